@@ -47,6 +47,8 @@ void hz_gl3_device_deinit(hz_renderer_gl3_t *g)
 {
     glDeleteBuffers(1,&g->glyphs_vbo);
     glDeleteVertexArrays(1,&g->glyphs_vao);
+    glDeleteTextures(1,&g->styles_tex);
+    glDeleteBuffers(1,&g->styles_tbo);
 }
 
 int hz_gl3_device_init(hz_renderer_gl3_t *g, hz_glyph_cache_opts_t *opts)
@@ -100,7 +102,20 @@ int hz_gl3_device_init(hz_renderer_gl3_t *g, hz_glyph_cache_opts_t *opts)
 
     glGenBuffers(1, &g->slots_ubo_handle);
     glBindBuffer(GL_UNIFORM_BUFFER, g->slots_ubo_handle);
-    glBufferData(GL_UNIFORM_BUFFER, sizeof(struct hz_cache_slot_t)*opts->x_cells*opts->y_cells, NULL, GL_STREAM_DRAW);
+    int slot_count = opts->x_cells*opts->y_cells;
+    if (opts->packing == HZ_GLYPH_CACHE_PACKING_SHELF && opts->max_glyphs > 0)
+        slot_count = opts->max_glyphs;
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(struct hz_cache_slot_t)*slot_count, NULL, GL_STREAM_DRAW);
+
+    // style table, one uvec4 per style
+    glGenBuffers(1, &g->styles_tbo);
+    glBindBuffer(GL_TEXTURE_BUFFER, g->styles_tbo);
+    glBufferData(GL_TEXTURE_BUFFER, 0, NULL, GL_STREAM_DRAW);
+    glGenTextures(1, &g->styles_tex);
+    glBindTexture(GL_TEXTURE_BUFFER, g->styles_tex);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32UI, g->styles_tbo);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
 
     g->opts = *opts;
     glGenFramebuffers(1, &g->fbo);
@@ -145,42 +160,37 @@ void hz_gl3_unbind_fb() {
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER,0);
 }
 
-void hz_gl3_refill_cache(hz_context_t *ctx, hz_renderer_gl3_t *g, uint16_t unavail_ids_sz, hz_cache_id_t *unavail_ids)
+void hz_gl3_refill_cache(hz_context_t *ctx, hz_renderer_gl3_t *g, size_t raster_count, hz_cache_id_t *raster_ids, uint16_t *raster_slots, hz_rect_t *raster_rects)
 {
     /*
-     * @NOTE: We should adjust the LRU cache API to move a lot of this logic insize hz.c.
-     * We want a clean interface and the implementation should only have to define a single slot fill function and pass it in
-     * to the context. Adding batch rendering into the atlas texture would also make this much more efficient but it requires some
+     * @NOTE: Slots are assigned by hz_frame_resolve, this only has to render the glyphs into them.
+     * Adding batch rendering into the atlas texture would also make this much more efficient but it requires some
      * planning. The goal is always to maintain simplicity.
      */
-    uint8_t buffer[1024];
-    hz_memory_arena_t arena = hz_memory_arena_create(buffer, sizeof(buffer));
-    uint16_t *open_slots = hz_memory_arena_alloc(&arena, sizeof(uint16_t)*unavail_ids_sz);
     hz_glyph_cache_t *lru = hz_context_get_lru(ctx);
-    hz_lru_cache_replace_slots(lru, unavail_ids_sz, open_slots);
     
     hz_vector(hz_vec4) clear_rects = NULL;
     hz_vector(hz_bezier_vertex_t) bezier_verts = NULL;
     hz_vector(hz_stencil_vertex_t) mask_verts = NULL;
     size_t bezier_vertex_count = 0;
 
-    for (uint16_t i = 0; i < unavail_ids_sz; ++i) {
-        hz_cache_id_t lru_id = unavail_ids[i];
-        uint16_t slot_index = open_slots[i];
+    for (size_t i = 0; i < raster_count; ++i) {
+        hz_cache_id_t lru_id = raster_ids[i];
+        uint16_t slot_index = raster_slots[i];
 
         // Get face needed to render this slot's glyph
         hz_face_t *face = hz_context_get_face(ctx, lru_id.font_id);
 
-        // Get Atlas bounds
-        float cellw = (float)g->opts.width / (float)g->opts.x_cells;
-        float cellh = (float)g->opts.height / (float)g->opts.y_cells;
-        float cellx = (float)(slot_index % g->opts.x_cells) * cellw;
-        float celly = (float)(slot_index / g->opts.y_cells) * cellh;
+        // Get Atlas bounds, a grid cell or a packed rect depending on the cache packing
+        float cellw = (float)raster_rects[i].w;
+        float cellh = (float)raster_rects[i].h;
+        float cellx = (float)raster_rects[i].x;
+        float celly = (float)raster_rects[i].y;
         // Add to clear rects
         hz_vec4 r = (hz_vec4){cellx, celly, cellw, cellh};
         hz_vector_push_back(clear_rects, r);
 
-        float scale = hz_face_scale_for_pixel_h(face, cellh);
+        float scale = hz_face_scale_for_pixel_h(face, hz_glyph_cache_glyph_height(&g->opts));
         hz_bbox_t bounds;
         hz_face_get_glyph_box(face, lru_id.glyph_id, &bounds);
 
@@ -358,119 +368,93 @@ void hz_gl3_refill_cache(hz_context_t *ctx, hz_renderer_gl3_t *g, uint16_t unava
 void hz_gl3_render_frame(hz_context_t *ctx, hz_renderer_gl3_t *g)
 {
     hz_command_list_t *cmds = hz_command_list_get(ctx);
-    hz_memory_arena_t *frame_arena = hz_get_frame_arena(ctx);
     hz_glyph_cache_t *lru = hz_context_get_lru(ctx);
-
-    if (hz_vector_size(cmds->draw_data)) {
-        size_t gid_ht_sz = hz_ht_size(cmds->unique_glyph_ht);
-
-        if (gid_ht_sz) {
-            hz_cache_id_t *avail_ids = hz_memory_arena_alloc(frame_arena, sizeof(hz_cache_id_t)*gid_ht_sz);
-            hz_cache_id_t *unavail_ids = hz_memory_arena_alloc(frame_arena, sizeof(hz_cache_id_t)*gid_ht_sz);
-
-            for(;;){
-                struct hz_cache_stat_t stat = hz_lru_cache_stat(lru, cmds->unique_glyph_ht,
-                                                            avail_ids, unavail_ids);
-
-                // Render glyphs
-                hz_vector(hz_glyph_instance_t) instance_glyphs = NULL;
-                // Build glyph instances
-                for (size_t v = 0; v < hz_vector_size(cmds->draw_data); ++v) {
-                    struct hz_cache_node_t *n;
-                    if ( (n = hz_lru_cache_get_node(lru, cmds->draw_data[v].lru_id)) != NULL ) {
-                        hz_glyph_instance_t p = cmds->draw_data[v];
-                        p.lru_id.u32 = n->slot;
-                        hz_vector_push_back(instance_glyphs, p);
-                    }
-                }
-
-                size_t glyphs_sz = hz_vector_size(instance_glyphs);
-
-                if (glyphs_sz) {
-                    glBindVertexArray(g->glyphs_vao);
-                    glBindBuffer(GL_ARRAY_BUFFER, g->glyphs_vbo);
-                    glBufferData(GL_ARRAY_BUFFER, sizeof(hz_glyph_instance_t)*glyphs_sz,
-                        instance_glyphs, GL_DYNAMIC_DRAW);
-
-                    // mvp
-                    glEnableVertexAttribArray(0);
-                    glEnableVertexAttribArray(1);
-                    glEnableVertexAttribArray(2);
-                    glEnableVertexAttribArray(3);
-                    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(hz_glyph_instance_t), (void *)offsetof(hz_glyph_instance_t,vp));
-                    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(hz_glyph_instance_t), (void *)(offsetof(hz_glyph_instance_t,vp) + sizeof(float)*4));
-                    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(hz_glyph_instance_t), (void *)(offsetof(hz_glyph_instance_t,vp) + sizeof(float)*8));
-                    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(hz_glyph_instance_t), (void *)(offsetof(hz_glyph_instance_t,vp) + sizeof(float)*12));
-                    glVertexAttribDivisor(0, 1);
-                    glVertexAttribDivisor(1, 1);
-                    glVertexAttribDivisor(2, 1);
-                    glVertexAttribDivisor(3, 1);
-
-                    // scale
-                    glEnableVertexAttribArray(4);
-                    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(hz_glyph_instance_t), (void *)offsetof(hz_glyph_instance_t, v4_ts));
-                    glVertexAttribDivisor(4, 1);
-                    // style vars
-                    glEnableVertexAttribArray(5);
-                    glVertexAttribIPointer(5, 4, GL_UNSIGNED_INT, sizeof(hz_glyph_instance_t), (void *)offsetof(hz_glyph_instance_t, sv));
-                    glVertexAttribDivisor(5, 1);
-
-                    // id
-                    glEnableVertexAttribArray(6);
-                    glVertexAttribIPointer(6, 1, GL_UNSIGNED_INT, sizeof(hz_glyph_instance_t), (void *)offsetof(hz_glyph_instance_t, lru_id));
-                    glVertexAttribDivisor(6, 1);
-
-                    glBindVertexArray(g->glyphs_vao);
-                    glUseProgram(g->char_quad_shader);
-
-                    GLuint block_index = glGetUniformBlockIndex(g->char_quad_shader, "u_cache_slots" );
-                    glBindBuffer(GL_UNIFORM_BUFFER, g->slots_ubo_handle);
-                    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(struct hz_cache_slot_t)*lru->sz, lru->slots );
-                    glBindBufferBase(GL_UNIFORM_BUFFER, block_index, g->slots_ubo_handle);
-
-                    glBindTexture(GL_TEXTURE_2D, g->sdf_texture);
-                    glEnable(GL_BLEND);
-                    glDisable(GL_CULL_FACE);
-                    glDisable(GL_DEPTH_TEST);
-                    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-                    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, glyphs_sz);
-                    glBindVertexArray(0);
+    hz_bool done = HZ_FALSE;
+
+    // the style table is shared by every batch of the frame
+    glBindBuffer(GL_TEXTURE_BUFFER, g->styles_tbo);
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(hz_glyph_style_t)*hz_vector_size(cmds->styles),
+        cmds->styles, GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    while (!done) {
+        hz_frame_result_t res;
+        done = hz_frame_resolve(ctx, &res);
+
+        if (res.raster_count) {
+            // Write glyphs into texture
+            hz_gl3_bind_fb(g);
+            // Clear stencil from previous operations
+            glClear(GL_STENCIL_BUFFER_BIT);
+            glViewport(0,0, g->opts.width, g->opts.height);
+            // Update UBO
+            glUseProgram(g->curve_to_sdf_program);
+            g->ubo_data.max_sdf_distance = g->opts.max_sdf_distance;
+            g->ubo_data.view_matrix = hz_mat4_ortho(0.0f,g->opts.width,0.0f,g->opts.height);
+
+            {
+                GLuint block_index = glGetUniformBlockIndex( g->curve_to_sdf_program, "UboData" );
+                if (block_index == GL_INVALID_INDEX) {
+                    fprintf(stderr,"Block index invalid 1!\n");
+                    exit(-1);
                 }
 
-                // TODO: Remove drawn glyphs from ht
-
-                hz_vector_destroy(instance_glyphs); // destroy glyph instances buffer
-
-                if (!stat.unavail) {
-                    break;
-                }
+                glBindBuffer(GL_UNIFORM_BUFFER, g->ubo_handle);
+                glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(hz_gl3_ubo_data_t), &g->ubo_data);
+                glBindBufferBase(GL_UNIFORM_BUFFER, block_index, g->ubo_handle);
+            }
 
-                // Write glyphs into texture
-                hz_gl3_bind_fb(g);
-                // Clear stencil from previous operations
-                glClear(GL_STENCIL_BUFFER_BIT);
-                glViewport(0,0, g->opts.width, g->opts.height);
-                // Update UBO
-                glUseProgram(g->curve_to_sdf_program);
-                g->ubo_data.max_sdf_distance = g->opts.max_sdf_distance;
-                g->ubo_data.view_matrix = hz_mat4_ortho(0.0f,g->opts.width,0.0f,g->opts.height);
-
-                {
-                    GLuint block_index = glGetUniformBlockIndex( g->curve_to_sdf_program, "UboData" );
-                    if (block_index == GL_INVALID_INDEX) {
-                        fprintf(stderr,"Block index invalid 1!\n");
-                        exit(-1);
-                    }
-
-                    glBindBuffer(GL_UNIFORM_BUFFER, g->ubo_handle);
-                    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(hz_gl3_ubo_data_t), &g->ubo_data);
-                    glBindBufferBase(GL_UNIFORM_BUFFER, block_index, g->ubo_handle);
-                }
+            hz_gl3_refill_cache(ctx, g, res.raster_count, res.raster_ids, res.raster_slots, res.raster_rects);
+            hz_gl3_unbind_fb();
+        }
 
-                hz_gl3_refill_cache(ctx, g, stat.unavail, unavail_ids);
-                hz_gl3_unbind_fb();
-            }
+        // Render glyphs, instances already carry their resolved slot
+        size_t glyphs_sz = res.instance_count;
+        hz_glyph_instance_t *instance_glyphs = cmds->draw_data + res.first_instance;
+
+        if (glyphs_sz) {
+            glBindVertexArray(g->glyphs_vao);
+            glBindBuffer(GL_ARRAY_BUFFER, g->glyphs_vbo);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(hz_glyph_instance_t)*glyphs_sz,
+                instance_glyphs, GL_DYNAMIC_DRAW);
+
+            // position
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(hz_glyph_instance_t), (void *)offsetof(hz_glyph_instance_t, x));
+            glVertexAttribDivisor(0, 1);
+            // size, fixed point
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(hz_glyph_instance_t), (void *)offsetof(hz_glyph_instance_t, w));
+            glVertexAttribDivisor(1, 1);
+            // style index and slot
+            glEnableVertexAttribArray(2);
+            glVertexAttribIPointer(2, 2, GL_UNSIGNED_SHORT, sizeof(hz_glyph_instance_t), (void *)offsetof(hz_glyph_instance_t, style));
+            glVertexAttribDivisor(2, 1);
+
+            glBindVertexArray(g->glyphs_vao);
+            glUseProgram(g->char_quad_shader);
+
+            // the camera is per batch
+            glUniformMatrix4fv(glGetUniformLocation(g->char_quad_shader, "u_vp"), 1, GL_FALSE, res.camera.f);
+            glUniform1f(glGetUniformLocation(g->char_quad_shader, "u_size_scale"), 1.0f / HZ_GLYPH_INSTANCE_SIZE_SCALE);
+            glUniform1i(glGetUniformLocation(g->char_quad_shader, "u_styles"), 1);
+            glActiveTexture(GL_TEXTURE1);
+            glBindTexture(GL_TEXTURE_BUFFER, g->styles_tex);
+            glActiveTexture(GL_TEXTURE0);
+
+            GLuint block_index = glGetUniformBlockIndex(g->char_quad_shader, "u_cache_slots" );
+            glBindBuffer(GL_UNIFORM_BUFFER, g->slots_ubo_handle);
+            glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(struct hz_cache_slot_t)*lru->sz, lru->slots );
+            glBindBufferBase(GL_UNIFORM_BUFFER, block_index, g->slots_ubo_handle);
+
+            glBindTexture(GL_TEXTURE_2D, g->sdf_texture);
+            glEnable(GL_BLEND);
+            glDisable(GL_CULL_FACE);
+            glDisable(GL_DEPTH_TEST);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 6, glyphs_sz);
+            glBindVertexArray(0);
         }
     }
-}
\ No newline at end of file
+}
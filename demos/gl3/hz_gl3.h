@@ -39,6 +39,7 @@ typedef struct {
     hz_gl3_ubo_data_t ubo_data;
 
     GLuint slots_ubo_handle;
+    GLuint styles_tbo, styles_tex; // frame style table, read with texelFetch
     hz_glyph_cache_opts_t opts;
 } hz_renderer_gl3_t;
 
@@ -397,10 +397,13 @@ static const char hz_gl3_char_quad_vsh[] =
 "#extension GL_ARB_separate_shader_objects : enable\n"
 "#define MAX_SLOTS_BUFFER_SIZE 1024\n"
 "\n"
-"layout(location = 0) in mat4 v_vp;\n"
-"layout(location = 4) in vec4 v_ts;\n"
-"layout(location = 5) in uvec4 v_style_vars; // u32 col, u32 outline_col, u32 glow_outline, u32 weight_shear\n"
-"layout(location = 6) in uint v_lru_id;\n"
+"layout(location = 0) in vec2 v_pos;\n"
+"layout(location = 1) in vec2 v_size; // fixed point, scaled by u_size_scale\n"
+"layout(location = 2) in uvec2 v_style_slot; // style table index, cache slot\n"
+"\n"
+"uniform mat4 u_vp;\n"
+"uniform float u_size_scale;\n"
+"uniform usamplerBuffer u_styles; // u32 col, u32 outline_col, u32 glow_outline, u32 weight_shear\n"
 "\n"
 "vec4 unpack_color32(uint var){\n"
 "    return vec4(\n"
@@ -445,18 +448,19 @@ static const char hz_gl3_char_quad_vsh[] =
 "\n"
 "void main(){\n"
 "    vec2 q = quad_vertices[gl_VertexID];\n"
-"    uint weight_and_shear = v_style_vars[3];\n"
+"    uvec4 style_vars = texelFetch(u_styles, int(v_style_slot.x));\n"
+"    uint weight_and_shear = style_vars[3];\n"
 "    float shear = float(weight_and_shear & 0xffffu) / 65535.0;\n"
-"    mat4 mvp = v_vp * make_shear_matrix(shear);\n"
+"    mat4 mvp = u_vp * make_shear_matrix(shear);\n"
 "\n"
-"    vec3 px = vec3(mvp * vec4(v_ts.xy+q*v_ts.zw, 0.0, 1.0));\n"
+"    vec3 px = vec3(mvp * vec4(v_pos+q*v_size*u_size_scale, 0.0, 1.0));\n"
 "    gl_Position = vec4(px,1.0);\n"
-"    slot s = slots[v_lru_id];\n"
+"    slot s = slots[v_style_slot.y];\n"
 "    f_texcoords = mix(vec2(s.u0,s.v0),vec2(s.u1,s.v1),q);\n"
 "\n"
 "    // Pass style vars to fragment shader\n"
-"    f_color = unpack_color32(v_style_vars[0]);\n"
-"    f_outline_color = unpack_color32(v_style_vars[1]);\n"
+"    f_color = unpack_color32(style_vars[0]);\n"
+"    f_outline_color = unpack_color32(style_vars[1]);\n"
 "}\n"
 };
 
@@ -192,7 +192,9 @@ int main(int argc, char *argv[])
         .max_sdf_distance = 8.0f, 
         .padd = 0.0f,
         .x_cells = 16,
-        .y_cells = 16
+        .y_cells = 16,
+        .packing = HZ_GLYPH_CACHE_PACKING_SHELF,
+        .max_glyphs = 1024 // MAX_SLOTS_BUFFER_SIZE in char_quad.vert
     };
 
     hz_context_t *ctx = hz_context_create(&cache_opts);
@@ -413,7 +415,6 @@ int main(int argc, char *argv[])
         //                         .scale = 1.0f
         //                     },
         //                     24.0f);
-        hz_frame_end(ctx);
         hz_gl3_render_frame(ctx, &g);
 
         // glBindVertexArray(emptyVAO);
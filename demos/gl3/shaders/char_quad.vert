@@ -2,10 +2,13 @@
 #extension GL_ARB_separate_shader_objects : enable
 #define MAX_SLOTS_BUFFER_SIZE 1024
 
-layout(location = 0) in mat4 v_vp;
-layout(location = 4) in vec4 v_ts;
-layout(location = 5) in uvec4 v_style_vars; // u32 col, u32 outline_col, u32 glow_outline, u32 weight_shear
-layout(location = 6) in uint v_lru_id;
+layout(location = 0) in vec2 v_pos;
+layout(location = 1) in vec2 v_size; // fixed point, scaled by u_size_scale
+layout(location = 2) in uvec2 v_style_slot; // style table index, cache slot
+
+uniform mat4 u_vp;
+uniform float u_size_scale;
+uniform usamplerBuffer u_styles; // u32 col, u32 outline_col, u32 glow_outline, u32 weight_shear
 
 vec4 unpack_color32(uint var){
     return vec4(
@@ -50,16 +53,17 @@ mat4 make_shear_matrix(float s)
 
 void main(){
     vec2 q = quad_vertices[gl_VertexID];
-    uint weight_and_shear = v_style_vars[3];
+    uvec4 style_vars = texelFetch(u_styles, int(v_style_slot.x));
+    uint weight_and_shear = style_vars[3];
     float shear = float(weight_and_shear & 0xffffu) / 65535.0;
-    mat4 mvp = v_vp * make_shear_matrix(shear);
+    mat4 mvp = u_vp * make_shear_matrix(shear);
 
-    vec3 px = vec3(mvp * vec4(v_ts.xy+q*v_ts.zw, 0.0, 1.0));
+    vec3 px = vec3(mvp * vec4(v_pos+q*v_size*u_size_scale, 0.0, 1.0));
     gl_Position = vec4(px,1.0);
-    slot s = slots[v_lru_id];
+    slot s = slots[v_style_slot.y];
     f_texcoords = mix(vec2(s.u0,s.v0),vec2(s.u1,s.v1),q);
 
     // Pass style vars to fragment shader
-    f_color = unpack_color32(v_style_vars[0]);
-    f_outline_color = unpack_color32(v_style_vars[1]);
+    f_color = unpack_color32(style_vars[0]);
+    f_outline_color = unpack_color32(style_vars[1]);
 }
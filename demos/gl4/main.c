@@ -1,5 +1,4 @@
 
-#include "../../hz/hz_ucd_5_2_0.h"
 #define HZ_IMPLEMENTATION
 #define HZ_DEBUG_LOGGING
 #include "../../hz/hz.h"
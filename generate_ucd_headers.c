@@ -10,615 +10,1253 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+#include <ctype.h>
 
-#if _WIN32
-#define WIN32_LEAN_AND_MEAN
-#include <windows.h>
-#endif
+#define UNICODE_CODEPOINT_COUNT 0x110000
+#define PROPERTY_BLOCK_SHIFT 7
+#define PROPERTY_BLOCK_SIZE (1 << PROPERTY_BLOCK_SHIFT)
+#define COUNTOF(_A) ((int)(sizeof(_A)/sizeof((_A)[0])))
 
-#include <regex.h>
-#include <assert.h>
-
-#define INTS_PER_LINE 6
-
-typedef struct {
-    uint32_t codepoint;
-    char *comment;
-    int comment_len;
-    char joining_type;
-    char *joining_group;
-    int joining_group_len;
-} arabic_joining_data_t;
+static int find_property_value(const char **names, int name_count, const char *name, int len)
+{
+    for (int i = 0; i < name_count; ++i) {
+        if ((int)strlen(names[i]) == len && !strncmp(names[i], name, len))
+            return i;
+    }
+    return -1;
+}
 
-typedef struct {
-    uint32_t codepoint;
-    char name[25];
-} jamo_t;
+// Reads an enumerated property from a UCD file of "first..last ; value" lines into values, one byte
+// per codepoint holding the value's index in names. Unlisted codepoints keep the values they have
+// unless given a default in comments as "# @missing: 0000..10FFFF; XX", with missing_only just the
+// defaults are read.
+static int read_property_file_into(const char *path, const char **names, int name_count, int missing_only,
+                                   uint8_t *values)
+{
+    FILE *in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return 0;
+    }
 
-typedef struct {
-    char *txt[5];
-    size_t sizes[5];
-} property_value_alias_t;
+    char line[512];
+    while (fgets(line, sizeof(line), in)) {
+        char *s = line;
+        if (!strncmp(s, "# @missing:", 11)) s += 11;
+        else if (*s == '#' || missing_only) continue;
+
+        unsigned int first, last;
+        int n;
+        if (sscanf(s, " %x..%x%n", &first, &last, &n) == 2) {
+        } else if (sscanf(s, " %x%n", &first, &n) == 1) {
+            last = first;
+        } else {
+            continue;
+        }
 
-#define BUCKET_MAX_INDICES 64
+        s += n;
+        while (*s == ' ' || *s == ';') ++s;
+        int len = 0;
+        while (isalnum((unsigned char)s[len]) || s[len] == '_') ++len;
+        int v = find_property_value(names, name_count, s, len);
+        if (v < 0 || last >= UNICODE_CODEPOINT_COUNT) {
+            fprintf(stderr, "Unexpected line: %s", line);
+            continue;
+        }
 
-typedef struct {
-    int size;
-    uint32_t indices[BUCKET_MAX_INDICES];
-} mph_bucket_t;
+        memset(values + first, v, last - first + 1);
+    }
+    fclose(in);
+    return 1;
+}
 
-typedef struct {
-    int32_t *k2;
-    void *values;
-    size_t value_size;
-    size_t size;
-} mph_table_t;
-
-// 32-bit hash functions
-uint32_t hash2_lowbias32(uint32_t k1, uint32_t k2)
+// Reads a property file like read_property_file_into, unlisted codepoints without a default are 0.
+static uint8_t *read_property_file(const char *path, const char **names, int name_count)
 {
-    uint32_t h = k1;
-    h ^= h >> 16;
-    h *= 0x7feb352d;
-    h ^= h >> 15;
-    h *= 0x846ca68b;
-    h ^= h >> 16;
-
-    h ^= k2;
-    h ^= h >> 16;
-    h *= 0x7feb352d;
-    h ^= h >> 15;
-    h *= 0x846ca68b;
-    h ^= h >> 16;
-    return h;
+    uint8_t *values = calloc(UNICODE_CODEPOINT_COUNT, 1);
+    if (!read_property_file_into(path, names, name_count, 0, values)) {
+        free(values);
+        return NULL;
+    }
+    return values;
 }
 
-int compare_mph_buckets(const void *lhs, const void *rhs)
+// Writes values as a two-stage lookup table named hz_ucd_<name>_stage1/2. Stage one maps each
+// block of 128 codepoints to a deduplicated block of values in stage two, blocks past the last
+// one that isn't all zero are left out.
+static void write_two_stage_table(FILE *f, const char *name, const char *macro_name, const uint8_t *values)
 {
-    return ((const mph_bucket_t*)rhs)->size - ((const mph_bucket_t*)lhs)->size;
+    int block_count = UNICODE_CODEPOINT_COUNT / PROPERTY_BLOCK_SIZE;
+    while (block_count > 1) {
+        const uint8_t *b = values + (block_count - 1) * PROPERTY_BLOCK_SIZE;
+        int all_zero = 1;
+        for (int i = 0; i < PROPERTY_BLOCK_SIZE; ++i) all_zero &= b[i] == 0;
+        if (!all_zero) break;
+        --block_count;
+    }
+
+    uint16_t *stage1 = malloc(block_count * sizeof(uint16_t));
+    uint8_t *stage2 = malloc(block_count * PROPERTY_BLOCK_SIZE);
+    int unique_count = 0;
+    for (int i = 0; i < block_count; ++i) {
+        const uint8_t *b = values + i * PROPERTY_BLOCK_SIZE;
+        int j;
+        for (j = 0; j < unique_count; ++j)
+            if (!memcmp(stage2 + j * PROPERTY_BLOCK_SIZE, b, PROPERTY_BLOCK_SIZE)) break;
+        if (j == unique_count)
+            memcpy(stage2 + unique_count++ * PROPERTY_BLOCK_SIZE, b, PROPERTY_BLOCK_SIZE);
+        stage1[i] = (uint16_t)j;
+    }
+
+    fprintf(f, "#define HZ_UCD_%s_BLOCK_SHIFT %d\n", macro_name, PROPERTY_BLOCK_SHIFT);
+    fprintf(f, "#define HZ_UCD_%s_BLOCK_COUNT %d\n\n", macro_name, block_count);
+
+    fprintf(f, "static const uint16_t hz_ucd_%s_stage1[%d] = {", name, block_count);
+    for (int i = 0; i < block_count; ++i) {
+        if (!(i % 16)) fprintf(f, "\n    ");
+        fprintf(f, "%3d,", stage1[i]);
+    }
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static const uint8_t hz_ucd_%s_stage2[%d] = {", name, unique_count * PROPERTY_BLOCK_SIZE);
+    for (int i = 0; i < unique_count * PROPERTY_BLOCK_SIZE; ++i) {
+        if (!(i % 32)) fprintf(f, "\n    ");
+        fprintf(f, "%2d,", stage2[i]);
+    }
+    fprintf(f, "\n};\n\n");
+
+    printf("%s: %d blocks, %d unique\n", name, block_count, unique_count);
+    free(stage1);
+    free(stage2);
 }
 
-int popvalue(int *arr, int *size, int index)
+// Line break classes in the order of hz_line_break_class_t, XX first so that zeroed entries
+// are unknown.
+static const char *line_break_class_names[] = {
+    "XX","BK","CR","LF","CM","NL","SG","WJ","ZW","GL","SP","ZWJ","B2","BA","BB","HY","CB",
+    "CL","CP","EX","IN","NS","OP","QU","IS","NU","PO","PR","SY","AI","AL","CJ","EB","EM",
+    "H2","H3","HL","ID","JL","JV","JT","RI","SA"
+};
+
+// Writes the line break class enum and reads the classes from LineBreak.txt into classes_out for
+// the property table.
+int generate_line_break_header(const char *line_break_path, const char *out_path, uint8_t **classes_out)
 {
-    int val = arr[index];
-    for (int i = index; i < (*size); ++i) {
-        arr[i] = arr[i+1];
+    uint8_t *classes = read_property_file(line_break_path, line_break_class_names, COUNTOF(line_break_class_names));
+    if (!classes) return -1;
+
+    FILE *f = fopen(out_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", out_path);
+        free(classes);
+        return -1;
     }
 
-    (*size) --;
-    return val;
+    fprintf(f, "#ifndef HZ_UCD_LINE_BREAK_H\n#define HZ_UCD_LINE_BREAK_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from LineBreak.txt\n\n");
+    fprintf(f, "typedef enum {");
+    for (int i = 0; i < COUNTOF(line_break_class_names); ++i)
+        fprintf(f, "\n    HZ_LINE_BREAK_CLASS_%s,", line_break_class_names[i]);
+    fprintf(f, "\n    HZ_LINE_BREAK_CLASS_COUNT\n} hz_line_break_class_t;\n\n");
+
+    fprintf(f, "#endif /* HZ_UCD_LINE_BREAK_H */\n");
+    fclose(f);
+    *classes_out = classes;
+    return 0;
 }
 
-int binsearch(int *arr,int size, int val) {
-    int low,mid,high;
-    low = 0; high = size;
-
-    while (low <= high) {
-        mid = (low + high) >> 1;
-        if (val < arr[mid]) { // less
-            high = mid-1;
-        } else if (val > arr[mid]) { // greater
-            low = mid+1;
-        } else { // equal
-            return mid;
-        }
+// Bidi classes in the order of hz_bidi_class_t, L first as it is the default of unlisted
+// codepoints.
+static const char *bidi_class_names[] = {
+    "L","R","AL","EN","ES","ET","AN","CS","NSM","BN","B","S","WS","ON",
+    "LRE","LRO","RLE","RLO","PDF","LRI","RLI","FSI","PDI"
+};
+
+// Writes the bidi class enum and the sorted paired bracket list from BidiBrackets.txt, the classes
+// from DerivedBidiClass.txt go to classes_out for the property table.
+int generate_bidi_header(const char *bidi_class_path, const char *brackets_path, const char *out_path,
+                         uint8_t **classes_out)
+{
+    uint8_t *classes = read_property_file(bidi_class_path, bidi_class_names, COUNTOF(bidi_class_names));
+    if (!classes) return -1;
+
+    FILE *in = fopen(brackets_path, "r");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", brackets_path);
+        free(classes);
+        return -1;
     }
 
-    return -1;
-}
+    FILE *f = fopen(out_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", out_path);
+        fclose(in);
+        free(classes);
+        return -1;
+    }
 
-void arraypush(int *arr, int *size, int val) {
-    arr[(*size)++] = val;
+    fprintf(f, "#ifndef HZ_UCD_BIDI_H\n#define HZ_UCD_BIDI_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from DerivedBidiClass.txt and BidiBrackets.txt\n\n");
+    fprintf(f, "typedef enum {");
+    for (int i = 0; i < COUNTOF(bidi_class_names); ++i)
+        fprintf(f, "\n    HZ_BIDI_CLASS_%s,", bidi_class_names[i]);
+    fprintf(f, "\n    HZ_BIDI_CLASS_COUNT\n} hz_bidi_class_t;\n\n");
+
+    // codepoint, paired bracket and 1 for opening or 2 for closing brackets
+    char line[512];
+    int bracket_count = 0;
+    fprintf(f, "static const uint32_t hz_ucd_bidi_brackets[][3] = {");
+    while (fgets(line, sizeof(line), in)) {
+        unsigned int c, pair;
+        char type;
+        if (line[0] == '#' || sscanf(line, " %x ; %x ; %c", &c, &pair, &type) != 3) continue;
+        if (!(bracket_count % 4)) fprintf(f, "\n    ");
+        fprintf(f, "{0x%04X,0x%04X,%d},", c, pair, type == 'o' ? 1 : 2);
+        ++bracket_count;
+    }
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "#define HZ_UCD_BIDI_BRACKET_COUNT %d\n\n", bracket_count);
+    fprintf(f, "#endif /* HZ_UCD_BIDI_H */\n");
+
+    fclose(in);
+    fclose(f);
+    *classes_out = classes;
+    return 0;
 }
 
-void bininsert(int *arr, int *size, int val) {
-    int low,mid,high;
-    low = 0; high = *size;
-    mid = (low + high) >> 1;
-
-    while (low <= high) {
-        mid = (low + high) >> 1;
-        if (val < arr[mid]) { // lesser
-            high = mid-1;
-        } else if (val > arr[mid]) { // greater
-            low = mid+1;
-        } else { // equal
-            break;
+// Long and short script names in the order of hz_script_t in hz_data_tables.h. Odia is an alias
+// of Oriya kept by the enum, it is never used by the data.
+static const char *script_names[][2] = {
+    {"Common","Zyyy"}, {"Latin","Latn"}, {"Greek","Grek"}, {"Cyrillic","Cyrl"},
+    {"Armenian","Armn"}, {"Hebrew","Hebr"}, {"Arabic","Arab"}, {"Syriac","Syrc"},
+    {"Thaana","Thaa"}, {"Devanagari","Deva"}, {"Bengali","Beng"}, {"Gurmukhi","Guru"},
+    {"Gujarati","Gujr"}, {"Oriya","Orya"}, {"Tamil","Taml"}, {"Telugu","Telu"},
+    {"Kannada","Knda"}, {"Malayalam","Mlym"}, {"Odia",""}, {"Sinhala","Sinh"},
+    {"Thai","Thai"}, {"Lao","Laoo"}, {"Tibetan","Tibt"}, {"Myanmar","Mymr"},
+    {"Georgian","Geor"}, {"Hangul","Hang"}, {"Ethiopic","Ethi"}, {"Cherokee","Cher"},
+    {"Canadian_Aboriginal","Cans"}, {"Ogham","Ogam"}, {"Runic","Runr"}, {"Khmer","Khmr"},
+    {"Mongolian","Mong"}, {"Hiragana","Hira"}, {"Katakana","Kana"}, {"Bopomofo","Bopo"},
+    {"Han","Hani"}, {"Yi","Yiii"}, {"Old_Italic","Ital"}, {"Gothic","Goth"},
+    {"Deseret","Dsrt"}, {"Inherited","Zinh"}, {"Tagalog","Tglg"}, {"Hanunoo","Hano"},
+    {"Buhid","Buhd"}, {"Tagbanwa","Tagb"}, {"Limbu","Limb"}, {"Tai_Le","Tale"},
+    {"Linear_B","Linb"}, {"Ugaritic","Ugar"}, {"Shavian","Shaw"}, {"Osmanya","Osma"},
+    {"Cypriot","Cprt"}, {"Braille","Brai"}, {"Buginese","Bugi"}, {"Coptic","Copt"},
+    {"New_Tai_Lue","Talu"}, {"Glagolitic","Glag"}, {"Tifinagh","Tfng"}, {"Syloti_Nagri","Sylo"},
+    {"Old_Persian","Xpeo"}, {"Kharoshthi","Khar"}, {"Balinese","Bali"}, {"Cuneiform","Xsux"},
+    {"Phoenician","Phnx"}, {"Phags_Pa","Phag"}, {"Nko","Nkoo"}, {"Sundanese","Sund"},
+    {"Lepcha","Lepc"}, {"Ol_Chiki","Olck"}, {"Vai","Vaii"}, {"Saurashtra","Saur"},
+    {"Kayah_Li","Kali"}, {"Rejang","Rjng"}, {"Lycian","Lyci"}, {"Carian","Cari"},
+    {"Lydian","Lydi"}, {"Cham","Cham"}, {"Tai_Tham","Lana"}, {"Tai_Viet","Tavt"},
+    {"Avestan","Avst"}, {"Egyptian_Hieroglyphs","Egyp"}, {"Samaritan","Samr"}, {"Lisu","Lisu"},
+    {"Bamum","Bamu"}, {"Javanese","Java"}, {"Meetei_Mayek","Mtei"}, {"Imperial_Aramaic","Armi"},
+    {"Old_South_Arabian","Sarb"}, {"Inscriptional_Parthian","Prti"}, {"Inscriptional_Pahlavi","Phli"}, {"Old_Turkic","Orkh"},
+    {"Kaithi","Kthi"}, {"Batak","Batk"}, {"Brahmi","Brah"}, {"Mandaic","Mand"},
+    {"Chakma","Cakm"}, {"Meroitic_Cursive","Merc"}, {"Meroitic_Hieroglyphs","Mero"}, {"Miao","Plrd"},
+    {"Sharada","Shrd"}, {"Sora_Sompeng","Sora"}, {"Takri","Takr"}, {"Caucasian_Albanian","Aghb"},
+    {"Bassa_Vah","Bass"}, {"Duployan","Dupl"}, {"Elbasan","Elba"}, {"Grantha","Gran"},
+    {"Pahawh_Hmong","Hmng"}, {"Khojki","Khoj"}, {"Linear_A","Lina"}, {"Mahajani","Mahj"},
+    {"Manichaean","Mani"}, {"Mende_Kikakui","Mend"}, {"Modi","Modi"}, {"Mro","Mroo"},
+    {"Old_North_Arabian","Narb"}, {"Nabataean","Nbat"}, {"Palmyrene","Palm"}, {"Pau_Cin_Hau","Pauc"},
+    {"Old_Permic","Perm"}, {"Psalter_Pahlavi","Phlp"}, {"Siddham","Sidd"}, {"Khudawadi","Sind"},
+    {"Tirhuta","Tirh"}, {"Warang_Citi","Wara"}, {"Ahom","Ahom"}, {"Anatolian_Hieroglyphs","Hluw"},
+    {"Hatran","Hatr"}, {"Multani","Mult"}, {"Old_Hungarian","Hung"}, {"SignWriting","Sgnw"},
+    {"Adlam","Adlm"}, {"Bhaiksuki","Bhks"}, {"Marchen","Marc"}, {"Newa","Newa"},
+    {"Osage","Osge"}, {"Tangut","Tang"}, {"Masaram_Gondi","Gonm"}, {"Nushu","Nshu"},
+    {"Soyombo","Soyo"}, {"Zanabazar_Square","Zanb"}, {"Dogra","Dogr"}, {"Gunjala_Gondi","Gong"},
+    {"Makasar","Maka"}, {"Medefaidrin","Medf"}, {"Hanifi_Rohingya","Rohg"}, {"Sogdian","Sogd"},
+    {"Old_Sogdian","Sogo"}, {"Elymaic","Elym"}, {"Nandinagari","Nand"}, {"Nyiakeng_Puachue_Hmong","Hmnp"},
+    {"Wancho","Wcho"}, {"Chorasmian","Chrs"}, {"Dives_Akuru","Diak"}, {"Khitan_Small_Script","Kits"},
+    {"Yezidi","Yezi"}, {"Cypro_Minoan","Cpmn"}, {"Old_Uyghur","Ougr"}, {"Tangsa","Tnsa"},
+    {"Toto","Toto"}, {"Vithkuqi","Vith"}, {"Kawi","Kawi"}, {"Nag_Mundari","Nagm"},
+    {"Unknown","Zzzz"}
+};
+
+// Reads the scripts from Scripts.txt into scripts_out and the script values from it and
+// ScriptExtensions.txt into values_out for the property table. Codepoints whose Script_Extensions
+// differ from their script store an index past the last script into a list of sets written here,
+// each one the script, the number of extensions and the extensions in file order.
+int generate_script_header(const char *scripts_path, const char *extensions_path, const char *out_path,
+                           uint8_t **scripts_out, uint8_t **values_out)
+{
+    const char *long_names[COUNTOF(script_names)];
+    for (int i = 0; i < COUNTOF(script_names); ++i) long_names[i] = script_names[i][0];
+
+    uint8_t *values = read_property_file(scripts_path, long_names, COUNTOF(script_names));
+    if (!values) return -1;
+    uint8_t *scripts = malloc(UNICODE_CODEPOINT_COUNT);
+    memcpy(scripts, values, UNICODE_CODEPOINT_COUNT);
+
+    FILE *in = fopen(extensions_path, "r");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", extensions_path);
+        free(values);
+        free(scripts);
+        return -1;
+    }
+
+    FILE *f = fopen(out_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", out_path);
+        fclose(in);
+        free(values);
+        free(scripts);
+        return -1;
+    }
+
+    int base = COUNTOF(script_names);
+    uint8_t sets[256][64];
+    int set_count = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), in)) {
+        unsigned int first, last;
+        int n;
+        if (line[0] == '#') continue;
+        if (sscanf(line, " %x..%x%n", &first, &last, &n) == 2) {
+        } else if (sscanf(line, " %x%n", &first, &n) == 1) {
+            last = first;
+        } else {
+            continue;
+        }
+
+        for (unsigned int c = first; c <= last; ++c) {
+            uint8_t set[64] = {values[c], 0};
+            for (char *s = line + n; *s && *s != '#';) {
+                while (*s == ' ' || *s == ';') ++s;
+                int len = 0;
+                while (isalnum((unsigned char)s[len])) ++len;
+                if (!len) break;
+
+                int v = -1;
+                for (int i = 0; i < base && v < 0; ++i)
+                    if ((int)strlen(script_names[i][1]) == len && !strncmp(script_names[i][1], s, len)) v = i;
+                if (v < 0 || set[1] == 62) {
+                    fprintf(stderr, "Unexpected line: %s", line);
+                    break;
+                }
+
+                set[2 + set[1]++] = (uint8_t)v;
+                s += len;
+            }
+
+            int j;
+            for (j = 0; j < set_count; ++j)
+                if (!memcmp(sets[j], set, 2 + set[1])) break;
+            if (j == set_count) {
+                if (base + set_count == 256) {
+                    fprintf(stderr, "Too many script extension sets\n");
+                    fclose(in);
+                    fclose(f);
+                    free(values);
+                    free(scripts);
+                    return -1;
+                }
+                memcpy(sets[set_count++], set, sizeof(set));
+            }
+
+            values[c] = (uint8_t)(base + j);
         }
     }
 
-    (*size) ++;
-    for (int i = (*size)-1; i > mid; --i) {
-        arr[i] = arr[i-1];
+    fprintf(f, "#ifndef HZ_UCD_SCRIPT_H\n#define HZ_UCD_SCRIPT_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from Scripts.txt and ScriptExtensions.txt\n\n");
+    fprintf(f, "// values from HZ_UCD_SCRIPT_EXTENSIONS_BASE on index hz_ucd_script_extension_offsets\n");
+    fprintf(f, "#define HZ_UCD_SCRIPT_EXTENSIONS_BASE %d\n\n", base);
+
+    // script, extension count and extensions of each set
+    int offset = 0;
+    fprintf(f, "static const uint16_t hz_ucd_script_extension_offsets[%d] = {", set_count);
+    for (int i = 0; i < set_count; ++i) {
+        if (!(i % 16)) fprintf(f, "\n    ");
+        fprintf(f, "%3d,", offset);
+        offset += 2 + sets[i][1];
     }
+    fprintf(f, "\n};\n\n");
 
-    arr[mid] = val;
+    fprintf(f, "static const uint8_t hz_ucd_script_extension_data[%d] = {", offset);
+    for (int i = 0; i < set_count; ++i) {
+        fprintf(f, "\n    ");
+        for (int k = 0; k < 2 + sets[i][1]; ++k) fprintf(f, "%d,", sets[i][k]);
+    }
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "#endif /* HZ_UCD_SCRIPT_H */\n");
+
+    fclose(in);
+    fclose(f);
+    *scripts_out = scripts;
+    *values_out = values;
+    return 0;
 }
 
-int occurcnt(int *arr, int size, int val)
+#define MAX_DECOMPOSITION 32
+
+typedef struct {
+    uint8_t length;
+    uint8_t compat;
+    uint32_t chars[MAX_DECOMPOSITION];
+} decomposition_t;
+
+// Appends the full decomposition of c to out, applying canonical mappings only unless compat is set.
+static void expand_decomposition(const decomposition_t *mappings, uint32_t c, int compat, decomposition_t *out)
 {
-    int cnt = 0;
-    for (int i =0; i < size; ++i) {
-        cnt += (arr[i] == val);
+    const decomposition_t *m = &mappings[c];
+    if (!m->length || (m->compat && !compat)) {
+        out->chars[out->length++] = c;
+        return;
     }
-    return cnt;
+
+    for (int i = 0; i < m->length; ++i)
+        expand_decomposition(mappings, m->chars[i], compat, out);
 }
 
-void mph_table_init(mph_table_t t[static 1], uint32_t *keys, void *values,
-                    size_t value_size, size_t num_values, uint32_t (*hash)(uint32_t, uint32_t))
+static int compare_compositions(const void *lhs, const void *rhs)
 {
-    mph_bucket_t *buckets = calloc(num_values, sizeof(mph_bucket_t)); // Index buckets
-    t->k2 = calloc(num_values, sizeof(int32_t)); // Secondary Hash Array (for Collision Resolution)
-    t->value_size = value_size;
-    t->size = num_values;
-    t->values = malloc(num_values * value_size); // Ordered values
-
-    // Store keys in appropriate buckets
-    for (int i=0; i<num_values; ++i) {
-        uint32_t h = hash(keys[i],0)%num_values;
-        mph_bucket_t *bucket = &buckets[h];
-        bucket->indices[bucket->size++] = i;
-    }
-
-    // Sort the buckets and process in decreasing order (largest -> smallest)
-    qsort(buckets, num_values, sizeof(mph_bucket_t), compare_mph_buckets);
-
-    // Freeslots array
-    int *freeslots = malloc(num_values * sizeof(int));
-    int freeslots_size = num_values;
-    for (int i = 0; i < num_values; ++i) {
-        freeslots[i] = i;
-    }
-
-    int ones = 0, multi = 0;
-    for (int i = 0; i < num_values; ++i) {
-        if (buckets[i].size < 1)
-            break;
-        else if (buckets[i].size == 1) {
-            // Only buckets with one item remain, place them directly into a free slot
-            // k2 list already initialized to 0 so no need to set here
-            int idx = buckets[i].indices[0];
-            uint32_t k1 = keys[idx];
-            // uint32_t k1 = keys[idx];
-
-            assert(freeslots_size);
-            int slot = popvalue(freeslots, &freeslots_size, 0);
-            // printf("%d\n", slot);
-            // We subtract one to ensure it's negative even if the zeroeth slot was
-            // used.
-            t->k2[hash(k1,0)%num_values] = -(int32_t)(slot+1);
-            memcpy((char*)t->values + slot*value_size, (char*)values+idx*value_size, value_size);//Store value in slot
-            ++ones;
-        } else {
-            // Try different values of k2 until we find a hash function that places
-            // all the items in the buckets into free slots
-            int32_t k2 = 0;
-            int slots[BUCKET_MAX_INDICES];
-            int slots_size = 0;
-            
-            while (slots_size < buckets[i].size) {
-                int idx = buckets[i].indices[slots_size];
-                uint32_t k1 = keys[idx];
-                int slot = hash(k1,k2)%num_values;
-                if (occurcnt(slots, slots_size, slot) >= 1 || binsearch(freeslots, freeslots_size, slot) == -1) {
-                    ++k2;
-                    slots_size = 0; // Clear
-                } else {
-                    slots[slots_size] = slot;
-                    ++slots_size;
-                }
-            }
+    const uint32_t *a = lhs, *b = rhs;
+    if (a[0] != b[0]) return a[0] < b[0] ? -1 : 1;
+    return a[1] < b[1] ? -1 : a[1] > b[1];
+}
 
-            // printf("SLOTS SIZE: %d\n", slots_size);
-            // for (int z = 0; z < slots_size; ++z) {
-            //     printf("%d ", slots[z]);
-            // }printf("\n\n");
-
-            assert(slots_size == buckets[i].size);
-
-            // Set k2 param for bucket
-            uint32_t k1 = keys[buckets[i].indices[0]];
-            t->k2[hash(k1,0)%num_values] = k2;
-
-            // Copy values from source table to their slots
-            for (int j = 0; j < slots_size; ++j){
-                int idx = buckets[i].indices[j];
-                memcpy((char*)t->values + slots[j]*value_size, (char*)values+idx*value_size, value_size); // Store value in slot
-                int slot_index = binsearch(freeslots, freeslots_size, slots[j]);
-                assert(slot_index != -1);
-                int popped = popvalue(freeslots, &freeslots_size, slot_index);
-                // printf("[%d] : %d\n", slot_index, popped);
-            }
+static void write_decomposition_list(FILE *f, const char *name, uint32_t (*list)[2], int count)
+{
+    fprintf(f, "static const uint32_t hz_ucd_%s_decompositions[%d][2] = {", name, count);
+    for (int i = 0; i < count; ++i) {
+        if (!(i % 6)) fprintf(f, "\n    ");
+        fprintf(f, "{0x%04X,0x%X},", list[i][0], list[i][1]);
+    }
+    fprintf(f, "\n};\n\n");
+}
+
+// Builds the normalization tables from UnicodeData.txt and DerivedNormalizationProps.txt: quick
+// check flags, full canonical and compatibility decompositions (Hangul syllables are left to the
+// algorithm) and the primary composites sorted by their pair. The canonical combining classes go to
+// ccc_out for the property table.
+int generate_normalization_header(const char *unicode_data_path, const char *norm_props_path, const char *out_path,
+                                  uint8_t **ccc_out)
+{
+    FILE *in = fopen(unicode_data_path, "r");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", unicode_data_path);
+        return -1;
+    }
+
+    uint8_t *ccc = calloc(UNICODE_CODEPOINT_COUNT, 1);
+    uint8_t *qc = calloc(UNICODE_CODEPOINT_COUNT, 1);
+    uint8_t *excluded = calloc(UNICODE_CODEPOINT_COUNT, 1);
+    decomposition_t *mappings = calloc(UNICODE_CODEPOINT_COUNT, sizeof(decomposition_t));
+
+    char line[1024];
+    while (fgets(line, sizeof(line), in)) {
+        // codepoint;name;category;combining class;bidi class;decomposition;...
+        char *fields[6];
+        char *s = line;
+        int n = 0;
+        for (; n < 6 && s; ++n) {
+            fields[n] = s;
+            s = strchr(s, ';');
+            if (s) *s++ = '\0';
+        }
+        if (n < 6) continue;
 
-            multi += slots_size;
+        uint32_t c = (uint32_t)strtoul(fields[0], NULL, 16);
+        ccc[c] = (uint8_t)atoi(fields[3]);
+
+        char *d = fields[5];
+        if (*d == '<') {
+            mappings[c].compat = 1;
+            d = strchr(d, '>') + 1;
+        }
+        char *end;
+        for (uint32_t x = (uint32_t)strtoul(d, &end, 16); end != d; x = (uint32_t)strtoul(d, &end, 16)) {
+            mappings[c].chars[mappings[c].length++] = x;
+            d = end;
         }
     }
+    fclose(in);
+
+    in = fopen(norm_props_path, "r");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", norm_props_path);
+        free(ccc); free(qc); free(excluded); free(mappings);
+        return -1;
+    }
 
-    // Verify if MPH table was built correctly
-    int matches = 0, mismatches = 0;
-    for (int i = 0; i < num_values; ++i) {
-        uint32_t k1 = keys[i];
-        uint32_t h = hash(k1,0)%num_values;
-        int32_t k2 = t->k2[h];
-        uint32_t slot;
-        if (k2 < 0) {
-            slot = (-k2)-1;
+    static const struct { const char *property; char value; uint8_t flag; } qc_flags[] = {
+        {"NFD_QC", 'N', 0x01}, {"NFKD_QC", 'N', 0x02}, {"NFC_QC", 'N', 0x04},
+        {"NFC_QC", 'M', 0x08}, {"NFKC_QC", 'N', 0x10}, {"NFKC_QC", 'M', 0x20}
+    };
+    while (fgets(line, sizeof(line), in)) {
+        unsigned int first, last;
+        int n;
+        if (line[0] == '#') continue;
+        if (sscanf(line, " %x..%x%n", &first, &last, &n) == 2) {
+        } else if (sscanf(line, " %x%n", &first, &n) == 1) {
+            last = first;
         } else {
-            slot = hash(keys[i],k2)%num_values;
+            continue;
         }
 
-        char *val = (char*)t->values + slot*value_size;
-        uint32_t codepoint = ((arabic_joining_data_t*) val)->codepoint;
-        if (codepoint != k1) {
-            mismatches ++;
-        } else {
-            matches ++;
+        char property[64] = "", value = 0;
+        if (sscanf(line + n, " ; %63[A-Za-z_] ; %c", property, &value) < 1) continue;
+
+        if (!strcmp(property, "Full_Composition_Exclusion")) {
+            memset(excluded + first, 1, last - first + 1);
+            continue;
+        }
+
+        for (int i = 0; i < COUNTOF(qc_flags); ++i) {
+            if (!strcmp(property, qc_flags[i].property) && value == qc_flags[i].value)
+                for (unsigned int c = first; c <= last; ++c) qc[c] |= qc_flags[i].flag;
+        }
+    }
+    fclose(in);
+
+    FILE *f = fopen(out_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", out_path);
+        free(ccc); free(qc); free(excluded); free(mappings);
+        return -1;
+    }
+
+    fprintf(f, "#ifndef HZ_UCD_NORMALIZATION_H\n#define HZ_UCD_NORMALIZATION_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from UnicodeData.txt and DerivedNormalizationProps.txt\n\n");
+    fprintf(f, "// quick check values other than Yes\n");
+    for (int i = 0; i < COUNTOF(qc_flags); ++i)
+        fprintf(f, "#define HZ_UCD_%s_%s 0x%02x\n", qc_flags[i].property, qc_flags[i].value == 'N' ? "NO" : "MAYBE", qc_flags[i].flag);
+    fprintf(f, "\n");
+
+    write_two_stage_table(f, "quick_check", "QUICK_CHECK", qc);
+
+    // codepoint, and the offset in hz_ucd_decomposition_data shifted left by 5 with the length
+    uint32_t (*canonical)[2] = malloc(UNICODE_CODEPOINT_COUNT / 16 * sizeof(*canonical));
+    uint32_t (*compat)[2] = malloc(UNICODE_CODEPOINT_COUNT / 16 * sizeof(*compat));
+    uint32_t *data = malloc(UNICODE_CODEPOINT_COUNT * sizeof(uint32_t));
+    int canonical_count = 0, compat_count = 0, data_size = 0, max_length = 0;
+    for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+        if (!mappings[c].length) continue;
+
+        decomposition_t d = {0}, kd = {0};
+        expand_decomposition(mappings, c, 0, &d);
+        expand_decomposition(mappings, c, 1, &kd);
+        if (kd.length > max_length) max_length = kd.length;
+        if (!mappings[c].compat) {
+            canonical[canonical_count][0] = c;
+            canonical[canonical_count++][1] = (uint32_t)data_size << 5 | d.length;
+            memcpy(data + data_size, d.chars, d.length * sizeof(uint32_t));
+            data_size += d.length;
+        }
+        if (mappings[c].compat || kd.length != d.length || memcmp(kd.chars, d.chars, d.length * sizeof(uint32_t))) {
+            compat[compat_count][0] = c;
+            compat[compat_count++][1] = (uint32_t)data_size << 5 | kd.length;
+            memcpy(data + data_size, kd.chars, kd.length * sizeof(uint32_t));
+            data_size += kd.length;
+        }
+    }
+
+    fprintf(f, "#define HZ_UCD_MAX_DECOMPOSITION %d\n\n", max_length);
+    write_decomposition_list(f, "canonical", canonical, canonical_count);
+    fprintf(f, "#define HZ_UCD_CANONICAL_DECOMPOSITION_COUNT %d\n\n", canonical_count);
+    write_decomposition_list(f, "compat", compat, compat_count);
+    fprintf(f, "#define HZ_UCD_COMPAT_DECOMPOSITION_COUNT %d\n\n", compat_count);
+
+    fprintf(f, "static const uint32_t hz_ucd_decomposition_data[%d] = {", data_size);
+    for (int i = 0; i < data_size; ++i) {
+        if (!(i % 12)) fprintf(f, "\n    ");
+        fprintf(f, "0x%04X,", data[i]);
+    }
+    fprintf(f, "\n};\n\n");
+
+    // first, second and composite, sorted by first then second
+    uint32_t (*compositions)[3] = malloc(UNICODE_CODEPOINT_COUNT / 16 * sizeof(*compositions));
+    int composition_count = 0;
+    for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+        const decomposition_t *m = &mappings[c];
+        if (m->length != 2 || m->compat || excluded[c]) continue;
+        compositions[composition_count][0] = m->chars[0];
+        compositions[composition_count][1] = m->chars[1];
+        compositions[composition_count++][2] = c;
+    }
+    qsort(compositions, composition_count, sizeof(*compositions), compare_compositions);
+
+    fprintf(f, "static const uint32_t hz_ucd_compositions[%d][3] = {", composition_count);
+    for (int i = 0; i < composition_count; ++i) {
+        if (!(i % 4)) fprintf(f, "\n    ");
+        fprintf(f, "{0x%04X,0x%04X,0x%04X},", compositions[i][0], compositions[i][1], compositions[i][2]);
+    }
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "#define HZ_UCD_COMPOSITION_COUNT %d\n\n", composition_count);
+    fprintf(f, "#endif /* HZ_UCD_NORMALIZATION_H */\n");
+    fclose(f);
+
+    free(canonical); free(compat); free(data); free(compositions);
+    free(qc); free(excluded); free(mappings);
+    *ccc_out = ccc;
+    return 0;
+}
+
+// General categories in the order of hz_general_category_t, Cn first as it is the default of
+// unlisted codepoints.
+static const char *general_category_names[] = {
+    "Cn","Lu","Ll","Lt","Lm","Lo","Mn","Mc","Me","Nd","Nl","No","Pc","Pd","Ps","Pe","Pi","Pf",
+    "Po","Sm","Sc","Sk","So","Zs","Zl","Zp","Cc","Cf","Cs","Co"
+};
+
+// Joining types in the order of the hz_joining_type_t flags, U first as it is the default of
+// unlisted codepoints.
+static const char *joining_type_names[] = {"U","C","D","L","R","T"};
+
+// Joining groups in the order of hz_joining_group_t as spelled in ArabicShaping.txt.
+static const char *joining_group_names[] = {
+    "No_Joining_Group","AFRICAN FEH","AFRICAN NOON","AFRICAN QAF","AIN","ALAPH","ALEF","BEH","BETH",
+    "BURUSHASKI YEH BARREE","DAL","DALATH RISH","E","FARSI YEH","FE","FEH","FINAL SEMKATH","GAF",
+    "GAMAL","HAH","HANIFI ROHINGYA KINNA YA","HANIFI ROHINGYA PA","HE","HEH","HEH GOAL","HETH","KAF",
+    "KAPH","KHAPH","KNOTTED HEH","LAM","LAMADH","MALAYALAM BHA","MALAYALAM JA","MALAYALAM LLA",
+    "MALAYALAM LLLA","MALAYALAM NGA","MALAYALAM NNA","MALAYALAM NNNA","MALAYALAM NYA","MALAYALAM RA",
+    "MALAYALAM SSA","MALAYALAM TTA","MANICHAEAN ALEPH","MANICHAEAN AYIN","MANICHAEAN BETH",
+    "MANICHAEAN DALETH","MANICHAEAN DHAMEDH","MANICHAEAN FIVE","MANICHAEAN GIMEL","MANICHAEAN HETH",
+    "MANICHAEAN HUNDRED","MANICHAEAN KAPH","MANICHAEAN LAMEDH","MANICHAEAN MEM","MANICHAEAN NUN",
+    "MANICHAEAN ONE","MANICHAEAN PE","MANICHAEAN QOPH","MANICHAEAN RESH","MANICHAEAN SADHE",
+    "MANICHAEAN SAMEKH","MANICHAEAN TAW","MANICHAEAN TEN","MANICHAEAN TETH","MANICHAEAN THAMEDH",
+    "MANICHAEAN TWENTY","MANICHAEAN WAW","MANICHAEAN YODH","MANICHAEAN ZAYIN","MEEM","MIM","NOON",
+    "NUN","NYA","PE","QAF","QAPH","REH","REVERSED PE","ROHINGYA YEH","SAD","SADHE","SEEN","SEMKATH",
+    "SHIN","STRAIGHT WAW","SWASH KAF","SYRIAC WAW","TAH","TAW","TEH MARBUTA","HAMZA ON HEH GOAL",
+    "TETH","THIN YEH","VERTICAL TAIL","WAW","YEH","YEH BARREE","YEH WITH TAIL","YUDH","YUDH HE",
+    "ZAIN","ZHAIN"
+};
+
+// Reads the joining groups, and the joining types if types isn't NULL, of the codepoints listed in
+// ArabicShaping.txt. Returns 0 if the file couldn't be opened.
+static int read_arabic_shaping(const char *path, uint8_t *types, uint8_t *groups)
+{
+    FILE *in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return 0;
+    }
+
+    // codepoint; name; joining type; joining group
+    char line[512];
+    while (fgets(line, sizeof(line), in)) {
+        unsigned int c;
+        char type[8], group[64];
+        if (line[0] == '#' || sscanf(line, " %x ; %*[^;] ; %7[A-Z] ; %63[A-Za-z_ ]", &c, type, group) != 3) continue;
+        int len = (int)strlen(group);
+        while (len && group[len - 1] == ' ') --len;
+        if (len == 16 && !strncmp(group, "TEH MARBUTA GOAL", len)) { // alias of Hamza_On_Heh_Goal
+            strcpy(group, "HAMZA ON HEH GOAL");
+            len = 17;
+        }
+
+        int t = find_property_value(joining_type_names, COUNTOF(joining_type_names), type, (int)strlen(type));
+        int g = find_property_value(joining_group_names, COUNTOF(joining_group_names), group, len);
+        if (t < 0 || g < 0 || c >= UNICODE_CODEPOINT_COUNT) {
+            fprintf(stderr, "Unexpected line: %s", line);
+            continue;
         }
+
+        if (types) types[c] = (uint8_t)t;
+        groups[c] = (uint8_t)g;
     }
+    fclose(in);
+    return 1;
+}
 
-    printf(" MATCHES: %d/%d , multi:%d, ones:%d\n", matches, mismatches, multi,ones);
+// All properties of a codepoint, the layout of hz_ucd_record_t.
+typedef struct {
+    int16_t mirror_offset;
+    uint8_t general_category;
+    uint8_t script;
+    uint8_t script_value;
+    uint8_t bidi_class;
+    uint8_t line_break;
+    uint8_t joining_type;
+    uint8_t joining_group;
+    uint8_t combining_class;
+} property_record_t;
+
+#define BLOCK_HASH_SIZE (1 << 17)
+
+static uint32_t hash_block(const uint16_t *block, int size)
+{
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < size; ++i) h = (h ^ block[i]) * 16777619u;
+    return h;
+}
+
+// Splits values into blocks of 1 << shift, writes the offset in unique of each one's first copy to
+// offsets and returns the size of unique.
+static int deduplicate_blocks(const uint16_t *values, int count, int shift, uint32_t *offsets, uint16_t *unique)
+{
+    int size = 1 << shift, unique_count = 0;
+    int *buckets = malloc(BLOCK_HASH_SIZE * sizeof(int));
+    int *next = malloc((count >> shift) * sizeof(int));
+    memset(buckets, -1, BLOCK_HASH_SIZE * sizeof(int));
+
+    for (int i = 0; i < count >> shift; ++i) {
+        const uint16_t *b = values + (i << shift);
+        uint32_t h = hash_block(b, size) % BLOCK_HASH_SIZE;
+        int j = buckets[h];
+        while (j >= 0 && memcmp(unique + (j << shift), b, size * sizeof(uint16_t))) j = next[j];
+        if (j < 0) {
+            j = unique_count++;
+            memcpy(unique + (j << shift), b, size * sizeof(uint16_t));
+            next[j] = buckets[h];
+            buckets[h] = j;
+        }
+        offsets[i] = (uint32_t)j << shift;
+    }
 
-    free(freeslots);
     free(buckets);
+    free(next);
+    return unique_count << shift;
 }
 
-void mph_table_deinit(mph_table_t *t)
+static void write_u16_array(FILE *f, const char *name, const uint16_t *values, int count)
 {
-    free(t->k2);
-    free(t->values);
+    fprintf(f, "static const uint16_t %s[%d] = {", name, count);
+    for (int i = 0; i < count; ++i) {
+        if (!(i % 16)) fprintf(f, "\n    ");
+        fprintf(f, "%d,", values[i]);
+    }
+    fprintf(f, "\n};\n\n");
 }
 
+// Writes the 16-bit values of all codepoints as a three-stage trie named hz_ucd_<name>_stage1/2/3.
+// The top bits of a codepoint index stage one for the offset of a block of stage two, the middle
+// bits index that block for the offset of a block of values in stage three and the low bits the
+// value in it. Blocks are deduplicated at both levels, the block sizes are the ones giving the
+// smallest tables. Each stage ends with an unused entry so 32-bit gathers of its last entry stay
+// in bounds.
+static void write_three_stage_table(FILE *f, const char *name, const char *macro_name, const uint16_t *values)
+{
+    int best_size = -1, best_shift2 = 0, best_shift3 = 0;
+    uint32_t *offsets3 = malloc(UNICODE_CODEPOINT_COUNT * sizeof(uint32_t));
+    uint16_t *stage3 = malloc(UNICODE_CODEPOINT_COUNT * sizeof(uint16_t));
+    uint16_t *stage2 = malloc(UNICODE_CODEPOINT_COUNT * sizeof(uint16_t));
+    uint32_t *offsets2 = malloc(UNICODE_CODEPOINT_COUNT * sizeof(uint32_t));
+
+    for (int shift3 = 3; shift3 <= 9; ++shift3) {
+        int stage3_size = deduplicate_blocks(values, UNICODE_CODEPOINT_COUNT, shift3, offsets3, stage3);
+        if (stage3_size > 0xffff) continue;
+
+        int block_count = UNICODE_CODEPOINT_COUNT >> shift3;
+        for (int i = 0; i < block_count; ++i) stage2[i] = (uint16_t)offsets3[i];
+        for (int shift2 = 2; shift2 <= 9; ++shift2) {
+            int stage2_size = deduplicate_blocks(stage2, block_count, shift2, offsets2, stage3 + stage3_size);
+            int size = (block_count >> shift2) + stage2_size + stage3_size;
+            if (stage2_size <= 0xffff && (best_size < 0 || size < best_size)) {
+                best_size = size;
+                best_shift2 = shift2;
+                best_shift3 = shift3;
+            }
+        }
+    }
 
-int generate() {
-    int err;
-    char errbuf[512];
-    regex_t ver_regex,
-            arabic_shaping_regex,
-            jamo_regex,
-            property_value_aliases_regex;
+    int stage3_size = deduplicate_blocks(values, UNICODE_CODEPOINT_COUNT, best_shift3, offsets3, stage3);
+    int block_count = UNICODE_CODEPOINT_COUNT >> best_shift3;
+    for (int i = 0; i < block_count; ++i) stage2[i] = (uint16_t)offsets3[i];
+    uint16_t *unique2 = malloc((block_count + 1) * sizeof(uint16_t));
+    int stage2_size = deduplicate_blocks(stage2, block_count, best_shift2, offsets2, unique2);
+    int stage1_size = block_count >> best_shift2;
+    uint16_t *stage1 = malloc((stage1_size + 1) * sizeof(uint16_t));
+    for (int i = 0; i < stage1_size; ++i) stage1[i] = (uint16_t)offsets2[i];
+    stage1[stage1_size] = 0;
+    unique2[stage2_size] = 0;
+    stage3[stage3_size] = 0;
+
+    fprintf(f, "#define HZ_UCD_%s_SHIFT1 %d\n", macro_name, best_shift2 + best_shift3);
+    fprintf(f, "#define HZ_UCD_%s_SHIFT2 %d\n", macro_name, best_shift3);
+    fprintf(f, "#define HZ_UCD_%s_MASK2 0x%x\n", macro_name, (1 << best_shift2) - 1);
+    fprintf(f, "#define HZ_UCD_%s_MASK3 0x%x\n\n", macro_name, (1 << best_shift3) - 1);
+
+    char array_name[100];
+    snprintf(array_name, sizeof(array_name), "hz_ucd_%s_stage1", name);
+    write_u16_array(f, array_name, stage1, stage1_size + 1);
+    snprintf(array_name, sizeof(array_name), "hz_ucd_%s_stage2", name);
+    write_u16_array(f, array_name, unique2, stage2_size + 1);
+    snprintf(array_name, sizeof(array_name), "hz_ucd_%s_stage3", name);
+    write_u16_array(f, array_name, stage3, stage3_size + 1);
+
+    printf("%s: shifts %d/%d, %d+%d+%d entries\n", name, best_shift2, best_shift3, stage1_size, stage2_size, stage3_size);
+    free(offsets3); free(stage3); free(stage2); free(offsets2); free(unique2); free(stage1);
+}
 
-    if ((err = regcomp(&ver_regex, "^([0-9]+)\\.([0-9]+)(?:\\.([0-9]+)|-(Update(?:[0-9]+)?))$", REG_EXTENDED|REG_NEWLINE)) != 0) {
-        regerror(err, &arabic_shaping_regex, errbuf, 512);
-        fprintf(stderr, "Failed to compile regex err:\n%s\n", errbuf);
+// Writes the general category and joining enums the public header needs, the values themselves
+// are in the property table that only hz.c includes.
+int generate_property_value_headers(const char *general_category_path, const char *joining_path)
+{
+    FILE *f = fopen(general_category_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", general_category_path);
         return -1;
     }
 
-    if ((err = regcomp(&arabic_shaping_regex, "^([[:xdigit:]]*)[[:space:]]*;[[:space:]]*((?:[[:alnum:]][[:space:]]?)*)[[:space:]]*;[[:space:]]*([[:alpha:]])[[:space:]]*;[[:space:]]*((?:[[:space:]]?[[:alpha:]_])*)[[:space:]]*$", REG_EXTENDED|REG_NEWLINE)) != 0) {
-        regerror(err, &arabic_shaping_regex, errbuf, 512);
-        fprintf(stderr, "Failed to compile regex err:\n%s\n", errbuf);
-        return -1;
+    fprintf(f, "#ifndef HZ_UCD_GENERAL_CATEGORY_H\n#define HZ_UCD_GENERAL_CATEGORY_H\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from DerivedGeneralCategory.txt\n\n");
+    fprintf(f, "typedef enum {");
+    for (int i = 0; i < COUNTOF(general_category_names); ++i) {
+        char name[3] = {(char)toupper((unsigned char)general_category_names[i][0]),
+                        (char)toupper((unsigned char)general_category_names[i][1])};
+        fprintf(f, "\n    HZ_GENERAL_CATEGORY_%s,", name);
     }
+    fprintf(f, "\n    HZ_GENERAL_CATEGORY_COUNT\n} hz_general_category_t;\n\n");
+    fprintf(f, "#endif /* HZ_UCD_GENERAL_CATEGORY_H */\n");
+    fclose(f);
 
-    if ((err = regcomp(&jamo_regex, "^([[:xdigit:]]*)[[:space:]]*;[[:space:]]*([[:alpha:]]*)[[:space:]#^\\n]*", REG_EXTENDED|REG_NEWLINE)) != 0) {
-        regerror(err, &jamo_regex, errbuf, 512);
-        fprintf(stderr, "Failed to compile regex err:\n%s\n", errbuf);
+    f = fopen(joining_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", joining_path);
         return -1;
     }
 
-    if ((err = regcomp(&property_value_aliases_regex, "^([[:alnum:]_\\-\\.]*)(?:[[:space:]]*;[[:space:]]*([[:alnum:]_\\-\\.\\/\\\\]*)(?:[[:space:]]*;[[:space:]]*([[:alnum:]_\\-\\.\\/\\\\]*)(?:[[:space:]]*;[[:space:]]*([[:alnum:]_\\-\\.\\/\\\\]*)[[:space:]]*)?)?)(?:[[:space:]]*#[^\\n]*)?", REG_EXTENDED|REG_NEWLINE)) != 0) {
-        regerror(err, &property_value_aliases_regex, errbuf, 512);
-        fprintf(stderr, "Failed to compile regex err:\n%s\n", errbuf);
+    fprintf(f, "#ifndef HZ_UCD_JOINING_H\n#define HZ_UCD_JOINING_H\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from DerivedJoiningType.txt and ArabicShaping.txt\n\n");
+    fprintf(f, "typedef enum {");
+    for (int i = 0; i < COUNTOF(joining_type_names); ++i)
+        fprintf(f, "\n    HZ_JOINING_TYPE_%s = 1 << %d,", joining_type_names[i], 16 + i);
+    fprintf(f, "\n} hz_joining_type_t;\n\n");
+
+    fprintf(f, "typedef enum {\n    HZ_JOINING_GROUP_NONE,");
+    for (int i = 1; i < COUNTOF(joining_group_names); ++i) {
+        char name[64];
+        int k = 0;
+        for (; joining_group_names[i][k]; ++k) name[k] = joining_group_names[i][k] == ' ' ? '_' : joining_group_names[i][k];
+        name[k] = '\0';
+        fprintf(f, "\n    HZ_JOINING_GROUP_%s,", name);
+    }
+    fprintf(f, "\n} hz_joining_group_t;\n\n");
+    fprintf(f, "#endif /* HZ_UCD_JOINING_H */\n");
+    fclose(f);
+    return 0;
+}
+
+// Builds the shared property table: the general category from DerivedGeneralCategory.txt, joining
+// types from DerivedJoiningType.txt, joining groups from ArabicShaping.txt and mirrored characters
+// from BidiMirroring.txt, together with the scripts and script values, bidi and line break classes and
+// canonical combining classes read for the other headers. Each distinct combination of values is
+// stored once as a record and codepoints are mapped to their record by a three-stage trie, record
+// zero holds the values of codepoints past the end of Unicode.
+int generate_properties_header(const char *ucd_path, const uint8_t *scripts, const uint8_t *script_values,
+                               const uint8_t *bidi_classes,
+                               const uint8_t *line_break_classes, const uint8_t *combining_classes,
+                               const char *out_path)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/extracted/DerivedGeneralCategory.txt", ucd_path);
+    uint8_t *general_categories = read_property_file(path, general_category_names, COUNTOF(general_category_names));
+    snprintf(path, sizeof(path), "%s/extracted/DerivedJoiningType.txt", ucd_path);
+    uint8_t *joining_types = read_property_file(path, joining_type_names, COUNTOF(joining_type_names));
+    uint8_t *joining_groups = calloc(UNICODE_CODEPOINT_COUNT, 1);
+    int16_t *mirror_offsets = calloc(UNICODE_CODEPOINT_COUNT, sizeof(int16_t));
+    if (!general_categories || !joining_types) {
+        free(general_categories); free(joining_types); free(joining_groups); free(mirror_offsets);
         return -1;
     }
 
-#ifdef _WIN32
-    WIN32_FIND_DATA fdFile;
-    HANDLE hFind;
+    snprintf(path, sizeof(path), "%s/ArabicShaping.txt", ucd_path);
+    read_arabic_shaping(path, NULL, joining_groups);
+
+    // codepoint; mirrored codepoint
+    char line[512];
+    snprintf(path, sizeof(path), "%s/BidiMirroring.txt", ucd_path);
+    FILE *in = fopen(path, "r");
+    while (in && fgets(line, sizeof(line), in)) {
+        unsigned int c, mirror;
+        if (line[0] == '#' || sscanf(line, " %x ; %x", &c, &mirror) != 2) continue;
+        if ((int)mirror - (int)c < INT16_MIN || (int)mirror - (int)c > INT16_MAX)
+            fprintf(stderr, "Mirror too far: %s", line);
+        else mirror_offsets[c] = (int16_t)((int)mirror - (int)c);
+    }
+    if (in) fclose(in);
+    else fprintf(stderr, "Failed to open %s\n", path);
 
-    char *sDir = ".\\UCD";
-    char sPath[2048] = ".\\UCD\\*.*";
-    
-    if((hFind = FindFirstFile(sPath, &fdFile)) == INVALID_HANDLE_VALUE) {
-        printf("Path not found: [%s]\n", sDir);
+    FILE *f = fopen(out_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", out_path);
+        free(general_categories); free(joining_types); free(joining_groups); free(mirror_offsets);
         return -1;
     }
 
-    printf("Path found: [%s]\n", sDir);
-    do {
-        //Find first file will always return "."
-        //    and ".." as the first two directories.
-        if(strcmp(fdFile.cFileName, ".") != 0
-                && strcmp(fdFile.cFileName, "..") != 0) {
-            //Build up our file path using the passed in
-            //  [sDir] and the file/foldername we just found:
-            snprintf(sPath, 2048, "%s\\%s", sDir, fdFile.cFileName);
-
-            //Is the entity a Folder?
-            if(fdFile.dwFileAttributes &FILE_ATTRIBUTE_DIRECTORY) {
-                printf("Directory: %s\n", sPath);
-                regmatch_t match[5];
-                if (regexec(&ver_regex, fdFile.cFileName, 5, match, 0) != REG_NOMATCH) {
-                    // Regex match, generate UCD file
-                    char filename[100];
-                    int major = atoi(fdFile.cFileName + match[1].rm_so);
-                    int minor = atoi(fdFile.cFileName + match[2].rm_so);
-                    int patch = atoi(fdFile.cFileName + match[3].rm_so);
-                    snprintf(filename,sizeof(filename),"hz_ucd_%d_%d_%.*s%d.h", major, minor,
-                            match[4].rm_eo-match[4].rm_so, fdFile.cFileName + match[4].rm_so,
-                            patch);
-
-                    char filename2[100];
-                    snprintf(filename2,100,"./hz/%s", filename);
-                    FILE *f = fopen(filename2, "w+");
-                    if (f) {
-                        char macro[100]; strcpy(macro,filename);
-                        for (char *p = macro; *p != '\0'; ++p) {
-                            if (*p == '.') *p = '_';
-                        }
-                        strupr(macro);
-
-                        fprintf(f, "#ifndef %s\n", macro);
-                        fprintf(f, "#define %s\n\n", macro);
-                        fprintf(f, "#include <stdint.h>\n\n");
-                        fprintf(f, "#define HZ_UCD_VERSION HZ_MAKE_VERSION(%d,%d,%d)\n\n",major,minor,patch);
-
-                        {
-                            // Add enum definitions from PropertyValueAliases.txt
-                            char tmp[100];
-                            snprintf(tmp,100,"%s\\ucd\\PropertyValueAliases.txt", sPath);
-                            printf("%s\n", tmp);
-                            FILE *property_value_aliases = fopen(tmp,"r");
-                            if (property_value_aliases) { // Read entire file data, then split into lines and parse
-                                fseek(property_value_aliases,0,SEEK_END);
-                                size_t filesize = ftell(property_value_aliases);
-                                fseek(property_value_aliases,0,SEEK_SET);
-                                char *str = malloc(filesize+1); 
-                                fread(str, 1, filesize, property_value_aliases);
-                                str[filesize] = '\0';
-
-                                // Allocate big enough buffer for joining groups
-                                #define MAX_PROPERTY_VALUE_ALIASES 2048
-                                property_value_alias_t *aliases = malloc(sizeof(aliases[0]) * MAX_PROPERTY_VALUE_ALIASES);
-                                char *s = str;
-                                int off, len;
-                                int cnt;
-                                for (cnt=0; ; ++cnt) {
-                                    regmatch_t match[6];
-                                    if (regexec(&property_value_aliases_regex, s, 6, match, 0) == REG_NOMATCH)
-                                        break;
-
-                                    off = match[0].rm_so + (s - str);
-                                    len = match[0].rm_eo - match[0].rm_so;
-
-                                    property_value_alias_t alias;
-                                    for (int k = 0; k < 5; ++k) {
-                                        alias.txt[k] = s + match[k+1].rm_so;
-                                        alias.sizes[k] = match[k+1].rm_eo - match[k+1].rm_so;
-                                    }
-                                    aliases[cnt] = alias;
-                                    s += match[0].rm_eo;
-                                }
-
-                                fprintf(f, "typedef enum {");
-                                int v = 16;
-                                for (int j = 0; j < cnt; ++j) {
-                                    if (aliases[j].sizes[0] == 2 && !strncmp(aliases[j].txt[0], "jt", 2)) {
-                                        char enum_name[50];
-                                        snprintf(enum_name, 50, "\n    HZ_JOINING_TYPE_%.*s = 1 << %d,", aliases[j].sizes[1], aliases[j].txt[1], v);
-                                        fprintf(f, strupr(enum_name));
-                                        ++v;
-                                    }
-                                }
-                                fprintf(f, "\n} hz_joining_type_t;\n\n");
-
-                                fprintf(f, "typedef enum {");
-                                fprintf(f, "\n    HZ_JOINING_GROUP_NONE,");
-                                for (int j = 0; j < cnt; ++j) {
-                                    if (aliases[j].sizes[0] == 2 && !strncmp(aliases[j].txt[0], "jg", 2)) {
-                                        char enum_name[50]="";
-                                        strncat(enum_name, aliases[j].txt[2], aliases[j].sizes[2]);
-                                        enum_name[aliases[j].sizes[2]] = '\0';
-                                        if (strcmp(enum_name,"No_Joining_Group")) {
-                                            fprintf(f,"\n    HZ_JOINING_GROUP_%s,", strupr(enum_name));
-                                        }
-                                    }
-                                }
-                                fprintf(f, "\n} hz_joining_group_t;\n\n");
-
-                                free(aliases);
-                                fclose(property_value_aliases);
-                            }
-                        }
-
-                        if (0) { // Add Korean Jamo table from Jamo.txt
-                            char tmp[100];
-                            snprintf(tmp,100,"%s\\ucd\\Jamo.txt", sPath);
-                            printf("%s\n", tmp);
-                            FILE *jamo = fopen(tmp,"r");
-                            if (jamo) { // Read entire file data, then split into lines and parse
-                                mph_table_t jamo_mph_table;
-                                fseek(jamo,0,SEEK_END);
-                                size_t filesize = ftell(jamo);
-                                fseek(jamo,0,SEEK_SET);
-                                char *str = malloc(filesize+1); 
-                                fread(str,1,filesize,jamo);
-                                str[filesize] = '\0';
-                                // Allocate big enough buffer for joining data
-
-                                #define JAMO_SIZE 2048
-                                jamo_t *jamo_data = malloc(sizeof(*jamo_data) * JAMO_SIZE);
-                                uint32_t *jamo_data_keys = malloc(sizeof(uint32_t) * JAMO_SIZE);
-
-                                char *s = str;
-                                int off, len, cnt;
-                                for (cnt=0; ; ++cnt) {
-                                    regmatch_t match[3];
-                                    if (regexec(&jamo_regex, s, 3, match, 0) == REG_NOMATCH)
-                                        break;
-
-                                    off = match[0].rm_so + (s - str);
-                                    len = match[0].rm_eo - match[0].rm_so;
-
-                                    jamo_data_keys[cnt] = strtol(s+match[1].rm_so,NULL,16);
-                                    jamo_data[cnt].codepoint = jamo_data_keys[cnt];
-                                    memset(jamo_data[cnt].name, 0, sizeof jamo_data[cnt].name);
-                                    snprintf(jamo_data[cnt].name, sizeof jamo_data[cnt].name, "%.*s", match[2].rm_eo - match[2].rm_so, s + match[2].rm_so);
-
-                                    printf("%s\n", jamo_data[cnt].name);
-
-                                    s += match[0].rm_eo;
-                                }
-
-                                mph_table_init(&jamo_mph_table,
-                                                jamo_data_keys,
-                                                jamo_data,
-                                                sizeof(jamo_data[0]),
-                                                cnt,
-                                                hash2_lowbias32);
+    int record_count = 1, max_records = 1 << 16;
+    property_record_t *records = calloc(max_records, sizeof(property_record_t));
+    uint16_t *indices = malloc(UNICODE_CODEPOINT_COUNT * sizeof(uint16_t));
+    int *buckets = malloc(BLOCK_HASH_SIZE * sizeof(int));
+    int *next = calloc(max_records, sizeof(int));
+    memset(buckets, -1, BLOCK_HASH_SIZE * sizeof(int));
+
+    // past the end of Unicode: Unknown script, left to right, unknown line break and non joining
+    records[0].script = records[0].script_value = (uint8_t)(COUNTOF(script_names) - 1);
+    next[0] = -1;
+    for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+        property_record_t r;
+        memset(&r, 0, sizeof(r));
+        r.mirror_offset = mirror_offsets[c];
+        r.general_category = general_categories[c];
+        r.script = scripts[c];
+        r.script_value = script_values[c];
+        r.bidi_class = bidi_classes[c];
+        r.line_break = line_break_classes[c];
+        r.joining_type = joining_types[c];
+        r.joining_group = joining_groups[c];
+        r.combining_class = combining_classes[c];
+
+        uint32_t h = hash_block((const uint16_t *)&r, sizeof(r) / sizeof(uint16_t)) % BLOCK_HASH_SIZE;
+        int j = buckets[h];
+        while (j >= 0 && memcmp(&records[j], &r, sizeof(r))) j = next[j];
+        if (j < 0) {
+            if (record_count == max_records) {
+                fprintf(stderr, "Too many property records\n");
+                break;
+            }
+            j = record_count++;
+            records[j] = r;
+            next[j] = buckets[h];
+            buckets[h] = j;
+        }
+        indices[c] = (uint16_t)j;
+    }
+
+    fprintf(f, "#ifndef HZ_UCD_PROPERTIES_H\n#define HZ_UCD_PROPERTIES_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from DerivedGeneralCategory.txt, Scripts.txt, ScriptExtensions.txt,\n");
+    fprintf(f, "// DerivedBidiClass.txt, BidiMirroring.txt, LineBreak.txt, DerivedJoiningType.txt, ArabicShaping.txt\n");
+    fprintf(f, "// and UnicodeData.txt\n\n");
+
+    fprintf(f, "typedef struct {\n");
+    fprintf(f, "    int16_t mirror_offset; // Bidi_Mirroring_Glyph minus the codepoint, zero if there is none\n");
+    fprintf(f, "    uint8_t general_category; // hz_general_category_t\n");
+    fprintf(f, "    uint8_t script; // hz_script_t\n");
+    fprintf(f, "    uint8_t script_value; // script or HZ_UCD_SCRIPT_EXTENSIONS_BASE plus its extension set\n");
+    fprintf(f, "    uint8_t bidi_class; // hz_bidi_class_t\n");
+    fprintf(f, "    uint8_t line_break; // hz_line_break_class_t\n");
+    fprintf(f, "    uint8_t joining_type; // hz_joining_type_t flag is 1 << (16 + joining_type)\n");
+    fprintf(f, "    uint8_t joining_group; // hz_joining_group_t\n");
+    fprintf(f, "    uint8_t combining_class;\n");
+    fprintf(f, "} hz_ucd_record_t;\n\n");
+
+    write_three_stage_table(f, "properties", "PROPERTIES", indices);
+
+    // an unused record at the end for gathers, like the trie stages
+    fprintf(f, "static const hz_ucd_record_t hz_ucd_records[%d] = {", record_count + 1);
+    for (int i = 0; i <= record_count; ++i) {
+        const property_record_t *r = &records[i < record_count ? i : 0];
+        if (!(i % 4)) fprintf(f, "\n    ");
+        fprintf(f, "{%d,%d,%d,%d,%d,%d,%d,%d,%d},", r->mirror_offset, r->general_category, r->script, r->script_value,
+                r->bidi_class, r->line_break, r->joining_type, r->joining_group, r->combining_class);
+    }
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "#endif /* HZ_UCD_PROPERTIES_H */\n");
+    fclose(f);
+
+    printf("properties: %d records\n", record_count);
+    free(records); free(indices); free(buckets); free(next);
+    free(general_categories); free(joining_types); free(joining_groups); free(mirror_offsets);
+    return 0;
+}
+
+// Versions of hz_ucd_versions.h, oldest first, the newest one is the version of the property table.
+static const int ucd_versions[][3] = {
+    {4,1,0}, {5,0,0}, {5,1,0}, {5,2,0}, {6,0,0}, {6,1,0}, {6,2,0}, {6,3,0}, {7,0,0},
+    {8,0,0}, {9,0,0}, {10,0,0}, {11,0,0}, {12,0,0}, {12,1,0}, {13,0,0}, {14,0,0}, {15,0,0}
+};
 
+// Values of the properties kept for older UCD versions.
+typedef struct {
+    uint8_t general_category, script, bidi_class, line_break, joining_type, joining_group;
+} version_record_t;
 
-/*
-                                fprintf(f, "int32_t hz_ucd_jamo_short_names_k2[%d] = {", cnt);
-                                for (int i = 0; i < jamo_mph_table.size; ++i) {
-                                    int k2 = jamo_mph_table.k2[i];
-                                    if (!(i % INTS_PER_LINE)) fprintf(f,"\n    ");
-                                    fprintf(f, "%4d,", k2);
-                                }
-
-                                fprintf(f,"\n};\n\n");
-
-                                // Short Names
-                                fprintf(f, "uint32_t hz_ucd_jamo_short_names[%d] = {",cnt);
-                                for (int i = 0; i < jamo_mph_table.size; ++i) {
-                                    jamo_t dat = ((jamo_t*)jamo_mph_table.values)[i];
-                                    fprintf(f, "\n    HZ_JAMO_SHORT_NAME_%s,", dat.name);
-                                }
-
-                                fprintf(f,"\n};\n\n");
-                                */
-                            }
-
-                        }
-
-                        { // Add arabic table
-                            char tmp[100];
-                            snprintf(tmp,100,"%s\\ucd\\ArabicShaping.txt", sPath);
-                            printf("%s\n", tmp);
-                            FILE *arabic_shaping = fopen(tmp,"r");
-                            if (arabic_shaping) { // Read entire file data, then split into lines and parse
-                                mph_table_t arabic_shaping_table;
-                                fseek(arabic_shaping,0,SEEK_END);
-                                size_t filesize = ftell(arabic_shaping);
-                                fseek(arabic_shaping,0,SEEK_SET);
-                                char *str = malloc(filesize+1); 
-                                fread(str,1,filesize,arabic_shaping);
-                                str[filesize] = '\0';
-                                // Allocate big enough buffer for joining data
-
-                                #define ARABIC_JOINING_SIZE 2048
-                                arabic_joining_data_t *arabic_data = malloc(sizeof(*arabic_data) * ARABIC_JOINING_SIZE);
-                                uint32_t *arabic_data_keys = malloc(sizeof(uint32_t) * ARABIC_JOINING_SIZE);
-
-                                char *s = str;
-                                int off, len, cnt;
-                                for (cnt=0; ; ++cnt) {
-                                    regmatch_t match[5];
-                                    if (regexec(&arabic_shaping_regex, s, 5, match, 0) == REG_NOMATCH)
-                                        break;
-
-                                    off = match[0].rm_so + (s - str);
-                                    len = match[0].rm_eo - match[0].rm_so;
-
-                                    // Create joining data
-                                    arabic_joining_data_t jd;
-                                    memset(&jd,0,sizeof(jd));
-                                    jd.codepoint = strtol(s + match[1].rm_so, NULL, 16);
-                                    // printf("%d -> %.*s : %04x\n", cnt, match[1].rm_eo - match[1].rm_so, s + match[1].rm_so, jd.codepoint);
-                                    jd.joining_type = s[match[3].rm_so]; // Joining type
-                                    if (match[2].rm_so != -1) {
-                                        jd.comment = s + match[2].rm_so;
-                                        jd.comment_len = match[2].rm_eo - match[2].rm_so;
-                                    }
-                                    if (match[4].rm_so != -1) {
-                                        jd.joining_group = s + match[4].rm_so;
-                                        jd.joining_group_len =  match[4].rm_eo - match[4].rm_so;
-                                    }
-
-                                    arabic_data[cnt] = jd;
-                                    arabic_data_keys[cnt] = jd.codepoint;
-
-                                    s += match[0].rm_eo;
-                                }
-
-                                mph_table_init(&arabic_shaping_table,
-                                                arabic_data_keys,
-                                                arabic_data,
-                                                sizeof(arabic_joining_data_t),
-                                                cnt,
-                                                hash2_lowbias32);
-
-                                printf("ArabicShaping.txt MPH table created\n");
-
-                                fprintf(f, "static int32_t hz_ucd_arabic_joining_k2[%d] = {", cnt);
-                                for (int i = 0; i < arabic_shaping_table.size; ++i) {
-                                    int k2 = arabic_shaping_table.k2[i];
-                                    if (!(i % INTS_PER_LINE)) fprintf(f,"\n    ");
-                                    fprintf(f, "%4d,", k2);
-                                }
-
-                                fprintf(f,"\n};\n\n");
-
-                                // UCS 
-                                fprintf(f, "static uint32_t hz_ucd_arabic_joining_ucs_codepoints[%d] = {",cnt);
-                                for (int i = 0; i < arabic_shaping_table.size; ++i) {
-                                    arabic_joining_data_t dat = ((arabic_joining_data_t*)arabic_shaping_table.values)[i];
-                                    if (!(i % INTS_PER_LINE))
-                                        fprintf(f,"\n    ");
-                                    fprintf(f, "%8d,", dat.codepoint);
-                                }
-
-                                fprintf(f,"\n};\n\n");
-                                printf("UCS Done\n");
-
-                                fprintf(f, "static uint32_t hz_ucd_arabic_joining_data[%d] = {",cnt);
-                                for (int i = 0; i < arabic_shaping_table.size; ++i) {
-                                    arabic_joining_data_t dat = ((arabic_joining_data_t*)arabic_shaping_table.values)[i];
-                                    fprintf(f,"\n    ");
-                                    char jg[50]="";
-                                    strncat(jg, dat.joining_group, dat.joining_group_len);
-                                    if (!strcmp("No_Joining_Group", jg)) {
-                                        fprintf(f, "HZ_JOINING_TYPE_%c | HZ_JOINING_GROUP_NONE,", dat.joining_type);
-                                    } else {
-                                        strupr(jg); // uppercase
-                                        // Change spaces to underscores
-                                        for (char *p = jg; *p != '\0'; ++p) {
-                                            if (*p == ' ') *p = '_';
-                                        }
-                                        fprintf(f, "HZ_JOINING_TYPE_%c | HZ_JOINING_GROUP_%s,", dat.joining_type, jg);
-                                    }
-                                }
-
-                                fprintf(f,"\n};\n\n");
-#if 0
-                                fprintf(f, "static char const* const hz_ucd_arabic_joining_ucs_names[%d] = {",cnt);
-                                for (int i = 0; i < arabic_shaping_table.size; ++i) {
-                                    arabic_joining_data_t dat = ((arabic_joining_data_t*)arabic_shaping_table.values)[i];
-                                    fprintf(f,"\n    ");
-                                    fprintf(f, "\"%.*s\",", dat.comment_len, dat.comment);
-                                }
-
-                                fprintf(f,"\n};\n\n");
-#endif
-                                free(arabic_data);
-                                free(str);
-                                mph_table_deinit(&arabic_shaping_table);
-                                fclose(arabic_shaping);
-                            }
-                        }
-
-                        fprintf(f, "#endif /* %s */", macro);
-                        fclose(f);
-                    }
-                    printf("%s\n",filename);
+// Reads the general category and bidi class fields of UnicodeData.txt, including the ranges given by
+// First and Last entries. Unlisted codepoints are unassigned, their bidi class is the default of
+// bidi_defaults.
+static int read_unicode_data(const char *path, const uint8_t *bidi_defaults, version_record_t *records)
+{
+    FILE *in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return 0;
+    }
+
+    for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+        records[c].general_category = 0;
+        records[c].bidi_class = bidi_defaults[c];
+    }
+
+    // codepoint; name; general category; combining class; bidi class; ...
+    char line[1024];
+    unsigned int range_first = 0;
+    while (fgets(line, sizeof(line), in)) {
+        unsigned int c;
+        char name[256], gc[8], bidi[8];
+        if (sscanf(line, "%x;%255[^;];%7[^;];%*[^;];%7[^;]", &c, name, gc, bidi) != 4) continue;
+        int g = find_property_value(general_category_names, COUNTOF(general_category_names), gc, (int)strlen(gc));
+        int b = find_property_value(bidi_class_names, COUNTOF(bidi_class_names), bidi, (int)strlen(bidi));
+        if (g < 0 || b < 0 || c >= UNICODE_CODEPOINT_COUNT) {
+            fprintf(stderr, "Unexpected line: %s", line);
+            continue;
+        }
+
+        size_t len = strlen(name);
+        if (len > 7 && !strcmp(name + len - 7, ", First>")) {
+            range_first = c;
+            continue;
+        }
+
+        unsigned int first = len > 6 && !strcmp(name + len - 6, ", Last>") ? range_first : c;
+        for (unsigned int k = first; k <= c; ++k) {
+            records[k].general_category = (uint8_t)g;
+            records[k].bidi_class = (uint8_t)b;
+        }
+    }
+    fclose(in);
+    return 1;
+}
+
+// Reads the properties of an older version from <ucd_root>/<version>/ucd: UnicodeData.txt, Scripts.txt,
+// LineBreak.txt and ArabicShaping.txt. A property whose file isn't there keeps the values of the
+// version after it in records. Codepoints ArabicShaping.txt doesn't list are transparent if they are
+// marks or format characters and non joining otherwise.
+static void read_version(const char *dir, const uint8_t *bidi_defaults, version_record_t *records, uint8_t *scratch)
+{
+    char path[512];
+    uint8_t *values = scratch;
+    int unknown = COUNTOF(script_names) - 1;
+    int transparent = find_property_value(joining_type_names, COUNTOF(joining_type_names), "T", 1);
+    const char *transparent_categories[] = {"Mn","Me","Cf"};
+
+    snprintf(path, sizeof(path), "%s/UnicodeData.txt", dir);
+    read_unicode_data(path, bidi_defaults, records);
+
+    const char *long_names[COUNTOF(script_names)];
+    for (int i = 0; i < COUNTOF(script_names); ++i) long_names[i] = script_names[i][0];
+    memset(values, unknown, UNICODE_CODEPOINT_COUNT);
+    snprintf(path, sizeof(path), "%s/Scripts.txt", dir);
+    if (read_property_file_into(path, long_names, COUNTOF(script_names), 0, values))
+        for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) records[c].script = values[c];
+
+    memset(values, 0, UNICODE_CODEPOINT_COUNT);
+    snprintf(path, sizeof(path), "%s/LineBreak.txt", dir);
+    if (read_property_file_into(path, line_break_class_names, COUNTOF(line_break_class_names), 0, values))
+        for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) records[c].line_break = values[c];
+
+    uint8_t *types = values, *groups = values + UNICODE_CODEPOINT_COUNT;
+    for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+        types[c] = 0;
+        for (int k = 0; k < COUNTOF(transparent_categories); ++k)
+            if (!strcmp(general_category_names[records[c].general_category], transparent_categories[k]))
+                types[c] = (uint8_t)transparent;
+    }
+    memset(groups, 0, UNICODE_CODEPOINT_COUNT);
+    snprintf(path, sizeof(path), "%s/ArabicShaping.txt", dir);
+    if (read_arabic_shaping(path, types, groups)) {
+        for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+            records[c].joining_type = types[c];
+            records[c].joining_group = groups[c];
+        }
+    }
+}
+
+// Stores the older UCD versions as the runs of codepoints whose general category, script, bidi class,
+// line break class or joining differ from the version after them, starting from the newest version
+// in ucd_path. The older ones are read from <ucd_root>/<version>/ucd, codepoints that weren't assigned
+// yet have the defaults of unassigned codepoints, the bidi ones from the @missing lines of the newest
+// DerivedBidiClass.txt. Script extensions aren't kept, an older script replaces them.
+int generate_versions_header(const char *ucd_path, const char *ucd_root, const uint8_t *scripts,
+                             const uint8_t *bidi_classes, const uint8_t *line_break_classes, const char *out_path)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/extracted/DerivedGeneralCategory.txt", ucd_path);
+    uint8_t *general_categories = read_property_file(path, general_category_names, COUNTOF(general_category_names));
+    snprintf(path, sizeof(path), "%s/extracted/DerivedJoiningType.txt", ucd_path);
+    uint8_t *types = read_property_file(path, joining_type_names, COUNTOF(joining_type_names));
+    uint8_t *groups = calloc(UNICODE_CODEPOINT_COUNT, 1), *bidi_defaults = calloc(UNICODE_CODEPOINT_COUNT, 1);
+    snprintf(path, sizeof(path), "%s/ArabicShaping.txt", ucd_path);
+    int ok = general_categories && types && read_arabic_shaping(path, NULL, groups);
+    snprintf(path, sizeof(path), "%s/extracted/DerivedBidiClass.txt", ucd_path);
+    ok = ok && read_property_file_into(path, bidi_class_names, COUNTOF(bidi_class_names), 1, bidi_defaults);
+    FILE *f = ok ? fopen(out_path, "w+") : NULL;
+    if (!f) {
+        if (ok) fprintf(stderr, "Failed to open %s\n", out_path);
+        free(general_categories); free(types); free(groups); free(bidi_defaults);
+        return -1;
+    }
+
+    version_record_t *next = malloc(UNICODE_CODEPOINT_COUNT * sizeof(version_record_t));
+    version_record_t *records = malloc(UNICODE_CODEPOINT_COUNT * sizeof(version_record_t));
+    uint8_t *scratch = malloc(UNICODE_CODEPOINT_COUNT * 2);
+    for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+        next[c] = (version_record_t){general_categories[c], scripts[c], bidi_classes[c], line_break_classes[c],
+                                     types[c], groups[c]};
+    }
+
+    int version_count = COUNTOF(ucd_versions), run_count = 0, value_count = 0, max_values = 1 << 16;
+    uint32_t (*runs)[2] = malloc(UNICODE_CODEPOINT_COUNT * sizeof(*runs));
+    version_record_t *values = malloc(max_values * sizeof(version_record_t));
+    int (*offsets)[2] = calloc(version_count, sizeof(*offsets));
+
+    for (int v = version_count - 2; v >= 0; --v) {
+        char dir[512];
+        snprintf(dir, sizeof(dir), "%s/%d.%d.%d/ucd", ucd_root, ucd_versions[v][0], ucd_versions[v][1], ucd_versions[v][2]);
+        memcpy(records, next, UNICODE_CODEPOINT_COUNT * sizeof(version_record_t));
+        read_version(dir, bidi_defaults, records, scratch);
+
+        offsets[v][0] = run_count;
+        for (uint32_t c = 0; c < UNICODE_CODEPOINT_COUNT; ++c) {
+            if (!memcmp(&records[c], &next[c], sizeof(version_record_t))) continue;
+
+            int k = 0;
+            while (k < value_count && memcmp(&values[k], &records[c], sizeof(version_record_t))) ++k;
+            if (k == value_count) {
+                if (value_count == max_values) {
+                    fprintf(stderr, "Too many version records\n");
+                    break;
                 }
+                values[value_count++] = records[c];
+            }
+
+            uint32_t *last = run_count > offsets[v][0] ? runs[run_count - 1] : NULL;
+            if (last && last[1] == (uint32_t)k && (last[0] & 0x1fffff) + (last[0] >> 21) + 1 == c && (last[0] >> 21) < 0x7ff) {
+                last[0] += 1 << 21;
+            } else {
+                runs[run_count][0] = c;
+                runs[run_count++][1] = (uint32_t)k;
             }
         }
+        offsets[v][1] = run_count - offsets[v][0];
+
+        version_record_t *t = next; next = records; records = t;
+    }
+
+    fprintf(f, "#ifndef HZ_UCD_VERSIONS_H\n#define HZ_UCD_VERSIONS_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from UnicodeData.txt, Scripts.txt, LineBreak.txt and\n");
+    fprintf(f, "// ArabicShaping.txt of each UCD version\n");
+    fprintf(f, "// Included by hz.c only, the tables stay out of the public header\n\n");
+    fprintf(f, "#define HZ_UCD_VERSION_COUNT %d\n\n", version_count);
+
+    fprintf(f, "// version, first run in hz_ucd_version_deltas and number of runs of the codepoints whose values\n");
+    fprintf(f, "// differ from the version after it, the newest version has none\n");
+    fprintf(f, "static const uint32_t hz_ucd_versions[%d][3] = {", version_count);
+    for (int v = 0; v < version_count; ++v) {
+        if (!(v % 3)) fprintf(f, "\n    ");
+        fprintf(f, "{HZ_MAKE_VERSION(%d,%d,%d),%d,%d},", ucd_versions[v][0], ucd_versions[v][1], ucd_versions[v][2],
+                offsets[v][0], offsets[v][1]);
     }
-    while(FindNextFile(hFind, &fdFile)); //Find the next file.
-#endif
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "// general category, script, bidi class, line break class, joining type and joining group\n");
+    fprintf(f, "static const uint8_t hz_ucd_version_records[%d][6] = {", value_count);
+    for (int i = 0; i < value_count; ++i) {
+        const version_record_t *r = &values[i];
+        if (!(i % 6)) fprintf(f, "\n    ");
+        fprintf(f, "{%d,%d,%d,%d,%d,%d},", r->general_category, r->script, r->bidi_class, r->line_break,
+                r->joining_type, r->joining_group);
+    }
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "// first codepoint | (length - 1) << 21 and the index in hz_ucd_version_records of runs of codepoints\n");
+    fprintf(f, "static const uint32_t hz_ucd_version_deltas[%d][2] = {", run_count);
+    for (int i = 0; i < run_count; ++i) {
+        if (!(i % 6)) fprintf(f, "\n    ");
+        fprintf(f, "{0x%X,%u},", runs[i][0], runs[i][1]);
+    }
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "#endif /* HZ_UCD_VERSIONS_H */\n");
+    fclose(f);
+
+    printf("versions: %d runs, %d records\n", run_count, value_count);
+    free(runs); free(values); free(offsets); free(next); free(records); free(scratch);
+    free(general_categories); free(types); free(groups); free(bidi_defaults);
+    return 0;
+}
+
+// log2 of the number of words of each length in the Brotli static dictionary, RFC 7932 section 8
+static const int brotli_dictionary_size_bits[25] = {
+    0, 0, 0, 0, 10, 10, 11, 11, 10, 10, 10, 10, 10, 9, 9, 8, 7, 7, 8, 7, 7, 6, 6, 5, 5
+};
+
+// Embeds the Brotli static dictionary (the binary form of RFC 7932 appendix A, dictionary.bin in the
+// reference implementation) for the WOFF2 decoder, along with the offsets of the words of each length.
+int generate_brotli_dictionary_header(const char *dictionary_path, const char *out_path)
+{
+    uint32_t offsets[25] = {0}, size = 0;
+    for (int length = 4; length < 25; ++length) {
+        offsets[length] = size;
+        size += length << brotli_dictionary_size_bits[length];
+    }
+
+    FILE *in = fopen(dictionary_path, "rb");
+    if (!in) {
+        fprintf(stderr, "Failed to open %s\n", dictionary_path);
+        return -1;
+    }
+
+    uint8_t *data = malloc(size + 1);
+    size_t read = fread(data, 1, size + 1, in);
+    fclose(in);
+    if (read != size) {
+        fprintf(stderr, "%s: expected %u bytes, got %zu\n", dictionary_path, size, read);
+        free(data);
+        return -1;
+    }
+
+    FILE *f = fopen(out_path, "w+");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", out_path);
+        free(data);
+        return -1;
+    }
+
+    fprintf(f, "#ifndef HZ_BROTLI_DICTIONARY_H\n#define HZ_BROTLI_DICTIONARY_H\n\n");
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "// Generated by generate_ucd_headers.c from the Brotli static dictionary (RFC 7932 appendix A)\n\n");
+    fprintf(f, "#define HZ_BROTLI_MIN_DICTIONARY_WORD_LENGTH 4\n");
+    fprintf(f, "#define HZ_BROTLI_MAX_DICTIONARY_WORD_LENGTH 24\n\n");
+
+    fprintf(f, "static const uint8_t hz_brotli_dictionary_size_bits[25] = {\n    ");
+    for (int i = 0; i < 25; ++i) fprintf(f, "%d,", brotli_dictionary_size_bits[i]);
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static const uint32_t hz_brotli_dictionary_offsets[25] = {\n    ");
+    for (int i = 0; i < 25; ++i) fprintf(f, "%u,", offsets[i]);
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static const uint8_t hz_brotli_dictionary[%u] = {", size);
+    for (uint32_t i = 0; i < size; ++i) {
+        if (!(i % 32)) fprintf(f, "\n    ");
+        fprintf(f, "%d,", data[i]);
+    }
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "#endif /* HZ_BROTLI_DICTIONARY_H */\n");
+    fclose(f);
+    free(data);
+    return 0;
 }
 
 int main(int argc, char *argv[]) {
-    generate();
+    // line break, bidi, script and normalization data are taken from a single, preferably the latest, UCD version
+    const char *ucd_path = argc > 1 ? argv[1] : "./UCD/15.0.0/ucd";
+    char path[512], path2[512];
+    uint8_t *line_break = NULL, *bidi = NULL, *scripts = NULL, *script_values = NULL, *ccc = NULL;
+    snprintf(path, sizeof(path), "%s/LineBreak.txt", ucd_path);
+    generate_line_break_header(path, "./hz/hz_ucd_line_break.h", &line_break);
+    snprintf(path, sizeof(path), "%s/extracted/DerivedBidiClass.txt", ucd_path);
+    snprintf(path2, sizeof(path2), "%s/BidiBrackets.txt", ucd_path);
+    generate_bidi_header(path, path2, "./hz/hz_ucd_bidi.h", &bidi);
+    snprintf(path, sizeof(path), "%s/Scripts.txt", ucd_path);
+    snprintf(path2, sizeof(path2), "%s/ScriptExtensions.txt", ucd_path);
+    generate_script_header(path, path2, "./hz/hz_ucd_script.h", &scripts, &script_values);
+    snprintf(path, sizeof(path), "%s/UnicodeData.txt", ucd_path);
+    snprintf(path2, sizeof(path2), "%s/DerivedNormalizationProps.txt", ucd_path);
+    generate_normalization_header(path, path2, "./hz/hz_ucd_normalization.h", &ccc);
+    if (line_break && bidi && scripts && script_values && ccc) {
+        generate_properties_header(ucd_path, scripts, script_values, bidi, line_break, ccc, "./hz/hz_ucd_properties.h");
+        generate_versions_header(ucd_path, argc > 3 ? argv[3] : "./UCD", scripts, bidi, line_break, "./hz/hz_ucd_versions.h");
+    }
+    free(line_break); free(bidi); free(scripts); free(script_values); free(ccc);
+    generate_property_value_headers("./hz/hz_ucd_general_category.h", "./hz/hz_ucd_joining.h");
+    generate_brotli_dictionary_header(argc > 2 ? argv[2] : "./brotli/dictionary.bin", "./hz/hz_brotli_dictionary.h");
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
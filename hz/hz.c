@@ -1,4 +1,7 @@
 #include "hz.h"
+#include "hz_ucd_normalization.h"
+#include "hz_ucd_properties.h"
+#include "hz_ucd_versions.h"
 
 #if HZ_COMPILER & (HZ_COMPILER_CLANG | HZ_COMPILER_GCC)
 #    define HZ_PACK(__Declaration__) __Declaration__ __attribute__((__packed__))
@@ -33,7 +36,12 @@ HZ_ALWAYS_INLINE void hz_memcpy(void *dst, const void *src, size_t size) {
 #  define HZ_MEMSET hz_memset
 #endif
 
+HZ_ALWAYS_INLINE void hz_memmove(void *dst, const void *src, size_t size) {
+    memmove(dst,src,size);
+}
+
 #define HZ_MEMCPY hz_memcpy
+#define HZ_MEMMOVE hz_memmove
 
 #define hz_zero(_Data, _Size) HZ_MEMSET(_Data,0,_Size)
 #define hz_zero_struct(_Struct) HZ_MEMSET((void *)&(_Struct),0,sizeof(_Struct))
@@ -45,6 +53,10 @@ HZ_ALWAYS_INLINE void hz_memcpy(void *dst, const void *src, size_t size) {
 #include <assert.h>
 #include <stdarg.h>
 
+#if HZ_ARCH & HZ_ARCH_SSSE3_BIT
+#   include <tmmintrin.h>
+#endif
+
 #define SIZEOF_VOIDPTR sizeof(void*)
 
 #define KIB 1024
@@ -315,53 +327,201 @@ uint32_t hz_hash2_lowbias32(uint32_t k1, uint32_t k2) {
     return h;
 }
 
+HZ_ALWAYS_INLINE uint32_t hz_hash32_lowbias(uint32_t k) {
+    k ^= k >> 16;
+    k *= 0x7feb352d;
+    k ^= k >> 15;
+    k *= 0x846ca68b;
+    k ^= k >> 16;
+    return k;
+}
+
+/* Robin Hood hash table
+
+    Open addressing over a power-of-two bucket array. Every occupied bucket stores its
+    probe distance + 1 in `dists` (0 marks an empty bucket). On insertion an entry that
+    is further from its home bucket steals the slot of a "richer" one, which keeps probe
+    sequences short and lets a search stop as soon as it meets a bucket closer to home
+    than itself. Removal shifts the following cluster back by one, so no tombstones are
+    ever left behind. The table grows by doubling once the load factor goes over
+    HZ_HT_MAX_LOAD_NUM / HZ_HT_MAX_LOAD_DEN.
+
+    NOTE: insertions can move entries around, iterators and value pointers are only
+    valid until the next insert or remove.
+*/
+#define HZ_HT_MIN_CAPACITY 16
+#define HZ_HT_MAX_LOAD_NUM 7
+#define HZ_HT_MAX_LOAD_DEN 8
+#define HZ_HT_MAX_DIST 255
+
 typedef struct hz_ht_t {
-    uint8_t *flags;
+    uint8_t *dists;
     uint32_t *keys;
     uint32_t *values;
-    size_t size;
+    size_t size; // bucket count, always a power of two
     size_t num_occupied;
     hz_allocator_t *alctr;
+    hz_memory_arena_t *arena; // when set, all storage comes from this arena
 } hz_ht_t;
 
+HZ_STATIC size_t hz_ht_capacity_for(size_t count)
+{
+    size_t cap = HZ_HT_MIN_CAPACITY;
+    while (cap * HZ_HT_MAX_LOAD_NUM < count * HZ_HT_MAX_LOAD_DEN)
+        cap <<= 1;
+    return cap;
+}
+
+HZ_STATIC void *hz_ht_alloc(hz_ht_t *ht, size_t size)
+{
+    if (ht->arena != NULL)
+        return hz_memory_arena_alloc(ht->arena, size);
+
+    return hz_allocate(ht->alctr, size);
+}
+
+HZ_STATIC void hz_ht_free(hz_ht_t *ht, void *ptr)
+{
+    if (ht->arena == NULL && ptr != NULL)
+        hz_deallocate(ht->alctr, ptr);
+}
+
+HZ_STATIC hz_bool hz_ht_alloc_buckets(hz_ht_t *ht, size_t size)
+{
+    uint8_t *dists = hz_ht_alloc(ht, size*sizeof(uint8_t));
+    uint32_t *keys = hz_ht_alloc(ht, size*sizeof(uint32_t));
+    uint32_t *values = hz_ht_alloc(ht, size*sizeof(uint32_t));
+
+    if (dists == NULL || keys == NULL || values == NULL) {
+        hz_ht_free(ht, dists);
+        hz_ht_free(ht, keys);
+        hz_ht_free(ht, values);
+        return HZ_FALSE;
+    }
+
+    HZ_MEMSET(dists, 0, size);
+    ht->dists = dists;
+    ht->keys = keys;
+    ht->values = values;
+    ht->size = size;
+    ht->num_occupied = 0;
+    return HZ_TRUE;
+}
+
 void hz_ht_clear(hz_ht_t *ht) {
-    HZ_MEMSET(ht->flags, HZ_HT_EMPTY, ht->size);
-    HZ_MEMSET(ht->keys, 0, ht->size*sizeof(uint32_t));
-    HZ_MEMSET(ht->values, 0, ht->size*sizeof(uint32_t));
+    HZ_MEMSET(ht->dists, 0, ht->size);
     ht->num_occupied = 0;
 }
 
-void hz_ht_init(hz_ht_t *ht, hz_allocator_t *alctr, size_t size)
+HZ_STATIC hz_error_t hz_ht_init(hz_ht_t *ht, hz_allocator_t *alctr, hz_memory_arena_t *arena, size_t size)
 {
-    ht->alctr = alctr;
-    ht->keys = hz_allocate(alctr, size*sizeof(uint32_t));
-    ht->values = hz_allocate(alctr,size*sizeof(uint32_t));
-    ht->flags = hz_allocate(alctr,size*sizeof(uint8_t));
-    ht->num_occupied = 0;
-    ht->size = size;
-    hz_ht_clear(ht);
+    *ht = (hz_ht_t){.alctr = alctr, .arena = arena};
+    return hz_ht_alloc_buckets(ht, hz_ht_capacity_for(size)) ? HZ_OK : HZ_ERROR_OUT_OF_MEMORY;
 }
 
 hz_ht_t *hz_ht_create(hz_allocator_t *alctr, size_t size){
     hz_ht_t *ht = hz_allocate(alctr, sizeof(*ht));
-    hz_ht_init(ht,alctr,size);
+    if (ht != NULL && hz_ht_init(ht,alctr,NULL,size) != HZ_OK) {
+        hz_deallocate(alctr, ht);
+        return NULL;
+    }
+
+    return ht;
+}
+
+hz_ht_t *hz_ht_create_arena(hz_memory_arena_t *arena, size_t size){
+    hz_ht_t *ht = hz_memory_arena_alloc(arena, sizeof(*ht));
+    if (ht != NULL && hz_ht_init(ht,NULL,arena,size) != HZ_OK)
+        return NULL;
+
     return ht;
 }
 
 void hz_ht_destroy(hz_ht_t *ht)
 {
-    hz_deallocate(ht->alctr,ht->flags);
+    if (ht == NULL || ht->arena != NULL)
+        return; // storage is owned by the arena
+
+    hz_deallocate(ht->alctr,ht->dists);
     hz_deallocate(ht->alctr,ht->keys);
     hz_deallocate(ht->alctr,ht->values);
+    hz_deallocate(ht->alctr,ht);
 }
 
-uint32_t hz_ht_next_valid_index(hz_ht_t *ht, uint32_t index) {
-    if (index >= ht->size) return HZ_HT_INVALID_INDEX;
+HZ_ALWAYS_INLINE size_t hz_ht_home(const hz_ht_t *ht, uint32_t key) {
+    return hz_hash32_lowbias(key) & (ht->size - 1);
+}
+
+// places an entry known not to be in the table. If a probe sequence gets too long the
+// entry left homeless (which may be a displaced resident) is handed back through key/value.
+HZ_STATIC hz_bool hz_ht_place(hz_ht_t *ht, uint32_t *key, uint32_t *value)
+{
+    size_t mask = ht->size - 1;
+    size_t h = hz_ht_home(ht, *key);
+    uint32_t k = *key, v = *value, d = 1;
+
+    for (;;) {
+        if (!ht->dists[h]) {
+            ht->dists[h] = d;
+            ht->keys[h] = k;
+            ht->values[h] = v;
+            ++ht->num_occupied;
+            return HZ_TRUE;
+        }
+
+        if (ht->dists[h] < d) {
+            // resident is closer to its home than we are, take its place and carry it forward
+            uint32_t tk = ht->keys[h], tv = ht->values[h], td = ht->dists[h];
+            ht->keys[h] = k; ht->values[h] = v; ht->dists[h] = d;
+            k = tk; v = tv; d = td;
+        }
+
+        if (hz_unlikely(++d > HZ_HT_MAX_DIST)) {
+            *key = k; *value = v;
+            return HZ_FALSE;
+        }
+
+        h = (h + 1) & mask;
+    }
+}
+
+HZ_STATIC hz_bool hz_ht_rehash(hz_ht_t *ht, size_t new_size)
+{
+    hz_ht_t old = *ht;
+
+    for (;;) {
+        if (!hz_ht_alloc_buckets(ht, new_size)) {
+            *ht = old;
+            return HZ_FALSE;
+        }
+
+        hz_bool ok = HZ_TRUE;
+        for (size_t i = 0; i < old.size && ok; ++i) {
+            uint32_t k = old.keys[i], v = old.values[i];
+            if (old.dists[i])
+                ok = hz_ht_place(ht, &k, &v);
+        }
+
+        if (ok) break;
+
+        // pathological clustering, try again with twice the buckets
+        hz_ht_free(ht, ht->dists);
+        hz_ht_free(ht, ht->keys);
+        hz_ht_free(ht, ht->values);
+        new_size <<= 1;
+    }
+
+    hz_ht_free(&old, old.dists);
+    hz_ht_free(&old, old.keys);
+    hz_ht_free(&old, old.values);
+    return HZ_TRUE;
+}
 
-    while ((ht->flags[index] & (HZ_HT_EMPTY|HZ_HT_TOMBSTONE)) && index < ht->size)
+uint32_t hz_ht_next_valid_index(hz_ht_t *ht, uint32_t index) {
+    while (index < ht->size && !ht->dists[index])
         ++index;
 
-    if (index != ht->size)
+    if (index < ht->size)
         return index;
 
     return HZ_HT_INVALID_INDEX;
@@ -390,12 +550,12 @@ hz_ht_iter_t hz_ht_iter_begin(hz_ht_t *ht) {
 }
 
 hz_bool hz_ht_search(hz_ht_t *ht, uint32_t key, hz_ht_iter_t *it) {
-    uint32_t h = hz_hash32_fnv1a(key) % ht->size;
-    for (uint32_t i = 0; i < ht->size && !(ht->flags[h] & HZ_HT_EMPTY); ++i, h = (h + i) % ht->size) {
-        if (ht->flags[h] & HZ_HT_TOMBSTONE)
-            continue; // skip tombstone
+    size_t mask = ht->size - 1;
+    size_t h = hz_ht_home(ht, key);
 
-        // bucket is occupied
+    // an entry can't be further from home than the resident of the bucket we're looking at,
+    // so the probe ends as soon as the resident is closer to its home than we'd be
+    for (uint32_t d = 1; ht->dists[h] >= d; ++d, h = (h + 1) & mask) {
         if (ht->keys[h] == key) {
             // keys match, set iterator pointers and return successfully
             it->key = ht->keys[h];
@@ -408,36 +568,47 @@ hz_bool hz_ht_search(hz_ht_t *ht, uint32_t key, hz_ht_iter_t *it) {
     return HZ_FALSE; // didn't find item
 }
 
-// returns true if insert succeeded, and false if it didn't
+// returns true if insert succeeded, and false if it didn't (out of memory)
 hz_bool hz_ht_insert(hz_ht_t *ht, uint32_t key, uint32_t value)
 {
-    uint32_t h = hz_hash32_fnv1a(key) % ht->size;
+    hz_ht_iter_t it;
+    if (hz_ht_search(ht, key, &it)) { // entry aready exists, replace with our value
+        *it.ptr_value = value;
+        return HZ_TRUE;
+    }
 
-    for (uint32_t i = 0; i < ht->size; ++i, h = (h + i) % ht->size) {
-        if ((ht->flags[h] & HZ_HT_OCCUPIED) && ht->keys[h] == key) { // entry aready exists, replace with our value
-            ht->values[h] = value;
-            ++ht->num_occupied;
-            return HZ_TRUE;
-        }
+    if ((ht->num_occupied + 1) * HZ_HT_MAX_LOAD_DEN > ht->size * HZ_HT_MAX_LOAD_NUM) {
+        if (!hz_ht_rehash(ht, ht->size << 1))
+            return HZ_FALSE;
+    }
 
-        if (ht->flags[h] & (HZ_HT_EMPTY | HZ_HT_TOMBSTONE)) { // found empty/tombstone slot, insert value and return
-            ht->keys[h] = key;
-            ht->values[h] = value;
-            ht->flags[h] = HZ_HT_OCCUPIED;
-            ++ht->num_occupied;
-            return HZ_TRUE;
-        }
+    while (!hz_ht_place(ht, &key, &value)) {
+        // key/value now hold whichever entry got pushed out, grow and place it again
+        if (!hz_ht_rehash(ht, ht->size << 1))
+            return HZ_FALSE;
     }
-    
-    // insertion failed
-    return HZ_FALSE;
+
+    return HZ_TRUE;
 }
+
 size_t hz_ht_size(hz_ht_t* ht) { return ht->num_occupied;}
+
 hz_bool hz_ht_remove(hz_ht_t *ht, uint32_t key)
 {
     hz_ht_iter_t it;
-    if (hz_ht_search(ht, key, &it)) {   
-        ht->flags[it.index] = HZ_HT_TOMBSTONE;
+    if (hz_ht_search(ht, key, &it)) {
+        size_t mask = ht->size - 1;
+        size_t h = it.index, n = (h + 1) & mask;
+
+        // backward-shift the rest of the cluster instead of leaving a tombstone
+        while (ht->dists[n] > 1) {
+            ht->keys[h] = ht->keys[n];
+            ht->values[h] = ht->values[n];
+            ht->dists[h] = ht->dists[n] - 1;
+            h = n; n = (n + 1) & mask;
+        }
+
+        ht->dists[h] = 0;
         --ht->num_occupied;
         return HZ_TRUE;
     }
@@ -490,17 +661,6 @@ HZ_ALWAYS_INLINE uint32_t hz_bswap32(uint32_t x)
     return v;
 }
 
-HZ_ALWAYS_INLINE void hz_byte_swap_u16x4(uint64_t *p) {
-    uint64_t q = 0;
-    q |= (*p & 0xff00ff00ff00ff00) >> 8;
-    q |= (*p & 0x00ff00ff00ff00ff) << 8;
-    *p = q;
-}
-
-HZ_ALWAYS_INLINE void hz_byte_swap_u16x2(u32 *p) {
-    *p = ((*p & 0xff00ff00) >> 8) | ((*p & 0x00ff00ff) << 8);
-}
-
 HZ_ALWAYS_INLINE void hz_byte_swap_16(uint16_t *p)
 {
     *p = (*p << 8) | (*p >> 8);
@@ -516,15 +676,6 @@ HZ_ALWAYS_INLINE void hz_byte_swap_32(uint32_t *p)
     *p = q;
 }
 
-HZ_ALWAYS_INLINE void hz_byte_swap_u32x2(uint64_t *p) {
-    uint64_t q = 0;
-    q |= (*p & 0xff000000ff000000) >> 24;
-    q |= (*p & 0x00ff000000ff0000) >> 8;
-    q |= (*p & 0x0000ff000000ff00) << 8;
-    q |= (*p & 0x000000ff000000ff) << 24;
-    *p = q;
-}
-
 HZ_ALWAYS_INLINE uint64_t hz_bswap64(uint64_t x)
 {
     uint64_t v = 0;
@@ -755,29 +906,105 @@ uint64_t hz_parser_read_u64(hz_parser_t *p)
     return p->must_bswap ? hz_bswap64(v) : v;
 }
 
+HZ_STATIC HZ_ALWAYS_INLINE uint16_t hz_load_u16be(const uint8_t *p)
+{
+    return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+HZ_STATIC HZ_ALWAYS_INLINE uint32_t hz_load_u32be(const uint8_t *p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
 void hz_parser_read_block(hz_parser_t *p, uint8_t *write_addr, size_t size)
 {
     hz_memcpy(write_addr, hz_parser_at_cursor(p), size);
     hz_parser_advance(p, size);
 }
 
+// A vector at a time with a byte shuffle where there is one, the values left over one at a time.
+void hz_bswap_u16_block(uint16_t *values, size_t count)
+{
+    size_t i = 0;
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+    const __m256i order = _mm256_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14,
+                                           1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+    for (; i + 16 <= count; i += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        _mm256_storeu_si256((__m256i *)(values + i), _mm256_shuffle_epi8(v, order));
+    }
+#endif
+#if HZ_ARCH & HZ_ARCH_SSSE3_BIT
+    const __m128i order128 = _mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+        _mm_storeu_si128((__m128i *)(values + i), _mm_shuffle_epi8(v, order128));
+    }
+#elif HZ_ARCH & HZ_ARCH_NEON_BIT
+    for (; i + 8 <= count; i += 8)
+        vst1q_u8((uint8_t *)(values + i), vrev16q_u8(vld1q_u8((const uint8_t *)(values + i))));
+#endif
+    for (; i < count; ++i)
+        values[i] = hz_bswap16(values[i]);
+}
+
+void hz_bswap_u32_block(uint32_t *values, size_t count)
+{
+    size_t i = 0;
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+    const __m256i order = _mm256_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+                                           3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12);
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        _mm256_storeu_si256((__m256i *)(values + i), _mm256_shuffle_epi8(v, order));
+    }
+#endif
+#if HZ_ARCH & HZ_ARCH_SSSE3_BIT
+    const __m128i order128 = _mm_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12);
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+        _mm_storeu_si128((__m128i *)(values + i), _mm_shuffle_epi8(v, order128));
+    }
+#elif HZ_ARCH & HZ_ARCH_NEON_BIT
+    for (; i + 4 <= count; i += 4)
+        vst1q_u8((uint8_t *)(values + i), vrev32q_u8(vld1q_u8((const uint8_t *)(values + i))));
+#endif
+    for (; i < count; ++i)
+        values[i] = hz_bswap32(values[i]);
+}
+
+void hz_bswap_u64_block(uint64_t *values, size_t count)
+{
+    size_t i = 0;
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+    const __m256i order = _mm256_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,
+                                           7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+    for (; i + 4 <= count; i += 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        _mm256_storeu_si256((__m256i *)(values + i), _mm256_shuffle_epi8(v, order));
+    }
+#endif
+#if HZ_ARCH & HZ_ARCH_SSSE3_BIT
+    const __m128i order128 = _mm_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+    for (; i + 2 <= count; i += 2) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+        _mm_storeu_si128((__m128i *)(values + i), _mm_shuffle_epi8(v, order128));
+    }
+#elif HZ_ARCH & HZ_ARCH_NEON_BIT
+    for (; i + 2 <= count; i += 2)
+        vst1q_u8((uint8_t *)(values + i), vrev64q_u8(vld1q_u8((const uint8_t *)(values + i))));
+#endif
+    for (; i < count; ++i)
+        values[i] = hz_bswap64(values[i]);
+}
+
 void hz_parser_read_u16_block(hz_parser_t *p, uint16_t *write_addr, size_t size)
 {
     hz_memcpy(write_addr, hz_parser_at_cursor(p), size*2);
     p->offset += size*2;
 
-    if (p->must_bswap) {
-        size_t swap_index = 0;
-        while(swap_index+4 <= size) {
-            hz_byte_swap_u16x4((uint64_t*)&write_addr[swap_index]);
-            swap_index += 4;
-        }
-
-        while (swap_index < size) {
-            hz_byte_swap_16(write_addr + swap_index);
-            ++swap_index;
-        }
-    }
+    if (p->must_bswap)
+        hz_bswap_u16_block(write_addr, size);
 }
 
 void hz_parser_read_u32_block(hz_parser_t *p, uint32_t *write_addr, size_t size)
@@ -785,101 +1012,63 @@ void hz_parser_read_u32_block(hz_parser_t *p, uint32_t *write_addr, size_t size)
     hz_memcpy(write_addr, hz_parser_at_cursor(p), size*4);
     p->offset += size*4;
 
-    if (p->must_bswap) {
-        size_t swap_index = 0;
-        while(swap_index+2 <= size) {
-            hz_byte_swap_u32x2((uint64_t*)&write_addr[swap_index]);
-            swap_index += 2;
-        }
-
-        while (swap_index < size) {
-            hz_byte_swap_32(write_addr + swap_index);
-            ++swap_index;
-        }
-    }
+    if (p->must_bswap)
+        hz_bswap_u32_block(write_addr, size);
 }
 
 void hz_parser_read_u64_block(hz_parser_t *p, uint64_t *write_addr, size_t size)
 {
-    while (size > 0) {
-        *write_addr++ = hz_parser_read_u64(p);
-        --size;
-    }
-}
-
-int hz_cmdread(hz_parser_t *p, int c_struct_align, void *dataptr, const char *cmd, ...)
-{
-    va_list va; va_start(va, cmd);
-
-    const char *curs = cmd;
-    uint8_t *mem = (uint8_t *)dataptr;
-    size_t member_offset = 0;
-    size_t member_array_count = 1;
-
-    while (*curs != '\0') {
-        switch (*curs) {
-            case '^': {
-                ++curs; // skip '^'
-                member_array_count = 0;
-                while (*curs >= '0' && *curs <= '9') {
-                    member_array_count *= 10;
-                    member_array_count += *curs - '0';
-                    ++curs;
-                }
+    hz_memcpy(write_addr, hz_parser_at_cursor(p), size*8);
+    p->offset += size*8;
 
-                break;
-            }
-            case 'b': {
-                ++curs;
-                hz_parser_read_block(p, (uint8_t *)mem, member_array_count);
-                member_offset += member_array_count;
-                member_array_count = 1;
-                break;
-            }
+    if (p->must_bswap)
+        hz_bswap_u64_block(write_addr, size);
+}
 
-            case 'w': {
-                ++curs;
-                member_offset += hz_align_forward(member_offset, c_struct_align ? 2 * member_array_count : 1);
-                hz_parser_read_u16_block(p,
-                            (uint16_t *)(mem + member_offset),
-                            member_array_count);
-                member_offset += 2 * member_array_count;
-                member_array_count = 1;
-                break;
-            }
+// Declares the struct of a table header made of big-endian 16-bit fields, along with hz_read_<name> which reads
+// it at the cursor. The field count is known at compile time, the reader unrolls to a load per field.
+#define HZ_U16_TABLE(name, ...) \
+    typedef struct hz_##name##_t { uint16_t __VA_ARGS__; } hz_##name##_t; \
+    HZ_STATIC HZ_ALWAYS_INLINE void hz_read_##name(hz_parser_t *p, hz_##name##_t *table) \
+    { \
+        const uint8_t *at = hz_parser_at_cursor(p); \
+        uint16_t *fields = (uint16_t *)table; \
+        for (size_t i = 0; i < sizeof(*table) / 2; ++i) \
+            fields[i] = hz_load_u16be(at + i * 2); \
+        hz_parser_advance(p, sizeof(*table)); \
+    }
 
-            case 'd': {
-                ++curs;
-                member_offset += hz_align_forward(member_offset, c_struct_align ? 4 * member_array_count : 1);
-                hz_parser_read_u32_block(p,
-                            (uint32_t *)(mem + member_offset),
-                            member_array_count);
-                member_offset += 4 * member_array_count;
-                member_array_count = 1;
-                break;
-            }
+HZ_U16_TABLE(gdef_header, glyph_class_def_offset, attach_list_offset, lig_caret_list_offset, mark_attach_class_def_offset)
+HZ_U16_TABLE(layout_header, script_list_offset, feature_list_offset, lookup_list_offset) // GSUB and GPOS
+HZ_U16_TABLE(kern_subtable_header, version, length, coverage)
+#define hz_table_views() (hz_.cfg.flags & HZ_CONFIG_FLAG_TABLE_VIEWS)
 
-            case 'q': {
-                ++curs;
-                member_offset += hz_align_forward(member_offset, c_struct_align ? 8 * member_array_count : 1);
-                hz_parser_read_u64_block(p,
-                            (uint64_t *)(mem + member_offset),
-                            member_array_count);
-                member_offset += 8 * member_array_count;
-                member_array_count = 1;
-                break;
-            }   
+// Reads count 16-bit values at the cursor. They are copied to the arena in host order, or in table view mode
+// the returned array is the big-endian font data itself, read it with hz_table_u16.
+HZ_STATIC uint16_t *hz_parser_read_u16_array(hz_parser_t *p, hz_memory_arena_t *memory_arena, size_t count)
+{
+    uint16_t *values;
 
-            case ' ': default: {
-                ++curs;
-                break;
-            }
-        }
+    if (hz_table_views()) {
+        values = (uint16_t *)hz_parser_at_cursor(p);
+        hz_parser_advance(p, count*2);
+    } else {
+        values = hz_memory_arena_alloc(memory_arena, count*2);
+        hz_parser_read_u16_block(p, values, count);
     }
 
-    va_end(va);
+    return values;
 }
 
+HZ_STATIC HZ_ALWAYS_INLINE uint16_t hz_table_u16(const uint16_t *array, size_t index)
+{
+    return hz_table_views() ? hz_load_u16be((const uint8_t *)array + index*2) : array[index];
+}
+
+// Shared by mark-to-base, mark-to-ligature and mark-to-mark, the target being the base, ligature or mark2.
+HZ_U16_TABLE(mark_attachment_header, mark_coverage_offset, target_coverage_offset, mark_class_count,
+                                     mark_array_offset, target_array_offset)
+
 typedef struct hz_array_t {
     size_t size;
     uint32_t *data;
@@ -1230,6 +1419,10 @@ void hz_buffer_init(hz_buffer_t *buffer)
     buffer->glyph_classes = NULL;
     buffer->attachment_classes = NULL;
     buffer->component_indices = NULL;
+    buffer->clusters = NULL;
+    buffer->glyph_flags = NULL;
+    buffer->font_indices = NULL;
+    buffer->joining_forms = NULL;
     buffer->glyph_metrics = NULL;
     buffer->attrib_flags = 0;
 }
@@ -1257,6 +1450,14 @@ hz_buffer_clear_attribs(hz_buffer_t *self, hz_glyph_attrib_flags_t attribs)
                 hz_vector_clear(self->attachment_classes);
             if (attribs & HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT)
                 hz_vector_clear(self->component_indices);
+            if (attribs & HZ_GLYPH_ATTRIB_CLUSTER_BIT)
+                hz_vector_clear(self->clusters);
+            if (attribs & HZ_GLYPH_ATTRIB_FLAGS_BIT)
+                hz_vector_clear(self->glyph_flags);
+            if (attribs & HZ_GLYPH_ATTRIB_FONT_INDEX_BIT)
+                hz_vector_clear(self->font_indices);
+            if (attribs & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT)
+                hz_vector_clear(self->joining_forms);
 
         }
 
@@ -1278,7 +1479,9 @@ typedef struct {
     uint16_t glyph_class; // 2 bytes
     uint16_t attachment_class; // 2 bytes
     uint16_t component_index; // 2 bytes
-} hz_glyph_object_t; // 28 bytes
+    uint32_t cluster; // 4 bytes
+    uint8_t joining_form; // 1 byte
+} hz_glyph_object_t; // 36 bytes
 
 void hz_buffer_reserve(hz_buffer_t *self, size_t capacity)
 {
@@ -1301,6 +1504,10 @@ void hz_buffer_add_glyph(hz_buffer_t *self,
         hz_vector_push_back(self->attachment_classes, go.attachment_class);
     if (self->attrib_flags & HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT)
         hz_vector_push_back(self->component_indices, go.component_index);
+    if (self->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT)
+        hz_vector_push_back(self->clusters, go.cluster);
+    if (self->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT)
+        hz_vector_push_back(self->joining_forms, go.joining_form);
 
     ++self->glyph_count;
 }
@@ -1321,6 +1528,10 @@ hz_glyph_object_t hz_buffer_get_glyph(hz_buffer_t *self, size_t index)
         go.attachment_class = self->attachment_classes[index];
     if (self->attrib_flags & HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT)
         go.component_index = self->component_indices[index];
+    if (self->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT)
+        go.cluster = self->clusters[index];
+    if (self->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT)
+        go.joining_form = self->joining_forms[index];
 
     return go;
 }
@@ -1343,6 +1554,14 @@ void hz_buffer_add_range(hz_buffer_t *self,
             hz_vector_push_many(self->attachment_classes, other->attachment_classes+v1, gap);
         if (self->attrib_flags & HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT)
             hz_vector_push_many(self->component_indices, other->component_indices+v1, gap);
+        if (self->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT)
+            hz_vector_push_many(self->clusters, other->clusters+v1, gap);
+        if (self->attrib_flags & HZ_GLYPH_ATTRIB_FLAGS_BIT)
+            hz_vector_push_many(self->glyph_flags, other->glyph_flags+v1, gap);
+        if (self->attrib_flags & HZ_GLYPH_ATTRIB_FONT_INDEX_BIT)
+            hz_vector_push_many(self->font_indices, other->font_indices+v1, gap);
+        if (self->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT)
+            hz_vector_push_many(self->joining_forms, other->joining_forms+v1, gap);
 
         self->glyph_count += gap;
     }
@@ -1373,12 +1592,24 @@ void hz_buffer_release(hz_buffer_t *buffer)
     if (buffer->attachment_classes != NULL) {
         hz_vector_destroy(buffer->attachment_classes);
     }
+    if (buffer->clusters != NULL) {
+        hz_vector_destroy(buffer->clusters);
+    }
+    if (buffer->glyph_flags != NULL) {
+        hz_vector_destroy(buffer->glyph_flags);
+    }
+    if (buffer->font_indices != NULL) {
+        hz_vector_destroy(buffer->font_indices);
+    }
+    if (buffer->joining_forms != NULL) {
+        hz_vector_destroy(buffer->joining_forms);
+    }
     hz_buffer_init(buffer);
 }
 
 void hz_buffer_destroy(hz_buffer_t *buffer)
 {
-    hz_buffer_clear(buffer);
+    hz_buffer_release(buffer);
     hz_free(buffer);
 }
 
@@ -1391,25 +1622,248 @@ typedef struct {
     uint32_t            flags;
 } hz_utf8_decoder_t;
 
-HZ_ALWAYS_INLINE uint32_t hz_mph_table_lookup(uint32_t n, int32_t G[], uint32_t k)
+struct hz_ucd_t {
+    const uint16_t *stage1, *stage2, *stage3;
+    const hz_ucd_record_t *records;
+};
+
+// Property tables of the newest version, the ones of a NULL hz_ucd_t.
+static const hz_ucd_t hz_ucd_newest = {
+    hz_ucd_properties_stage1, hz_ucd_properties_stage2, hz_ucd_properties_stage3, hz_ucd_records
+};
+
+// Record of all the properties of c, record zero past the end of Unicode.
+HZ_STATIC HZ_ALWAYS_INLINE const hz_ucd_record_t *hz_ucd_record(const hz_ucd_t *ucd, hz_unicode_t c)
+{
+    const hz_ucd_t *t = ucd ? ucd : &hz_ucd_newest;
+    if (c > 0x10ffff) return &t->records[0];
+
+    uint32_t i = t->stage1[c >> HZ_UCD_PROPERTIES_SHIFT1] + ((c >> HZ_UCD_PROPERTIES_SHIFT2) & HZ_UCD_PROPERTIES_MASK2);
+    i = t->stage2[i] + (c & HZ_UCD_PROPERTIES_MASK3);
+    return &t->records[t->stage3[i]];
+}
+
+// Set of distinct items of size bytes stored one after the other in items, found through an open
+// addressed table of their indices plus one.
+typedef struct {
+    uint8_t *items;
+    size_t size, count, max;
+    uint32_t *slots;
+    size_t slot_mask;
+} hz_ucd_intern_t;
+
+// Index of the item equal to item in set, added at the end if there is none. Returns -1 once the
+// set holds max items.
+HZ_STATIC int32_t hz_ucd_intern(hz_ucd_intern_t *set, const void *item)
+{
+    uint32_t h = 0x811c9dc5ul;
+    for (size_t i = 0; i < set->size; ++i) h = 0x01000193 * (h ^ ((const uint8_t *)item)[i]);
+
+    for (size_t i = h & set->slot_mask;; i = (i + 1) & set->slot_mask) {
+        uint32_t k = set->slots[i];
+        if (!k) break;
+        if (!memcmp(set->items + (k - 1) * set->size, item, set->size)) return (int32_t)(k - 1);
+    }
+
+    if (set->count == set->max) return -1;
+    HZ_MEMCPY(set->items + set->count * set->size, item, set->size);
+    for (size_t i = h & set->slot_mask;; i = (i + 1) & set->slot_mask) {
+        if (!set->slots[i]) {
+            set->slots[i] = (uint32_t)++set->count;
+            break;
+        }
+    }
+    return (int32_t)(set->count - 1);
+}
+
+// Decodes the tables of an older UCD version. The record of each codepoint of the newest tables
+// takes the values of every version's runs in hz_ucd_version_deltas from the newest down to this
+// one, then the records and the blocks of both trie stages are deduplicated again into tables of
+// the same shape as the generated ones, each ending with an unused entry for gathers.
+HZ_STATIC hz_ucd_t *hz_ucd_decode_version(size_t version_index)
+{
+    size_t block2 = HZ_UCD_PROPERTIES_MASK2 + 1, block3 = HZ_UCD_PROPERTIES_MASK3 + 1;
+    size_t stage1_size = HZ_ARRAY_SIZE(hz_ucd_properties_stage1) - 1, base_count = HZ_ARRAY_SIZE(hz_ucd_records) - 1;
+    size_t slot_count = 0x20000, max = 0x10000;
+
+    // the scratch: a record index per codepoint, the three sets and their slots
+    size_t scratch_size = 0x110000 * sizeof(uint16_t) + max * (sizeof(hz_ucd_record_t) + 2 * sizeof(uint16_t))
+                        + 3 * slot_count * sizeof(uint32_t);
+    uint8_t *scratch = hz_malloc(scratch_size);
+    if (!scratch) return NULL;
+    HZ_MEMSET(scratch, 0, scratch_size);
+
+    uint16_t *indices = (uint16_t *)scratch;
+    hz_ucd_intern_t records = {(uint8_t *)(indices + 0x110000), sizeof(hz_ucd_record_t), 0, max};
+    hz_ucd_intern_t stage3 = {records.items + max * sizeof(hz_ucd_record_t), block3 * sizeof(uint16_t), 0, max / block3};
+    hz_ucd_intern_t stage2 = {stage3.items + max * sizeof(uint16_t), block2 * sizeof(uint16_t), 0, max / block2};
+    uint32_t *slots = (uint32_t *)(stage2.items + max * sizeof(uint16_t));
+    hz_ucd_intern_t *sets[3] = {&records, &stage3, &stage2};
+    for (size_t i = 0; i < 3; ++i) {
+        sets[i]->slots = slots + i * slot_count;
+        sets[i]->slot_mask = slot_count - 1;
+    }
+
+    // record zero past the end of Unicode is also the one of some unassigned codepoints, it stays first
+    hz_ucd_t *ucd = NULL;
+    uint16_t base_indices[HZ_ARRAY_SIZE(hz_ucd_records)];
+    for (size_t i = 0; i < base_count; ++i) base_indices[i] = (uint16_t)hz_ucd_intern(&records, &hz_ucd_records[i]);
+    for (hz_unicode_t c = 0; c < 0x110000; ++c)
+        indices[c] = base_indices[hz_ucd_record(NULL, c) - hz_ucd_records];
+
+    // the runs of each version hold the values of the codepoints that differ from the version after it,
+    // a codepoint whose script changes loses its script extensions
+    int32_t last_base = -1, last_value = -1, last_index = 0;
+    for (size_t v = HZ_UCD_VERSION_COUNT - 1; v-- > version_index;) {
+        const uint32_t (*runs)[2] = hz_ucd_version_deltas + hz_ucd_versions[v][1];
+        for (uint32_t i = 0; i < hz_ucd_versions[v][2]; ++i) {
+            hz_unicode_t first = runs[i][0] & 0x1fffff, last = first + (runs[i][0] >> 21);
+            const uint8_t *values = hz_ucd_version_records[runs[i][1]];
+            for (hz_unicode_t c = first; c <= last; ++c) {
+                if (indices[c] != last_base || (int32_t)runs[i][1] != last_value) {
+                    hz_ucd_record_t r = ((const hz_ucd_record_t *)records.items)[indices[c]];
+                    if (r.script != values[1]) r.script_value = values[1];
+                    r.general_category = values[0];
+                    r.script = values[1];
+                    r.bidi_class = values[2];
+                    r.line_break = values[3];
+                    r.joining_type = values[4];
+                    r.joining_group = values[5];
+
+                    last_base = indices[c];
+                    last_value = (int32_t)runs[i][1];
+                    last_index = hz_ucd_intern(&records, &r);
+                    if (last_index < 0) goto done;
+                }
+                indices[c] = (uint16_t)last_index;
+            }
+        }
+    }
+
+    uint16_t stage1[HZ_ARRAY_SIZE(hz_ucd_properties_stage1)] = {0};
+    for (size_t i = 0; i < stage1_size; ++i) {
+        uint16_t block[HZ_UCD_PROPERTIES_MASK2 + 1];
+        for (size_t j = 0; j < block2; ++j) {
+            int32_t k = hz_ucd_intern(&stage3, indices + (i * block2 + j) * block3);
+            if (k < 0) goto done;
+            block[j] = (uint16_t)(k * block3);
+        }
+
+        int32_t k = hz_ucd_intern(&stage2, block);
+        if (k < 0) goto done;
+        stage1[i] = (uint16_t)(k * block2);
+    }
+
+    // one block for the handle and the tables
+    size_t stage2_size = stage2.count * block2, stage3_size = stage3.count * block3;
+    size_t size = sizeof(hz_ucd_t) + (records.count + 1) * sizeof(hz_ucd_record_t)
+                + (stage1_size + 1 + stage2_size + 1 + stage3_size + 1) * sizeof(uint16_t);
+    ucd = hz_malloc(size);
+    if (!ucd) goto done;
+    HZ_MEMSET(ucd, 0, size);
+
+    hz_ucd_record_t *r = (hz_ucd_record_t *)(ucd + 1);
+    uint16_t *s1 = (uint16_t *)(r + records.count + 1), *s2 = s1 + stage1_size + 1, *s3 = s2 + stage2_size + 1;
+    HZ_MEMCPY(r, records.items, records.count * sizeof(hz_ucd_record_t));
+    HZ_MEMCPY(s1, stage1, stage1_size * sizeof(uint16_t));
+    HZ_MEMCPY(s2, stage2.items, stage2_size * sizeof(uint16_t));
+    HZ_MEMCPY(s3, stage3.items, stage3_size * sizeof(uint16_t));
+    *ucd = (hz_ucd_t){s1, s2, s3, r};
+
+done:
+    hz_free(scratch);
+    return ucd;
+}
+
+hz_ucd_t *hz_ucd_create(hz_version_t version)
+{
+    if (!version || version == HZ_UCD_VERSION) {
+        hz_ucd_t *ucd = hz_malloc(sizeof(hz_ucd_t));
+        if (ucd) *ucd = hz_ucd_newest;
+        return ucd;
+    }
+
+    for (size_t i = 0; i < HZ_UCD_VERSION_COUNT; ++i)
+        if (hz_ucd_versions[i][0] == version) return hz_ucd_decode_version(i);
+
+    return NULL;
+}
+
+void hz_ucd_destroy(hz_ucd_t *ucd)
+{
+    if (ucd) hz_free(ucd);
+}
+
+// Joining type flag of c or'ed with its joining group.
+HZ_STATIC HZ_ALWAYS_INLINE uint32_t hz_ucd_get_arabic_joining_data(const hz_ucd_t *ucd, hz_unicode_t k) {
+    const hz_ucd_record_t *r = hz_ucd_record(ucd, k);
+    return (1u << (16 + r->joining_type)) | r->joining_group;
+}
+
+hz_general_category_t hz_ucd_general_category(const hz_ucd_t *ucd, hz_unicode_t c)
+{
+    return (hz_general_category_t)hz_ucd_record(ucd, c)->general_category;
+}
+
+hz_unicode_t hz_ucd_mirror(hz_unicode_t c)
 {
-    uint32_t h = hz_hash2_lowbias32((uint32_t)k,0)%n;
-    int32_t g = G[h]; // sample second param
+    return c + hz_ucd_record(NULL, c)->mirror_offset;
+}
 
-    // check if g is negative, in which case we don't need to hash again to get the final slot.
-    // that's because this bucket had a single key in it.
-    return g & 0x80000000 ? (-g)-1 :
-            hz_hash2_lowbias32((uint32_t)k, (uint32_t)g)%n;
+// Byte offset of the field of property in hz_ucd_record_t.
+HZ_STATIC size_t hz_ucd_property_offset(hz_ucd_property_t property)
+{
+    const hz_ucd_record_t *r = hz_ucd_records;
+    const uint8_t *field;
+    switch (property) {
+        case HZ_UCD_PROPERTY_GENERAL_CATEGORY: field = &r->general_category; break;
+        case HZ_UCD_PROPERTY_SCRIPT: field = &r->script; break;
+        case HZ_UCD_PROPERTY_BIDI_CLASS: field = &r->bidi_class; break;
+        case HZ_UCD_PROPERTY_LINE_BREAK_CLASS: field = &r->line_break; break;
+        case HZ_UCD_PROPERTY_JOINING_TYPE: field = &r->joining_type; break;
+        case HZ_UCD_PROPERTY_JOINING_GROUP: field = &r->joining_group; break;
+        default: field = &r->combining_class; break;
+    }
+    return (size_t)(field - (const uint8_t *)r);
 }
 
-HZ_ALWAYS_INLINE uint32_t hz_ucd_get_arabic_joining_data(hz_unicode_t k) {
-    static const size_t N = HZ_ARRAY_SIZE(hz_ucd_arabic_joining_data);
-    uint32_t slot = hz_mph_table_lookup(N,hz_ucd_arabic_joining_k2, k);
+void hz_ucd_lookup_n(const hz_ucd_t *ucd, const hz_unicode_t *chars, size_t count, hz_ucd_property_t property,
+                     uint8_t *values)
+{
+    const hz_ucd_t *t = ucd ? ucd : &hz_ucd_newest;
+    const uint8_t *fields = (const uint8_t *)t->records + hz_ucd_property_offset(property);
+    size_t i = 0;
 
-    // Verify if unicode codepoints match, otherwise return default
-    if (hz_ucd_arabic_joining_ucs_codepoints[slot] != k) return HZ_JOINING_GROUP_NONE|HZ_JOINING_TYPE_T;
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+    // the trie walk with gathers of 32 bits masked down to the 16-bit stage entries and the byte of the record,
+    // the tables end with an unused entry for the bytes read past the last one
+    const __m256i last = _mm256_set1_epi32(0x10ffff), low16 = _mm256_set1_epi32(0xffff);
+    const __m256i mask2 = _mm256_set1_epi32(HZ_UCD_PROPERTIES_MASK2), mask3 = _mm256_set1_epi32(HZ_UCD_PROPERTIES_MASK3);
+    for (; i + 8 <= count; i += 8) {
+        __m256i c = _mm256_loadu_si256((const __m256i *)(chars + i));
+        __m256i clamped = _mm256_min_epu32(c, last);
+        __m256i valid = _mm256_cmpeq_epi32(clamped, c);
+
+        __m256i k = _mm256_and_si256(_mm256_i32gather_epi32((const int *)t->stage1,
+                                         _mm256_srli_epi32(clamped, HZ_UCD_PROPERTIES_SHIFT1), 2), low16);
+        k = _mm256_add_epi32(k, _mm256_and_si256(_mm256_srli_epi32(clamped, HZ_UCD_PROPERTIES_SHIFT2), mask2));
+        k = _mm256_and_si256(_mm256_i32gather_epi32((const int *)t->stage2, k, 2), low16);
+        k = _mm256_add_epi32(k, _mm256_and_si256(clamped, mask3));
+        __m256i r = _mm256_and_si256(_mm256_i32gather_epi32((const int *)t->stage3, k, 2), low16);
+        r = _mm256_and_si256(r, valid);
+
+        __m256i v = _mm256_i32gather_epi32((const int *)fields,
+                                           _mm256_mullo_epi32(r, _mm256_set1_epi32(sizeof(hz_ucd_record_t))), 1);
+        v = _mm256_and_si256(v, _mm256_set1_epi32(0xff));
+        v = _mm256_packus_epi16(_mm256_packus_epi32(v, v), v);
+        uint32_t lo = (uint32_t)_mm256_cvtsi256_si32(v), hi = (uint32_t)_mm256_extract_epi32(v, 4);
+        HZ_MEMCPY(values + i, &lo, 4);
+        HZ_MEMCPY(values + i + 4, &hi, 4);
+    }
+#endif
 
-    return hz_ucd_arabic_joining_data[slot];
+    for (; i < count; ++i)
+        values[i] = fields[(size_t)(hz_ucd_record(t, chars[i]) - t->records) * sizeof(hz_ucd_record_t)];
 }
 
 typedef struct {
@@ -1457,31 +1911,30 @@ HZ_STATIC void hz_read_coverage(hz_memory_arena_t *memory_arena, hz_parser_t *p,
         default: break;
         case 1:
         cov->count = hz_parser_read_u16(p);
-        cov->values = hz_memory_arena_alloc(memory_arena, sizeof(uint16_t)*cov->count);
-        hz_parser_read_u16_block(p, cov->values, cov->count);
+        cov->values = hz_parser_read_u16_array(p, memory_arena, cov->count);
         break;
         case 2:
         cov->count = hz_parser_read_u16(p);
-        cov->ranges = hz_memory_arena_alloc(memory_arena, sizeof(hz_coverage_range_t)*cov->count);
-        hz_parser_read_u16_block(p, (uint16_t*) cov->ranges, cov->count * 3);
+        cov->ranges = (hz_coverage_range_t *)hz_parser_read_u16_array(p, memory_arena, cov->count * 3);
         break;
     }
 }
 
-HZ_ALWAYS_INLINE int32_t hz_coverage_scalar_search(uint16_t *array, uint16_t size, uint16_t val)
+HZ_STATIC HZ_ALWAYS_INLINE int32_t hz_coverage_scalar_search(const uint16_t *array, uint16_t size, uint16_t val)
 {
     int32_t low = 0, high = size-1, mid = (low+high)/2;
 
-    if (val < array[low] || val > array[high]) {
+    if (!size || val < hz_table_u16(array, low) || val > hz_table_u16(array, high)) {
         // error, glyph not found within coverage
         return -1;
     }
 
     // binary search
     while (high >= low) {
-        if (val < array[mid]) {
+        uint16_t mid_value = hz_table_u16(array, mid);
+        if (val < mid_value) {
             high = mid-1;
-        } else if (val > array[mid]) {
+        } else if (val > mid_value) {
             low = mid+1;
         } else {
             return mid;
@@ -1493,26 +1946,24 @@ HZ_ALWAYS_INLINE int32_t hz_coverage_scalar_search(uint16_t *array, uint16_t siz
     return -1;
 }
 
-HZ_ALWAYS_INLINE int32_t hz_coverage_range_search(hz_coverage_range_t *ranges, uint16_t size, uint16_t val)
+// Fields of range i, the ranges being read as a flat array of 16-bit values in case they are a table view.
+#define hz_range_start_glyph_id(r, i) hz_table_u16((const uint16_t *)(r), 3*(i))
+#define hz_range_end_glyph_id(r, i) hz_table_u16((const uint16_t *)(r), 3*(i)+1)
+#define hz_range_value(r, i) hz_table_u16((const uint16_t *)(r), 3*(i)+2)
+
+HZ_STATIC HZ_ALWAYS_INLINE int32_t hz_coverage_range_search(const hz_coverage_range_t *ranges, uint16_t size, uint16_t val)
 {
     int32_t low = 0, high = size-1, mid = (low+high)/2;
-    hz_coverage_range_t *low_range = &ranges[low];
-    hz_coverage_range_t *high_range = &ranges[high];
-    hz_coverage_range_t *mid_range = &ranges[mid];
 
-    if (val < low_range->start_glyph_id || val > high_range->end_glyph_id) {
+    if (!size || val < hz_range_start_glyph_id(ranges, low) || val > hz_range_end_glyph_id(ranges, high)) {
         // early return as glyph cannot possibly be in this coverage.
         return -1;
     }
 
     while (high >= low) {
-        low_range = &ranges[low];
-        high_range = &ranges[high];
-        mid_range = &ranges[mid];
-
-        if (val < mid_range->start_glyph_id) {
+        if (val < hz_range_start_glyph_id(ranges, mid)) {
             high = mid-1;
-        } else if (val > mid_range->end_glyph_id) {
+        } else if (val > hz_range_end_glyph_id(ranges, mid)) {
             low = mid+1;
         } else {
             return mid;
@@ -1524,7 +1975,7 @@ HZ_ALWAYS_INLINE int32_t hz_coverage_range_search(hz_coverage_range_t *ranges, u
     return -1;
 }
 
-HZ_ALWAYS_INLINE int32_t
+HZ_STATIC HZ_ALWAYS_INLINE int32_t
 hz_coverage_search(const hz_coverage_t *coverage, uint16_t glyph_id)
 {
     switch (coverage->format) {
@@ -1534,8 +1985,7 @@ hz_coverage_search(const hz_coverage_t *coverage, uint16_t glyph_id)
         case 2: {
             int32_t index = hz_coverage_range_search(coverage->ranges, coverage->count, glyph_id);
             if (index != -1) {
-                hz_coverage_range_t const *range = &coverage->ranges[index];
-                index = range->start_coverage_index + glyph_id - range->start_glyph_id;
+                index = hz_range_value(coverage->ranges, index) + glyph_id - hz_range_start_glyph_id(coverage->ranges, index);
             }
             return index;
         }
@@ -1544,12 +1994,12 @@ hz_coverage_search(const hz_coverage_t *coverage, uint16_t glyph_id)
 
 #define hz_coverage_contains(c,g) (hz_coverage_search(c,g) != -1)
 
-HZ_ALWAYS_INLINE int32_t hz_class_def_search(hz_class_def_t *class_def, uint16_t glyph_id) {
+HZ_STATIC HZ_ALWAYS_INLINE int32_t hz_class_def_search(hz_class_def_t *class_def, uint16_t glyph_id) {
     switch (class_def->format) {
         default: break;
         case 1: {
             if (glyph_id >= class_def->start_glyph_id && glyph_id < class_def->start_glyph_id + class_def->count)
-                return class_def->values[glyph_id - class_def->start_glyph_id];
+                return hz_table_u16(class_def->values, glyph_id - class_def->start_glyph_id);
             
             break;
         }
@@ -1557,8 +2007,7 @@ HZ_ALWAYS_INLINE int32_t hz_class_def_search(hz_class_def_t *class_def, uint16_t
         case 2: {
             int32_t index = hz_coverage_range_search(class_def->ranges, class_def->count, glyph_id);
             if (index != -1) {
-                const hz_coverage_range_t *range = &class_def->ranges[index];
-                return range->glyph_class;
+                return hz_range_value(class_def->ranges, index);
             }
             
             break;
@@ -1577,15 +2026,13 @@ HZ_STATIC hz_error_t hz_read_class_def_table(hz_memory_arena_t *memory_arena, hz
         case 1: {
             class_def->start_glyph_id = hz_parser_read_u16(p);
             class_def->count = hz_parser_read_u16(p);
-            class_def->values = hz_memory_arena_alloc(memory_arena, sizeof(uint16_t)*class_def->count);
-            hz_parser_read_u16_block(p, class_def->values, class_def->count);
+            class_def->values = hz_parser_read_u16_array(p, memory_arena, class_def->count);
             break;
         }
 
         case 2: {
             class_def->count = hz_parser_read_u16(p);
-            class_def->ranges = hz_memory_arena_alloc(memory_arena, sizeof(hz_coverage_range_t)*class_def->count);
-            hz_parser_read_u16_block(p, (uint16_t*)class_def->ranges, 3*class_def->count);
+            class_def->ranges = (hz_coverage_range_t *)hz_parser_read_u16_array(p, memory_arena, 3*class_def->count);
             break;
         }
     }
@@ -1598,10 +2045,58 @@ typedef enum hz_joining_dir_t {
     JOINING_PREV
 } hz_joining_dir_t;
 
+// Unscaled outline in font units. The header is followed by the points as int16 x,y pairs
+// and the verbs packed 4 to a byte (hz_vertex_type_t - 1). Moveto and line take one point,
+// quadratic curves two and cubic curves three, the end point always comes last.
+typedef struct {
+    uint16_t verb_count, point_count;
+    uint16_t contour_count, curve_count;
+} hz_outline_t;
+
+#define hz_outline_points(_O) ((int16_t *)((_O) + 1))
+#define hz_outline_verbs(_O) ((uint8_t *)(hz_outline_points(_O) + 2*(_O)->point_count))
+#define hz_outline_verb(_O, _I) ((hz_outline_verbs(_O)[(_I) >> 2] >> (((_I) & 3) * 2)) & 3)
+
+#define HZ_OUTLINE_CACHE_DFLT_SIZE (256*1024) /*256KiB*/
+#define HZ_OUTLINE_ENTRY_NIL UINT32_MAX
+
+typedef struct {
+    hz_outline_t *outline;
+    uint32_t prev, next; // lru list, or free list through next
+    uint16_t glyph;
+} hz_outline_entry_t;
+
+// Bounded per-face cache of decoded outlines, least recently used outlines are
+// freed once the encoded size goes over max_size.
+typedef struct {
+    hz_ht_t *glyph_ht; // glyph -> entry
+    hz_vector(hz_outline_entry_t) entries;
+    uint32_t head, tail, free_entry;
+    size_t size, max_size;
+} hz_outline_cache_t;
+
+// Raw TrueType points, SoA, before on/off curve points are turned into curves. Kept in
+// the face as scratch memory so decoding doesn't allocate once it has warmed up.
+typedef struct {
+    hz_vector(int16_t) x;
+    hz_vector(int16_t) y;
+    hz_vector(uint8_t) on_curve;
+    hz_vector(uint16_t) end_points; // index of the last point of each contour
+    hz_vector(uint8_t) flags;
+    hz_vector(uint8_t) outline; // outline being built
+} hz_glyf_points_t;
+
+// Resolved data of one instance of a variable font, see <hz_font_get_instance>.
+typedef struct hz_variation_instance_t hz_variation_instance_t;
+
+#define HZ_VARIATION_CACHE_SIZE 4 // instances of a variable font kept resolved per font data
+
 struct hz_face_t {
     stbtt_fontinfo *fontinfo;
     unsigned char *data;
-    unsigned int gpos,gsub,gdef,jstf,cmap,maxp,glyf,hmtx,kern,hhea;
+    unsigned int gpos,gsub,gdef,jstf,cmap,maxp,glyf,loca,hmtx,kern,hhea,fvar,avar,hvar,colr,cpal;
+    uint32_t cmap_subtable; // best Unicode subtable, from the start of cmap, 0 when there is none
+    int16_t index_to_loc_format; // 0 for short loca offsets, 1 for long
 
     uint16_t num_glyphs;
     uint16_t num_of_h_metrics;
@@ -1614,60 +2109,211 @@ struct hz_face_t {
     int16_t fheight;
 
     uint16_t upem;
+    uint16_t max_context; // usMaxContext of OS/2, 0 when the font doesn't give it
 
     uint8_t *arenamem;
     hz_memory_arena_t memory_arena;
     hz_class_def_t class_def;
     hz_class_def_t attach_class_def;
     hz_coverage_t *mark_glyph_set;
+    hz_outline_cache_t outline_cache;
+    hz_glyf_points_t glyf_scratch;
+
+    // variations, offsets are from the start of the font and 0 when the table is missing
+    uint16_t axis_count;
+    hz_variation_axis_t *axes;
+    uint32_t gdef_var_store; // GDEF ItemVariationStore
+    uint32_t gsub_feature_variations, gpos_feature_variations;
+
+    // layers of glyph g are color_layers[color_layer_starts[g]] up to those of g + 1, NULL without COLR
+    uint32_t *color_layer_starts;
+    hz_color_layer_t *color_layers;
 };
 
-hz_face_t *
-hz_face_create()
+HZ_STATIC void hz_glyf_points_release(hz_glyf_points_t *pts)
 {
-    hz_face_t *face = hz_malloc(sizeof(hz_face_t));
-    face->num_glyphs = 0;
-    face->num_of_h_metrics = 0;
-    face->num_of_v_metrics = 0;
-    face->metrics = NULL;
-    face->ascender = 0;
-    face->descender = 0;
-    face->linegap = 0;
-    face->upem = 0;
-
-    face->arenamem = hz_malloc(500000);
-    hz_memory_arena_init(&face->memory_arena, face->arenamem, 500000);
-    face->mark_glyph_set = NULL;
-    return face;
+    hz_vector_destroy(pts->x);
+    hz_vector_destroy(pts->y);
+    hz_vector_destroy(pts->on_curve);
+    hz_vector_destroy(pts->end_points);
+    hz_vector_destroy(pts->flags);
+    hz_vector_destroy(pts->outline);
 }
 
-void
-hz_face_destroy(hz_face_t *face)
+HZ_STATIC hz_error_t hz_outline_cache_init(hz_outline_cache_t *oc, size_t max_size)
 {
-    hz_memory_arena_release(&face->memory_arena);
-    hz_free(face);
+    oc->glyph_ht = hz_ht_create(hz_get_allocator(), 64);
+    oc->entries = NULL;
+    oc->head = oc->tail = oc->free_entry = HZ_OUTLINE_ENTRY_NIL;
+    oc->size = 0;
+    oc->max_size = max_size;
+    return oc->glyph_ht != NULL ? HZ_OK : HZ_ERROR_OUT_OF_MEMORY;
 }
 
-uint16_t
-hz_face_get_upem(hz_face_t *face)
+HZ_STATIC void hz_outline_cache_unlink(hz_outline_cache_t *oc, uint32_t index)
 {
-    return face->upem;
+    hz_outline_entry_t *e = &oc->entries[index];
+    if (e->prev != HZ_OUTLINE_ENTRY_NIL) oc->entries[e->prev].next = e->next; else oc->head = e->next;
+    if (e->next != HZ_OUTLINE_ENTRY_NIL) oc->entries[e->next].prev = e->prev; else oc->tail = e->prev;
 }
 
-void
-hz_face_set_upem(hz_face_t *face, uint16_t upem)
+HZ_STATIC void hz_outline_cache_link_front(hz_outline_cache_t *oc, uint32_t index)
 {
-    face->upem = upem;
+    hz_outline_entry_t *e = &oc->entries[index];
+    e->prev = HZ_OUTLINE_ENTRY_NIL;
+    e->next = oc->head;
+    if (oc->head != HZ_OUTLINE_ENTRY_NIL) oc->entries[oc->head].prev = index; else oc->tail = index;
+    oc->head = index;
 }
 
-void
-hz_face_set_num_glyphs(hz_face_t *face, uint16_t num_glyphs)
+HZ_ALWAYS_INLINE size_t hz_outline_size(const hz_outline_t *o)
 {
-    face->num_glyphs = num_glyphs;
+    return sizeof(hz_outline_t) + sizeof(int16_t)*2*o->point_count + ((o->verb_count + 3) >> 2);
 }
 
-uint16_t
-hz_face_get_num_glyphs(hz_face_t *face)
+HZ_STATIC void hz_outline_cache_evict(hz_outline_cache_t *oc, uint32_t index)
+{
+    hz_outline_entry_t *e = &oc->entries[index];
+    hz_outline_cache_unlink(oc, index);
+    hz_ht_remove(oc->glyph_ht, e->glyph);
+    oc->size -= hz_outline_size(e->outline);
+    hz_free(e->outline);
+    e->outline = NULL;
+    e->next = oc->free_entry;
+    oc->free_entry = index;
+}
+
+HZ_STATIC void hz_outline_cache_trim(hz_outline_cache_t *oc, size_t max_size)
+{
+    while (oc->size > max_size && oc->tail != HZ_OUTLINE_ENTRY_NIL) {
+        hz_outline_cache_evict(oc, oc->tail);
+    }
+}
+
+// Takes ownership of the outline, it stays valid until the next insertion.
+HZ_STATIC void hz_outline_cache_insert(hz_outline_cache_t *oc, uint16_t glyph, hz_outline_t *outline)
+{
+    uint32_t index = oc->free_entry;
+    if (index != HZ_OUTLINE_ENTRY_NIL) {
+        oc->free_entry = oc->entries[index].next;
+    } else {
+        index = (uint32_t)hz_vector_size(oc->entries);
+        hz_outline_entry_t e = {0};
+        hz_vector_push_back(oc->entries, e);
+    }
+
+    oc->entries[index].outline = outline;
+    oc->entries[index].glyph = glyph;
+    hz_outline_cache_link_front(oc, index);
+    hz_ht_insert(oc->glyph_ht, glyph, index);
+    oc->size += hz_outline_size(outline);
+
+    // never evict what was just inserted, a single outline may be bigger than the budget
+    while (oc->size > oc->max_size && oc->tail != index) {
+        hz_outline_cache_evict(oc, oc->tail);
+    }
+}
+
+HZ_STATIC hz_outline_t *hz_outline_cache_lookup(hz_outline_cache_t *oc, uint16_t glyph)
+{
+    hz_ht_iter_t it;
+    if (!hz_ht_search(oc->glyph_ht, glyph, &it))
+        return NULL;
+
+    uint32_t index = *it.ptr_value;
+    if (oc->head != index) {
+        hz_outline_cache_unlink(oc, index);
+        hz_outline_cache_link_front(oc, index);
+    }
+
+    return oc->entries[index].outline;
+}
+
+HZ_STATIC void hz_outline_cache_release(hz_outline_cache_t *oc)
+{
+    hz_outline_cache_trim(oc, 0);
+    hz_vector_destroy(oc->entries);
+    hz_ht_destroy(oc->glyph_ht);
+}
+
+void
+hz_face_set_outline_cache_size(hz_face_t *face, size_t max_size)
+{
+    face->outline_cache.max_size = max_size;
+    hz_outline_cache_trim(&face->outline_cache, max_size);
+}
+
+hz_face_t *
+hz_face_create()
+{
+    hz_face_t *face = hz_malloc(sizeof(hz_face_t));
+    if (face == NULL) return NULL;
+
+    face->num_glyphs = 0;
+    face->num_of_h_metrics = 0;
+    face->num_of_v_metrics = 0;
+    face->metrics = NULL;
+    face->ascender = 0;
+    face->descender = 0;
+    face->linegap = 0;
+    face->upem = 0;
+    face->glyf = 0;
+    face->loca = 0;
+    face->index_to_loc_format = 0;
+    face->cmap = face->cmap_subtable = 0;
+
+    face->arenamem = hz_malloc(500000);
+    if (face->arenamem == NULL || hz_outline_cache_init(&face->outline_cache, HZ_OUTLINE_CACHE_DFLT_SIZE) != HZ_OK) {
+        hz_free(face->arenamem);
+        hz_free(face);
+        return NULL;
+    }
+
+    hz_memory_arena_init(&face->memory_arena, face->arenamem, 500000);
+    face->mark_glyph_set = NULL;
+    face->glyf_scratch = (hz_glyf_points_t){0};
+    face->fvar = face->avar = face->hvar = 0;
+    face->axis_count = 0;
+    face->axes = NULL;
+    face->gdef_var_store = 0;
+    face->gsub_feature_variations = face->gpos_feature_variations = 0;
+    face->colr = face->cpal = 0;
+    face->color_layer_starts = NULL;
+    face->color_layers = NULL;
+    return face;
+}
+
+void
+hz_face_destroy(hz_face_t *face)
+{
+    if (face->color_layer_starts) hz_free(face->color_layer_starts);
+    if (face->color_layers) hz_free(face->color_layers);
+    hz_outline_cache_release(&face->outline_cache);
+    hz_glyf_points_release(&face->glyf_scratch);
+    hz_memory_arena_release(&face->memory_arena);
+    hz_free(face);
+}
+
+uint16_t
+hz_face_get_upem(hz_face_t *face)
+{
+    return face->upem;
+}
+
+void
+hz_face_set_upem(hz_face_t *face, uint16_t upem)
+{
+    face->upem = upem;
+}
+
+void
+hz_face_set_num_glyphs(hz_face_t *face, uint16_t num_glyphs)
+{
+    face->num_glyphs = num_glyphs;
+}
+
+uint16_t
+hz_face_get_num_glyphs(hz_face_t *face)
 {
     return face->num_glyphs;
 }
@@ -1726,24 +2372,26 @@ hz_face_load_class_maps(hz_face_t *face)
         hz_parser_t p = hz_parser_create(face->data);
         hz_parser_push_state(&p, face->gdef);
 
-        struct {
-            Offset16 glyph_class_def_offset,
-                     attach_list_offset,
-                     lig_caret_list_offset,
-                     mark_attach_class_def_offset,
-                     mark_glyph_sets_def_offset; } hdr;
+        hz_gdef_header_t hdr = {0};
+        Offset16 mark_glyph_sets_def_offset = 0; // 1.0 tables have no mark glyph sets
 
         Version16Dot16 version = hz_parser_read_u32(&p);
 
         switch (version) {
             case 0x00010000: // 1.0
-                hz_cmdread(&p, 1, &hdr, "wwww");
+                hz_read_gdef_header(&p, &hdr);
                 break;
             case 0x00010002: // 1.2
-                hz_cmdread(&p, 1, &hdr, "wwwww");
+                hz_read_gdef_header(&p, &hdr);
+                mark_glyph_sets_def_offset = hz_parser_read_u16(&p);
                 break;
-            case 0x00010003: // 1.3
+            case 0x00010003: { // 1.3
+                hz_read_gdef_header(&p, &hdr);
+                mark_glyph_sets_def_offset = hz_parser_read_u16(&p);
+                Offset32 item_var_store_offset = hz_parser_read_u32(&p);
+                if (item_var_store_offset) face->gdef_var_store = face->gdef + item_var_store_offset;
                 break;
+            }
             default: // error
                 break;
         }
@@ -1761,8 +2409,8 @@ hz_face_load_class_maps(hz_face_t *face)
             hz_parser_pop_state(&p);
         }
 
-        if (hdr.mark_glyph_sets_def_offset) {
-            hz_parser_push_state(&p, hdr.mark_glyph_sets_def_offset);
+        if (mark_glyph_sets_def_offset) {
+            hz_parser_push_state(&p, mark_glyph_sets_def_offset);
             uint16_t format = hz_parser_read_u16(&p);
             if (format == 1) {
                 uint16_t mark_glyph_set_count = hz_parser_read_u16(&p);
@@ -1823,12 +2471,11 @@ hz_face_load_kerning_pairs(hz_face_t *face)
     }
 
     for (i = 0; i < n; ++i) {
-        struct {
-        uint16_t version, length;
-        hz_kern_coverage_field_t coverage; } hdr;
-        hz_cmdread(&p,1,&hdr,"www");
+        hz_kern_subtable_header_t hdr;
+        hz_read_kern_subtable_header(&p, &hdr);
+        hz_kern_coverage_t coverage = { .data = hdr.coverage };
 
-        switch (hdr.coverage.format) {
+        switch (coverage.field.format) {
             case 0:
                 break;
             case 2:
@@ -1862,6 +2509,13 @@ hz_face_get_glyph_attach_class(hz_face_t *face, hz_index_t id) {
     return 0;
 }
 
+// usMaxContext, the most glyphs a GSUB or GPOS lookup reads at once, is in OS/2 from version 2.
+HZ_STATIC void hz_face_load_max_context(hz_face_t *face)
+{
+    uint32_t os2 = stbtt__find_table(face->data, 0, "OS/2");
+    face->max_context = os2 && hz_load_u16be(face->data + os2) >= 2 ? hz_load_u16be(face->data + os2 + 94) : 0;
+}
+
 void
 hz_face_load_upem(hz_face_t *face)
 {
@@ -1893,24 +2547,33 @@ struct hz_font_t {
     uint32_t y_ppem;
 
     float ptem;
+
+    void *storage; // font data owned by the font, e.g. a decoded WOFF2
+    int16_t *coords; // normalized variation coordinates, NULL at the default instance
 };
 
 hz_font_t *
 hz_font_create(void)
 {
     hz_font_t *font = hz_malloc(sizeof(hz_font_t));
+    if (font == NULL) return NULL;
+
     font->face = NULL;
     font->x_ppem = 1000;
     font->y_ppem = 1000;
     font->ptem = 12.0f;
     font->x_scale = 0;
     font->y_scale = 0;
+    font->storage = NULL;
+    font->coords = NULL;
     return font;
 }
 
 void
 hz_font_destroy(hz_font_t *font)
 {
+    if (font->storage) hz_free(font->storage);
+    if (font->coords) hz_free(font->coords);
     hz_free(font);
 }
 
@@ -1926,6 +2589,285 @@ hz_font_get_face(hz_font_t *font)
     return font->face;
 }
 
+// Reads the axes of a variable font and where the tables its instances are resolved from start.
+HZ_STATIC void
+hz_face_load_variations(hz_face_t *face)
+{
+    if (face->fvar) {
+        const uint8_t *fvar = face->data + face->fvar;
+        const uint8_t *axis_record = fvar + hz_load_u16be(fvar + 4);
+        uint16_t axis_size = hz_load_u16be(fvar + 10);
+
+        face->axis_count = hz_load_u16be(fvar + 8);
+        face->axes = hz_memory_arena_alloc(&face->memory_arena, face->axis_count * sizeof(hz_variation_axis_t));
+
+        for (uint16_t i = 0; i < face->axis_count; ++i, axis_record += axis_size) {
+            hz_variation_axis_t *axis = &face->axes[i];
+            axis->tag = hz_load_u32be(axis_record);
+            axis->min_value = (int32_t)hz_load_u32be(axis_record + 4) / 65536.0f;
+            axis->default_value = (int32_t)hz_load_u32be(axis_record + 8) / 65536.0f;
+            axis->max_value = (int32_t)hz_load_u32be(axis_record + 12) / 65536.0f;
+        }
+    }
+
+    // 1.1 layout tables end their header with the FeatureVariations offset
+    if (face->gsub && hz_load_u32be(face->data + face->gsub) == 0x00010001) {
+        Offset32 offset = hz_load_u32be(face->data + face->gsub + 10);
+        if (offset) face->gsub_feature_variations = face->gsub + offset;
+    }
+
+    if (face->gpos && hz_load_u32be(face->data + face->gpos) == 0x00010001) {
+        Offset32 offset = hz_load_u32be(face->data + face->gpos + 10);
+        if (offset) face->gpos_feature_variations = face->gpos + offset;
+    }
+}
+
+#define HZ_COLR_MAX_PAINT_DEPTH 16
+#define HZ_COLR_MAX_GLYPH_PAINTS 4096 // paints visited to flatten one color glyph
+#define HZ_COLR_MAX_GLYPH_LAYERS 1024
+#define HZ_COLR_MAX_FACE_LAYERS (1u << 20)
+
+// State of flattening the paint graph of one color glyph. A glyph that goes over a limit or references
+// itself through PaintColrGlyph is given up on entirely.
+typedef struct hz_colr_walk_t {
+    hz_color_layer_t *out; // NULL while counting
+    uint32_t capacity, layer_count, paint_count;
+    hz_index_t glyphs[HZ_COLR_MAX_PAINT_DEPTH + 2]; // color glyphs on the path to the current paint
+    int glyph_count;
+} hz_colr_walk_t;
+
+// Packs CPAL palette entry palette_index of the first palette scaled by alpha, 0xFFFF is the text color.
+HZ_STATIC hz_bool
+hz_face_cpal_color(hz_face_t *face, uint16_t palette_index, float alpha, hz_color_layer_t *layer)
+{
+    uint8_t bgra[4] = {255, 255, 255, 255};
+    layer->flags = 0;
+
+    if (palette_index == 0xFFFF) {
+        layer->flags |= HZ_COLOR_LAYER_FOREGROUND;
+    } else {
+        if (!face->cpal) return HZ_FALSE;
+
+        const uint8_t *cpal = face->data + face->cpal;
+        uint16_t palette_size = hz_load_u16be(cpal + 2);
+        uint16_t color_record_count = hz_load_u16be(cpal + 6);
+        uint16_t first = hz_load_u16be(cpal + 12);
+        if (palette_index >= palette_size || first + palette_index >= color_record_count) return HZ_FALSE;
+
+        HZ_MEMCPY(bgra, cpal + hz_load_u32be(cpal + 8) + 4 * (first + palette_index), 4);
+    }
+
+    float a = bgra[3] * HZ_MAX(0.0f, HZ_MIN(alpha, 1.0f)) + 0.5f;
+    layer->color_rgba = (uint32_t)bgra[2] | (uint32_t)bgra[1] << 8 | (uint32_t)bgra[0] << 16 | (uint32_t)a << 24;
+    return HZ_TRUE;
+}
+
+// Paint of a glyph in the COLRv1 BaseGlyphList, NULL if the glyph has none.
+HZ_STATIC const uint8_t *hz_colr_find_base_paint(const uint8_t *base_glyph_list, hz_index_t glyph)
+{
+    uint32_t lo = 0, hi = hz_load_u32be(base_glyph_list);
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        const uint8_t *record = base_glyph_list + 4 + 6 * (size_t)mid;
+        hz_index_t g = hz_load_u16be(record);
+        if (g == glyph) return base_glyph_list + hz_load_u32be(record + 2);
+        if (g < glyph) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return NULL;
+}
+
+// Flattens a COLRv1 paint to layers appended to the walk. Only layers, glyphs, solid fills and references
+// to other color glyphs are drawn, any other paint is left out. Returns false if the glyph has to be dropped.
+HZ_STATIC hz_bool
+hz_colr_paint_layers(hz_face_t *face, const uint8_t *paint, hz_colr_walk_t *walk, int depth)
+{
+    const uint8_t *colr = face->data + face->colr;
+    if (depth > HZ_COLR_MAX_PAINT_DEPTH || ++walk->paint_count > HZ_COLR_MAX_GLYPH_PAINTS) return HZ_FALSE;
+
+    switch (paint[0]) {
+        case 1: { // PaintColrLayers
+            if (!hz_load_u32be(colr + 18)) return HZ_TRUE;
+            const uint8_t *layer_list = colr + hz_load_u32be(colr + 18);
+            uint32_t layer_count = hz_load_u32be(layer_list);
+            uint32_t first = hz_load_u32be(paint + 2);
+
+            for (uint32_t i = 0; i < paint[1] && first < layer_count && i < layer_count - first; ++i) {
+                const uint8_t *layer = layer_list + hz_load_u32be(layer_list + 4 + 4 * ((size_t)first + i));
+                if (!hz_colr_paint_layers(face, layer, walk, depth + 1)) return HZ_FALSE;
+            }
+
+            return HZ_TRUE;
+        }
+        case 10: { // PaintGlyph, its child paint fills the glyph
+            const uint8_t *fill = paint + ((uint32_t)paint[1] << 16 | hz_load_u16be(paint + 2));
+            hz_color_layer_t layer;
+            layer.glyph = hz_load_u16be(paint + 4);
+
+            // solid fills, PaintVarSolid at its default alpha
+            if ((fill[0] != 2 && fill[0] != 3)
+                || !hz_face_cpal_color(face, hz_load_u16be(fill + 1), (int16_t)hz_load_u16be(fill + 3) / 16384.0f, &layer))
+                return HZ_TRUE;
+
+            if (walk->layer_count == walk->capacity) return HZ_FALSE;
+            if (walk->out != NULL) walk->out[walk->layer_count] = layer;
+            ++walk->layer_count;
+            return HZ_TRUE;
+        }
+        case 11: { // PaintColrGlyph
+            hz_index_t glyph = hz_load_u16be(paint + 1);
+            for (int i = 0; i < walk->glyph_count; ++i)
+                if (walk->glyphs[i] == glyph) return HZ_FALSE; // cycle
+
+            const uint8_t *base_paint = hz_colr_find_base_paint(colr + hz_load_u32be(colr + 14), glyph);
+            if (base_paint == NULL) return HZ_TRUE;
+
+            walk->glyphs[walk->glyph_count++] = glyph;
+            hz_bool ok = hz_colr_paint_layers(face, base_paint, walk, depth + 1);
+            --walk->glyph_count;
+            return ok;
+        }
+        default:
+            return HZ_TRUE;
+    }
+}
+
+// Number of layers the COLRv1 paint of a base glyph flattens to, written to out unless it is NULL. Returns 0
+// for a glyph that has to be dropped, or if it flattens to more than capacity layers.
+HZ_STATIC uint32_t
+hz_colr_glyph_layers(hz_face_t *face, hz_index_t glyph, const uint8_t *paint, hz_color_layer_t *out, uint32_t capacity)
+{
+    hz_colr_walk_t walk;
+    walk.out = out;
+    walk.capacity = capacity;
+    walk.layer_count = walk.paint_count = 0;
+    walk.glyphs[0] = glyph;
+    walk.glyph_count = 1;
+    return hz_colr_paint_layers(face, paint, &walk, 0) ? walk.layer_count : 0;
+}
+
+// Flattens the COLRv0 layers of a base glyph record, at most capacity of them written to out unless it is NULL.
+HZ_STATIC uint32_t hz_colr_v0_layers(hz_face_t *face, const uint8_t *record, hz_color_layer_t *out, uint32_t capacity)
+{
+    const uint8_t *colr = face->data + face->colr;
+    const uint8_t *layer_records = colr + hz_load_u32be(colr + 8);
+    uint16_t layer_record_count = hz_load_u16be(colr + 12);
+    uint16_t first = hz_load_u16be(record + 2), layer_count = hz_load_u16be(record + 4);
+    uint32_t count = 0;
+
+    for (uint32_t i = first; i < (uint32_t)first + layer_count && i < layer_record_count && count < capacity; ++i) {
+        hz_color_layer_t layer;
+        layer.glyph = hz_load_u16be(layer_records + 4 * i);
+        if (hz_face_cpal_color(face, hz_load_u16be(layer_records + 4 * i + 2), 1.0f, &layer)) {
+            if (out != NULL) out[count] = layer;
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+// Resolves the layers of every color glyph, so drawing a glyph only looks up its range.
+// The layers of each glyph are counted first, then written once they all have a place. Glyphs past
+// HZ_COLR_MAX_FACE_LAYERS layers in all are drawn without color.
+HZ_STATIC void
+hz_face_load_color_layers(hz_face_t *face)
+{
+    if (!face->colr) return;
+
+    const uint8_t *colr = face->data + face->colr;
+    uint16_t version = hz_load_u16be(colr);
+    const uint8_t *base_records = colr + hz_load_u32be(colr + 4);
+    uint16_t base_record_count = hz_load_u16be(colr + 2);
+    const uint8_t *base_glyph_list = version >= 1 && hz_load_u32be(colr + 14) ? colr + hz_load_u32be(colr + 14) : NULL;
+    uint32_t base_paint_count = base_glyph_list != NULL ? hz_load_u32be(base_glyph_list) : 0;
+
+    uint32_t *starts = hz_malloc(sizeof(uint32_t) * (face->num_glyphs + 1));
+    uint8_t *from_v0 = hz_malloc(face->num_glyphs);
+    hz_color_layer_t *layers = NULL;
+
+    if (starts == NULL || from_v0 == NULL) {
+        hz_free(starts);
+        hz_free(from_v0);
+        return;
+    }
+
+    HZ_MEMSET(starts, 0, sizeof(uint32_t) * (face->num_glyphs + 1));
+    HZ_MEMSET(from_v0, 0, face->num_glyphs);
+
+    // COLRv1 paints take precedence, COLRv0 layers are kept for the glyphs they draw nothing for
+    for (uint32_t i = 0; i < base_paint_count; ++i) {
+        const uint8_t *record = base_glyph_list + 4 + 6 * (size_t)i;
+        hz_index_t glyph = hz_load_u16be(record);
+        if (glyph < face->num_glyphs && !starts[glyph + 1])
+            starts[glyph + 1] = hz_colr_glyph_layers(face, glyph, base_glyph_list + hz_load_u32be(record + 2),
+                                                     NULL, HZ_COLR_MAX_GLYPH_LAYERS);
+    }
+
+    for (uint16_t i = 0; i < base_record_count; ++i) {
+        const uint8_t *record = base_records + 6 * i;
+        hz_index_t glyph = hz_load_u16be(record);
+        if (glyph < face->num_glyphs && !starts[glyph + 1]) {
+            starts[glyph + 1] = hz_colr_v0_layers(face, record, NULL, HZ_COLR_MAX_GLYPH_LAYERS);
+            from_v0[glyph] = 1;
+        }
+    }
+
+    for (uint32_t g = 0; g < face->num_glyphs; ++g) {
+        if (starts[g + 1] > HZ_COLR_MAX_FACE_LAYERS - starts[g])
+            starts[g + 1] = 0;
+
+        starts[g + 1] += starts[g];
+    }
+
+    if (starts[face->num_glyphs])
+        layers = hz_malloc(sizeof(hz_color_layer_t) * starts[face->num_glyphs]);
+
+    if (layers != NULL) {
+        // a glyph is done once the record it was counted from fills its range, later duplicates are skipped
+        for (uint32_t i = 0; i < base_paint_count; ++i) {
+            const uint8_t *record = base_glyph_list + 4 + 6 * (size_t)i;
+            hz_index_t glyph = hz_load_u16be(record);
+            uint32_t count = glyph < face->num_glyphs ? starts[glyph + 1] - starts[glyph] : 0;
+            if (count && !from_v0[glyph] && hz_colr_glyph_layers(face, glyph, base_glyph_list + hz_load_u32be(record + 2),
+                                                                 layers + starts[glyph], count) == count)
+                from_v0[glyph] = 2;
+        }
+
+        for (uint16_t i = 0; i < base_record_count; ++i) {
+            const uint8_t *record = base_records + 6 * i;
+            hz_index_t glyph = hz_load_u16be(record);
+            uint32_t count = glyph < face->num_glyphs ? starts[glyph + 1] - starts[glyph] : 0;
+            if (count && from_v0[glyph] == 1 && hz_colr_v0_layers(face, record, layers + starts[glyph], count) == count)
+                from_v0[glyph] = 2;
+        }
+    }
+
+    hz_free(from_v0);
+
+    if (layers == NULL) {
+        hz_free(starts);
+        return;
+    }
+
+    face->color_layer_starts = starts;
+    face->color_layers = layers;
+}
+
+size_t hz_face_get_glyph_color_layers(hz_face_t *face, hz_index_t glyph, const hz_color_layer_t **layers)
+{
+    if (face->color_layer_starts == NULL || glyph >= face->num_glyphs) {
+        *layers = NULL;
+        return 0;
+    }
+
+    *layers = face->color_layers + face->color_layer_starts[glyph];
+    return face->color_layer_starts[glyph + 1] - face->color_layer_starts[glyph];
+}
+
+HZ_STATIC void hz_face_select_cmap_subtable(hz_face_t *face);
+
 hz_font_t *
 hz_stbtt_font_create(stbtt_fontinfo *info)
 {
@@ -1935,6 +2877,12 @@ hz_stbtt_font_create(stbtt_fontinfo *info)
 
     font = hz_font_create();
     face = hz_face_create();
+    if (font == NULL || face == NULL) {
+        if (font != NULL) hz_font_destroy(font);
+        if (face != NULL) hz_face_destroy(face);
+        return NULL;
+    }
+
     face->fontinfo = info;
     face->data = info->data;
     face->gsub = stbtt__find_table(info->data,0,"GSUB");
@@ -1942,9 +2890,17 @@ hz_stbtt_font_create(stbtt_fontinfo *info)
     face->gdef = stbtt__find_table(info->data,0,"GDEF");
     face->maxp = stbtt__find_table(info->data,0,"maxp");
     face->glyf = info->glyf;
+    face->loca = info->loca;
+    face->index_to_loc_format = (int16_t)info->indexToLocFormat;
     face->cmap = stbtt__find_table(info->data,0,"cmap");
+    hz_face_select_cmap_subtable(face);
     face->hhea = info->hhea;
     face->kern = info->kern;
+    face->fvar = stbtt__find_table(info->data,0,"fvar");
+    face->avar = stbtt__find_table(info->data,0,"avar");
+    face->hvar = stbtt__find_table(info->data,0,"HVAR");
+    face->colr = stbtt__find_table(info->data,0,"COLR");
+    face->cpal = stbtt__find_table(info->data,0,"CPAL");
 
     face->num_glyphs = info->numGlyphs;
 
@@ -1959,18 +2915,23 @@ hz_stbtt_font_create(stbtt_fontinfo *info)
         int lsb;
         stbtt_GetGlyphHMetrics(info, g, &ax, &lsb);
 
-        int cx1, cy1, cx2, cy2;
-        stbtt_GetGlyphBox(info, g, &cx1, &cy1, &cx2, &cy2);
+        hz_bbox_t box;
+        hz_face_get_glyph_box(face, g, &box);
 
-        face->metrics[g].w = cx2 - cx1;
-        face->metrics[g].h = cy2 - cy1;
+        face->metrics[g].bounds = (hz_bounds2i_t){box.x0, box.y0, box.x1, box.y1};
+        face->metrics[g].w = box.x1 - box.x0;
+        face->metrics[g].h = box.y1 - box.y0;
         face->metrics[g].xAdvance = ax;
         face->metrics[g].yAdvance  = 0;
         face->metrics[g].xBearing = lsb;
+        face->metrics[g].yBearing = box.y1;
     }
 
     hz_face_load_class_maps(face);
+    hz_face_load_max_context(face);
     hz_face_load_kerning_pairs(face);
+    hz_face_load_variations(face);
+    hz_face_load_color_layers(face);
 
     {
         hz_parser_t p = hz_parser_create(face->data + face->hhea + 4);
@@ -1983,736 +2944,1604 @@ hz_stbtt_font_create(stbtt_fontinfo *info)
     return font;
 }
 
-typedef struct {
-    u32 data[4];
-    u8 length;
-} uint_base128;
-
-struct hz_woff2_header{
-    u32 signature, flavor, length;
-    u16 num_tables, reserved; // reserved
-    u32 total_sfnt_size, total_compressed_size;
-    u16 major_version, minor_version;
-    u32 meta_offset, meta_length, meta_orig_length;
-    u32 priv_offset, priv_length;
-};
-
-struct hz_woff2_table_dir_entry{
-    union {
-        unsigned int c;
-        struct {
-            unsigned known_tag:6, preprocessing_transformation_version_number:2;
-        } s;
-    } flags; 
-    u32 tag;
-    u32 orig_length;
-    u32 transform_length;
-};
-
-HZ_ALWAYS_INLINE s32 hz_read_base_uint128(u32 *w, u8 *restrict mem)
-{
-    u32 accum=0;
-    for (u32 i = 0; i < 5; ++i) {
-        u8 byte = *mem++;
-        // No leading 0's
-        // If any of top 7 bits are set then << 7 would overflow
-        if ((!i && byte == 0x80) || (accum & 0xfe000000)) return HZ_FALSE;
-        accum = (accum << 7) | (byte & 0x7f);
+#include "hz_brotli_dictionary.h"
 
-        if (!(byte & 0x80)) { // most significand bit is 0, end of sequence
-            *w = accum;
-            return i;
-        }
-    }
+/*  Brotli (RFC 7932) decoder for the WOFF2 table data. The stream is decoded into one flat buffer which is also the
+ *  sliding window, so besides the caller's output the only allocation is the prefix code lookup tables, which are
+ *  sized from the code lengths of each meta-block. Codes are decoded through an 8-bit root table with second-level
+ *  tables for longer codes, which costs one or two table loads per symbol.
+ */
 
-    return -1;
-}
+#define HZ_BROTLI_HUFFMAN_ROOT_BITS 8
+#define HZ_BROTLI_MAX_CODE_LENGTH 15
+// Zero bytes the bit buffer can hold past the end of the input without any of them having been read. Once more were
+// shifted in, the stream was truncated.
+#define HZ_BROTLI_READER_LOOKAHEAD 7
+#define HZ_BROTLI_LITERAL_ALPHABET_SIZE 256
+#define HZ_BROTLI_COMMAND_ALPHABET_SIZE 704
+#define HZ_BROTLI_BLOCK_LENGTH_ALPHABET_SIZE 26
+#define HZ_BROTLI_CODE_LENGTH_ALPHABET_SIZE 18
+#define HZ_BROTLI_MAX_BLOCK_TYPES 256
+#define HZ_BROTLI_NUM_TRANSFORMS 121
 
-static const hz_tag_t woff2_known_table_tags[63] = {
-    'cmap', 'head', 'hhea', 'hmtx',
-    'maxp', 'name', 'OS/2', 'post',
-    'cvt ', 'fpgm', 'glyf', 'loca',
-    'prep', 'CFF ', 'VORG', 'EBDT',
-    'EBLC', 'gasp', 'hdmx', 'kern',
-    'LTSH', 'PCLT', 'VDMX', 'vhea',
-    'vmtx', 'BASE', 'GDEF', 'GPOS',
-    'GSUB', 'EBSC', 'JSTF', 'MATH',
-    'CBDT', 'CBLC', 'COLR', 'CPAL',
-    'SVG ', 'sbix', 'acnt', 'avar',
-    'bdat', 'bloc', 'bsln', 'cvar',
-    'fdsc', 'feat', 'fmtx', 'fvar',
-    'gvar', 'hsty', 'just', 'lcar',
-    'mort', 'morx', 'opbd', 'prop',
-    'trak', 'Zapf', 'Silf', 'Glat',
-    'Gloc', 'Feat', 'Sill'
-};
+typedef struct {
+    uint8_t bits;
+    uint16_t value;
+} hz_brotli_huffman_code_t;
 
-#define WOFF2_SIGNATURE 0x774F4632 /* wOF2 */
+typedef struct {
+    hz_brotli_huffman_code_t *codes;
+    uint32_t size, capacity;
+} hz_brotli_tables_t;
 
-struct woff2_collection_header{u32 version;u16 num_fonts;};
+typedef struct {
+    const uint8_t *begin, *next, *end;
+    uint64_t val;
+    uint32_t bits;
+    uint32_t overrun; // zero bytes shifted in past the end of the input
+} hz_brotli_reader_t;
 
-u32 read_255_uint16(u8* ptr, u16 *outval)
-{
-    *outval = ptr[0];
-    if (*outval == 253) {
-        *outval = ((u16)ptr[1]) << 8 | ((u16)ptr[2]);
-        return 3;
-    }
-    else if (*outval == 254) {
-        *outval = (u16)ptr[1] + 253;
-        return 2;
-    }else if (*outval == 255) {
-        *outval = (u16)ptr[1] + 253*2;
-        return 2;
-    }
-    return 1;
-}
+typedef struct {
+    uint32_t count; // number of block types
+    uint32_t type, previous_type;
+    uint32_t length; // symbols left in the current block
+    const hz_brotli_huffman_code_t *type_table, *length_table;
+} hz_brotli_block_state_t;
 
 typedef struct {
-    u16 code;
-    u16 symbol;
-    u8 code_length_in_bits;
-    u8 extension_bits;
-} huffman_symbol;
-
-struct huffman_tree {
-    u16 num_entries;
-    u8 max_code_length_in_bits;
-    huffman_symbol* entries; 
-    // huffman_entry* entries;
-    // u8 *code_lengths_in_bits;
-    // u8 num_code_lengths;
+    const char *prefix;
+    uint8_t type; // 0 identity, 1-9 omit last n, 10 uppercase first, 11 uppercase all, 12-20 omit first n-11
+    const char *suffix;
+} hz_brotli_transform_t;
+
+// RFC 7932 appendix B
+static const hz_brotli_transform_t hz_brotli_transforms[HZ_BROTLI_NUM_TRANSFORMS] = {
+    {"",0,""}, {"",0," "}, {" ",0," "}, {"",12,""},
+    {"",10," "}, {"",0," the "}, {" ",0,""}, {"s ",0," "},
+    {"",0," of "}, {"",10,""}, {"",0," and "}, {"",13,""},
+    {"",1,""}, {", ",0," "}, {"",0,", "}, {" ",10," "},
+    {"",0," in "}, {"",0," to "}, {"e ",0," "}, {"",0,"\""},
+    {"",0,"."}, {"",0,"\">"}, {"",0,"\n"}, {"",3,""},
+    {"",0,"]"}, {"",0," for "}, {"",14,""}, {"",2,""},
+    {"",0," a "}, {"",0," that "}, {" ",10,""}, {"",0,". "},
+    {".",0,""}, {" ",0,", "}, {"",15,""}, {"",0," with "},
+    {"",0,"'"}, {"",0," from "}, {"",0," by "}, {"",16,""},
+    {"",17,""}, {" the ",0,""}, {"",4,""}, {"",0,". The "},
+    {"",11,""}, {"",0," on "}, {"",0," as "}, {"",0," is "},
+    {"",7,""}, {"",1,"ing "}, {"",0,"\n\x09"}, {"",0,":"},
+    {" ",0,". "}, {"",0,"ed "}, {"",20,""}, {"",18,""},
+    {"",6,""}, {"",0,"("}, {"",10,", "}, {"",8,""},
+    {"",0," at "}, {"",0,"ly "}, {" the ",0," of "}, {"",5,""},
+    {"",9,""}, {" ",10,", "}, {"",10,"\""}, {".",0,"("},
+    {"",11," "}, {"",10,"\">"}, {"",0,"=\""}, {" ",0,"."},
+    {".com/",0,""}, {" the ",0," of the "}, {"",10,"'"}, {"",0,". This "},
+    {"",0,","}, {".",0," "}, {"",10,"("}, {"",10,"."},
+    {"",0," not "}, {" ",0,"=\""}, {"",0,"er "}, {" ",11," "},
+    {"",0,"al "}, {" ",11,""}, {"",0,"='"}, {"",11,"\""},
+    {"",10,". "}, {" ",0,"("}, {"",0,"ful "}, {" ",10,". "},
+    {"",0,"ive "}, {"",0,"less "}, {"",11,"'"}, {"",0,"est "},
+    {" ",10,"."}, {"",11,"\">"}, {" ",0,"='"}, {"",10,","},
+    {"",0,"ize "}, {"",11,"."}, {"\xc2\xa0",0,""}, {" ",0,","},
+    {"",10,"=\""}, {"",11,"=\""}, {"",0,"ous "}, {"",11,", "},
+    {"",10,"='"}, {" ",10,","}, {" ",11,"=\""}, {" ",11,", "},
+    {"",11,","}, {"",11,"("}, {"",11,". "}, {" ",11,"."},
+    {"",11,"='"}, {" ",11,". "}, {" ",10,"=\""}, {" ",11,"='"},
+    {" ",10,"='"},};
+
+// Literal context lookup for each context mode (LSB6, MSB6, UTF8, signed), indexed by p1 in the first half and p2 in
+// the second, the context id is the bitwise or of both (RFC 7932 section 7.1).
+static const uint8_t hz_brotli_context_lut[4][512] = {
+    {
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+        32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+        32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+        32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+        32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    },
+    {
+        0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,6,6,6,6,7,7,7,7,
+        8,8,8,8,9,9,9,9,10,10,10,10,11,11,11,11,12,12,12,12,13,13,13,13,14,14,14,14,15,15,15,15,
+        16,16,16,16,17,17,17,17,18,18,18,18,19,19,19,19,20,20,20,20,21,21,21,21,22,22,22,22,23,23,23,23,
+        24,24,24,24,25,25,25,25,26,26,26,26,27,27,27,27,28,28,28,28,29,29,29,29,30,30,30,30,31,31,31,31,
+        32,32,32,32,33,33,33,33,34,34,34,34,35,35,35,35,36,36,36,36,37,37,37,37,38,38,38,38,39,39,39,39,
+        40,40,40,40,41,41,41,41,42,42,42,42,43,43,43,43,44,44,44,44,45,45,45,45,46,46,46,46,47,47,47,47,
+        48,48,48,48,49,49,49,49,50,50,50,50,51,51,51,51,52,52,52,52,53,53,53,53,54,54,54,54,55,55,55,55,
+        56,56,56,56,57,57,57,57,58,58,58,58,59,59,59,59,60,60,60,60,61,61,61,61,62,62,62,62,63,63,63,63,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    },
+    {
+        0,0,0,0,0,0,0,0,0,4,4,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        8,12,16,12,12,20,12,16,24,28,12,12,32,12,36,12,44,44,44,44,44,44,44,44,44,44,32,32,24,40,28,12,
+        12,48,52,52,52,48,52,52,52,48,52,52,52,52,52,48,52,52,52,52,52,48,52,52,52,52,52,24,12,28,12,12,
+        12,56,60,60,60,56,60,60,60,56,60,60,60,60,60,56,60,60,60,60,60,56,60,60,60,60,60,24,12,28,12,0,
+        0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+        0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+        2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,
+        2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,2,3,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,
+        1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,
+        1,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,1,1,1,1,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    },
+    {
+        0,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+        16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+        40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,56,
+        0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,
+    },};
+
+// Base value and number of extra bits of the insert length, copy length and block length codes.
+static const uint32_t hz_brotli_insert_length_codes[24][2] = {
+    {0,0},{1,0},{2,0},{3,0},{4,0},{5,0},{6,1},{8,1},{10,2},{14,2},{18,3},{26,3},
+    {34,4},{50,4},{66,5},{98,5},{130,6},{194,7},{322,8},{578,9},{1090,10},{2114,12},{6210,14},{22594,24}
 };
 
-
-// rfc7932 9.1
-// lookup table to decode WBITS field in the Brotli stream's header, this is used to determine the length of he sliding
-// window
-static const huffman_symbol wbits_huffman_symbols[] = {
-    {0b1000010, 10, 7},
-    {0b1000110, 11, 7},
-    {0b1000001, 12, 7},
-    {0b1000101, 13, 7},
-    {0b1000011, 14, 7},
-    {0b1000111, 15, 7},
-    {0b0, 16, 1},
-    {0b1000000, 17, 7},
-    {0b1100, 18, 4},
-    {0b1010, 19, 4},
-    {0b1110, 20, 4},
-    {0b1001, 21, 4},
-    {0b1101, 22, 4},
-    {0b1011, 23, 4},
-    {0b1111, 24, 4}
+static const uint32_t hz_brotli_copy_length_codes[24][2] = {
+    {2,0},{3,0},{4,0},{5,0},{6,0},{7,0},{8,0},{9,0},{10,1},{12,1},{14,2},{18,2},
+    {22,3},{30,3},{38,4},{54,4},{70,5},{102,5},{134,6},{198,7},{326,8},{582,9},{1094,10},{2118,24}
 };
 
-static const huffman_symbol nbltypes_huffman_symbols[] = {
-    {0x0 /* 0 */,    1,   1, 0},//1
-    {0x8 /* 1000 */, 2,   4, 0},//2
-    {0xC /*1100*/, 3,   4, 1},// 3..4
-    {0xA /*1010*/, 5,   4, 2},// 5..8
-    {0xE /*1110*/, 9,   4, 3},// 9..16
-    {0x9 /*1001*/, 17,  4, 4},// 17..32
-    {0xD /*1101*/, 33,  4, 5},//33..64
-    {0xB /*1011*/, 65,  4, 6},//65..128
-    {0xF /*1111*/, 129, 4, 7},//129..256
+static const uint32_t hz_brotli_block_length_codes[HZ_BROTLI_BLOCK_LENGTH_ALPHABET_SIZE][2] = {
+    {1,2},{5,2},{9,2},{13,2},{17,3},{25,3},{33,3},{41,3},{49,4},{65,4},{81,4},{97,4},{113,5},
+    {145,5},{177,5},{209,5},{241,6},{305,6},{369,7},{497,8},{753,9},{1265,10},{2289,11},{4337,12},{8433,13},{16625,24}
 };
 
-struct streaming_buffer {
-    uint_least8_t *data;
-    uint64_t bit_offset;
+// First insert and copy length code of each 64 symbol cell of the insert-and-copy alphabet, the first two cells
+// reuse the last distance.
+static const uint8_t hz_brotli_command_cells[11][2] = {
+    {0,0},{0,8},{0,0},{0,8},{8,0},{8,8},{0,16},{16,0},{8,16},{16,8},{16,16}
 };
 
-u32 streaming_buffer_read(struct streaming_buffer *input)
-{
-    // reads single bit from the stream
-    u8 shift = input->bit_offset & 0x7u;
-    u32 byte_index = input->bit_offset >> 3u;
-    u8 byte = input->data[byte_index];
-    u8 result = (byte >> shift) & 0x1u;
-    ++input->bit_offset;
-    return (u32)result;
-}
+// Ring buffer slot (0 being the last distance) and offset of the 16 short distance codes.
+static const uint8_t hz_brotli_short_distance_index[16] = {0,1,2,3,0,0,0,0,0,0,1,1,1,1,1,1};
+static const int8_t hz_brotli_short_distance_offset[16] = {0,0,0,0,-1,1,-2,2,-3,3,-1,1,-2,2,-3,3};
 
-uint64_t streaming_buffer_read_integer(struct streaming_buffer *input, int num_bits)
+HZ_STATIC void hz_brotli_reader_init(hz_brotli_reader_t *br, const uint8_t *data, size_t size)
 {
-    assert(num_bits <= 64);
-    uint64_t value = 0;
-
-    if (!num_bits) return 0; // don't read anything
-
-    int x0 = input->bit_offset;
-    int x1 = x0 + num_bits - 1;
-
-    int start_byte = x0 >> 3, end_byte = x1 >> 3;
-    int num_bytes = (end_byte - start_byte) + 1;
-
-    // We shift down the bytes as we read them, this will
-    // make sure the first byte we read is the lsb, and the last would be msb.
-    // We then correct the
-    while (start_byte <= end_byte) {
-        value >>= 8;
-        value |= (uint64_t)input->data[start_byte++] << 56;
-    }
-
-    // Shift down by inner-byte offset
-    value >>= (x0 & 0x7) + (64 - 8*num_bytes);
-    // Mask off unused bits
-    value &= (1 << num_bits) - 1;
-
-    // Update buffer
-    input->bit_offset += num_bits;
-
-    return value;
+    br->begin = br->next = data;
+    br->end = data + size;
+    br->val = 0;
+    br->bits = 0;
+    br->overrun = 0;
 }
 
-
-
-uint64_t sb_read_msb_to_lsb(struct streaming_buffer* sb, int nbits)
+// Tops the bit buffer up to at least 56 bits. The fast path loads 8 bytes at once and only advances by the whole
+// bytes that fit, the bytes left over in the upper bits are loaded to the same place again on the next refill.
+HZ_STATIC HZ_ALWAYS_INLINE void hz_brotli_refill(hz_brotli_reader_t *br)
 {
-    HZ_ASSERT(nbits <= 64);
-    uint64_t value = 0;
-    if (!nbits) return value;
-
-    int x0 = sb->bit_offset;
-    int x1 = x0 + nbits - 1;
-
-    int start_byte = x0 >> 3, end_byte = x1 >> 3;
-    int nbytes = (end_byte - start_byte) + 1;
-    
-    // reverse byte bits (method by Rich Schroeppel)
-    while (start_byte <= end_byte) {
-        value <<= 8;
-        uint8_t b = sb->data[ start_byte ++ ];
-        b = (b * 0x0202020202ull & 0x010884422010ull) % 1023;
-        value |= b;
-    }
-
-    // Shift down by inner-byte offset
-    value >>= (x0 & 0x7);
-    // Mask off unused bits
-    value &= (1 << nbits) - 1;
-    // Update buffer
-    sb->bit_offset += nbits;
-
-    return value;
-}
-
-static u8 streaming_buffer_read_byte(struct streaming_buffer *input)
-{
-    u8 val;
-    u32 bit_offset = input->bit_offset;
-    u32 byte_index = bit_offset >> 3u;
-    u32 shift = input->bit_offset & 0x7u;
-    // if the shift is on a byte boundary, all we have to do is return the current byte
-    if (shift) {
-        // combine parts of current byte, and next byte
-        u32 next_byte_index = byte_index + 1;
-        u8 byte1 = input->data[byte_index];
-        u8 byte2 = input->data[next_byte_index];
-        val = (byte1 >> shift) | (byte2 << (8u - shift));
+    if (hz_likely(br->end - br->next >= 8)) {
+        const uint8_t *p = br->next;
+        uint64_t w = (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24
+                   | (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+        br->val |= w << br->bits;
+        br->next += (63 - br->bits) >> 3;
+        br->bits |= 56;
     } else {
-        val = input->data[byte_index];
+        while (br->bits < 56) {
+            if (br->next < br->end) br->val |= (uint64_t)*br->next++ << br->bits;
+            else ++br->overrun;
+            br->bits += 8;
+        }
     }
-
-    input->bit_offset += 8;
-    return val;
 }
 
-static void streaming_buffer_align_to_next_byte(struct streaming_buffer *input)
+HZ_STATIC HZ_ALWAYS_INLINE uint32_t hz_brotli_read_bits(hz_brotli_reader_t *br, uint32_t n)
 {
-    u32 offset = input->bit_offset;
-    input->bit_offset += ~offset & 0x7u;
+    uint32_t v;
+    if (br->bits < n) hz_brotli_refill(br);
+    v = (uint32_t)(br->val & ((1ull << n) - 1));
+    br->val >>= n;
+    br->bits -= n;
+    return v;
 }
 
-static void streaming_buffer_skip(struct streaming_buffer *input, int number)
+HZ_STATIC HZ_ALWAYS_INLINE uint32_t hz_brotli_read_symbol(hz_brotli_reader_t *br, const hz_brotli_huffman_code_t *table)
 {
-    input->bit_offset += number;
+    if (br->bits < HZ_BROTLI_MAX_CODE_LENGTH) hz_brotli_refill(br);
+    table += br->val & ((1u << HZ_BROTLI_HUFFMAN_ROOT_BITS) - 1);
+    if (table->bits > HZ_BROTLI_HUFFMAN_ROOT_BITS) {
+        uint32_t n = table->bits - HZ_BROTLI_HUFFMAN_ROOT_BITS;
+        br->val >>= HZ_BROTLI_HUFFMAN_ROOT_BITS;
+        br->bits -= HZ_BROTLI_HUFFMAN_ROOT_BITS;
+        table += table->value + (br->val & ((1u << n) - 1));
+    }
+    br->val >>= table->bits;
+    br->bits -= table->bits;
+    return table->value;
 }
 
-#define HUFFMAN_ALLOCATE(A) huffman_allocate(ArraySize(A), A)
+// Byte aligns the reader and returns its buffered bytes to the input so whole bytes can be copied or skipped. Fails if
+// the padding bits aren't zero or if the stream ran past the end of the input.
+HZ_STATIC hz_bool hz_brotli_sync(hz_brotli_reader_t *br)
+{
+    size_t position;
+    if (hz_brotli_read_bits(br, br->bits & 7)) return HZ_FALSE;
+    position = (size_t)(br->next - br->begin) + br->overrun - (br->bits >> 3);
+    if (position > (size_t)(br->end - br->begin)) return HZ_FALSE;
+    br->next = br->begin + position;
+    br->val = 0;
+    br->bits = 0;
+    br->overrun = 0;
+    return HZ_TRUE;
+}
+
+HZ_STATIC hz_bool hz_brotli_read_bytes(hz_brotli_reader_t *br, uint8_t *out, size_t n)
+{
+    if (!hz_brotli_sync(br) || (size_t)(br->end - br->next) < n) return HZ_FALSE;
+    if (out) HZ_MEMCPY(out, br->next, n);
+    br->next += n;
+    return HZ_TRUE;
+}
 
-static struct huffman_tree* huffman_allocate(u16 num_symbols, const huffman_symbol* symbols)
+HZ_STATIC HZ_ALWAYS_INLINE uint32_t hz_brotli_reverse_bits(uint32_t code, uint32_t length)
 {
-    struct huffman_tree *huffman = hz_malloc(sizeof(*huffman));
-    u32 max_code_length_in_bits = 0;
-    for (u16 i = 0; i < num_symbols; ++i) {
-        max_code_length_in_bits = MAX(max_code_length_in_bits, symbols[i].code_length_in_bits);
+    uint32_t r = 0;
+    while (length--) {
+        r = (r << 1) | (code & 1);
+        code >>= 1;
     }
+    return r;
+}
 
-    u16 num_entries = 1u << max_code_length_in_bits;
-    // printf("%d\n", num_entries);
+// Fills the lookup table of the canonical prefix code given by lengths and returns its size, codes longer than the
+// root bits are resolved by a second-level table per root slot, sized by the longest code under that slot. With a
+// null table only the size is computed. Returns 0 if the lengths don't form a complete prefix code.
+HZ_STATIC uint32_t hz_brotli_build_huffman_table(hz_brotli_huffman_code_t *table, const uint8_t *lengths, uint32_t alphabet_size)
+{
+    uint32_t count[HZ_BROTLI_MAX_CODE_LENGTH + 1] = {0}, next_code[HZ_BROTLI_MAX_CODE_LENGTH + 1];
+    uint32_t slot_offset[1 << HZ_BROTLI_HUFFMAN_ROOT_BITS];
+    uint8_t slot_bits[1 << HZ_BROTLI_HUFFMAN_ROOT_BITS] = {0};
+    uint32_t symbol, length, code, size, space = 0, used = 0, last = 0, i;
+    const uint32_t root_size = 1u << HZ_BROTLI_HUFFMAN_ROOT_BITS;
 
-    huffman->entries = hz_malloc(num_entries * sizeof(huffman_symbol));//FIXME:use own allocator
-    huffman->num_entries = num_entries;
-    huffman->max_code_length_in_bits = max_code_length_in_bits;
-    
-    hz_memset(huffman->entries, 0, num_entries * sizeof(huffman_symbol));
-    
-    for (u16 symbol_index = 0; symbol_index < num_symbols; ++symbol_index) {
-        huffman_symbol sym = symbols[symbol_index];
-        u16 code = sym.code;
-        // printf("CODE: %u\n", code);
+    for (symbol = 0; symbol < alphabet_size; ++symbol) {
+        if (lengths[symbol]) {
+            ++count[lengths[symbol]];
+            space += 32768u >> lengths[symbol];
+            last = symbol;
+            ++used;
+        }
+    }
 
-        huffman->entries[code] = sym;
+    if (used == 1) { // a lone symbol takes no bits
+        if (table) {
+            for (i = 0; i < root_size; ++i) {
+                table[i].bits = 0;
+                table[i].value = (uint16_t)last;
+            }
+        }
+        return root_size;
     }
 
-    return huffman;
-}
+    if (space != 32768u) return 0;
 
-static int huffman_decode(struct streaming_buffer *input, struct huffman_tree *huffman, u32 *output)
-{
-    u32 bits = 0;
-    huffman_symbol *sym;
+    code = 0;
+    for (length = 1; length <= HZ_BROTLI_MAX_CODE_LENGTH; ++length) {
+        code = (code + count[length - 1]) << 1;
+        next_code[length] = code;
+    }
 
-    for (u32 code_length = 1; code_length <= huffman->max_code_length_in_bits; code_length++) {
-        // read single bit into code
-        u32 bit = streaming_buffer_read(input);
-        bits = (bits << 1) | bit;
-        u32 code = bits;
-        sym = &huffman->entries[code];
-        // printf("Reversed: 0x%02x\n", code);
-        if (sym->code_length_in_bits == code_length) { // match length
-            // if extra bits to read, read them then combine with the code
-            // printf("Sym: %u, Code length: %u, Code: %u Ext: %u\n", sym->symbol, sym->code_length_in_bits, sym->code, sym->extension_bits);
-            u32 ext = sb_read_msb_to_lsb(input, sym->extension_bits);//streaming_buffer_read_integer(input, sym->extension_bits);
-            *output = (u32)sym->symbol + ext;
-            return 1;
+    // depth of the second-level table under each root slot
+    uint32_t codes[HZ_BROTLI_MAX_CODE_LENGTH + 1];
+    HZ_MEMCPY(codes, next_code, sizeof(codes));
+    for (symbol = 0; symbol < alphabet_size; ++symbol) {
+        length = lengths[symbol];
+        if (length > HZ_BROTLI_HUFFMAN_ROOT_BITS) {
+            uint32_t slot = hz_brotli_reverse_bits(codes[length]++, length) & (root_size - 1);
+            slot_bits[slot] = MAX(slot_bits[slot], length - HZ_BROTLI_HUFFMAN_ROOT_BITS);
         }
     }
 
-    // could not match any huffman code
-    return 0;
-}
+    size = root_size;
+    for (i = 0; i < root_size; ++i) {
+        if (slot_bits[i]) {
+            slot_offset[i] = size;
+            size += 1u << slot_bits[i];
+        }
+    }
 
-#define ALPHABET_SIZE_LITERAL 256
-#define ALPHABET_SIZE_INSERT_AND_COPY_LENGTH 704
-#define ALPHABET_SIZE_BLOCK_COUNT 26
+    if (!table) return size;
 
-HZ_ALWAYS_INLINE u32 fit_bits_for_max_value(u32 value)
-{
-    u32 clz = HZ_CLZ(value);
-    return 0x80000000u >> clz;
+    for (symbol = 0; symbol < alphabet_size; ++symbol) {
+        uint32_t key, step, end;
+        hz_brotli_huffman_code_t *t = table;
+        length = lengths[symbol];
+        if (!length) continue;
+
+        key = hz_brotli_reverse_bits(next_code[length]++, length);
+        if (length <= HZ_BROTLI_HUFFMAN_ROOT_BITS) {
+            step = 1u << length;
+            end = root_size;
+        } else {
+            uint32_t slot = key & (root_size - 1);
+            table[slot].bits = (uint8_t)(HZ_BROTLI_HUFFMAN_ROOT_BITS + slot_bits[slot]);
+            table[slot].value = (uint16_t)(slot_offset[slot] - slot);
+            t = table + slot_offset[slot];
+            key >>= HZ_BROTLI_HUFFMAN_ROOT_BITS;
+            length -= HZ_BROTLI_HUFFMAN_ROOT_BITS;
+            step = 1u << length;
+            end = 1u << slot_bits[slot];
+        }
+
+        for (; key < end; key += step) {
+            t[key].bits = (uint8_t)length;
+            t[key].value = (uint16_t)symbol;
+        }
+    }
+
+    return size;
 }
 
-HZ_ALWAYS_INLINE u32 symbol_exists_in_buffer(u32 *buffer, u32 n, u32 sym)
+// Appends the lookup table of a prefix code to tables and returns its offset, or -1 for an invalid code. Tables are
+// referred to by offset until a meta-block's codes are all read, as the storage may move while it grows.
+HZ_STATIC int32_t hz_brotli_add_table(hz_brotli_tables_t *tables, const uint8_t *lengths, uint32_t alphabet_size)
 {
-    for (u32 i = 0; i < n; ++i) {
-        if ( buffer[i] == sym) {
-            return HZ_TRUE;
-        }
+    uint32_t size = hz_brotli_build_huffman_table(NULL, lengths, alphabet_size), offset;
+    if (!size) return -1;
+
+    if (tables->size + size > tables->capacity) {
+        uint32_t capacity = MAX(tables->capacity * 2, tables->size + size);
+        hz_brotli_huffman_code_t *codes = tables->codes
+            ? hz_realloc(tables->codes, capacity * sizeof(*codes))
+            : hz_malloc(capacity * sizeof(*codes));
+        if (!codes) return -1;
+        tables->codes = codes;
+        tables->capacity = capacity;
     }
-    return HZ_FALSE;
+
+    offset = tables->size;
+    hz_brotli_build_huffman_table(tables->codes + offset, lengths, alphabet_size);
+    tables->size += size;
+    return (int32_t)offset;
 }
 
-typedef struct {
-    
-} brotli_prefix_code;
-
-
-static hz_error_t brotli_decode_prefix_code(struct streaming_buffer *input,
-                                            u32 alphabet_size,
-                                            u32 alphabet_size_bits,
-                                            brotli_prefix_code *output
-                                            )
-{
-    u32 hskip = streaming_buffer_read_integer(input,2);
-    printf("hskip (simple code if 1): %d\n", hskip);
-    if (hskip == 1) {//simple code
-        printf("simple prefix code\n");
-        u32 nsym_minus_one = streaming_buffer_read_integer(input,2);
-        u32 nsym = nsym_minus_one + 1;
-        // read nsym symbols
-        u32 nsym_buffer[4];
-        for (u32 n = 0; n < nsym; ++n) {
-            u32 sym = streaming_buffer_read_integer(input, alphabet_size_bits);
-            if (sym >= alphabet_size || symbol_exists_in_buffer(nsym_buffer, n, sym))
-                return HZ_ERROR_BROTLI_STREAM_REJECTED;
-            
-            nsym_buffer[n] = sym;
+// Reads a simple or complex prefix code (RFC 7932 sections 3.4 and 3.5).
+HZ_STATIC int32_t hz_brotli_read_prefix_code(hz_brotli_reader_t *br, hz_brotli_tables_t *tables, uint32_t alphabet_size)
+{
+    static const uint8_t code_length_order[HZ_BROTLI_CODE_LENGTH_ALPHABET_SIZE] = {
+        1,2,3,4,0,5,17,6,16,7,8,9,10,11,12,13,14,15
+    };
+    // static code of the code length code lengths, indexed by the next 4 bits
+    static const uint8_t code_length_prefix_bits[16] = {2,2,2,3,2,2,2,4,2,2,2,3,2,2,2,4};
+    static const uint8_t code_length_prefix_value[16] = {0,4,3,2,0,4,3,1,0,4,3,2,0,4,3,5};
+    uint8_t lengths[HZ_BROTLI_COMMAND_ALPHABET_SIZE];
+    uint32_t hskip = hz_brotli_read_bits(br, 2), i, j;
+
+    HZ_MEMSET(lengths, 0, alphabet_size);
+
+    if (hskip == 1) {
+        uint32_t alphabet_bits = 0, symbols[4], count = hz_brotli_read_bits(br, 2) + 1;
+        while ((1u << alphabet_bits) < alphabet_size) ++alphabet_bits;
+
+        for (i = 0; i < count; ++i) {
+            symbols[i] = hz_brotli_read_bits(br, alphabet_bits);
+            if (symbols[i] >= alphabet_size) return -1;
+            for (j = 0; j < i; ++j)
+                if (symbols[j] == symbols[i]) return -1;
         }
-        u32 tree_select;
-        
-        if (nsym == 4)
-            tree_select = streaming_buffer_read(input);
-
-        
 
-    }
-    else
-    {
-        // complex code
-        printf("complex prefix code\n");
-        /* The following is more than slightly complicated...
-         * The way it works is that as opposed to simple prefix codes, which encode symbols as fixed bit-length integers,
-         * complex codes compress the symbol lengths themselves using a prefix code. The table for that is defined below
-         * as 's_prefix_c_over_l_huffman_symbols'.
-         * We have to read 18 **code length lengths** for a predefined list of symbols
-         * provided in section 3.5 of the Brotli spec. and defined as 's_ll_symbols'.
-         */
-        static const huffman_symbol s_prefix_c_over_l_huffman_symbols[6] = {
-            {0x0/* 00 */, 0, 2},
-            {0xe/* 1110 */, 1, 4},
-            {0x6/* 110 */, 2, 3},
-            {0x1/* 01 */, 3, 2},
-            {0x2/* 10 */, 4, 2},
-            {0xf/* 1111 */, 5, 4}
-        }; 
-        struct huffman_tree *prefix_c_over_l_huffman = HUFFMAN_ALLOCATE(s_prefix_c_over_l_huffman_symbols);
-        int code_lengths[18], code_lls[18];
-
-        for(int i = 0; i < 18; ++i) {
-            u32 cl = 0;
-            if (!huffman_decode(input, prefix_c_over_l_huffman, &cl)){
-                printf("can't decode huffman code\n");
-            }
-            printf("CL: %d\n", cl);
-            code_lls[i] = cl;
+        switch (count) {
+            case 1: lengths[symbols[0]] = 1; break;
+            case 2: lengths[symbols[0]] = lengths[symbols[1]] = 1; break;
+            case 3: lengths[symbols[0]] = 1; lengths[symbols[1]] = lengths[symbols[2]] = 2; break;
+            default:
+                if (hz_brotli_read_bits(br, 1)) {
+                    lengths[symbols[0]] = 1; lengths[symbols[1]] = 2;
+                    lengths[symbols[2]] = lengths[symbols[3]] = 3;
+                } else {
+                    for (i = 0; i < 4; ++i) lengths[symbols[i]] = 2;
+                }
+                break;
         }
-        
-        static const int s_ll_symbols[18] = {1,2,3,4,0,5,17,6,16,7,8,9,10,11,12,13,14,15};
-        {
-            /* check if sum of (32 >> cl) for all non-zero code-lengths is 32 to validate if 
-             * we're parsing the code lengths properly, and that the file is valid.
-             */
-            int cl_sum = 0, nz = 0;
-            for (int i = 0; i < 18; ++i) {
-                int cl = code_lls[i];
-                nz += (int){cl > 0};
-                cl_sum += cl ? 32 >> cl : 0;
-            }
-            printf("nz: %u / 18\n", nz);
-            printf("cl_sum: %u\n", cl_sum);
-            if (nz >= 2 && cl_sum != 32 && code_lls[17] != 0) {
-                printf("ERROR: Invalid result for cl_sum!\n");
-                return HZ_ERROR_BROTLI_STREAM_REJECTED;
+    } else {
+        uint8_t code_length_lengths[HZ_BROTLI_CODE_LENGTH_ALPHABET_SIZE] = {0};
+        hz_brotli_huffman_code_t code_length_table[1 << HZ_BROTLI_HUFFMAN_ROOT_BITS];
+        uint32_t used = 0, symbol = 0, repeat = 0, repeat_length = 0, previous_length = 8;
+        int32_t space = 32;
+
+        for (i = hskip; i < HZ_BROTLI_CODE_LENGTH_ALPHABET_SIZE; ++i) {
+            uint32_t p, v;
+            if (br->bits < 4) hz_brotli_refill(br);
+            p = br->val & 15;
+            v = code_length_prefix_value[p];
+            br->val >>= code_length_prefix_bits[p];
+            br->bits -= code_length_prefix_bits[p];
+            code_length_lengths[code_length_order[i]] = (uint8_t)v;
+            if (v) {
+                ++used;
+                space -= 32 >> v;
+                if (space <= 0) break;
             }
         }
 
-        /* build huffman tree */
-        // struct huffman_tree* code_ll_huffman = BUILD_HUFFMAN_TREE(s_ll_symbols, code_lls);
+        if ((used != 1 && space != 0)
+        || !hz_brotli_build_huffman_table(code_length_table, code_length_lengths, HZ_BROTLI_CODE_LENGTH_ALPHABET_SIZE))
+            return -1;
+
+        space = 32768;
+        while (symbol < alphabet_size && space > 0) {
+            uint32_t length = hz_brotli_read_symbol(br, code_length_table);
+            if (length < 16) {
+                repeat = 0;
+                lengths[symbol++] = (uint8_t)length;
+                if (length) {
+                    previous_length = length;
+                    space -= 32768 >> length;
+                }
+            } else {
+                // 16 repeats the previous non-zero length, 17 repeats zero, consecutive repeat codes multiply
+                uint32_t extra_bits = length == 16 ? 2 : 3, new_length = length == 16 ? previous_length : 0;
+                uint32_t old_repeat, delta;
+                if (repeat_length != new_length) {
+                    repeat = 0;
+                    repeat_length = new_length;
+                }
+                old_repeat = repeat;
+                if (repeat) repeat = (repeat - 2) << extra_bits;
+                repeat += hz_brotli_read_bits(br, extra_bits) + 3;
+                delta = repeat - old_repeat;
+                if (delta > alphabet_size - symbol) return -1;
+                HZ_MEMSET(lengths + symbol, (int)repeat_length, delta);
+                symbol += delta;
+                if (repeat_length) space -= (int32_t)(delta << (15 - repeat_length));
+            }
+        }
 
-        /* TODO: Finish this shit */
+        if (space != 0) return -1;
     }
 
-    return HZ_OK;
+    return hz_brotli_add_table(tables, lengths, alphabet_size);
 }
 
-// block category
-enum brotli_blcat {
-    BROTLI_BLCAT_L,
-    BROTLI_BLCAT_I,
-    BROTLI_BLCAT_D,
-    BROTLI_BLCAT_COUNT
-};
+// NBLTYPES and NTREES variable length code, 1 to 256 (RFC 7932 section 9.2)
+HZ_STATIC uint32_t hz_brotli_read_type_count(hz_brotli_reader_t *br)
+{
+    uint32_t n;
+    if (!hz_brotli_read_bits(br, 1)) return 1;
+    n = hz_brotli_read_bits(br, 3);
+    return n ? (1u << n) + 1 + hz_brotli_read_bits(br, n) : 2;
+}
 
-typedef struct {
-    u32 htree_btype;
-    u32 htree_blen;
-    u32 blen;
-    u32 btype;
-    u32 nbltypes;
-} brotli_blcat;
-
-enum brotli_cmode {
-    BROTLI_CMODE_LSB6,
-    BROTLI_CMODE_MSB6,
-    BROTLI_CMODE_UTF8,
-    BROTLI_CMODE_SIGNED,
-    NUM_BROTLI_CMODES
-};
+HZ_STATIC HZ_ALWAYS_INLINE uint32_t hz_brotli_read_block_length(hz_brotli_reader_t *br, const hz_brotli_huffman_code_t *table)
+{
+    uint32_t code = hz_brotli_read_symbol(br, table);
+    return hz_brotli_block_length_codes[code][0] + hz_brotli_read_bits(br, hz_brotli_block_length_codes[code][1]);
+}
 
-static const char* s_brotli_cmode_name[] = {"LSB6","MSB6","UTF8","Signed"};
+HZ_STATIC void hz_brotli_switch_block(hz_brotli_reader_t *br, hz_brotli_block_state_t *b)
+{
+    uint32_t type = hz_brotli_read_symbol(br, b->type_table);
+    if (type == 0) type = b->previous_type;
+    else if (type == 1) type = b->type + 1;
+    else type -= 2;
+    if (type >= b->count) type -= b->count;
+    b->previous_type = b->type;
+    b->type = type;
+    b->length = hz_brotli_read_block_length(br, b->length_table);
+}
 
-typedef struct {
-    unsigned int is_last;
-    unsigned int is_last_empty;
-    unsigned int num_nibbles;
-    brotli_blcat blcats[BROTLI_BLCAT_COUNT];
-    enum brotli_cmode* cmode;
-    enum brotli_cmode* cmapl;
-    enum brotli_cmode* cmapd;
-} brotli_meta_block;
-
-void woff2_brotli_decompress(struct streaming_buffer *input) {
-    // parse wbits, 1-7 bits variable length
-    struct huffman_tree* wbits_huffman = HUFFMAN_ALLOCATE(wbits_huffman_symbols);
-    struct huffman_tree* nbltypes_huffman = HUFFMAN_ALLOCATE(nbltypes_huffman_symbols);
-
-    u32 wbits;
-    if (!huffman_decode(input, wbits_huffman, &wbits)) {
-        printf("Failed to decode huffman!\n");
-    }
-    u32 window_size = (1u << wbits) - 16u;
-
-    printf("wbits: %u\n", wbits);
-    printf("sliding window: %u bytes\n\n", window_size);
-    for(;;) {
-        brotli_meta_block blk = {0};
-
-        // read meta block header
-        u32 is_last = streaming_buffer_read(input);
-        if (is_last){
-            u32 is_last_empty = streaming_buffer_read(input);
-            if (is_last_empty)
-                break;
-        }
+// Reads a context map of size entries (RFC 7932 section 7.3), with run lengths of zeros and an optional inverse
+// move-to-front transform.
+HZ_STATIC hz_bool hz_brotli_read_context_map(hz_brotli_reader_t *br, hz_brotli_tables_t *tables,
+                                             uint8_t *map, uint32_t size, uint32_t tree_count)
+{
+    uint32_t rle_max = 0, i = 0;
+    int32_t offset;
 
-        printf("is_last: %d\n", is_last);
+    if (tree_count < 2) {
+        HZ_MEMSET(map, 0, size);
+        return HZ_TRUE;
+    }
 
-        // read fixed-length mnibbles
-        u32 m_nibbles = ((int[]){4,5,6,0})[streaming_buffer_read_integer(input, 2)];
-        printf("m_nibbles: %d\n", m_nibbles);
-        
-        if (!m_nibbles){
-#if 1
-            u32 reserved = streaming_buffer_read(input);
-            HZ_ASSERT(reserved == 0);
-#else
-            streaming_buffer_skip(input, 1);
-#endif
-            u32 m_skip_bytes = streaming_buffer_read_integer(input, 2);
-            printf("skip bytes: %d\n", m_skip_bytes);
-            u32 m_skip_len = 0;
-            if (m_skip_bytes) {
-                for (u32 i = 0; i < m_skip_bytes; ++i) {
-                    u32 byte = streaming_buffer_read_byte(input);
-                    m_skip_len = (m_skip_len >> 8u) | (byte << 24u);
-                }
+    if (hz_brotli_read_bits(br, 1)) rle_max = hz_brotli_read_bits(br, 4) + 1;
+    if ((offset = hz_brotli_read_prefix_code(br, tables, tree_count + rle_max)) < 0) return HZ_FALSE;
 
-                m_skip_len >>= (32u - (m_skip_bytes << 3u));
-                m_skip_len += 1;
-            }
+    while (i < size) {
+        uint32_t symbol = hz_brotli_read_symbol(br, tables->codes + offset);
+        if (symbol == 0) {
+            map[i++] = 0;
+        } else if (symbol <= rle_max) {
+            uint32_t run = (1u << symbol) + hz_brotli_read_bits(br, symbol);
+            if (run > size - i) return HZ_FALSE;
+            HZ_MEMSET(map + i, 0, run);
+            i += run;
+        } else {
+            map[i++] = (uint8_t)(symbol - rle_max);
+        }
+    }
 
-            printf("skip length: %d\n", m_skip_len);
-            streaming_buffer_align_to_next_byte(input);
-            if (m_skip_len){
-                
-            }
+    if (hz_brotli_read_bits(br, 1)) {
+        uint8_t mtf[256];
+        for (i = 0; i < 256; ++i) mtf[i] = (uint8_t)i;
+        for (i = 0; i < size; ++i) {
+            uint8_t index = map[i], value = mtf[index];
+            map[i] = value;
+            HZ_MEMMOVE(mtf + 1, mtf, index);
+            mtf[0] = value;
         }
+    }
+
+    return HZ_TRUE;
+}
+
+// Applies the case transforms of RFC 7932 section 8 to the UTF-8 sequence at p, returns the sequence length.
+HZ_STATIC uint32_t hz_brotli_uppercase(uint8_t *p, uint32_t length)
+{
+    if (p[0] < 0xC0) {
+        if (p[0] >= 'a' && p[0] <= 'z') p[0] ^= 32;
+        return 1;
+    }
 
-        u32 m_len_minus_one = streaming_buffer_read_integer(input, 4 * m_nibbles);
-        u32 m_len = m_len_minus_one + 1;
+    if (p[0] < 0xE0) {
+        if (length > 1) p[1] ^= 32;
+        return 2;
+    }
 
-        u32 is_uncompressed;
-        if (!is_last) {
-            is_uncompressed = streaming_buffer_read(input);
+    if (length > 2) p[2] ^= 5;
+    return 3;
+}
+
+// Writes the transformed static dictionary word to dst, returns the number of bytes written or -1 if it doesn't fit.
+HZ_STATIC int32_t hz_brotli_transform_word(uint8_t *dst, size_t capacity, const uint8_t *word, uint32_t length, uint32_t id)
+{
+    const hz_brotli_transform_t *t = &hz_brotli_transforms[id];
+    size_t prefix_length = strlen(t->prefix), suffix_length = strlen(t->suffix);
+    uint8_t *p;
+
+    if (t->type >= 12) {
+        uint32_t skip = MIN((uint32_t)t->type - 11, length);
+        word += skip;
+        length -= skip;
+    } else if (t->type >= 1 && t->type <= 9) {
+        length -= MIN((uint32_t)t->type, length);
+    }
+
+    if (prefix_length + length + suffix_length > capacity) return -1;
+
+    HZ_MEMCPY(dst, t->prefix, prefix_length);
+    p = dst + prefix_length;
+    HZ_MEMCPY(p, word, length);
+    if (t->type == 10 && length) {
+        hz_brotli_uppercase(p, length);
+    } else if (t->type == 11) {
+        uint32_t i = 0;
+        while (i < length) i += hz_brotli_uppercase(p + i, length - i);
+    }
+    HZ_MEMCPY(p + length, t->suffix, suffix_length);
+    return (int32_t)(prefix_length + length + suffix_length);
+}
+
+// Decodes the commands of a compressed meta-block whose header up to MLEN has been read.
+HZ_STATIC hz_bool hz_brotli_decode_meta_block(hz_brotli_reader_t *br, hz_brotli_tables_t *tables,
+                                              uint8_t *out, size_t *position, size_t end, size_t window,
+                                              int32_t *distances, uint32_t *distance_index)
+{
+    hz_brotli_block_state_t blocks[3]; // literal, insert-and-copy and distance blocks
+    int32_t type_offsets[3], length_offsets[3];
+    int32_t literal_offsets[HZ_BROTLI_MAX_BLOCK_TYPES], command_offsets[HZ_BROTLI_MAX_BLOCK_TYPES];
+    int32_t distance_offsets[HZ_BROTLI_MAX_BLOCK_TYPES];
+    const hz_brotli_huffman_code_t *literal_tables[HZ_BROTLI_MAX_BLOCK_TYPES];
+    const hz_brotli_huffman_code_t *command_tables[HZ_BROTLI_MAX_BLOCK_TYPES];
+    const hz_brotli_huffman_code_t *distance_tables[HZ_BROTLI_MAX_BLOCK_TYPES];
+    uint8_t modes[HZ_BROTLI_MAX_BLOCK_TYPES];
+    uint8_t literal_map[HZ_BROTLI_MAX_BLOCK_TYPES << 6], distance_map[HZ_BROTLI_MAX_BLOCK_TYPES << 2];
+    uint32_t literal_trees, distance_trees, postfix_bits, postfix_mask, direct, distance_alphabet_size, i;
+    size_t pos = *position;
+
+    tables->size = 0;
+    for (i = 0; i < 3; ++i) {
+        hz_brotli_block_state_t *b = &blocks[i];
+        b->count = hz_brotli_read_type_count(br);
+        b->type = 0;
+        b->previous_type = 1;
+        b->length = 1u << 24;
+        type_offsets[i] = length_offsets[i] = 0;
+        if (b->count >= 2) {
+            if ((type_offsets[i] = hz_brotli_read_prefix_code(br, tables, b->count + 2)) < 0
+            || (length_offsets[i] = hz_brotli_read_prefix_code(br, tables, HZ_BROTLI_BLOCK_LENGTH_ALPHABET_SIZE)) < 0)
+                return HZ_FALSE;
+            b->length = hz_brotli_read_block_length(br, tables->codes + length_offsets[i]);
         }
+    }
 
-        printf("m_len: %u\n", m_len);
-        printf("is_uncompressed: %u\n", is_uncompressed);
+    postfix_bits = hz_brotli_read_bits(br, 2);
+    postfix_mask = (1u << postfix_bits) - 1;
+    direct = hz_brotli_read_bits(br, 4) << postfix_bits;
+    distance_alphabet_size = 16 + direct + (48u << postfix_bits);
+
+    for (i = 0; i < blocks[0].count; ++i)
+        modes[i] = (uint8_t)hz_brotli_read_bits(br, 2);
+
+    literal_trees = hz_brotli_read_type_count(br);
+    if (!hz_brotli_read_context_map(br, tables, literal_map, blocks[0].count << 6, literal_trees))
+        return HZ_FALSE;
+    distance_trees = hz_brotli_read_type_count(br);
+    if (!hz_brotli_read_context_map(br, tables, distance_map, blocks[2].count << 2, distance_trees))
+        return HZ_FALSE;
+
+    for (i = 0; i < literal_trees; ++i)
+        if ((literal_offsets[i] = hz_brotli_read_prefix_code(br, tables, HZ_BROTLI_LITERAL_ALPHABET_SIZE)) < 0)
+            return HZ_FALSE;
+    for (i = 0; i < blocks[1].count; ++i)
+        if ((command_offsets[i] = hz_brotli_read_prefix_code(br, tables, HZ_BROTLI_COMMAND_ALPHABET_SIZE)) < 0)
+            return HZ_FALSE;
+    for (i = 0; i < distance_trees; ++i)
+        if ((distance_offsets[i] = hz_brotli_read_prefix_code(br, tables, distance_alphabet_size)) < 0)
+            return HZ_FALSE;
+
+    // the tables are final, resolve the offsets
+    for (i = 0; i < 3; ++i) {
+        blocks[i].type_table = tables->codes + type_offsets[i];
+        blocks[i].length_table = tables->codes + length_offsets[i];
+    }
+    for (i = 0; i < literal_trees; ++i) literal_tables[i] = tables->codes + literal_offsets[i];
+    for (i = 0; i < blocks[1].count; ++i) command_tables[i] = tables->codes + command_offsets[i];
+    for (i = 0; i < distance_trees; ++i) distance_tables[i] = tables->codes + distance_offsets[i];
 
-        for (u32 i = 0; i < BROTLI_BLCAT_COUNT; ++i) {//iterate I,L,D
-            brotli_blcat* c = &blk.blcats[i];
-            
-            if (!huffman_decode(input, nbltypes_huffman, &c->nbltypes)) {
-                printf("Failed to decode huffman symbol.\n");
+    {
+        const uint8_t *literal_context_map = literal_map, *distance_context_map = distance_map;
+        const uint8_t *lut = hz_brotli_context_lut[modes[0]];
+        const hz_brotli_huffman_code_t *command_table = command_tables[0];
+        uint8_t p1 = pos ? out[pos - 1] : 0, p2 = pos > 1 ? out[pos - 2] : 0;
+
+        while (pos < end) {
+            uint32_t command, insert_code, copy_code, insert, copy, code = 0;
+            int32_t distance;
+            size_t max_distance;
+
+            if (!blocks[1].length) {
+                hz_brotli_switch_block(br, &blocks[1]);
+                command_table = command_tables[blocks[1].type];
             }
-            printf("nbltypes_i: %u\n", c->nbltypes);
-            
-            if (c->nbltypes >= 2){
+            --blocks[1].length;
+
+            command = hz_brotli_read_symbol(br, command_table);
+            insert_code = hz_brotli_command_cells[command >> 6][0] + ((command >> 3) & 7);
+            copy_code = hz_brotli_command_cells[command >> 6][1] + (command & 7);
+            insert = hz_brotli_insert_length_codes[insert_code][0]
+                   + hz_brotli_read_bits(br, hz_brotli_insert_length_codes[insert_code][1]);
+            copy = hz_brotli_copy_length_codes[copy_code][0]
+                 + hz_brotli_read_bits(br, hz_brotli_copy_length_codes[copy_code][1]);
+
+            if (insert > end - pos) return HZ_FALSE;
+            if (br->overrun > HZ_BROTLI_READER_LOOKAHEAD) return HZ_FALSE; // truncated, only zeros left to decode
+            while (insert--) {
+                uint32_t context;
+                if (!blocks[0].length) {
+                    hz_brotli_switch_block(br, &blocks[0]);
+                    literal_context_map = literal_map + (blocks[0].type << 6);
+                    lut = hz_brotli_context_lut[modes[blocks[0].type]];
+                }
+                --blocks[0].length;
+                context = lut[p1] | lut[256 + p2];
+                p2 = p1;
+                p1 = (uint8_t)hz_brotli_read_symbol(br, literal_tables[literal_context_map[context]]);
+                out[pos++] = p1;
+            }
+
+            // the copy of a command that completes the meta-block is ignored
+            if (pos == end) break;
 
+            if (command < 128) {
+                distance = distances[*distance_index & 3];
             } else {
-                c->btype = 0, c->blen = 16777216;
+                if (!blocks[2].length) {
+                    hz_brotli_switch_block(br, &blocks[2]);
+                    distance_context_map = distance_map + (blocks[2].type << 2);
+                }
+                --blocks[2].length;
+
+                code = hz_brotli_read_symbol(br, distance_tables[distance_context_map[copy > 4 ? 3 : copy - 2]]);
+                if (code < 16) {
+                    distance = distances[(*distance_index - hz_brotli_short_distance_index[code]) & 3]
+                             + hz_brotli_short_distance_offset[code];
+                    if (distance <= 0) return HZ_FALSE;
+                } else if (code < 16 + direct) {
+                    distance = (int32_t)code - 15;
+                } else {
+                    uint32_t d = code - 16 - direct, bits = 1 + (d >> (postfix_bits + 1));
+                    uint32_t offset = ((2 + ((d >> postfix_bits) & 1)) << bits) - 4;
+                    distance = (int32_t)(((offset + hz_brotli_read_bits(br, bits)) << postfix_bits)
+                             + (d & postfix_mask) + direct + 1);
+                }
             }
-        }
 
-        u32 nbltypesi = blk.blcats[BROTLI_BLCAT_I].nbltypes;
-        u32 nbltypesl = blk.blcats[BROTLI_BLCAT_L].nbltypes;
-        u32 nbltypesd = blk.blcats[BROTLI_BLCAT_D].nbltypes;
+            max_distance = MIN(pos, window);
+            if ((size_t)distance > max_distance) {
+                // static dictionary reference, the distance past the window selects the word and transform
+                uint32_t word_id = (uint32_t)((size_t)distance - max_distance - 1), size_bits, index, transform;
+                int32_t written;
+                if (copy < HZ_BROTLI_MIN_DICTIONARY_WORD_LENGTH || copy > HZ_BROTLI_MAX_DICTIONARY_WORD_LENGTH)
+                    return HZ_FALSE;
+                size_bits = hz_brotli_dictionary_size_bits[copy];
+                index = word_id & ((1u << size_bits) - 1);
+                transform = word_id >> size_bits;
+                if (transform >= HZ_BROTLI_NUM_TRANSFORMS) return HZ_FALSE;
+                written = hz_brotli_transform_word(out + pos, end - pos,
+                                                   hz_brotli_dictionary + hz_brotli_dictionary_offsets[copy] + index * copy,
+                                                   copy, transform);
+                if (written < 0) return HZ_FALSE;
+                pos += (size_t)written;
+            } else {
+                const uint8_t *src = out + pos - distance;
+                uint8_t *dst = out + pos;
+                if (code) distances[++*distance_index & 3] = distance;
+                if (copy > end - pos) return HZ_FALSE;
+                if ((uint32_t)distance >= copy) {
+                    HZ_MEMCPY(dst, src, copy);
+                } else {
+                    for (i = 0; i < copy; ++i) dst[i] = src[i];
+                }
+                pos += copy;
+            }
 
-        u32 npostfix = streaming_buffer_read_integer(input, 2);
-        printf("npostfix: %u\n", npostfix);
-        
-        u32 ndirect_four_msb_bits = streaming_buffer_read_integer(input, 4);
-        u32 ndirect = ndirect_four_msb_bits << npostfix;
-        printf("ndirect: %u\n", ndirect);
-        
-        // read cmode[]
-        // read context mode for each literal block type
-        blk.cmode = hz_malloc(sizeof(blk.cmode[0]) * nbltypesl); 
-        for (u32 i = 0; i < nbltypesl; ++i) {
-            u32 cmode = streaming_buffer_read_integer(input, 2);
-            printf("cmode: %s\n", s_brotli_cmode_name[cmode]);
-            blk.cmode[i] = cmode;
+            p1 = pos ? out[pos - 1] : 0;
+            p2 = pos > 1 ? out[pos - 2] : 0;
         }
+    }
 
-        u32 ntreesl, ntreesd;
-        huffman_decode(input, nbltypes_huffman, &ntreesl);
-        if (ntreesl >= 2) { // read context map, CMAPL[]
-
-        } else {
-            // fill CMAPL[] with zeros
-        }
-        huffman_decode(input, nbltypes_huffman, &ntreesd);
-        if (ntreesd >= 2) { // read context map, CMAPD[]
+    *position = pos;
+    return HZ_TRUE;
+}
 
-        } else {
-            // fill CMAPD[] with zeros
-        }
+// Decompresses a complete Brotli stream into out, which bounds the output, and returns the decompressed size in
+// out_size. A truncated stream fails with HZ_ERROR_INVALID_FORMAT, one that is malformed or larger than capacity
+// with HZ_ERROR_BROTLI_STREAM_REJECTED.
+HZ_STATIC hz_error_t hz_brotli_decompress(const uint8_t *data, size_t size, uint8_t *out, size_t capacity, size_t *out_size)
+{
+    hz_brotli_reader_t br;
+    hz_brotli_tables_t tables = {0};
+    int32_t distances[4] = {16, 15, 11, 4};
+    uint32_t distance_index = 3, wbits, n, is_last = 0, i;
+    size_t pos = 0, window;
+    hz_error_t error = HZ_ERROR_BROTLI_STREAM_REJECTED;
 
-        printf("ntreesl: %u\n", ntreesl);
-        printf("ntreesd: %u\n", ntreesd);
-        
-        u32 alphabet_size_distance = 16 + ndirect + (48 << npostfix);
-        u32 alphabet_size_distance_bits = fit_bits_for_max_value(alphabet_size_distance);
-        
-        brotli_prefix_code *literal_codes = hz_malloc(sizeof(brotli_prefix_code)*nbltypesl);
-        brotli_prefix_code *insert_and_copy_length_codes = hz_malloc(sizeof(brotli_prefix_code)*nbltypesi);
-        brotli_prefix_code *distance_codes = hz_malloc(sizeof(brotli_prefix_code)*nbltypesd);
+    hz_brotli_reader_init(&br, data, size);
 
-        for (u32 i = 0; i<ntreesl; ++i) {
-            if (HZ_OK != brotli_decode_prefix_code(input, ALPHABET_SIZE_LITERAL, 8, &literal_codes[i])) {
-                // reject stream
-                break;
+    // WBITS (RFC 7932 section 9.1), the large window extension isn't part of the format
+    if (!hz_brotli_read_bits(&br, 1)) {
+        wbits = 16;
+    } else if ((n = hz_brotli_read_bits(&br, 3))) {
+        wbits = 17 + n;
+    } else {
+        n = hz_brotli_read_bits(&br, 3);
+        if (n == 1) goto done;
+        wbits = n ? 8 + n : 17;
+    }
+    window = ((size_t)1 << wbits) - 16;
+
+    while (!is_last) {
+        uint32_t nibbles, meta_length = 0;
+
+        is_last = hz_brotli_read_bits(&br, 1);
+        if (is_last && hz_brotli_read_bits(&br, 1)) break; // ISLASTEMPTY
+
+        nibbles = hz_brotli_read_bits(&br, 2);
+        if (nibbles == 3) {
+            // metadata block, skipped
+            uint32_t skip_bytes, skip_length = 0;
+            if (is_last || hz_brotli_read_bits(&br, 1)) goto done;
+            skip_bytes = hz_brotli_read_bits(&br, 2);
+            for (i = 0; i < skip_bytes; ++i) {
+                uint32_t byte = hz_brotli_read_bits(&br, 8);
+                if (i + 1 == skip_bytes && skip_bytes > 1 && !byte) goto done;
+                skip_length |= byte << (i * 8);
             }
+            if (skip_bytes) ++skip_length;
+            if (!hz_brotli_read_bytes(&br, NULL, skip_length)) goto done;
+            continue;
         }
 
-        for (u32 i = 0; i<nbltypesi; ++i) {
-            if (HZ_OK != brotli_decode_prefix_code(input, ALPHABET_SIZE_INSERT_AND_COPY_LENGTH, 10, &insert_and_copy_length_codes[i])) {
-                // reject stream
-                break;
-            }
+        nibbles += 4;
+        for (i = 0; i < nibbles; ++i) {
+            uint32_t nibble = hz_brotli_read_bits(&br, 4);
+            if (i + 1 == nibbles && nibbles > 4 && !nibble) goto done;
+            meta_length |= nibble << (i * 4);
         }
-
-        for (u32 i = 0; i<ntreesd; ++i) {
-            if (HZ_OK != brotli_decode_prefix_code(input, alphabet_size_distance, alphabet_size_distance_bits, &distance_codes[i])) {
-                // reject stream
-                break;
-            }
+        ++meta_length;
+        if (meta_length > capacity - pos) goto done;
+
+        if (!is_last && hz_brotli_read_bits(&br, 1)) {
+            // uncompressed meta-block
+            if (!hz_brotli_read_bytes(&br, out + pos, meta_length)) goto done;
+            pos += meta_length;
+            continue;
         }
 
-        hz_free(distance_codes);
-        hz_free(insert_and_copy_length_codes);
-        hz_free(literal_codes);
+        if (!hz_brotli_decode_meta_block(&br, &tables, out, &pos, pos + meta_length, window, distances, &distance_index))
+            goto done;
+    }
 
-        break;
+    // trailing bits must be zero, and the stream must not have run past the input
+    if (!hz_brotli_sync(&br)) goto done;
+
+    *out_size = pos;
+    error = HZ_OK;
+
+done:
+    // zero bytes read rather than just buffered, the stream ran past the end of the input
+    if (error != HZ_OK && (size_t)br.overrun * 8 > br.bits) error = HZ_ERROR_INVALID_FORMAT;
+    if (tables.codes) hz_free(tables.codes);
+    return error;
+}
+
+static const hz_tag_t woff2_known_table_tags[63] = {
+    'cmap', 'head', 'hhea', 'hmtx',
+    'maxp', 'name', 'OS/2', 'post',
+    'cvt ', 'fpgm', 'glyf', 'loca',
+    'prep', 'CFF ', 'VORG', 'EBDT',
+    'EBLC', 'gasp', 'hdmx', 'kern',
+    'LTSH', 'PCLT', 'VDMX', 'vhea',
+    'vmtx', 'BASE', 'GDEF', 'GPOS',
+    'GSUB', 'EBSC', 'JSTF', 'MATH',
+    'CBDT', 'CBLC', 'COLR', 'CPAL',
+    'SVG ', 'sbix', 'acnt', 'avar',
+    'bdat', 'bloc', 'bsln', 'cvar',
+    'fdsc', 'feat', 'fmtx', 'fvar',
+    'gvar', 'hsty', 'just', 'lcar',
+    'mort', 'morx', 'opbd', 'prop',
+    'trak', 'Zapf', 'Silf', 'Glat',
+    'Gloc', 'Feat', 'Sill'
+};
+
+#define WOFF2_SIGNATURE 0x774F4632 /* wOF2 */
+#define WOFF2_HEADER_SIZE 48
+
+// Upper bound of the decompressed table data, the reference decoder's limit.
+#define WOFF2_MAX_TABLE_DATA_SIZE (30u << 20)
+// Upper bound of the decoded font, the table data plus the offset table, the table directory and the padding of
+// every table to four bytes.
+#define WOFF2_MAX_SFNT_SIZE(num_tables) (WOFF2_MAX_TABLE_DATA_SIZE + 12u + (num_tables) * (16u + 3u))
+
+// simple and composite glyph flags used by the glyf transform
+#define WOFF2_GLYF_ON_CURVE 0x01
+#define WOFF2_GLYF_X_SHORT 0x02
+#define WOFF2_GLYF_Y_SHORT 0x04
+#define WOFF2_GLYF_REPEAT 0x08
+#define WOFF2_GLYF_THIS_X_IS_SAME 0x10
+#define WOFF2_GLYF_THIS_Y_IS_SAME 0x20
+#define WOFF2_GLYF_OVERLAP_SIMPLE 0x40
+#define WOFF2_COMPOSITE_ARG_1_AND_2_ARE_WORDS 0x0001
+#define WOFF2_COMPOSITE_WE_HAVE_A_SCALE 0x0008
+#define WOFF2_COMPOSITE_MORE_COMPONENTS 0x0020
+#define WOFF2_COMPOSITE_WE_HAVE_AN_X_AND_Y_SCALE 0x0040
+#define WOFF2_COMPOSITE_WE_HAVE_A_TWO_BY_TWO 0x0080
+#define WOFF2_COMPOSITE_WE_HAVE_INSTRUCTIONS 0x0100
+
+struct hz_woff2_header {
+    u32 signature, flavor, length;
+    u16 num_tables, reserved;
+    u32 total_sfnt_size, total_compressed_size;
+    u16 major_version, minor_version;
+    u32 meta_offset, meta_length, meta_orig_length;
+    u32 priv_offset, priv_length;
+};
+
+typedef struct {
+    hz_tag_t tag;
+    u32 transform_version;
+    hz_bool transformed;
+    u32 orig_length, transform_length;
+    u32 src_offset; // in the decompressed table data
+    u32 dst_offset, dst_length, checksum;
+} hz_woff2_table_t;
+
+// Bounds checked big-endian reader, reads past the end yield zeros and set the error flag.
+typedef struct {
+    const u8 *data;
+    size_t size, offset;
+    hz_bool error;
+} hz_woff2_reader_t;
+
+// Bounds checked big-endian writer into the caller's sfnt buffer.
+typedef struct {
+    u8 *data;
+    size_t capacity, size;
+    hz_bool error;
+} hz_woff2_writer_t;
+
+typedef struct {
+    u32 num_glyphs;
+    u32 index_format;
+    u32 *loca; // num_glyphs + 1 offsets into the reconstructed glyf table
+    s16 *x_mins; // for the hmtx transform
+    void *memory;
+} hz_woff2_glyf_info_t;
+
+HZ_STATIC hz_woff2_reader_t hz_woff2_reader(const u8 *data, size_t size)
+{
+    hz_woff2_reader_t r = {data, size, 0, HZ_FALSE};
+    return r;
+}
+
+HZ_STATIC const u8 *hz_woff2_read_bytes(hz_woff2_reader_t *r, size_t n)
+{
+    const u8 *p = r->data + r->offset;
+    if (n > r->size - r->offset) {
+        r->error = HZ_TRUE;
+        r->offset = r->size;
+        return NULL;
     }
+    r->offset += n;
+    return p;
 }
 
-// This is where we start parsing a WOFF2 file from an in-memory buffer
-// provided by the caller. This does modify the memory passed in
-hz_font_t *hz_font_load_woff2_from_memory(u8 *mem, size_t sz) {
-    //  Ensure user doesn't pass in garbage or malicious values
-    HZ_ASSERT((mem != NULL) && "Passed in null value");
-    HZ_ASSERT(sz > 0); // ensure size is non-zero
-
-    struct hz_woff2_header *hdr = (struct hz_woff2_header*)mem;
-    mem += 48;
-    if (!IS_BIG_ENDIAN){
-        hz_byte_swap_u32x2((u64*)&hdr->signature);
-        hz_byte_swap_32(&hdr->length);
-        hz_byte_swap_16(&hdr->num_tables);
-        hz_byte_swap_u32x2((u64*)&hdr->total_sfnt_size);
-        hz_byte_swap_u16x2((u32*)&hdr->major_version);
-        hz_byte_swap_u32x2((u64*)&hdr->meta_offset);
-        hz_byte_swap_u32x2((u64*)&hdr->meta_orig_length);
-        hz_byte_swap_32((u32*)&hdr->priv_length);
-    }
-
-    if (hdr->signature != 0x774F4632) { //'wOF2'
-        return NULL; // error, signature mismatch
-    }
-    printf("Woff2 Header:\n");
-    printf("\tFlavor: 0x%08x\n", hdr->flavor);
-    printf("\tLength: %u\n", hdr->length);
-    printf("\tVer: %hu.%hu\n", hdr->major_version, hdr->minor_version);
-    printf("\tNumber Of Tables: %u\n", hdr->num_tables);
-    printf("\tTotal Compressed Size: %u\n", hdr->total_compressed_size);
-    printf("\tTotal Snft Size: %u\n", hdr->total_sfnt_size);
-    printf("\tMeta Offset: %u\n", hdr->meta_offset);
-    printf("\tMeta Length: %u\n", hdr->meta_length);
-    printf("\tMeta Original Length: %u\n", hdr->meta_orig_length);
-
-    if (sz != hdr->total_compressed_size) {
-        printf("warning: total compressed size mismatch, sz: %u, total_compressed_size: %u\n",
-        (u32)sz, hdr->total_compressed_size);
-    }
-
-    printf("table directory:\n");
-    for (u32 i = 0; i < hdr->num_tables; ++i){
-        struct hz_woff2_table_dir_entry d = {0};
-        d.flags.c = (unsigned int) *mem++;
-        if (d.flags.s.known_tag == 63) {//arbitrary tag
-            d.tag = *(u32*)(mem); mem += 4;
-            if (!IS_BIG_ENDIAN) hz_byte_swap_32(&d.tag);
-        } else {
-            d.tag = woff2_known_table_tags[d.flags.s.known_tag];
-        }
+HZ_STATIC HZ_ALWAYS_INLINE u8 hz_woff2_read_u8(hz_woff2_reader_t *r)
+{
+    if (r->offset >= r->size) {
+        r->error = HZ_TRUE;
+        return 0;
+    }
+    return r->data[r->offset++];
+}
 
-        mem += hz_read_base_uint128(&d.orig_length, mem);
-        if (d.flags.s.preprocessing_transformation_version_number != 3) {
-            mem += hz_read_base_uint128(&d.transform_length, mem);
-        }
-        printf("flags: 0x%02x, orig_length: %u, transform_length: %u, tag: '%c%c%c%c', transform: %u\n",
-            (u32)d.flags.c&0x3f, d.orig_length, d.transform_length, HZ_UNTAG(d.tag), d.flags.s.preprocessing_transformation_version_number);
+HZ_STATIC HZ_ALWAYS_INLINE u16 hz_woff2_read_u16(hz_woff2_reader_t *r)
+{
+    const u8 *p = hz_woff2_read_bytes(r, 2);
+    return p ? (u16)(p[0] << 8 | p[1]) : 0;
+}
+
+HZ_STATIC HZ_ALWAYS_INLINE u32 hz_woff2_read_u32(hz_woff2_reader_t *r)
+{
+    const u8 *p = hz_woff2_read_bytes(r, 4);
+    return p ? (u32)p[0] << 24 | (u32)p[1] << 16 | (u32)p[2] << 8 | p[3] : 0;
+}
+
+// UIntBase128, at most 5 bytes without leading zeros
+HZ_STATIC u32 hz_woff2_read_base128(hz_woff2_reader_t *r)
+{
+    u32 accum = 0;
+    for (u32 i = 0; i < 5; ++i) {
+        u8 byte = hz_woff2_read_u8(r);
+        // no leading zeros, and shifting must not overflow
+        if ((!i && byte == 0x80) || (accum & 0xfe000000)) break;
+        accum = (accum << 7) | (byte & 0x7f);
+        if (!(byte & 0x80)) return accum;
     }
 
-    if (hdr->flavor == 0x74746366){//ttcf
-        // read collection directory format
-        struct woff2_collection_header collection_hdr = {0}; 
-        collection_hdr.version = *(u32*)mem;
-        mem += 4;
-        if (!IS_BIG_ENDIAN) hz_byte_swap_32(&collection_hdr.version);
-        mem += read_255_uint16(mem, &collection_hdr.num_fonts);
-        printf("version: %d, num_fonts: %d\n", collection_hdr.version, collection_hdr.num_fonts);
+    r->error = HZ_TRUE;
+    return 0;
+}
+
+HZ_STATIC u16 hz_woff2_read_255_uint16(hz_woff2_reader_t *r)
+{
+    u8 code = hz_woff2_read_u8(r);
+    switch (code) {
+        case 253: return hz_woff2_read_u16(r);
+        case 254: return (u16)(hz_woff2_read_u8(r) + 253 * 2);
+        case 255: return (u16)(hz_woff2_read_u8(r) + 253);
+        default: return code;
     }
+}
 
-    // decompress brotli stream
-    struct streaming_buffer buffer = {.data=mem, .bit_offset=0};
-    woff2_brotli_decompress(&buffer);
+HZ_STATIC HZ_ALWAYS_INLINE void hz_woff2_write_bytes(hz_woff2_writer_t *w, const void *data, size_t n)
+{
+    if (n > w->capacity - w->size) {
+        w->error = HZ_TRUE;
+        return;
+    }
+    HZ_MEMCPY(w->data + w->size, data, n);
+    w->size += n;
+}
 
-    return NULL;
+HZ_STATIC HZ_ALWAYS_INLINE void hz_woff2_write_u8(hz_woff2_writer_t *w, u8 v)
+{
+    if (w->size >= w->capacity) {
+        w->error = HZ_TRUE;
+        return;
+    }
+    w->data[w->size++] = v;
 }
 
-#define HZ_BASE85_VALIDATE_CHARS
+HZ_STATIC HZ_ALWAYS_INLINE void hz_woff2_write_u16(hz_woff2_writer_t *w, u16 v)
+{
+    u8 b[2] = {(u8)(v >> 8), (u8)v};
+    hz_woff2_write_bytes(w, b, 2);
+}
 
-/* The Base85/Ascii85 decoder is based on the RFC 1924
- * version of the encoding: https://datatracker.ietf.org/doc/html/rfc1924,
- * The character set is as follows:
- *      0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz!#$%&()*+-;<=>?@^_`{|}~
- */
-static const s32 base85_alphabet_rfc_1924[127] = {
-    [0 ... 32] = -1,
-    [33] = 62,-1,63,64,65,66,-1,67,68,69,70,-1,71,-1,-1,0,1,2,3,4,5,6,7,8,9,-1,72,73,74,75,76,77,
-    10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,
-    -1,-1,-1, 78,79,80,
-    36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,
-    81,82,84,84
-};
+HZ_STATIC HZ_ALWAYS_INLINE void hz_woff2_write_u32(hz_woff2_writer_t *w, u32 v)
+{
+    u8 b[4] = {(u8)(v >> 24), (u8)(v >> 16), (u8)(v >> 8), (u8)v};
+    hz_woff2_write_bytes(w, b, 4);
+}
 
-enum base85_error {
-    BASE85_OVERFLOW = -1,
-    BASE85_INVALID_CHARS = -2,
-};
+HZ_STATIC HZ_ALWAYS_INLINE void hz_woff2_put_u16(u8 *p, u16 v)
+{
+    p[0] = (u8)(v >> 8);
+    p[1] = (u8)v;
+}
 
-s32 hz_base85_max_size(const s8 *const inp, s32 *restrict max_outp_sz)
+HZ_STATIC HZ_ALWAYS_INLINE void hz_woff2_put_u32(u8 *p, u32 v)
 {
-    s32 inp_sz = strlen(inp);
-    *max_outp_sz = ((inp_sz + 3) / 4) * 5;
-    return inp_sz;
+    p[0] = (u8)(v >> 24);
+    p[1] = (u8)(v >> 16);
+    p[2] = (u8)(v >> 8);
+    p[3] = (u8)v;
 }
 
-s32 base85_char_ng(s8 c)
+HZ_STATIC void hz_woff2_pad4(hz_woff2_writer_t *w)
 {
-    return ((c < 33u) || (c > 117u));
+    static const u8 zeros[4] = {0};
+    hz_woff2_write_bytes(w, zeros, (4 - (w->size & 3)) & 3);
 }
 
-static s32 decode_base85_adobe(u8 *restrict outp, s32 max_outp_sz, const s8 *const inp, s32 inp_sz)
+HZ_STATIC u32 hz_woff2_checksum(const u8 *data, size_t length)
 {
-    s32 outp_sz = 0, i = 0;
-    u32 chunk;
+    u32 sum = 0;
+    for (size_t i = 0; i < length; i += 4)
+        sum += (u32)data[i] << 24 | (u32)data[i + 1] << 16 | (u32)data[i + 2] << 8 | data[i + 3];
+    return sum;
+}
 
-    while (i < inp_sz) {
-        s32 chunk_sz = inp_sz - i;
-        if (inp[i] == (u8)' ') {
-            ++i; continue; // ignore whitespace
-        } else if (inp[i] == (u8)'z') {
-            ++i;
-            chunk = 0;
-            chunk_sz = 5;
-        }
-        else if (base85_char_ng(inp[i])
+HZ_STATIC hz_bool hz_woff2_read_header(const u8 *data, size_t size, struct hz_woff2_header *hdr)
+{
+    hz_woff2_reader_t r = hz_woff2_reader(data, size);
+    hdr->signature = hz_woff2_read_u32(&r);
+    hdr->flavor = hz_woff2_read_u32(&r);
+    hdr->length = hz_woff2_read_u32(&r);
+    hdr->num_tables = hz_woff2_read_u16(&r);
+    hdr->reserved = hz_woff2_read_u16(&r);
+    hdr->total_sfnt_size = hz_woff2_read_u32(&r);
+    hdr->total_compressed_size = hz_woff2_read_u32(&r);
+    hdr->major_version = hz_woff2_read_u16(&r);
+    hdr->minor_version = hz_woff2_read_u16(&r);
+    hdr->meta_offset = hz_woff2_read_u32(&r);
+    hdr->meta_length = hz_woff2_read_u32(&r);
+    hdr->meta_orig_length = hz_woff2_read_u32(&r);
+    hdr->priv_offset = hz_woff2_read_u32(&r);
+    hdr->priv_length = hz_woff2_read_u32(&r);
+    return !r.error && hdr->signature == WOFF2_SIGNATURE && hdr->num_tables && hdr->length <= size
+        && hdr->total_sfnt_size <= WOFF2_MAX_SFNT_SIZE(hdr->num_tables);
+}
+
+// Decodes one glyph coordinate of the glyf transform's triplet encoding, the flag selects how many bytes of the glyph
+// stream the x and y deltas take up and how they are packed.
+HZ_STATIC hz_bool hz_woff2_decode_triplet(hz_woff2_reader_t *glyphs, u8 flag, s32 *dx, s32 *dy)
+{
+    u32 n = flag < 84 ? 1 : flag < 120 ? 2 : flag < 124 ? 3 : 4;
+    const u8 *in = hz_woff2_read_bytes(glyphs, n);
+    s32 x, y;
+    if (!in) return HZ_FALSE;
+
+    if (flag < 10) {
+        x = 0;
+        y = ((flag & 14) << 7) + in[0];
+    } else if (flag < 20) {
+        x = (((flag - 10) & 14) << 7) + in[0];
+        y = 0;
+    } else if (flag < 84) {
+        u32 b0 = flag - 20, b1 = in[0];
+        x = 1 + (b0 & 0x30) + (b1 >> 4);
+        y = 1 + ((b0 & 0x0c) << 2) + (b1 & 0x0f);
+    } else if (flag < 120) {
+        u32 b0 = flag - 84;
+        x = 1 + ((b0 / 12) << 8) + in[0];
+        y = 1 + (((b0 % 12) >> 2) << 8) + in[1];
+    } else if (flag < 124) {
+        x = (in[0] << 4) + (in[1] >> 4);
+        y = ((in[1] & 0x0f) << 8) + in[2];
+    } else {
+        x = (in[0] << 8) + in[1];
+        y = (in[2] << 8) + in[3];
+    }
+
+    // the low bits of the flag hold the signs, set meaning positive
+    *dx = (flag & 1) ? x : -x;
+    *dy = ((flag < 20 ? flag : flag >> 1) & 1) ? y : -y;
+    return HZ_TRUE;
+}
+
+// Writes a simple glyph's flags and coordinates in the usual packed form, with runs of equal flags repeated.
+HZ_STATIC void hz_woff2_write_points(hz_woff2_writer_t *w, const s32 *xs, const s32 *ys, const u8 *on_curve,
+                                     u32 count, hz_bool overlap)
+{
+    s32 last_x = 0, last_y = 0;
+    u32 repeat = 0, i;
+    int last_flag = -1;
+    size_t flag_offset = 0;
+
+    for (i = 0; i < count; ++i) {
+        s32 dx = xs[i] - last_x, dy = ys[i] - last_y;
+        u8 flag = on_curve[i] ? WOFF2_GLYF_ON_CURVE : 0;
+        if (!i && overlap) flag |= WOFF2_GLYF_OVERLAP_SIMPLE;
+
+        if (dx == 0) flag |= WOFF2_GLYF_THIS_X_IS_SAME;
+        else if (dx > -256 && dx < 256) flag |= WOFF2_GLYF_X_SHORT | (dx > 0 ? WOFF2_GLYF_THIS_X_IS_SAME : 0);
+        if (dy == 0) flag |= WOFF2_GLYF_THIS_Y_IS_SAME;
+        else if (dy > -256 && dy < 256) flag |= WOFF2_GLYF_Y_SHORT | (dy > 0 ? WOFF2_GLYF_THIS_Y_IS_SAME : 0);
+
+        if (flag == last_flag && repeat != 255) {
+            if (!w->error) w->data[flag_offset] |= WOFF2_GLYF_REPEAT;
+            ++repeat;
+        } else {
+            if (repeat) hz_woff2_write_u8(w, (u8)repeat);
+            flag_offset = w->size;
+            hz_woff2_write_u8(w, flag);
+            repeat = 0;
+        }
+
+        last_x = xs[i];
+        last_y = ys[i];
+        last_flag = flag;
+    }
+    if (repeat) hz_woff2_write_u8(w, (u8)repeat);
+
+    for (int axis = 0; axis < 2; ++axis) {
+        const s32 *v = axis ? ys : xs;
+        s32 last = 0;
+        for (i = 0; i < count; ++i) {
+            s32 d = v[i] - last;
+            last = v[i];
+            if (d == 0) continue;
+            if (d > -256 && d < 256) hz_woff2_write_u8(w, (u8)(d < 0 ? -d : d));
+            else hz_woff2_write_u16(w, (u16)(s16)d);
+        }
+    }
+}
+
+// Rebuilds the glyf table from its transformed form (WOFF2 section 5.1) into w, recording the loca offsets and the
+// x minimum of each glyph in info.
+HZ_STATIC hz_error_t hz_woff2_reconstruct_glyf(const u8 *data, size_t size, hz_woff2_writer_t *w, hz_woff2_glyf_info_t *info)
+{
+    hz_woff2_reader_t header = hz_woff2_reader(data, size), streams[7];
+    hz_woff2_reader_t *n_contours = &streams[0], *n_points = &streams[1], *flags = &streams[2], *glyphs = &streams[3];
+    hz_woff2_reader_t *composites = &streams[4], *bboxes = &streams[5], *instructions = &streams[6];
+    const u8 *bbox_bitmap, *overlap_bitmap = NULL;
+    u32 option_flags, bitmap_size, max_points = 0, g, i;
+    size_t offset = 36, glyf_start = w->size;
+    s32 *xs, *ys;
+    u8 *on_curve;
+
+    hz_woff2_read_u16(&header); // reserved
+    option_flags = hz_woff2_read_u16(&header);
+    info->num_glyphs = hz_woff2_read_u16(&header);
+    info->index_format = hz_woff2_read_u16(&header);
+    for (i = 0; i < 7; ++i) {
+        u32 stream_size = hz_woff2_read_u32(&header);
+        if (header.error || stream_size > size - offset) return HZ_ERROR_INVALID_FORMAT;
+        streams[i] = hz_woff2_reader(data + offset, stream_size);
+        offset += stream_size;
+    }
+
+    if (info->index_format > 1) return HZ_ERROR_INVALID_FORMAT;
+
+    if (option_flags & 1) {
+        if ((info->num_glyphs + 7) >> 3 > size - offset) return HZ_ERROR_INVALID_FORMAT;
+        overlap_bitmap = data + offset;
+    }
+
+    bitmap_size = ((info->num_glyphs + 31) >> 5) << 2;
+    if (!(bbox_bitmap = hz_woff2_read_bytes(bboxes, bitmap_size))) return HZ_ERROR_INVALID_FORMAT;
+
+    // every point has a flag byte, which bounds the point scratch of the largest glyph
+    {
+        hz_woff2_reader_t c = *n_contours, p = *n_points;
+        for (g = 0; g < info->num_glyphs; ++g) {
+            s16 contours = (s16)hz_woff2_read_u16(&c);
+            u32 points = 0;
+            for (s32 k = 0; k < contours; ++k) points += hz_woff2_read_255_uint16(&p);
+            if (c.error || p.error || points > flags->size) return HZ_ERROR_INVALID_FORMAT;
+            max_points = MAX(max_points, points);
+        }
+    }
+
+    info->memory = hz_malloc((info->num_glyphs + 1) * sizeof(u32) + info->num_glyphs * sizeof(s16)
+                             + max_points * (2 * sizeof(s32) + 1));
+    if (!info->memory) return HZ_ERROR_OUT_OF_MEMORY;
+    info->loca = info->memory;
+    xs = (s32 *)(info->loca + info->num_glyphs + 1);
+    ys = xs + max_points;
+    info->x_mins = (s16 *)(ys + max_points);
+    on_curve = (u8 *)(info->x_mins + info->num_glyphs);
+
+    for (g = 0; g < info->num_glyphs; ++g) {
+        s16 contours = (s16)hz_woff2_read_u16(n_contours);
+        hz_bool has_bbox = (bbox_bitmap[g >> 3] >> (7 - (g & 7))) & 1;
+        size_t glyph_start = w->size;
+        s16 bbox[4] = {0};
+
+        info->loca[g] = (u32)(glyph_start - glyf_start);
+
+        if (contours == 0) {
+            // empty glyph
+            if (has_bbox) return HZ_ERROR_INVALID_FORMAT;
+            info->x_mins[g] = 0;
+            continue;
+        }
+
+        if (contours < 0) {
+            // composite glyph, the component records are copied as is
+            size_t components_start = composites->offset;
+            hz_bool have_instructions = HZ_FALSE;
+            u16 component_flags;
+
+            if (contours != -1 || !has_bbox) return HZ_ERROR_INVALID_FORMAT;
+            for (i = 0; i < 4; ++i) bbox[i] = (s16)hz_woff2_read_u16(bboxes);
+
+            do {
+                component_flags = hz_woff2_read_u16(composites);
+                hz_woff2_read_bytes(composites, 2 + (component_flags & WOFF2_COMPOSITE_ARG_1_AND_2_ARE_WORDS ? 4 : 2));
+                if (component_flags & WOFF2_COMPOSITE_WE_HAVE_A_SCALE) hz_woff2_read_bytes(composites, 2);
+                else if (component_flags & WOFF2_COMPOSITE_WE_HAVE_AN_X_AND_Y_SCALE) hz_woff2_read_bytes(composites, 4);
+                else if (component_flags & WOFF2_COMPOSITE_WE_HAVE_A_TWO_BY_TWO) hz_woff2_read_bytes(composites, 8);
+                if (component_flags & WOFF2_COMPOSITE_WE_HAVE_INSTRUCTIONS) have_instructions = HZ_TRUE;
+            } while (!composites->error && (component_flags & WOFF2_COMPOSITE_MORE_COMPONENTS));
+            if (composites->error) return HZ_ERROR_INVALID_FORMAT;
+
+            hz_woff2_write_u16(w, (u16)contours);
+            for (i = 0; i < 4; ++i) hz_woff2_write_u16(w, (u16)bbox[i]);
+            hz_woff2_write_bytes(w, composites->data + components_start, composites->offset - components_start);
+
+            if (have_instructions) {
+                u16 length = hz_woff2_read_255_uint16(glyphs);
+                const u8 *code = hz_woff2_read_bytes(instructions, length);
+                if (!code && length) return HZ_ERROR_INVALID_FORMAT;
+                hz_woff2_write_u16(w, length);
+                hz_woff2_write_bytes(w, code, length);
+            }
+        } else {
+            // simple glyph, the bounding box is filled in once the points are known
+            u32 points = 0;
+            u16 length;
+            const u8 *point_flags, *code;
+
+            hz_woff2_write_u16(w, (u16)contours);
+            hz_woff2_write_bytes(w, bbox, sizeof(bbox));
+            for (s32 k = 0; k < contours; ++k) {
+                points += hz_woff2_read_255_uint16(n_points);
+                if (!points || points > 0x10000) return HZ_ERROR_INVALID_FORMAT;
+                hz_woff2_write_u16(w, (u16)(points - 1));
+            }
+
+            if (!(point_flags = hz_woff2_read_bytes(flags, points))) return HZ_ERROR_INVALID_FORMAT;
+            for (i = 0; i < points; ++i) {
+                s32 dx, dy;
+                if (!hz_woff2_decode_triplet(glyphs, point_flags[i] & 0x7f, &dx, &dy)) return HZ_ERROR_INVALID_FORMAT;
+                xs[i] = (i ? xs[i - 1] : 0) + dx;
+                ys[i] = (i ? ys[i - 1] : 0) + dy;
+                if (xs[i] < INT16_MIN || xs[i] > INT16_MAX || ys[i] < INT16_MIN || ys[i] > INT16_MAX)
+                    return HZ_ERROR_INVALID_FORMAT;
+                on_curve[i] = !(point_flags[i] >> 7);
+            }
+
+            length = hz_woff2_read_255_uint16(glyphs);
+            code = hz_woff2_read_bytes(instructions, length);
+            if (glyphs->error || (!code && length)) return HZ_ERROR_INVALID_FORMAT;
+            hz_woff2_write_u16(w, length);
+            hz_woff2_write_bytes(w, code, length);
+
+            hz_woff2_write_points(w, xs, ys, on_curve, points,
+                                  overlap_bitmap && ((overlap_bitmap[g >> 3] >> (7 - (g & 7))) & 1));
+
+            if (has_bbox) {
+                for (i = 0; i < 4; ++i) bbox[i] = (s16)hz_woff2_read_u16(bboxes);
+            } else if (points) {
+                s32 x_min = xs[0], y_min = ys[0], x_max = xs[0], y_max = ys[0];
+                for (i = 1; i < points; ++i) {
+                    x_min = MIN(x_min, xs[i]); x_max = MAX(x_max, xs[i]);
+                    y_min = MIN(y_min, ys[i]); y_max = MAX(y_max, ys[i]);
+                }
+                bbox[0] = (s16)x_min; bbox[1] = (s16)y_min;
+                bbox[2] = (s16)x_max; bbox[3] = (s16)y_max;
+            }
+
+            if (!w->error)
+                for (i = 0; i < 4; ++i) hz_woff2_put_u16(w->data + glyph_start + 2 + 2 * i, (u16)bbox[i]);
+        }
+
+        if (bboxes->error) return HZ_ERROR_INVALID_FORMAT;
+        info->x_mins[g] = bbox[0];
+        hz_woff2_pad4(w);
+    }
+
+    info->loca[info->num_glyphs] = (u32)(w->size - glyf_start);
+    if (info->index_format == 0 && info->loca[info->num_glyphs] > 0x1FFFE) return HZ_ERROR_INVALID_FORMAT;
+    return HZ_OK;
+}
+
+// Rebuilds hmtx from its transformed form (WOFF2 section 5.4), the left side bearings left out are the glyph x minimums.
+HZ_STATIC hz_error_t hz_woff2_reconstruct_hmtx(const u8 *data, size_t size, u32 num_hmetrics,
+                                               const hz_woff2_glyf_info_t *glyf, hz_woff2_writer_t *w)
+{
+    hz_woff2_reader_t r = hz_woff2_reader(data, size), advances, lsbs, extra_lsbs;
+    u8 flags = hz_woff2_read_u8(&r);
+    u32 i;
+
+    if (r.error || (flags & ~3) || !(flags & 3) || !num_hmetrics || num_hmetrics > glyf->num_glyphs)
+        return HZ_ERROR_INVALID_FORMAT;
+
+    advances = hz_woff2_reader(data + 1, size - 1);
+    hz_woff2_read_bytes(&r, 2 * num_hmetrics);
+    lsbs = hz_woff2_reader(data + r.offset, size - r.offset);
+    if (!(flags & 1)) hz_woff2_read_bytes(&r, 2 * num_hmetrics);
+    extra_lsbs = hz_woff2_reader(data + r.offset, size - r.offset);
+    if (!(flags & 2)) hz_woff2_read_bytes(&r, 2 * (glyf->num_glyphs - num_hmetrics));
+    if (r.error) return HZ_ERROR_INVALID_FORMAT;
+
+    for (i = 0; i < glyf->num_glyphs; ++i) {
+        if (i < num_hmetrics) {
+            hz_woff2_write_u16(w, hz_woff2_read_u16(&advances));
+            hz_woff2_write_u16(w, (flags & 1) ? (u16)glyf->x_mins[i] : hz_woff2_read_u16(&lsbs));
+        } else {
+            hz_woff2_write_u16(w, (flags & 2) ? (u16)glyf->x_mins[i] : hz_woff2_read_u16(&extra_lsbs));
+        }
+    }
+
+    return HZ_OK;
+}
+
+HZ_STATIC int hz_woff2_compare_tables(const void *a, const void *b)
+{
+    hz_tag_t x = ((const hz_woff2_table_t *)a)->tag, y = ((const hz_woff2_table_t *)b)->tag;
+    return x < y ? -1 : x > y;
+}
+
+HZ_STATIC hz_woff2_table_t *hz_woff2_find_table(hz_woff2_table_t *tables, u32 count, hz_tag_t tag)
+{
+    for (u32 i = 0; i < count; ++i)
+        if (tables[i].tag == tag) return &tables[i];
+    return NULL;
+}
+
+size_t hz_woff2_get_sfnt_size(const uint8_t *data, size_t size)
+{
+    struct hz_woff2_header hdr;
+    return hz_woff2_read_header(data, size, &hdr) ? hdr.total_sfnt_size : 0;
+}
+
+hz_error_t hz_woff2_decode(const uint8_t *data, size_t size, uint8_t *sfnt, size_t capacity, size_t *sfnt_size)
+{
+    struct hz_woff2_header hdr;
+    hz_woff2_reader_t r = hz_woff2_reader(data, size);
+    hz_woff2_writer_t w = {sfnt, capacity, 0, HZ_FALSE};
+    hz_woff2_table_t *tables, *glyf, *loca, *hmtx, *head;
+    hz_woff2_glyf_info_t glyf_info = {0};
+    u8 *stream = NULL;
+    size_t stream_size = 0, decoded_size = 0;
+    u32 i, checksum, entry_selector = 0;
+    hz_error_t error = HZ_ERROR_INVALID_FORMAT;
+
+    if (!hz_woff2_read_header(data, size, &hdr)) return HZ_ERROR_INVALID_FORMAT;
+    // font collections aren't supported
+    if (hdr.flavor == HZ_TAG('t','t','c','f')) return HZ_ERROR_INVALID_FORMAT;
+
+    r.size = hdr.length;
+    r.offset = WOFF2_HEADER_SIZE;
+    if (!(tables = hz_malloc(hdr.num_tables * sizeof(*tables)))) return HZ_ERROR_OUT_OF_MEMORY;
+
+    // table directory, the table data is concatenated in directory order in the decompressed stream
+    for (i = 0; i < hdr.num_tables; ++i) {
+        hz_woff2_table_t *t = &tables[i];
+        u8 flags = hz_woff2_read_u8(&r);
+        t->tag = (flags & 63) == 63 ? hz_woff2_read_u32(&r) : woff2_known_table_tags[flags & 63];
+        t->transform_version = flags >> 6;
+        // glyf and loca use version 3 for the null transform, other tables version 0
+        t->transformed = (t->tag == HZ_TAG('g','l','y','f') || t->tag == HZ_TAG('l','o','c','a'))
+                       ? t->transform_version != 3 : t->transform_version != 0;
+        t->orig_length = hz_woff2_read_base128(&r);
+        t->transform_length = t->transformed ? hz_woff2_read_base128(&r) : t->orig_length;
+        t->src_offset = (u32)stream_size;
+        stream_size += t->transform_length;
+        if (r.error || stream_size > WOFF2_MAX_TABLE_DATA_SIZE) goto done;
+    }
+
+    qsort(tables, hdr.num_tables, sizeof(*tables), hz_woff2_compare_tables);
+    for (i = 1; i < hdr.num_tables; ++i)
+        if (tables[i].tag == tables[i - 1].tag) goto done;
+
+    glyf = hz_woff2_find_table(tables, hdr.num_tables, HZ_TAG('g','l','y','f'));
+    loca = hz_woff2_find_table(tables, hdr.num_tables, HZ_TAG('l','o','c','a'));
+    hmtx = hz_woff2_find_table(tables, hdr.num_tables, HZ_TAG('h','m','t','x'));
+    head = hz_woff2_find_table(tables, hdr.num_tables, HZ_TAG('h','e','a','d'));
+
+    // glyf and loca are transformed together, hmtx only along with them, nothing else has a transform
+    for (i = 0; i < hdr.num_tables; ++i) {
+        hz_woff2_table_t *t = &tables[i];
+        if (!t->transformed) continue;
+        if (t == glyf || t == loca) {
+            if (t->transform_version != 0 || !glyf || !loca || !glyf->transformed || !loca->transformed) goto done;
+        } else if (t != hmtx || t->transform_version != 1 || !glyf || !glyf->transformed) {
+            goto done;
+        }
+    }
+    if (loca && loca->transformed && loca->transform_length) goto done;
+    if (!head || head->orig_length < 54) goto done;
+
+    {
+        const u8 *compressed = hz_woff2_read_bytes(&r, hdr.total_compressed_size);
+        if (!compressed) goto done;
+        if (!(stream = hz_malloc(stream_size ? stream_size : 1))) {
+            error = HZ_ERROR_OUT_OF_MEMORY;
+            goto done;
+        }
+        error = hz_brotli_decompress(compressed, hdr.total_compressed_size, stream, stream_size, &decoded_size);
+        if (error != HZ_OK) goto done;
+        error = HZ_ERROR_INVALID_FORMAT;
+        if (decoded_size != stream_size) goto done;
+    }
+
+    // offset table, the directory is filled in at the end
+    while ((2u << entry_selector) <= hdr.num_tables) ++entry_selector;
+    hz_woff2_write_u32(&w, hdr.flavor);
+    hz_woff2_write_u16(&w, hdr.num_tables);
+    hz_woff2_write_u16(&w, (u16)(16u << entry_selector));
+    hz_woff2_write_u16(&w, (u16)entry_selector);
+    hz_woff2_write_u16(&w, (u16)(hdr.num_tables * 16u - (16u << entry_selector)));
+    for (i = 0; i < hdr.num_tables * 4u; ++i) hz_woff2_write_u32(&w, 0);
+
+    // tables in tag order, which reconstructs glyf before hmtx and loca depend on it
+    for (i = 0; i < hdr.num_tables && !w.error; ++i) {
+        hz_woff2_table_t *t = &tables[i];
+        const u8 *src = stream + t->src_offset;
+
+        t->dst_offset = (u32)w.size;
+        if (t == glyf && t->transformed) {
+            if ((error = hz_woff2_reconstruct_glyf(src, t->transform_length, &w, &glyf_info)) != HZ_OK) goto done;
+            error = HZ_ERROR_INVALID_FORMAT;
+        } else if (t == loca && t->transformed) {
+            for (u32 g = 0; g <= glyf_info.num_glyphs; ++g) {
+                if (glyf_info.index_format) hz_woff2_write_u32(&w, glyf_info.loca[g]);
+                else hz_woff2_write_u16(&w, (u16)(glyf_info.loca[g] >> 1));
+            }
+        } else if (t == hmtx && t->transformed) {
+            hz_woff2_table_t *hhea = hz_woff2_find_table(tables, hdr.num_tables, HZ_TAG('h','h','e','a'));
+            u32 num_hmetrics;
+            if (!hhea || hhea->orig_length < 36) goto done;
+            num_hmetrics = (u32)stream[hhea->src_offset + 34] << 8 | stream[hhea->src_offset + 35];
+            if ((error = hz_woff2_reconstruct_hmtx(src, t->transform_length, num_hmetrics, &glyf_info, &w)) != HZ_OK)
+                goto done;
+            error = HZ_ERROR_INVALID_FORMAT;
+        } else {
+            hz_woff2_write_bytes(&w, src, t->orig_length);
+        }
+
+        t->dst_length = (u32)(w.size - t->dst_offset);
+        hz_woff2_pad4(&w);
+    }
+
+    if (w.error) {
+        error = HZ_ERROR_INVALID_PARAM;
+        goto done;
+    }
+
+    // indexToLocFormat has to agree with the reconstructed loca
+    if (glyf && glyf->transformed
+    && ((u32)sfnt[head->dst_offset + 50] << 8 | sfnt[head->dst_offset + 51]) != glyf_info.index_format)
+        goto done;
+
+    hz_woff2_put_u32(sfnt + head->dst_offset + 8, 0); // checkSumAdjustment
+    checksum = 0;
+    for (i = 0; i < hdr.num_tables; ++i) {
+        hz_woff2_table_t *t = &tables[i];
+        u8 *record = sfnt + 12 + 16 * i;
+        t->checksum = hz_woff2_checksum(sfnt + t->dst_offset, (t->dst_length + 3) & ~3u);
+        hz_woff2_put_u32(record, t->tag);
+        hz_woff2_put_u32(record + 4, t->checksum);
+        hz_woff2_put_u32(record + 8, t->dst_offset);
+        hz_woff2_put_u32(record + 12, t->dst_length);
+        checksum += t->checksum;
+    }
+    checksum += hz_woff2_checksum(sfnt, 12 + 16 * hdr.num_tables);
+    hz_woff2_put_u32(sfnt + head->dst_offset + 8, 0xB1B0AFBA - checksum);
+
+    *sfnt_size = w.size;
+    error = HZ_OK;
+
+done:
+    if (glyf_info.memory) hz_free(glyf_info.memory);
+    if (stream) hz_free(stream);
+    hz_free(tables);
+    return error;
+}
+
+// Decodes a WOFF2 file from memory into a new font, which owns the decoded font data.
+hz_font_t *hz_font_load_woff2_from_memory(const uint8_t *data, size_t size)
+{
+    size_t capacity = hz_woff2_get_sfnt_size(data, size), sfnt_size;
+    u8 *storage;
+    stbtt_fontinfo *info;
+    hz_font_t *font;
+
+    if (!capacity || !(storage = hz_malloc(sizeof(stbtt_fontinfo) + capacity))) return NULL;
+
+    info = (stbtt_fontinfo *)storage;
+    if (hz_woff2_decode(data, size, storage + sizeof(stbtt_fontinfo), capacity, &sfnt_size) != HZ_OK
+    || !stbtt_InitFont(info, storage + sizeof(stbtt_fontinfo), 0)) {
+        hz_free(storage);
+        return NULL;
+    }
+
+    if (!(font = hz_stbtt_font_create(info))) {
+        hz_free(storage);
+        return NULL;
+    }
+
+    font->storage = storage;
+    return font;
+}
+
+#define HZ_BASE85_VALIDATE_CHARS
+
+/* The Base85/Ascii85 decoder is based on the RFC 1924
+ * version of the encoding: https://datatracker.ietf.org/doc/html/rfc1924,
+ * The character set is as follows:
+ *      0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz!#$%&()*+-;<=>?@^_`{|}~
+ */
+static const s32 base85_alphabet_rfc_1924[127] = {
+    [0 ... 32] = -1,
+    [33] = 62,-1,63,64,65,66,-1,67,68,69,70,-1,71,-1,-1,0,1,2,3,4,5,6,7,8,9,-1,72,73,74,75,76,77,
+    10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,
+    -1,-1,-1, 78,79,80,
+    36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,
+    81,82,84,84
+};
+
+enum base85_error {
+    BASE85_OVERFLOW = -1,
+    BASE85_INVALID_CHARS = -2,
+};
+
+s32 hz_base85_max_size(const s8 *const inp, s32 *restrict max_outp_sz)
+{
+    s32 inp_sz = strlen(inp);
+    *max_outp_sz = ((inp_sz + 3) / 4) * 5;
+    return inp_sz;
+}
+
+s32 base85_char_ng(s8 c)
+{
+    return ((c < 33u) || (c > 117u));
+}
+
+static s32 decode_base85_adobe(u8 *restrict outp, s32 max_outp_sz, const s8 *const inp, s32 inp_sz)
+{
+    s32 outp_sz = 0, i = 0;
+    u32 chunk;
+
+    while (i < inp_sz) {
+        s32 chunk_sz = inp_sz - i;
+        if (inp[i] == (u8)' ') {
+            ++i; continue; // ignore whitespace
+        } else if (inp[i] == (u8)'z') {
+            ++i;
+            chunk = 0;
+            chunk_sz = 5;
+        }
+        else if (base85_char_ng(inp[i])
             || ((chunk_sz > 1) && base85_char_ng(inp[i+1]))
             || ((chunk_sz > 2) && base85_char_ng(inp[i+2]))
             || ((chunk_sz > 3) && base85_char_ng(inp[i+3]))
@@ -2781,9 +4610,12 @@ static s32 decode_base85_adobe(u8 *restrict outp, s32 max_outp_sz, const s8 *con
 
 hz_font_t *hz_font_load_woff2_from_memory_base85(enum hz_base85_encoding encoding, const char *base85_string)
 {
-    s32 max_outp_sz, inp_sz, sz;
+    s32 max_outp_sz, inp_sz, sz = 0;
+    hz_font_t *font;
     inp_sz = hz_base85_max_size((const s8* const)base85_string, &max_outp_sz);
     u8 *decoded = hz_malloc(max_outp_sz);
+    if (decoded == NULL) return NULL;
+
     switch (encoding) {
         default:break;
         case HZ_BASE85_ENCODING_ADOBE:
@@ -2794,11 +4626,9 @@ hz_font_t *hz_font_load_woff2_from_memory_base85(enum hz_base85_encoding encodin
         case HZ_BASE85_ENCODING_IPV6: /*No Impl*/
         break;
     }
-    printf("%d\n", sz);//danger!
-    
-    hz_font_load_woff2_from_memory(decoded, sz);
+    font = sz > 0 ? hz_font_load_woff2_from_memory(decoded, sz) : NULL;
     hz_free(decoded);
-    return NULL;
+    return font;
 }
 
 uint16_t
@@ -2913,15 +4743,34 @@ typedef struct {
     int16_t yPlacement;
     int16_t xAdvance;
     int16_t yAdvance;
-    Offset16 xPlaDeviceOffset;
-    Offset16 yPlaDeviceOffset;
-    Offset16 xAdvDeviceOffset;
-    Offset16 yAdvDeviceOffset;
+    // delta-set indices of the device tables that vary the values, see <hz_read_variation_index>
+    uint32_t xPlaVarIndex;
+    uint32_t yPlaVarIndex;
+    uint32_t xAdvVarIndex;
+    uint32_t yAdvVarIndex;
 } hz_value_record_t;
 
+#define HZ_NO_VARIATION_INDEX 0xFFFFFFFFu
+
+// Reads the delta-set index (outer << 16 | inner) of the VariationIndex table at offset from table_start,
+// HZ_NO_VARIATION_INDEX if there's none. Other device tables only adjust hinted sizes and are ignored.
+HZ_STATIC uint32_t
+hz_read_variation_index(hz_parser_t *p, size_t table_start, Offset16 offset)
+{
+    if (offset) {
+        const uint8_t *device = p->mem + table_start + offset;
+        if (hz_load_u16be(device + 4) == 0x8000)
+            return (uint32_t)hz_load_u16be(device) << 16 | hz_load_u16be(device + 2);
+    }
+
+    return HZ_NO_VARIATION_INDEX;
+}
 
+// Device offsets of a value record are from the start of the subtable holding it, table_start.
 static void
-hz_read_value_record(hz_parser_t *p, hz_value_record_t *record, uint16_t valueFormat) {
+hz_read_value_record(hz_parser_t *p, hz_value_record_t *record, uint16_t valueFormat, size_t table_start) {
+    record->xPlaVarIndex = record->yPlaVarIndex = HZ_NO_VARIATION_INDEX;
+    record->xAdvVarIndex = record->yAdvVarIndex = HZ_NO_VARIATION_INDEX;
 
     if (valueFormat & HZ_VALUE_FORMAT_X_PLACEMENT)
         record->xPlacement = (int16_t) hz_parser_read_u16(p);
@@ -2936,16 +4785,16 @@ hz_read_value_record(hz_parser_t *p, hz_value_record_t *record, uint16_t valueFo
         record->yAdvance  = (int16_t) hz_parser_read_u16(p);
 
     if (valueFormat & HZ_VALUE_FORMAT_X_PLACEMENT_DEVICE)
-        record->xPlaDeviceOffset = hz_parser_read_u16(p);
+        record->xPlaVarIndex = hz_read_variation_index(p, table_start, hz_parser_read_u16(p));
 
     if (valueFormat & HZ_VALUE_FORMAT_Y_PLACEMENT_DEVICE)
-        record->yPlaDeviceOffset = hz_parser_read_u16(p);
+        record->yPlaVarIndex = hz_read_variation_index(p, table_start, hz_parser_read_u16(p));
 
     if (valueFormat & HZ_VALUE_FORMAT_X_ADVANCE_DEVICE)
-        record->xAdvDeviceOffset = hz_parser_read_u16(p);
+        record->xAdvVarIndex = hz_read_variation_index(p, table_start, hz_parser_read_u16(p));
 
     if (valueFormat & HZ_VALUE_FORMAT_Y_ADVANCE_DEVICE)
-        record->yAdvDeviceOffset = hz_parser_read_u16(p);
+        record->yAdvVarIndex = hz_read_variation_index(p, table_start, hz_parser_read_u16(p));
 }
 
 typedef struct hz_ot_single_pos_format1_table_t {
@@ -2967,6 +4816,7 @@ typedef struct hz_entry_exit_record_t {
 
 typedef struct {
     int16_t x_coord, y_coord;
+    uint32_t x_var_index, y_var_index; // format 3 anchors can vary
 } hz_anchor_t;
 
 typedef struct {
@@ -3169,6 +5019,15 @@ hz_read_anchor(hz_parser_t *p) {
     HZ_ASSERT(format >= 1 && format <= 3);
     anchor.x_coord = hz_parser_read_u16(p);
     anchor.y_coord = hz_parser_read_u16(p);
+    anchor.x_var_index = anchor.y_var_index = HZ_NO_VARIATION_INDEX;
+
+    if (format == 3) {
+        Offset16 x_device_offset = hz_parser_read_u16(p);
+        Offset16 y_device_offset = hz_parser_read_u16(p);
+        anchor.x_var_index = hz_read_variation_index(p, p->start, x_device_offset);
+        anchor.y_var_index = hz_read_variation_index(p, p->start, y_device_offset);
+    }
+
     return anchor;
 }
 
@@ -3310,41 +5169,33 @@ hz_ot_is_complex_script(hz_script_t script)
 HZ_STATIC void
 hz_auto_load_script_features(hz_memory_arena_t *memory_arena, hz_script_t script, hz_feature_t **featuresptr, unsigned int *countptr)
 {
-    unsigned int i, j, inclmask;
+    /* standard scripts (Latin, Cyrillic, Greek, etc), and complex scripts without a table yet */
+    const hz_feature_layout_op_t *ops = simple_script_feature_orders;
+    size_t num_ops = HZ_ARRAY_SIZE(simple_script_feature_orders);
+    unsigned int i, j, f, cnt = 0;
 
-    inclmask = HZ_FEATURE_FLAG_REQUIRED | HZ_FEATURE_FLAG_ALWAYS_APPLIED
-        | HZ_FEATURE_FLAG_ON_BY_DEFAULT;
-
-    if (hz_ot_is_complex_script(script)) {
-        for (i=0; i<HZ_ARRAY_SIZE(complex_script_feature_orders); ++i) {
-            hz_script_feature_order_t order = complex_script_feature_orders[i];
-            if (order.script == script) {
-                unsigned int cnt = 0;
-
-                // count required, on by default and always applied features
-                for (j=0;j<order.num_ops;++j)
-                    if (order.ops[j].flags & inclmask)
-                        ++cnt;
+    for (i=0; i<HZ_ARRAY_SIZE(complex_script_feature_orders); ++i) {
+        if (complex_script_feature_orders[i].script == script) {
+            ops = complex_script_feature_orders[i].ops;
+            num_ops = complex_script_feature_orders[i].num_ops;
+            break;
+        }
+    }
 
-                if (cnt) {
-                    unsigned int f;
-                    *featuresptr = hz_memory_arena_alloc(memory_arena, cnt * sizeof(hz_feature_t));
-                    *countptr = cnt;
+    // count every feature but the ones which have to be turned on by the user
+    for (j=0;j<num_ops;++j)
+        if (!(ops[j].flags & HZ_FEATURE_FLAG_OFF_BY_DEFAULT))
+            ++cnt;
 
-                    // again, go over the list and copy features
-                    for (j=f=0; f<cnt && j<order.num_ops; ++j) {
-                        if (order.ops[j].flags & inclmask) {
-                            (*featuresptr)[f] = order.ops[j].feature;
-                            ++f;
-                        }
-                    }
-                }
+    *featuresptr = hz_memory_arena_alloc(memory_arena, cnt * sizeof(hz_feature_t));
+    *countptr = cnt;
 
-                break;
-            }
+    // again, go over the list and copy features
+    for (j=f=0; f<cnt && j<num_ops; ++j) {
+        if (!(ops[j].flags & HZ_FEATURE_FLAG_OFF_BY_DEFAULT)) {
+            (*featuresptr)[f] = ops[j].feature;
+            ++f;
         }
-    } else {
-        /* standard scripts (Latin, Cyrillic, Greek, etc) */
     }
 }
 
@@ -3387,7 +5238,8 @@ typedef enum {
 
 typedef enum hz_cmap_subtable_format_t {
     HZ_CMAP_SUBTABLE_FORMAT_BYTE_ENCODING_TABLE = 0,
-    HZ_CMAP_SUBTABLE_FORMAT_SEGMENT_MAPPING_TO_DELTA_VALUES = 4
+    HZ_CMAP_SUBTABLE_FORMAT_SEGMENT_MAPPING_TO_DELTA_VALUES = 4,
+    HZ_CMAP_SUBTABLE_FORMAT_SEGMENTED_COVERAGE = 12
 } hz_cmap_subtable_format_t;
 
 typedef struct {
@@ -3494,6 +5346,21 @@ void hz_deinit(void)
 #define HZ_NAKEDFN
 #endif
 
+// Binary search of the sequential map groups of a format 12 subtable, 12 bytes each.
+HZ_STATIC hz_index_t hz_cmap_format12_lookup(const uint8_t *groups, uint32_t num_groups, hz_unicode_t codepoint)
+{
+    uint32_t lo = 0, hi = num_groups;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        const uint8_t *group = groups + 12 * mid;
+        if (codepoint < hz_load_u32be(group)) hi = mid;
+        else if (codepoint > hz_load_u32be(group + 4)) lo = mid + 1;
+        else return (hz_index_t)(hz_load_u32be(group + 8) + (codepoint - hz_load_u32be(group)));
+    }
+
+    return 0; // map to .notdef
+}
+
 HZ_STATIC void
 hz_apply_cmap_format4_subtable(hz_cmap_format4_subtable_t *subtable,
                                hz_index_t glyph_indices[],
@@ -3552,6 +5419,18 @@ hz_apply_cmap_encoding(hz_parser_t *p,
             hz_free(cmapSubtable.idDelta);
             hz_free(cmapSubtable.idRangeOffsets);
 
+            break;
+        }
+        case HZ_CMAP_SUBTABLE_FORMAT_SEGMENTED_COVERAGE: {
+            hz_parser_read_u16(p); // reserved
+            hz_parser_read_u32(p); // length
+            hz_parser_read_u32(p); // language
+            uint32_t num_groups = hz_parser_read_u32(p);
+            const uint8_t *groups = hz_parser_at_cursor(p);
+
+            for (size_t i = 0; i < size; ++i)
+                glyphIndices[i] = hz_cmap_format12_lookup(groups, num_groups, codepoints[i]);
+
             break;
         }
     }
@@ -3559,29 +5438,194 @@ hz_apply_cmap_encoding(hz_parser_t *p,
     hz_parser_pop_state(p);
 }
 
+// Picks the subtable used to map codepoints, preferring full repertoire format 12 subtables over BMP only
+// format 4 ones. Encodings are ranked as in the OpenType recommendations, formats we can't read are skipped.
+HZ_STATIC void hz_face_select_cmap_subtable(hz_face_t *face)
+{
+    face->cmap_subtable = 0;
+    if (!face->cmap) return;
+
+    const uint8_t *cmap = face->data + face->cmap;
+    uint16_t num_encodings = hz_load_u16be(cmap + 2);
+    int best_rank = 0;
+
+    for (uint16_t i = 0; i < num_encodings; ++i) {
+        const uint8_t *record = cmap + 4 + 8 * i;
+        uint16_t platform_id = hz_load_u16be(record), encoding_id = hz_load_u16be(record + 2);
+        uint32_t offset = hz_load_u32be(record + 4);
+        uint16_t format = hz_load_u16be(cmap + offset);
+        int rank = 0;
+
+        if (format == HZ_CMAP_SUBTABLE_FORMAT_SEGMENTED_COVERAGE) {
+            if (platform_id == 3 && encoding_id == 10) rank = 5;
+            else if (platform_id == 0 && encoding_id == 6) rank = 4;
+            else if (platform_id == 0 && encoding_id == 4) rank = 3;
+        } else if (format == HZ_CMAP_SUBTABLE_FORMAT_SEGMENT_MAPPING_TO_DELTA_VALUES) {
+            if (platform_id == 3 && encoding_id == 1) rank = 2;
+            else if (platform_id == 0 && encoding_id == 3) rank = 1;
+        }
+
+        if (rank > best_rank) {
+            best_rank = rank;
+            face->cmap_subtable = offset;
+        }
+    }
+}
+
 HZ_STATIC void
 hz_map_to_nominal_forms(hz_face_t *face,
                         hz_index_t glyph_indices[],
                         hz_unicode_t codepoints[],
                         size_t size)
 {
+    if (!face->cmap_subtable) {
+        hz_zero(glyph_indices, sizeof(hz_index_t) * size);
+        return;
+    }
+
     hz_parser_t p = hz_parser_create(face->data + face->cmap);
-    uint16_t version = hz_parser_read_u16(&p);
+    hz_cmap_encoding_t encoding = {0};
+    encoding.subtable_offset = face->cmap_subtable;
+    hz_apply_cmap_encoding(&p, encoding, glyph_indices, codepoints, size);
+}
+
+#define HZ_CODEPOINT_SET_PAGE_COUNT (0x110000 >> 8)
+#define HZ_CODEPOINT_SET_EMPTY_PAGE 0
+#define HZ_CODEPOINT_SET_FULL_PAGE 1
 
-    // Table version number must be 0
-    HZ_ASSERT(version == 0);
+// Sparse bitset of codepoints split into pages of 256, each page indexes 8 words of bits. Pages without any
+// codepoint share the empty page and pages with all of them share the full page, so a lookup is always two loads.
+typedef struct {
+    uint16_t pages[HZ_CODEPOINT_SET_PAGE_COUNT];
+    hz_vector(uint32_t) words;
+} hz_codepoint_set_t;
 
-    uint16_t num_encodings, enc_idx;
-    num_encodings = hz_parser_read_u16(&p);
+HZ_STATIC void hz_codepoint_set_init(hz_codepoint_set_t *set)
+{
+    HZ_MEMSET(set->pages, 0, sizeof(set->pages));
+    set->words = NULL;
+    hz_vector_resize(set->words, 16);
+    HZ_MEMSET(set->words, 0x00, 8 * sizeof(uint32_t));
+    HZ_MEMSET(set->words + 8, 0xff, 8 * sizeof(uint32_t));
+}
 
-    {
-        hz_cmap_encoding_t encoding = {0};
-        encoding.platform_id = hz_parser_read_u16(&p);
-        encoding.encoding_id = hz_parser_read_u16(&p);
-        encoding.subtable_offset = hz_parser_read_u32(&p);
+HZ_STATIC void hz_codepoint_set_release(hz_codepoint_set_t *set)
+{
+    hz_vector_destroy(set->words);
+}
+
+HZ_STATIC HZ_ALWAYS_INLINE hz_bool hz_codepoint_set_contains(const hz_codepoint_set_t *set, hz_unicode_t c)
+{
+    return c < 0x110000 && ((set->words[set->pages[c >> 8] * 8 + ((c >> 5) & 7)] >> (c & 31)) & 1);
+}
+
+HZ_STATIC void hz_codepoint_set_add_range(hz_codepoint_set_t *set, hz_unicode_t first, hz_unicode_t last)
+{
+    last = MIN(last, 0x10FFFF);
+    while (first <= last) {
+        uint32_t page = first >> 8;
+        hz_unicode_t page_last = MIN(last, first | 0xff);
+
+        if (set->pages[page] != HZ_CODEPOINT_SET_FULL_PAGE) {
+            if (!(first & 0xff) && (page_last & 0xff) == 0xff) {
+                set->pages[page] = HZ_CODEPOINT_SET_FULL_PAGE;
+            } else {
+                if (set->pages[page] == HZ_CODEPOINT_SET_EMPTY_PAGE) {
+                    size_t words = hz_vector_size(set->words);
+                    set->pages[page] = (uint16_t)(words / 8);
+                    hz_vector_resize(set->words, words + 8);
+                    HZ_MEMSET(set->words + words, 0, 8 * sizeof(uint32_t));
+                }
+
+                uint32_t *bits = set->words + set->pages[page] * 8;
+                for (hz_unicode_t c = first; c <= page_last; ++c)
+                    bits[(c >> 5) & 7] |= 1u << (c & 31);
+            }
+        }
+
+        first = page_last + 1;
+    }
+}
+
+// Folds pages which got filled a range at a time into the full page and packs the remaining ones.
+HZ_STATIC void hz_codepoint_set_compact(hz_codepoint_set_t *set)
+{
+    hz_vector(uint32_t) words = NULL;
+    hz_vector_push_many(words, set->words, 16);
+
+    for (size_t p = 0; p < HZ_CODEPOINT_SET_PAGE_COUNT; ++p) {
+        if (set->pages[p] <= HZ_CODEPOINT_SET_FULL_PAGE) continue;
+
+        const uint32_t *bits = set->words + set->pages[p] * 8;
+        uint32_t all = bits[0] & bits[1] & bits[2] & bits[3] & bits[4] & bits[5] & bits[6] & bits[7];
+        if (all == 0xffffffff) {
+            set->pages[p] = HZ_CODEPOINT_SET_FULL_PAGE;
+        } else {
+            set->pages[p] = (uint16_t)(hz_vector_size(words) / 8);
+            hz_vector_push_many(words, bits, 8);
+        }
+    }
+
+    hz_vector_destroy(set->words);
+    set->words = words;
+}
+
+// Adds every codepoint the face maps to a glyph other than .notdef, reading the subtable hz_map_to_nominal_forms
+// maps with so the set agrees with shaping.
+HZ_STATIC void hz_codepoint_set_add_cmap(hz_codepoint_set_t *set, hz_face_t *face)
+{
+    if (!face->cmap_subtable) return;
 
-        hz_apply_cmap_encoding(&p, encoding, glyph_indices, codepoints, size);
+    const uint8_t *subtable = face->data + face->cmap + face->cmap_subtable;
+    switch (hz_load_u16be(subtable)) {
+        default: break;
+        case HZ_CMAP_SUBTABLE_FORMAT_SEGMENT_MAPPING_TO_DELTA_VALUES: {
+            uint16_t seg_count = hz_load_u16be(subtable + 6) / 2;
+            const uint8_t *end_codes = subtable + 14;
+            const uint8_t *start_codes = end_codes + 2 * seg_count + 2; // after reservedPad
+            const uint8_t *id_deltas = start_codes + 2 * seg_count;
+            const uint8_t *id_range_offsets = id_deltas + 2 * seg_count;
+
+            for (uint16_t i = 0; i < seg_count; ++i) {
+                uint32_t start = hz_load_u16be(start_codes + 2 * i), end = hz_load_u16be(end_codes + 2 * i);
+                uint16_t id_delta = hz_load_u16be(id_deltas + 2 * i);
+                uint16_t id_range_offset = hz_load_u16be(id_range_offsets + 2 * i);
+                if (start > end) continue;
+
+                if (!id_range_offset) {
+                    // maps to c + delta, which wraps to .notdef for at most one codepoint
+                    uint32_t notdef = (uint16_t)-id_delta;
+                    if (notdef < start || notdef > end) {
+                        hz_codepoint_set_add_range(set, start, end);
+                    } else {
+                        if (notdef > start) hz_codepoint_set_add_range(set, start, notdef - 1);
+                        if (notdef < end) hz_codepoint_set_add_range(set, notdef + 1, end);
+                    }
+                } else {
+                    const uint8_t *ids = id_range_offsets + 2 * i + id_range_offset;
+                    for (uint32_t c = start; c <= end; ++c) {
+                        uint16_t id = hz_load_u16be(ids + 2 * (c - start));
+                        if (id && (uint16_t)(id + id_delta)) hz_codepoint_set_add_range(set, c, c);
+                    }
+                }
+            }
+            break;
+        }
+        case HZ_CMAP_SUBTABLE_FORMAT_SEGMENTED_COVERAGE: {
+            uint32_t num_groups = hz_load_u32be(subtable + 12);
+            const uint8_t *groups = subtable + 16;
+
+            for (uint32_t i = 0; i < num_groups; ++i) {
+                uint32_t start = hz_load_u32be(groups + 12 * i), end = hz_load_u32be(groups + 12 * i + 4);
+                // only the first codepoint of a group starting at glyph 0 maps to .notdef
+                if (!hz_load_u32be(groups + 12 * i + 8)) ++start;
+                if (start <= end) hz_codepoint_set_add_range(set, start, end);
+            }
+            break;
+        }
     }
+
+    hz_codepoint_set_compact(set);
 }
 
 HZ_STATIC void
@@ -3589,18 +5633,11 @@ hz_mirror_uc_symbols(hz_vector(hz_unicode_t) v)
 {
     for (size_t i = 0; i < hz_vector_size(v); ++i) {
         switch (v[i]) {
-            case '(': v[i] = ')'; break;
-            case ')': v[i] = '('; break;
-            case '[': v[i] = ']'; break;
-            case ']': v[i] = '['; break;
-            case '{': v[i] = '}'; break;
-            case '}': v[i] = '{'; break;
-            case '<': v[i] = '>'; break;
-            case '>': v[i] = '<'; break;
+            // reversed punctuation, which Bidi_Mirroring_Glyph doesn't pair
             case ',': v[i] = 0x2E41; break; // reversed comma
-//            case ',': v[i] = 0x060C; break; // arabic comma U+060C
             case ';': v[i] = 0x204F; break; // reversed semicolon
             case '?': v[i] = 0x2E2E; break; // reversed question mark
+            default: v[i] = hz_ucd_mirror(v[i]); break;
         }
     }
 }
@@ -3679,6 +5716,18 @@ void hz_buffer_copy_attribs(hz_buffer_t *b1, hz_buffer_t *b2)
     if (b2->attrib_flags & HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT) {
         hz_vector_push_many(b1->component_indices, b2->component_indices, b2->glyph_count);
     }
+    if (b2->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT) {
+        hz_vector_push_many(b1->clusters, b2->clusters, b2->glyph_count);
+    }
+    if (b2->attrib_flags & HZ_GLYPH_ATTRIB_FLAGS_BIT) {
+        hz_vector_push_many(b1->glyph_flags, b2->glyph_flags, b2->glyph_count);
+    }
+    if (b2->attrib_flags & HZ_GLYPH_ATTRIB_FONT_INDEX_BIT) {
+        hz_vector_push_many(b1->font_indices, b2->font_indices, b2->glyph_count);
+    }
+    if (b2->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT) {
+        hz_vector_push_many(b1->joining_forms, b2->joining_forms, b2->glyph_count);
+    }
 
     b1->glyph_count = b2->glyph_count;
 }
@@ -3759,15 +5808,31 @@ hz_buffer_flip_direction(hz_buffer_t *buffer)
         hz_swap_buffer_elements(buffer->component_indices,len,sizeof(uint16_t));
     }
 
-    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_METRICS_BIT) {
-        hz_swap_buffer_elements(buffer->glyph_metrics,len,sizeof(hz_glyph_metrics_t));
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT) {
+        hz_swap_buffer_elements(buffer->clusters,len,sizeof(uint32_t));
     }
-}
 
-hz_bool hz_buffer_contains_range(const hz_buffer_t *buf, int v1, int v2) {
-    size_t size = hz_vector_size(buf->glyph_indices);
-    return v1 >= 0 && v1 < size
-    && v2 >= 0 && v2 < size
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_FLAGS_BIT) {
+        hz_swap_buffer_elements(buffer->glyph_flags,len,sizeof(uint8_t));
+    }
+
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_FONT_INDEX_BIT) {
+        hz_swap_buffer_elements(buffer->font_indices,len,sizeof(uint16_t));
+    }
+
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT) {
+        hz_swap_buffer_elements(buffer->joining_forms,len,sizeof(uint8_t));
+    }
+
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_METRICS_BIT) {
+        hz_swap_buffer_elements(buffer->glyph_metrics,len,sizeof(hz_glyph_metrics_t));
+    }
+}
+
+hz_bool hz_buffer_contains_range(const hz_buffer_t *buf, int v1, int v2) {
+    size_t size = hz_vector_size(buf->glyph_indices);
+    return v1 >= 0 && v1 < size
+    && v2 >= 0 && v2 < size
     && v2 >= v1;
 }
 
@@ -3789,6 +5854,14 @@ hz_buffer_t *hz_buffer_copy_range(hz_buffer_t *from, int v1, int v2){
             hz_vector_push_many(to->attachment_classes, from->attachment_classes + v1, len);
         if (from->attrib_flags & HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT)
             hz_vector_push_many(to->component_indices, from->component_indices + v1, len);
+        if (from->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT)
+            hz_vector_push_many(to->clusters, from->clusters + v1, len);
+        if (from->attrib_flags & HZ_GLYPH_ATTRIB_FLAGS_BIT)
+            hz_vector_push_many(to->glyph_flags, from->glyph_flags + v1, len);
+        if (from->attrib_flags & HZ_GLYPH_ATTRIB_FONT_INDEX_BIT)
+            hz_vector_push_many(to->font_indices, from->font_indices + v1, len);
+        if (from->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT)
+            hz_vector_push_many(to->joining_forms, from->joining_forms + v1, len);
 
         to->glyph_count = len;
 
@@ -3841,9 +5914,15 @@ typedef struct {
     hz_feature_list_item_t *features;
 } hz_gpos_table_t;
 
+#define HZ_AUTO_SHAPER_CACHE_SIZE 4 // shapers of hz_shape_auto kept per font data, by script and language
 
 struct hz_font_data_t {
     hz_face_t *face;
+    hz_font_t *font; // its variations select the instance shaped with
+    // Written while shaping a variable font, so a font data is used by one thread at a time; the face
+    // stays read-only and can be shared by the font data of every thread.
+    hz_variation_instance_t *instances[HZ_VARIATION_CACHE_SIZE]; // most recently used first
+    hz_shaper_t *auto_shapers[HZ_AUTO_SHAPER_CACHE_SIZE]; // most recently used first
     uint8_t *memory_arena_data;
     hz_memory_arena_t memory_arena;
     hz_allocator_t allocator;
@@ -3854,6 +5933,21 @@ struct hz_font_data_t {
 
 #define HZ_SHAPER_ARENA_SIZE 5000
 
+// Glyphs the marks of a buffer attach to, -1 where there is none. Positioning keeps the glyph classes,
+// so they are found once per buffer instead of searching backwards from every mark of every lookup.
+typedef struct hz_mark_attachments_t {
+    int32_t *bases; // base a mark attaches to, past the marks before it
+    int32_t *ligatures; // ligature a mark attaches to, past the marks before it
+    int32_t *marks; // mark right before a mark
+    int32_t *batch; // scratch for the placements of a subtable, 4 entries per glyph
+} hz_mark_attachments_t;
+
+typedef struct hz_lookup_reference_t {
+    uint16_t index;
+    hz_feature_t feature;
+    hz_tag_t type;
+} hz_lookup_reference_t;
+
 struct hz_shaper_t {
     uint8_t ar [HZ_SHAPER_ARENA_SIZE]; // used to store the feature list
     hz_memory_arena_t memory_arena;
@@ -3863,10 +5957,20 @@ struct hz_shaper_t {
     hz_script_t script;
     hz_language_t language;
     hz_shaper_flags_t flags;
+    uint8_t *unsafe_to_break; // per source character, only set while a buffer is being shaped
+    const hz_variation_instance_t *instance; // instance of the font being shaped with, NULL at the default
+    const hz_mark_attachments_t *attachments; // of the buffer being positioned, only set during GPOS
+    // scratch kept between buffers, so shaping text no longer than before doesn't allocate
+    hz_lookup_reference_t *lookup_refs;
+    size_t lookup_ref_capacity;
+    int32_t *attachment_data; // 7 entries per glyph, see hz_mark_attachments_compute
+    size_t attachment_capacity; // in glyphs
+    const hz_ucd_t *ucd; // character properties, NULL for the newest UCD version
 };
 
 hz_shaper_t *hz_shaper_create() {
     hz_shaper_t *s = hz_malloc(sizeof(*s));
+    if (s == NULL) return NULL;
     *s = (hz_shaper_t){
         .direction = HZ_DIRECTION_LTR,
         .script = HZ_SCRIPT_LATIN,
@@ -3878,9 +5982,28 @@ hz_shaper_t *hz_shaper_create() {
 }
 
 void hz_shaper_destroy(hz_shaper_t *shaper){
+    if (shaper->lookup_refs) hz_free(shaper->lookup_refs);
+    if (shaper->attachment_data) hz_free(shaper->attachment_data);
     hz_free(shaper);
 }
 
+// Grows a scratch array of the shaper to at least count elements of elem_size bytes and returns it, or NULL
+// if it can't be allocated, in which case the old array is kept. The contents aren't copied over.
+HZ_STATIC void *hz_shaper_reserve_scratch(void *data, size_t *capacity, size_t count, size_t elem_size)
+{
+    if (count <= *capacity) return data;
+
+    size_t new_capacity = HZ_MAX(count, *capacity + *capacity / 2);
+    if (new_capacity > SIZE_MAX / elem_size) return NULL;
+
+    void *new_data = hz_malloc(new_capacity * elem_size);
+    if (new_data == NULL) return NULL;
+
+    if (data) hz_free(data);
+    *capacity = new_capacity;
+    return new_data;
+}
+
 void hz_shaper_set_features(hz_shaper_t *shaper, size_t sz,
                                 const hz_feature_t features[])
 {
@@ -3907,11 +6030,14 @@ void hz_shaper_set_language(hz_shaper_t *shaper, hz_language_t language) {
     shaper->language = language;
 }
 
+void hz_shaper_set_ucd(hz_shaper_t *shaper, const hz_ucd_t *ucd) {
+    shaper->ucd = ucd;
+}
+
 HZ_STATIC void hz_load_feature_table(hz_memory_arena_t *memory_arena, hz_parser_t *p, hz_feature_table_t *table) {
     table->feature_params = hz_parser_read_u16(p);
     table->lookup_index_count = hz_parser_read_u16(p);
-    table->lookup_list_indices = hz_memory_arena_alloc(memory_arena, sizeof(uint16_t) * table->lookup_index_count);
-    hz_parser_read_u16_block(p, table->lookup_list_indices, table->lookup_index_count);
+    table->lookup_list_indices = hz_parser_read_u16_array(p, memory_arena, table->lookup_index_count);
 }
 
 typedef struct {
@@ -3961,8 +6087,7 @@ hz_read_gsub_single_substitution_subtable(hz_memory_arena_t *memory_arena,
             hz_parser_pop_state(p);
 
             subtable->glyph_count = hz_parser_read_u16(p);
-            subtable->substitute_glyph_ids = hz_memory_arena_alloc(memory_arena, subtable->glyph_count * sizeof(uint16_t));
-            hz_parser_read_u16_block(p, subtable->substitute_glyph_ids, subtable->glyph_count);
+            subtable->substitute_glyph_ids = hz_parser_read_u16_array(p, memory_arena, subtable->glyph_count);
 
             lookup->subtables[subtable_index] = (hz_lookup_subtable_t *)subtable;
             break;
@@ -4043,8 +6168,7 @@ hz_read_gsub_ligature_substitution_subtable(hz_memory_arena_t *memory_arena,
             ligature->ligature_glyph = hz_parser_read_u16(p);
             ligature->component_count = hz_parser_read_u16(p);
             if (ligature->component_count > 1) {
-                ligature->component_glyph_ids = hz_memory_arena_alloc(memory_arena, (ligature->component_count - 1) * sizeof(uint16_t));
-                hz_parser_read_u16_block(p, ligature->component_glyph_ids, ligature->component_count - 1);
+                ligature->component_glyph_ids = hz_parser_read_u16_array(p, memory_arena, ligature->component_count - 1);
             } else {
                 ligature->component_glyph_ids = NULL;
             }
@@ -4067,6 +6191,38 @@ typedef struct hz_chained_sequence_context_format1_subtable_t {
     hz_chained_sequence_rule_set_t *rule_sets;
 } hz_chained_sequence_context_format1_subtable_t;
 
+// Chained sequence context format 1, simple glyph contexts, shared by GSUB and GPOS.
+HZ_STATIC void
+hz_ot_load_chained_sequence_context_format1_subtable(hz_memory_arena_t *memory_arena,
+                                                     hz_parser_t *p,
+                                                     hz_chained_sequence_context_format1_subtable_t *table)
+{
+    uint8_t tmp_buffer[4000];
+    hz_memory_arena_t tmp_arena = hz_memory_arena_create(tmp_buffer, sizeof tmp_buffer);
+
+    Offset16 coverage_offset = hz_parser_read_u16(p);
+    hz_parser_push_state(p,coverage_offset);
+    hz_read_coverage(memory_arena, p, &table->coverage);
+    hz_parser_pop_state(p);
+
+    table->rule_set_count = hz_parser_read_u16(p);
+
+    Offset16 *rule_set_offsets = hz_memory_arena_alloc(&tmp_arena, sizeof(Offset16) * table->rule_set_count);
+    hz_parser_read_u16_block(p, rule_set_offsets, table->rule_set_count);
+
+    table->rule_sets = hz_memory_arena_alloc(memory_arena, sizeof(*table->rule_sets) * table->rule_set_count);
+    for (int i = 0; i < table->rule_set_count; ++i) {
+        if (rule_set_offsets[i]) {
+            hz_parser_push_state(p, rule_set_offsets[i]);
+            hz_parse_chained_sequence_rule_set(memory_arena, p, table->rule_sets+i);
+            hz_parser_pop_state(p);
+        } else {
+            table->rule_sets[i].count = 0;
+            table->rule_sets[i].rules = NULL;
+        }
+    }
+}
+
 HZ_STATIC hz_error_t
 hz_read_gsub_chained_contexts_substitution_subtable(hz_memory_arena_t *memory_arena,
                                                     hz_parser_t *p,
@@ -4074,37 +6230,13 @@ hz_read_gsub_chained_contexts_substitution_subtable(hz_memory_arena_t *memory_ar
                                                     uint16_t subtable_index,
                                                     uint16_t format)
 {
-    uint8_t tmp_buffer[4000];
-    hz_memory_arena_t tmp_arena = hz_memory_arena_create(tmp_buffer, sizeof tmp_buffer);
     switch (format) {
         case 1: {
             // 6.1 Chained Contexts Substitution Format 1: Simple Glyph Contexts
             // https://docs.microsoft.com/en-us/typography/opentype/spec/gsub#61-chained-contexts-substitution-format-1-simple-glyph-contexts
             hz_chained_sequence_context_format1_subtable_t *subtable = hz_memory_arena_alloc(memory_arena, sizeof(*subtable));
             subtable->format = format;
-
-            Offset16 coverage_offset = hz_parser_read_u16(p);
-            hz_parser_push_state(p,coverage_offset);
-            hz_read_coverage(memory_arena, p, &subtable->coverage);
-            hz_parser_pop_state(p);
-
-            subtable->rule_set_count = hz_parser_read_u16(p);
-
-            Offset16 *rule_set_offsets = hz_memory_arena_alloc(&tmp_arena, sizeof(Offset16) * subtable->rule_set_count);
-            hz_parser_read_u16_block(p, rule_set_offsets, subtable->rule_set_count);
-
-            subtable->rule_sets = hz_memory_arena_alloc(memory_arena, sizeof(*subtable->rule_sets) * subtable->rule_set_count);
-            for (int i = 0; i < subtable->rule_set_count; ++i) {
-                if (rule_set_offsets[i]) {
-                    hz_parser_push_state(p, rule_set_offsets[i]);
-                    hz_parse_chained_sequence_rule_set(memory_arena, p, subtable->rule_sets+i);
-                    hz_parser_pop_state(p);
-                } else {
-                    subtable->rule_sets[i].count = 0;
-                    subtable->rule_sets[i].rules = NULL;
-                }
-            }
-
+            hz_ot_load_chained_sequence_context_format1_subtable(memory_arena, p, subtable);
             lookup->subtables[subtable_index] = (hz_lookup_subtable_t *)subtable;
             break;
         }
@@ -4159,8 +6291,7 @@ hz_read_gsub_multiple_substitution_subtable(hz_memory_arena_t *memory_arena,
         if (sequence_offsets[i]) {
             hz_parser_push_state(p, sequence_offsets[i]);
             seq->glyph_count = hz_parser_read_u16(p);
-            seq->glyphs = hz_memory_arena_alloc(memory_arena, seq->glyph_count * sizeof(uint16_t));
-            hz_parser_read_u16_block(p, seq->glyphs, seq->glyph_count);
+            seq->glyphs = hz_parser_read_u16_array(p, memory_arena, seq->glyph_count);
             hz_parser_pop_state(p);
         }
     }
@@ -4355,7 +6486,7 @@ hz_read_gpos_single_adjustment_subtable(hz_memory_arena_t *memory_arena,
             subtable->format = format;
             Offset16 coverage_offset = hz_parser_read_u16(p);
             subtable->value_format = hz_parser_read_u16(p);
-            hz_read_value_record(p,&subtable->value_record,subtable->value_format);
+            hz_read_value_record(p,&subtable->value_record,subtable->value_format,p->start);
             hz_parser_push_state(p, coverage_offset);
             hz_read_coverage(memory_arena,p,&subtable->coverage);
             hz_parser_pop_state(p);
@@ -4371,7 +6502,7 @@ hz_read_gpos_single_adjustment_subtable(hz_memory_arena_t *memory_arena,
             subtable->value_records = hz_memory_arena_alloc(memory_arena,sizeof(hz_value_record_t) * subtable->value_count);
 
             for (int i = 0; i < subtable->value_count; ++i) {
-                hz_read_value_record(p, &subtable->value_records[i], subtable->value_format);
+                hz_read_value_record(p, &subtable->value_records[i], subtable->value_format, p->start);
             }
 
             hz_parser_push_state(p, coverage_offset);
@@ -4392,9 +6523,10 @@ hz_read_pair_value_record(hz_parser_t *p,
                           hz_pair_value_record_t *pair_value_record,
                           uint16_t v1, uint16_t v2)
 {
+    // device offsets are from the start of the pair set
     pair_value_record->second_glyph = hz_parser_read_u16(p);
-    hz_read_value_record(p, &pair_value_record->value_record1, v1);
-    hz_read_value_record(p, &pair_value_record->value_record2, v2);
+    hz_read_value_record(p, &pair_value_record->value_record1, v1, p->start);
+    hz_read_value_record(p, &pair_value_record->value_record2, v2, p->start);
 }
 
 HZ_STATIC void hz_read_pair_set(hz_memory_arena_t *memory_arena, hz_parser_t *p, hz_pair_set_t *pair_set, uint16_t v1, uint16_t v2) {
@@ -4465,8 +6597,8 @@ hz_read_gpos_pair_adjustment_subtable(hz_memory_arena_t *memory_arena,
                 class1_record->class2_records = hz_memory_arena_alloc(memory_arena, sizeof(hz_class2_record_t) * subtable->class2_count);
                 for (int j = 0; j < subtable->class2_count; ++j) {
                     hz_class2_record_t *class2_record = &class1_record->class2_records[j];
-                    hz_read_value_record(p,&class2_record->value_record1,subtable->value_format1);
-                    hz_read_value_record(p,&class2_record->value_record2,subtable->value_format2);
+                    hz_read_value_record(p,&class2_record->value_record1,subtable->value_format1,p->start);
+                    hz_read_value_record(p,&class2_record->value_record2,subtable->value_format2,p->start);
                 }
             }
 
@@ -4492,6 +6624,61 @@ hz_read_gpos_pair_adjustment_subtable(hz_memory_arena_t *memory_arena,
     return HZ_OK;
 }
 
+typedef struct hz_cursive_attachment_format1_subtable_t {
+    uint16_t format;
+    hz_coverage_t coverage;
+    uint16_t entry_exit_count;
+    hz_anchor_pair_t *entry_exit_records;
+} hz_cursive_attachment_format1_subtable_t;
+
+HZ_STATIC hz_error_t
+hz_read_gpos_cursive_attachment_subtable(hz_memory_arena_t *memory_arena,
+                                         hz_parser_t *p,
+                                         hz_lookup_table_t *lookup,
+                                         uint16_t subtable_index,
+                                         uint16_t format)
+{
+    if (hz_unlikely(format != 1)) {
+        return HZ_ERROR_INVALID_LOOKUP_SUBTABLE_FORMAT;
+    }
+
+    hz_cursive_attachment_format1_subtable_t *subtable = hz_memory_arena_alloc(memory_arena, sizeof(*subtable));
+    subtable->format = format;
+
+    Offset16 coverage_offset = hz_parser_read_u16(p);
+    subtable->entry_exit_count = hz_parser_read_u16(p);
+    subtable->entry_exit_records = hz_memory_arena_alloc(memory_arena, subtable->entry_exit_count * sizeof(hz_anchor_pair_t));
+
+    for (uint16_t i = 0; i < subtable->entry_exit_count; ++i) {
+        hz_anchor_pair_t *record = &subtable->entry_exit_records[i];
+        hz_entry_exit_record_t offsets;
+        offsets.entry_anchor_offset = hz_parser_read_u16(p);
+        offsets.exit_anchor_offset = hz_parser_read_u16(p);
+
+        // anchor offsets are from the start of the subtable, zero where the glyph has none
+        record->has_entry = offsets.entry_anchor_offset != 0;
+        if (record->has_entry) {
+            hz_parser_push_state(p, offsets.entry_anchor_offset);
+            record->entry = hz_read_anchor(p);
+            hz_parser_pop_state(p);
+        }
+
+        record->has_exit = offsets.exit_anchor_offset != 0;
+        if (record->has_exit) {
+            hz_parser_push_state(p, offsets.exit_anchor_offset);
+            record->exit = hz_read_anchor(p);
+            hz_parser_pop_state(p);
+        }
+    }
+
+    hz_parser_push_state(p, coverage_offset);
+    hz_read_coverage(memory_arena, p, &subtable->coverage);
+    hz_parser_pop_state(p);
+
+    lookup->subtables[subtable_index] = (hz_lookup_subtable_t *)subtable;
+    return HZ_OK;
+}
+
 HZ_STATIC hz_error_t
 hz_read_gpos_mark_to_base_attachment_subtable(hz_memory_arena_t *memory_arena,
                                               hz_parser_t *p,
@@ -4507,25 +6694,23 @@ hz_read_gpos_mark_to_base_attachment_subtable(hz_memory_arena_t *memory_arena,
     hz_mark_to_base_attachment_subtable_t *subtable = hz_memory_arena_alloc(memory_arena,sizeof(hz_mark_to_base_attachment_subtable_t));
     subtable->format = format;
 
-    Offset16 mark_coverage_offset = hz_parser_read_u16(p);
-    Offset16 base_coverage_offset = hz_parser_read_u16(p);
-    subtable->mark_class_count = hz_parser_read_u16(p);
-    Offset16 mark_array_offset = hz_parser_read_u16(p);
-    Offset16 base_array_offset = hz_parser_read_u16(p);
+    hz_mark_attachment_header_t hdr;
+    hz_read_mark_attachment_header(p, &hdr);
+    subtable->mark_class_count = hdr.mark_class_count;
     
-    hz_parser_push_state(p,mark_coverage_offset);
+    hz_parser_push_state(p,hdr.mark_coverage_offset);
     hz_read_coverage(memory_arena, p, &subtable->mark_coverage);
     hz_parser_pop_state(p);
 
-    hz_parser_push_state(p,base_coverage_offset);
+    hz_parser_push_state(p,hdr.target_coverage_offset);
     hz_read_coverage(memory_arena, p, &subtable->base_coverage);
     hz_parser_pop_state(p);
 
-    hz_parser_push_state(p,mark_array_offset);
+    hz_parser_push_state(p,hdr.mark_array_offset);
     hz_read_mark_array(memory_arena, p, &subtable->mark_array);
     hz_parser_pop_state(p);
 
-    hz_parser_push_state(p,base_array_offset);
+    hz_parser_push_state(p,hdr.target_array_offset);
     hz_load_base_array(memory_arena, p, &subtable->base_array, subtable->mark_class_count);
     hz_parser_pop_state(p);
     
@@ -4557,25 +6742,23 @@ hz_read_gpos_mark_to_mark_attachment_subtable(hz_memory_arena_t *memory_arena,
 
     hz_mark_to_mark_attachment_format1_subtable_t *subtable = hz_memory_arena_alloc(memory_arena, sizeof(*subtable));
     subtable->format = format;
-    Offset16 mark1_coverage_offset = hz_parser_read_u16(p);
-    Offset16 mark2_coverage_offset = hz_parser_read_u16(p);
-    subtable->mark_class_count = hz_parser_read_u16(p);
-    Offset16 mark1_array_offset = hz_parser_read_u16(p);
-    Offset16 mark2_array_offset = hz_parser_read_u16(p);
+    hz_mark_attachment_header_t hdr;
+    hz_read_mark_attachment_header(p, &hdr);
+    subtable->mark_class_count = hdr.mark_class_count;
     
-    hz_parser_push_state(p, mark1_coverage_offset);
+    hz_parser_push_state(p, hdr.mark_coverage_offset);
     hz_read_coverage(memory_arena, p, &subtable->mark1_coverage);
     hz_parser_pop_state(p);
 
-    hz_parser_push_state(p, mark2_coverage_offset);
+    hz_parser_push_state(p, hdr.target_coverage_offset);
     hz_read_coverage(memory_arena, p, &subtable->mark2_coverage);
     hz_parser_pop_state(p);
     
-    hz_parser_push_state(p, mark1_array_offset);
+    hz_parser_push_state(p, hdr.mark_array_offset);
     hz_read_mark_array(memory_arena, p,  &subtable->mark1_array);
     hz_parser_pop_state(p);
     
-    hz_parser_push_state(p, mark2_array_offset);
+    hz_parser_push_state(p, hdr.target_array_offset);
     hz_load_mark2_array(memory_arena, p, &subtable->mark2_array, subtable->mark_class_count);
     hz_parser_pop_state(p);
 
@@ -4661,26 +6844,23 @@ hz_read_gpos_mark_to_ligature_attachment_subtable(hz_memory_arena_t *memory_aren
             hz_mark_to_ligature_attachment_format1_subtable_t *subtable = hz_memory_arena_alloc(memory_arena, sizeof(*subtable));
             subtable->format = format;
 
-            Offset16 mark_coverage_offset = hz_parser_read_u16(p);
-            Offset16 ligature_coverage_offset = hz_parser_read_u16(p);
-            subtable->mark_class_count = hz_parser_read_u16(p);
-            Offset16 mark_array_offset = hz_parser_read_u16(p);
-            Offset16 ligature_array_offset = hz_parser_read_u16(p);
-
+            hz_mark_attachment_header_t hdr;
+            hz_read_mark_attachment_header(p, &hdr);
+            subtable->mark_class_count = hdr.mark_class_count;
 
-            hz_parser_push_state(p,mark_coverage_offset);
+            hz_parser_push_state(p,hdr.mark_coverage_offset);
             hz_read_coverage(memory_arena, p, &subtable->mark_coverage);
             hz_parser_pop_state(p);
 
-            hz_parser_push_state(p,ligature_coverage_offset);
+            hz_parser_push_state(p,hdr.target_coverage_offset);
             hz_read_coverage(memory_arena, p, &subtable->ligature_coverage);
             hz_parser_pop_state(p);
 
-            hz_parser_push_state(p,mark_array_offset);
+            hz_parser_push_state(p,hdr.mark_array_offset);
             hz_read_mark_array(memory_arena, p, &subtable->mark_array);
             hz_parser_pop_state(p);
 
-            hz_parser_push_state(p,ligature_array_offset);
+            hz_parser_push_state(p,hdr.target_array_offset);
             hz_load_ligature_array(memory_arena, p, subtable->mark_class_count, &subtable->ligature_array);
             hz_parser_pop_state(p);
 
@@ -4703,6 +6883,10 @@ hz_load_gpos_chained_context_positioning_subtable(hz_memory_arena_t *memory_aren
 {
     switch (format) {
         case 1: {
+            hz_chained_sequence_context_format1_subtable_t *subtable = hz_memory_arena_alloc(memory_arena, sizeof(*subtable));
+            subtable->format = format;
+            hz_ot_load_chained_sequence_context_format1_subtable(memory_arena, p, subtable);
+            lookup->subtables[subtable_index] = (hz_lookup_subtable_t *)subtable;
             break;
         }
 
@@ -4748,7 +6932,7 @@ hz_read_gpos_lookup_subtable(hz_memory_arena_t *memory_arena,
             break;
 
         case HZ_GPOS_LOOKUP_TYPE_CURSIVE_ATTACHMENT:
-            // error = hz_read_gpos_cursive_attachment_subtable(alctr, p, lookup, subtable_index, format);
+            error = hz_read_gpos_cursive_attachment_subtable(memory_arena, p, lookup, subtable_index, format);
             break;
 
         case HZ_GPOS_LOOKUP_TYPE_MARK_TO_BASE_ATTACHMENT:
@@ -4883,20 +7067,15 @@ HZ_STATIC hz_error_t hz_load_gsub_table(hz_parser_t *p, hz_font_data_t *font_dat
     hz_parser_push_state(p, face->gsub);
     hz_gsub_table_t *gsub_table = &font_data->gsub_table;
 
-    struct { uint16_t script_list_offset,
-                      feature_list_offset,
-                      lookup_list_offset,
-                      feature_variations_offset; } hdr;
+    hz_layout_header_t hdr;
 
     gsub_table->version = hz_parser_read_u32(p);
 
     switch (gsub_table->version) {
     default: return HZ_ERROR_INVALID_TABLE_VERSION;
     case 0x00010000: // 1.0
-        hz_cmdread(p, 1, &hdr, "www");
-        break;
-    case 0x00010001: // 1.1
-        hz_cmdread(p, 1, &hdr, "wwww");
+    case 0x00010001: // 1.1, FeatureVariations is read per face by hz_face_load_variations
+        hz_read_layout_header(p, &hdr);
         break;
     }
 
@@ -4954,19 +7133,14 @@ HZ_STATIC hz_error_t hz_load_gpos_table(hz_parser_t *p, hz_font_data_t *font_dat
     hz_parser_push_state(p, face->gpos);
     hz_gpos_table_t *gpos_table = &font_data->gpos_table;
 
-    struct { uint16_t script_list_offset,
-                      feature_list_offset,
-                      lookup_list_offset,
-                      feature_variations_offset; } hdr;
-    
+    hz_layout_header_t hdr;
+
     gpos_table->version = hz_parser_read_u32(p);
 
     switch (gpos_table->version) {
     case 0x00010000: // 1.0
-        hz_cmdread(p, 1, &hdr, "www");
-        break;
-    case 0x00010001: // 1.1
-        hz_cmdread(p, 1, &hdr, "wwww");
+    case 0x00010001: // 1.1, FeatureVariations is read per face by hz_face_load_variations
+        hz_read_layout_header(p, &hdr);
         break;
     default: // error
         return HZ_ERROR_INVALID_TABLE_VERSION;
@@ -5017,6 +7191,7 @@ HZ_STATIC void hz_font_data_load(hz_font_data_t *fd, hz_font_t *font) {
     hz_parser_init(&p, font->face->data);
     hz_memory_arena_reset(&fd->memory_arena); /* reset arena before parsing new font */
     fd->face = font->face;
+    fd->font = font;
 
     hz_load_gsub_table(&p, fd);
     hz_load_gpos_table(&p, fd);
@@ -5040,123 +7215,484 @@ hz_font_data_t *hz_font_data_create(hz_font_t* font) {
     return fd;
 }
 
+HZ_STATIC void hz_variation_instance_destroy(hz_variation_instance_t *instance);
+
 void hz_font_data_release(hz_font_data_t *fd){
+    for (size_t i = 0; i < HZ_VARIATION_CACHE_SIZE && fd->instances[i] != NULL; ++i)
+        hz_variation_instance_destroy(fd->instances[i]);
+    for (size_t i = 0; i < HZ_AUTO_SHAPER_CACHE_SIZE && fd->auto_shapers[i] != NULL; ++i)
+        hz_shaper_destroy(fd->auto_shapers[i]);
+
     hz_free(fd->memory_arena_data);
     hz_free(fd);
 }
 
+// Deltas of every item of an ItemVariationStore at one instance.
+typedef struct {
+    int32_t *deltas; // by outer index, then inner index
+    uint32_t *starts; // first delta of each outer index, outer_count + 1 entries
+    uint16_t outer_count;
+} hz_variation_deltas_t;
+
+struct hz_variation_instance_t {
+    int16_t *coords; // normalized coordinates, the key the instance is cached by
+    int32_t *advances; // horizontal advance of each glyph, NULL without an HVAR table
+    hz_variation_deltas_t gdef_deltas; // GPOS device table deltas
+    // FeatureVariations alternates by feature index, NULL where the default feature table is kept
+    hz_feature_table_t **gsub_features, **gpos_features;
+    uint16_t gsub_feature_count, gpos_feature_count;
+};
+
+// Evaluates every delta set of an ItemVariationStore at the normalized coordinates, rounded to font units.
+HZ_STATIC void
+hz_item_variation_store_evaluate(const uint8_t *store, const int16_t *coords, uint16_t axis_count, hz_variation_deltas_t *out)
+{
+    const uint8_t *region_list = store + hz_load_u32be(store + 2);
+    uint16_t data_count = hz_load_u16be(store + 6);
+    uint16_t region_axis_count = hz_load_u16be(region_list);
+    uint16_t region_count = hz_load_u16be(region_list + 2);
+
+    // scalar of each region, the product of its per axis tents
+    float *scalars = hz_malloc(sizeof(float) * (region_count + 1));
+    for (uint16_t r = 0; r < region_count; ++r) {
+        const uint8_t *axis = region_list + 4 + (size_t)r * region_axis_count * 6;
+        float scalar = 1.0f;
+
+        for (uint16_t a = 0; a < region_axis_count && scalar != 0.0f; ++a, axis += 6) {
+            int start = (int16_t)hz_load_u16be(axis);
+            int peak = (int16_t)hz_load_u16be(axis + 2);
+            int end = (int16_t)hz_load_u16be(axis + 4);
+            int v = a < axis_count ? coords[a] : 0;
+
+            if (peak == 0 || v == peak || start > peak || peak > end || (start < 0 && end > 0)) continue;
+            if (v <= start || v >= end) scalar = 0.0f;
+            else if (v < peak) scalar *= (float)(v - start) / (float)(peak - start);
+            else scalar *= (float)(end - v) / (float)(end - peak);
+        }
+
+        scalars[r] = scalar;
+    }
+
+    out->outer_count = data_count;
+    out->starts = hz_malloc(sizeof(uint32_t) * (data_count + 1));
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < data_count; ++i) {
+        Offset32 data_offset = hz_load_u32be(store + 8 + 4 * i);
+        out->starts[i] = total;
+        if (data_offset) total += hz_load_u16be(store + data_offset);
+    }
+
+    out->starts[data_count] = total;
+    out->deltas = hz_malloc(sizeof(int32_t) * (total + 1));
+
+    for (uint16_t i = 0; i < data_count; ++i) {
+        Offset32 data_offset = hz_load_u32be(store + 8 + 4 * i);
+        if (!data_offset) continue;
+
+        const uint8_t *data = store + data_offset;
+        uint16_t item_count = hz_load_u16be(data);
+        uint16_t word_delta_count = hz_load_u16be(data + 2);
+        uint16_t region_index_count = hz_load_u16be(data + 4);
+        const uint8_t *region_indices = data + 6;
+
+        // rows start with the word deltas, LONG_WORDS doubles the size of both kinds
+        hz_bool long_words = (word_delta_count & 0x8000) != 0;
+        uint16_t word_count = HZ_MIN(word_delta_count & 0x7FFF, region_index_count);
+        size_t word_size = long_words ? 4 : 2, short_size = long_words ? 2 : 1;
+        const uint8_t *row = region_indices + 2 * region_index_count;
 
-HZ_STATIC int64_t next_joining_arabic_glyph(hz_buffer_t *buffer, int64_t g, uint16_t lookup_flag, const hz_coverage_t *mark_filtering_set)
+        for (uint16_t item = 0; item < item_count; ++item) {
+            float delta = 0.0f;
+
+            for (uint16_t k = 0; k < region_index_count; ++k) {
+                int32_t v;
+                if (k < word_count) {
+                    v = long_words ? (int32_t)hz_load_u32be(row) : (int16_t)hz_load_u16be(row);
+                    row += word_size;
+                } else {
+                    v = long_words ? (int16_t)hz_load_u16be(row) : (int8_t)row[0];
+                    row += short_size;
+                }
+
+                uint16_t region = hz_load_u16be(region_indices + 2 * k);
+                if (region < region_count) delta += scalars[region] * (float)v;
+            }
+
+            out->deltas[out->starts[i] + item] = (int32_t)floorf(delta + 0.5f);
+        }
+    }
+
+    hz_free(scalars);
+}
+
+HZ_STATIC void hz_variation_deltas_release(hz_variation_deltas_t *deltas)
 {
-    size_t size = hz_vector_size(buffer->glyph_indices);
-    do {
-        if (++g >= size)
-            return -1;
+    if (deltas->starts) hz_free(deltas->starts);
+    if (deltas->deltas) hz_free(deltas->deltas);
+}
+
+// Delta of the item at a delta-set index (outer << 16 | inner), 0 for indices past the store.
+HZ_STATIC HZ_INLINE int32_t hz_variation_deltas_get(const hz_variation_deltas_t *deltas, uint32_t var_index)
+{
+    uint32_t outer = var_index >> 16, inner = var_index & 0xFFFF;
+    if (outer >= deltas->outer_count || inner >= deltas->starts[outer + 1] - deltas->starts[outer])
+        return 0;
+
+    return deltas->deltas[deltas->starts[outer] + inner];
+}
 
-    } while (hz_should_ignore_glyph(buffer,g,lookup_flag, mark_filtering_set));
+// Delta-set index a DeltaSetIndexMap maps an item to, items past the map use its last entry.
+HZ_STATIC uint32_t hz_delta_set_index_map_lookup(const uint8_t *map, uint32_t item)
+{
+    uint8_t format = map[0], entry_format = map[1];
+    uint32_t map_count = format == 0 ? hz_load_u16be(map + 2) : hz_load_u32be(map + 2);
+    const uint8_t *entry = map + (format == 0 ? 4 : 6);
+    unsigned int entry_size = ((entry_format >> 4) & 3) + 1;
+    unsigned int inner_bits = (entry_format & 0xF) + 1;
+
+    if (!map_count) return HZ_NO_VARIATION_INDEX;
+    entry += (size_t)HZ_MIN(item, map_count - 1) * entry_size;
 
-    return g;
+    uint32_t value = 0;
+    for (unsigned int k = 0; k < entry_size; ++k)
+        value = value << 8 | entry[k];
+
+    return (value >> inner_bits) << 16 | (value & ((1u << inner_bits) - 1));
 }
 
-HZ_STATIC int64_t prev_joining_arabic_glyph(hz_buffer_t *buffer, int64_t g, uint16_t lookup_flag, const hz_coverage_t *mark_filtering_set)
+// Alternate feature tables of the first FeatureVariations record whose conditions the coordinates meet,
+// by index into the layout table's feature list. Returns NULL when no record applies.
+HZ_STATIC hz_feature_table_t **
+hz_select_feature_variations(const uint8_t *layout_table, const uint8_t *feature_variations,
+                             const int16_t *coords, uint16_t axis_count, uint16_t *feature_count)
 {
-    do {
-        if (--g < 0)
-            return -1;
+    uint32_t record_count = hz_load_u32be(feature_variations + 4);
+    *feature_count = hz_load_u16be(layout_table + hz_load_u16be(layout_table + 6));
+
+    for (uint32_t r = 0; r < record_count; ++r) {
+        const uint8_t *record = feature_variations + 8 + 8 * (size_t)r;
+        Offset32 condition_set_offset = hz_load_u32be(record);
+        hz_bool match = HZ_TRUE;
+
+        if (condition_set_offset) {
+            const uint8_t *condition_set = feature_variations + condition_set_offset;
+            uint16_t condition_count = hz_load_u16be(condition_set);
+
+            for (uint16_t c = 0; c < condition_count && match; ++c) {
+                const uint8_t *condition = condition_set + hz_load_u32be(condition_set + 2 + 4 * c);
+                // conditions of unknown formats can't be met
+                if (hz_load_u16be(condition) != 1) {
+                    match = HZ_FALSE;
+                } else {
+                    uint16_t axis_index = hz_load_u16be(condition + 2);
+                    int v = axis_index < axis_count ? coords[axis_index] : 0;
+                    match = v >= (int16_t)hz_load_u16be(condition + 4) && v <= (int16_t)hz_load_u16be(condition + 6);
+                }
+            }
+        }
 
-    } while (hz_should_ignore_glyph(buffer,g,lookup_flag, mark_filtering_set));
+        if (match) {
+            const uint8_t *substitution = feature_variations + hz_load_u32be(record + 4);
+            uint16_t substitution_count = hz_load_u16be(substitution + 4);
+            hz_feature_table_t **features = hz_malloc(sizeof(*features) * (*feature_count + 1));
+            HZ_MEMSET(features, 0, sizeof(*features) * (*feature_count + 1));
 
-    return g;
+            for (uint16_t s = 0; s < substitution_count; ++s) {
+                const uint8_t *substitution_record = substitution + 6 + 6 * s;
+                uint16_t feature_index = hz_load_u16be(substitution_record);
+                if (feature_index >= *feature_count || features[feature_index] != NULL) continue;
+
+                const uint8_t *alternate = substitution + hz_load_u32be(substitution_record + 2);
+                uint16_t lookup_index_count = hz_load_u16be(alternate + 2);
+                hz_feature_table_t *table;
+
+                if (hz_table_views()) {
+                    table = hz_malloc(sizeof(*table));
+                    table->lookup_list_indices = (uint16_t *)(alternate + 4);
+                } else {
+                    table = hz_malloc(sizeof(*table) + sizeof(uint16_t) * lookup_index_count);
+                    table->lookup_list_indices = (uint16_t *)(table + 1);
+
+                    for (uint16_t k = 0; k < lookup_index_count; ++k)
+                        table->lookup_list_indices[k] = hz_load_u16be(alternate + 4 + 2 * k);
+                }
+
+                table->feature_params = hz_load_u16be(alternate);
+                table->lookup_index_count = lookup_index_count;
+
+                features[feature_index] = table;
+            }
+
+            return features;
+        }
+    }
+
+    return NULL;
 }
 
-typedef struct hz_arabic_joining_triplet_t {
-    uint32_t prev_joining, curr_joining, next_joining;
-    int init,fina,medi;
-    int does_apply;
-} hz_arabic_joining_triplet_t;
+HZ_STATIC void hz_feature_alternates_destroy(hz_feature_table_t **features, uint16_t feature_count)
+{
+    if (features != NULL) {
+        for (uint16_t i = 0; i < feature_count; ++i)
+            if (features[i] != NULL) hz_free(features[i]);
+
+        hz_free(features);
+    }
+}
 
-hz_arabic_joining_triplet_t
-hz_shape_complex_arabic_joining(hz_buffer_t *buffer,
-                                int64_t index,
-                                uint16_t lookup_flag,
-                                const hz_coverage_t *mark_filtering_set)
+HZ_STATIC hz_variation_instance_t *hz_variation_instance_create(hz_face_t *face, const int16_t *coords)
 {
-    hz_arabic_joining_triplet_t triplet;
-    triplet.curr_joining = hz_ucd_get_arabic_joining_data(buffer->codepoints[index]);
-    if (triplet.curr_joining != (HZ_JOINING_GROUP_NONE | HZ_JOINING_TYPE_U)) {
-        int64_t prev_index = prev_joining_arabic_glyph(buffer, index, HZ_LOOKUP_FLAG_IGNORE_MARKS, mark_filtering_set);
-        int64_t next_index = next_joining_arabic_glyph(buffer, index, HZ_LOOKUP_FLAG_IGNORE_MARKS, mark_filtering_set);
+    hz_variation_instance_t *instance = hz_malloc(sizeof(*instance));
+    HZ_MEMSET(instance, 0, sizeof(*instance));
+    instance->coords = hz_malloc(sizeof(int16_t) * face->axis_count);
+    HZ_MEMCPY(instance->coords, coords, sizeof(int16_t) * face->axis_count);
 
-        if (prev_index == -1)
-            triplet.prev_joining = HZ_JOINING_GROUP_NONE | HZ_JOINING_TYPE_T;
-        else
-            triplet.prev_joining = hz_ucd_get_arabic_joining_data(buffer->codepoints[prev_index]);
+    if (face->hvar) {
+        // advances vary by the item the glyph maps to, the glyph id itself without an advance map
+        const uint8_t *hvar = face->data + face->hvar;
+        Offset32 advance_map_offset = hz_load_u32be(hvar + 8);
+        hz_variation_deltas_t deltas;
+        hz_item_variation_store_evaluate(hvar + hz_load_u32be(hvar + 4), coords, face->axis_count, &deltas);
 
-        if (next_index == -1)
-            triplet.next_joining = HZ_JOINING_GROUP_NONE | HZ_JOINING_TYPE_T;
-        else
-            triplet.next_joining = hz_ucd_get_arabic_joining_data(buffer->codepoints[next_index]);
+        instance->advances = hz_malloc(sizeof(int32_t) * face->num_glyphs);
+        for (uint32_t g = 0; g < face->num_glyphs; ++g) {
+            uint32_t var_index = advance_map_offset ? hz_delta_set_index_map_lookup(hvar + advance_map_offset, g) : g;
+            instance->advances[g] = face->metrics[g].xAdvance + hz_variation_deltas_get(&deltas, var_index);
+        }
+
+        hz_variation_deltas_release(&deltas);
+    }
+
+    if (face->gdef_var_store)
+        hz_item_variation_store_evaluate(face->data + face->gdef_var_store, coords, face->axis_count, &instance->gdef_deltas);
+
+    if (face->gsub_feature_variations)
+        instance->gsub_features = hz_select_feature_variations(face->data + face->gsub, face->data + face->gsub_feature_variations,
+                                                               coords, face->axis_count, &instance->gsub_feature_count);
 
-        triplet.init = triplet.curr_joining & (HZ_JOINING_TYPE_L | HZ_JOINING_TYPE_D)
-                && triplet.next_joining & (HZ_JOINING_TYPE_R | HZ_JOINING_TYPE_D | HZ_JOINING_TYPE_C);
+    if (face->gpos_feature_variations)
+        instance->gpos_features = hz_select_feature_variations(face->data + face->gpos, face->data + face->gpos_feature_variations,
+                                                               coords, face->axis_count, &instance->gpos_feature_count);
 
-        triplet.fina = triplet.curr_joining & (HZ_JOINING_TYPE_R | HZ_JOINING_TYPE_D)
-                && triplet.prev_joining & (HZ_JOINING_TYPE_L | HZ_JOINING_TYPE_D | HZ_JOINING_TYPE_C);
+    return instance;
+}
+
+HZ_STATIC void hz_variation_instance_destroy(hz_variation_instance_t *instance)
+{
+    hz_free(instance->coords);
+    if (instance->advances) hz_free(instance->advances);
+    hz_variation_deltas_release(&instance->gdef_deltas);
+    hz_feature_alternates_destroy(instance->gsub_features, instance->gsub_feature_count);
+    hz_feature_alternates_destroy(instance->gpos_features, instance->gpos_feature_count);
+    hz_free(instance);
+}
+
+/*  Function: hz_font_get_instance
+ *      Resolved data of the instance the font of a font data is set to, taken from the font data's cache
+ *      of recently used instances or computed and cached in place of the least recently used one. The
+ *      instance stays valid until another one is requested from the same font data.
+ *
+ *  Returns:
+ *      The instance, or NULL at the default instance.
+ */
+HZ_STATIC const hz_variation_instance_t *hz_font_get_instance(hz_font_data_t *font_data)
+{
+    hz_font_t *font = font_data->font;
+    if (font == NULL || font->coords == NULL) return NULL;
 
-        triplet.medi = triplet.curr_joining & HZ_JOINING_TYPE_D
-                && triplet.prev_joining & (HZ_JOINING_TYPE_L | HZ_JOINING_TYPE_C | HZ_JOINING_TYPE_D)
-                && triplet.next_joining & (HZ_JOINING_TYPE_R | HZ_JOINING_TYPE_C | HZ_JOINING_TYPE_D);
+    hz_face_t *face = font->face;
+    hz_variation_instance_t **instances = font_data->instances;
+    size_t i = 0;
+    while (i < HZ_VARIATION_CACHE_SIZE && instances[i] != NULL
+           && memcmp(instances[i]->coords, font->coords, sizeof(int16_t) * face->axis_count))
+        ++i;
 
-        triplet.does_apply = 1;
+    hz_variation_instance_t *instance;
+    if (i < HZ_VARIATION_CACHE_SIZE && instances[i] != NULL) {
+        instance = instances[i];
     } else {
-        triplet.does_apply = 0;
+        if (i == HZ_VARIATION_CACHE_SIZE)
+            hz_variation_instance_destroy(instances[--i]);
+
+        instance = hz_variation_instance_create(face, font->coords);
+    }
+
+    // move to the front
+    memmove(&instances[1], &instances[0], i * sizeof(instances[0]));
+    instances[0] = instance;
+    return instance;
+}
+
+// Maps a normalized coordinate through the segment map of an avar axis.
+HZ_STATIC int16_t hz_avar_map(const uint8_t *segment_map, int16_t coord)
+{
+    uint16_t count = hz_load_u16be(segment_map);
+    const uint8_t *maps = segment_map + 2;
+
+    for (uint16_t k = 0; k < count; ++k) {
+        int from = (int16_t)hz_load_u16be(maps + 4 * k), to = (int16_t)hz_load_u16be(maps + 4 * k + 2);
+        if (coord == from) return to;
+        if (coord < from) {
+            if (k == 0) return to;
+            int prev_from = (int16_t)hz_load_u16be(maps + 4 * k - 4), prev_to = (int16_t)hz_load_u16be(maps + 4 * k - 2);
+            return (int16_t)(prev_to + floorf((float)(coord - prev_from) * (to - prev_to) / (from - prev_from) + 0.5f));
+        }
     }
 
-    return triplet;
+    return count ? (int16_t)hz_load_u16be(maps + 4 * count - 2) : coord;
+}
+
+uint16_t hz_face_get_variation_axes(hz_face_t *face, const hz_variation_axis_t **axes)
+{
+    *axes = face->axes;
+    return face->axis_count;
 }
 
-HZ_STATIC hz_bool hz_shape_complex_arabic_init(hz_buffer_t *buffer, int64_t index, uint16_t lookup_flag, const hz_coverage_t *mark_filtering_set)
+void hz_font_set_variations(hz_font_t *font, size_t count, const hz_variation_t *variations)
 {
-    hz_arabic_joining_triplet_t triplet = hz_shape_complex_arabic_joining(buffer,index,lookup_flag, mark_filtering_set);
-    return triplet.does_apply ? triplet.init && !(triplet.medi || triplet.fina) : HZ_FALSE;
+    hz_face_t *face = font->face;
+
+    if (font->coords) {
+        hz_free(font->coords);
+        font->coords = NULL;
+    }
+
+    if (face == NULL || !face->axis_count) return;
+
+    // normalize to F2DOT14, -1 at the axis minimum, 0 at the default and 1 at the maximum
+    int16_t *coords = hz_malloc(sizeof(int16_t) * face->axis_count);
+    for (uint16_t a = 0; a < face->axis_count; ++a) {
+        const hz_variation_axis_t *axis = &face->axes[a];
+        float v = axis->default_value, n = 0.0f;
+
+        for (size_t i = 0; i < count; ++i)
+            if (variations[i].tag == axis->tag) v = variations[i].value;
+
+        v = HZ_MAX(axis->min_value, HZ_MIN(v, axis->max_value));
+        if (v < axis->default_value) n = (v - axis->default_value) / (axis->default_value - axis->min_value);
+        else if (v > axis->default_value) n = (v - axis->default_value) / (axis->max_value - axis->default_value);
+        coords[a] = (int16_t)floorf(n * 16384.0f + 0.5f);
+    }
+
+    if (face->avar) {
+        const uint8_t *avar = face->data + face->avar;
+        const uint8_t *segment_map = avar + 8;
+        uint16_t map_count = HZ_MIN(hz_load_u16be(avar + 6), face->axis_count);
+
+        for (uint16_t a = 0; a < map_count; ++a) {
+            coords[a] = hz_avar_map(segment_map, coords[a]);
+            segment_map += 2 + 4 * hz_load_u16be(segment_map);
+        }
+    }
+
+    for (uint16_t a = 0; a < face->axis_count; ++a) {
+        if (coords[a]) {
+            font->coords = coords;
+            return;
+        }
+    }
+
+    // the default instance has nothing to resolve
+    hz_free(coords);
 }
 
-HZ_STATIC hz_bool hz_shape_complex_arabic_medi(hz_buffer_t *buffer, int64_t index, uint16_t lookup_flag, const hz_coverage_t *mark_filtering_set)
+// Anchor moved by the instance's deltas.
+HZ_STATIC HZ_INLINE hz_anchor_t hz_vary_anchor(const hz_variation_instance_t *instance, const hz_anchor_t *anchor)
 {
-    hz_arabic_joining_triplet_t triplet = hz_shape_complex_arabic_joining(buffer,index,lookup_flag, mark_filtering_set);
-    return triplet.does_apply ? triplet.medi : HZ_FALSE;
+    hz_anchor_t varied = *anchor;
+    if (instance != NULL) {
+        varied.x_coord += hz_variation_deltas_get(&instance->gdef_deltas, anchor->x_var_index);
+        varied.y_coord += hz_variation_deltas_get(&instance->gdef_deltas, anchor->y_var_index);
+    }
+
+    return varied;
 }
 
-HZ_STATIC hz_bool hz_shape_complex_arabic_fina(hz_buffer_t *buffer, int64_t index, uint16_t lookup_flag, const hz_coverage_t *mark_filtering_set)
+// Feature table the instance uses for a feature of a layout table, FeatureVariations can swap in an alternate.
+HZ_STATIC HZ_INLINE hz_feature_table_t *
+hz_instance_feature_table(hz_feature_table_t **alternates, uint16_t alternate_count,
+                          hz_feature_list_item_t *features, int feature_index)
 {
-    hz_arabic_joining_triplet_t triplet = hz_shape_complex_arabic_joining(buffer,index,lookup_flag,mark_filtering_set);
-    return triplet.does_apply ? triplet.fina && !(triplet.medi || triplet.init) : HZ_FALSE;
+    if (alternates != NULL && feature_index < alternate_count && alternates[feature_index] != NULL)
+        return alternates[feature_index];
+
+    return &features[feature_index].table;
 }
 
-HZ_STATIC hz_bool hz_shape_complex_arabic_isol(hz_buffer_t *buffer, int64_t index, uint16_t lookup_flag, const hz_coverage_t *mark_filtering_set)
+
+HZ_STATIC HZ_INLINE uint8_t hz_arabic_joining_form(uint32_t prev, uint32_t curr, uint32_t next)
 {
-    hz_arabic_joining_triplet_t triplet = hz_shape_complex_arabic_joining(buffer,index,lookup_flag,mark_filtering_set);
-    return triplet.does_apply ? !(triplet.fina || triplet.medi || triplet.init) : HZ_FALSE;
+    if (curr == (HZ_JOINING_GROUP_NONE | HZ_JOINING_TYPE_U))
+        return 0;
+
+    hz_bool init = curr & (HZ_JOINING_TYPE_L | HZ_JOINING_TYPE_D)
+                && next & (HZ_JOINING_TYPE_R | HZ_JOINING_TYPE_D | HZ_JOINING_TYPE_C);
+
+    hz_bool fina = curr & (HZ_JOINING_TYPE_R | HZ_JOINING_TYPE_D)
+                && prev & (HZ_JOINING_TYPE_L | HZ_JOINING_TYPE_D | HZ_JOINING_TYPE_C);
+
+    hz_bool medi = curr & HZ_JOINING_TYPE_D
+                && prev & (HZ_JOINING_TYPE_L | HZ_JOINING_TYPE_C | HZ_JOINING_TYPE_D)
+                && next & (HZ_JOINING_TYPE_R | HZ_JOINING_TYPE_C | HZ_JOINING_TYPE_D);
+
+    if (medi) return HZ_JOINING_FORM_MEDI;
+    if (init && !fina) return HZ_JOINING_FORM_INIT;
+    if (fina && !init) return HZ_JOINING_FORM_FINA;
+    if (!init && !fina) return HZ_JOINING_FORM_ISOL;
+    return 0;
 }
 
-HZ_STATIC hz_bool
-hz_should_replace(hz_buffer_t *buffer,
-                  hz_feature_t feature,
-                  uint16_t node_index,
-                  uint16_t lookup_flag,
-                  const hz_coverage_t *mark_filtering_set)
-{
-    if (feature == HZ_FEATURE_INIT) {
-        return hz_shape_complex_arabic_init(buffer, node_index, lookup_flag, mark_filtering_set);
-    } else if (feature == HZ_FEATURE_MEDI) {
-        return hz_shape_complex_arabic_medi(buffer, node_index, lookup_flag, mark_filtering_set);
-    } else if (feature == HZ_FEATURE_FINA) {
-        return hz_shape_complex_arabic_fina(buffer, node_index, lookup_flag, mark_filtering_set);
-    } else if (feature == HZ_FEATURE_ISOL) {
-        return hz_shape_complex_arabic_isol(buffer, node_index, lookup_flag, mark_filtering_set);
+// Joining form of every glyph in a single pass. Marks are skipped over to find the neighbours of a glyph, the
+// ones after the last joining glyph wait with it for the next one. The glyph classes must be computed.
+HZ_STATIC void hz_buffer_compute_joining_forms(const hz_ucd_t *ucd, hz_buffer_t *buffer)
+{
+    size_t size = buffer->glyph_count;
+    hz_vector_resize(buffer->joining_forms, size);
+
+    const uint32_t none = HZ_JOINING_GROUP_NONE | HZ_JOINING_TYPE_T;
+    uint32_t prev = none, curr = none;
+    int64_t last = -1;
+
+    for (size_t g = 0; g <= size; ++g) {
+        if (g < size && hz_should_ignore_glyph(buffer, g, HZ_LOOKUP_FLAG_IGNORE_MARKS, NULL)) continue;
+
+        uint32_t next = g < size ? hz_ucd_get_arabic_joining_data(ucd, buffer->codepoints[g]) : none;
+        if (last != -1) {
+            buffer->joining_forms[last] = hz_arabic_joining_form(prev, curr, next);
+            prev = curr;
+        }
+
+        for (size_t k = (size_t)(last + 1); k < g; ++k) {
+            uint32_t joining = hz_ucd_get_arabic_joining_data(ucd, buffer->codepoints[k]);
+            buffer->joining_forms[k] = hz_arabic_joining_form(prev, joining, next);
+        }
+
+        last = (int64_t)g;
+        curr = next;
     }
 
-    return HZ_TRUE;
+    buffer->attrib_flags |= HZ_GLYPH_ATTRIB_JOINING_FORM_BIT;
+}
+
+// Joining form carried by a glyph, 0 when the buffer has none.
+#define hz_buffer_joining_form(b, i) (((b)->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT) ? (b)->joining_forms[i] : 0)
+
+HZ_STATIC HZ_INLINE hz_bool hz_is_joining_feature(hz_feature_t feature)
+{
+    return feature == HZ_FEATURE_INIT || feature == HZ_FEATURE_MEDI
+        || feature == HZ_FEATURE_FINA || feature == HZ_FEATURE_ISOL;
+}
+
+HZ_STATIC HZ_INLINE hz_bool
+hz_should_replace(const hz_buffer_t *buffer, hz_feature_t feature, size_t index)
+{
+    switch (feature) {
+        case HZ_FEATURE_INIT: return (buffer->joining_forms[index] & HZ_JOINING_FORM_INIT) != 0;
+        case HZ_FEATURE_MEDI: return (buffer->joining_forms[index] & HZ_JOINING_FORM_MEDI) != 0;
+        case HZ_FEATURE_FINA: return (buffer->joining_forms[index] & HZ_JOINING_FORM_FINA) != 0;
+        case HZ_FEATURE_ISOL: return (buffer->joining_forms[index] & HZ_JOINING_FORM_ISOL) != 0;
+        default: return HZ_TRUE;
+    }
 }
 
 typedef struct hz_range_t {
@@ -5272,45 +7808,103 @@ hz_range_list_search(hz_range_list_t *range_list, hz_segment_sz_t i)
     return -1; // NOT FOUND
 }
 
-/*  Function: hz_search_prev_glyph
- *      Find previous glyph while making use of m1 and m2 glyph class masks.
- *      It searches for a glyph with m2 classes and ensures the glyphs until then match with m1.
- *      NOTE: this is useful to implement MARK_TO_BASE or MARK_TO_LIGATURE positioning.
+/*  Function: hz_mark_attachments_compute
+ *      Finds the base, ligature and previous mark of every glyph in one forward pass. A glyph's base
+ *      or ligature is the closest one before it with only marks in between, which is the previous glyph's
+ *      own when that is a mark. The glyph classes must be computed, mem holds 7 entries per glyph.
+ */
+HZ_STATIC void hz_mark_attachments_compute(hz_mark_attachments_t *attachments, int32_t *mem, const hz_buffer_t *buffer)
+{
+    size_t size = buffer->glyph_count;
+    attachments->bases = mem;
+    attachments->ligatures = mem + size;
+    attachments->marks = mem + size * 2;
+    attachments->batch = mem + size * 3;
+
+    int32_t base = -1, ligature = -1, mark = -1;
+    for (size_t g = 0; g < size; ++g) {
+        attachments->bases[g] = base;
+        attachments->ligatures[g] = ligature;
+        attachments->marks[g] = mark;
+
+        uint16_t glyph_class = buffer->glyph_classes[g];
+        int32_t self = (int32_t)g;
+        hz_bool is_mark = (glyph_class & HZ_GLYPH_CLASS_MARK) != 0;
+        base = glyph_class & HZ_GLYPH_CLASS_BASE ? self : is_mark ? base : -1;
+        ligature = glyph_class & HZ_GLYPH_CLASS_LIGATURE ? self : is_mark ? ligature : -1;
+        mark = is_mark ? self : -1;
+    }
+}
+
+/*  Function: hz_search_unignored_glyph
+ *      Find the next glyph a lookup doesn't ignore, searching forwards when dir is 1 and backwards
+ *      when it is -1.
  *
  *  Returns:
  *      The index of the glyph in case of success, otherwise it returns -1.
  */
-HZ_STATIC int hz_search_prev_glyph(hz_buffer_t *buffer, int index, uint16_t m1, uint16_t m2)
+HZ_STATIC int hz_search_unignored_glyph(hz_buffer_t *buffer, int index, int dir, uint16_t flags, const hz_coverage_t *mark_filtering_set)
 {
-    --index;
-    while (index >= 0) {
-        if ((buffer->glyph_classes[index] & m2) == m2) {
-            // found
+    for (index += dir; index >= 0 && (size_t)index < buffer->glyph_count; index += dir) {
+        if (!hz_should_ignore_glyph(buffer, index, flags, mark_filtering_set))
             return index;
-        } else if ((buffer->glyph_classes[index] & m1) != m1) {
-            break;
-        }
-
-        --index;
     }
 
     return -1;
 }
 
-HZ_STATIC void
-hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
-                            hz_font_data_t *font_data,
-                            hz_feature_t feature,
-                            uint16_t lookup_index,
-                            hz_buffer_t *in, hz_buffer_t *out,
-                            int v1, int v2, int depth)
+/*  Function: hz_shaper_mark_unsafe
+ *      Records that glyphs g1 to g2 of buffer were shaped together, so the text can't be split
+ *      between the first and last of their clusters.
+ */
+HZ_STATIC void hz_shaper_mark_unsafe(hz_shaper_t *shaper, const hz_buffer_t *buffer, int g1, int g2)
 {
-    char tmp[8192];
-    hz_memory_arena_t arena = hz_memory_arena_create(tmp, sizeof tmp);
+    if (shaper->unsafe_to_break == NULL || g2 <= g1) return;
 
-    HZ_ASSERT(in != NULL && out != NULL);
-    HZ_ASSERT(in != out);
-    HZ_ASSERT(hz_buffer_contains_range(in,v1,v2));
+    uint32_t lo = buffer->clusters[g1], hi = lo;
+    for (int g = g1 + 1; g <= g2; ++g) {
+        lo = HZ_MIN(lo, buffer->clusters[g]);
+        hi = HZ_MAX(hi, buffer->clusters[g]);
+    }
+
+    for (uint32_t c = lo + 1; c <= hi; ++c)
+        shaper->unsafe_to_break[c] = 1;
+}
+
+// Characters whose joining forms depend on each other can't be shaped apart.
+HZ_STATIC void hz_shaper_mark_unsafe_joining(hz_shaper_t *shaper, hz_buffer_t *buffer)
+{
+    int prev = -1;
+    uint32_t prev_joining = 0;
+
+    for (size_t g = 0; g < buffer->glyph_count; ++g) {
+        if (hz_should_ignore_glyph(buffer, g, HZ_LOOKUP_FLAG_IGNORE_MARKS, NULL)) continue;
+
+        uint32_t joining = hz_ucd_get_arabic_joining_data(shaper->ucd, buffer->codepoints[g]);
+        if (prev != -1 && (prev_joining & (HZ_JOINING_TYPE_L | HZ_JOINING_TYPE_D | HZ_JOINING_TYPE_C))
+            && (joining & (HZ_JOINING_TYPE_R | HZ_JOINING_TYPE_D | HZ_JOINING_TYPE_C))) {
+            hz_shaper_mark_unsafe(shaper, buffer, prev, (int)g);
+        }
+
+        prev = (int)g;
+        prev_joining = joining;
+    }
+}
+
+HZ_STATIC void
+hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
+                            hz_font_data_t *font_data,
+                            hz_feature_t feature,
+                            uint16_t lookup_index,
+                            hz_buffer_t *in, hz_buffer_t *out,
+                            int v1, int v2, int depth)
+{
+    char tmp[8192];
+    hz_memory_arena_t arena = hz_memory_arena_create(tmp, sizeof tmp);
+
+    HZ_ASSERT(in != NULL && out != NULL);
+    HZ_ASSERT(in != out);
+    HZ_ASSERT(hz_buffer_contains_range(in,v1,v2));
 
     if (depth >= HZ_MAX_RECURSE_DEPTH) {
         // hit max recurse depth, wind back up the call stack
@@ -5326,7 +7920,8 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
     b1 = hz_buffer_create();
     b1->attrib_flags = in->attrib_flags;
     b2 = hz_buffer_create();
-    b2->attrib_flags = HZ_GLYPH_ATTRIB_INDEX_BIT | HZ_GLYPH_ATTRIB_CODEPOINT_BIT | HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT;
+    b2->attrib_flags = HZ_GLYPH_ATTRIB_INDEX_BIT | HZ_GLYPH_ATTRIB_CODEPOINT_BIT | HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT
+                     | HZ_GLYPH_ATTRIB_CLUSTER_BIT | (in->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT);
     hz_buffer_add_range(b1, in, v1, v2);
 
     for (uint16_t i = 0; i < table->subtable_count; ++i) {
@@ -5361,16 +7956,20 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                 // unignored
                                 for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
                                     int32_t index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
+                                    if (hz_should_replace(b1, feature, g)
                                         && (index = hz_coverage_search(&subtable->coverage, b1->glyph_indices[g])) != -1) {
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                 .id = b1->glyph_indices[g] + subtable->delta_glyph_id,
                                                 .codepoint = b1->codepoints[g],
+                                                .cluster = b1->clusters[g],
+                                                .joining_form = hz_buffer_joining_form(b1, g),
                                                 .component_index = b1->component_indices[g]});
                                     } else {
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                 .id = b1->glyph_indices[g],
                                                 .codepoint = b1->codepoints[g],
+                                                .cluster = b1->clusters[g],
+                                                .joining_form = hz_buffer_joining_form(b1, g),
                                                 .component_index = b1->component_indices[g]});
                                     }
                                 }
@@ -5389,16 +7988,20 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                             } else {
                                 for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
                                     int32_t index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
+                                    if (hz_should_replace(b1, feature, g)
                                         && (index = hz_coverage_search(&subtable->coverage, b1->glyph_indices[g])) != -1) {
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                                .id = subtable->substitute_glyph_ids[index],
+                                                .id = hz_table_u16(subtable->substitute_glyph_ids, index),
                                                 .codepoint = b1->codepoints[g],
+                                                .cluster = b1->clusters[g],
+                                                .joining_form = hz_buffer_joining_form(b1, g),
                                                 .component_index = b1->component_indices[g]});
                                     } else {
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                 .id = b1->glyph_indices[g],
                                                 .codepoint = b1->codepoints[g],
+                                                .cluster = b1->clusters[g],
+                                                .joining_form = hz_buffer_joining_form(b1, g),
                                                 .component_index = b1->component_indices[g]});
                                     }
                                 }
@@ -5423,20 +8026,24 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                             } else {
                                 for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
                                     int32_t index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
+                                    if (hz_should_replace(b1, feature, g)
                                         && (index = hz_coverage_search(&subtable->coverage, b1->glyph_indices[g])) != -1) {
                                         const hz_sequence_table_t *sequence = &subtable->sequences[index];
 
                                         for (uint16_t w = 0; w < sequence->glyph_count; ++w) {
                                             hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                                    .id = sequence->glyphs[w],
+                                                    .id = hz_table_u16(sequence->glyphs, w),
                                                     .codepoint = b1->codepoints[g],
+                                                    .cluster = b1->clusters[g],
+                                                    .joining_form = hz_buffer_joining_form(b1, g),
                                                     .component_index = b1->component_indices[g]});
                                         }
                                     } else {
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                 .id = b1->glyph_indices[g],
                                                 .codepoint = b1->codepoints[g],
+                                                .cluster = b1->clusters[g],
+                                                .joining_form = hz_buffer_joining_form(b1, g),
                                                 .component_index = b1->component_indices[g]});
                                     }
                                 }
@@ -5466,7 +8073,7 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                     hz_bool matched = HZ_FALSE;
 
                                     int32_t index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
+                                    if (hz_should_replace(b1, feature, g)
                                         && (index = hz_coverage_search(&subtable->coverage, b1->glyph_indices[g])) != -1) {
                                         const hz_ligature_set_table_t *ligature_set = subtable->ligature_sets + index;
 
@@ -5480,23 +8087,22 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                                 int test = 1;
                                                 if (component_count >= 2) {
                                                     // There are enough unignored glyphs until the end of the buffer
-                                                    // to load component glyphs. This could be possibly optimized later with
-                                                    // SSE/AVX2 (gather,cmp,shuffle)
-                                                    hz_memory_arena_reset(&arena);
-                                                    hz_index_t *block = hz_memory_arena_alloc(&arena, (component_count - 1) * 2);
-                                                    
-                                                    for (uint16_t k = 0; k < component_count-1; ++k) {
-                                                        block[k] = b1->glyph_indices[range_list->unignored_indices[s1 + k + 1]];
+                                                    // to compare the component glyphs.
+                                                    for (uint16_t k = 0; test && k < component_count-1; ++k) {
+                                                        test = hz_table_u16(ligature->component_glyph_ids, k)
+                                                            == b1->glyph_indices[range_list->unignored_indices[s1 + k + 1]];
                                                     }
-
-                                                    test = !memcmp(ligature->component_glyph_ids, block, (component_count-1)*2);
                                                 }
 
                                                 if (test) {
+                                                    hz_shaper_mark_unsafe(shaper, b1, g, range_list->unignored_indices[s2]);
+
                                                     // GID match found with ligature, push ligature glyph to buffer
                                                     hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                             .id = ligature->ligature_glyph,
                                                             .codepoint = 0,
+                                                            .cluster = b1->clusters[g],
+                                                            .joining_form = hz_buffer_joining_form(b1, g),
                                                             .component_index = b1->component_indices[g]});
 
                                                     // Push ignored glyphs found within the matched range
@@ -5507,6 +8113,8 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                                             hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                                 .id = b1->glyph_indices[m],
                                                                 .codepoint = b1->codepoints[m],
+                                                                .cluster = b1->clusters[m],
+                                                                .joining_form = hz_buffer_joining_form(b1, m),
                                                                 .component_index = k-s1});
                                                         }
                                                     }
@@ -5528,6 +8136,8 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                             .id = b1->glyph_indices[g],
                                             .codepoint = b1->codepoints[g],
+                                            .cluster = b1->clusters[g],
+                                            .joining_form = hz_buffer_joining_form(b1, g),
                                             .component_index = b1->component_indices[g]});
                                     }
                                 }
@@ -5555,7 +8165,7 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                             } else {
                                 for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
                                     hz_bool match = HZ_FALSE;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
+                                    if (hz_should_replace(b1, feature, g)
                                         && hz_coverage_contains(&subtable->coverage, b1->glyph_indices[g])) {
                                         for (uint16_t m = 0; m < subtable->rule_set_count; ++m) {
                                             hz_chained_sequence_rule_set_t *rs = &subtable->rule_sets[m];
@@ -5602,6 +8212,9 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
 
                                                     // compare context with current glyph sequence
                                                     if (!memcmp(context, sequence, context_len*2)) {
+                                                        hz_shaper_mark_unsafe(shaper, b1, range_list->unignored_indices[u1],
+                                                                              range_list->unignored_indices[u2]);
+
                                                         // if match, apply nested lookups
                                                         hz_segment_sz_t context_low = range_list->unignored_indices[u];
                                                         hz_segment_sz_t context_high = range_list->unignored_indices[u + rule->input_count];
@@ -5650,6 +8263,8 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                 .id = b1->glyph_indices[g],
                                                 .codepoint = b1->codepoints[g],
+                                                .cluster = b1->clusters[g],
+                                                .joining_form = hz_buffer_joining_form(b1, g),
                                                 .component_index = b1->component_indices[g]});
                                     }
                                 }
@@ -5675,7 +8290,7 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                 // unignored
                                 for (short g = range->mn; g <= range->mx; ++g) {
                                     hz_bool match = HZ_FALSE;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)) {
+                                    if (hz_should_replace(b1, feature, g)) {
                                         // context bounds check, if this doesn't fit inside the original range
                                         // this context is impossible to match
                                         int u = range->base + (g - range->mn);
@@ -5718,6 +8333,9 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                             }
 
                                             if (input_match && suffix_match && prefix_match) {
+                                                hz_shaper_mark_unsafe(shaper, b1, range_list->unignored_indices[u1],
+                                                                      range_list->unignored_indices[u2]);
+
                                                 // if match, apply nested lookups
                                                 hz_segment_sz_t context_low = range_list->unignored_indices[u];
                                                 hz_segment_sz_t context_high = range_list->unignored_indices[u + subtable->input_count - 1];
@@ -5763,6 +8381,8 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
                                         hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
                                                 .id = b1->glyph_indices[g],
                                                 .codepoint = b1->codepoints[g],
+                                                .cluster = b1->clusters[g],
+                                                .joining_form = hz_buffer_joining_form(b1, g),
                                                 .component_index = b1->component_indices[g]});
                                     }
                                 }
@@ -5796,7 +8416,8 @@ hz_shaper_apply_gsub_lookup(hz_shaper_t *shaper,
 
 void hz_apply_value_record_adjustments(hz_glyph_metrics_t *metrics,
                                        const hz_value_record_t *value_record,
-                                       uint16_t value_format)
+                                       uint16_t value_format,
+                                       const hz_variation_instance_t *instance)
 {
     if (value_format & HZ_VALUE_FORMAT_X_ADVANCE)
         metrics->xAdvance += value_record->xAdvance;
@@ -5806,22 +8427,45 @@ void hz_apply_value_record_adjustments(hz_glyph_metrics_t *metrics,
         metrics->xOffset += value_record->xPlacement;
     if (value_format & HZ_VALUE_FORMAT_Y_PLACEMENT)
         metrics->yOffset += value_record->yPlacement;
+
+    if (instance != NULL) {
+        const hz_variation_deltas_t *deltas = &instance->gdef_deltas;
+        if (value_format & HZ_VALUE_FORMAT_X_ADVANCE_DEVICE)
+            metrics->xAdvance += hz_variation_deltas_get(deltas, value_record->xAdvVarIndex);
+        if (value_format & HZ_VALUE_FORMAT_Y_ADVANCE_DEVICE)
+            metrics->yAdvance += hz_variation_deltas_get(deltas, value_record->yAdvVarIndex);
+        if (value_format & HZ_VALUE_FORMAT_X_PLACEMENT_DEVICE)
+            metrics->xOffset += hz_variation_deltas_get(deltas, value_record->xPlaVarIndex);
+        if (value_format & HZ_VALUE_FORMAT_Y_PLACEMENT_DEVICE)
+            metrics->yOffset += hz_variation_deltas_get(deltas, value_record->yPlaVarIndex);
+    }
 }
 
+/*  Function: hz_shaper_apply_gpos_lookup
+ *      Applies a GPOS lookup to glyphs v1 to v2 of a buffer. Positioning never changes the glyph count,
+ *      so the lookup adjusts the buffer's metrics in place. Context and attachment searches can read
+ *      glyphs outside of the range.
+ *
+ *  Parameters:
+ *      shaper - The shaper.
+ *      font_data - The font data holding the GPOS table.
+ *      feature - The feature the lookup belongs to.
+ *      lookup_index - Index of the lookup in the GPOS lookup list.
+ *      buffer - The buffer to position, its glyph classes must be computed.
+ *      v1 - First glyph to position.
+ *      v2 - Last glyph to position.
+ *      depth - Nesting depth of the lookup.
+ */
 void
 hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
                             hz_font_data_t *font_data,
                             hz_feature_t feature,
                             uint16_t lookup_index,
-                            hz_buffer_t *in, hz_buffer_t *out,
+                            hz_buffer_t *buffer,
                             int v1, int v2, int depth)
 {
-    char tmp[4096];
-    hz_memory_arena_t arena = hz_memory_arena_create(tmp, sizeof tmp);
-
-    HZ_ASSERT(in != NULL && out != NULL);
-    HZ_ASSERT(in != out);
-    HZ_ASSERT(hz_buffer_contains_range(in,v1,v2));
+    HZ_ASSERT(buffer != NULL);
+    HZ_ASSERT(hz_buffer_contains_range(buffer,v1,v2));
 
     if (depth >= HZ_MAX_RECURSE_DEPTH) {
         // hit max recurse depth, wind back up the call stack
@@ -5829,47 +8473,27 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
     }
 
     const hz_lookup_table_t *table = &font_data->gpos_table.lookups[lookup_index];
-    hz_face_t *face = font_data->face;
-
-    // copy segment glyph ids and info into a read-only buffer
-    hz_buffer_t *b1, *b2;
-    b1 = hz_buffer_create();
-    b1->attrib_flags = in->attrib_flags;
-    b2 = hz_buffer_create();
-    b2->attrib_flags = HZ_GLYPH_ATTRIB_METRICS_BIT;
-    hz_buffer_add_range(b1, in, v1, v2);
+    uint16_t flags = table->lookup_flags;
+    const hz_coverage_t *mark_filtering_set = table->mark_filtering_set;
+    const uint16_t *ids = buffer->glyph_indices;
+    hz_glyph_metrics_t *metrics = buffer->glyph_metrics;
 
     for (uint16_t i = 0; i < table->subtable_count; ++i) {
         hz_lookup_subtable_t *base = table->subtables[i];
         if (base == NULL) continue;
         // subtable requested is loaded
-        hz_memory_arena_reset(&arena);
-        hz_buffer_compute_info(b1, face);
-        hz_range_list_t *range_list = hz_compute_range_list(b1, table->lookup_flags, table->mark_filtering_set);
 
         switch (table->lookup_type) {
             case HZ_GPOS_LOOKUP_TYPE_SINGLE_ADJUSTMENT: {
                 switch (base->format) {
                     case 1: {
                         hz_single_adjustment_format1_subtable_t *subtable = (hz_single_adjustment_format1_subtable_t *)base;
-                        for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                            hz_range_t *range = &range_list->ranges[r];
-
-                            if (range->is_ignored) {
-                                hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                            } else {
-                                for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
-                                    hz_glyph_metrics_t metrics = b1->glyph_metrics[g];
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set) &&
-                                        hz_coverage_contains(&subtable->coverage, b1->glyph_indices[g])) {
-                                        hz_apply_value_record_adjustments(&metrics, &subtable->value_record,
-                                                                            subtable->value_format);
-                                    }
-                                    
-                                    hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                        .metrics = metrics
-                                    });
-                                }
+                        for (int g = v1; g <= v2; ++g) {
+                            if (!hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                                && hz_should_replace(buffer, feature, g)
+                                && hz_coverage_contains(&subtable->coverage, ids[g])) {
+                                hz_apply_value_record_adjustments(&metrics[g], &subtable->value_record,
+                                                                  subtable->value_format, shaper->instance);
                             }
                         }
 
@@ -5878,29 +8502,17 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
 
                     case 2: {
                         hz_single_adjustment_format2_subtable_t *subtable = (hz_single_adjustment_format2_subtable_t *)base;
-                        for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                            hz_range_t *range = &range_list->ranges[r];
-
-                            if (range->is_ignored) {
-                                hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                            } else {
-                                for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
-                                    hz_glyph_metrics_t metrics = b1->glyph_metrics[g];
-
-                                    int32_t record_index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set) &&
-                                        (record_index = hz_coverage_search(&subtable->coverage, b1->glyph_indices[g]))!= -1 ) {
-                                        hz_apply_value_record_adjustments(&metrics,
-                                                                            &subtable->value_records[record_index],
-                                                                            subtable->value_format);
-                                    }
-
-                                    hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                            .metrics = metrics
-                                    });
-                                }
+                        for (int g = v1; g <= v2; ++g) {
+                            int32_t record_index;
+                            if (!hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                                && hz_should_replace(buffer, feature, g)
+                                && (record_index = hz_coverage_search(&subtable->coverage, ids[g])) != -1) {
+                                hz_apply_value_record_adjustments(&metrics[g],
+                                                                  &subtable->value_records[record_index],
+                                                                  subtable->value_format, shaper->instance);
                             }
                         }
+
                         break;
                     }
                 }
@@ -5911,92 +8523,56 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
                 switch (base->format) {
                     case 1: {
                         hz_pair_pos_format1_subtable_t *subtable = (hz_pair_pos_format1_subtable_t *)base;
-                        for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                            hz_range_t *range = &range_list->ranges[r];
-
-                            if (range->is_ignored) {
-                                hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                            } else {
-                                for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
-                                    int32_t cov_index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
-                                        && (cov_index = hz_coverage_search(&subtable->coverage, b1->glyph_indices[g])) != -1) {
-                                        hz_segment_sz_t base_idx = range->base + (g - range->mn);
-
-                                        if (base_idx+1 < hz_vector_size(range_list->unignored_indices)) {
-                                            hz_segment_sz_t g2 = range_list->unignored_indices[base_idx + 1];
-                                            hz_pair_set_t *pair_set = &subtable->pair_sets[cov_index];
-
-                                            for (uint16_t pv = 0; pv < pair_set->pair_value_count; ++pv) {
-                                                hz_pair_value_record_t *pair_value_record = &pair_set->pair_value_records[pv];
-                                                if (pair_value_record->second_glyph == b1->glyph_indices[g2]) {
-                                                    // HACK: Adjust the two glyphs in b1 directly,
-                                                    // haven't had time or peace to think about what's best to do in this case
-                                                    // where we have to write to multiple locations. This should be good enough
-                                                    // in most cases.
-                                                    hz_apply_value_record_adjustments(&b1->glyph_metrics[g],
-                                                                                        &pair_value_record->value_record1,
-                                                                                        subtable->value_format1);
-
-                                                    hz_apply_value_record_adjustments(&b1->glyph_metrics[g2],
-                                                                                        &pair_value_record->value_record2,
-                                                                                        subtable->value_format2);
-
-                                                    break;
-                                                }
-                                            }
-                                        }
+                        for (int g = v1; g <= v2; ++g) {
+                            int32_t cov_index;
+                            int g2;
+                            if (!hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                                && hz_should_replace(buffer, feature, g)
+                                && (cov_index = hz_coverage_search(&subtable->coverage, ids[g])) != -1
+                                && (g2 = hz_search_unignored_glyph(buffer, g, 1, flags, mark_filtering_set)) != -1) {
+                                hz_pair_set_t *pair_set = &subtable->pair_sets[cov_index];
+
+                                for (uint16_t pv = 0; pv < pair_set->pair_value_count; ++pv) {
+                                    hz_pair_value_record_t *pair_value_record = &pair_set->pair_value_records[pv];
+                                    if (pair_value_record->second_glyph == ids[g2]) {
+                                        hz_shaper_mark_unsafe(shaper, buffer, g, g2);
+                                        hz_apply_value_record_adjustments(&metrics[g],
+                                                                          &pair_value_record->value_record1,
+                                                                          subtable->value_format1, shaper->instance);
+
+                                        hz_apply_value_record_adjustments(&metrics[g2],
+                                                                          &pair_value_record->value_record2,
+                                                                          subtable->value_format2, shaper->instance);
+
+                                        break;
                                     }
-
-                                    hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                            .metrics = b1->glyph_metrics[g]
-                                    });
                                 }
                             }
                         }
 
-
                         break;
                     }
 
                     case 2: {
                         hz_pair_pos_format2_subtable_t *subtable = (hz_pair_pos_format2_subtable_t *)base;
-                        for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                            hz_range_t *range = &range_list->ranges[r];
-
-                            if (range->is_ignored) {
-                                hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                            } else {
-                                // unignored
-                                for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
-                                    
-                                    int32_t class1_index, class2_index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
-                                        && (class1_index = hz_coverage_search(&subtable->coverage, b1->glyph_indices[g])) != -1) {
-                                        hz_segment_sz_t base_idx = range->base + (g - range->mn);
-
-                                        if (base_idx+1 < hz_vector_size(range_list->unignored_indices)) {
-                                            hz_segment_sz_t g2 = range_list->unignored_indices[base_idx + 1];
-                
-                                            if ((class1_index = hz_class_def_search(&subtable->class_def1, b1->glyph_classes[g])) != -1
-                                                && (class2_index = hz_class_def_search(&subtable->class_def2, b1->glyph_classes[g2])) != -1) {
-
-                                                const hz_class2_record_t *class2_record = &subtable->class1_records[class1_index].class2_records[class2_index];
-                                                hz_apply_value_record_adjustments(&b1->glyph_metrics[g],
-                                                                                    &class2_record->value_record1,
-                                                                                    subtable->value_format1);
-
-                                                hz_apply_value_record_adjustments(&b1->glyph_metrics[g2],
-                                                                                    &class2_record->value_record2,
-                                                                                    subtable->value_format2);
-                                            }
-                                        }
-                                    }
-
-                                    hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                            .metrics = b1->glyph_metrics[g]
-                                    });
-                                }
+                        for (int g = v1; g <= v2; ++g) {
+                            int32_t class1_index, class2_index;
+                            int g2;
+                            if (!hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                                && hz_should_replace(buffer, feature, g)
+                                && hz_coverage_contains(&subtable->coverage, ids[g])
+                                && (g2 = hz_search_unignored_glyph(buffer, g, 1, flags, mark_filtering_set)) != -1
+                                && (class1_index = hz_class_def_search(&subtable->class_def1, ids[g])) != -1
+                                && (class2_index = hz_class_def_search(&subtable->class_def2, ids[g2])) != -1) {
+                                const hz_class2_record_t *class2_record = &subtable->class1_records[class1_index].class2_records[class2_index];
+                                hz_shaper_mark_unsafe(shaper, buffer, g, g2);
+                                hz_apply_value_record_adjustments(&metrics[g],
+                                                                  &class2_record->value_record1,
+                                                                  subtable->value_format1, shaper->instance);
+
+                                hz_apply_value_record_adjustments(&metrics[g2],
+                                                                  &class2_record->value_record2,
+                                                                  subtable->value_format2, shaper->instance);
                             }
                         }
 
@@ -6010,44 +8586,117 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
                 break;
             }
             case HZ_GPOS_LOOKUP_TYPE_CURSIVE_ATTACHMENT: {
+                hz_cursive_attachment_format1_subtable_t *subtable = (hz_cursive_attachment_format1_subtable_t *)base;
+                int32_t *children = shaper->attachments->batch, *parents = children + buffer->glyph_count;
+                int32_t *cross = parents + buffer->glyph_count;
+                size_t count = 0;
+
+                for (int g = v1; g <= v2; ++g) {
+                    int32_t exit_index, entry_index;
+                    int g2;
+                    if (!hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                        && hz_should_replace(buffer, feature, g)
+                        && (exit_index = hz_coverage_search(&subtable->coverage, ids[g])) != -1
+                        && subtable->entry_exit_records[exit_index].has_exit
+                        && (g2 = hz_search_unignored_glyph(buffer, g, 1, flags, mark_filtering_set)) != -1
+                        && (entry_index = hz_coverage_search(&subtable->coverage, ids[g2])) != -1
+                        && subtable->entry_exit_records[entry_index].has_entry) {
+                        hz_shaper_mark_unsafe(shaper, buffer, g, g2);
+                        hz_anchor_t exit = hz_vary_anchor(shaper->instance, &subtable->entry_exit_records[exit_index].exit);
+                        hz_anchor_t entry = hz_vary_anchor(shaper->instance, &subtable->entry_exit_records[entry_index].entry);
+                        hz_glyph_metrics_t *m1 = &metrics[g], *m2 = &metrics[g2];
+                        int32_t d;
+
+                        // the exit of the first glyph meets the entry of the second along the direction of the text
+                        switch (shaper->direction) {
+                            case HZ_DIRECTION_LTR:
+                                m1->xAdvance = exit.x_coord + m1->xOffset;
+                                d = entry.x_coord + m2->xOffset;
+                                m2->xAdvance -= d;
+                                m2->xOffset -= d;
+                                break;
+                            case HZ_DIRECTION_RTL:
+                                d = exit.x_coord + m1->xOffset;
+                                m1->xAdvance -= d;
+                                m1->xOffset -= d;
+                                m2->xAdvance = entry.x_coord + m2->xOffset;
+                                break;
+                            case HZ_DIRECTION_TTB:
+                                m1->yAdvance = exit.y_coord + m1->yOffset;
+                                d = entry.y_coord + m2->yOffset;
+                                m2->yAdvance -= d;
+                                m2->yOffset -= d;
+                                break;
+                            case HZ_DIRECTION_BTT:
+                                d = exit.y_coord + m1->yOffset;
+                                m1->yAdvance -= d;
+                                m1->yOffset -= d;
+                                m2->yAdvance = entry.y_coord;
+                                break;
+                            default:
+                                break;
+                        }
+
+                        // across it the first glyph of the chain stays in place, the last one with the RIGHT_TO_LEFT flag
+                        hz_bool first_is_root = !(flags & HZ_LOOKUP_FLAG_RIGHT_TO_LEFT);
+                        hz_bool vertical = HZ_DIRECTION_IS_VERTICAL(shaper->direction);
+                        int32_t offset = vertical ? entry.x_coord - exit.x_coord : entry.y_coord - exit.y_coord;
+                        children[count] = first_is_root ? g2 : g;
+                        parents[count] = first_is_root ? g : g2;
+                        cross[count] = first_is_root ? -offset : offset;
+                        ++count;
+                    }
+                }
+
+                // each parent is resolved before its children, in one pass along the chains
+                for (size_t k = 0; k < count; ++k) {
+                    size_t i = flags & HZ_LOOKUP_FLAG_RIGHT_TO_LEFT ? count - 1 - k : k;
+                    hz_glyph_metrics_t *child = &metrics[children[i]], *parent = &metrics[parents[i]];
+                    if (HZ_DIRECTION_IS_VERTICAL(shaper->direction))
+                        child->xOffset = cross[i] + parent->xOffset;
+                    else
+                        child->yOffset = cross[i] + parent->yOffset;
+                }
+
                 break;
             }
             case HZ_GPOS_LOOKUP_TYPE_MARK_TO_BASE_ATTACHMENT: {
                 switch (base->format) {
                     case 1: {
                         hz_mark_to_base_attachment_subtable_t *subtable = (hz_mark_to_base_attachment_subtable_t *)base;
+                        const hz_mark_attachments_t *attachments = shaper->attachments;
+                        int32_t *marks = attachments->batch, *bases = marks + buffer->glyph_count;
+                        int32_t *dx = bases + buffer->glyph_count, *dy = dx + buffer->glyph_count;
+                        size_t count = 0;
 
-                        for (size_t g = 0; g < b1->glyph_count; ++g) {
-                            hz_glyph_metrics_t metrics = b1->glyph_metrics[g];
-
+                        // anchors are resolved first, the placements are then applied in one pass
+                        for (int g = v1; g <= v2; ++g) {
                             int32_t mark_index, base_index;
-                            if (!hz_should_ignore_glyph(b1, g, table->lookup_flags, table->mark_filtering_set)
-                               && (mark_index = hz_coverage_search(&subtable->mark_coverage, b1->glyph_indices[g])) != -1)
+                            int prev_base = attachments->bases[g];
+                            if (prev_base != -1
+                               && !hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                               && (mark_index = hz_coverage_search(&subtable->mark_coverage, ids[g])) != -1
+                               && (base_index = hz_coverage_search(&subtable->base_coverage, ids[prev_base])) != -1)
                             {
-                                hz_segment_sz_t prev_base = hz_search_prev_glyph(b1, g, HZ_GLYPH_CLASS_MARK, HZ_GLYPH_CLASS_BASE);
-                                if (prev_base != -1 && (base_index = hz_coverage_search(&subtable->base_coverage, b1->glyph_indices[prev_base])) != -1) {
-                                    // both coverages match
-                                    hz_mark_record_t *mark_record = &subtable->mark_array.mark_records[mark_index];
-                                    hz_anchor_t *base_anchor = &subtable->base_array.base_records[base_index].base_anchors[mark_record->mark_class];
-                                    hz_anchor_t *mark_anchor = &mark_record->mark_anchor;
-
-                                    hz_glyph_metrics_t base_metrics = b1->glyph_metrics[prev_base];
-                                    int32_t placement_x1 = mark_anchor->x_coord - base_metrics.xOffset;
-                                    int32_t placement_y1 = mark_anchor->y_coord - base_metrics.yOffset;
-                                    int32_t placement_x2 = base_anchor->x_coord + base_metrics.xOffset;
-                                    int32_t placement_y2 = base_anchor->y_coord + base_metrics.yOffset;
-
-                                    int32_t xOffset = placement_x2 - placement_x1;
-                                    int32_t yOffset = placement_y2 - placement_y1;
-
-                                    metrics.xOffset = xOffset;
-                                    metrics.yOffset = yOffset;
-                                }
+                                // both coverages match
+                                hz_shaper_mark_unsafe(shaper, buffer, prev_base, g);
+                                hz_mark_record_t *mark_record = &subtable->mark_array.mark_records[mark_index];
+                                hz_anchor_t base_anchor = hz_vary_anchor(shaper->instance, &subtable->base_array.base_records[base_index].base_anchors[mark_record->mark_class]);
+                                hz_anchor_t mark_anchor = hz_vary_anchor(shaper->instance, &mark_record->mark_anchor);
+
+                                marks[count] = g;
+                                bases[count] = prev_base;
+                                dx[count] = base_anchor.x_coord - mark_anchor.x_coord;
+                                dy[count] = base_anchor.y_coord - mark_anchor.y_coord;
+                                ++count;
                             }
+                        }
 
-                            hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                    .metrics = metrics
-                            });
+                        // the base's offset moves both of the anchors
+                        for (size_t i = 0; i < count; ++i) {
+                            hz_glyph_metrics_t base_metrics = metrics[bases[i]];
+                            metrics[marks[i]].xOffset = dx[i] + base_metrics.xOffset * 2;
+                            metrics[marks[i]].yOffset = dy[i] + base_metrics.yOffset * 2;
                         }
 
                         break;
@@ -6058,50 +8707,32 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
 
             case HZ_GPOS_LOOKUP_TYPE_MARK_TO_LIGATURE_ATTACHMENT: {
                 hz_mark_to_ligature_attachment_format1_subtable_t *subtable = (hz_mark_to_ligature_attachment_format1_subtable_t *)base;
-                for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                    hz_range_t *range = &range_list->ranges[r];
-                    if (range->is_ignored) {
-                        hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                    } else {
-                        for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
-                            hz_glyph_metrics_t metrics = b1->glyph_metrics[g];
-
-                            int32_t cov_index1, cov_index2;
-                            if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
-                                && (cov_index1 = hz_coverage_search(&subtable->mark_coverage, b1->glyph_indices[g])) != -1) {
-                                int prev_ligature = hz_search_prev_glyph(b1, g, HZ_GLYPH_CLASS_MARK, HZ_GLYPH_CLASS_LIGATURE);
-                                if (prev_ligature != -1) {
-                                    if ((cov_index2 = hz_coverage_search(&subtable->ligature_coverage, b1->glyph_indices[prev_ligature])) != -1) {
-                                        // both coverages match
-                                        uint16_t component_index = b1->component_indices[g];
-                                        uint16_t attachment_class = b1->attachment_classes[g];
-                                        
-                                        uint16_t mark_index = cov_index1;
-                                        uint16_t ligature_index = cov_index2;
-                                        hz_mark_record_t *mark_record = &subtable->mark_array.mark_records[mark_index];
-                                        hz_ligature_attachment_t *ligature_attachment = &subtable->ligature_array.ligature_attachments[ligature_index];
-                                        hz_component_record_t *component = &ligature_attachment->component_records[component_index];
-                                        hz_anchor_t *mark_anchor = &mark_record->mark_anchor;
-                                        hz_anchor_t *ligature_anchor = &component->ligature_anchors[mark_record->mark_class];
-
-                                        hz_glyph_metrics_t lig_metrics = b1->glyph_metrics[prev_ligature];
-                                        int32_t placement_x1 = mark_anchor->x_coord;
-                                        int32_t placement_y1 = mark_anchor->y_coord;
-                                        int32_t placement_x2 = ligature_anchor->x_coord + lig_metrics.xOffset;
-                                        int32_t placement_y2 = ligature_anchor->y_coord + lig_metrics.yOffset;// + lig_metrics.yAdvance;// - lig_metrics.yAdvance;
-
-                                        int32_t xOffset = placement_x2 - placement_x1;// + lig_metrics.xAdvance;
-                                        int32_t yOffset = placement_y2 - placement_y1;// + lig_metrics.yAdvance;
-
-                                        metrics.xOffset = xOffset;
-                                        metrics.yOffset = yOffset;
-                                    }   
-                                }
-                            }
-
-                            hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                .metrics = metrics
-                            });
+                for (int g = v1; g <= v2; ++g) {
+                    int32_t cov_index1, cov_index2;
+                    if (!hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                        && hz_should_replace(buffer, feature, g)
+                        && (cov_index1 = hz_coverage_search(&subtable->mark_coverage, ids[g])) != -1) {
+                        int prev_ligature = shaper->attachments->ligatures[g];
+                        if (prev_ligature != -1
+                            && (cov_index2 = hz_coverage_search(&subtable->ligature_coverage, ids[prev_ligature])) != -1) {
+                            // both coverages match
+                            hz_shaper_mark_unsafe(shaper, buffer, prev_ligature, g);
+                            uint16_t component_index = buffer->component_indices[g];
+
+                            hz_mark_record_t *mark_record = &subtable->mark_array.mark_records[cov_index1];
+                            hz_ligature_attachment_t *ligature_attachment = &subtable->ligature_array.ligature_attachments[cov_index2];
+                            hz_component_record_t *component = &ligature_attachment->component_records[component_index];
+                            hz_anchor_t mark_anchor = hz_vary_anchor(shaper->instance, &mark_record->mark_anchor);
+                            hz_anchor_t ligature_anchor = hz_vary_anchor(shaper->instance, &component->ligature_anchors[mark_record->mark_class]);
+
+                            hz_glyph_metrics_t lig_metrics = metrics[prev_ligature];
+                            int32_t placement_x1 = mark_anchor.x_coord;
+                            int32_t placement_y1 = mark_anchor.y_coord;
+                            int32_t placement_x2 = ligature_anchor.x_coord + lig_metrics.xOffset;
+                            int32_t placement_y2 = ligature_anchor.y_coord + lig_metrics.yOffset;
+
+                            metrics[g].xOffset = placement_x2 - placement_x1;
+                            metrics[g].yOffset = placement_y2 - placement_y1;
                         }
                     }
                 }
@@ -6113,46 +8744,31 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
                 switch (base->format) {
                     case 1 : {
                         hz_mark_to_mark_attachment_format1_subtable_t *subtable = (hz_mark_to_mark_attachment_format1_subtable_t *)base;
-                        for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                            hz_range_t *range = &range_list->ranges[r];
-
-                            if (range->is_ignored) {
-                                hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                            } else {
-                                for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
-                                    hz_glyph_metrics_t metrics = b1->glyph_metrics[g];
-                                    int32_t mark1_index, mark2_index;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)) {
-                                        int prev_mark = hz_search_prev_glyph(b1, g, HZ_GLYPH_CLASS_MARK, HZ_GLYPH_CLASS_MARK);//range->base + (g - range->mn) - 1;
-                                        if (prev_mark != -1) {
-                                            if ((mark2_index = hz_coverage_search(&subtable->mark2_coverage, b1->glyph_indices[prev_mark])) != -1 &&
-                                                ( mark1_index = hz_coverage_search(&subtable->mark1_coverage, b1->glyph_indices[g])) != -1 &&
-                                                (b1->component_indices[g] == b1->component_indices[prev_mark]))
-                                            {
-                                                // valid second mark found
-                                                hz_mark_record_t *mark_record = &subtable->mark1_array.mark_records[mark1_index];
-                                                hz_mark2_record_t *mark2_record = &subtable->mark2_array.mark2_records[mark2_index];
-                                                hz_anchor_t *base_anchor = &mark2_record->mark2_anchors[mark_record->mark_class];
-                                                hz_anchor_t *mark_anchor = &mark_record->mark_anchor;
-
-                                                hz_glyph_metrics_t base_metrics = b1->glyph_metrics[prev_mark];
-                                                int32_t placement_x1 = mark_anchor->x_coord;
-                                                int32_t placement_y1 = mark_anchor->y_coord;
-                                                int32_t placement_x2 = base_anchor->x_coord + base_metrics.xOffset;
-                                                int32_t placement_y2 = base_anchor->y_coord + base_metrics.yOffset;
-
-                                                int32_t xOffset = placement_x2 - placement_x1;
-                                                int32_t yOffset = placement_y2 - placement_y1;
-
-                                                metrics.xOffset = xOffset;
-                                                metrics.yOffset = yOffset;
-                                            }
-                                        }
-                                    }
-
-                                    hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                            .metrics = metrics
-                                    });
+                        for (int g = v1; g <= v2; ++g) {
+                            int32_t mark1_index, mark2_index;
+                            if (!hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                                && hz_should_replace(buffer, feature, g)) {
+                                int prev_mark = shaper->attachments->marks[g];
+                                if (prev_mark != -1
+                                    && (mark2_index = hz_coverage_search(&subtable->mark2_coverage, ids[prev_mark])) != -1
+                                    && (mark1_index = hz_coverage_search(&subtable->mark1_coverage, ids[g])) != -1
+                                    && buffer->component_indices[g] == buffer->component_indices[prev_mark])
+                                {
+                                    // valid second mark found, positioned relative to where this pass already put it
+                                    hz_shaper_mark_unsafe(shaper, buffer, prev_mark, g);
+                                    hz_mark_record_t *mark_record = &subtable->mark1_array.mark_records[mark1_index];
+                                    hz_mark2_record_t *mark2_record = &subtable->mark2_array.mark2_records[mark2_index];
+                                    hz_anchor_t base_anchor = hz_vary_anchor(shaper->instance, &mark2_record->mark2_anchors[mark_record->mark_class]);
+                                    hz_anchor_t mark_anchor = hz_vary_anchor(shaper->instance, &mark_record->mark_anchor);
+
+                                    hz_glyph_metrics_t base_metrics = metrics[prev_mark];
+                                    int32_t placement_x1 = mark_anchor.x_coord;
+                                    int32_t placement_y1 = mark_anchor.y_coord;
+                                    int32_t placement_x2 = base_anchor.x_coord + base_metrics.xOffset;
+                                    int32_t placement_y2 = base_anchor.y_coord + base_metrics.yOffset;
+
+                                    metrics[g].xOffset = placement_x2 - placement_x1;
+                                    metrics[g].yOffset = placement_y2 - placement_y1;
                                 }
                             }
                         }
@@ -6173,115 +8789,61 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
                     case 1: {
                         hz_chained_sequence_context_format1_subtable_t *subtable = (hz_chained_sequence_context_format1_subtable_t *)base;
 
-                        for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                            const hz_range_t *range = &range_list->ranges[r];
-
-                            if (range->is_ignored) {
-                                hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                            } else {
-                                for (hz_segment_sz_t g = range->mn; g <= range->mx; ++g) {
-                                    hz_bool match = HZ_FALSE;
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)
-                                        && hz_coverage_contains(&subtable->coverage, b1->glyph_indices[g]))  {
-                                        for (uint16_t m = 0; m < subtable->rule_set_count; ++m) {
-                                            hz_chained_sequence_rule_set_t *rs = &subtable->rule_sets[m];
-                                            for (uint16_t n = 0; n < rs->count; ++n) {
-                                                // fill both context and sequence buffers, use memcmp to quickly check if they are matching
-                                                // context
-                                                hz_chained_sequence_rule_t *rule = &rs->rules[n];
-                                                int u = range->base + (g - range->mn);
-                                                int u1 = u - rule->prefix_count;
-                                                int u2 = (u + rule->input_count + rule->suffix_count) - 1;
-
-                                                if (u1 >= 0 && u2 <= hz_vector_size(range_list->unignored_indices) - 1 && u2 >= u1) {
-                                                    int context_len = (u2-u1)+1;
-                                                    uint16_t *sequence = hz_memory_arena_alloc(&arena, context_len * 2);
-                                                    uint16_t *context = hz_memory_arena_alloc(&arena, context_len * 2);
-                                                    {
-                                                        // load sequence
-                                                        for (int k = 0; k < context_len; ++k) {
-                                                            // NOTE: this could use SIMD gather if the glyphs were
-                                                            // aligned on a 32-bit (4-byte) boundary
-                                                            sequence[k] = b1->glyph_indices[range_list->unignored_indices[u1 + k]];
-                                                        }
-                                                    }
-
-                                                    {
-                                                        //load context
-                                                        int k = 0;
-                                                        // start with prefix
-                                                        for (uint16_t c = 0; c < rule->prefix_count; ++c) {
-                                                            context[k++] = rule->prefix_sequence[c];
-                                                        }
-
-                                                        // load current glyph so memcmp doesn't fail
-                                                        context[k++] = b1->glyph_indices[range_list->unignored_indices[u]];
-
-                                                        for (uint16_t c = 0; c < rule->input_count-1; ++c) {
-                                                            context[k++] = rule->input_sequence[c];
-                                                        }
-
-                                                        for (uint16_t c = 0; c < rule->suffix_count; ++c) {
-                                                            context[k++] = rule->suffix_sequence[c];
-                                                        }
-                                                    }
-
-                                                    // compare context with current glyph sequence
-                                                    if (!memcmp(context, sequence, context_len*2)) {
-                                                        // if match, apply nested lookups
-                                                        int context_low = range_list->unignored_indices[u];
-                                                        int context_high = range_list->unignored_indices[u + rule->input_count];
-
-                                                        // create context from input glyphs
-                                                        hz_buffer_t *ctx1 = hz_buffer_copy_range(b1, context_low, context_high);
-                                                        hz_buffer_t *ctx2 = hz_buffer_create();
-                                                        ctx2->attrib_flags = b2->attrib_flags;
-
-                                                        for (uint16_t z = 0; z < rule->lookup_count; ++z) {
-                                                            hz_buffer_compute_info(ctx1, face);
-                                                            int *context_index_list = hz_buffer_get_unignored_indices(ctx1, table->lookup_flags, table->mark_filtering_set);
-                                                            int sequence_idx = context_index_list[rule->lookup_records[z].sequence_index];
-
-                                                            hz_shaper_apply_gpos_lookup(shaper, font_data, feature,
-                                                                                        rule->lookup_records[z].lookup_list_index,
-                                                                                        ctx1, ctx2,
-                                                                                        sequence_idx,
-                                                                                        sequence_idx,
-                                                                                        depth + 1);
+                        for (int g = v1; g <= v2; ++g) {
+                            int32_t cov_index;
+                            if (hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                                || !hz_should_replace(buffer, feature, g)
+                                || (cov_index = hz_coverage_search(&subtable->coverage, ids[g])) == -1
+                                || cov_index >= subtable->rule_set_count)
+                                continue;
+
+                            hz_chained_sequence_rule_set_t *rs = &subtable->rule_sets[cov_index];
+                            for (uint16_t n = 0; n < rs->count; ++n) {
+                                hz_chained_sequence_rule_t *rule = &rs->rules[n];
+                                int first = g, last = g, k;
+
+                                // prefix (reverse order according to spec.)
+                                for (k = 0; k < rule->prefix_count; ++k) {
+                                    first = hz_search_unignored_glyph(buffer, first, -1, flags, mark_filtering_set);
+                                    if (first == -1 || ids[first] != rule->prefix_sequence[k]) break;
+                                }
+                                if (k < rule->prefix_count) continue;
 
-                                                            hz_swap_buffers(ctx1, ctx2, face);
-                                                            hz_vector_destroy(context_index_list);
-                                                        }
+                                // input, the sequence starts at the second glyph
+                                for (k = 0; k < rule->input_count - 1; ++k) {
+                                    last = hz_search_unignored_glyph(buffer, last, 1, flags, mark_filtering_set);
+                                    if (last == -1 || ids[last] != rule->input_sequence[k]) break;
+                                }
+                                if (k < rule->input_count - 1) continue;
+                                int input_end = last;
 
-                                                        // add final result to b2
-                                                        hz_buffer_add_other(b2, ctx1);
+                                // suffix
+                                for (k = 0; k < rule->suffix_count; ++k) {
+                                    last = hz_search_unignored_glyph(buffer, last, 1, flags, mark_filtering_set);
+                                    if (last == -1 || ids[last] != rule->suffix_sequence[k]) break;
+                                }
+                                if (k < rule->suffix_count) continue;
 
-                                                        match = HZ_TRUE;
-                                                        // skip over input context
-                                                        int skip_loc = u + rule->input_count;
-                                                        g = range_list->unignored_indices[skip_loc];
-                                                        r = hz_range_list_search(range_list, g);
-                                                        range = &range_list->ranges[r];
+                                hz_shaper_mark_unsafe(shaper, buffer, first, last);
 
-                                                        hz_buffer_destroy(ctx1);
-                                                        hz_buffer_destroy(ctx2);
-                                                        goto check_match_gpos_6_1;
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
+                                // apply nested lookups to the input glyphs in place
+                                for (uint16_t z = 0; z < rule->lookup_count; ++z) {
+                                    int sequence_idx = g;
+                                    for (k = 0; k < rule->lookup_records[z].sequence_index && sequence_idx < input_end; ++k)
+                                        sequence_idx = hz_search_unignored_glyph(buffer, sequence_idx, 1, flags, mark_filtering_set);
 
-                                    check_match_gpos_6_1:
-                                    if (!match) {
-                                        hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                                .id = b1->glyph_indices[g],
-                                                .codepoint = b1->codepoints[g]});
+                                    if (k == rule->lookup_records[z].sequence_index) {
+                                        hz_shaper_apply_gpos_lookup(shaper, font_data, feature,
+                                                                    rule->lookup_records[z].lookup_list_index,
+                                                                    buffer, sequence_idx, sequence_idx,
+                                                                    depth + 1);
                                     }
                                 }
 
+                                // skip over input context
+                                g = input_end;
+                                break;
                             }
-
                         }
 
                         break;
@@ -6294,108 +8856,53 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
                     case 3: {
                         hz_chained_sequence_context_format3_subtable_t *subtable = (hz_chained_sequence_context_format3_subtable_t *)base;
 
-                        for (size_t r = 0; r < hz_vector_size(range_list->ranges); ++r) {
-                            const hz_range_t *range = &range_list->ranges[r];
+                        for (int g = v1; g <= v2; ++g) {
+                            if (hz_should_ignore_glyph(buffer, g, flags, mark_filtering_set)
+                                || !hz_should_replace(buffer, feature, g))
+                                continue;
 
-                            if (range->is_ignored) {
-                                hz_buffer_add_range(b2, b1, range->mn, range->mx);
-                            } else {
-                                // unignored
-                                for (short g = range->mn; g <= range->mx; ++g) {
-                                    hz_bool match = HZ_FALSE;
-                                    hz_glyph_metrics_t metrics = b1->glyph_metrics[g];
+                            int first = g, last = g, k;
 
-                                    if (hz_should_replace(b1, feature, g, table->lookup_flags, table->mark_filtering_set)) {
-                                        // context bounds check, if this doesn't fit inside the original range
-                                        // this context is impossible to match
-                                        int u = range->base + (g - range->mn);
-                                        int u1 = u - subtable->prefix_count;
-                                        int u2 = (u + subtable->input_count + subtable->suffix_count)-1;
+                            // prefix (reverse order according to spec.)
+                            for (k = 0; k < subtable->prefix_count; ++k) {
+                                first = hz_search_unignored_glyph(buffer, first, -1, flags, mark_filtering_set);
+                                if (first == -1 || !hz_coverage_contains(&subtable->prefix_coverages[k], ids[first])) break;
+                            }
+                            if (k < subtable->prefix_count) continue;
 
-                                        if (u1 >= 0 && u2 <= hz_vector_size(range_list->unignored_indices) - 1) {
-                                            // check prefix, input and suffix sequences for match
+                            // input
+                            for (k = 0; k < subtable->input_count; ++k) {
+                                if (k) last = hz_search_unignored_glyph(buffer, last, 1, flags, mark_filtering_set);
+                                if (last == -1 || !hz_coverage_contains(&subtable->input_coverages[k], ids[last])) break;
+                            }
+                            if (k < subtable->input_count) continue;
+                            int input_end = last;
 
-                                            int prefix_match = 1, input_match = 1, suffix_match = 1; // matches
+                            // suffix
+                            for (k = 0; k < subtable->suffix_count; ++k) {
+                                last = hz_search_unignored_glyph(buffer, last, 1, flags, mark_filtering_set);
+                                if (last == -1 || !hz_coverage_contains(&subtable->suffix_coverages[k], ids[last])) break;
+                            }
+                            if (k < subtable->suffix_count) continue;
 
-                                            // prefix (reverse order according to spec.)
-                                            for (int k = 0; k < subtable->prefix_count; ++k) {
-                                                if (!hz_coverage_contains(&subtable->prefix_coverages[k],
-                                                                        b1->glyph_indices[range_list->unignored_indices[
-                                                                                u - (k + 1)]])) {
-                                                    prefix_match = 0;
-                                                    break;
-                                                }
-                                            }
+                            hz_shaper_mark_unsafe(shaper, buffer, first, last);
 
-                                            // input
-                                            for (int k = 0; k < subtable->input_count; ++k) {
-                                                if (!hz_coverage_contains(&subtable->input_coverages[k],
-                                                                        b1->glyph_indices[range_list->unignored_indices[
-                                                                                u + k]])) {
-                                                    input_match = 0;
-                                                    break;
-                                                }
-                                            }
+                            // apply nested lookups to the input glyphs in place
+                            for (uint16_t z = 0; z < subtable->lookup_count; ++z) {
+                                int sequence_idx = g;
+                                for (k = 0; k < subtable->lookup_records[z].sequence_index && sequence_idx < input_end; ++k)
+                                    sequence_idx = hz_search_unignored_glyph(buffer, sequence_idx, 1, flags, mark_filtering_set);
 
-                                            // suffix
-                                            for (int k = 0; k < subtable->suffix_count; ++k) {
-                                                if (!hz_coverage_contains(&subtable->suffix_coverages[k],
-                                                                        b1->glyph_indices[range_list->unignored_indices[
-                                                                                u + subtable->input_count + k]])) {
-                                                    suffix_match = 0;
-                                                    break;
-                                                }
-                                            }
-
-                                            if (input_match && suffix_match && prefix_match) {
-                                                int context_low = range_list->unignored_indices[u];
-                                                int context_high = range_list->unignored_indices[u + subtable->input_count - 1];
-
-                                                // create context from input glyphs
-                                                hz_buffer_t *ctx1 = hz_buffer_copy_range(b1, context_low, context_high);
-                                                hz_buffer_t *ctx2 = hz_buffer_create();
-                                                ctx2->attrib_flags = b2->attrib_flags;
-
-                                                for (uint16_t z = 0; z < subtable->lookup_count; ++z) {
-                                                    hz_buffer_compute_info(ctx1, face);
-                                                    hz_vector(int) context_index_list = hz_buffer_get_unignored_indices(ctx1, table->lookup_flags, table->mark_filtering_set);
-                                                    int sequence_idx = context_index_list[subtable->lookup_records[z].sequence_index];
-                                                    hz_vector_destroy(context_index_list);
-
-                                                    hz_shaper_apply_gpos_lookup(shaper, font_data, feature,
-                                                                                subtable->lookup_records[z].lookup_list_index,
-                                                                                ctx1, ctx2,
-                                                                                sequence_idx, sequence_idx,
-                                                                                depth + 1);
-
-                                                    hz_swap_buffers(ctx1, ctx2, face);
-                                                }
-
-                                                // add final result to b2
-                                                hz_buffer_add_other(b2, ctx1);
-
-                                                match = HZ_TRUE;
-
-                                                int skip_loc = u + subtable->input_count - 1;
-                                                g = range_list->unignored_indices[skip_loc];
-                                                r = hz_range_list_search(range_list, g);
-                                                range = &range_list->ranges[r];
-
-                                                hz_buffer_destroy(ctx1);
-                                                hz_buffer_destroy(ctx2);
-                                                goto check_match_gpos_6_3;
-                                            }
-                                        }
-                                    }
-
-                                    check_match_gpos_6_3:
-                                    if (!match) {
-                                        hz_buffer_add_glyph(b2, (hz_glyph_object_t) {
-                                                .metrics = metrics});
-                                    }
+                                if (k == subtable->lookup_records[z].sequence_index) {
+                                    hz_shaper_apply_gpos_lookup(shaper, font_data, feature,
+                                                                subtable->lookup_records[z].lookup_list_index,
+                                                                buffer, sequence_idx, sequence_idx,
+                                                                depth + 1);
                                 }
-
                             }
+
+                            // skip over input context
+                            g = input_end;
                         }
 
                         break;
@@ -6406,24 +8913,9 @@ hz_shaper_apply_gpos_lookup(hz_shaper_t *shaper,
             }
 
             default :
-                hz_buffer_add_other(b2,b1);
                 break;
         }
-
-
-        // move glyphs from source buffer to destination buffer
-        hz_swap_buffers(b1, b2, face);
-        hz_range_list_destroy(range_list);
     }
-
-    // write slices caused by range into the output buffer
-    hz_buffer_add_range(out, in, 0, v1 - 1);
-    hz_buffer_add_other(out, b1);
-    hz_buffer_add_range(out, in, v2 + 1, in->glyph_count - 1);
-
-    // cleanup buffers
-    hz_buffer_destroy(b1);
-    hz_buffer_destroy(b2);
 }
 
 HZ_STATIC int
@@ -6441,7 +8933,7 @@ hz_feature_list_search(hz_feature_list_item_t *features, uint16_t num_features,
 }
 
 
-HZ_STATIC void hz_buffer_setup_metrics(hz_buffer_t *buffer, hz_face_t *face)
+HZ_STATIC void hz_buffer_setup_metrics(hz_buffer_t *buffer, hz_face_t *face, const hz_variation_instance_t *instance)
 {
     if (buffer != NULL) {
         size_t size = buffer->glyph_count;
@@ -6451,7 +8943,8 @@ HZ_STATIC void hz_buffer_setup_metrics(hz_buffer_t *buffer, hz_face_t *face)
             // Marks should not have advance, but this is a hack
             {
                 hz_index_t glyph_index = buffer->glyph_indices[i];
-                buffer->glyph_metrics[i].xAdvance = face->metrics[glyph_index].xAdvance;
+                buffer->glyph_metrics[i].xAdvance = instance != NULL && instance->advances != NULL
+                                                  ? instance->advances[glyph_index] : face->metrics[glyph_index].xAdvance;
                 buffer->glyph_metrics[i].yAdvance = face->metrics[glyph_index].yAdvance;
             }
 
@@ -6463,87 +8956,120 @@ HZ_STATIC void hz_buffer_setup_metrics(hz_buffer_t *buffer, hz_face_t *face)
     }
 }
 
-typedef struct hz_lookup_reference_t {
-    uint16_t index;
-    hz_feature_t feature;
-    hz_tag_t type;
-} hz_lookup_reference_t;
-
 int cmp_lookup_ref(const void *a, const void *b)
 {
     return (int)((const hz_lookup_reference_t *)a)->index - (int)((const hz_lookup_reference_t *)b)->index;
 }
 
-HZ_STATIC void hz_shaper_apply_gsub_features(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_buffer_t *in_buffer, hz_buffer_t *out_buffer)
+// Lists the lookups of the shaper's features in a layout table into the shaper's scratch, sorted into the order
+// they apply in. With_rvrn adds required variation alternates whether the shaper lists 'rvrn' or not. Returns the
+// number of lookups, 0 when there's no room for them.
+HZ_STATIC size_t hz_shaper_collect_lookups(hz_shaper_t *shaper, hz_feature_list_item_t *features, uint32_t num_features,
+                                           hz_feature_table_t **alternates, uint16_t alternate_count, hz_bool with_rvrn)
 {
-    hz_face_t *face = font_data->face;
-    hz_gsub_table_t *gsub = &font_data->gsub_table;
-    out_buffer->attrib_flags = HZ_GLYPH_ATTRIB_CODEPOINT_BIT | HZ_GLYPH_ATTRIB_INDEX_BIT | HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT;
-
-    hz_vector(hz_lookup_reference_t) lookup_refs = NULL;
+    for (uint32_t i = 0; i < shaper->num_features; ++i)
+        if (shaper->features[i] == HZ_FEATURE_RVRN) with_rvrn = HZ_FALSE;
 
-    for (uint32_t i = 0; i < shaper->num_features; ++i) {
-        hz_feature_t feature = shaper->features[i];
-        int feature_index = hz_feature_list_search(gsub->features, gsub->num_features, feature);
-        if (feature_index != -1) {
-            // Found feature, apply corresponding lookups
-            hz_feature_table_t *feature_table = &gsub->features[feature_index].table;
+    // counted first, so the scratch grows once
+    size_t count = 0;
+    for (int pass = 0; pass < 2; ++pass) {
+        size_t num_refs = 0;
+        for (uint32_t i = 0; i < shaper->num_features + (with_rvrn ? 1 : 0); ++i) {
+            hz_feature_t feature = i < shaper->num_features ? shaper->features[i] : HZ_FEATURE_RVRN;
+            int feature_index = hz_feature_list_search(features, num_features, feature);
+            if (feature_index == -1) continue;
 
-            for (uint16_t j = 0; j < feature_table->lookup_index_count; ++j) {
-                hz_lookup_reference_t lookup_ref = (hz_lookup_reference_t){feature_table->lookup_list_indices[j],feature};
-                hz_vector_push_back(lookup_refs,lookup_ref);
+            hz_feature_table_t *feature_table = hz_instance_feature_table(alternates, alternate_count, features, feature_index);
+            if (pass == 0) {
+                count += feature_table->lookup_index_count;
+                continue;
             }
+
+            for (uint16_t j = 0; j < feature_table->lookup_index_count; ++j)
+                shaper->lookup_refs[num_refs++] = (hz_lookup_reference_t){hz_table_u16(feature_table->lookup_list_indices, j),feature};
+        }
+
+        if (pass == 0) {
+            if (count == 0) return 0;
+            hz_lookup_reference_t *refs = hz_shaper_reserve_scratch(shaper->lookup_refs, &shaper->lookup_ref_capacity,
+                                                                    count, sizeof(hz_lookup_reference_t));
+            if (refs == NULL) return 0;
+            shaper->lookup_refs = refs;
         }
     }
 
-    qsort(lookup_refs,
-          hz_vector_size(lookup_refs),
-          sizeof(hz_lookup_reference_t),
-          &cmp_lookup_ref);
+    qsort(shaper->lookup_refs, count, sizeof(hz_lookup_reference_t), &cmp_lookup_ref);
+    return count;
+}
+
+HZ_STATIC void hz_shaper_apply_gsub_features(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_buffer_t *in_buffer, hz_buffer_t *out_buffer)
+{
+    hz_face_t *face = font_data->face;
+    hz_gsub_table_t *gsub = &font_data->gsub_table;
+    out_buffer->attrib_flags = HZ_GLYPH_ATTRIB_CODEPOINT_BIT | HZ_GLYPH_ATTRIB_INDEX_BIT | HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT
+                             | HZ_GLYPH_ATTRIB_CLUSTER_BIT;
+
+    const hz_variation_instance_t *instance = shaper->instance;
+    size_t num_refs = hz_shaper_collect_lookups(shaper, gsub->features, gsub->num_features,
+                                                instance ? instance->gsub_features : NULL,
+                                                instance ? instance->gsub_feature_count : 0, HZ_TRUE);
+
+    // joining forms come from the characters, so they are found once and follow the glyphs through substitutions
+    for (size_t i = 0; i < num_refs; ++i) {
+        if (hz_is_joining_feature(shaper->lookup_refs[i].feature)) {
+            hz_buffer_compute_joining_forms(shaper->ucd, in_buffer);
+            out_buffer->attrib_flags |= HZ_GLYPH_ATTRIB_JOINING_FORM_BIT;
+            break;
+        }
+    }
 
-    for (size_t i = 0; i < hz_vector_size(lookup_refs); ++i) {
-        hz_lookup_reference_t *ref = &lookup_refs[i];
+    for (size_t i = 0; i < num_refs; ++i) {
+        hz_lookup_reference_t *ref = &shaper->lookup_refs[i];
         hz_shaper_apply_gsub_lookup(shaper, font_data, ref->feature, ref->index, in_buffer, out_buffer, 0, in_buffer->glyph_count - 1, 0);
         hz_swap_buffers(in_buffer, out_buffer, face);
     }
-
-    hz_vector_destroy(lookup_refs);
 }
 
-HZ_STATIC void hz_shaper_apply_gpos_features(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_buffer_t *in_buffer, hz_buffer_t *out_buffer)
+HZ_STATIC void hz_shaper_apply_gpos_features(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_buffer_t *buffer)
 {
-    hz_face_t *face = font_data->face;
     hz_gpos_table_t *gpos = &font_data->gpos_table;
-    out_buffer->attrib_flags = HZ_GLYPH_ATTRIB_METRICS_BIT;
-
-    hz_vector(hz_lookup_reference_t) lookup_refs = NULL;
 
-    for (uint32_t i = 0; i < shaper->num_features; ++i) {
-        hz_feature_t feature = shaper->features[i];
-        int feature_index = hz_feature_list_search(gpos->features, gpos->num_features, feature);
-        if (feature_index != -1) {
-            // Found feature, apply corresponding lookups
-            hz_feature_table_t *feature_table = &gpos->features[feature_index].table;
-
-            for (uint16_t j = 0; j < feature_table->lookup_index_count; ++j) {
-                hz_lookup_reference_t lookup_ref = (hz_lookup_reference_t){feature_table->lookup_list_indices[j],feature};
-                hz_vector_push_back(lookup_refs,lookup_ref);
-            }
+    const hz_variation_instance_t *instance = shaper->instance;
+    size_t num_refs = hz_shaper_collect_lookups(shaper, gpos->features, gpos->num_features,
+                                                instance ? instance->gpos_features : NULL,
+                                                instance ? instance->gpos_feature_count : 0, HZ_FALSE);
+
+    // positioning keeps the glyph ids, so the classes lookups skip glyphs by only need computing once
+    hz_buffer_compute_info(buffer, font_data->face);
+
+    hz_bool has_joining = HZ_FALSE;
+    for (size_t i = 0; i < num_refs; ++i)
+        has_joining |= hz_is_joining_feature(shaper->lookup_refs[i].feature);
+
+    if (has_joining && !(buffer->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT))
+        hz_buffer_compute_joining_forms(shaper->ucd, buffer);
+
+    // mark lookups need the attachments, without room for them nothing is positioned
+    int32_t *attachment_data = hz_shaper_reserve_scratch(shaper->attachment_data, &shaper->attachment_capacity,
+                                                         HZ_MAX(buffer->glyph_count, 1), sizeof(int32_t) * 7);
+    if (attachment_data != NULL) {
+        shaper->attachment_data = attachment_data;
+        hz_mark_attachments_t attachments;
+        hz_mark_attachments_compute(&attachments, attachment_data, buffer);
+        shaper->attachments = &attachments;
+
+        for (size_t i = 0; i < num_refs; ++i) {
+            hz_lookup_reference_t *ref = &shaper->lookup_refs[i];
+            hz_shaper_apply_gpos_lookup(shaper, font_data, ref->feature, ref->index, buffer, 0, buffer->glyph_count - 1, 0);
         }
-    }
-
-    qsort(lookup_refs,
-          hz_vector_size(lookup_refs),
-          sizeof(hz_lookup_reference_t),
-          &cmp_lookup_ref);
 
-    for (size_t i = 0; i < hz_vector_size(lookup_refs); ++i) {
-        hz_lookup_reference_t *ref = &lookup_refs[i];
-        hz_shaper_apply_gpos_lookup(shaper, font_data, ref->feature, ref->index, in_buffer, out_buffer, 0, in_buffer->glyph_count - 1, 0);
-        hz_swap_buffers(in_buffer, out_buffer, face);
+        shaper->attachments = NULL;
     }
 
-    hz_vector_destroy(lookup_refs);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_JOINING_FORM_BIT) {
+        hz_buffer_clear_attribs(buffer, HZ_GLYPH_ATTRIB_JOINING_FORM_BIT);
+        buffer->attrib_flags &= ~HZ_GLYPH_ATTRIB_JOINING_FORM_BIT;
+    }
 }
 
 HZ_STATIC void hz_buffer_correct_metrics(hz_buffer_t *buffer) {
@@ -6555,18 +9081,57 @@ HZ_STATIC void hz_buffer_correct_metrics(hz_buffer_t *buffer) {
     }
 }
 
+// Glyphs of a cluster that wasn't shaped apart from the previous one are flagged unsafe to break,
+// as well as every glyph after the first of a cluster. All of them are when unsafe_to_break is NULL.
+HZ_STATIC void hz_buffer_setup_glyph_flags(hz_buffer_t *buffer, const uint8_t *unsafe_to_break)
+{
+    hz_vector_resize(buffer->glyph_flags, buffer->glyph_count);
+
+    for (size_t g = 0; g < buffer->glyph_count; ++g) {
+        uint32_t cluster = buffer->clusters[g];
+        hz_bool unsafe = unsafe_to_break == NULL || unsafe_to_break[cluster] || (g && buffer->clusters[g - 1] == cluster);
+        buffer->glyph_flags[g] = unsafe ? HZ_GLYPH_FLAG_UNSAFE_TO_BREAK : 0;
+    }
+
+    buffer->attrib_flags |= HZ_GLYPH_ATTRIB_FLAGS_BIT;
+}
+
 HZ_STATIC void hz_shape_buffer(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_buffer_t *in_buffer)
 {
     hz_buffer_t out_buffer;
     hz_buffer_init(&out_buffer);
 
     if (in_buffer->glyph_count) {
+        // clusters start as the index of each character, and follow the glyphs through substitutions
+        size_t char_count = in_buffer->glyph_count;
+        hz_vector_resize(in_buffer->clusters, char_count);
+        for (size_t i = 0; i < char_count; ++i) in_buffer->clusters[i] = (uint32_t)i;
+        in_buffer->attrib_flags |= HZ_GLYPH_ATTRIB_CLUSTER_BIT;
+
+        // without it nothing is recorded, and every glyph is flagged unsafe to break
+        uint8_t *unsafe_to_break = hz_malloc(char_count);
+        if (unsafe_to_break != NULL) HZ_MEMSET(unsafe_to_break, 0, char_count);
+        shaper->unsafe_to_break = unsafe_to_break;
+        shaper->instance = hz_font_get_instance(font_data);
+
+        for (size_t i = 0; i < shaper->num_features; ++i) {
+            hz_feature_t feature = shaper->features[i];
+            if (feature == HZ_FEATURE_INIT || feature == HZ_FEATURE_MEDI || feature == HZ_FEATURE_FINA) {
+                hz_shaper_mark_unsafe_joining(shaper, in_buffer);
+                break;
+            }
+        }
+
         hz_shaper_apply_gsub_features(shaper, font_data, in_buffer, &out_buffer);
-        hz_buffer_setup_metrics(in_buffer, font_data->face);
-        hz_shaper_apply_gpos_features(shaper, font_data, in_buffer, &out_buffer);
-        hz_buffer_compute_info(in_buffer, font_data->face);
+        hz_buffer_setup_metrics(in_buffer, font_data->face, shaper->instance);
+        hz_shaper_apply_gpos_features(shaper, font_data, in_buffer);
         hz_buffer_correct_metrics(in_buffer);
 
+        shaper->unsafe_to_break = NULL;
+        shaper->instance = NULL;
+        hz_buffer_setup_glyph_flags(in_buffer, unsafe_to_break);
+        hz_free(unsafe_to_break);
+
         if (shaper->direction == HZ_DIRECTION_RTL || shaper->direction == HZ_DIRECTION_BTT) {
             hz_buffer_flip_direction(in_buffer);
         }
@@ -6842,49 +9407,272 @@ void hz_buffer_load_ucs2_sz(hz_buffer_t *buffer, const hz_ucs2_char_t *sz_input)
     }
 }
 
-void HzBuffero_nfd(hz_buffer_t *buffer)
+uint8_t hz_ucd_combining_class(hz_unicode_t c)
 {
-    
+    return hz_ucd_record(NULL, c)->combining_class;
 }
-void HzBuffero_nfc(hz_buffer_t *buffer)
+
+// Quick check flags of c, HZ_UCD_*_QC_* bits for the values other than Yes.
+HZ_STATIC HZ_INLINE uint8_t hz_ucd_quick_check(hz_unicode_t c)
+{
+    if (c >= (HZ_UCD_QUICK_CHECK_BLOCK_COUNT << HZ_UCD_QUICK_CHECK_BLOCK_SHIFT))
+        return 0;
+
+    uint32_t block = hz_ucd_quick_check_stage1[c >> HZ_UCD_QUICK_CHECK_BLOCK_SHIFT];
+    uint32_t mask = (1u << HZ_UCD_QUICK_CHECK_BLOCK_SHIFT) - 1;
+    return hz_ucd_quick_check_stage2[(block << HZ_UCD_QUICK_CHECK_BLOCK_SHIFT) | (c & mask)];
+}
+
+#define HZ_HANGUL_SBASE 0xac00
+#define HZ_HANGUL_LBASE 0x1100
+#define HZ_HANGUL_VBASE 0x1161
+#define HZ_HANGUL_TBASE 0x11a7
+#define HZ_HANGUL_LCOUNT 19
+#define HZ_HANGUL_VCOUNT 21
+#define HZ_HANGUL_TCOUNT 28
+#define HZ_HANGUL_SCOUNT (HZ_HANGUL_LCOUNT * HZ_HANGUL_VCOUNT * HZ_HANGUL_TCOUNT)
+
+// Characters below the limit of a form are normalized on their own, they have a combining class of 0 and
+// quick check to Yes. U+0300 is the first combining mark, Latin-1 letters with accents decompose and
+// U+00A0 is the first character with a compatibility mapping.
+static const hz_unicode_t hz_normalization_fast_limits[] = {
+    [HZ_NFD] = 0xc0, [HZ_NFC] = 0x300, [HZ_NFKD] = 0xa0, [HZ_NFKC] = 0xa0
+};
+
+static const uint8_t hz_normalization_check_masks[] = {
+    [HZ_NFD] = HZ_UCD_NFD_QC_NO,
+    [HZ_NFC] = HZ_UCD_NFC_QC_NO | HZ_UCD_NFC_QC_MAYBE,
+    [HZ_NFKD] = HZ_UCD_NFKD_QC_NO,
+    [HZ_NFKC] = HZ_UCD_NFKC_QC_NO | HZ_UCD_NFKC_QC_MAYBE
+};
+
+// UAX #15 quick check. Returns the start of the segment, the last character with a combining class of 0,
+// before the first character which may not be normalized, or count if the whole text is normalized.
+HZ_STATIC size_t hz_normalization_quick_check(const hz_unicode_t *chars, size_t count, hz_normalization_form_t nf)
 {
+    hz_unicode_t limit = hz_normalization_fast_limits[nf];
+    uint8_t check_mask = hz_normalization_check_masks[nf];
+    uint8_t last_ccc = 0;
+    size_t segment = 0, i = 0;
+
+    while (i < count) {
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+        {
+            // skip 8 characters at a time while they are all below the limit
+            const __m256i limits = _mm256_set1_epi32((int)limit);
+            size_t start = i;
+            for (; i + 8 <= count; i += 8) {
+                __m256i c = _mm256_loadu_si256((const __m256i *)(chars + i));
+                if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(limits, c)) != -1) break;
+            }
+
+            if (i != start) {
+                segment = i - 1;
+                last_ccc = 0;
+                if (i == count) break;
+            }
+        }
+#endif
+        hz_unicode_t c = chars[i];
+        if (c < limit) {
+            segment = i++;
+            last_ccc = 0;
+            continue;
+        }
+
+        uint8_t ccc = hz_ucd_combining_class(c);
+        if ((ccc && last_ccc > ccc) || (hz_ucd_quick_check(c) & check_mask))
+            return segment;
 
+        if (!ccc) segment = i;
+        last_ccc = ccc;
+        ++i;
+    }
+
+    return count;
 }
 
-void HzBuffero_nfkd(hz_buffer_t *buffer)
+HZ_STATIC const uint32_t *hz_find_decomposition(const uint32_t (*list)[2], size_t count, hz_unicode_t c)
 {
-    
+    size_t lo = 0, hi = count;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (list[mid][0] < c) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo < count && list[lo][0] == c ? list[lo] : NULL;
 }
-void HzBuffero_nfkc(hz_buffer_t *buffer)
+
+// Writes the full canonical, or compatibility if compat is set, decomposition of c to out and returns its
+// length, at most HZ_UCD_MAX_DECOMPOSITION.
+HZ_STATIC size_t hz_decompose_char(hz_unicode_t c, hz_bool compat, hz_unicode_t *out)
 {
-    
+    if (c - HZ_HANGUL_SBASE < HZ_HANGUL_SCOUNT) {
+        uint32_t s = c - HZ_HANGUL_SBASE;
+        out[0] = HZ_HANGUL_LBASE + s / (HZ_HANGUL_VCOUNT * HZ_HANGUL_TCOUNT);
+        out[1] = HZ_HANGUL_VBASE + (s / HZ_HANGUL_TCOUNT) % HZ_HANGUL_VCOUNT;
+        if (!(s % HZ_HANGUL_TCOUNT)) return 2;
+        out[2] = HZ_HANGUL_TBASE + s % HZ_HANGUL_TCOUNT;
+        return 3;
+    }
+
+    const uint32_t *entry = NULL;
+    if (hz_ucd_quick_check(c) & (compat ? HZ_UCD_NFKD_QC_NO : HZ_UCD_NFD_QC_NO)) {
+        if (compat) entry = hz_find_decomposition(hz_ucd_compat_decompositions, HZ_UCD_COMPAT_DECOMPOSITION_COUNT, c);
+        if (!entry) entry = hz_find_decomposition(hz_ucd_canonical_decompositions, HZ_UCD_CANONICAL_DECOMPOSITION_COUNT, c);
+    }
+
+    if (!entry) {
+        out[0] = c;
+        return 1;
+    }
+
+    size_t length = entry[1] & 31;
+    HZ_MEMCPY(out, hz_ucd_decomposition_data + (entry[1] >> 5), length * sizeof(hz_unicode_t));
+    return length;
+}
+
+// Primary composite of a and b, 0 if there is none.
+HZ_STATIC hz_unicode_t hz_compose_pair(hz_unicode_t a, hz_unicode_t b)
+{
+    if (a - HZ_HANGUL_LBASE < HZ_HANGUL_LCOUNT && b - HZ_HANGUL_VBASE < HZ_HANGUL_VCOUNT)
+        return HZ_HANGUL_SBASE + ((a - HZ_HANGUL_LBASE) * HZ_HANGUL_VCOUNT + (b - HZ_HANGUL_VBASE)) * HZ_HANGUL_TCOUNT;
+
+    if (a - HZ_HANGUL_SBASE < HZ_HANGUL_SCOUNT && !((a - HZ_HANGUL_SBASE) % HZ_HANGUL_TCOUNT)
+        && b - HZ_HANGUL_TBASE - 1 < HZ_HANGUL_TCOUNT - 1)
+        return a + (b - HZ_HANGUL_TBASE);
+
+    size_t lo = 0, hi = HZ_UCD_COMPOSITION_COUNT;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        const uint32_t *p = hz_ucd_compositions[mid];
+        if (p[0] < a || (p[0] == a && p[1] < b)) lo = mid + 1;
+        else hi = mid;
+    }
+
+    if (lo < HZ_UCD_COMPOSITION_COUNT && hz_ucd_compositions[lo][0] == a && hz_ucd_compositions[lo][1] == b)
+        return hz_ucd_compositions[lo][2];
+    return 0;
+}
+
+// Canonical composition of chars in place, returns the composed length.
+HZ_STATIC size_t hz_compose(hz_unicode_t *chars, size_t count)
+{
+    size_t starter = SIZE_MAX, w = 0;
+    uint8_t last_ccc = 0;
+
+    for (size_t r = 0; r < count; ++r) {
+        hz_unicode_t c = chars[r];
+        uint8_t ccc = hz_ucd_combining_class(c);
+
+        // only characters which quick check to Maybe are the second character of a composite, and they
+        // combine with the last starter if nothing in between has a combining class of 0 or at least theirs
+        if (starter != SIZE_MAX && (w == starter + 1 || last_ccc < ccc)
+            && (hz_ucd_quick_check(c) & HZ_UCD_NFC_QC_MAYBE)) {
+            hz_unicode_t composite = hz_compose_pair(chars[starter], c);
+            if (composite) {
+                chars[starter] = composite;
+                continue;
+            }
+        }
+
+        if (!ccc) starter = w;
+        last_ccc = ccc;
+        chars[w++] = c;
+    }
+
+    return w;
 }
 
 void HzBuffero_nf(hz_buffer_t *buffer, hz_normalization_form_t nf)
 {
-    switch (nf) {
-        default: break;
-        case HZ_NFD: HzBuffero_nfd(buffer); break;
-        case HZ_NFC: HzBuffero_nfc(buffer); break;
-        case HZ_NFKD: HzBuffero_nfkd(buffer); break;
-        case HZ_NFKC: HzBuffero_nfkc(buffer); break;
+    size_t count = hz_vector_size(buffer->codepoints);
+    size_t first = hz_normalization_quick_check(buffer->codepoints, count, nf);
+    if (first == count) return; // normalized already, left as is
+
+    hz_bool compat = nf == HZ_NFKD || nf == HZ_NFKC;
+    // characters below the limit of the decomposed form have no decomposition
+    hz_unicode_t limit = hz_normalization_fast_limits[compat ? HZ_NFKD : HZ_NFD];
+    hz_vector(hz_unicode_t) tail = NULL;
+    hz_vector_reserve(tail, count - first);
+
+    // the text is only rewritten from the segment the quick check stopped at
+    for (size_t i = first; i < count; ++i) {
+        hz_unicode_t d[HZ_UCD_MAX_DECOMPOSITION];
+        size_t n = 1;
+        d[0] = buffer->codepoints[i];
+        if (d[0] >= limit) n = hz_decompose_char(d[0], compat, d);
+
+        for (size_t k = 0; k < n; ++k) {
+            hz_unicode_t c = d[k];
+            uint8_t ccc = hz_ucd_combining_class(c);
+            hz_vector_push_back(tail, c);
+
+            // canonical ordering, a mark goes before the marks of a higher class
+            if (ccc) {
+                size_t j = hz_vector_size(tail) - 1;
+                while (j && hz_ucd_combining_class(tail[j - 1]) > ccc) {
+                    tail[j] = tail[j - 1];
+                    --j;
+                }
+                tail[j] = c;
+            }
+        }
     }
+
+    size_t length = hz_vector_size(tail);
+    if (nf == HZ_NFC || nf == HZ_NFKC) length = hz_compose(tail, length);
+
+    hz_vector_resize(buffer->codepoints, first + length);
+    HZ_MEMCPY(buffer->codepoints + first, tail, length * sizeof(hz_unicode_t));
+    hz_vector_destroy(tail);
 }
 
-void hz_shape_sz1(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_encoding_t encoding, const void* sz_input, hz_buffer_t *out_buffer)
+void HzBuffero_nfd(hz_buffer_t *buffer)
 {
-    HZ_ASSERT(sz_input != NULL);
-    hz_face_t *face = font_data->face;
+    HzBuffero_nf(buffer, HZ_NFD);
+}
+
+void HzBuffero_nfc(hz_buffer_t *buffer)
+{
+    HzBuffero_nf(buffer, HZ_NFC);
+}
+
+void HzBuffero_nfkd(hz_buffer_t *buffer)
+{
+    HzBuffero_nf(buffer, HZ_NFKD);
+}
+
+void HzBuffero_nfkc(hz_buffer_t *buffer)
+{
+    HzBuffero_nf(buffer, HZ_NFKC);
+}
 
+HZ_STATIC void hz_buffer_load_sz(hz_buffer_t *buffer, hz_encoding_t encoding, const void *sz_input)
+{
     switch (encoding) {
         default:
-        case HZ_ENCODING_ASCII: hz_buffer_load_ascii_sz(out_buffer, (const char*)sz_input); break;
+        case HZ_ENCODING_ASCII: hz_buffer_load_ascii_sz(buffer, (const char*)sz_input); break;
         case HZ_ENCODING_LATIN1: break;
-        case HZ_ENCODING_UCS2: hz_buffer_load_ucs2_sz(out_buffer, (const hz_ucs2_char_t*)sz_input); break;
-        case HZ_ENCODING_UTF8: hz_buffer_load_utf8_sz(out_buffer, (const unsigned char*)sz_input); break;
+        case HZ_ENCODING_UCS2: hz_buffer_load_ucs2_sz(buffer, (const hz_ucs2_char_t*)sz_input); break;
+        case HZ_ENCODING_UTF8: hz_buffer_load_utf8_sz(buffer, (const unsigned char*)sz_input); break;
         case HZ_ENCODING_UTF16: break;
         case HZ_ENCODING_UTF32: break;
     }
+}
+
+// Loads the input of a shaping entry point, normalized the way the shaper asks for.
+HZ_STATIC void hz_shaper_load_sz(hz_shaper_t *shaper, hz_buffer_t *buffer, hz_encoding_t encoding, const void *sz_input)
+{
+    hz_buffer_load_sz(buffer, encoding, sz_input);
+    if (shaper->flags & HZ_SHAPER_NORMALIZE_NFC) HzBuffero_nfc(buffer);
+}
+
+// Shapes the codepoints loaded into the buffer.
+HZ_STATIC void hz_shape_codepoints(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_buffer_t *out_buffer)
+{
+    hz_face_t *face = font_data->face;
 
     // set initial buffer attrib flags
     out_buffer->attrib_flags = HZ_GLYPH_ATTRIB_CODEPOINT_BIT | HZ_GLYPH_ATTRIB_INDEX_BIT | HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT;
@@ -6903,68 +9691,534 @@ void hz_shape_sz1(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_encoding_t
     hz_shape_buffer(shaper, font_data, out_buffer);
 }
 
-// NOTE: On ARM, it is possible to make use of the hardware types such as __fp16 and _Float16.
-// half-float (16-bit) type.
-typedef uint16_t hz_half;
-
-#define HZ_FLOAT_MAX_BIASED_EXP (0xff << 23)
-#define HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP (0x38000000)
-#define HZ_HALF_FLOAT_MAX_BIASED_EXP_AS_SINGLE_FP_EXP (0x47800000)
-#define HZ_HALF_FLOAT_MAX_BIASED_EXP (0x1f << 10)
+void hz_shape_sz1(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_encoding_t encoding, const void* sz_input, hz_buffer_t *out_buffer)
+{
+    HZ_ASSERT(sz_input != NULL);
+    hz_shaper_load_sz(shaper, out_buffer, encoding, sz_input);
+    hz_shape_codepoints(shaper, font_data, out_buffer);
+}
 
-typedef float hz_float;
+void hz_shaped_text_init(hz_shaped_text_t *text)
+{
+    text->chars = NULL;
+    hz_buffer_init(&text->buffer);
+    text->direction = HZ_DIRECTION_LTR;
+}
 
-// convert from 16-bit half float to single float
-HZ_ALWAYS_INLINE hz_half hz_float_to_half(hz_float f)
+void hz_shaped_text_release(hz_shaped_text_t *text)
 {
-    hz_half hf;
-    uint32_t x = *(uint32_t *)&f;
-    uint32_t sign = (uint16_t)(x >> 31);
-    // get mantissa
-    uint32_t mantissa = x & ((1 << 23) - 1);
-    // get exponent bits
-    uint32_t exp = x & HZ_FLOAT_MAX_BIASED_EXP;
+    hz_vector_destroy(text->chars);
+    hz_buffer_release(&text->buffer);
+}
 
-    if (exp >= HZ_HALF_FLOAT_MAX_BIASED_EXP_AS_SINGLE_FP_EXP) {
-        // check if the original single precision float number is a NaN
-        if (mantissa && (exp == HZ_FLOAT_MAX_BIASED_EXP)) {
-            // we have a single precision NaN
-            mantissa = (1 << 23) - 1;
-        } else {
-            // 16-bit half-float stores number as Inf
-            mantissa = 0;
-        }
+// Shapes count characters of chars starting at first on their own, with clusters relative to chars.
+HZ_STATIC void hz_shape_chars(hz_shaper_t *shaper, hz_font_data_t *font_data, const hz_unicode_t *chars,
+                              size_t first, size_t count, hz_buffer_t *out_buffer)
+{
+    if (count) hz_vector_push_many(out_buffer->codepoints, chars + first, count);
+    hz_shape_codepoints(shaper, font_data, out_buffer);
 
-        hf = (hz_half)(sign << 15) | (hz_half)(HZ_HALF_FLOAT_MAX_BIASED_EXP) | (hz_half)(mantissa >> 13);
-    } else if (exp <= HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP) { // check if exponent is <= -15
-        // store a denorm half-float value or zero
-        exp = (HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP - exp) >> 23;
-        mantissa >>= 14 + exp;
-        
-        hf = ((hz_half)sign << 15) | (hz_half)(mantissa);
-    } else {
-        hf = (hz_half)(sign << 15)
-           | (hz_half)((exp - HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP) >> 13)
-           | (hz_half)(mantissa >> 13);
+    if (out_buffer->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT) {
+        for (size_t g = 0; g < out_buffer->glyph_count; ++g)
+            out_buffer->clusters[g] += (uint32_t)first;
     }
+}
 
-    return hf;
+void hz_shape_text(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_encoding_t encoding, const void *sz_input,
+                   hz_shaped_text_t *text)
+{
+    HZ_ASSERT(sz_input != NULL);
+    hz_shaped_text_release(text);
+    hz_shaped_text_init(text);
+    text->direction = shaper->direction;
+
+    hz_buffer_t input;
+    hz_buffer_init(&input);
+    hz_shaper_load_sz(shaper, &input, encoding, sz_input);
+    text->chars = input.codepoints; // the buffer gives up its codepoints to the text
+    input.codepoints = NULL;
+
+    hz_shape_chars(shaper, font_data, text->chars, 0, hz_vector_size(text->chars), &text->buffer);
 }
 
-HZ_ALWAYS_INLINE hz_float hz_half_to_float(hz_half hf)
+HZ_STATIC hz_bool hz_shaped_text_is_reversed(const hz_shaped_text_t *text)
 {
-    uint32_t sign = (uint32_t)(hf >> 15);
-    uint32_t mantissa = (uint32_t)(hf & ((1 << 10) - 1));
-    uint32_t exp = (uint32_t)(hf & HZ_HALF_FLOAT_MAX_BIASED_EXP);
-    uint32_t f;
+    return text->direction == HZ_DIRECTION_RTL || text->direction == HZ_DIRECTION_BTT;
+}
 
-    if (exp == HZ_HALF_FLOAT_MAX_BIASED_EXP) {
-        // we have a half-float NaN or Inf
-        // half-float NaNs will be converted to a single precision NaN
-        // half-float Infs will be converted to a single precision Inf
-        exp = HZ_FLOAT_MAX_BIASED_EXP;
-        if (mantissa)
-            mantissa = (1 << 23) - 1;
+// Glyphs of right-to-left text are stored in visual order, logical glyph index i maps to the stored index.
+HZ_STATIC size_t hz_shaped_text_glyph(const hz_shaped_text_t *text, size_t i)
+{
+    return hz_shaped_text_is_reversed(text) ? text->buffer.glyph_count - 1 - i : i;
+}
+
+// Logical index of the first glyph with a cluster of at least c, using a binary search.
+HZ_STATIC size_t hz_shaped_text_find_cluster(const hz_shaped_text_t *text, uint32_t c)
+{
+    size_t lo = 0, hi = text->buffer.glyph_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (text->buffer.clusters[hz_shaped_text_glyph(text, mid)] < c) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+// Whether the text can be split before character c without changing the shaping on either side.
+HZ_STATIC hz_bool hz_shaped_text_safe_to_break(const hz_shaped_text_t *text, size_t c)
+{
+    if (c == 0 || c >= hz_vector_size(text->chars)) return HZ_TRUE;
+
+    size_t i = hz_shaped_text_find_cluster(text, (uint32_t)c);
+    if (i == text->buffer.glyph_count) return HZ_FALSE;
+
+    size_t g = hz_shaped_text_glyph(text, i);
+    return text->buffer.clusters[g] == c && !(text->buffer.glyph_flags[g] & HZ_GLYPH_FLAG_UNSAFE_TO_BREAK);
+}
+
+// Combining marks are transparent to the context of their neighbours.
+HZ_STATIC hz_bool hz_shaped_text_is_mark(const hz_ucd_t *ucd, const hz_shaped_text_t *text, size_t c)
+{
+    hz_general_category_t gc = hz_ucd_general_category(ucd, text->chars[c]);
+    return gc == HZ_GENERAL_CATEGORY_MN || gc == HZ_GENERAL_CATEGORY_MC || gc == HZ_GENERAL_CATEGORY_ME
+        || hz_ucd_combining_class(text->chars[c]) != 0;
+}
+
+// Replaces remove glyphs at index at with the glyphs of src.
+HZ_STATIC void hz_buffer_splice(hz_buffer_t *buffer, size_t at, size_t remove, const hz_buffer_t *src)
+{
+    size_t len = src->glyph_count;
+
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_METRICS_BIT)
+        hz_vector_splice(buffer->glyph_metrics, at, remove, src->glyph_metrics, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_INDEX_BIT)
+        hz_vector_splice(buffer->glyph_indices, at, remove, src->glyph_indices, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_CODEPOINT_BIT)
+        hz_vector_splice(buffer->codepoints, at, remove, src->codepoints, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_GLYPH_CLASS_BIT)
+        hz_vector_splice(buffer->glyph_classes, at, remove, src->glyph_classes, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_ATTACHMENT_CLASS_BIT)
+        hz_vector_splice(buffer->attachment_classes, at, remove, src->attachment_classes, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT)
+        hz_vector_splice(buffer->component_indices, at, remove, src->component_indices, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_CLUSTER_BIT)
+        hz_vector_splice(buffer->clusters, at, remove, src->clusters, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_FLAGS_BIT)
+        hz_vector_splice(buffer->glyph_flags, at, remove, src->glyph_flags, len);
+    if (buffer->attrib_flags & HZ_GLYPH_ATTRIB_FONT_INDEX_BIT)
+        hz_vector_splice(buffer->font_indices, at, remove, src->font_indices, len);
+
+    buffer->glyph_count = buffer->glyph_count - remove + len;
+}
+
+// base characters kept on each side of an edit when the font doesn't give its maximum context
+#define HZ_RESHAPE_DEFAULT_CONTEXT 2
+
+// Base characters kept on each side of an edit. A lookup reads at most max_context glyphs, so a
+// changed character can only change the shaping of the max_context - 1 glyphs on either side of it.
+HZ_STATIC size_t hz_reshape_context(const hz_face_t *face)
+{
+    return face->max_context ? HZ_MAX(face->max_context - 1, 1) : HZ_RESHAPE_DEFAULT_CONTEXT;
+}
+
+// Widens the characters start..end to the span to reshape when they change, keeping context base
+// characters on both sides, then going to the nearest boundaries the previous shaping marked as safe
+// to break.
+HZ_STATIC void hz_shaped_text_reshape_span(const hz_ucd_t *ucd, const hz_shaped_text_t *text, size_t context,
+                                           size_t *start, size_t *end)
+{
+    size_t len = hz_vector_size(text->chars);
+    size_t s = *start, e = *end;
+
+    for (size_t k = 0; k < context && s; ++k) {
+        do --s; while (s && hz_shaped_text_is_mark(ucd, text, s));
+    }
+    while (s && (hz_shaped_text_is_mark(ucd, text, s) || !hz_shaped_text_safe_to_break(text, s))) --s;
+
+    for (size_t k = 0; k < context && e < len; ++k) {
+        while (e < len && hz_shaped_text_is_mark(ucd, text, e)) ++e;
+        e = HZ_MIN(e + 1, len);
+    }
+    while (e < len && hz_shaped_text_is_mark(ucd, text, e)) ++e;
+    while (!hz_shaped_text_safe_to_break(text, e)) ++e;
+
+    *start = s;
+    *end = e;
+}
+
+void hz_reshape_edit(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_shaped_text_t *text,
+                     size_t offset, size_t deleted, hz_encoding_t encoding, const void *sz_inserted)
+{
+    size_t old_len = hz_vector_size(text->chars);
+    HZ_ASSERT(offset + deleted <= old_len);
+
+    hz_buffer_t inserted;
+    hz_buffer_init(&inserted);
+    if (sz_inserted != NULL) hz_buffer_load_sz(&inserted, encoding, sz_inserted);
+    size_t inserted_count = hz_vector_size(inserted.codepoints);
+
+    size_t start = offset, old_end = offset + deleted;
+    hz_shaped_text_reshape_span(shaper->ucd, text, hz_reshape_context(font_data->face), &start, &old_end);
+
+    size_t g1 = hz_shaped_text_find_cluster(text, (uint32_t)start);
+    size_t g2 = hz_shaped_text_find_cluster(text, (uint32_t)old_end);
+
+    hz_vector_splice(text->chars, offset, deleted, inserted.codepoints, inserted_count);
+    size_t new_end = old_end - deleted + inserted_count;
+
+    if (shaper->flags & HZ_SHAPER_NORMALIZE_NFC) {
+        // the span is bounded by base characters, composing it on its own gives the same text as composing it all
+        hz_buffer_t composed;
+        hz_buffer_init(&composed);
+        hz_vector_push_many(composed.codepoints, text->chars + start, new_end - start);
+        HzBuffero_nfc(&composed);
+
+        size_t composed_count = hz_vector_size(composed.codepoints);
+        hz_vector_splice(text->chars, start, new_end - start, composed.codepoints, composed_count);
+        new_end = start + composed_count;
+        hz_buffer_release(&composed);
+    }
+
+    hz_buffer_t span;
+    hz_buffer_init(&span);
+    hz_shape_chars(shaper, font_data, text->chars, start, new_end - start, &span);
+
+    if (text->buffer.glyph_count == 0) {
+        // nothing to splice into, the span is the whole text
+        hz_buffer_release(&text->buffer);
+        text->buffer = span;
+    } else {
+        size_t old_count = text->buffer.glyph_count;
+        hz_bool reversed = hz_shaped_text_is_reversed(text);
+        size_t at = reversed ? old_count - g2 : g1;
+        hz_buffer_splice(&text->buffer, at, g2 - g1, &span);
+
+        // clusters after the span move with the edit
+        int64_t delta = (int64_t)hz_vector_size(text->chars) - (int64_t)old_len;
+        if (delta) {
+            size_t first = reversed ? 0 : at + span.glyph_count;
+            size_t last = reversed ? at : text->buffer.glyph_count;
+            for (size_t g = first; g < last; ++g)
+                text->buffer.clusters[g] = (uint32_t)(text->buffer.clusters[g] + delta);
+        }
+
+        hz_buffer_release(&span);
+    }
+
+    hz_buffer_release(&inserted);
+}
+
+void hz_reshape_line_break(hz_shaper_t *shaper, hz_font_data_t *font_data, const hz_shaped_text_t *text,
+                           size_t c, hz_line_break_reshape_t *out)
+{
+    HZ_ASSERT(c <= hz_vector_size(text->chars));
+
+    size_t start = c, end = c;
+    hz_shaped_text_reshape_span(shaper->ucd, text, hz_reshape_context(font_data->face), &start, &end);
+    out->first_char = start;
+    out->end_char = end;
+    hz_shape_chars(shaper, font_data, text->chars, start, c - start, &out->before);
+    hz_shape_chars(shaper, font_data, text->chars, c, end - c, &out->after);
+}
+
+// Shaper for runs of script in language, set up with the script's default features the first time it is
+// used. Shapers are cached in the font data like its variation instances, the least recently used one is
+// replaced when the cache is full. Returns NULL if it can't be allocated.
+HZ_STATIC hz_shaper_t *hz_font_data_get_auto_shaper(hz_font_data_t *font_data, hz_script_t script,
+                                                     hz_language_t language)
+{
+    hz_shaper_t **shapers = font_data->auto_shapers;
+    size_t i = 0;
+    while (i < HZ_AUTO_SHAPER_CACHE_SIZE && shapers[i] != NULL
+           && (shapers[i]->script != script || shapers[i]->language != language))
+        ++i;
+
+    hz_shaper_t *shaper;
+    if (i < HZ_AUTO_SHAPER_CACHE_SIZE && shapers[i] != NULL) {
+        shaper = shapers[i];
+    } else {
+        shaper = hz_shaper_create();
+        if (shaper == NULL) return NULL;
+        if (i == HZ_AUTO_SHAPER_CACHE_SIZE)
+            hz_shaper_destroy(shapers[--i]);
+
+        uint8_t ar[256];
+        hz_memory_arena_t memory_arena;
+        hz_memory_arena_init(&memory_arena, ar, sizeof ar);
+
+        hz_feature_t *features;
+        unsigned int num_features;
+        hz_auto_load_script_features(&memory_arena, script, &features, &num_features);
+
+        hz_shaper_set_script(shaper, script);
+        hz_shaper_set_language(shaper, language);
+        hz_shaper_set_features(shaper, num_features, features);
+    }
+
+    // move to the front
+    memmove(&shapers[1], &shapers[0], i * sizeof(shapers[0]));
+    shapers[0] = shaper;
+    return shaper;
+}
+
+hz_error_t hz_shape_auto(hz_font_data_t *font_data, const hz_ucd_t *ucd, hz_encoding_t encoding,
+                         const void *sz_input, hz_direction_t dir, hz_language_t language, hz_buffer_t *out_buffer)
+{
+    HZ_ASSERT(sz_input != NULL);
+
+    hz_buffer_t input;
+    hz_buffer_init(&input);
+    hz_buffer_load_sz(&input, encoding, sz_input);
+    const hz_unicode_t *chars = input.codepoints;
+    size_t count = hz_vector_size(input.codepoints);
+    hz_error_t err = HZ_OK;
+
+    if (count) {
+        // script runs, the runs split at script and level boundaries, their levels and visual order
+        size_t scratch_size = HZ_BIDI_SCRATCH_SIZE(count)
+            + count * (sizeof(hz_script_run_t) + 2 * (sizeof(hz_script_run_t) + 1 + sizeof(uint32_t)))
+            + 4 * DEFAULT_ALIGNMENT;
+        uint8_t *scratch_data = hz_malloc(scratch_size);
+        if (scratch_data == NULL) {
+            hz_buffer_release(&input);
+            return HZ_ERROR_OUT_OF_MEMORY;
+        }
+
+        hz_memory_arena_t scratch;
+        hz_memory_arena_init(&scratch, scratch_data, scratch_size);
+
+        hz_bidi_paragraph_t para;
+        hz_script_run_t *script_runs = NULL, *runs = NULL;
+        uint8_t *levels = NULL;
+        uint32_t *order = NULL;
+        size_t script_run_count = 0;
+        if (hz_bidi_resolve_paragraph(ucd, &scratch, chars, count, dir, &para)
+            && (script_runs = hz_memory_arena_alloc(&scratch, count * sizeof(hz_script_run_t))) != NULL) {
+            script_run_count = hz_itemize_scripts(ucd, chars, count, script_runs);
+
+            size_t max_runs = script_run_count + para.run_count;
+            runs = hz_memory_arena_alloc(&scratch, max_runs * sizeof(hz_script_run_t));
+            levels = hz_memory_arena_alloc(&scratch, max_runs);
+            order = hz_memory_arena_alloc(&scratch, max_runs * sizeof(uint32_t));
+        }
+
+        if (order == NULL || levels == NULL || runs == NULL) {
+            err = HZ_ERROR_OUT_OF_MEMORY;
+        } else {
+            size_t run_count = 0;
+            for (size_t pos = 0, s = 0, b = 0; pos < count; ++run_count) {
+                size_t script_end = script_runs[s].first + script_runs[s].count;
+                size_t level_end = para.runs[b].first + para.runs[b].count;
+                size_t end = HZ_MIN(script_end, level_end);
+                runs[run_count] = (hz_script_run_t){pos, end - pos, script_runs[s].script};
+                levels[run_count] = para.runs[b].level;
+                pos = end;
+                if (end == script_end) ++s;
+                if (end == level_end) ++b;
+            }
+
+            hz_bidi_reorder(levels, run_count, order);
+
+            for (size_t k = 0; k < run_count; ++k) {
+                hz_script_run_t run = runs[order[k]];
+                hz_shaper_t *shaper = hz_font_data_get_auto_shaper(font_data, run.script, language);
+                if (shaper == NULL) {
+                    err = HZ_ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                hz_shaper_set_direction(shaper, hz_bidi_level_direction(levels[order[k]]));
+                hz_shaper_set_ucd(shaper, ucd);
+
+                hz_buffer_t span;
+                hz_buffer_init(&span);
+                hz_shape_chars(shaper, font_data, chars, run.first, run.count, &span);
+
+                if (out_buffer->glyph_count == 0) {
+                    hz_buffer_release(out_buffer);
+                    *out_buffer = span;
+                } else {
+                    hz_buffer_splice(out_buffer, out_buffer->glyph_count, 0, &span);
+                    hz_buffer_release(&span);
+                }
+            }
+        }
+
+        hz_free(scratch_data);
+    }
+
+    hz_buffer_release(&input);
+    return err;
+}
+
+typedef struct {
+    hz_font_data_t *font_data;
+    hz_codepoint_set_t coverage;
+} hz_fallback_font_t;
+
+struct hz_fallback_chain_t {
+    hz_vector(hz_fallback_font_t) fonts;
+};
+
+hz_fallback_chain_t *hz_fallback_chain_create(void)
+{
+    hz_fallback_chain_t *chain = hz_malloc(sizeof(*chain));
+    chain->fonts = NULL;
+    return chain;
+}
+
+void hz_fallback_chain_destroy(hz_fallback_chain_t *chain)
+{
+    for (size_t i = 0; i < hz_vector_size(chain->fonts); ++i)
+        hz_codepoint_set_release(&chain->fonts[i].coverage);
+
+    hz_vector_destroy(chain->fonts);
+    hz_free(chain);
+}
+
+void hz_fallback_chain_add_font(hz_fallback_chain_t *chain, hz_font_data_t *font_data)
+{
+    hz_fallback_font_t font;
+    font.font_data = font_data;
+    hz_codepoint_set_init(&font.coverage);
+    hz_codepoint_set_add_cmap(&font.coverage, font_data->face);
+    hz_vector_push_back(chain->fonts, font);
+}
+
+int hz_fallback_chain_find_font(const hz_fallback_chain_t *chain, hz_unicode_t c)
+{
+    for (size_t i = 0; i < hz_vector_size(chain->fonts); ++i)
+        if (hz_codepoint_set_contains(&chain->fonts[i].coverage, c)) return (int)i;
+
+    return -1;
+}
+
+// Appends the glyphs of a run shaped with font to out_buffer, in front of the previous runs when the glyphs are in
+// right-to-left visual order.
+HZ_STATIC void hz_fallback_append_run(hz_buffer_t *out_buffer, hz_buffer_t *span, uint16_t font, hz_bool reversed)
+{
+    span->attrib_flags |= HZ_GLYPH_ATTRIB_FONT_INDEX_BIT;
+    hz_vector_resize(span->font_indices, span->glyph_count);
+    for (size_t g = 0; g < span->glyph_count; ++g) span->font_indices[g] = font;
+
+    if (out_buffer->glyph_count == 0) {
+        hz_buffer_release(out_buffer);
+        *out_buffer = *span;
+    } else {
+        hz_buffer_splice(out_buffer, reversed ? 0 : out_buffer->glyph_count, 0, span);
+        hz_buffer_release(span);
+    }
+}
+
+void hz_shape_fallback(hz_shaper_t *shaper, hz_fallback_chain_t *chain, hz_encoding_t encoding, const void *sz_input,
+                       hz_buffer_t *out_buffer)
+{
+    HZ_ASSERT(sz_input != NULL);
+    HZ_ASSERT(hz_vector_size(chain->fonts) > 0);
+
+    hz_buffer_t input;
+    hz_buffer_init(&input);
+    hz_shaper_load_sz(shaper, &input, encoding, sz_input);
+    const hz_unicode_t *chars = input.codepoints;
+    size_t count = hz_vector_size(input.codepoints);
+    hz_bool reversed = shaper->direction == HZ_DIRECTION_RTL || shaper->direction == HZ_DIRECTION_BTT;
+
+    size_t run_first = 0;
+    int run_font = -1;
+    for (size_t i = 0; i <= count; ++i) {
+        int font = run_font;
+
+        if (i < count) {
+            hz_unicode_t c = chars[i];
+            hz_line_break_class_t cls = hz_ucd_line_break_class(shaper->ucd, c);
+            hz_bool is_mark = cls == HZ_LINE_BREAK_CLASS_CM || cls == HZ_LINE_BREAK_CLASS_ZWJ;
+
+            // marks stay with their base when its font has them, characters no font has stay in the current run
+            if (run_font < 0 || !is_mark || !hz_codepoint_set_contains(&chain->fonts[run_font].coverage, c)) {
+                int first_font = hz_fallback_chain_find_font(chain, c);
+                if (first_font >= 0) font = first_font;
+                else if (run_font < 0) font = 0;
+            }
+
+            if (font == run_font) continue;
+        }
+
+        if (i > run_first) {
+            hz_buffer_t span;
+            hz_buffer_init(&span);
+            hz_shape_chars(shaper, chain->fonts[run_font].font_data, chars, run_first, i - run_first, &span);
+            hz_fallback_append_run(out_buffer, &span, (uint16_t)run_font, reversed);
+        }
+
+        run_first = i;
+        run_font = font;
+    }
+
+    hz_buffer_release(&input);
+}
+
+// NOTE: On ARM, it is possible to make use of the hardware types such as __fp16 and _Float16.
+// half-float (16-bit) type.
+typedef uint16_t hz_half;
+
+#define HZ_FLOAT_MAX_BIASED_EXP (0xff << 23)
+#define HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP (0x38000000)
+#define HZ_HALF_FLOAT_MAX_BIASED_EXP_AS_SINGLE_FP_EXP (0x47800000)
+#define HZ_HALF_FLOAT_MAX_BIASED_EXP (0x1f << 10)
+
+typedef float hz_float;
+
+// convert from 16-bit half float to single float
+HZ_ALWAYS_INLINE hz_half hz_float_to_half(hz_float f)
+{
+    hz_half hf;
+    uint32_t x = *(uint32_t *)&f;
+    uint32_t sign = (uint16_t)(x >> 31);
+    // get mantissa
+    uint32_t mantissa = x & ((1 << 23) - 1);
+    // get exponent bits
+    uint32_t exp = x & HZ_FLOAT_MAX_BIASED_EXP;
+
+    if (exp >= HZ_HALF_FLOAT_MAX_BIASED_EXP_AS_SINGLE_FP_EXP) {
+        // check if the original single precision float number is a NaN
+        if (mantissa && (exp == HZ_FLOAT_MAX_BIASED_EXP)) {
+            // we have a single precision NaN
+            mantissa = (1 << 23) - 1;
+        } else {
+            // 16-bit half-float stores number as Inf
+            mantissa = 0;
+        }
+
+        hf = (hz_half)(sign << 15) | (hz_half)(HZ_HALF_FLOAT_MAX_BIASED_EXP) | (hz_half)(mantissa >> 13);
+    } else if (exp <= HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP) { // check if exponent is <= -15
+        // store a denorm half-float value or zero
+        exp = (HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP - exp) >> 23;
+        mantissa >>= 14 + exp;
+        
+        hf = ((hz_half)sign << 15) | (hz_half)(mantissa);
+    } else {
+        hf = (hz_half)(sign << 15)
+           | (hz_half)((exp - HZ_HALF_FLOAT_MIN_BIASED_EXP_AS_SINGLE_FP_EXP) >> 13)
+           | (hz_half)(mantissa >> 13);
+    }
+
+    return hf;
+}
+
+HZ_ALWAYS_INLINE hz_float hz_half_to_float(hz_half hf)
+{
+    uint32_t sign = (uint32_t)(hf >> 15);
+    uint32_t mantissa = (uint32_t)(hf & ((1 << 10) - 1));
+    uint32_t exp = (uint32_t)(hf & HZ_HALF_FLOAT_MAX_BIASED_EXP);
+    uint32_t f;
+
+    if (exp == HZ_HALF_FLOAT_MAX_BIASED_EXP) {
+        // we have a half-float NaN or Inf
+        // half-float NaNs will be converted to a single precision NaN
+        // half-float Infs will be converted to a single precision Inf
+        exp = HZ_FLOAT_MAX_BIASED_EXP;
+        if (mantissa)
+            mantissa = (1 << 23) - 1;
     } else if (exp == 0) {
         // convert half-float zero/denorm to single precision value
         if (mantissa) {
@@ -6993,18 +10247,6 @@ HZ_ALWAYS_INLINE hz_float hz_half_to_float(hz_half hf)
     return *((hz_float *)&f);
 }
 
-typedef enum {
-    HZ_LAYOUT_ALIGN_LEFT    = HZ_FLAG(0),
-    HZ_LAYOUT_ALIGN_RIGHT   = HZ_FLAG(1),
-    HZ_LAYOUT_ALIGN_BOTTOM  = HZ_FLAG(2),
-    HZ_LAYOUT_ALIGN_TOP     = HZ_FLAG(3),
-    HZ_LAYOUT_AUTO_ALIGN    = HZ_FLAG(4),
-    HZ_LAYOUT_JUSTIFY       = HZ_FLAG(5),
-    HZ_LAYOUT_WRAP          = HZ_FLAG(6),
-    HZ_LAYOUT_X_CENTER      = HZ_FLAG(7),
-    HZ_LAYOUT_Y_CENTER      = HZ_FLAG(8),
-} hz_layout_flags_t;
-
 /* MSI Hash table
 
     Hash table inspired by Chris Wellons' on the idea of the "MSI" hash table found here: https://nullprogram.com/blog/2022/08/08/.
@@ -7053,23 +10295,49 @@ int32_t hz_msi_ht_intern(HzMSI *msi, uint32_t key) {
     return HZ_MSI_NOT_FOUND;
 }
 
-void hz_lru_cache_init(hz_memory_arena_t *ma, hz_glyph_cache_t *c, int sz, int max_replace_sz)
+hz_error_t hz_lru_cache_init(hz_memory_arena_t *ma, hz_glyph_cache_t *c, int sz, int max_replace_sz)
 {
     HZ_ASSERT(sz);
     c->slots_occupied = 0;
     c->sz = sz;
     c->p2sz = HZ_NXP2(sz);
+    c->max_replace_sz = max_replace_sz;
     c->slots = hz_memory_arena_alloc(ma, sizeof(struct hz_cache_slot_t)*c->p2sz);
+    c->nodes = hz_memory_arena_alloc(ma, sizeof(struct hz_cache_node_t)*sz);
+    c->id_ht = hz_ht_create(hz_get_allocator(), sz);
+    c->batch = 0;
+    c->opts = (hz_glyph_cache_opts_t){0};
+    c->packer = (hz_atlas_packer_t){0};
     c->fn = hz_malloc(sizeof(*c->fn));
     c->ln = hz_malloc(sizeof(*c->ln));
+
+    // whatever did get allocated is freed by hz_lru_cache_release
+    if (c->slots == NULL || c->nodes == NULL || c->id_ht == NULL || c->fn == NULL || c->ln == NULL)
+        return HZ_ERROR_OUT_OF_MEMORY;
+
     (*c->fn) = (struct hz_cache_node_t){.next = c->ln, .prev = NULL};
     (*c->ln) = (struct hz_cache_node_t){.prev = c->fn, .next = NULL};
+
+    for (int i = 0; i < sz; ++i) {
+        c->slots[i].id = HZ_LRU_ID_INVALID;
+    }
+
+    return HZ_OK;
+}
+
+void hz_lru_cache_release(hz_glyph_cache_t *c)
+{
+    hz_ht_destroy(c->id_ht);
+    hz_atlas_packer_release(&c->packer);
+    hz_free(c->fn);
+    hz_free(c->ln);
 }
 
 struct hz_cache_node_t *hz_lru_cache_get_node(hz_glyph_cache_t *c, hz_cache_id_t id)
 {
-    for(struct hz_cache_node_t *n = c->fn->next; n != c->ln; n = n->next){
-        if(c->slots[n->slot].id.u32 == id.u32) return n;
+    hz_ht_iter_t it;
+    if (hz_ht_search(c->id_ht, id.u32, &it)) {
+        return &c->nodes[*it.ptr_value];
     }
 
     return NULL;
@@ -7087,7 +10355,7 @@ struct hz_cache_stat_t hz_lru_cache_stat(hz_glyph_cache_t *c,
         struct hz_cache_node_t *n;
         hz_cache_id_t id = {.u32 = it.key};
         if ((n = hz_lru_cache_get_node(c, id)) != NULL) {
-            avail_id_list[++stat.avail] = id;
+            avail_id_list[stat.avail++] = id;
         } else {
             unavail_id_list[stat.unavail++] = id;
         }
@@ -7098,18 +10366,32 @@ struct hz_cache_stat_t hz_lru_cache_stat(hz_glyph_cache_t *c,
 
 HZ_ALWAYS_INLINE int hz_lru_cache_is_full(hz_glyph_cache_t *lru) { return lru->slots_occupied>=lru->sz; }
 
-HZ_ALWAYS_INLINE struct hz_cache_node_t *hz_lru_cache_add_node(hz_glyph_cache_t *lru)
+HZ_ALWAYS_INLINE void hz_lru_cache_link_front(hz_glyph_cache_t *lru, struct hz_cache_node_t *n)
 {
-    // When adding node, we always move it to the front of the list
-    struct hz_cache_node_t *n = hz_malloc(sizeof(*n));
-    n->slot = lru->slots_occupied++;
-
-    // Link node with the LRU list
     struct hz_cache_node_t *old_next = lru->fn->next;
-
     n->next = old_next; n->prev = lru->fn;
+    old_next->prev = n;
     lru->fn->next = n;
-    
+}
+
+HZ_ALWAYS_INLINE void hz_lru_cache_move_to_front(hz_glyph_cache_t *lru, struct hz_cache_node_t *n)
+{
+    if (lru->fn->next == n) return;
+
+    // Link prev and next nodes together
+    n->prev->next = n->next;
+    n->next->prev = n->prev;
+    hz_lru_cache_link_front(lru, n);
+}
+
+HZ_ALWAYS_INLINE struct hz_cache_node_t *hz_lru_cache_add_node(hz_glyph_cache_t *lru)
+{
+    // When adding node, we always move it to the front of the list.
+    // Node i always owns slot i, so nodes can be found from a slot index.
+    struct hz_cache_node_t *n = &lru->nodes[lru->slots_occupied];
+    n->slot = lru->slots_occupied++;
+    n->batch = 0;
+    hz_lru_cache_link_front(lru, n);
     return n;
 }
 
@@ -7127,83 +10409,420 @@ void hz_lru_cache_replace_slots(hz_glyph_cache_t *lru,
     // If slots remain to be filled, start replacing last recently used nodes
     // from back of list.
     for (;slot_index < slots_sz; ++slot_index) {
-        struct hz_cache_node_t *n = lru->ln->prev, *n_left = n->prev, *n_right = n->next;
-
-        // Link prev and next nodes together
-        n_left->next = n_right;
-        n_right->prev = n_left;
-
-        // Move node to front
-        struct hz_cache_node_t *old_first = lru->fn->next;
-        lru->fn->next = n;
-        n->prev = lru->fn;
-        n->next = old_first;
-
+        struct hz_cache_node_t *n = lru->ln->prev;
+        hz_lru_cache_move_to_front(lru, n);
         open_slots[slot_index] = n->slot;
     }
 }
 
 
 void hz_lru_write_slot(hz_glyph_cache_t *lru, int slot_index, struct hz_cache_slot_t slot) {
+    hz_cache_id_t old_id = lru->slots[slot_index].id;
+
+    if (old_id.u32 != slot.id.u32) {
+        if (old_id.u32 != HZ_LRU_ID_INVALID.u32)
+            hz_ht_remove(lru->id_ht, old_id.u32);
+
+        hz_ht_insert(lru->id_ht, slot.id.u32, slot_index);
+    }
+
     lru->slots[slot_index] = slot;
 }
 
-typedef struct {
-    size_t first_glyph;
-    size_t size;
-} hz_segment_command_t;
+void hz_atlas_packer_init(hz_atlas_packer_t *p, int width, int height)
+{
+    p->width = width;
+    p->height = height;
+    p->top = 0;
+    p->shelves = NULL;
+}
 
-typedef struct {
-    hz_direction_t dir;
-    hz_layout_flags_t flags;
-    float sx, sy, max_length;
-    float v_advance;
-    hz_vector(hz_segment_command_t) segments;
-} hz_line_layout_t;
+void hz_atlas_packer_release(hz_atlas_packer_t *p)
+{
+    for (size_t i = 0; i < hz_vector_size(p->shelves); ++i) {
+        hz_vector_destroy(p->shelves[i].slots);
+    }
 
-#define HZ_MAX_UNIQUE_GLYPHS_PER_FRAME 1000
+    hz_vector_destroy(p->shelves);
+}
 
-void hz_command_list_init(hz_command_list_t *cmd_list)
+// Rounds a height up to one of 4 size classes per octave, so a shelf wastes
+// at most a quarter of its height on the glyphs of its class.
+int hz_atlas_size_class(int h)
 {
-    cmd_list->draw_data = NULL;
-    cmd_list->unique_glyph_ht = hz_ht_create(hz_get_allocator(), HZ_MAX_UNIQUE_GLYPHS_PER_FRAME);
+    if (h <= 8) return 8;
+    int e = 31 - __builtin_clz((unsigned)h);
+    int step = 1 << (e - 2);
+    return (h + step - 1) & ~(step - 1);
 }
 
-void hz_command_list_clear(hz_command_list_t *cmd_list)
+int hz_atlas_packer_alloc(hz_atlas_packer_t *p, int w, int h, hz_rect_t *rect)
 {
-    hz_vector_clear(cmd_list->draw_data);
-    hz_ht_clear(cmd_list->unique_glyph_ht);
-}
+    int cls = hz_atlas_size_class(h);
+    int shelf_cnt = (int)hz_vector_size(p->shelves);
+    int best = -1;
 
-#define HZ_CONTEXT_DFLT_MEMORY_SIZE (1024*1024) /*1MiB*/
-#ifndef HZ_CONTEXT_MEMORY_SIZE
-#   define HZ_CONTEXT_MEMORY_SIZE HZ_CONTEXT_DFLT_MEMORY_SIZE
-#endif
+    if (w > p->width || h > p->height)
+        return -1;
 
-#define HZ_CONTEXT_FRAME_MEMORY_SIZE 1048576
-#define HZ_CONTEXT_FONT_TABLE_SIZE 64
+    // shortest shelf with room left that is at most one class taller than needed
+    for (int i = 0; i < shelf_cnt; ++i) {
+        hz_atlas_shelf_t *shelf = &p->shelves[i];
+        if (shelf->h >= h && shelf->h <= hz_atlas_size_class(cls + 1) && shelf->x + w <= p->width
+            && (best < 0 || shelf->h < p->shelves[best].h))
+            best = i;
+    }
 
-struct hz_context_t {
-    hz_command_list_t frame_cmds;
-    hz_font_data_t font_table [HZ_CONTEXT_FONT_TABLE_SIZE];
-    uint16_t font_id_counter;
-    hz_glyph_cache_t lru;
-    hz_memory_arena_t memory_arena;
-    hz_memory_arena_t frame_arena;
-    void *arena_buffer, *frame_arena_buffer;
-    hz_mat4 camera_matrix;
-};
+    // otherwise the shortest empty shelf that fits
+    for (int i = 0; best < 0 && i < shelf_cnt; ++i) {
+        hz_atlas_shelf_t *shelf = &p->shelves[i];
+        if (shelf->x == 0 && shelf->h >= h && (best < 0 || shelf->h < p->shelves[best].h))
+            best = i;
+    }
 
-hz_context_t *hz_context_create (hz_glyph_cache_opts_t *opts) {
-    hz_context_t *ctx = hz_malloc(sizeof(*ctx));
-    hz_command_list_init(&ctx->frame_cmds);
+    if (best < 0) {
+        if (p->top + cls > p->height) {
+            if (p->top + h > p->height)
+                return -1;
+            cls = p->height - p->top; // last shelf takes whatever is left
+        }
 
+        hz_atlas_shelf_t shelf = {.y = p->top, .h = cls};
+        hz_vector_push_back(p->shelves, shelf);
+        p->top += cls;
+        best = shelf_cnt;
+    }
+
+    hz_atlas_shelf_t *shelf = &p->shelves[best];
+    if (shelf->x == 0 && shelf->h - cls >= 8) {
+        // reused empty shelf is taller than needed, split the rest off into its own shelf
+        hz_atlas_shelf_t rest = {.y = shelf->y + cls, .h = shelf->h - cls};
+        shelf->h = cls;
+        hz_vector_push_back(p->shelves, rest);
+        HZ_MEMMOVE(&p->shelves[best+2], &p->shelves[best+1], sizeof(hz_atlas_shelf_t)*(shelf_cnt - best - 1));
+        p->shelves[best+1] = rest;
+        shelf = &p->shelves[best];
+    }
+
+    *rect = (hz_rect_t){shelf->x, shelf->y, w, h};
+    shelf->x += w;
+    shelf->used_area += w * h;
+    return best;
+}
+
+void hz_atlas_packer_clear_shelf(hz_atlas_packer_t *p, int shelf_index)
+{
+    hz_atlas_shelf_t *shelf = &p->shelves[shelf_index];
+    shelf->x = 0;
+    shelf->used_area = 0;
+    hz_vector_clear(shelf->slots);
+
+    // give empty shelves at the top back so they can be reopened with another size class
+    while (hz_vector_size(p->shelves) && hz_vector_top(p->shelves)->x == 0) {
+        hz_atlas_shelf_t *top = hz_vector_top(p->shelves);
+        p->top = top->y;
+        hz_vector_destroy(top->slots);
+        hz_vector_pop(p->shelves);
+    }
+}
+
+void hz_atlas_packer_merge_shelves(hz_atlas_packer_t *p, int first, int count)
+{
+    hz_atlas_shelf_t *shelves = p->shelves;
+    int shelf_cnt = (int)hz_vector_size(shelves);
+
+    for (int i = first + 1; i < first + count; ++i) {
+        shelves[first].h += shelves[i].h;
+        hz_vector_destroy(shelves[i].slots);
+    }
+
+    HZ_MEMMOVE(&shelves[first+1], &shelves[first+count], sizeof(hz_atlas_shelf_t)*(shelf_cnt - first - count));
+    hz_vector_resize(p->shelves, shelf_cnt - count + 1);
+    hz_atlas_packer_clear_shelf(p, first);
+}
+
+hz_atlas_stats_t hz_atlas_packer_stats(const hz_atlas_packer_t *p)
+{
+    hz_atlas_stats_t stats = {0};
+    long used = 0, claimed = 0;
+
+    for (size_t i = 0; i < hz_vector_size(p->shelves); ++i) {
+        const hz_atlas_shelf_t *shelf = &p->shelves[i];
+        used += shelf->used_area;
+        claimed += (long)shelf->h * p->width;
+        stats.glyph_count += (int)hz_vector_size(shelf->slots);
+    }
+
+    stats.shelf_count = (int)hz_vector_size(p->shelves);
+    stats.fill_ratio = (float)used / ((float)p->width * (float)p->height);
+    stats.fragmentation = claimed ? 1.0f - (float)used / (float)claimed : 0.0f;
+    return stats;
+}
+
+hz_atlas_stats_t hz_glyph_cache_stats(const hz_glyph_cache_t *c)
+{
+    if (c->opts.packing == HZ_GLYPH_CACHE_PACKING_SHELF)
+        return hz_atlas_packer_stats(&c->packer);
+
+    return (hz_atlas_stats_t){
+        .fill_ratio = (float)c->slots_occupied / (float)c->sz,
+        .glyph_count = c->slots_occupied
+    };
+}
+
+void hz_glyph_cache_setup_packing(hz_memory_arena_t *ma, hz_glyph_cache_t *c, const hz_glyph_cache_opts_t *opts)
+{
+    c->opts = *opts;
+    c->slot_shelf = NULL;
+    c->free_slots = NULL;
+    c->free_slot_count = 0;
+    hz_atlas_packer_init(&c->packer, opts->width, opts->height);
+
+    if (opts->packing == HZ_GLYPH_CACHE_PACKING_SHELF) {
+        c->slot_shelf = hz_memory_arena_alloc(ma, sizeof(uint16_t)*c->sz);
+        c->free_slots = hz_memory_arena_alloc(ma, sizeof(uint16_t)*c->sz);
+
+        // slots are handed out lowest first, nodes only serve as slot lookups here
+        for (int i = 0; i < c->sz; ++i) {
+            c->free_slots[i] = (uint16_t)(c->sz - 1 - i);
+            c->nodes[i] = (struct hz_cache_node_t){.slot = (uint16_t)i};
+        }
+
+        c->free_slot_count = c->sz;
+    }
+}
+
+HZ_STATIC void hz_glyph_cache_free_shelf_slots(hz_glyph_cache_t *c, int shelf_index)
+{
+    hz_atlas_shelf_t *shelf = &c->packer.shelves[shelf_index];
+
+    for (size_t i = 0; i < hz_vector_size(shelf->slots); ++i) {
+        uint16_t slot = shelf->slots[i];
+        hz_ht_remove(c->id_ht, c->slots[slot].id.u32);
+        c->slots[slot].id = HZ_LRU_ID_INVALID;
+        c->free_slots[c->free_slot_count++] = slot;
+        --c->slots_occupied;
+    }
+}
+
+// Shelves from `first` on moved after a split or merge, fix the slot to shelf mapping.
+HZ_STATIC void hz_glyph_cache_renumber_shelves(hz_glyph_cache_t *c, int first)
+{
+    for (int i = first; i < (int)hz_vector_size(c->packer.shelves); ++i) {
+        hz_atlas_shelf_t *shelf = &c->packer.shelves[i];
+        for (size_t j = 0; j < hz_vector_size(shelf->slots); ++j) {
+            c->slot_shelf[shelf->slots[j]] = (uint16_t)i;
+        }
+    }
+}
+
+// Least recently used shelf at least min_h tall, holding glyphs and not referenced by the
+// current batch. Ties go to the shortest shelf.
+HZ_STATIC int hz_glyph_cache_lru_shelf(hz_glyph_cache_t *c, int min_h)
+{
+    int victim = -1;
+
+    for (int i = 0; i < (int)hz_vector_size(c->packer.shelves); ++i) {
+        hz_atlas_shelf_t *shelf = &c->packer.shelves[i];
+        if (shelf->batch == c->batch || shelf->h < min_h || !hz_vector_size(shelf->slots)) continue;
+
+        hz_atlas_shelf_t *v = victim < 0 ? NULL : &c->packer.shelves[victim];
+        if (v == NULL || shelf->batch < v->batch || (shelf->batch == v->batch && shelf->h < v->h))
+            victim = i;
+    }
+
+    return victim;
+}
+
+// Empties the least recently used run of adjacent shelves that together are at least h tall,
+// merging it into a single shelf. A run reaching the last shelf also counts the free space
+// above it, so when nothing is in use this ends up emptying the whole page.
+HZ_STATIC hz_bool hz_glyph_cache_evict_run(hz_glyph_cache_t *c, int h)
+{
+    hz_atlas_packer_t *p = &c->packer;
+    int shelf_cnt = (int)hz_vector_size(p->shelves);
+    int first = -1, count = 0;
+    uint32_t first_batch = UINT32_MAX;
+
+    for (int i = 0; i < shelf_cnt; ++i) {
+        int run_h = 0;
+        uint32_t run_batch = 0;
+
+        for (int j = i; j < shelf_cnt && p->shelves[j].batch != c->batch; ++j) {
+            run_h += p->shelves[j].h;
+            run_batch = HZ_MAX(run_batch, p->shelves[j].batch);
+
+            if (run_h >= h || (j == shelf_cnt-1 && run_h + p->height - p->top >= h)) {
+                if (run_batch < first_batch) {
+                    first = i;
+                    count = j - i + 1;
+                    first_batch = run_batch;
+                }
+                break;
+            }
+        }
+    }
+
+    if (first < 0)
+        return HZ_FALSE;
+
+    for (int i = first; i < first + count; ++i) {
+        hz_glyph_cache_free_shelf_slots(c, i);
+    }
+
+    hz_atlas_packer_merge_shelves(p, first, count);
+    hz_glyph_cache_renumber_shelves(c, first + 1);
+    return HZ_TRUE;
+}
+
+// Places a w*h glyph, evicting whole shelves when the atlas or the slots run out.
+// Returns the slot or -1 if everything left is in use by the current batch.
+HZ_STATIC int hz_glyph_cache_alloc_rect(hz_glyph_cache_t *c, int w, int h, hz_rect_t *rect)
+{
+    hz_atlas_packer_t *p = &c->packer;
+    int shelf_index;
+
+    while (!c->free_slot_count) {
+        int victim = hz_glyph_cache_lru_shelf(c, 0);
+        if (victim < 0) return -1;
+        hz_glyph_cache_free_shelf_slots(c, victim);
+        hz_atlas_packer_clear_shelf(p, victim);
+    }
+
+    w = HZ_MIN(w, p->width);
+    h = HZ_MIN(h, p->height);
+
+    for (;;) {
+        int shelf_cnt = (int)hz_vector_size(p->shelves);
+        shelf_index = hz_atlas_packer_alloc(p, w, h, rect);
+
+        if (shelf_index >= 0) {
+            if ((int)hz_vector_size(p->shelves) > shelf_cnt && shelf_index < shelf_cnt - 1)
+                hz_glyph_cache_renumber_shelves(c, shelf_index + 1); // split a shelf
+
+            break;
+        }
+
+        // evict a single shelf when one is tall enough, otherwise merge adjacent ones
+        int victim = hz_glyph_cache_lru_shelf(c, h);
+        if (victim >= 0) {
+            hz_glyph_cache_free_shelf_slots(c, victim);
+            hz_atlas_packer_clear_shelf(p, victim);
+        } else if (!hz_glyph_cache_evict_run(c, h)) {
+            return -1;
+        }
+    }
+
+    hz_atlas_shelf_t *shelf = &p->shelves[shelf_index];
+    uint16_t slot = c->free_slots[--c->free_slot_count];
+    hz_vector_push_back(shelf->slots, slot);
+    shelf->batch = c->batch;
+    c->slot_shelf[slot] = (uint16_t)shelf_index;
+    ++c->slots_occupied;
+    return slot;
+}
+
+// initial capacity hint, the table grows as needed and keeps its size across frames
+#define HZ_UNIQUE_GLYPHS_PER_FRAME_HINT 1024
+
+hz_error_t hz_command_list_init(hz_command_list_t *cmd_list)
+{
+    cmd_list->draw_data = NULL;
+    cmd_list->styles = NULL;
+    cmd_list->cameras = NULL;
+    cmd_list->unique_glyph_ht = hz_ht_create(hz_get_allocator(), HZ_UNIQUE_GLYPHS_PER_FRAME_HINT);
+    return cmd_list->unique_glyph_ht != NULL ? HZ_OK : HZ_ERROR_OUT_OF_MEMORY;
+}
+
+void hz_command_list_clear(hz_command_list_t *cmd_list)
+{
+    hz_vector_clear(cmd_list->draw_data);
+    hz_vector_clear(cmd_list->styles);
+    hz_vector_clear(cmd_list->cameras);
+    hz_ht_clear(cmd_list->unique_glyph_ht);
+}
+
+#define HZ_CONTEXT_DFLT_MEMORY_SIZE (1024*1024) /*1MiB*/
+#ifndef HZ_CONTEXT_MEMORY_SIZE
+#   define HZ_CONTEXT_MEMORY_SIZE HZ_CONTEXT_DFLT_MEMORY_SIZE
+#endif
+
+#define HZ_CONTEXT_FRAME_MEMORY_SIZE 1048576
+#define HZ_CONTEXT_FONT_TABLE_SIZE 64
+#define HZ_SCALED_METRICS_CACHE_SIZE 16
+
+// Glyph metrics of a face scaled to a pixel size, SoA so drawing only touches the fields it
+// needs. Glyphs are scaled on first use, filled marks the ones that are.
+typedef struct {
+    uint16_t font_id;
+    float px_size;
+    float scale;
+    float ascent, descent, line_gap;
+    uint32_t glyph_count;
+    uint64_t last_use;
+    float *x0, *y0, *x1, *y1; // glyph box, the pen advances by the shaped metrics
+    uint32_t *filled; // one bit per glyph
+} hz_scaled_metrics_t;
+
+typedef struct {
+    hz_scaled_metrics_t entries[HZ_SCALED_METRICS_CACHE_SIZE];
+    size_t count;
+    uint64_t clock;
+} hz_scaled_metrics_cache_t;
+
+struct hz_context_t {
+    hz_command_list_t frame_cmds;
+    hz_font_data_t font_table [HZ_CONTEXT_FONT_TABLE_SIZE];
+    uint16_t font_id_counter;
+    hz_glyph_cache_t lru;
+    hz_memory_arena_t memory_arena;
+    hz_memory_arena_t frame_arena;
+    void *arena_buffer, *frame_arena_buffer;
+    hz_scaled_metrics_cache_t scaled_metrics;
+    hz_mat4 camera_matrix;
+    hz_bool camera_dirty; // camera changed since the last range was recorded
+    size_t camera_cursor; // camera range of resolve_cursor
+    size_t resolve_cursor; // first instance of draw_data not yet resolved by hz_frame_resolve
+    // hz_frame_resolve result arrays, allocated once per frame and reused by every batch
+    hz_cache_id_t *raster_ids;
+    uint16_t *raster_slots;
+    hz_rect_t *raster_rects;
+};
+
+hz_context_t *hz_context_create (hz_glyph_cache_opts_t *opts) {
+    hz_context_t *ctx = hz_malloc(sizeof(*ctx));
+    if (ctx == NULL) return NULL;
+
+    hz_error_t err = hz_command_list_init(&ctx->frame_cmds);
     ctx->arena_buffer = hz_malloc(HZ_CONTEXT_MEMORY_SIZE);
-    hz_memory_arena_init(&ctx->memory_arena, (uint8_t *)ctx->arena_buffer, HZ_CONTEXT_MEMORY_SIZE);
     ctx->frame_arena_buffer = hz_malloc(HZ_CONTEXT_FRAME_MEMORY_SIZE);
+    if (err != HZ_OK || ctx->arena_buffer == NULL || ctx->frame_arena_buffer == NULL) {
+        hz_ht_destroy(ctx->frame_cmds.unique_glyph_ht);
+        hz_free(ctx->arena_buffer);
+        hz_free(ctx->frame_arena_buffer);
+        hz_free(ctx);
+        return NULL;
+    }
+
+    hz_memory_arena_init(&ctx->memory_arena, (uint8_t *)ctx->arena_buffer, HZ_CONTEXT_MEMORY_SIZE);
     hz_memory_arena_init(&ctx->frame_arena, (uint8_t *)ctx->frame_arena_buffer, HZ_CONTEXT_FRAME_MEMORY_SIZE);
-    hz_lru_cache_init(&ctx->memory_arena, &ctx->lru, opts->x_cells * opts->y_cells, 0.5f);
+    int cache_sz = opts->x_cells * opts->y_cells;
+    if (opts->packing == HZ_GLYPH_CACHE_PACKING_SHELF && opts->max_glyphs > 0)
+        cache_sz = opts->max_glyphs;
+
+    hz_zero_struct(ctx->scaled_metrics);
+    if (hz_lru_cache_init(&ctx->memory_arena, &ctx->lru, cache_sz, 0.5f) != HZ_OK) {
+        hz_context_release(ctx);
+        return NULL;
+    }
+
+    hz_glyph_cache_setup_packing(&ctx->memory_arena, &ctx->lru, opts);
     ctx->font_id_counter = 0;
+    ctx->camera_matrix = hz_mat4_identity();
+    ctx->camera_dirty = HZ_TRUE;
+    ctx->camera_cursor = 0;
+    ctx->resolve_cursor = 0;
+    ctx->raster_ids = NULL;
     return ctx;
 }
 
@@ -7216,6 +10835,13 @@ hz_memory_arena_t *hz_get_frame_arena(hz_context_t *ctx) {
 }
 
 void hz_context_release (hz_context_t *ctx) {
+    hz_vector_destroy(ctx->frame_cmds.draw_data);
+    hz_vector_destroy(ctx->frame_cmds.styles);
+    hz_vector_destroy(ctx->frame_cmds.cameras);
+    hz_ht_destroy(ctx->frame_cmds.unique_glyph_ht);
+    hz_lru_cache_release(&ctx->lru);
+    for (size_t i = 0; i < ctx->scaled_metrics.count; ++i)
+        hz_free(ctx->scaled_metrics.entries[i].x0);
     hz_free(ctx->arena_buffer);
     hz_free(ctx->frame_arena_buffer);
     hz_free(ctx);
@@ -7240,6 +10866,10 @@ uint16_t hz_context_stash_font(hz_context_t *ctx, const hz_font_data_t *fd)
 void hz_frame_begin(hz_context_t *ctx) {
     hz_command_list_clear(&ctx->frame_cmds);
     hz_memory_arena_reset(&ctx->frame_arena);
+    ctx->camera_dirty = HZ_TRUE;
+    ctx->camera_cursor = 0;
+    ctx->resolve_cursor = 0;
+    ctx->raster_ids = NULL;
 }
 
 typedef struct {
@@ -7268,6 +10898,124 @@ void hz_frame_end(hz_context_t *ctx) {
     }
 }
 
+// Sizes the atlas rect of a glyph from its bounding box at the cache's glyph height.
+HZ_STATIC int hz_glyph_cache_alloc_glyph(hz_context_t *ctx, hz_cache_id_t id, hz_rect_t *rect)
+{
+    hz_glyph_cache_t *lru = &ctx->lru;
+    hz_face_t *face = hz_context_get_face(ctx, id.font_id);
+    float scale = hz_face_scale_for_pixel_h(face, hz_glyph_cache_glyph_height(&lru->opts));
+    hz_bbox_t bounds;
+    hz_face_get_glyph_box(face, id.glyph_id, &bounds);
+
+    int pad = (int)ceilf(2.0f*lru->opts.padd);
+    int w = (int)ceilf((float)(bounds.x1 - bounds.x0) * scale) + pad;
+    int h = (int)ceilf((float)(bounds.y1 - bounds.y0) * scale) + pad;
+    return hz_glyph_cache_alloc_rect(lru, HZ_MAX(w, 1), HZ_MAX(h, 1), rect);
+}
+
+hz_bool hz_frame_resolve(hz_context_t *ctx, hz_frame_result_t *result)
+{
+    hz_command_list_t *frame_cmds = &ctx->frame_cmds;
+    hz_glyph_cache_t *lru = &ctx->lru;
+    hz_ht_t *batch_ht = frame_cmds->unique_glyph_ht;
+    size_t instance_cnt = hz_vector_size(frame_cmds->draw_data);
+    size_t camera_cnt = hz_vector_size(frame_cmds->cameras);
+    size_t v = ctx->resolve_cursor;
+
+    // the batch can't go past the next camera change
+    size_t batch_end = instance_cnt;
+    if (ctx->camera_cursor + 1 < camera_cnt)
+        batch_end = frame_cmds->cameras[ctx->camera_cursor + 1].first_instance;
+
+    // Slots touched with the current batch stamp are referenced by this batch and
+    // can't be evicted until it has been drawn.
+    ++lru->batch;
+    hz_ht_clear(batch_ht);
+
+    if (ctx->raster_ids == NULL) {
+        ctx->raster_ids = hz_memory_arena_alloc(&ctx->frame_arena, sizeof(hz_cache_id_t)*lru->sz);
+        ctx->raster_slots = hz_memory_arena_alloc(&ctx->frame_arena, sizeof(uint16_t)*lru->sz);
+        ctx->raster_rects = hz_memory_arena_alloc(&ctx->frame_arena, sizeof(hz_rect_t)*lru->sz);
+    }
+
+    *result = (hz_frame_result_t){
+        .first_instance = v,
+        .raster_ids = ctx->raster_ids,
+        .raster_slots = ctx->raster_slots,
+        .raster_rects = ctx->raster_rects,
+        .camera = camera_cnt ? frame_cmds->cameras[ctx->camera_cursor].vp : ctx->camera_matrix
+    };
+    hz_bool shelf_packing = lru->opts.packing == HZ_GLYPH_CACHE_PACKING_SHELF;
+
+    for (; v < batch_end; ++v) {
+        hz_glyph_instance_t *g = &frame_cmds->draw_data[v];
+        uint32_t key = g->lru_id.u32;
+        hz_ht_iter_t it;
+
+        if (hz_ht_search(batch_ht, key, &it)) {
+            // already resolved by an earlier instance of this batch
+            g->slot = (uint16_t)*it.ptr_value;
+            continue;
+        }
+
+        struct hz_cache_node_t *n = hz_lru_cache_get_node(lru, g->lru_id);
+        if (shelf_packing) {
+            if (n == NULL) {
+                hz_rect_t rect;
+                int slot = hz_glyph_cache_alloc_glyph(ctx, g->lru_id, &rect);
+                if (slot < 0) {
+                    // every shelf is in use by this batch, the rest goes into the next one
+                    break;
+                }
+
+                n = &lru->nodes[slot];
+                lru->slots[slot].id = g->lru_id;
+                hz_ht_insert(lru->id_ht, key, slot);
+                result->raster_ids[result->raster_count] = g->lru_id;
+                result->raster_slots[result->raster_count] = n->slot;
+                result->raster_rects[result->raster_count] = rect;
+                ++result->raster_count;
+            }
+
+            lru->packer.shelves[lru->slot_shelf[n->slot]].batch = lru->batch;
+        } else if (n != NULL) {
+            hz_lru_cache_move_to_front(lru, n);
+        } else {
+            if (!hz_lru_cache_is_full(lru)) {
+                n = hz_lru_cache_add_node(lru);
+            } else {
+                n = lru->ln->prev;
+                if (n->batch == lru->batch) {
+                    // every slot is in use by this batch, the rest goes into the next one
+                    break;
+                }
+
+                hz_lru_cache_move_to_front(lru, n);
+                hz_ht_remove(lru->id_ht, lru->slots[n->slot].id.u32);
+            }
+
+            lru->slots[n->slot].id = g->lru_id;
+            hz_ht_insert(lru->id_ht, key, n->slot);
+            result->raster_ids[result->raster_count] = g->lru_id;
+            result->raster_slots[result->raster_count] = n->slot;
+            result->raster_rects[result->raster_count] = hz_glyph_cache_compute_cell_rect(&lru->opts, n->slot);
+            ++result->raster_count;
+        }
+
+        n->batch = lru->batch;
+        hz_ht_insert(batch_ht, key, n->slot);
+        g->slot = (uint16_t)n->slot;
+    }
+
+    result->instance_count = v - result->first_instance;
+    result->unique_count = hz_ht_size(batch_ht);
+    ctx->resolve_cursor = v;
+    if (v == batch_end && v < instance_cnt)
+        ++ctx->camera_cursor;
+
+    return v == instance_cnt;
+}
+
 typedef struct {
     char r,g,b,a;
 } hz_color_t;
@@ -7288,168 +11036,1914 @@ uint32_t hz_vec4_to_u32(hz_vec4 *v)
     return r;
 }
 
-void hz_draw_buffer(hz_context_t *ctx, hz_buffer_t *buffer, uint16_t font_id,
-                    hz_vec3 pos, hz_buffer_style_t *style,
-                    float px_size)
+// Sets *clamped if size doesn't fit in the instance's fixed point.
+HZ_STATIC uint16_t hz_glyph_instance_quantize_size(float size, hz_bool *clamped)
+{
+    float q = size * HZ_GLYPH_INSTANCE_SIZE_SCALE + 0.5f;
+    if (q >= 65536.0f) {
+        *clamped = HZ_TRUE;
+        return 65535;
+    }
+
+    return (uint16_t)(q <= 0.0f ? 0.0f : q);
+}
+
+// Returns the metrics of font_id at px_size, reusing the least recently used entry on a miss.
+HZ_STATIC hz_scaled_metrics_t *hz_context_get_scaled_metrics(hz_context_t *ctx, uint16_t font_id, float px_size)
+{
+    hz_scaled_metrics_cache_t *mc = &ctx->scaled_metrics;
+    hz_scaled_metrics_t *m = NULL;
+    ++mc->clock;
+
+    size_t i;
+    for (i = 0; i < mc->count; ++i) {
+        hz_scaled_metrics_t *e = &mc->entries[i];
+        if (e->font_id == font_id && e->px_size == px_size) {
+            e->last_use = mc->clock;
+            if (e->x0 != NULL) return e;
+            m = e; // allocating the glyph boxes failed last time, try again
+            break;
+        }
+
+        if (m == NULL || e->last_use < m->last_use)
+            m = e;
+    }
+
+    if (i == mc->count && mc->count < HZ_SCALED_METRICS_CACHE_SIZE)
+        m = &mc->entries[mc->count++];
+
+    hz_face_t *face = ctx->font_table[font_id].face;
+    uint32_t glyph_count = hz_face_get_num_glyphs(face);
+
+    // all arrays share one allocation starting at x0, kept if the glyph count matches
+    if (m->x0 == NULL || m->glyph_count != glyph_count) {
+        hz_free(m->x0);
+        m->x0 = hz_malloc(sizeof(float)*4*glyph_count + sizeof(uint32_t)*((glyph_count + 31) / 32));
+        if (m->x0 == NULL) {
+            // no glyph box can be kept, the line metrics below still are
+            glyph_count = 0;
+            m->y0 = m->x1 = m->y1 = NULL;
+            m->filled = NULL;
+        } else {
+            m->y0 = m->x0 + glyph_count;
+            m->x1 = m->y0 + glyph_count;
+            m->y1 = m->x1 + glyph_count;
+            m->filled = (uint32_t *)(m->y1 + glyph_count);
+        }
+    }
+
+    int ascent, descent, line_gap;
+    stbtt_GetFontVMetrics(face->fontinfo, &ascent, &descent, &line_gap);
+    m->font_id = font_id;
+    m->px_size = px_size;
+    m->scale = hz_face_scale_for_pixel_h(face, px_size);
+    m->ascent = ascent * m->scale;
+    m->descent = descent * m->scale;
+    m->line_gap = line_gap * m->scale;
+    m->glyph_count = glyph_count;
+    m->last_use = mc->clock;
+    if (m->filled != NULL) HZ_MEMSET(m->filled, 0, sizeof(uint32_t)*((glyph_count + 31) / 32));
+    return m;
+}
+
+#define HZ_LAYER_STYLE_CACHE_SIZE 64
+
+// Style entries a draw call added for its color layers, by layer color. Colors that collide in the
+// cache just get another entry.
+typedef struct {
+    uint32_t color_rgba[HZ_LAYER_STYLE_CACHE_SIZE];
+    int32_t style[HZ_LAYER_STYLE_CACHE_SIZE];
+} hz_layer_style_cache_t;
+
+// Style index of a color layer drawn with base_style, -1 when the frame's style table is full.
+HZ_STATIC int32_t
+hz_color_layer_style(hz_command_list_t *cmds, hz_layer_style_cache_t *cache,
+                     const hz_glyph_style_t *base_style, const hz_color_layer_t *layer)
+{
+    hz_glyph_style_t style = *base_style;
+    style.color_rgba = layer->color_rgba;
+
+    if (layer->flags & HZ_COLOR_LAYER_FOREGROUND) {
+        uint32_t alpha = ((base_style->color_rgba >> 24) * (layer->color_rgba >> 24) + 127) / 255;
+        style.color_rgba = (base_style->color_rgba & 0xffffffu) | alpha << 24;
+    }
+
+    size_t h = (style.color_rgba * 2654435761u) >> 26;
+    if (cache->style[h] >= 0 && cache->color_rgba[h] == style.color_rgba)
+        return cache->style[h];
+
+    size_t style_cnt = hz_vector_size(cmds->styles);
+    if (style_cnt >= HZ_MAX_FRAME_STYLES)
+        return -1;
+
+    hz_vector_push_back(cmds->styles, style);
+    cache->color_rgba[h] = style.color_rgba;
+    cache->style[h] = (int32_t)style_cnt;
+    return (int32_t)style_cnt;
+}
+
+HZ_STATIC void hz_scaled_metrics_fill(hz_scaled_metrics_t *m, hz_face_t *face, hz_index_t glyph)
+{
+    const hz_metrics_t *gm = hz_face_get_glyph_metrics(face, glyph);
+    m->x0[glyph] = gm->bounds.x0 * m->scale;
+    m->y0[glyph] = gm->bounds.y0 * m->scale;
+    m->x1[glyph] = gm->bounds.x1 * m->scale;
+    m->y1[glyph] = gm->bounds.y1 * m->scale;
+    m->filled[glyph >> 5] |= 1u << (glyph & 31);
+}
+
+hz_error_t hz_draw_buffer(hz_context_t *ctx, hz_buffer_t *buffer, uint16_t font_id,
+                          hz_vec3 pos, hz_buffer_style_t *style,
+                          float px_size)
 {
     const hz_font_data_t *font_data = &ctx->font_table[font_id];
     hz_face_t *face = font_data->face;
-    float text_width = 0.0f;
     float pen_x=pos.x,pen_y=pos.y;
-    float v_scale = hz_face_scale_for_pixel_h(face,px_size);
+    hz_scaled_metrics_t *sm = hz_context_get_scaled_metrics(ctx, font_id, px_size);
+    float v_scale = sm->scale;
+    if (sm->x0 == NULL && buffer->glyph_count)
+        return HZ_ERROR_OUT_OF_MEMORY;
+
+    hz_command_list_t *cmds = &ctx->frame_cmds;
+    hz_glyph_style_t packed_style = {
+        .color_rgba = hz_vec4_to_u32(&style->col),
+        .outline_color_rgba = hz_vec4_to_u32(&style->outline_col),
+        .weight_shear = ((uint32_t)(style->shear*65535.0f) & 0xffffu)
+    };
 
-    int ascent, descent, lineGap;
-    stbtt_GetFontVMetrics(face->fontinfo, &ascent, &descent, &lineGap);
-    ascent = ascent * v_scale;
-    descent = descent * v_scale;
+    // consecutive draws with the same style share a table entry
+    size_t style_cnt = hz_vector_size(cmds->styles);
+    if (!style_cnt || memcmp(&cmds->styles[style_cnt-1], &packed_style, sizeof(packed_style))) {
+        if (style_cnt >= HZ_MAX_FRAME_STYLES) {
+            // style indices are 16 bits, the table is full for this frame
+            return HZ_ERROR_LIMIT_EXCEEDED;
+        }
+        hz_vector_push_back(cmds->styles, packed_style);
+        ++style_cnt;
+    }
+    uint16_t style_index = (uint16_t)(style_cnt - 1);
+
+    if (ctx->camera_dirty) {
+        hz_camera_range_t range = {hz_vector_size(cmds->draw_data), ctx->camera_matrix};
+        size_t camera_cnt = hz_vector_size(cmds->cameras);
+        if (camera_cnt && cmds->cameras[camera_cnt-1].first_instance == range.first_instance)
+            cmds->cameras[camera_cnt-1] = range; // nothing was drawn with the previous camera
+        else
+            hz_vector_push_back(cmds->cameras, range);
+        ctx->camera_dirty = HZ_FALSE;
+    }
+
+    // color glyphs are drawn as one instance per layer, each layer glyph is cached like any other glyph
+    size_t instance_cnt = buffer->glyph_count;
+    const hz_color_layer_t *layers;
+    if (face->color_layer_starts != NULL) {
+        for (size_t i = 0; i < buffer->glyph_count; ++i) {
+            size_t layer_cnt = hz_face_get_glyph_color_layers(face, buffer->glyph_indices[i], &layers);
+            if (layer_cnt) instance_cnt += layer_cnt - 1;
+        }
+    }
+
+    size_t first = hz_vector_size(cmds->draw_data);
+    size_t count = 0;
+    hz_vector_extend(cmds->draw_data, instance_cnt);
+    hz_layer_style_cache_t layer_styles;
+    for (size_t i = 0; i < HZ_LAYER_STYLE_CACHE_SIZE; ++i) layer_styles.style[i] = -1;
+    hz_bool clamped = HZ_FALSE, dropped = HZ_FALSE;
 
     for (size_t i = 0; i < buffer->glyph_count; ++i) {
         hz_glyph_metrics_t metrics = buffer->glyph_metrics[i];
-        hz_glyph_instance_t g;
-        hz_index_t gid = buffer->glyph_indices[i];
-        g.lru_id.glyph_id = gid;
-        g.lru_id.font_id = font_id;
+        hz_index_t base_gid = buffer->glyph_indices[i];
+        hz_color_layer_t plain = {base_gid, 0, 0};
+        size_t layer_cnt = hz_face_get_glyph_color_layers(face, base_gid, &layers);
+        if (!layer_cnt) {
+            layers = &plain;
+            layer_cnt = 1;
+        }
 
-        int32_t xAdvance = metrics.xAdvance;
-        int32_t yAdvance = metrics.yAdvance;
-        int32_t x_offset  = metrics.xOffset;
-        int32_t y_offset  = metrics.yOffset;
+        for (size_t l = 0; l < layer_cnt; ++l) {
+            hz_index_t gid = layers[l].glyph;
+            int32_t layer_style = layers == &plain ? style_index
+                                : hz_color_layer_style(cmds, &layer_styles, &packed_style, &layers[l]);
+
+            dropped |= layer_style < 0;
+            if (gid < sm->glyph_count && layer_style >= 0) {
+                if (!(sm->filled[gid >> 5] & (1u << (gid & 31))))
+                    hz_scaled_metrics_fill(sm, face, gid);
+
+                hz_glyph_instance_t *g = &cmds->draw_data[first + count++];
+                g->lru_id.glyph_id = gid;
+                g->lru_id.font_id = font_id;
+                g->x = pen_x + sm->x0[gid] + metrics.xOffset*v_scale;
+                g->y = pen_y + sm->y0[gid] + metrics.yOffset*v_scale;
+                g->w = hz_glyph_instance_quantize_size(sm->x1[gid] - sm->x0[gid], &clamped);
+                g->h = hz_glyph_instance_quantize_size(sm->y1[gid] - sm->y0[gid], &clamped);
+                g->style = (uint16_t)layer_style;
+                g->slot = 0;
+            }
+        }
 
-        int ax;
-        int lsb;
-        stbtt_GetGlyphHMetrics(face->fontinfo, gid, &ax, &lsb);
-
-        int ix0,iy0,ix1,iy1;
-        stbtt_GetGlyphBox(face->fontinfo, gid,
-                          &ix0, &iy0, &ix1, &iy1);
-
-        /* compute y (different characters have different heights */
-        int y = pen_y - (ascent - iy0);
-
-        /* render character (stride and offset is important here) */
-        float c_w = (ix1 - ix0)*v_scale;
-        float c_h = (iy1 - iy0)*v_scale;
-        float dstx = pen_x + (ix0 + x_offset)*v_scale;
-        float dsty = pen_y + (iy0 + y_offset)*v_scale;//(ascent - iy0*v_scale) + y_offset*v_scale + 0.5f;
-        // c_w -= 0.5f;
-        // c_h -= 0.5f;
-
-        hz_mat4 mvp;
-        // hz_mat4 scale_matrix = hz_mat4_scale(c_w, c_h, 1.0f);
-        // hz_mat4 translation_matrix = hz_mat4_translate(dstx, dsty, 0.0f);
-        // hz_mat4_mult(&translation_matrix, &scale_matrix, &mvp);
-        // hz_mat4_mult(&ctx->camera_matrix, &mvp, &mvp);
-        g.vp = ctx->camera_matrix;
-        g.v4_ts = (hz_vec4){dstx, dsty, c_w, c_h};
-        g.sv.color_rgba = hz_vec4_to_u32(&style->col);
-        g.sv.outline_color_rgba = hz_vec4_to_u32(&style->outline_col);
-        g.sv.weight_sheer = ((uint32_t)(style->shear*65535.0f) & 0xffffu);
-
-        hz_vector_push_back(ctx->frame_cmds.draw_data,g);
         pen_x += metrics.xAdvance * v_scale;
     }
-}
 
-hz_command_list_t *hz_get_frame_commands(hz_context_t *ctx) {
-    return &ctx->frame_cmds;
+    hz_vector_header(cmds->draw_data)->size = first + count;
+    return clamped || dropped ? HZ_ERROR_LIMIT_EXCEEDED : HZ_OK;
 }
 
-void hz_shape_draw_data_clear(hz_shape_draw_data_t *draw_data)
+hz_bidi_class_t hz_ucd_bidi_class(const hz_ucd_t *ucd, hz_unicode_t c)
 {
-    if (draw_data->verts != NULL) {
-        hz_vector_destroy(draw_data->verts);
-    }
+    return (hz_bidi_class_t)hz_ucd_record(ucd, c)->bidi_class;
 }
 
-hz_rect_t hz_glyph_cache_compute_cell_rect(hz_glyph_cache_opts_t *opts, int cell)
+#define HZ_BC(_C) HZ_BIDI_CLASS_##_C
+#define HZ_BCM(_C) (1u << HZ_BIDI_CLASS_##_C)
+
+#define HZ_BIDI_EXPLICIT_MASK (HZ_BCM(LRE) | HZ_BCM(LRO) | HZ_BCM(RLE) | HZ_BCM(RLO) | HZ_BCM(PDF))
+#define HZ_BIDI_ISOLATE_MASK (HZ_BCM(LRI) | HZ_BCM(RLI) | HZ_BCM(FSI) | HZ_BCM(PDI))
+#define HZ_BIDI_REMOVED_MASK (HZ_BIDI_EXPLICIT_MASK | HZ_BCM(BN)) // X9
+#define HZ_BIDI_NEUTRAL_MASK (HZ_BCM(B) | HZ_BCM(S) | HZ_BCM(WS) | HZ_BCM(ON) | HZ_BIDI_ISOLATE_MASK)
+#define HZ_BIDI_WHITESPACE_MASK (HZ_BCM(WS) | HZ_BIDI_ISOLATE_MASK | HZ_BIDI_REMOVED_MASK) // L1
+// classes which can make a left to right paragraph anything but level 0
+#define HZ_BIDI_RTL_MASK (HZ_BCM(R) | HZ_BCM(AL) | HZ_BCM(AN) | HZ_BIDI_EXPLICIT_MASK | HZ_BIDI_ISOLATE_MASK)
+
+// match entries are the index of the matching isolate initiator or PDI, the top bits keep the
+// directional override of isolate initiators and PDIs as their class isn't changed by X5a-X5c
+// and X6a, so that X10 can still link them.
+#define HZ_BIDI_INDEX_MASK 0x3fffffffu
+#define HZ_BIDI_NONE HZ_BIDI_INDEX_MASK
+#define HZ_BIDI_OVERRIDE_L (1u << 30)
+#define HZ_BIDI_OVERRIDE_R (1u << 31)
+
+#define HZ_BIDI_MAX_BRACKET_DEPTH 63 // BD16
+
+HZ_STATIC HZ_INLINE hz_bool hz_bidi_is(uint8_t cls, uint32_t mask)
 {
-    HZ_ASSERT(cell < opts->x_cells*opts->y_cells);
-    float cw = (float)opts->width / (float)opts->x_cells;
-    float ch = (float)opts->height / (float)opts->y_cells;
-    int icx = cell % opts->x_cells;
-    int icy = cell / opts->x_cells;;
-    return (hz_rect_t){icx * cw, icy * ch, cw, ch};
+    return (HZ_FLAG(cls) & mask) != 0;
 }
 
-hz_vec2 hz_vec2_add(hz_vec2 v1, hz_vec2 v2) {
-    return (hz_vec2){v1.x+v2.x, v1.y+v2.y};
+HZ_STATIC HZ_INLINE hz_bool hz_bidi_is_isolate_initiator(uint8_t cls)
+{
+    return hz_bidi_is(cls, HZ_BCM(LRI) | HZ_BCM(RLI) | HZ_BCM(FSI));
 }
 
-hz_vec2 hz_vec2_mult_s(hz_vec2 v1, float scale) {
-    return (hz_vec2){v1.x*scale,v1.y*scale};
+// Direction of a resolved class for N0 and N1, numbers count as R and neutrals as none (ON).
+HZ_STATIC HZ_INLINE uint8_t hz_bidi_strong(uint8_t cls)
+{
+    if (cls == HZ_BC(L)) return HZ_BC(L);
+    if (hz_bidi_is(cls, HZ_BCM(R) | HZ_BCM(EN) | HZ_BCM(AN))) return HZ_BC(R);
+    return HZ_BC(ON);
 }
 
-int hz_face_get_glyph_shape(hz_face_t *face, hz_shape_draw_data_t *draw_data, hz_vec2 translate, float y_scale, hz_index_t glyph_index)
+// Paired bracket type of c, 1 for opening and 2 for closing brackets, 0 if c isn't one.
+// U+2329 and U+232A are canonically equivalent to U+3008 and U+3009 and are matched as those.
+HZ_STATIC int hz_bidi_bracket(hz_unicode_t c, hz_unicode_t *pair)
 {
-    #define PUSH_CURVE() do{hz_contour_t _contour = {hz_vector_size(draw_data->verts),0,pen}; hz_vector_push_back(draw_data->contours, _contour); c = hz_vector_top(draw_data->contours); } while(0)
+    size_t lo = 0, hi = HZ_UCD_BIDI_BRACKET_COUNT;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (hz_ucd_bidi_brackets[mid][0] < c) lo = mid + 1;
+        else hi = mid;
+    }
 
-    if (stbtt_IsGlyphEmpty(face->fontinfo, glyph_index)) {
+    if (lo == HZ_UCD_BIDI_BRACKET_COUNT || hz_ucd_bidi_brackets[lo][0] != c)
         return 0;
+
+    *pair = hz_ucd_bidi_brackets[lo][1];
+    return (int)hz_ucd_bidi_brackets[lo][2];
+}
+
+HZ_STATIC HZ_INLINE hz_unicode_t hz_bidi_canonical_bracket(hz_unicode_t c)
+{
+    return c == 0x2329 ? 0x3008 : c == 0x232a ? 0x3009 : c;
+}
+
+// P2, P3. First strong class of first..end, skipping isolates, ON if there is none.
+HZ_STATIC uint8_t hz_bidi_first_strong(const uint8_t *cls, const uint32_t *match, size_t first, size_t end)
+{
+    for (size_t i = first; i < end; ++i) {
+        uint8_t c = cls[i];
+        if (hz_bidi_is(c, HZ_BCM(L) | HZ_BCM(R) | HZ_BCM(AL))) return c;
+        if (hz_bidi_is_isolate_initiator(c)) {
+            uint32_t pdi = match[i] & HZ_BIDI_INDEX_MASK;
+            if (pdi == HZ_BIDI_NONE) break;
+            i = pdi;
+        }
     }
-    
-    stbtt_vertex *vertices = NULL;
-    size_t nverts = stbtt_GetGlyphShape(face->fontinfo, glyph_index, &vertices);
-    
-    hz_vec2 pen = {0,0};
-    hz_contour_t *c = NULL;
-    size_t i = 0;
-    
-    while (i < nverts) {
-        switch (vertices[i].type) {
-            default:break;
-            case HZ_VERTEX_TYPE_MOVETO: { // moveto
-                pen.x = translate.x + vertices[i].x* y_scale; pen.y = translate.y + vertices[i].y* y_scale;
-                PUSH_CURVE();
+    return HZ_BC(ON);
+}
+
+typedef struct {
+    uint8_t level;
+    uint8_t override; // L, R or ON when there is none
+    uint8_t isolate;
+} hz_bidi_status_t;
+
+// X1-X8, embedding levels are given to every character including the ones removed by X9.
+HZ_STATIC void hz_bidi_resolve_explicit(const hz_bidi_paragraph_t *para, uint8_t *cls, uint32_t *match,
+                                        uint8_t *embedding)
+{
+    hz_bidi_status_t stack[HZ_BIDI_MAX_DEPTH + 2];
+    size_t sp = 1;
+    stack[0] = (hz_bidi_status_t){para->base_level, HZ_BC(ON), HZ_FALSE};
+    size_t overflow_isolates = 0, overflow_embeddings = 0, valid_isolates = 0;
+
+    for (size_t i = 0; i < para->char_count; ++i) {
+        uint8_t c = cls[i];
+        hz_bidi_status_t *top = &stack[sp - 1];
+        embedding[i] = top->level;
+
+        switch (c) {
+            case HZ_BC(RLE): case HZ_BC(LRE): case HZ_BC(RLO): case HZ_BC(LRO): { // X2-X5
+                hz_bool rtl = c == HZ_BC(RLE) || c == HZ_BC(RLO);
+                uint8_t level = rtl ? (top->level + 1) | 1 : (top->level + 2) & ~1;
+                if (level <= HZ_BIDI_MAX_DEPTH && !overflow_isolates && !overflow_embeddings) {
+                    uint8_t override = c == HZ_BC(RLO) ? HZ_BC(R) : c == HZ_BC(LRO) ? HZ_BC(L) : HZ_BC(ON);
+                    stack[sp++] = (hz_bidi_status_t){level, override, HZ_FALSE};
+                } else if (!overflow_isolates) {
+                    ++overflow_embeddings;
+                }
                 break;
             }
 
-            case HZ_VERTEX_TYPE_LINE: { // line
-                hz_bezier_vertex_t v;
-                v.type = vertices[i].type;
-                v.v1 = pen;
-                v.v2 = hz_vec2_add(translate, hz_vec2_mult_s((hz_vec2){vertices[i].x,vertices[i].y}, y_scale));
-                hz_vector_push_back(draw_data->verts, v);
-                pen = v.v2;
-                ++c->curve_count;
+            case HZ_BC(RLI): case HZ_BC(LRI): case HZ_BC(FSI): { // X5a-X5c
+                if (top->override != HZ_BC(ON))
+                    match[i] |= top->override == HZ_BC(L) ? HZ_BIDI_OVERRIDE_L : HZ_BIDI_OVERRIDE_R;
+
+                hz_bool rtl = c == HZ_BC(RLI);
+                if (c == HZ_BC(FSI)) {
+                    uint32_t pdi = match[i] & HZ_BIDI_INDEX_MASK;
+                    size_t end = pdi == HZ_BIDI_NONE ? para->char_count : pdi;
+                    uint8_t first = hz_bidi_first_strong(cls, match, i + 1, end);
+                    rtl = first == HZ_BC(R) || first == HZ_BC(AL);
+                }
+
+                uint8_t level = rtl ? (top->level + 1) | 1 : (top->level + 2) & ~1;
+                if (level <= HZ_BIDI_MAX_DEPTH && !overflow_isolates && !overflow_embeddings) {
+                    ++valid_isolates;
+                    stack[sp++] = (hz_bidi_status_t){level, HZ_BC(ON), HZ_TRUE};
+                } else {
+                    ++overflow_isolates;
+                }
                 break;
             }
-            case HZ_VERTEX_TYPE_QUADRATIC_BEZIER: { // quadratic bezier
-                hz_bezier_vertex_t v;
-                v.type = vertices[i].type;
-                v.v1 = pen;
-                v.v2 = hz_vec2_add(translate, hz_vec2_mult_s((hz_vec2){vertices[i].x,vertices[i].y}, y_scale));
-                v.c1 = hz_vec2_add(translate, hz_vec2_mult_s((hz_vec2){vertices[i].cx,vertices[i].cy}, y_scale));
-                hz_vector_push_back(draw_data->verts, v);
-                pen = v.v2;
-                ++c->curve_count;
-                break;
+
+            case HZ_BC(PDI): // X6a
+                if (overflow_isolates) {
+                    --overflow_isolates;
+                } else if (valid_isolates) {
+                    overflow_embeddings = 0;
+                    while (!stack[sp - 1].isolate) --sp;
+                    --sp;
+                    --valid_isolates;
+                }
+
+                top = &stack[sp - 1];
+                embedding[i] = top->level;
+                if (top->override != HZ_BC(ON))
+                    match[i] |= top->override == HZ_BC(L) ? HZ_BIDI_OVERRIDE_L : HZ_BIDI_OVERRIDE_R;
+                break;
+
+            case HZ_BC(PDF): // X7
+                if (overflow_isolates) {
+                } else if (overflow_embeddings) {
+                    --overflow_embeddings;
+                } else if (!top->isolate && sp >= 2) {
+                    --sp;
+                }
+                break;
+
+            case HZ_BC(B): // X8
+                embedding[i] = para->base_level;
+                sp = 1;
+                overflow_isolates = overflow_embeddings = valid_isolates = 0;
+                break;
+
+            case HZ_BC(BN):
+                break;
+
+            default: // X6
+                if (top->override != HZ_BC(ON)) cls[i] = top->override;
+                break;
+        }
+    }
+}
+
+typedef struct {
+    const hz_unicode_t *chars;
+    const uint8_t *cls;
+    const uint8_t *embedding; // levels from X1-X8, sos and eos are found with these
+    uint8_t *levels;
+    const uint32_t *seq; // character indices of the sequence
+    uint8_t *t; // working classes of the sequence
+    uint32_t *pair_close;
+    size_t count;
+    uint8_t sos, eos;
+} hz_bidi_sequence_t;
+
+// W1-W7 on an isolating run sequence.
+HZ_STATIC void hz_bidi_resolve_weak(hz_bidi_sequence_t *s)
+{
+    uint8_t *t = s->t;
+    size_t n = s->count;
+
+    // W1
+    for (size_t k = 0; k < n; ++k) {
+        if (t[k] != HZ_BC(NSM)) continue;
+        if (!k) t[k] = s->sos;
+        else t[k] = hz_bidi_is(t[k - 1], HZ_BIDI_ISOLATE_MASK) ? HZ_BC(ON) : t[k - 1];
+    }
+
+    // W2, W3
+    uint8_t last_strong = s->sos;
+    for (size_t k = 0; k < n; ++k) {
+        if (hz_bidi_is(t[k], HZ_BCM(L) | HZ_BCM(R) | HZ_BCM(AL))) last_strong = t[k];
+        else if (t[k] == HZ_BC(EN) && last_strong == HZ_BC(AL)) t[k] = HZ_BC(AN);
+        if (t[k] == HZ_BC(AL)) t[k] = HZ_BC(R);
+    }
+
+    // W4, a separator can't follow one that was changed since that one is followed by a number
+    for (size_t k = 1; k + 1 < n; ++k) {
+        uint8_t prev = t[k - 1];
+        if (prev != t[k + 1]) continue;
+        if (t[k] == HZ_BC(ES) && prev == HZ_BC(EN)) t[k] = HZ_BC(EN);
+        else if (t[k] == HZ_BC(CS) && (prev == HZ_BC(EN) || prev == HZ_BC(AN))) t[k] = prev;
+    }
+
+    // W5, W6
+    for (size_t k = 0; k < n;) {
+        if (t[k] != HZ_BC(ET)) {
+            if (hz_bidi_is(t[k], HZ_BCM(ES) | HZ_BCM(CS))) t[k] = HZ_BC(ON);
+            ++k;
+            continue;
+        }
+
+        size_t end = k;
+        while (end < n && t[end] == HZ_BC(ET)) ++end;
+        uint8_t to = (k && t[k - 1] == HZ_BC(EN)) || (end < n && t[end] == HZ_BC(EN)) ? HZ_BC(EN) : HZ_BC(ON);
+        for (; k < end; ++k) t[k] = to;
+    }
+
+    // W7
+    last_strong = s->sos;
+    for (size_t k = 0; k < n; ++k) {
+        if (t[k] == HZ_BC(L) || t[k] == HZ_BC(R)) last_strong = t[k];
+        else if (t[k] == HZ_BC(EN) && last_strong == HZ_BC(L)) t[k] = HZ_BC(L);
+    }
+}
+
+// N0, bracket pairs are found with the BD16 stack and resolved in order of their opening
+// brackets. The strong class before each opening bracket is tracked with a cursor that only
+// moves forward, as brackets resolved earlier all lie before it or after the current one.
+HZ_STATIC void hz_bidi_resolve_brackets(hz_bidi_sequence_t *s, uint8_t e)
+{
+    uint8_t *t = s->t;
+    size_t n = s->count;
+    struct { hz_unicode_t close; uint32_t pos; } stack[HZ_BIDI_MAX_BRACKET_DEPTH];
+    size_t sp = 0;
+    hz_bool any = HZ_FALSE;
+
+    for (size_t k = 0; k < n; ++k) s->pair_close[k] = HZ_BIDI_NONE;
+    for (size_t k = 0; k < n; ++k) {
+        hz_unicode_t c = s->chars[s->seq[k]], pair;
+        int type;
+        if (t[k] != HZ_BC(ON) || !(type = hz_bidi_bracket(c, &pair))) continue;
+
+        if (type == 1) {
+            if (sp == HZ_BIDI_MAX_BRACKET_DEPTH) break;
+            stack[sp].close = hz_bidi_canonical_bracket(pair);
+            stack[sp].pos = (uint32_t)k;
+            ++sp;
+        } else {
+            c = hz_bidi_canonical_bracket(c);
+            for (size_t j = sp; j-- > 0;) {
+                if (stack[j].close == c) {
+                    s->pair_close[stack[j].pos] = (uint32_t)k;
+                    any = HZ_TRUE;
+                    sp = j;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (!any) return;
+
+    uint8_t o = e == HZ_BC(L) ? HZ_BC(R) : HZ_BC(L);
+    uint8_t before = s->sos;
+    size_t cursor = 0;
+    for (size_t k = 0; k < n; ++k) {
+        size_t close = s->pair_close[k];
+        if (close == HZ_BIDI_NONE) continue;
+
+        for (; cursor < k; ++cursor) {
+            uint8_t st = hz_bidi_strong(t[cursor]);
+            if (st != HZ_BC(ON)) before = st;
+        }
+
+        hz_bool has_e = HZ_FALSE, has_o = HZ_FALSE;
+        for (size_t q = k + 1; q < close && !has_e; ++q) {
+            uint8_t st = hz_bidi_strong(t[q]);
+            has_e |= st == e;
+            has_o |= st == o;
+        }
+
+        uint8_t to;
+        if (has_e) to = e;
+        else if (has_o) to = before == o ? o : e;
+        else continue;
+
+        // brackets and the NSMs following them, which W1 made ON
+        t[k] = t[close] = to;
+        for (size_t q = k + 1; q < n && s->cls[s->seq[q]] == HZ_BC(NSM); ++q) t[q] = to;
+        for (size_t q = close + 1; q < n && s->cls[s->seq[q]] == HZ_BC(NSM); ++q) t[q] = to;
+    }
+}
+
+// N0-N2, I1-I2 on an isolating run sequence, the levels of its characters are set.
+HZ_STATIC void hz_bidi_resolve_sequence(hz_bidi_sequence_t *s)
+{
+    uint8_t *t = s->t;
+    size_t n = s->count;
+    uint8_t level = s->embedding[s->seq[0]];
+    uint8_t e = (level & 1) ? HZ_BC(R) : HZ_BC(L);
+
+    hz_bidi_resolve_weak(s);
+    hz_bidi_resolve_brackets(s, e);
+
+    // N1, N2
+    for (size_t k = 0; k < n;) {
+        if (!hz_bidi_is(t[k], HZ_BIDI_NEUTRAL_MASK)) { ++k; continue; }
+
+        size_t end = k;
+        while (end < n && hz_bidi_is(t[end], HZ_BIDI_NEUTRAL_MASK)) ++end;
+        uint8_t before = k ? hz_bidi_strong(t[k - 1]) : s->sos;
+        uint8_t after = end < n ? hz_bidi_strong(t[end]) : s->eos;
+        uint8_t to = before == after ? before : e;
+        for (; k < end; ++k) t[k] = to;
+    }
+
+    // I1, I2
+    for (size_t k = 0; k < n; ++k) {
+        uint8_t l = level;
+        if (!(level & 1)) l += t[k] == HZ_BC(R) ? 1 : (t[k] == HZ_BC(AN) || t[k] == HZ_BC(EN)) ? 2 : 0;
+        else l += t[k] != HZ_BC(R);
+        s->levels[s->seq[k]] = l;
+    }
+}
+
+HZ_STATIC hz_bool hz_bidi_single_run(hz_memory_arena_t *scratch, size_t count, hz_bidi_paragraph_t *para)
+{
+    para->levels = hz_memory_arena_alloc(scratch, count + 1);
+    para->runs = hz_memory_arena_alloc(scratch, sizeof(hz_bidi_run_t));
+    if (!para->levels || !para->runs) return HZ_FALSE;
+
+    HZ_MEMSET(para->levels, para->base_level, count);
+    para->runs[0] = (hz_bidi_run_t){0, count, para->base_level};
+    para->run_count = count ? 1 : 0;
+    para->max_level = para->base_level;
+    return HZ_TRUE;
+}
+
+hz_bool hz_bidi_resolve_paragraph(const hz_ucd_t *ucd, hz_memory_arena_t *scratch, const hz_unicode_t *chars,
+                                  size_t count, hz_direction_t dir, hz_bidi_paragraph_t *para)
+{
+    HZ_ASSERT(count < HZ_BIDI_NONE);
+    hz_zero_struct(*para);
+    para->char_count = count;
+    para->base_level = dir == HZ_DIRECTION_RTL;
+
+    // no character below the Hebrew block is right to left, a number or a formatting character
+    size_t i = 0;
+    if (dir != HZ_DIRECTION_RTL) {
+        while (i < count && chars[i] < 0x590) ++i;
+        if (i == count) return hz_bidi_single_run(scratch, count, para);
+    }
+
+    uint8_t *cls = hz_memory_arena_alloc(scratch, count + 1);
+    if (!cls) return HZ_FALSE;
+    uint32_t mask = 0;
+    for (i = 0; i < count; ++i) {
+        cls[i] = (uint8_t)hz_ucd_bidi_class(ucd, chars[i]);
+        mask |= HZ_FLAG(cls[i]);
+    }
+
+    if (dir != HZ_DIRECTION_RTL && !(mask & HZ_BIDI_RTL_MASK))
+        return hz_bidi_single_run(scratch, count, para);
+
+    // BD9, the isolate stack is kept in match entries of the initiators being matched
+    uint32_t *match = NULL;
+    if (mask & HZ_BIDI_ISOLATE_MASK) {
+        match = hz_memory_arena_alloc(scratch, count * sizeof(uint32_t));
+        if (!match) return HZ_FALSE;
+
+        size_t depth = 0;
+        uint32_t open = HZ_BIDI_NONE;
+        for (i = 0; i < count; ++i) {
+            match[i] = HZ_BIDI_NONE;
+            if (hz_bidi_is_isolate_initiator(cls[i])) {
+                match[i] = open; // link to the enclosing open initiator until matched
+                open = (uint32_t)i;
+                ++depth;
+            } else if (cls[i] == HZ_BC(PDI) && depth) {
+                uint32_t initiator = open;
+                open = match[initiator];
+                match[initiator] = (uint32_t)i;
+                match[i] = initiator;
+                --depth;
+            } else if (cls[i] == HZ_BC(B)) {
+                while (depth--) {
+                    uint32_t initiator = open;
+                    open = match[initiator];
+                    match[initiator] = HZ_BIDI_NONE;
+                }
+                depth = 0;
+            }
+        }
+        while (depth--) {
+            uint32_t initiator = open;
+            open = match[initiator];
+            match[initiator] = HZ_BIDI_NONE;
+        }
+    }
+
+    if (dir != HZ_DIRECTION_LTR && dir != HZ_DIRECTION_RTL) {
+        uint8_t first = hz_bidi_first_strong(cls, match, 0, count);
+        para->base_level = first == HZ_BC(R) || first == HZ_BC(AL);
+    }
+
+    uint8_t *embedding = hz_memory_arena_alloc(scratch, count + 1);
+    para->levels = hz_memory_arena_alloc(scratch, count + 1);
+    if (!embedding || !para->levels) return HZ_FALSE;
+    hz_bidi_resolve_explicit(para, cls, match, embedding);
+
+    // X9, X10. Level runs are ranges of idx, the characters left after removing X9 ones
+    uint32_t *idx = hz_memory_arena_alloc(scratch, count * sizeof(uint32_t));
+    uint32_t *run_first = hz_memory_arena_alloc(scratch, count * sizeof(uint32_t));
+    uint32_t *run_last = hz_memory_arena_alloc(scratch, count * sizeof(uint32_t));
+    uint32_t *seq = hz_memory_arena_alloc(scratch, count * sizeof(uint32_t));
+    uint32_t *pair_close = hz_memory_arena_alloc(scratch, count * sizeof(uint32_t));
+    uint8_t *t = hz_memory_arena_alloc(scratch, count + 1);
+    uint32_t *run_of = match ? hz_memory_arena_alloc(scratch, count * sizeof(uint32_t)) : NULL;
+    if (!idx || !run_first || !run_last || !seq || !pair_close || !t || (match && !run_of)) return HZ_FALSE;
+
+    size_t m = 0, level_run_count = 0;
+    for (i = 0; i < count; ++i) {
+        if (hz_bidi_is(cls[i], HZ_BIDI_REMOVED_MASK)) continue;
+        if (!m || embedding[i] != embedding[idx[m - 1]]) {
+            if (level_run_count) run_last[level_run_count - 1] = (uint32_t)(m - 1);
+            if (run_of) run_of[i] = (uint32_t)level_run_count;
+            run_first[level_run_count++] = (uint32_t)m;
+        }
+        idx[m++] = (uint32_t)i;
+    }
+    if (level_run_count) run_last[level_run_count - 1] = (uint32_t)(m - 1);
+
+    hz_bidi_sequence_t s = {
+        .chars = chars, .cls = cls, .embedding = embedding, .levels = para->levels,
+        .seq = seq, .t = t, .pair_close = pair_close, .count = 0, // count, sos and eos are set per sequence
+    };
+    for (size_t r = 0; r < level_run_count; ++r) {
+        uint32_t first = idx[run_first[r]];
+        if (cls[first] == HZ_BC(PDI) && (match[first] & HZ_BIDI_INDEX_MASK) != HZ_BIDI_NONE)
+            continue; // continues the sequence of its initiator
+
+        size_t n = 0, last_pos, rr = r;
+        for (;;) {
+            for (size_t p = run_first[rr]; p <= run_last[rr]; ++p) {
+                uint32_t j = idx[p];
+                uint8_t c = cls[j];
+                if (match && hz_bidi_is(c, HZ_BIDI_ISOLATE_MASK) && (match[j] & ~HZ_BIDI_INDEX_MASK))
+                    c = (match[j] & HZ_BIDI_OVERRIDE_L) ? HZ_BC(L) : HZ_BC(R);
+                seq[n] = j;
+                t[n++] = c;
+            }
+
+            last_pos = run_last[rr];
+            uint32_t last = idx[last_pos];
+            if (!hz_bidi_is_isolate_initiator(cls[last])) break;
+            uint32_t pdi = match[last] & HZ_BIDI_INDEX_MASK;
+            if (pdi == HZ_BIDI_NONE) break;
+            rr = run_of[pdi];
+        }
+
+        uint8_t level = embedding[first];
+        uint8_t prev = run_first[r] ? embedding[idx[run_first[r] - 1]] : para->base_level;
+        uint8_t next = para->base_level;
+        if (!hz_bidi_is_isolate_initiator(cls[seq[n - 1]]) && last_pos + 1 < m)
+            next = embedding[idx[last_pos + 1]];
+
+        s.count = n;
+        s.sos = (HZ_MAX(level, prev) & 1) ? HZ_BC(R) : HZ_BC(L);
+        s.eos = (HZ_MAX(level, next) & 1) ? HZ_BC(R) : HZ_BC(L);
+        hz_bidi_resolve_sequence(&s);
+    }
+
+    // removed characters take the level of the previous one, L1 with the original classes
+    for (i = 0; i < count; ++i) {
+        if (hz_bidi_is(cls[i], HZ_BIDI_REMOVED_MASK))
+            para->levels[i] = i ? para->levels[i - 1] : para->base_level;
+    }
+
+    hz_bool trailing = HZ_TRUE;
+    for (i = count; i-- > 0;) {
+        uint8_t c = (uint8_t)hz_ucd_bidi_class(ucd, chars[i]);
+        if (c == HZ_BC(S) || c == HZ_BC(B)) {
+            para->levels[i] = para->base_level;
+            trailing = HZ_TRUE;
+        } else if (trailing && hz_bidi_is(c, HZ_BIDI_WHITESPACE_MASK)) {
+            para->levels[i] = para->base_level;
+        } else {
+            trailing = HZ_FALSE;
+        }
+    }
+
+    // level runs of the whole paragraph, the memory of the scratch arrays is reused
+    para->runs = hz_memory_arena_alloc(scratch, count * sizeof(hz_bidi_run_t));
+    if (!para->runs) return HZ_FALSE;
+    para->max_level = para->base_level;
+    for (i = 0; i < count; ++i) {
+        uint8_t l = para->levels[i];
+        para->max_level = HZ_MAX(para->max_level, l);
+        if (!i || l != para->levels[i - 1])
+            para->runs[para->run_count++] = (hz_bidi_run_t){i, 0, l};
+        ++para->runs[para->run_count - 1].count;
+    }
+
+    return HZ_TRUE;
+}
+
+void hz_bidi_reorder(const uint8_t *levels, size_t count, uint32_t *order)
+{
+    uint8_t max_level = 0, min_odd = 0xff;
+    for (size_t i = 0; i < count; ++i) {
+        order[i] = (uint32_t)i;
+        max_level = HZ_MAX(max_level, levels[i]);
+        if (levels[i] & 1) min_odd = HZ_MIN(min_odd, levels[i]);
+    }
+
+    // from the highest level down to the lowest odd one, reverse every sequence at that level or higher
+    for (int level = max_level; level >= min_odd; --level) {
+        for (size_t i = 0; i < count;) {
+            if (levels[order[i]] < level) { ++i; continue; }
+
+            size_t end = i;
+            while (end < count && levels[order[end]] >= level) ++end;
+            for (size_t a = i, b = end - 1; a < b; ++a, --b) {
+                uint32_t tmp = order[a];
+                order[a] = order[b];
+                order[b] = tmp;
+            }
+            i = end;
+        }
+    }
+}
+
+#undef HZ_BC
+#undef HZ_BCM
+
+// Raw script table entry of c, a script or HZ_UCD_SCRIPT_EXTENSIONS_BASE plus its extension set.
+HZ_STATIC HZ_INLINE uint32_t hz_ucd_script_value(const hz_ucd_t *ucd, hz_unicode_t c)
+{
+    return hz_ucd_record(ucd, c)->script_value;
+}
+
+// Extension set of a table entry, the script followed by the number of extensions and the extensions.
+HZ_STATIC HZ_INLINE const uint8_t *hz_ucd_script_extension_set(uint32_t value)
+{
+    return hz_ucd_script_extension_data + hz_ucd_script_extension_offsets[value - HZ_UCD_SCRIPT_EXTENSIONS_BASE];
+}
+
+hz_script_t hz_ucd_script(const hz_ucd_t *ucd, hz_unicode_t c)
+{
+    return (hz_script_t)hz_ucd_record(ucd, c)->script;
+}
+
+size_t hz_ucd_script_extensions(const hz_ucd_t *ucd, hz_unicode_t c, hz_script_t *scripts, size_t max)
+{
+    uint32_t value = hz_ucd_script_value(ucd, c);
+    if (value < HZ_UCD_SCRIPT_EXTENSIONS_BASE) {
+        if (max) scripts[0] = (hz_script_t)value;
+        return 1;
+    }
+
+    const uint8_t *set = hz_ucd_script_extension_set(value);
+    for (size_t k = 0; k < set[1] && k < max; ++k) scripts[k] = (hz_script_t)set[2 + k];
+    return set[1];
+}
+
+HZ_STATIC hz_bool hz_ucd_script_value_has(uint32_t value, hz_script_t script)
+{
+    if (value < HZ_UCD_SCRIPT_EXTENSIONS_BASE) return value == script;
+
+    const uint8_t *set = hz_ucd_script_extension_set(value);
+    for (size_t k = 0; k < set[1]; ++k)
+        if (set[2 + k] == script) return HZ_TRUE;
+    return HZ_FALSE;
+}
+
+// ASCII characters other than brackets, none of which can end a Latin run.
+HZ_STATIC HZ_INLINE hz_bool hz_script_is_plain_ascii(hz_unicode_t c)
+{
+    return c < 0x80 && (c | 0x01) != 0x29 && (c | 0x20) != 0x7b && (c | 0x20) != 0x7d;
+}
+
+#define HZ_SCRIPT_BRACKET_DEPTH 32
+
+typedef struct {
+    hz_unicode_t pair; // closing bracket, canonical
+    hz_script_t script; // script of the run the opening bracket was in
+} hz_script_bracket_t;
+
+size_t hz_itemize_scripts(const hz_ucd_t *ucd, const hz_unicode_t *chars, size_t count, hz_script_run_t *runs)
+{
+    hz_script_bracket_t stack[HZ_SCRIPT_BRACKET_DEPTH];
+    size_t depth = 0, run_count = 0, start = 0, i = 0;
+    hz_script_t script = HZ_SCRIPT_COMMON; // stays Common until a character decides the first run
+
+    while (i < count) {
+        if (script == HZ_SCRIPT_LATIN) {
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+            const __m256i high = _mm256_set1_epi32(~0x7f);
+            const __m256i parens = _mm256_set1_epi32(0x29), braces_open = _mm256_set1_epi32(0x7b),
+                braces_close = _mm256_set1_epi32(0x7d);
+            for (; i + 8 <= count; i += 8) {
+                __m256i c = _mm256_loadu_si256((const __m256i *)(chars + i));
+                __m256i folded = _mm256_or_si256(c, _mm256_set1_epi32(0x20));
+                __m256i brackets = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_or_si256(c, _mm256_set1_epi32(1)), parens),
+                                                   _mm256_or_si256(_mm256_cmpeq_epi32(folded, braces_open),
+                                                                   _mm256_cmpeq_epi32(folded, braces_close)));
+                if (!_mm256_testz_si256(c, high) || !_mm256_testz_si256(brackets, brackets)) break;
+            }
+#endif
+            while (i < count && hz_script_is_plain_ascii(chars[i])) ++i;
+            if (i == count) break;
+        }
+
+        hz_unicode_t c = chars[i];
+        uint32_t value = hz_ucd_script_value(ucd, c);
+        hz_script_t sc = value < HZ_UCD_SCRIPT_EXTENSIONS_BASE ? (hz_script_t)value
+                       : (hz_script_t)hz_ucd_script_extension_set(value)[0];
+        hz_script_t next = script;
+
+        if (sc == HZ_SCRIPT_COMMON || sc == HZ_SCRIPT_INHERITED) {
+            // marks stay with their base and other common characters with the text before them, except closing
+            // brackets which go back to the script of their opening bracket
+            hz_unicode_t pair;
+            int type = sc == HZ_SCRIPT_COMMON ? hz_bidi_bracket(c, &pair) : 0;
+            if (type == 1) {
+                if (depth < HZ_SCRIPT_BRACKET_DEPTH)
+                    stack[depth++] = (hz_script_bracket_t){hz_bidi_canonical_bracket(pair), script};
+            } else if (type == 2) {
+                hz_unicode_t closing = hz_bidi_canonical_bracket(c);
+                size_t k = depth;
+                while (k && stack[k - 1].pair != closing) --k;
+                if (k) {
+                    depth = k - 1;
+                    next = stack[depth].script;
+                }
+            }
+        } else if (!hz_ucd_script_value_has(value, script)) {
+            next = sc;
+        }
+
+        if (next != script) {
+            if (script == HZ_SCRIPT_COMMON) {
+                // leading common characters join the first script
+                for (size_t k = 0; k < depth; ++k) stack[k].script = next;
+            } else {
+                runs[run_count++] = (hz_script_run_t){start, i - start, script};
+                start = i;
+            }
+            script = next;
+        }
+
+        ++i;
+    }
+
+    if (count) runs[run_count++] = (hz_script_run_t){start, count - start, script};
+    return run_count;
+}
+
+hz_line_break_class_t hz_ucd_line_break_class(const hz_ucd_t *ucd, hz_unicode_t c)
+{
+    return (hz_line_break_class_t)hz_ucd_record(ucd, c)->line_break;
+}
+
+#define HZ_LB(_C) HZ_LINE_BREAK_CLASS_##_C
+
+// LB1, classes without a defined behaviour are resolved to the ones they act as. Without dictionary
+// based segmentation, SA characters act as combining marks when they are Mn or Mc and as AL otherwise.
+HZ_STATIC hz_line_break_class_t hz_line_break_resolve_class(const hz_ucd_t *ucd, hz_unicode_t c)
+{
+    hz_line_break_class_t cls = hz_ucd_line_break_class(ucd, c);
+    switch (cls) {
+        case HZ_LB(AI): case HZ_LB(SG): case HZ_LB(XX): return HZ_LB(AL);
+        case HZ_LB(SA): {
+            hz_general_category_t gc = hz_ucd_general_category(ucd, c);
+            return gc == HZ_GENERAL_CATEGORY_MN || gc == HZ_GENERAL_CATEGORY_MC ? HZ_LB(CM) : HZ_LB(AL);
+        }
+        case HZ_LB(CJ): return HZ_LB(NS);
+        default: return cls;
+    }
+}
+
+// OP characters with an East Asian width of F, W or H in EastAsianWidth.txt 15.0, there are no such CP
+// characters.
+static const uint16_t hz_line_break_east_asian_op[] = {
+    0x2329, 0x3008, 0x300A, 0x300C, 0x300E, 0x3010, 0x3014, 0x3016, 0x3018, 0x301A,
+    0x301D, 0xFE17, 0xFE35, 0xFE37, 0xFE39, 0xFE3B, 0xFE3D, 0xFE3F, 0xFE41, 0xFE43,
+    0xFE47, 0xFE59, 0xFE5B, 0xFE5D, 0xFF08, 0xFF3B, 0xFF5B, 0xFF5F, 0xFF62,
+};
+
+// Opening and closing punctuation with an East Asian width of F, W or H, excluded from LB30.
+HZ_STATIC hz_bool hz_line_break_is_east_asian(hz_unicode_t c)
+{
+    size_t lo = 0, hi = HZ_ARRAY_SIZE(hz_line_break_east_asian_op);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (hz_line_break_east_asian_op[mid] < c) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo < HZ_ARRAY_SIZE(hz_line_break_east_asian_op) && hz_line_break_east_asian_op[lo] == c;
+}
+
+typedef struct {
+    hz_line_break_class_t raw; // class of the previous character, before LB9 and LB10
+    hz_line_break_class_t prev; // class of the previous character, combining marks attached
+    hz_line_break_class_t prev2; // class of the character before prev
+    hz_line_break_class_t sp_base; // class before the run of spaces ending at prev
+    hz_unicode_t prev_char;
+    size_t ri_run; // regional indicators ending at prev
+} hz_line_break_state_t;
+
+// Pair rules LB11 to LB31 between the previous class a and the current class b.
+HZ_STATIC hz_line_break_t hz_line_break_pair(const hz_line_break_state_t *st, hz_line_break_class_t b, hz_unicode_t c)
+{
+    hz_line_break_class_t a = st->prev;
+    hz_line_break_class_t sp = a == HZ_LB(SP) ? st->sp_base : HZ_LB(XX);
+
+    if (a == HZ_LB(WJ) || b == HZ_LB(WJ)) return HZ_LINE_BREAK_NONE; // LB11
+    if (a == HZ_LB(GL)) return HZ_LINE_BREAK_NONE; // LB12
+    if (b == HZ_LB(GL) && a != HZ_LB(SP) && a != HZ_LB(BA) && a != HZ_LB(HY)) return HZ_LINE_BREAK_NONE; // LB12a
+    if (b == HZ_LB(CL) || b == HZ_LB(CP) || b == HZ_LB(EX) || b == HZ_LB(IS) || b == HZ_LB(SY))
+        return HZ_LINE_BREAK_NONE; // LB13
+    if (a == HZ_LB(OP) || sp == HZ_LB(OP)) return HZ_LINE_BREAK_NONE; // LB14
+    if (b == HZ_LB(OP) && (a == HZ_LB(QU) || sp == HZ_LB(QU))) return HZ_LINE_BREAK_NONE; // LB15
+    if (b == HZ_LB(NS) && (a == HZ_LB(CL) || a == HZ_LB(CP) || sp == HZ_LB(CL) || sp == HZ_LB(CP)))
+        return HZ_LINE_BREAK_NONE; // LB16
+    if (b == HZ_LB(B2) && (a == HZ_LB(B2) || sp == HZ_LB(B2))) return HZ_LINE_BREAK_NONE; // LB17
+    if (a == HZ_LB(SP)) return HZ_LINE_BREAK_ALLOWED; // LB18
+    if (a == HZ_LB(QU) || b == HZ_LB(QU)) return HZ_LINE_BREAK_NONE; // LB19
+    if (a == HZ_LB(CB) || b == HZ_LB(CB)) return HZ_LINE_BREAK_ALLOWED; // LB20
+    if (b == HZ_LB(BA) || b == HZ_LB(HY) || b == HZ_LB(NS) || a == HZ_LB(BB)) return HZ_LINE_BREAK_NONE; // LB21
+    if ((a == HZ_LB(HY) || a == HZ_LB(BA)) && st->prev2 == HZ_LB(HL)) return HZ_LINE_BREAK_NONE; // LB21a
+    if (a == HZ_LB(SY) && b == HZ_LB(HL)) return HZ_LINE_BREAK_NONE; // LB21b
+    if (b == HZ_LB(IN)) return HZ_LINE_BREAK_NONE; // LB22
+
+    hz_bool a_alpha = a == HZ_LB(AL) || a == HZ_LB(HL);
+    hz_bool b_alpha = b == HZ_LB(AL) || b == HZ_LB(HL);
+    hz_bool a_ideo = a == HZ_LB(ID) || a == HZ_LB(EB) || a == HZ_LB(EM);
+    hz_bool b_ideo = b == HZ_LB(ID) || b == HZ_LB(EB) || b == HZ_LB(EM);
+    hz_bool a_hangul = a == HZ_LB(JL) || a == HZ_LB(JV) || a == HZ_LB(JT) || a == HZ_LB(H2) || a == HZ_LB(H3);
+    hz_bool b_hangul = b == HZ_LB(JL) || b == HZ_LB(JV) || b == HZ_LB(JT) || b == HZ_LB(H2) || b == HZ_LB(H3);
+    hz_bool a_affix = a == HZ_LB(PR) || a == HZ_LB(PO);
+    hz_bool b_affix = b == HZ_LB(PR) || b == HZ_LB(PO);
+
+    if ((a_alpha && b == HZ_LB(NU)) || (a == HZ_LB(NU) && b_alpha)) return HZ_LINE_BREAK_NONE; // LB23
+    if ((a == HZ_LB(PR) && b_ideo) || (a_ideo && b == HZ_LB(PO))) return HZ_LINE_BREAK_NONE; // LB23a
+    if ((a_affix && b_alpha) || (a_alpha && b_affix)) return HZ_LINE_BREAK_NONE; // LB24
+    if ((b_affix && (a == HZ_LB(CL) || a == HZ_LB(CP) || a == HZ_LB(NU)))
+        || (a_affix && (b == HZ_LB(OP) || b == HZ_LB(NU)))
+        || (b == HZ_LB(NU) && (a == HZ_LB(HY) || a == HZ_LB(IS) || a == HZ_LB(NU) || a == HZ_LB(SY))))
+        return HZ_LINE_BREAK_NONE; // LB25
+    if ((a == HZ_LB(JL) && (b == HZ_LB(JL) || b == HZ_LB(JV) || b == HZ_LB(H2) || b == HZ_LB(H3)))
+        || ((a == HZ_LB(JV) || a == HZ_LB(H2)) && (b == HZ_LB(JV) || b == HZ_LB(JT)))
+        || ((a == HZ_LB(JT) || a == HZ_LB(H3)) && b == HZ_LB(JT)))
+        return HZ_LINE_BREAK_NONE; // LB26
+    if ((a_hangul && b == HZ_LB(PO)) || (a == HZ_LB(PR) && b_hangul)) return HZ_LINE_BREAK_NONE; // LB27
+    if (a_alpha && b_alpha) return HZ_LINE_BREAK_NONE; // LB28
+    if (a == HZ_LB(IS) && b_alpha) return HZ_LINE_BREAK_NONE; // LB29
+    if (((a_alpha || a == HZ_LB(NU)) && b == HZ_LB(OP) && !hz_line_break_is_east_asian(c))
+        || (a == HZ_LB(CP) && !hz_line_break_is_east_asian(st->prev_char) && (b_alpha || b == HZ_LB(NU))))
+        return HZ_LINE_BREAK_NONE; // LB30
+    if (a == HZ_LB(RI) && b == HZ_LB(RI) && (st->ri_run & 1)) return HZ_LINE_BREAK_NONE; // LB30a
+    if (a == HZ_LB(EB) && b == HZ_LB(EM)) return HZ_LINE_BREAK_NONE; // LB30b
+    return HZ_LINE_BREAK_ALLOWED; // LB31
+}
+
+void hz_find_line_breaks(const hz_ucd_t *ucd, const hz_unicode_t *codepoints, size_t count, uint8_t *breaks)
+{
+    hz_line_break_state_t st = {HZ_LB(XX), HZ_LB(XX), HZ_LB(XX), HZ_LB(XX), 0, 0};
+
+    for (size_t i = 0; i < count; ++i) {
+        hz_line_break_class_t raw = hz_line_break_resolve_class(ucd, codepoints[i]);
+        hz_line_break_class_t b = raw;
+        hz_line_break_t action;
+
+        if (i == 0) {
+            action = HZ_LINE_BREAK_NONE; // LB2
+        } else if (st.raw == HZ_LB(BK)) {
+            action = HZ_LINE_BREAK_MANDATORY; // LB4
+        } else if (st.raw == HZ_LB(CR) && b == HZ_LB(LF)) {
+            action = HZ_LINE_BREAK_NONE; // LB5
+        } else if (st.raw == HZ_LB(CR) || st.raw == HZ_LB(LF) || st.raw == HZ_LB(NL)) {
+            action = HZ_LINE_BREAK_MANDATORY; // LB5
+        } else if (b == HZ_LB(BK) || b == HZ_LB(CR) || b == HZ_LB(LF) || b == HZ_LB(NL)) {
+            action = HZ_LINE_BREAK_NONE; // LB6
+        } else if (b == HZ_LB(SP) || b == HZ_LB(ZW)) {
+            action = HZ_LINE_BREAK_NONE; // LB7
+        } else if (st.prev == HZ_LB(ZW) || (st.prev == HZ_LB(SP) && st.sp_base == HZ_LB(ZW))) {
+            action = HZ_LINE_BREAK_ALLOWED; // LB8
+        } else if (b == HZ_LB(CM) || b == HZ_LB(ZWJ)) {
+            if (st.prev != HZ_LB(SP)) {
+                // LB9, the mark takes the class of its base
+                breaks[i] = HZ_LINE_BREAK_NONE;
+                st.raw = raw;
+                continue;
+            }
+
+            b = HZ_LB(AL); // LB10
+            action = st.raw == HZ_LB(ZWJ) ? HZ_LINE_BREAK_NONE : hz_line_break_pair(&st, b, codepoints[i]);
+        } else if (st.raw == HZ_LB(ZWJ)) {
+            action = HZ_LINE_BREAK_NONE; // LB8a
+        } else {
+            action = hz_line_break_pair(&st, b, codepoints[i]);
+        }
+
+        breaks[i] = (uint8_t)action;
+        if (b == HZ_LB(CM) || b == HZ_LB(ZWJ)) b = HZ_LB(AL); // LB10
+
+        if (b == HZ_LB(SP) && st.prev != HZ_LB(SP))
+            st.sp_base = i ? st.prev : HZ_LB(XX);
+        st.ri_run = b == HZ_LB(RI) ? st.ri_run + 1 : 0;
+        st.prev2 = st.prev;
+        st.prev = b;
+        st.prev_char = codepoints[i];
+        st.raw = raw;
+    }
+}
+
+HZ_STATIC hz_bool hz_line_break_is_trailing(const hz_ucd_t *ucd, hz_unicode_t c)
+{
+    hz_line_break_class_t cls = hz_ucd_line_break_class(ucd, c);
+    return cls == HZ_LB(SP) || cls == HZ_LB(BK) || cls == HZ_LB(CR) || cls == HZ_LB(LF) || cls == HZ_LB(NL);
+}
+
+#undef HZ_LB
+
+void hz_line_layout_init(hz_line_layout_t *layout, hz_direction_t dir, hz_layout_flags_t flags,
+                         float sx, float sy, float max_length)
+{
+    hz_zero_struct(*layout);
+    layout->dir = dir;
+    layout->flags = flags;
+    layout->sx = sx;
+    layout->sy = sy;
+    layout->max_length = max_length;
+}
+
+void hz_line_layout_release(hz_line_layout_t *layout)
+{
+    hz_vector_destroy(layout->segments);
+    hz_vector_destroy(layout->lines);
+    hz_vector_destroy(layout->chars);
+    hz_vector_destroy(layout->pos);
+    hz_vector_destroy(layout->breaks);
+    hz_vector_destroy(layout->item_offsets);
+    hz_vector_destroy(layout->pieces);
+    hz_vector_destroy(layout->piece_levels);
+    hz_vector_destroy(layout->piece_order);
+    hz_vector_destroy(layout->ordered_pieces);
+}
+
+#define HZ_VECTOR_RESET(_V) do { if (_V) hz_vector_header(_V)->size = 0; } while (0)
+
+HZ_STATIC void hz_line_layout_add_line(hz_line_layout_t *layout, size_t start, size_t end)
+{
+    size_t content_end = end;
+    while (content_end > start && hz_line_break_is_trailing(layout->ucd, layout->chars[content_end - 1]))
+        --content_end;
+
+    hz_line_t line = {
+        .first_char = start,
+        .char_count = end - start,
+        .width = layout->pos[content_end] - layout->pos[start]
+    };
+    hz_vector_push_back(layout->lines, line);
+}
+
+// Visual glyph index of logical character i of an item starting at offset with n glyphs.
+HZ_STATIC size_t hz_layout_item_glyph(const hz_layout_item_t *item, size_t offset, size_t n, size_t i)
+{
+    return item->dir == HZ_DIRECTION_RTL ? n - 1 - (i - offset) : i - offset;
+}
+
+// Puts the pieces of a line in visual order by rule L2, pieces are item indices with their
+// logical ranges in the line. Without HZ_LAYOUT_BIDI items going against the layout direction
+// are one level above it.
+HZ_STATIC void hz_line_layout_reorder_pieces(hz_line_layout_t *layout, const hz_layout_item_t *items,
+                                             size_t *pieces, size_t piece_count)
+{
+    HZ_VECTOR_RESET(layout->piece_levels);
+    HZ_VECTOR_RESET(layout->piece_order);
+    HZ_VECTOR_RESET(layout->ordered_pieces);
+    hz_vector_extend(layout->piece_levels, piece_count);
+    hz_vector_extend(layout->piece_order, piece_count);
+    hz_vector_extend(layout->ordered_pieces, piece_count * 3);
+
+    hz_bool rtl = layout->dir == HZ_DIRECTION_RTL;
+    for (size_t i = 0; i < piece_count; ++i) {
+        const hz_layout_item_t *item = &items[pieces[3*i]];
+        if (layout->flags & HZ_LAYOUT_BIDI) layout->piece_levels[i] = item->level;
+        else layout->piece_levels[i] = (uint8_t)rtl + ((item->dir == HZ_DIRECTION_RTL) != rtl);
+    }
+
+    hz_bidi_reorder(layout->piece_levels, piece_count, layout->piece_order);
+    for (size_t i = 0; i < piece_count; ++i)
+        HZ_MEMCPY(&layout->ordered_pieces[3*i], &pieces[3*layout->piece_order[i]], 3 * sizeof(size_t));
+    HZ_MEMCPY(pieces, layout->ordered_pieces, piece_count * 3 * sizeof(size_t));
+}
+
+void hz_line_layout_build(hz_context_t *ctx, hz_line_layout_t *layout,
+                          const hz_layout_item_t *items, size_t item_count)
+{
+    HZ_VECTOR_RESET(layout->segments);
+    HZ_VECTOR_RESET(layout->lines);
+    HZ_VECTOR_RESET(layout->chars);
+    HZ_VECTOR_RESET(layout->pos);
+    HZ_VECTOR_RESET(layout->breaks);
+    HZ_VECTOR_RESET(layout->item_offsets);
+
+    // flatten the items in logical order, pos is the prefix sum of the scaled advances
+    float line_height = 0.0f, pen = 0.0f;
+    size_t total = 0;
+    for (size_t k = 0; k < item_count; ++k) total += items[k].buffer->glyph_count;
+    hz_vector_extend(layout->chars, total);
+    hz_vector_extend(layout->pos, total + 1);
+    hz_vector_extend(layout->breaks, total);
+    hz_vector_extend(layout->item_offsets, item_count + 1);
+
+    size_t n = 0;
+    for (size_t k = 0; k < item_count; ++k) {
+        const hz_buffer_t *b = items[k].buffer;
+        hz_scaled_metrics_t *sm = hz_context_get_scaled_metrics(ctx, items[k].font_id, items[k].px_size);
+        line_height = HZ_MAX(line_height, sm->ascent - sm->descent + sm->line_gap);
+        layout->item_offsets[k] = n;
+
+        for (size_t j = 0; j < b->glyph_count; ++j, ++n) {
+            size_t g = hz_layout_item_glyph(&items[k], n - j, b->glyph_count, n);
+            layout->chars[n] = b->codepoints[g];
+            layout->pos[n] = pen;
+            pen += b->glyph_metrics[g].xAdvance * sm->scale;
+        }
+    }
+    layout->item_offsets[item_count] = n;
+    layout->pos[n] = pen;
+    if (layout->v_advance > 0.0f) line_height = layout->v_advance;
+
+    hz_find_line_breaks(layout->ucd, layout->chars, n, layout->breaks);
+
+    // greedy line filling, the last break opportunity is remembered so every character is
+    // visited once
+    hz_bool wrap = (layout->flags & HZ_LAYOUT_WRAP) && layout->max_length > 0.0f;
+    size_t start = 0, last_break = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (i > start && layout->breaks[i] == HZ_LINE_BREAK_MANDATORY) {
+            hz_line_layout_add_line(layout, start, i);
+            start = i;
+            last_break = 0;
+        } else if (i > start && layout->breaks[i] == HZ_LINE_BREAK_ALLOWED) {
+            last_break = i;
+        }
+
+        // trailing spaces hang past the end of the line
+        if (wrap && last_break > start && !hz_line_break_is_trailing(layout->ucd, layout->chars[i])
+            && layout->pos[i + 1] - layout->pos[start] > layout->max_length) {
+            hz_line_layout_add_line(layout, start, last_break);
+            start = last_break;
+            last_break = 0;
+        }
+    }
+    if (n > start || !n) hz_line_layout_add_line(layout, start, n);
+
+    // position the lines
+    size_t line_count = hz_vector_size(layout->lines);
+    float box = layout->max_length;
+    if (box <= 0.0f) {
+        for (size_t l = 0; l < line_count; ++l) box = HZ_MAX(box, layout->lines[l].width);
+    }
+
+    float y = layout->sy;
+    float block_height = (float)(line_count - 1) * line_height;
+    if (layout->flags & HZ_LAYOUT_ALIGN_BOTTOM) y += block_height;
+    else if (layout->flags & HZ_LAYOUT_Y_CENTER) y += block_height * 0.5f;
+
+    size_t end_item = 0;
+    for (size_t l = 0; l < line_count; ++l, y -= line_height) {
+        hz_line_t *line = &layout->lines[l];
+        size_t start = line->first_char, end = start + line->char_count;
+        size_t content_end = end;
+        while (content_end > start && hz_line_break_is_trailing(layout->ucd, layout->chars[content_end - 1]))
+            --content_end;
+
+        // items are shaped apart, only a break inside one can split its shaping context
+        while (end_item < item_count && layout->item_offsets[end_item + 1] <= end) ++end_item;
+        if (end < n && end > layout->item_offsets[end_item]) {
+            const hz_buffer_t *b = items[end_item].buffer;
+            size_t g = hz_layout_item_glyph(&items[end_item], layout->item_offsets[end_item], b->glyph_count, end);
+            line->unsafe_break = (b->attrib_flags & HZ_GLYPH_ATTRIB_FLAGS_BIT)
+                && (b->glyph_flags[g] & HZ_GLYPH_FLAG_UNSAFE_TO_BREAK);
+        }
+
+        // justified lines stretch their spaces, except the last line of the paragraph and lines
+        // ending with a mandatory break
+        float space_extra = 0.0f;
+        hz_bool last = l + 1 == line_count || layout->breaks[end] == HZ_LINE_BREAK_MANDATORY;
+        if ((layout->flags & HZ_LAYOUT_JUSTIFY) && !last && line->width < box) {
+            size_t spaces = 0;
+            for (size_t i = start; i < content_end; ++i)
+                spaces += hz_ucd_line_break_class(layout->ucd, layout->chars[i]) == HZ_LINE_BREAK_CLASS_SP;
+            if (spaces) space_extra = (box - line->width) / (float)spaces;
+        }
+
+        float x = layout->sx;
+        if (space_extra == 0.0f) {
+            hz_bool right = (layout->flags & HZ_LAYOUT_ALIGN_RIGHT)
+                || (!(layout->flags & (HZ_LAYOUT_ALIGN_LEFT | HZ_LAYOUT_X_CENTER)) && layout->dir == HZ_DIRECTION_RTL);
+            if (layout->flags & HZ_LAYOUT_X_CENTER) x += (box - line->width) * 0.5f;
+            else if (right) x += box - line->width;
+        }
+
+        // split the line into one piece per item, (item, first, end) triplets in logical order
+        HZ_VECTOR_RESET(layout->pieces);
+        size_t k = 0;
+        while (k < item_count && layout->item_offsets[k + 1] <= start) ++k;
+        for (size_t i = start; i < content_end; ++k) {
+            size_t piece_end = HZ_MIN(content_end, layout->item_offsets[k + 1]);
+            if (piece_end > i) {
+                size_t piece[3] = {k, i, piece_end};
+                hz_vector_push_many(layout->pieces, piece, 3);
+            }
+            i = piece_end;
+        }
+
+        size_t piece_count = hz_vector_size(layout->pieces) / 3;
+        hz_line_layout_reorder_pieces(layout, items, layout->pieces, piece_count);
+
+        line->first_segment = hz_vector_size(layout->segments);
+        for (size_t p = 0; p < piece_count; ++p) {
+            size_t item = layout->pieces[3*p], first = layout->pieces[3*p+1], piece_end = layout->pieces[3*p+2];
+            const hz_layout_item_t *it = &items[item];
+            size_t offset = layout->item_offsets[item];
+            size_t glyph_count = it->buffer->glyph_count;
+            size_t g0 = hz_layout_item_glyph(it, offset, glyph_count, it->dir == HZ_DIRECTION_RTL ? piece_end - 1 : first);
+            size_t size = piece_end - first;
+
+            if (space_extra == 0.0f) {
+                hz_segment_command_t seg = {item, g0, size, x, y};
+                hz_vector_push_back(layout->segments, seg);
+                x += layout->pos[piece_end] - layout->pos[first];
+                continue;
+            }
+
+            // a segment per word, each space widened
+            hz_segment_command_t seg = {item, g0, 0, x, y};
+            for (size_t g = g0; g < g0 + size; ++g) {
+                size_t i = it->dir == HZ_DIRECTION_RTL ? offset + glyph_count - 1 - g : offset + g;
+                x += layout->pos[i + 1] - layout->pos[i];
+                ++seg.size;
+                if (hz_ucd_line_break_class(layout->ucd, layout->chars[i]) == HZ_LINE_BREAK_CLASS_SP) {
+                    x += space_extra;
+                    hz_vector_push_back(layout->segments, seg);
+                    seg = (hz_segment_command_t){item, g + 1, 0, x, y};
+                }
+            }
+            if (seg.size) hz_vector_push_back(layout->segments, seg);
+        }
+
+        line->segment_count = hz_vector_size(layout->segments) - line->first_segment;
+        line->y = y;
+    }
+}
+
+#undef HZ_VECTOR_RESET
+
+hz_error_t hz_draw_line_layout(hz_context_t *ctx, const hz_line_layout_t *layout, const hz_layout_item_t *items)
+{
+    hz_error_t error = HZ_OK;
+    for (size_t i = 0; i < hz_vector_size(layout->segments); ++i) {
+        const hz_segment_command_t *seg = &layout->segments[i];
+        const hz_layout_item_t *item = &items[seg->item];
+
+        // view of the segment's glyphs
+        hz_buffer_t view = *item->buffer;
+        view.glyph_count = seg->size;
+        view.glyph_metrics += seg->first_glyph;
+        view.glyph_indices += seg->first_glyph;
+        if (view.codepoints) view.codepoints += seg->first_glyph;
+
+        hz_error_t e = hz_draw_buffer(ctx, &view, item->font_id, (hz_vec3){seg->x, seg->y, 0.0f}, item->style, item->px_size);
+        if (error == HZ_OK) error = e;
+    }
+
+    return error;
+}
+
+hz_command_list_t *hz_get_frame_commands(hz_context_t *ctx) {
+    return &ctx->frame_cmds;
+}
+
+void hz_shape_draw_data_clear(hz_shape_draw_data_t *draw_data)
+{
+    hz_vector_destroy(draw_data->verts);
+    hz_vector_destroy(draw_data->contours);
+}
+
+float hz_glyph_cache_glyph_height(const hz_glyph_cache_opts_t *opts)
+{
+    return (float)opts->height / (float)opts->y_cells;
+}
+
+hz_rect_t hz_glyph_cache_compute_cell_rect(hz_glyph_cache_opts_t *opts, int cell)
+{
+    HZ_ASSERT(cell < opts->x_cells*opts->y_cells);
+    float cw = (float)opts->width / (float)opts->x_cells;
+    float ch = (float)opts->height / (float)opts->y_cells;
+    int icx = cell % opts->x_cells;
+    int icy = cell / opts->x_cells;;
+    return (hz_rect_t){icx * cw, icy * ch, cw, ch};
+}
+
+hz_vec2 hz_vec2_add(hz_vec2 v1, hz_vec2 v2) {
+    return (hz_vec2){v1.x+v2.x, v1.y+v2.y};
+}
+
+hz_vec2 hz_vec2_mult_s(hz_vec2 v1, float scale) {
+    return (hz_vec2){v1.x*scale,v1.y*scale};
+}
+
+///////////////////////// glyf decoder ////////////////////////////
+
+#define HZ_GLYF_ON_CURVE 0x01
+#define HZ_GLYF_X_SHORT 0x02
+#define HZ_GLYF_Y_SHORT 0x04
+#define HZ_GLYF_REPEAT 0x08
+#define HZ_GLYF_X_SAME_OR_POSITIVE 0x10
+#define HZ_GLYF_Y_SAME_OR_POSITIVE 0x20
+
+#define HZ_GLYF_ARG_1_AND_2_ARE_WORDS 0x0001
+#define HZ_GLYF_ARGS_ARE_XY_VALUES 0x0002
+#define HZ_GLYF_WE_HAVE_A_SCALE 0x0008
+#define HZ_GLYF_MORE_COMPONENTS 0x0020
+#define HZ_GLYF_WE_HAVE_AN_X_AND_Y_SCALE 0x0040
+#define HZ_GLYF_WE_HAVE_A_TWO_BY_TWO 0x0080
+#define HZ_GLYF_SCALED_COMPONENT_OFFSET 0x0800
+#define HZ_GLYF_UNSCALED_COMPONENT_OFFSET 0x1000
+
+#define HZ_GLYF_MAX_COMPOSITE_DEPTH 8
+
+HZ_ALWAYS_INLINE uint16_t hz_glyf_u16(const uint8_t *p) { return (uint16_t)(p[0] << 8 | p[1]); }
+
+HZ_STATIC const uint8_t *hz_glyf_locate(hz_face_t *face, hz_index_t glyph, size_t *len)
+{
+    const uint8_t *loca = face->data + face->loca;
+    uint32_t g1, g2;
+
+    if (glyph >= face->num_glyphs) return NULL;
+
+    if (face->index_to_loc_format == 0) {
+        g1 = hz_glyf_u16(loca + glyph*2) * 2u;
+        g2 = hz_glyf_u16(loca + glyph*2 + 2) * 2u;
+    } else {
+        g1 = (uint32_t)hz_glyf_u16(loca + glyph*4) << 16 | hz_glyf_u16(loca + glyph*4 + 2);
+        g2 = (uint32_t)hz_glyf_u16(loca + glyph*4 + 4) << 16 | hz_glyf_u16(loca + glyph*4 + 6);
+    }
+
+    if (g2 <= g1) return NULL; // empty glyph
+    *len = g2 - g1;
+    return face->data + face->glyf + g1;
+}
+
+// In-place inclusive prefix sum, wrapping like the int16 coordinates of the font.
+HZ_STATIC void hz_prefix_sum_i16(int16_t *v, size_t n)
+{
+    size_t i = 0;
+    int16_t carry = 0;
+
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+    const __m256i bcast7 = _mm256_setr_epi8(14,15,14,15,14,15,14,15,14,15,14,15,14,15,14,15,
+                                            14,15,14,15,14,15,14,15,14,15,14,15,14,15,14,15);
+    for (; i + 16 <= n; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(v + i));
+        // scan each 128-bit lane, then add the low lane's total to the high lane
+        x = _mm256_add_epi16(x, _mm256_slli_si256(x, 2));
+        x = _mm256_add_epi16(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi16(x, _mm256_slli_si256(x, 8));
+        __m256i lo = _mm256_permute2x128_si256(x, x, 0x08);
+        x = _mm256_add_epi16(x, _mm256_shuffle_epi8(lo, bcast7));
+        x = _mm256_add_epi16(x, _mm256_set1_epi16(carry));
+        _mm256_storeu_si256((__m256i *)(v + i), x);
+        carry = (int16_t)_mm256_extract_epi16(x, 15);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        carry = (int16_t)(carry + v[i]);
+        v[i] = carry;
+    }
+}
+
+// x' = a*x + c*y + e, y' = b*x + d*y + f, rounded to the nearest unit.
+HZ_STATIC void hz_glyf_transform(int16_t *xs, int16_t *ys, size_t n, const float m[6])
+{
+    size_t i = 0;
+
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+    __m256 a = _mm256_set1_ps(m[0]), b = _mm256_set1_ps(m[1]), c = _mm256_set1_ps(m[2]);
+    __m256 d = _mm256_set1_ps(m[3]), e = _mm256_set1_ps(m[4]), f = _mm256_set1_ps(m[5]);
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(xs + i))));
+        __m256 y = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(ys + i))));
+        __m256i tx = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, x), _mm256_mul_ps(c, y)), e));
+        __m256i ty = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b, x), _mm256_mul_ps(d, y)), f));
+        _mm_storeu_si128((__m128i *)(xs + i), _mm_packs_epi32(_mm256_castsi256_si128(tx), _mm256_extracti128_si256(tx, 1)));
+        _mm_storeu_si128((__m128i *)(ys + i), _mm_packs_epi32(_mm256_castsi256_si128(ty), _mm256_extracti128_si256(ty, 1)));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        float x = xs[i], y = ys[i];
+        long tx = lrintf(m[0]*x + m[2]*y + m[4]), ty = lrintf(m[1]*x + m[3]*y + m[5]);
+        xs[i] = (int16_t)HZ_MAX(HZ_MIN(tx, INT16_MAX), INT16_MIN);
+        ys[i] = (int16_t)HZ_MAX(HZ_MIN(ty, INT16_MAX), INT16_MIN);
+    }
+}
+
+// Reads one delta coded coordinate stream into out, then sums it up.
+HZ_STATIC const uint8_t *hz_glyf_read_coords(const uint8_t *p, const uint8_t *flags, size_t n,
+                                             uint8_t short_bit, uint8_t same_bit, int16_t *out)
+{
+    for (size_t i = 0; i < n; ++i) {
+        uint8_t f = flags[i];
+        int16_t d = 0;
+        if (f & short_bit) {
+            d = *p++;
+            if (!(f & same_bit)) d = -d;
+        } else if (!(f & same_bit)) {
+            d = (int16_t)hz_glyf_u16(p);
+            p += 2;
+        }
+        out[i] = d;
+    }
+
+    hz_prefix_sum_i16(out, n);
+    return p;
+}
+
+HZ_STATIC hz_bool hz_glyf_decode_simple(const uint8_t *g, size_t len, int contour_count, hz_glyf_points_t *pts)
+{
+    const uint8_t *end = g + len;
+    const uint8_t *p = g + 10;
+    if (p + contour_count*2 + 2 > end) return HZ_FALSE;
+
+    size_t first_point = hz_vector_size(pts->x);
+    size_t first_contour = hz_vector_size(pts->end_points);
+    hz_vector_extend(pts->end_points, contour_count);
+    for (int i = 0; i < contour_count; ++i) {
+        pts->end_points[first_contour + i] = (uint16_t)(first_point + hz_glyf_u16(p + i*2));
+    }
+
+    size_t n = (size_t)hz_glyf_u16(p + (contour_count - 1)*2) + 1;
+    p += contour_count*2;
+    p += 2 + hz_glyf_u16(p); // skip instructions
+
+    // flags, counting the coordinate bytes on the way to bounds check them at once
+    if (pts->flags) hz_vector_header(pts->flags)->size = 0;
+    hz_vector_extend(pts->flags, n);
+    uint8_t *flags = pts->flags;
+    size_t coord_bytes = 0;
+    for (size_t i = 0; i < n;) {
+        if (p >= end) return HZ_FALSE;
+        uint8_t f = *p++;
+        size_t repeat = 1;
+        if (f & HZ_GLYF_REPEAT) {
+            if (p >= end) return HZ_FALSE;
+            repeat += *p++;
+        }
+
+        size_t bytes = ((f & HZ_GLYF_X_SHORT) ? 1 : (f & HZ_GLYF_X_SAME_OR_POSITIVE) ? 0 : 2)
+                     + ((f & HZ_GLYF_Y_SHORT) ? 1 : (f & HZ_GLYF_Y_SAME_OR_POSITIVE) ? 0 : 2);
+        for (; repeat && i < n; --repeat, ++i) {
+            flags[i] = f;
+            coord_bytes += bytes;
+        }
+    }
+
+    if (p + coord_bytes > end) return HZ_FALSE;
+
+    hz_vector_extend(pts->x, n);
+    hz_vector_extend(pts->y, n);
+    hz_vector_extend(pts->on_curve, n);
+
+    p = hz_glyf_read_coords(p, flags, n, HZ_GLYF_X_SHORT, HZ_GLYF_X_SAME_OR_POSITIVE, pts->x + first_point);
+    hz_glyf_read_coords(p, flags, n, HZ_GLYF_Y_SHORT, HZ_GLYF_Y_SAME_OR_POSITIVE, pts->y + first_point);
+
+    for (size_t i = 0; i < n; ++i) {
+        pts->on_curve[first_point + i] = flags[i] & HZ_GLYF_ON_CURVE;
+    }
+
+    return HZ_TRUE;
+}
+
+HZ_STATIC hz_bool hz_glyf_decode_points(hz_face_t *face, hz_index_t glyph, hz_glyf_points_t *pts, int depth);
+
+HZ_STATIC hz_bool hz_glyf_decode_composite(hz_face_t *face, const uint8_t *g, size_t len,
+                                           hz_glyf_points_t *pts, int depth)
+{
+    const uint8_t *end = g + len;
+    const uint8_t *p = g + 10;
+    size_t base = hz_vector_size(pts->x); // first point of this glyph, anchor points are numbered from it
+    uint16_t flags;
+
+    do {
+        if (p + 4 > end) return HZ_FALSE;
+        flags = hz_glyf_u16(p);
+        hz_index_t component = hz_glyf_u16(p + 2);
+        p += 4;
+
+        int arg1, arg2;
+        if (flags & HZ_GLYF_ARG_1_AND_2_ARE_WORDS) {
+            if (p + 4 > end) return HZ_FALSE;
+            arg1 = hz_glyf_u16(p); arg2 = hz_glyf_u16(p + 2);
+            if (flags & HZ_GLYF_ARGS_ARE_XY_VALUES) { arg1 = (int16_t)arg1; arg2 = (int16_t)arg2; }
+            p += 4;
+        } else {
+            if (p + 2 > end) return HZ_FALSE;
+            arg1 = p[0]; arg2 = p[1];
+            if (flags & HZ_GLYF_ARGS_ARE_XY_VALUES) { arg1 = (int8_t)arg1; arg2 = (int8_t)arg2; }
+            p += 2;
+        }
+
+        float m[6] = {1,0,0,1,0,0};
+        if (flags & HZ_GLYF_WE_HAVE_A_SCALE) {
+            if (p + 2 > end) return HZ_FALSE;
+            m[0] = m[3] = (int16_t)hz_glyf_u16(p) / 16384.0f;
+            p += 2;
+        } else if (flags & HZ_GLYF_WE_HAVE_AN_X_AND_Y_SCALE) {
+            if (p + 4 > end) return HZ_FALSE;
+            m[0] = (int16_t)hz_glyf_u16(p) / 16384.0f;
+            m[3] = (int16_t)hz_glyf_u16(p + 2) / 16384.0f;
+            p += 4;
+        } else if (flags & HZ_GLYF_WE_HAVE_A_TWO_BY_TWO) {
+            if (p + 8 > end) return HZ_FALSE;
+            m[0] = (int16_t)hz_glyf_u16(p) / 16384.0f;
+            m[1] = (int16_t)hz_glyf_u16(p + 2) / 16384.0f;
+            m[2] = (int16_t)hz_glyf_u16(p + 4) / 16384.0f;
+            m[3] = (int16_t)hz_glyf_u16(p + 6) / 16384.0f;
+            p += 8;
+        }
+
+        size_t first = hz_vector_size(pts->x);
+        size_t parent_count = first - base;
+        if (!hz_glyf_decode_points(face, component, pts, depth + 1))
+            return HZ_FALSE;
+
+        size_t n = hz_vector_size(pts->x) - first;
+        int16_t *xs = pts->x + first, *ys = pts->y + first;
+
+        if (flags & HZ_GLYF_ARGS_ARE_XY_VALUES) {
+            if (flags & HZ_GLYF_SCALED_COMPONENT_OFFSET && !(flags & HZ_GLYF_UNSCALED_COMPONENT_OFFSET)) {
+                m[4] = m[0]*arg1 + m[2]*arg2;
+                m[5] = m[1]*arg1 + m[3]*arg2;
+            } else {
+                m[4] = (float)arg1;
+                m[5] = (float)arg2;
+            }
+            hz_glyf_transform(xs, ys, n, m);
+        } else {
+            // anchor points, align point arg2 of the component with point arg1 of the glyph so far
+            hz_glyf_transform(xs, ys, n, m);
+            if ((size_t)arg1 >= parent_count || (size_t)arg2 >= n) return HZ_FALSE;
+            float shift[6] = {1,0,0,1, (float)(pts->x[base + arg1] - xs[arg2]), (float)(pts->y[base + arg1] - ys[arg2])};
+            hz_glyf_transform(xs, ys, n, shift);
+        }
+    } while (flags & HZ_GLYF_MORE_COMPONENTS);
+
+    return HZ_TRUE;
+}
+
+// Appends the points of a glyph, resolving composites, returns HZ_FALSE on malformed data.
+HZ_STATIC hz_bool hz_glyf_decode_points(hz_face_t *face, hz_index_t glyph, hz_glyf_points_t *pts, int depth)
+{
+    size_t len;
+    const uint8_t *g = hz_glyf_locate(face, glyph, &len);
+    if (g == NULL) return HZ_TRUE; // empty
+    if (len < 10 || depth > HZ_GLYF_MAX_COMPOSITE_DEPTH) return HZ_FALSE;
+
+    int16_t contour_count = (int16_t)hz_glyf_u16(g);
+    if (contour_count > 0) return hz_glyf_decode_simple(g, len, contour_count, pts);
+    if (contour_count < 0) return hz_glyf_decode_composite(face, g, len, pts, depth);
+    return HZ_TRUE;
+}
+
+// Turns TrueType on/off curve points into moveto/line/quadratic verbs, implied on-curve
+// points between two off-curve ones are made explicit.
+HZ_STATIC hz_outline_t *hz_glyf_points_to_outline(hz_glyf_points_t *pts)
+{
+    size_t contour_count = hz_vector_size(pts->end_points);
+    size_t n = hz_vector_size(pts->x);
+    // each point turns into at most one verb with 2 points, plus a moveto and a closing verb per contour
+    size_t max_verbs = n + 2*contour_count;
+
+    hz_outline_t bound = {.verb_count = (uint16_t)HZ_MIN(max_verbs, UINT16_MAX),
+                          .point_count = (uint16_t)HZ_MIN(2*max_verbs, UINT16_MAX)};
+    if (max_verbs > UINT16_MAX || 2*max_verbs > UINT16_MAX) return NULL;
+
+    // built at its upper bound size in scratch memory, then copied out at its final size
+    if (pts->outline) hz_vector_header(pts->outline)->size = 0;
+    hz_vector_extend(pts->outline, hz_outline_size(&bound) + ((max_verbs + 3) >> 2));
+    hz_outline_t *o = (hz_outline_t *)pts->outline;
+    *o = bound;
+    int16_t *pt = hz_outline_points(o);
+    uint8_t *verbs = pts->outline + hz_outline_size(&bound);
+    HZ_MEMSET(verbs, 0, (max_verbs + 3) >> 2);
+    size_t verb_count = 0, point_count = 0;
+
+    #define PUSH_VERB(_T) (verbs[verb_count >> 2] |= (uint8_t)(((_T) - 1) << ((verb_count & 3) * 2)), ++verb_count)
+    #define PUSH_POINT(_X, _Y) (pt[2*point_count] = (int16_t)(_X), pt[2*point_count+1] = (int16_t)(_Y), ++point_count)
+
+    size_t start = 0;
+    for (size_t c = 0; c < contour_count; start = (size_t)pts->end_points[c++] + 1) {
+        size_t last = pts->end_points[c];
+        if (last < start || last >= n) continue;
+
+        int32_t sx, sy, scx = 0, scy = 0, cx = 0, cy = 0;
+        hz_bool start_off = !pts->on_curve[start] && last > start;
+        size_t i = start + 1;
+
+        if (start_off) {
+            scx = pts->x[start]; scy = pts->y[start];
+            if (!pts->on_curve[start + 1]) {
+                sx = (scx + pts->x[start + 1]) >> 1;
+                sy = (scy + pts->y[start + 1]) >> 1;
+            } else {
+                sx = pts->x[start + 1];
+                sy = pts->y[start + 1];
+                ++i;
+            }
+        } else {
+            sx = pts->x[start];
+            sy = pts->y[start];
+        }
+
+        PUSH_VERB(HZ_VERTEX_TYPE_MOVETO);
+        PUSH_POINT(sx, sy);
+        hz_bool was_off = HZ_FALSE;
+
+        for (; i <= last; ++i) {
+            int32_t x = pts->x[i], y = pts->y[i];
+            if (!pts->on_curve[i]) {
+                if (was_off) {
+                    PUSH_VERB(HZ_VERTEX_TYPE_QUADRATIC_BEZIER);
+                    PUSH_POINT(cx, cy);
+                    PUSH_POINT((cx + x) >> 1, (cy + y) >> 1);
+                }
+                cx = x; cy = y;
+                was_off = HZ_TRUE;
+            } else {
+                if (was_off) {
+                    PUSH_VERB(HZ_VERTEX_TYPE_QUADRATIC_BEZIER);
+                    PUSH_POINT(cx, cy);
+                } else {
+                    PUSH_VERB(HZ_VERTEX_TYPE_LINE);
+                }
+                PUSH_POINT(x, y);
+                was_off = HZ_FALSE;
             }
-            case HZ_VERTEX_TYPE_CUBIC_BEZIER: { // cubic bezier
-                hz_bezier_vertex_t v;
-                v.type = vertices[i].type;
-                v.v1 = pen;
-                v.v2 = hz_vec2_add(translate, hz_vec2_mult_s((hz_vec2){vertices[i].x,vertices[i].y}, y_scale));
-                v.c1 = hz_vec2_add(translate, hz_vec2_mult_s((hz_vec2){vertices[i].cx,vertices[i].cy}, y_scale));
-                v.c2 = hz_vec2_add(translate, hz_vec2_mult_s((hz_vec2){vertices[i].cx1,vertices[i].cy1}, y_scale));
-                hz_vector_push_back(draw_data->verts, v);
-                pen = v.v2;
-                ++c->curve_count;
-                break;
+        }
+
+        // close the contour
+        if (start_off) {
+            if (was_off) {
+                PUSH_VERB(HZ_VERTEX_TYPE_QUADRATIC_BEZIER);
+                PUSH_POINT(cx, cy);
+                PUSH_POINT((cx + scx) >> 1, (cy + scy) >> 1);
             }
+            PUSH_VERB(HZ_VERTEX_TYPE_QUADRATIC_BEZIER);
+            PUSH_POINT(scx, scy);
+        } else if (was_off) {
+            PUSH_VERB(HZ_VERTEX_TYPE_QUADRATIC_BEZIER);
+            PUSH_POINT(cx, cy);
+        } else {
+            PUSH_VERB(HZ_VERTEX_TYPE_LINE);
         }
-        
-        ++i;
+        PUSH_POINT(sx, sy);
+        ++o->contour_count;
+    }
+
+    #undef PUSH_VERB
+    #undef PUSH_POINT
+
+    hz_outline_t header = {
+        .verb_count = (uint16_t)verb_count,
+        .point_count = (uint16_t)point_count,
+        .contour_count = o->contour_count,
+        .curve_count = (uint16_t)(verb_count - o->contour_count)
+    };
+
+    hz_outline_t *out = hz_malloc(hz_outline_size(&header));
+    *out = header;
+    HZ_MEMCPY(hz_outline_points(out), pt, sizeof(int16_t)*2*point_count);
+    HZ_MEMCPY(hz_outline_verbs(out), verbs, (verb_count + 3) >> 2);
+    return out;
+}
+
+HZ_STATIC hz_outline_t *hz_glyf_decode_outline(hz_face_t *face, hz_index_t glyph_index)
+{
+    hz_glyf_points_t *pts = &face->glyf_scratch;
+    if (pts->x) {
+        hz_vector_header(pts->x)->size = 0;
+        hz_vector_header(pts->y)->size = 0;
+        hz_vector_header(pts->on_curve)->size = 0;
+    }
+    if (pts->end_points) hz_vector_header(pts->end_points)->size = 0;
+
+    if (!hz_glyf_decode_points(face, glyph_index, pts, 0))
+        return NULL;
+
+    return hz_glyf_points_to_outline(pts);
+}
+
+// Decodes a glyph with stb_truetype into the compact outline encoding.
+HZ_STATIC hz_outline_t *hz_stbtt_decode_outline(hz_face_t *face, hz_index_t glyph_index)
+{
+    stbtt_vertex *vertices = NULL;
+    int nverts = 0;
+    int point_count = 0, contour_count = 0;
+
+    if (!stbtt_IsGlyphEmpty(face->fontinfo, glyph_index))
+        nverts = stbtt_GetGlyphShape(face->fontinfo, glyph_index, &vertices);
+
+    for (int i = 0; i < nverts; ++i) {
+        switch (vertices[i].type) {
+            case HZ_VERTEX_TYPE_MOVETO: ++contour_count; ++point_count; break;
+            case HZ_VERTEX_TYPE_LINE: ++point_count; break;
+            case HZ_VERTEX_TYPE_QUADRATIC_BEZIER: point_count += 2; break;
+            case HZ_VERTEX_TYPE_CUBIC_BEZIER: point_count += 3; break;
+        }
+    }
+
+    hz_outline_t header = {
+        .verb_count = (uint16_t)nverts,
+        .point_count = (uint16_t)point_count,
+        .contour_count = (uint16_t)contour_count,
+        .curve_count = (uint16_t)(nverts - contour_count)
+    };
+
+    hz_outline_t *o = hz_malloc(hz_outline_size(&header));
+    *o = header;
+    int16_t *pt = hz_outline_points(o);
+    uint8_t *verbs = hz_outline_verbs(o);
+    HZ_MEMSET(verbs, 0, (nverts + 3) >> 2);
+
+    for (int i = 0; i < nverts; ++i) {
+        const stbtt_vertex *v = &vertices[i];
+        verbs[i >> 2] |= (uint8_t)((v->type - 1) << ((i & 3) * 2));
+
+        switch (v->type) {
+            case HZ_VERTEX_TYPE_CUBIC_BEZIER:
+                *pt++ = v->cx; *pt++ = v->cy;
+                *pt++ = v->cx1; *pt++ = v->cy1;
+                break;
+            case HZ_VERTEX_TYPE_QUADRATIC_BEZIER:
+                *pt++ = v->cx; *pt++ = v->cy;
+                break;
+        }
+
+        *pt++ = v->x; *pt++ = v->y;
+    }
+
+    if (vertices != NULL)
+        stbtt_FreeShape(face->fontinfo, vertices);
+
+    return o;
+}
+
+HZ_STATIC hz_outline_t *hz_face_get_outline(hz_face_t *face, hz_index_t glyph_index)
+{
+    hz_outline_t *o = hz_outline_cache_lookup(&face->outline_cache, glyph_index);
+    if (o == NULL) {
+        // TrueType outlines are decoded natively, CFF ones still go through stb_truetype
+        if (face->glyf && face->loca) o = hz_glyf_decode_outline(face, glyph_index);
+        if (o == NULL) o = hz_stbtt_decode_outline(face, glyph_index);
+        hz_outline_cache_insert(&face->outline_cache, glyph_index, o);
+    }
+
+    return o;
+}
+
+// Appends the outline to draw_data with scale and translate applied. Space for the
+// whole outline is reserved up front.
+HZ_STATIC void hz_outline_emit(const hz_outline_t *o, hz_shape_draw_data_t *draw_data, hz_vec2 translate, float scale)
+{
+    size_t first_vert = hz_vector_size(draw_data->verts);
+    size_t first_contour = hz_vector_size(draw_data->contours);
+    if (!o->verb_count) return;
+
+    hz_vector_extend(draw_data->verts, o->curve_count);
+    hz_vector_extend(draw_data->contours, o->contour_count);
+
+    const int16_t *pt = hz_outline_points(o);
+    hz_bezier_vertex_t *v = draw_data->verts + first_vert;
+    hz_contour_t *c = draw_data->contours + first_contour - 1;
+    hz_vec2 pen = {0,0};
+
+    #define NEXT_POINT() (pt += 2, (hz_vec2){translate.x + pt[-2]*scale, translate.y + pt[-1]*scale})
+    for (uint16_t i = 0; i < o->verb_count; ++i) {
+        int type = hz_outline_verb(o, i) + 1;
+
+        if (type == HZ_VERTEX_TYPE_MOVETO) {
+            pen = NEXT_POINT();
+            *++c = (hz_contour_t){(uint32_t)(v - draw_data->verts), 0, pen};
+            continue;
+        }
+
+        v->type = type;
+        v->v1 = pen;
+        if (type >= HZ_VERTEX_TYPE_QUADRATIC_BEZIER) v->c1 = NEXT_POINT();
+        if (type == HZ_VERTEX_TYPE_CUBIC_BEZIER) v->c2 = NEXT_POINT();
+        v->v2 = pen = NEXT_POINT();
+        ++c->curve_count;
+        ++v;
+    }
+    #undef NEXT_POINT
+}
+
+int hz_face_get_glyph_shape(hz_face_t *face, hz_shape_draw_data_t *draw_data, hz_vec2 translate, float y_scale, hz_index_t glyph_index)
+{
+    hz_outline_t *o = hz_face_get_outline(face, glyph_index);
+    hz_outline_emit(o, draw_data, translate, y_scale);
+    return o->verb_count;
+}
+
+void hz_face_get_glyph_shapes(hz_face_t *face, hz_shape_draw_data_t *draw_data, hz_glyph_shape_request_t *requests, size_t count)
+{
+    // fetch every outline first so the output is grown only once
+    size_t vert_count = hz_vector_size(draw_data->verts);
+    size_t contour_count = hz_vector_size(draw_data->contours);
+    size_t max_size = face->outline_cache.max_size;
+    hz_outline_t **outlines = hz_malloc(sizeof(hz_outline_t *) * count);
+
+    if (outlines == NULL) {
+        // no room to hold the batch, fetch and emit the outlines one at a time
+        for (size_t i = 0; i < count; ++i) {
+            hz_outline_t *o = hz_face_get_outline(face, requests[i].glyph);
+            requests[i].first_contour = hz_vector_size(draw_data->contours);
+            hz_outline_emit(o, draw_data, requests[i].translate, requests[i].scale);
+            requests[i].contour_count = o->contour_count;
+        }
+        return;
+    }
+
+    // outlines must stay alive until they are emitted, grow the budget for the call if needed
+    face->outline_cache.max_size = SIZE_MAX;
+    for (size_t i = 0; i < count; ++i) {
+        outlines[i] = hz_face_get_outline(face, requests[i].glyph);
+        vert_count += outlines[i]->curve_count;
+        contour_count += outlines[i]->contour_count;
+    }
+
+    hz_vector_reserve(draw_data->verts, vert_count);
+    hz_vector_reserve(draw_data->contours, contour_count);
+
+    for (size_t i = 0; i < count; ++i) {
+        requests[i].first_contour = hz_vector_size(draw_data->contours);
+        hz_outline_emit(outlines[i], draw_data, requests[i].translate, requests[i].scale);
+        requests[i].contour_count = outlines[i]->contour_count;
     }
 
-    stbtt_FreeShape(face->fontinfo, vertices);
-    return nverts;
-    #undef PUSH_CURVE
+    face->outline_cache.max_size = max_size;
+    hz_outline_cache_trim(&face->outline_cache, max_size);
+    hz_free(outlines);
 }
 
 void hz_face_get_glyph_box(hz_face_t *face, uint16_t glyph_id, hz_bbox_t *b)
 {
-    stbtt_GetGlyphBox(face->fontinfo, glyph_id, 
-                            &b->x0, &b->y0, &b->x1, &b->y1);
+    *b = (hz_bbox_t){0};
+
+    if (face->glyf && face->loca) {
+        // the box is stored in the glyph header, nothing else needs decoding
+        size_t len;
+        const uint8_t *g = hz_glyf_locate(face, glyph_id, &len);
+        if (g != NULL && len >= 10) {
+            b->x0 = (int16_t)hz_glyf_u16(g + 2);
+            b->y0 = (int16_t)hz_glyf_u16(g + 4);
+            b->x1 = (int16_t)hz_glyf_u16(g + 6);
+            b->y1 = (int16_t)hz_glyf_u16(g + 8);
+        }
+    } else {
+        stbtt_GetGlyphBox(face->fontinfo, glyph_id, &b->x0, &b->y0, &b->x1, &b->y1);
+    }
 }
 
 void hz_face_get_scaled_glyph
@@ -7460,9 +12954,551 @@ void hz_face_get_scaled_glyph
                             &b->x0, &b->y0, &b->x1, &b->y1);
 }
 
+/* CPU SDF/MSDF rasterizer
+
+    Glyph outlines from hz_face_get_glyph_shape are flattened into line segments, the
+    distance from every pixel center of the cell to the closest segment is then computed
+    8 pixels at a time (AVX2) or one at a time on other targets. The sign of the plain SDF
+    comes from the non-zero winding rule evaluated in the same loop.
+
+    For MSDF the original edges are colored per contour (switching color at corners), each
+    channel only sees the segments of its colors and takes its sign from the side of the
+    closest segment. The optional 4th channel stores the true SDF. This is a simplified
+    version of Chlumsky's method and doesn't run the error correction pass.
+*/
+#define HZ_SDF_FLATTEN_TOLERANCE 0.1f
+#define HZ_SDF_MAX_SUBDIVISIONS 64
+#define HZ_SDF_CORNER_CROSS_THRESHOLD 0.141f // sin(3 rad), same as msdfgen
+
+enum {
+    HZ_SDF_COLOR_RED = 1,
+    HZ_SDF_COLOR_GREEN = 2,
+    HZ_SDF_COLOR_BLUE = 4,
+    HZ_SDF_COLOR_YELLOW = HZ_SDF_COLOR_RED | HZ_SDF_COLOR_GREEN,
+    HZ_SDF_COLOR_MAGENTA = HZ_SDF_COLOR_RED | HZ_SDF_COLOR_BLUE,
+    HZ_SDF_COLOR_CYAN = HZ_SDF_COLOR_GREEN | HZ_SDF_COLOR_BLUE,
+    HZ_SDF_COLOR_WHITE = HZ_SDF_COLOR_RED | HZ_SDF_COLOR_GREEN | HZ_SDF_COLOR_BLUE
+};
+
+typedef struct {
+    float *ax, *ay, *dx, *dy, *inv_len2;
+    uint8_t *colors;
+    size_t count;
+    float orientation; // +1 if filled regions are on the left of the edges, -1 otherwise
+} hz_sdf_segments_t;
+
+HZ_STATIC int hz_sdf_subdivisions(const hz_bezier_vertex_t *v)
+{
+    float ddx, ddy, k;
+    switch (v->type) {
+        default: return 1;
+        case HZ_VERTEX_TYPE_QUADRATIC_BEZIER:
+            ddx = v->v1.x - 2.0f*v->c1.x + v->v2.x;
+            ddy = v->v1.y - 2.0f*v->c1.y + v->v2.y;
+            k = sqrtf(ddx*ddx + ddy*ddy) / (8.0f*HZ_SDF_FLATTEN_TOLERANCE);
+            break;
+        case HZ_VERTEX_TYPE_CUBIC_BEZIER: {
+            float ax = v->v1.x - 2.0f*v->c1.x + v->c2.x, ay = v->v1.y - 2.0f*v->c1.y + v->c2.y;
+            float bx = v->c1.x - 2.0f*v->c2.x + v->v2.x, by = v->c1.y - 2.0f*v->c2.y + v->v2.y;
+            k = 0.75f * sqrtf(HZ_MAX(ax*ax + ay*ay, bx*bx + by*by)) / HZ_SDF_FLATTEN_TOLERANCE;
+            break;
+        }
+    }
+
+    int n = (int)ceilf(sqrtf(k));
+    return HZ_MIN(HZ_MAX(n, 1), HZ_SDF_MAX_SUBDIVISIONS);
+}
+
+HZ_STATIC hz_vec2 hz_sdf_eval_curve(const hz_bezier_vertex_t *v, float t)
+{
+    float u = 1.0f - t;
+    switch (v->type) {
+        default:
+            return (hz_vec2){u*v->v1.x + t*v->v2.x, u*v->v1.y + t*v->v2.y};
+        case HZ_VERTEX_TYPE_QUADRATIC_BEZIER:
+            return (hz_vec2){u*u*v->v1.x + 2.0f*u*t*v->c1.x + t*t*v->v2.x,
+                             u*u*v->v1.y + 2.0f*u*t*v->c1.y + t*t*v->v2.y};
+        case HZ_VERTEX_TYPE_CUBIC_BEZIER:
+            return (hz_vec2){u*u*u*v->v1.x + 3.0f*u*u*t*v->c1.x + 3.0f*u*t*t*v->c2.x + t*t*t*v->v2.x,
+                             u*u*u*v->v1.y + 3.0f*u*u*t*v->c1.y + 3.0f*u*t*t*v->c2.y + t*t*t*v->v2.y};
+    }
+}
+
+// unit tangent at the start (end = 0) or end (end = 1) of a curve
+HZ_STATIC hz_vec2 hz_sdf_curve_tangent(const hz_bezier_vertex_t *v, int end)
+{
+    hz_vec2 a, b;
+    switch (v->type) {
+        default: a = v->v1; b = v->v2; break;
+        case HZ_VERTEX_TYPE_QUADRATIC_BEZIER:
+            if (end) { a = v->c1; b = v->v2; } else { a = v->v1; b = v->c1; }
+            break;
+        case HZ_VERTEX_TYPE_CUBIC_BEZIER:
+            if (end) { a = v->c2; b = v->v2; } else { a = v->v1; b = v->c1; }
+            break;
+    }
+
+    float dx = b.x - a.x, dy = b.y - a.y, l = sqrtf(dx*dx + dy*dy);
+    if (l == 0.0f) {
+        dx = v->v2.x - v->v1.x; dy = v->v2.y - v->v1.y; l = sqrtf(dx*dx + dy*dy);
+        if (l == 0.0f) return (hz_vec2){0.0f, 0.0f};
+    }
+
+    return (hz_vec2){dx/l, dy/l};
+}
+
+// assigns a color to every curve of a contour, switching colors at corners
+HZ_STATIC void hz_sdf_color_contour(const hz_bezier_vertex_t *verts, size_t n, uint8_t *colors)
+{
+    static const uint8_t cycle[3] = {HZ_SDF_COLOR_CYAN, HZ_SDF_COLOR_MAGENTA, HZ_SDF_COLOR_YELLOW};
+    size_t first_corner = n;
+    int corner_count = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        hz_vec2 a = hz_sdf_curve_tangent(&verts[(i + n - 1) % n], 1);
+        hz_vec2 b = hz_sdf_curve_tangent(&verts[i], 0);
+        float dot = a.x*b.x + a.y*b.y, cross = a.x*b.y - a.y*b.x;
+        if (dot <= 0.0f || fabsf(cross) > HZ_SDF_CORNER_CROSS_THRESHOLD) {
+            if (first_corner == n) first_corner = i;
+            colors[i] = 1; // mark corner
+            ++corner_count;
+        } else {
+            colors[i] = 0;
+        }
+    }
+
+    if (corner_count == 0) {
+        // smooth contour, every channel sees every edge
+        for (size_t i = 0; i < n; ++i) colors[i] = HZ_SDF_COLOR_WHITE;
+        return;
+    }
+
+    if (corner_count == 1) {
+        // teardrop, split the contour into three differently colored parts
+        for (size_t k = 0; k < n; ++k) {
+            size_t i = (first_corner + k) % n;
+            colors[i] = cycle[(3*k)/n];
+        }
+        return;
+    }
+
+    int c = 0, group = 0;
+    for (size_t k = 0; k < n; ++k) {
+        size_t i = (first_corner + k) % n;
+        if (colors[i] == 1 && k) {
+            ++group;
+            c = (c + 1) % 3;
+            // last group wraps around to the first one, it can't share its color
+            if (group == corner_count - 1 && c == 0) c = 1;
+        }
+        colors[i] = cycle[c];
+    }
+}
+
+HZ_STATIC void hz_sdf_segments_release(hz_sdf_segments_t *s)
+{
+    hz_free(s->ax);
+    hz_free(s->colors);
+}
+
+// Builds the segments of `contour_count` contours indexing into `all_verts`.
+HZ_STATIC hz_bool hz_sdf_build_segments(const hz_bezier_vertex_t *all_verts, const hz_contour_t *contours,
+                                        size_t contour_count, hz_bool colored, hz_sdf_segments_t *s)
+{
+    size_t vert_count = 0;
+    size_t count = contour_count; // closing segments
+
+    for (size_t c = 0; c < contour_count; ++c) {
+        for (uint16_t j = 0; j < contours[c].curve_count; ++j)
+            count += hz_sdf_subdivisions(&all_verts[contours[c].first_curve + j]);
+        vert_count += contours[c].curve_count;
+    }
+
+    *s = (hz_sdf_segments_t){0};
+    s->ax = hz_malloc(sizeof(float) * 5 * (count + 8));
+    s->colors = hz_malloc(count + vert_count + 8);
+    if (s->ax == NULL || s->colors == NULL) {
+        hz_sdf_segments_release(s);
+        return HZ_FALSE;
+    }
+
+    s->ay = s->ax + (count + 8);
+    s->dx = s->ay + (count + 8);
+    s->dy = s->dx + (count + 8);
+    s->inv_len2 = s->dy + (count + 8);
+    uint8_t *curve_colors = s->colors + count + 8;
+
+    float area = 0.0f;
+    size_t k = 0;
+
+    for (size_t c = 0; c < contour_count; ++c) {
+        const hz_contour_t *contour = &contours[c];
+        const hz_bezier_vertex_t *verts = all_verts + contour->first_curve;
+        if (!contour->curve_count) continue;
+
+        if (colored)
+            hz_sdf_color_contour(verts, contour->curve_count, curve_colors);
+
+        hz_vec2 last = contour->origin;
+        for (uint16_t j = 0; j <= contour->curve_count; ++j) {
+            hz_bezier_vertex_t closing;
+            const hz_bezier_vertex_t *v;
+            uint8_t color;
+            int n;
+
+            if (j == contour->curve_count) {
+                // close the contour if the font didn't
+                if (last.x == contour->origin.x && last.y == contour->origin.y) break;
+                closing = (hz_bezier_vertex_t){.v1 = last, .v2 = contour->origin, .type = HZ_VERTEX_TYPE_LINE};
+                v = &closing; n = 1;
+                color = colored ? curve_colors[j-1] : HZ_SDF_COLOR_WHITE;
+            } else {
+                v = &verts[j];
+                n = hz_sdf_subdivisions(v);
+                color = colored ? curve_colors[j] : HZ_SDF_COLOR_WHITE;
+            }
+
+            hz_vec2 p0 = v->v1;
+            for (int m = 1; m <= n; ++m) {
+                hz_vec2 p1 = m == n ? v->v2 : hz_sdf_eval_curve(v, (float)m / (float)n);
+                float dx = p1.x - p0.x, dy = p1.y - p0.y, l2 = dx*dx + dy*dy;
+
+                if (l2 > 0.0f) {
+                    s->ax[k] = p0.x; s->ay[k] = p0.y;
+                    s->dx[k] = dx; s->dy[k] = dy;
+                    s->inv_len2[k] = 1.0f / l2;
+                    s->colors[k] = color;
+                    area += p0.x*p1.y - p1.x*p0.y;
+                    ++k;
+                }
+
+                p0 = p1;
+            }
+
+            last = v->v2;
+        }
+    }
+
+    s->count = k;
+    s->orientation = area >= 0.0f ? 1.0f : -1.0f;
+    return HZ_TRUE;
+}
+
+HZ_ALWAYS_INLINE uint8_t hz_sdf_encode(float sd, float max_distance)
+{
+    float v = 0.5f + sd / (2.0f * max_distance);
+    v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+    return (uint8_t)(v * 255.0f + 0.5f);
+}
+
+// true signed distance of one row of pixels, sign from the non-zero winding rule
+HZ_STATIC void hz_sdf_row(const hz_sdf_segments_t *s, float x0, float py, int w, float *out)
+{
+    int i = 0;
+
+#if HZ_ARCH & HZ_ARCH_AVX2_BIT
+    for (; i + 8 <= w; i += 8) {
+        __m256 px = _mm256_add_ps(_mm256_set1_ps(x0 + (float)i),
+                                  _mm256_setr_ps(0.0f,1.0f,2.0f,3.0f,4.0f,5.0f,6.0f,7.0f));
+        __m256 best = _mm256_set1_ps(INFINITY);
+        __m256i winding = _mm256_setzero_si256();
+        __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+
+        for (size_t k = 0; k < s->count; ++k) {
+            __m256 dx = _mm256_set1_ps(s->dx[k]), dy = _mm256_set1_ps(s->dy[k]);
+            __m256 wx = _mm256_sub_ps(px, _mm256_set1_ps(s->ax[k]));
+            float wys = py - s->ay[k];
+            __m256 wy = _mm256_set1_ps(wys);
+            __m256 t = _mm256_mul_ps(_mm256_fmadd_ps(wx, dx, _mm256_mul_ps(wy, dy)), _mm256_set1_ps(s->inv_len2[k]));
+            t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+            __m256 ex = _mm256_fnmadd_ps(t, dx, wx);
+            __m256 ey = _mm256_fnmadd_ps(t, dy, wy);
+            best = _mm256_min_ps(best, _mm256_fmadd_ps(ex, ex, _mm256_mul_ps(ey, ey)));
+
+            // the crossing test only depends on the row
+            float ay = s->ay[k], by = ay + s->dy[k];
+            if ((ay <= py) != (by <= py)) {
+                float xi = s->ax[k] + wys * s->dx[k] / s->dy[k];
+                __m256i hit = _mm256_castps_si256(_mm256_cmp_ps(px, _mm256_set1_ps(xi), _CMP_LT_OQ));
+                __m256i dir = _mm256_set1_epi32(by > ay ? 1 : -1);
+                winding = _mm256_add_epi32(winding, _mm256_and_si256(hit, dir));
+            }
+        }
+
+        __m256 d = _mm256_sqrt_ps(best);
+        __m256 inside = _mm256_castsi256_ps(_mm256_cmpeq_epi32(winding, _mm256_setzero_si256()));
+        // negate outside (winding == 0)
+        d = _mm256_xor_ps(d, _mm256_and_ps(inside, _mm256_set1_ps(-0.0f)));
+        _mm256_storeu_ps(out + i, d);
+    }
+#endif
+
+    for (; i < w; ++i) {
+        float px = x0 + (float)i, best = INFINITY;
+        int winding = 0;
+
+        for (size_t k = 0; k < s->count; ++k) {
+            float wx = px - s->ax[k], wy = py - s->ay[k];
+            float t = (wx*s->dx[k] + wy*s->dy[k]) * s->inv_len2[k];
+            t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+            float ex = wx - t*s->dx[k], ey = wy - t*s->dy[k];
+            float d2 = ex*ex + ey*ey;
+            if (d2 < best) best = d2;
+
+            float ay = s->ay[k], by = ay + s->dy[k];
+            if ((ay <= py) != (by <= py) && px < s->ax[k] + wy * s->dx[k] / s->dy[k])
+                winding += by > ay ? 1 : -1;
+        }
+
+        out[i] = winding ? sqrtf(best) : -sqrtf(best);
+    }
+}
+
+// per channel signed distances of one pixel, sign taken from the side of the closest segment.
+// Ties between segments sharing an endpoint go to the one most orthogonal to the pixel.
+HZ_STATIC void hz_msdf_pixel(const hz_sdf_segments_t *s, float px, float py, float out[3])
+{
+    float best[3] = {INFINITY, INFINITY, INFINITY};
+    float best_orth[3] = {0.0f, 0.0f, 0.0f};
+    float best_side[3] = {0.0f, 0.0f, 0.0f};
+
+    for (size_t k = 0; k < s->count; ++k) {
+        float wx = px - s->ax[k], wy = py - s->ay[k];
+        float t = (wx*s->dx[k] + wy*s->dy[k]) * s->inv_len2[k];
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        float ex = wx - t*s->dx[k], ey = wy - t*s->dy[k];
+        float d2 = ex*ex + ey*ey;
+        float cross = s->dx[k]*wy - s->dy[k]*wx;
+        float w2 = wx*wx + wy*wy;
+        float orth = w2 > 0.0f ? cross*cross * s->inv_len2[k] / w2 : 1.0f;
+        float eps = 1e-4f * (d2 + 1e-6f);
+
+        for (int c = 0; c < 3; ++c) {
+            if (!(s->colors[k] & (1 << c))) continue;
+            if (d2 < best[c] - eps || (d2 <= best[c] + eps && orth > best_orth[c])) {
+                best[c] = d2;
+                best_orth[c] = orth;
+                best_side[c] = cross;
+            }
+        }
+    }
+
+    for (int c = 0; c < 3; ++c) {
+        float d = sqrtf(best[c]);
+        out[c] = best_side[c] * s->orientation > 0.0f ? d : -d;
+    }
+}
+
+HZ_STATIC void hz_sdf_fill_cell(hz_bitmap_t *atlas, hz_rect_t cell, uint8_t value)
+{
+    for (int j = 0; j < cell.h; ++j) {
+        uint8_t *row = atlas->data + (size_t)(cell.y + j) * atlas->stride + (size_t)cell.x * atlas->channels;
+        HZ_MEMSET(row, value, (size_t)cell.w * atlas->channels);
+    }
+}
+
+HZ_STATIC hz_bool hz_sdf_check_params(hz_face_t *face, hz_rect_t cell,
+                                     const hz_glyph_cache_opts_t *opts, const hz_bitmap_t *atlas)
+{
+    return face != NULL && opts != NULL && atlas != NULL && atlas->data != NULL
+        && cell.w > 0 && cell.h > 0 && cell.x >= 0 && cell.y >= 0
+        && cell.x + cell.w <= atlas->width && cell.y + cell.h <= atlas->height
+        && atlas->channels >= 1 && atlas->channels <= 4
+        && (opts->type != 1 || atlas->channels >= 3);
+}
+
+// Scale and translation placing the glyph at the center of the padded cell, returns
+// HZ_FALSE for empty glyphs.
+HZ_STATIC hz_bool hz_sdf_fit_glyph(hz_face_t *face, hz_index_t glyph, hz_rect_t cell,
+                                   const hz_glyph_cache_opts_t *opts, hz_glyph_shape_request_t *req,
+                                   hz_bbox_t *bounds)
+{
+    hz_face_get_glyph_box(face, glyph, bounds);
+    int bw = bounds->x1 - bounds->x0, bh = bounds->y1 - bounds->y0;
+    if (bw <= 0 || bh <= 0)
+        return HZ_FALSE;
+
+    float aw = (float)cell.w - 2.0f*opts->padd, ah = (float)cell.h - 2.0f*opts->padd;
+    float scale = hz_face_scale_for_pixel_h(face, hz_glyph_cache_glyph_height(opts));
+    scale = HZ_MIN(scale, aw / (float)bw);
+    scale = HZ_MIN(scale, ah / (float)bh);
+
+    req->glyph = glyph;
+    req->scale = scale;
+    req->translate = (hz_vec2){cell.x + cell.w*0.5f - (bounds->x0 + bounds->x1)*0.5f*scale,
+                               cell.y + cell.h*0.5f - (bounds->y0 + bounds->y1)*0.5f*scale};
+    return HZ_TRUE;
+}
+
+HZ_STATIC void hz_sdf_write_slot_uv(struct hz_cache_slot_t *slot, hz_rect_t cell, const hz_bbox_t *bounds,
+                                    float scale, const hz_bitmap_t *atlas)
+{
+    float bw = (float)(bounds->x1 - bounds->x0), bh = (float)(bounds->y1 - bounds->y0);
+    float x0 = cell.x + cell.w*0.5f - bw*0.5f*scale;
+    float y0 = cell.y + cell.h*0.5f - bh*0.5f*scale;
+    slot->u0 = x0 / (float)atlas->width;
+    slot->v0 = y0 / (float)atlas->height;
+    slot->u1 = (x0 + bw*scale) / (float)atlas->width;
+    slot->v1 = (y0 + bh*scale) / (float)atlas->height;
+}
+
+HZ_STATIC hz_error_t hz_sdf_render_contours(const hz_bezier_vertex_t *verts, const hz_contour_t *contours,
+                                            size_t contour_count, hz_rect_t cell,
+                                            const hz_glyph_cache_opts_t *opts, hz_bitmap_t *atlas)
+{
+    float max_distance = opts->max_sdf_distance > 0.0f ? opts->max_sdf_distance : 1.0f;
+    hz_sdf_segments_t segs;
+    hz_bool msdf = opts->type == 1;
+    if (!hz_sdf_build_segments(verts, contours, contour_count, msdf, &segs)) {
+        return HZ_ERROR_OUT_OF_MEMORY;
+    }
+
+    float *row_sd = hz_malloc(sizeof(float) * cell.w);
+    if (row_sd == NULL) {
+        hz_sdf_segments_release(&segs);
+        return HZ_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (int j = 0; j < cell.h; ++j) {
+        float py = (float)(cell.y + j) + 0.5f;
+        float x0 = (float)cell.x + 0.5f;
+        uint8_t *row = atlas->data + (size_t)(cell.y + j) * atlas->stride + (size_t)cell.x * atlas->channels;
+
+        if (!msdf || atlas->channels == 4)
+            hz_sdf_row(&segs, x0, py, cell.w, row_sd);
+
+        for (int i = 0; i < cell.w; ++i) {
+            uint8_t *px = row + i * atlas->channels;
+            if (msdf) {
+                float d[3];
+                hz_msdf_pixel(&segs, x0 + (float)i, py, d);
+                px[0] = hz_sdf_encode(d[0], max_distance);
+                px[1] = hz_sdf_encode(d[1], max_distance);
+                px[2] = hz_sdf_encode(d[2], max_distance);
+                if (atlas->channels == 4) px[3] = hz_sdf_encode(row_sd[i], max_distance);
+            } else {
+                uint8_t v = hz_sdf_encode(row_sd[i], max_distance);
+                for (int c = 0; c < atlas->channels; ++c) px[c] = v;
+            }
+        }
+    }
+
+    hz_free(row_sd);
+    hz_sdf_segments_release(&segs);
+    return HZ_OK;
+}
+
+hz_error_t hz_rasterize_sdf(hz_face_t *face, hz_index_t glyph, hz_rect_t cell,
+                            const hz_glyph_cache_opts_t *opts, hz_bitmap_t *atlas,
+                            struct hz_cache_slot_t *slot)
+{
+    if (!hz_sdf_check_params(face, cell, opts, atlas)) {
+        return HZ_ERROR_INVALID_PARAM;
+    }
+
+    if (slot != NULL) {
+        *slot = (struct hz_cache_slot_t){.id = slot->id};
+    }
+
+    hz_glyph_shape_request_t req;
+    hz_bbox_t bounds;
+    if (!hz_sdf_fit_glyph(face, glyph, cell, opts, &req, &bounds)) {
+        // empty glyph, cell is entirely outside
+        hz_sdf_fill_cell(atlas, cell, 0);
+        return HZ_OK;
+    }
+
+    hz_shape_draw_data_t dd = {0};
+    hz_face_get_glyph_shapes(face, &dd, &req, 1);
+    hz_error_t err = hz_sdf_render_contours(dd.verts, dd.contours, req.contour_count, cell, opts, atlas);
+    hz_shape_draw_data_clear(&dd);
+
+    if (err == HZ_OK && slot != NULL)
+        hz_sdf_write_slot_uv(slot, cell, &bounds, req.scale, atlas);
+
+    return err;
+}
+
+hz_error_t hz_rasterize_sdf_batch(hz_sdf_job_t *jobs, size_t job_count,
+                                  const hz_glyph_cache_opts_t *opts, hz_bitmap_t *atlas)
+{
+    hz_glyph_shape_request_t *reqs = hz_malloc(sizeof(*reqs) * job_count);
+    hz_bbox_t *bounds = hz_malloc(sizeof(*bounds) * job_count);
+    size_t *job_reqs = hz_malloc(sizeof(*job_reqs) * job_count);
+    hz_shape_draw_data_t dd = {0};
+
+    if (reqs == NULL || bounds == NULL || job_reqs == NULL) {
+        hz_free(job_reqs);
+        hz_free(bounds);
+        hz_free(reqs);
+        for (size_t i = 0; i < job_count; ++i) jobs[i].error = HZ_ERROR_OUT_OF_MEMORY;
+        return job_count ? HZ_ERROR_OUT_OF_MEMORY : HZ_OK;
+    }
+
+    // Outlines are fetched up front on this thread, one call per run of jobs sharing a
+    // face, since the face outline caches aren't thread safe.
+    size_t req_count = 0, run_start = 0;
+    hz_face_t *run_face = NULL;
+    for (size_t i = 0; i < job_count; ++i) {
+        hz_sdf_job_t *job = &jobs[i];
+        job_reqs[i] = SIZE_MAX;
+        job->error = HZ_OK;
+
+        if (!hz_sdf_check_params(job->face, job->cell, opts, atlas)) {
+            job->error = HZ_ERROR_INVALID_PARAM;
+            continue;
+        }
+
+        if (job->slot != NULL)
+            *job->slot = (struct hz_cache_slot_t){.id = job->slot->id};
+
+        if (!hz_sdf_fit_glyph(job->face, job->glyph, job->cell, opts, &reqs[req_count], &bounds[i])) {
+            hz_sdf_fill_cell(atlas, job->cell, 0);
+            continue;
+        }
+
+        if (job->face != run_face) {
+            if (req_count > run_start)
+                hz_face_get_glyph_shapes(run_face, &dd, &reqs[run_start], req_count - run_start);
+            run_face = job->face;
+            run_start = req_count;
+        }
+
+        job_reqs[i] = req_count++;
+    }
+
+    if (req_count > run_start)
+        hz_face_get_glyph_shapes(run_face, &dd, &reqs[run_start], req_count - run_start);
+
+    // cells don't overlap so every job writes to its own part of the atlas
+#if HZ_USE_OPENMP
+    #pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (long i = 0; i < (long)job_count; ++i) {
+        if (job_reqs[i] == SIZE_MAX) continue;
+
+        hz_glyph_shape_request_t *req = &reqs[job_reqs[i]];
+        jobs[i].error = hz_sdf_render_contours(dd.verts, dd.contours + req->first_contour,
+                                               req->contour_count, jobs[i].cell, opts, atlas);
+        if (jobs[i].error == HZ_OK && jobs[i].slot != NULL)
+            hz_sdf_write_slot_uv(jobs[i].slot, jobs[i].cell, &bounds[i], req->scale, atlas);
+    }
+
+    hz_shape_draw_data_clear(&dd);
+    hz_free(job_reqs);
+    hz_free(bounds);
+    hz_free(reqs);
+
+    for (size_t i = 0; i < job_count; ++i)
+        if (jobs[i].error != HZ_OK) return jobs[i].error;
+
+    return HZ_OK;
+}
+
 void hz_camera_begin_ortho(hz_context_t *ctx, float l, float r, float b, float t)
 {
     ctx->camera_matrix = hz_mat4_ortho(l,r,b,t);
+    ctx->camera_dirty = HZ_TRUE;
 }
 
 void hz_camera_set_zoom(hz_context_t *ctx, float zoomlvl)
@@ -7471,4 +13507,5 @@ void hz_camera_set_zoom(hz_context_t *ctx, float zoomlvl)
     z.e00 = 1.0/zoomlvl;
     z.e11 = 1.0/zoomlvl;
     hz_mat4_mult(&z, &ctx->camera_matrix, &ctx->camera_matrix);
+    ctx->camera_dirty = HZ_TRUE;
 }
\ No newline at end of file
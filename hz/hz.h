@@ -12,12 +12,14 @@
 #define HZ_MAKE_VERSION(major, minor, patch) (uint32_t)((major<<16)|(minor<<8)|(patch))
 
 #define HZ_VERSION HZ_MAKE_VERSION(0,4,0)
-#define HZ_UCD_VERSION HZ_MAKE_VERSION(5,2,0)
+#define HZ_UCD_VERSION HZ_MAKE_VERSION(15,0,0)
 #define HZ_STRINGIFY(S) HZ_STRINGIFY_(S)
 #define HZ_STRINGIFY_(S) #S
-#define HZ_UCD_HEADER_NAME(major,minor,patch) HZ_STRINGIFY(HZ_UCD_HEADER_NAME_(major,minor,patch))
-#define HZ_UCD_HEADER_NAME_(major,minor,patch) hz_ucd_##major##_##minor##_##patch.h
-#include HZ_UCD_HEADER_NAME(5,2,0)
+#include "hz_ucd_line_break.h"
+#include "hz_ucd_bidi.h"
+#include "hz_ucd_script.h"
+#include "hz_ucd_general_category.h"
+#include "hz_ucd_joining.h"
 
 #define HZ_COMPILER_UNKNOWN 0ul
 #define HZ_COMPILER_GCC 0x00000001ul
@@ -107,11 +109,14 @@
 #   define HZ_ARCH HZ_ARCH_SSE2
 #elif defined(__i386__)
 #   define HZ_ARCH (HZ_ARCH_X86)
+#elif defined(__ARM_ARCH) && (__ARM_ARCH >= 8) && defined(__ARM_NEON)
+#   define HZ_ARCH (HZ_ARCH_ARMV8 | HZ_ARCH_NEON_BIT)
+#   include <arm_neon.h>
 #elif defined(__ARM_ARCH) && (__ARM_ARCH >= 8)
 #   define HZ_ARCH (HZ_ARCH_ARMV8)
 #elif defined(__ARM_NEON)
 #   define HZ_ARCH (HZ_ARCH_ARM | HZ_ARCH_NEON)
-#   include <neon.h>
+#   include <arm_neon.h>
 #elif defined(__arm__) || defined(_M_ARM)
 #   define HZ_ARCH (HZ_ARCH_ARM)
 #elif defined(__mips__)
@@ -176,6 +181,9 @@ typedef uint32_t hz_version_t;
 
 typedef enum {
     HZ_CONFIG_FLAG_DEFAULT,
+    // Coverage, class def, feature and substitution arrays point into the font data and are byte swapped
+    // on access, instead of being copied out when font data is created. The font data must outlive them.
+    HZ_CONFIG_FLAG_TABLE_VIEWS = 1,
 } hz_config_flags_t;
 
 typedef enum {
@@ -271,6 +279,24 @@ memcpy((__ARR) + hz_vector_header(__ARR)->size, __PTR, (__LEN) * sizeof((__ARR)[
 hz_vector_header(__ARR)->size += (__LEN);\
 } while(0)
 
+// appends __LEN uninitialized elements, growing the capacity geometrically
+#define hz_vector_extend(__ARR, __LEN) do {\
+hz_vector_init((void **)&(__ARR), sizeof(*(__ARR)));\
+if (hz_vector_need_grow(__ARR, __LEN)) {\
+hz_vector_grow((void **)&(__ARR), __LEN);\
+}\
+hz_vector_header(__ARR)->size += (__LEN);\
+} while(0)
+
+// replaces __REMOVE elements at __AT with __LEN elements from __PTR
+#define hz_vector_splice(__ARR, __AT, __REMOVE, __PTR, __LEN) do {\
+size_t hz__tail = hz_vector_size(__ARR) - (__AT) - (__REMOVE);\
+if ((__LEN) > (__REMOVE)) hz_vector_extend(__ARR, (__LEN) - (__REMOVE));\
+if (hz__tail) memmove((__ARR) + (__AT) + (__LEN), (__ARR) + (__AT) + (__REMOVE), hz__tail * sizeof((__ARR)[0]));\
+if ((__LEN)) memcpy((__ARR) + (__AT), __PTR, (__LEN) * sizeof((__ARR)[0]));\
+if ((__LEN) < (__REMOVE)) hz_vector_header(__ARR)->size -= (__REMOVE) - (__LEN);\
+} while(0)
+
 #define hz_vector_pop(__ARR) hz_vector_resize(__ARR, hz_vector_size(__ARR)-1)
 #define hz_vector_top(__ARR) (&((__ARR)[hz_vector_size(__ARR)-1]))
 
@@ -354,8 +380,8 @@ typedef enum {
     HZ_DIRECTION_BTT = HZ_FLAG(3)
 } hz_direction_t;
 
-#define HZ_DIRECTION_IS_HORIZONTAL(dir) (hz_bool_t)(dir & 0x3)
-#define HZ_DIRECTION_IS_VERTICAL(dir) (hz_bool_t)(dir & 0xC)
+#define HZ_DIRECTION_IS_HORIZONTAL(dir) (hz_bool)((dir) & 0x3)
+#define HZ_DIRECTION_IS_VERTICAL(dir) (hz_bool)((dir) & 0xC)
 
 typedef enum {
     HZ_OK = 0ul,
@@ -370,6 +396,8 @@ typedef enum {
     HZ_ERROR_SETUP_FAILED                   = HZ_FLAG(8),
     HZ_ERROR_ALREADY_INITIALIZED            = HZ_FLAG(9),
     HZ_ERROR_BROTLI_STREAM_REJECTED         = HZ_FLAG(10),
+    HZ_ERROR_OUT_OF_MEMORY                  = HZ_FLAG(11),
+    HZ_ERROR_LIMIT_EXCEEDED                 = HZ_FLAG(12),
 } hz_error_t;
 
 /*  Enum: hz_glyph_class_t
@@ -428,8 +456,30 @@ typedef enum hz_glyph_attrib_flags_t {
     HZ_GLYPH_ATTRIB_GLYPH_CLASS_BIT      = HZ_FLAG(3),
     HZ_GLYPH_ATTRIB_ATTACHMENT_CLASS_BIT = HZ_FLAG(4),
     HZ_GLYPH_ATTRIB_COMPONENT_INDEX_BIT  = HZ_FLAG(5),
+    HZ_GLYPH_ATTRIB_CLUSTER_BIT          = HZ_FLAG(6),
+    HZ_GLYPH_ATTRIB_FLAGS_BIT            = HZ_FLAG(7),
+    HZ_GLYPH_ATTRIB_FONT_INDEX_BIT       = HZ_FLAG(8),
+    HZ_GLYPH_ATTRIB_JOINING_FORM_BIT     = HZ_FLAG(9),
 } hz_glyph_attrib_flags_t;
 
+/* Enum: hz_glyph_flags_t
+ *      HZ_GLYPH_FLAG_UNSAFE_TO_BREAK - Splitting the text at the start of this glyph's cluster and shaping
+ *                                      both sides separately would give a different result.
+ */
+typedef enum hz_glyph_flags_t {
+    HZ_GLYPH_FLAG_UNSAFE_TO_BREAK = HZ_FLAG(0),
+} hz_glyph_flags_t;
+
+/* Enum: hz_joining_form_t
+ *      Arabic joining form selected for a glyph by its neighbours, zero for glyphs that don't join.
+ */
+typedef enum hz_joining_form_t {
+    HZ_JOINING_FORM_ISOL = HZ_FLAG(0),
+    HZ_JOINING_FORM_INIT = HZ_FLAG(1),
+    HZ_JOINING_FORM_MEDI = HZ_FLAG(2),
+    HZ_JOINING_FORM_FINA = HZ_FLAG(3),
+} hz_joining_form_t;
+
 /* Struct: hz_buffer_t */
 typedef struct {
     size_t                  glyph_count;
@@ -439,6 +489,10 @@ typedef struct {
     uint16_t *              glyph_classes;
     uint16_t *              attachment_classes;
     uint16_t *              component_indices;
+    uint32_t *              clusters; // index of the first source character of each glyph
+    uint8_t *               glyph_flags; // <hz_glyph_flags_t> of each glyph
+    uint16_t *              font_indices; // index of each glyph's font in a <hz_fallback_chain_t>
+    uint8_t *               joining_forms; // <hz_joining_form_t> of each glyph
     hz_glyph_attrib_flags_t attrib_flags;
 } hz_buffer_t;
 
@@ -446,7 +500,8 @@ typedef struct {
 typedef enum hz_shape_flags_t {
     HZ_SHAPER_AUTO_LOAD_FEATURES = HZ_FLAG(0),
     HZ_SHAPER_CULL_MARKS         = HZ_FLAG(1),
-    HZ_SHAPER_CULL_BASES         = HZ_FLAG(2)
+    HZ_SHAPER_CULL_BASES         = HZ_FLAG(2),
+    HZ_SHAPER_NORMALIZE_NFC      = HZ_FLAG(3) // input is composed to NFC before shaping, clusters index the composed text
 } hz_shaper_flags_t;
 
 HZ_DECL hz_error_t hz_init(const hz_config_t *cfg);
@@ -517,6 +572,75 @@ HZ_DECL hz_face_t* hz_font_get_face(hz_font_t *font);
 /* function: hz_font_set_face */
 HZ_DECL void hz_font_set_face(hz_font_t *font, hz_face_t *face);
 
+/*  Struct: hz_variation_t
+ *      The value of a variation axis in the axis' own units, e.g. 700 on 'wght' for a bold instance.
+ */
+typedef struct hz_variation_t {
+    hz_tag_t tag;
+    float value;
+} hz_variation_t;
+
+/*  Struct: hz_variation_axis_t
+ *      A variation axis of a variable font, as declared by its fvar table.
+ */
+typedef struct hz_variation_axis_t {
+    hz_tag_t tag;
+    float min_value;
+    float default_value;
+    float max_value;
+} hz_variation_axis_t;
+
+/*  Function: hz_face_get_variation_axes
+ *      Gets the variation axes of a face.
+ *
+ *  Parameters:
+ *      face - The face.
+ *      axes - Receives the axes, owned by the face.
+ *
+ *  Returns:
+ *      The number of axes, 0 if the font isn't variable.
+ */
+HZ_DECL uint16_t hz_face_get_variation_axes(hz_face_t *face, const hz_variation_axis_t **axes);
+
+#define HZ_COLOR_LAYER_FOREGROUND 0x0001 // the layer takes the text color, scaled by the layer's alpha
+
+/*  Struct: hz_color_layer_t
+ *      A layer of a color glyph, drawn over the layers before it with a CPAL color.
+ */
+typedef struct hz_color_layer_t {
+    hz_index_t glyph;
+    uint16_t flags;
+    uint32_t color_rgba; // packed like the style colors, red in the low byte
+} hz_color_layer_t;
+
+/*  Function: hz_face_get_glyph_color_layers
+ *      Gets the layers a color glyph is drawn with, from the face's COLR table and the first CPAL palette.
+ *      COLRv0 glyphs are supported, as are COLRv1 glyphs made of layers and glyphs filled with solid colors.
+ *      The layers of every glyph are resolved once when the face is loaded.
+ *
+ *  Parameters:
+ *      face - The face.
+ *      glyph - The glyph.
+ *      layers - Receives the layers, bottom first, owned by the face.
+ *
+ *  Returns:
+ *      The number of layers, 0 if the glyph isn't a color glyph.
+ */
+HZ_DECL size_t hz_face_get_glyph_color_layers(hz_face_t *face, hz_index_t glyph, const hz_color_layer_t **layers);
+
+/*  Function: hz_font_set_variations
+ *      Selects the instance of a variable font the font is shaped at. Axes that aren't listed keep their
+ *      default value, values are clamped to the axis range, and an empty list selects the default instance.
+ *      Advances, GPOS deltas and FeatureVariations alternates of an instance are resolved the first time
+ *      it is shaped with, the face keeps the last few instances used.
+ *
+ *  Parameters:
+ *      font - The font, its face must be set.
+ *      count - Number of axis values.
+ *      variations - The axis values.
+ */
+HZ_DECL void hz_font_set_variations(hz_font_t *font, size_t count, const hz_variation_t *variations);
+
 /* function: hz_font_get_glyph_shape */
 HZ_DECL void hz_font_get_glyph_shape(void);
 
@@ -532,7 +656,39 @@ void hz_face_get_glyph_box(hz_face_t *face, uint16_t glyph_id, hz_bbox_t *b);
  */
 HZ_DECL hz_font_t* hz_stbtt_font_create(stbtt_fontinfo *info);
 
-// enum: hz_base85_encoding 
+/*  Function: hz_woff2_get_sfnt_size
+ *      Returns the size of the font a WOFF2 file decodes to, which is enough for <hz_woff2_decode>'s output buffer.
+ *
+ *  Returns:
+ *      The totalSfntSize from the header, or 0 if the data isn't a WOFF2 file or the size is over the decoder's
+ *      limit of 30 MiB of table data.
+ */
+HZ_DECL size_t hz_woff2_get_sfnt_size(const uint8_t *data, size_t size);
+
+/*  Function: hz_woff2_decode
+ *      Decodes a WOFF2 file into a TrueType/OpenType font written to a caller provided buffer, reconstructing the
+ *      transformed glyf, loca and hmtx tables. Font collections aren't supported.
+ *
+ *  Parameters:
+ *      data - The WOFF2 file.
+ *      size - Size of the file in bytes.
+ *      sfnt - Output buffer.
+ *      capacity - Size of the output buffer, see <hz_woff2_get_sfnt_size>.
+ *      sfnt_size - Receives the size of the decoded font.
+ *
+ *  Returns:
+ *      HZ_OK on success, HZ_ERROR_INVALID_PARAM if the buffer is too small, HZ_ERROR_OUT_OF_MEMORY if the
+ *      decoder's scratch can't be allocated, HZ_ERROR_INVALID_FORMAT for malformed or truncated files and
+ *      HZ_ERROR_BROTLI_STREAM_REJECTED for a malformed Brotli stream.
+ */
+HZ_DECL hz_error_t hz_woff2_decode(const uint8_t *data, size_t size, uint8_t *sfnt, size_t capacity, size_t *sfnt_size);
+
+/*  Function: hz_font_load_woff2_from_memory
+ *      Creates a font from a WOFF2 file in memory, the decoded font data is owned by the font.
+ */
+HZ_DECL hz_font_t *hz_font_load_woff2_from_memory(const uint8_t *data, size_t size);
+
+// enum: hz_base85_encoding
 enum hz_base85_encoding {
     HZ_BASE85_ENCODING_ADOBE, HZ_BASE85_ENCODING_Z85, HZ_BASE85_ENCODING_IPV6,
 };
@@ -543,6 +699,7 @@ HZ_DECL hz_font_t *hz_font_load_woff2_from_memory_base85(enum hz_base85_encoding
 
 typedef struct hz_shaper_t hz_shaper_t;
 typedef struct hz_font_data_t hz_font_data_t;
+typedef struct hz_ucd_t hz_ucd_t; // character properties of a UCD version, see hz_ucd_create
 
 /*
  *  Function: hz_shape_sz1
@@ -558,6 +715,119 @@ typedef struct hz_font_data_t hz_font_data_t;
  */
 HZ_DECL void hz_shape_sz1(hz_shaper_t* shaper, hz_font_data_t* font_data, hz_encoding_t encoding, const void* sz_input, hz_buffer_t *out_buffer);
 
+/*  Struct: hz_shaped_text_t
+ *      Paragraph text kept together with its shaped glyphs, so that edits can be reshaped with <hz_reshape_edit>.
+ *      The glyph clusters of buffer are indices into chars.
+ */
+typedef struct {
+    hz_vector(hz_unicode_t) chars;
+    hz_buffer_t buffer;
+    hz_direction_t direction;
+} hz_shaped_text_t;
+
+HZ_DECL void hz_shaped_text_init(hz_shaped_text_t *text);
+HZ_DECL void hz_shaped_text_release(hz_shaped_text_t *text);
+
+/*  Function: hz_shape_text
+ *      Shapes a NUL-terminated string of user-provided character encoding into text, replacing its contents.
+ */
+HZ_DECL void hz_shape_text(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_encoding_t encoding, const void *sz_input,
+                           hz_shaped_text_t *text);
+
+/*  Function: hz_reshape_edit
+ *      Applies an edit to text previously shaped with <hz_shape_text>, reshaping only the characters around it.
+ *      The reshaped span keeps the font's usMaxContext minus one base characters of context on both sides of the
+ *      edit (2 if the font doesn't give it), is widened to the nearest characters the previous shaping flagged as
+ *      safe to break at, then its glyphs are spliced in place of the old ones. The shaper must be set up as it was
+ *      for <hz_shape_text>.
+ *
+ *  Parameters:
+ *      shaper - The shaper.
+ *      font_data - Font data required for the shaper.
+ *      text - The shaped text to edit.
+ *      offset - Index of the first character replaced by the edit.
+ *      deleted - Number of characters removed at offset.
+ *      encoding - Text encoding of sz_inserted.
+ *      sz_inserted - NUL-terminated string inserted at offset, may be NULL.
+ */
+HZ_DECL void hz_reshape_edit(hz_shaper_t *shaper, hz_font_data_t *font_data, hz_shaped_text_t *text,
+                             size_t offset, size_t deleted, hz_encoding_t encoding, const void *sz_inserted);
+
+/*  Struct: hz_line_break_reshape_t
+ *      Glyphs around a line break of a <hz_shaped_text_t>, shaped as if the text was split there. The glyphs of the
+ *      characters first_char up to the break are replaced by before at the end of the line, and the ones from the
+ *      break up to end_char by after at the start of the next line. Both buffers are initialized with
+ *      <hz_buffer_init> by the caller, their clusters are indices into the text.
+ */
+typedef struct {
+    size_t first_char, end_char;
+    hz_buffer_t before, after;
+} hz_line_break_reshape_t;
+
+/*  Function: hz_reshape_line_break
+ *      Reshapes the characters around a line break at character c of text. Like <hz_reshape_edit>, only the span
+ *      between the nearest characters flagged safe to break at around c is shaped again, text is not modified.
+ *      Only needed for breaks falling on a glyph flagged HZ_GLYPH_FLAG_UNSAFE_TO_BREAK, see <hz_line_t>.
+ */
+HZ_DECL void hz_reshape_line_break(hz_shaper_t *shaper, hz_font_data_t *font_data, const hz_shaped_text_t *text,
+                                   size_t c, hz_line_break_reshape_t *out);
+
+/*  Function: hz_shape_auto
+ *      Shapes a NUL-terminated string of mixed scripts and directions without a user shaper. The text is split
+ *      into runs of one script and bidi level, each shaped in the run's direction with the script's default
+ *      features by a shaper that font_data caches per script and language. The glyphs of all runs are joined
+ *      into out_buffer in visual order, with clusters as indices into the whole decoded text.
+ *
+ *  Parameters:
+ *      font_data - Font data used for every run.
+ *      ucd - Character properties of the runs and their shaping, NULL for the newest UCD version.
+ *      encoding - Text encoding of sz_input.
+ *      sz_input - NUL-terminated string.
+ *      dir - Paragraph direction, HZ_DIRECTION_INVALID detects it from the text.
+ *      language - Language every run is shaped in.
+ *      out_buffer - The output buffer, initialized with <hz_buffer_init> and empty.
+ *
+ *  Returns:
+ *      HZ_OK, or HZ_ERROR_OUT_OF_MEMORY if the scratch or a shaper couldn't be allocated, out_buffer then
+ *      holds the runs shaped before the failure.
+ */
+HZ_DECL hz_error_t hz_shape_auto(hz_font_data_t *font_data, const hz_ucd_t *ucd, hz_encoding_t encoding,
+                                 const void *sz_input, hz_direction_t dir, hz_language_t language, hz_buffer_t *out_buffer);
+
+/*  Struct: hz_fallback_chain_t
+ *      Ordered list of fonts to shape text with, each character goes to the first font which maps it to a glyph.
+ *      Every font keeps a bitset of the codepoints its cmap covers, built when it is added.
+ */
+typedef struct hz_fallback_chain_t hz_fallback_chain_t;
+
+HZ_DECL hz_fallback_chain_t *hz_fallback_chain_create(void);
+HZ_DECL void hz_fallback_chain_destroy(hz_fallback_chain_t *chain);
+
+/*  Function: hz_fallback_chain_add_font
+ *      Appends font_data to the end of the chain. The chain doesn't take ownership of it.
+ */
+HZ_DECL void hz_fallback_chain_add_font(hz_fallback_chain_t *chain, hz_font_data_t *font_data);
+
+/*  Function: hz_fallback_chain_find_font
+ *      Returns the index of the first font of the chain covering c, or -1 if none of them do.
+ */
+HZ_DECL int hz_fallback_chain_find_font(const hz_fallback_chain_t *chain, hz_unicode_t c);
+
+/*  Function: hz_shape_fallback
+ *      Shapes a NUL-terminated string with a chain of fonts. The text is split into runs of the first font covering
+ *      each character, combining marks staying with their base if its font covers them, and the runs are shaped
+ *      separately and joined into out_buffer. The font of each glyph is given by the buffer's font_indices.
+ *
+ *  Parameters:
+ *      shaper - The shaper, used for every run.
+ *      chain - The fonts, with at least one font.
+ *      encoding - Text encoding of sz_input.
+ *      sz_input - NUL-terminated string.
+ *      out_buffer - The output buffer, initialized with <hz_buffer_init> and empty.
+ */
+HZ_DECL void hz_shape_fallback(hz_shaper_t *shaper, hz_fallback_chain_t *chain, hz_encoding_t encoding,
+                               const void *sz_input, hz_buffer_t *out_buffer);
+
 typedef enum {
     HZ_CMD_ALLOC,
     HZ_CMD_FREE,
@@ -580,6 +850,8 @@ HZ_DECL void hz_set_allocator_fn(hz_allocator_fn_t allocfn);
 // set the user pointer for the internal allocator.
 HZ_DECL void hz_set_allocator_user_pointer(void *user);
 
+// a font data caches the variation instances it shapes with and the shapers of hz_shape_auto, use one per
+// thread; the face can be shared.
 HZ_DECL hz_font_data_t *hz_font_data_create(hz_font_t *font);
 HZ_DECL void hz_font_data_release(hz_font_data_t *fd);
 
@@ -592,23 +864,76 @@ HZ_DECL void hz_shaper_set_direction(hz_shaper_t *shaper, hz_direction_t directi
 HZ_DECL void hz_shaper_set_script(hz_shaper_t *shaper, hz_script_t script);
 HZ_DECL void hz_shaper_set_language(hz_shaper_t *shaper, hz_language_t language);
 
+// Character properties the shaper's joining forms, fallback runs and reshaping use, NULL for the
+// newest UCD version. ucd must outlive the shaper or be replaced first.
+HZ_DECL void hz_shaper_set_ucd(hz_shaper_t *shaper, const hz_ucd_t *ucd);
+
 HZ_DECL void hz_buffer_init(hz_buffer_t *buffer);
 HZ_DECL void hz_buffer_release(hz_buffer_t *buffer);
 
+// Character properties of one UCD version, a version listed in hz_ucd_versions.h or 0 for
+// HZ_UCD_VERSION. The hz_ucd_* lookups and the algorithms built on them take one, NULL being the
+// newest version, so text of several versions can be handled side by side. An older version's tables
+// are decoded from the differences stored for it, using a few megabytes of scratch while it is done;
+// its general categories, scripts, bidi and line break classes and joining are the ones of that
+// version, while script extensions, mirroring and combining classes stay the newest ones like
+// normalization. Returns NULL if the version isn't available or out of memory.
+HZ_DECL hz_ucd_t *hz_ucd_create(hz_version_t version);
+HZ_DECL void hz_ucd_destroy(hz_ucd_t *ucd);
+
+HZ_DECL uint8_t hz_ucd_combining_class(hz_unicode_t c);
+HZ_DECL hz_general_category_t hz_ucd_general_category(const hz_ucd_t *ucd, hz_unicode_t c);
+
+// Bidi_Mirroring_Glyph of c, the character whose glyph is the mirror image of its own, or c if it
+// has none.
+HZ_DECL hz_unicode_t hz_ucd_mirror(hz_unicode_t c);
+
+typedef enum {
+    HZ_UCD_PROPERTY_GENERAL_CATEGORY, // hz_general_category_t
+    HZ_UCD_PROPERTY_SCRIPT, // hz_script_t
+    HZ_UCD_PROPERTY_BIDI_CLASS, // hz_bidi_class_t
+    HZ_UCD_PROPERTY_LINE_BREAK_CLASS, // hz_line_break_class_t
+    HZ_UCD_PROPERTY_JOINING_TYPE, // n for the hz_joining_type_t flag 1 << (16 + n)
+    HZ_UCD_PROPERTY_JOINING_GROUP, // hz_joining_group_t
+    HZ_UCD_PROPERTY_COMBINING_CLASS,
+} hz_ucd_property_t;
+
+// Looks up property for count codepoints at once, values[i] is the value of chars[i]. All
+// properties share one table, see hz_ucd_properties.h.
+HZ_DECL void hz_ucd_lookup_n(const hz_ucd_t *ucd, const hz_unicode_t *chars, size_t count, hz_ucd_property_t property,
+                             uint8_t *values);
+
+// Normalizes the codepoints of buffer to nf (UAX #15). Text which passes the quick check, such as
+// NFC text below U+0300, is left untouched, otherwise it is rewritten from the segment the check
+// stopped at.
+HZ_DECL void HzBuffero_nf(hz_buffer_t *buffer, hz_normalization_form_t nf);
+HZ_DECL void HzBuffero_nfd(hz_buffer_t *buffer);
+HZ_DECL void HzBuffero_nfc(hz_buffer_t *buffer);
+HZ_DECL void HzBuffero_nfkd(hz_buffer_t *buffer);
+HZ_DECL void HzBuffero_nfkc(hz_buffer_t *buffer);
+
 typedef float hz_float, hz_f32;
 typedef double hz_f64;
 
+typedef enum {
+    HZ_GLYPH_CACHE_PACKING_GRID = 0, // x_cells*y_cells identical cells, slot i is cell i
+    HZ_GLYPH_CACHE_PACKING_SHELF = 1, // glyph sized rects packed on shelves of a few size classes
+} hz_glyph_cache_packing_t;
+
 typedef struct {
     hz_float max_sdf_distance;
     hz_float padd;
     int width, height;
-    int x_cells, y_cells;
+    int x_cells, y_cells; // glyphs are rendered height/y_cells pixels tall in both packings
     int ss_level; // supersampling
     int type; // 0 for sdf, 1 for msdf
+    int packing; // hz_glyph_cache_packing_t
+    int max_glyphs; // slot count when shelf packing, defaults to x_cells*y_cells
 } hz_glyph_cache_opts_t;
 
 
 HZ_DECL hz_rect_t hz_glyph_cache_compute_cell_rect(hz_glyph_cache_opts_t *opts, int cell);
+HZ_DECL float hz_glyph_cache_glyph_height(const hz_glyph_cache_opts_t *opts);
 
 typedef enum {
     HZ_VERTEX_TYPE_MOVETO = 1,
@@ -639,7 +964,8 @@ typedef struct {
 } hz_stencil_vertex_t;
 
 typedef struct {
-    uint16_t first_curve, curve_count;
+    uint32_t first_curve;
+    uint16_t curve_count;
     hz_vec2 origin;
 } hz_contour_t;
 
@@ -652,14 +978,58 @@ HZ_DECL void hz_shape_draw_data_clear(hz_shape_draw_data_t *draw_data);
 
 HZ_DECL int hz_face_get_glyph_shape(hz_face_t *face, hz_shape_draw_data_t *draw_data, hz_vec2 translate, float y_scale, hz_index_t glyph_index );
 
+typedef struct {
+    hz_index_t glyph;
+    hz_vec2 translate;
+    float scale;
+    size_t first_contour, contour_count; // output, the glyph's contours in draw_data
+} hz_glyph_shape_request_t;
+
+// Appends the outlines of many glyphs of a face to draw_data in one call.
+HZ_DECL void hz_face_get_glyph_shapes(hz_face_t *face, hz_shape_draw_data_t *draw_data, hz_glyph_shape_request_t *requests, size_t count);
+
+// Outlines are decoded once and kept unscaled in a per-face cache, least recently used
+// outlines are dropped past max_size bytes (256KiB by default, 0 keeps only the last one).
+// The cache is not thread safe, shapes of a face must be fetched from one thread at a time.
+HZ_DECL void hz_face_set_outline_cache_size(hz_face_t *face, size_t max_size);
+
+// Caller-owned 8-bit atlas bitmap, rows are stored bottom-up like GL textures.
+typedef struct {
+    uint8_t *data;
+    int width, height;
+    int stride; // bytes per row
+    int channels; // 1 for sdf, 3 or 4 for msdf (4th channel gets the true sdf)
+} hz_bitmap_t;
+
+struct hz_cache_slot_t;
+
+typedef struct {
+    hz_face_t *face;
+    hz_index_t glyph;
+    hz_rect_t cell;
+    struct hz_cache_slot_t *slot; // optional, receives the glyph's uv rect
+    hz_error_t error; // output, result of rendering this job
+} hz_sdf_job_t;
+
+// Renders a glyph's signed distance field (or MSDF when opts->type == 1) on the CPU into
+// `cell` of the atlas. The glyph is rendered hz_glyph_cache_glyph_height pixels tall, centered
+// in the cell and shrunk if it doesn't fit inside opts->padd, distances are clamped to
+// opts->max_sdf_distance pixels.
+HZ_DECL hz_error_t hz_rasterize_sdf(hz_face_t *face, hz_index_t glyph, hz_rect_t cell,
+                                    const hz_glyph_cache_opts_t *opts, hz_bitmap_t *atlas,
+                                    struct hz_cache_slot_t *slot);
+
+// Renders many non-overlapping cells, in parallel when built with HZ_USE_OPENMP. Each job gets its own
+// error, the first failed job's error is returned.
+HZ_DECL hz_error_t hz_rasterize_sdf_batch(hz_sdf_job_t *jobs, size_t job_count,
+                                          const hz_glyph_cache_opts_t *opts, hz_bitmap_t *atlas);
+
 
 ///////////////////////// hz_ht_t ////////////////////////////
+// Growable uint32 -> uint32 Robin Hood hash table. The size passed at creation is only
+// a capacity hint, the table resizes itself as entries are inserted.
 typedef struct hz_ht_t hz_ht_t;
 
-#define HZ_HT_EMPTY HZ_FLAG(0)
-#define HZ_HT_OCCUPIED HZ_FLAG(1)
-#define HZ_HT_TOMBSTONE HZ_FLAG(2)
-
 #define HZ_HT_INVALID_INDEX (UINT32_MAX) 
 
 typedef struct hz_ht_t hz_ht_t;
@@ -673,7 +1043,11 @@ typedef struct {
 #define hz_ht_iter_valid(_IT) ((_IT)->index != HZ_HT_INVALID_INDEX)
 
 HZ_DECL void hz_ht_clear(hz_ht_t *ht);
+// Returns NULL if the table can't be allocated.
 HZ_DECL hz_ht_t* hz_ht_create(hz_allocator_t *alctr, size_t size);
+// Same as hz_ht_create but the table and all of its (re)allocations come from an arena,
+// hz_ht_destroy is then a no-op and the memory is reclaimed when the arena is reset.
+HZ_DECL hz_ht_t* hz_ht_create_arena(hz_memory_arena_t *arena, size_t size);
 HZ_DECL void hz_ht_destroy(hz_ht_t *ht);
 HZ_DECL uint32_t hz_ht_next_valid_index(hz_ht_t *ht, uint32_t index);
 HZ_DECL hz_bool hz_ht_iter_next(hz_ht_t *ht, hz_ht_iter_t *it);
@@ -683,6 +1057,11 @@ HZ_DECL hz_bool hz_ht_insert(hz_ht_t *ht, uint32_t key, uint32_t value);
 HZ_DECL hz_bool hz_ht_remove(hz_ht_t *ht, uint32_t key);
 HZ_DECL size_t hz_ht_size(hz_ht_t* ht);
 
+// Byte swap each value of a block in place, as the parser does to the big-endian arrays of a font.
+HZ_DECL void hz_bswap_u16_block(uint16_t *values, size_t count);
+HZ_DECL void hz_bswap_u32_block(uint32_t *values, size_t count);
+HZ_DECL void hz_bswap_u64_block(uint64_t *values, size_t count);
+
 // LRU cache slot
 typedef union { uint32_t u32; struct {
     uint16_t font_id, glyph_id;
@@ -698,23 +1077,74 @@ struct hz_cache_slot_t {
 struct hz_cache_node_t {
     struct hz_cache_node_t *prev, *next;
     uint16_t slot;
+    uint32_t batch; // last resolve batch that referenced this slot
 };
 
+// Shelf packer, the atlas is cut into horizontal shelves whose height is a size class and
+// glyphs are appended left to right on the shelf of their class. Space is only reclaimed by
+// emptying whole shelves, which the glyph cache does in least recently used order.
+typedef struct {
+    int y, h; // h is a size class
+    int x; // fill cursor
+    int used_area; // sum of the areas of the rects on the shelf
+    uint32_t batch; // last resolve batch that referenced a glyph on the shelf
+    hz_vector(uint16_t) slots; // cache slots of the glyphs on the shelf
+} hz_atlas_shelf_t;
+
+typedef struct {
+    int width, height;
+    int top; // y of the next shelf to open
+    hz_vector(hz_atlas_shelf_t) shelves;
+} hz_atlas_packer_t;
+
+HZ_DECL void hz_atlas_packer_init(hz_atlas_packer_t *p, int width, int height);
+HZ_DECL void hz_atlas_packer_release(hz_atlas_packer_t *p);
+HZ_DECL int hz_atlas_size_class(int h);
+// Finds room for a w*h rect without evicting anything, returns the index of the shelf
+// it was placed on or -1.
+HZ_DECL int hz_atlas_packer_alloc(hz_atlas_packer_t *p, int w, int h, hz_rect_t *rect);
+HZ_DECL void hz_atlas_packer_clear_shelf(hz_atlas_packer_t *p, int shelf_index);
+// Joins `count` adjacent shelves into one empty shelf, later shelves move down by count-1.
+HZ_DECL void hz_atlas_packer_merge_shelves(hz_atlas_packer_t *p, int first, int count);
+
 typedef struct {
     // msi hash table for fast lookup into cache
     //hz_msi_ht_t msi;
     // following doubly linked list nodes are stored contiguously for better coherence
     struct hz_cache_slot_t *slots;
+    struct hz_cache_node_t *nodes; // node i owns slot i
     struct hz_cache_node_t *fn, *ln;
+    hz_ht_t *id_ht; // glyph id -> slot index of cached glyphs
+    uint32_t batch;
     int slots_occupied;
     int sz; // size
     int p2sz; // power of two size
     int max_replace_sz; // insert max per batch
+    hz_glyph_cache_opts_t opts;
+    // shelf packing only
+    hz_atlas_packer_t packer;
+    uint16_t *slot_shelf; // shelf holding the glyph of each slot
+    uint16_t *free_slots;
+    int free_slot_count;
 } hz_glyph_cache_t;
 
 struct hz_cache_stat_t{uint16_t avail,unavail;};
 
-HZ_DECL void hz_lru_cache_init(hz_memory_arena_t *ma, hz_glyph_cache_t *c, int sz, int max_replace_sz);
+typedef struct {
+    float fill_ratio; // glyph area / atlas area
+    float fragmentation; // part of the area claimed by shelves that holds no glyph
+    int shelf_count, glyph_count;
+} hz_atlas_stats_t;
+
+HZ_DECL hz_atlas_stats_t hz_atlas_packer_stats(const hz_atlas_packer_t *p);
+// Atlas usage of the cache. With grid packing the glyph sizes aren't known, fill_ratio is
+// then the ratio of occupied cells and fragmentation is left at 0.
+HZ_DECL hz_atlas_stats_t hz_glyph_cache_stats(const hz_glyph_cache_t *c);
+
+HZ_DECL hz_error_t hz_lru_cache_init(hz_memory_arena_t *ma, hz_glyph_cache_t *c, int sz, int max_replace_sz);
+HZ_DECL void hz_lru_cache_release(hz_glyph_cache_t *c);
+// Switches the cache to opts->packing, called by hz_context_create.
+HZ_DECL void hz_glyph_cache_setup_packing(hz_memory_arena_t *ma, hz_glyph_cache_t *c, const hz_glyph_cache_opts_t *opts);
 HZ_DECL void hz_lru_cache_replace_slots(hz_glyph_cache_t *lru, uint16_t slots_sz, uint16_t open_slots[]);
 HZ_DECL struct hz_cache_node_t *hz_lru_cache_get_node(hz_glyph_cache_t *c, hz_cache_id_t id);
 HZ_DECL struct hz_cache_stat_t hz_lru_cache_stat(hz_glyph_cache_t *c, hz_ht_t *ids_ht, hz_cache_id_t *avail_id_list, hz_cache_id_t *unavail_id_list);
@@ -805,29 +1235,75 @@ HZ_ALWAYS_INLINE hz_mat4 hz_mat4_ortho(float l, float r, float b, float t) {
     return m;
 }
 
+// Packed style shared by the glyphs of a hz_draw_buffer call, stored once per frame in
+// the command list's style table.
 typedef struct {
-    hz_mat4 vp;
-    hz_vec4 v4_ts;
-    struct { // style
-        uint32_t color_rgba;
-        uint32_t outline_color_rgba;
-        uint32_t glow_outline;
-        uint32_t weight_sheer;
-    } sv;
+    uint32_t color_rgba;
+    uint32_t outline_color_rgba;
+    uint32_t glow_outline;
+    uint32_t weight_shear;
+} hz_glyph_style_t;
+
+// Instance sizes are stored as 16 bit fixed point with this many steps per unit, so a glyph
+// quad is at most HZ_GLYPH_INSTANCE_MAX_SIZE (just under 4096) units on a side. Larger quads
+// are clamped to it.
+#define HZ_GLYPH_INSTANCE_SIZE_SCALE 16.0f
+#define HZ_GLYPH_INSTANCE_MAX_SIZE (65535.0f / HZ_GLYPH_INSTANCE_SIZE_SCALE)
+// Distinct styles a frame can hold, style indices are 16 bits. Glyphs needing a style past
+// this are not drawn until the next frame.
+#define HZ_MAX_FRAME_STYLES 65536
+
+// Compact per-glyph instance (20 bytes). The view-projection matrix is the same for a
+// whole batch and comes with its hz_frame_result_t.
+typedef struct {
+    float x, y; // bottom left of the quad, in world units
+    uint16_t w, h; // size of the quad, in 1/HZ_GLYPH_INSTANCE_SIZE_SCALE units
     hz_cache_id_t lru_id;
+    uint16_t style; // index into the frame's style table
+    uint16_t slot; // cache slot, written by hz_frame_resolve
 } hz_glyph_instance_t;
 
+// Camera used by the instances from first_instance up to the next range.
+typedef struct {
+    size_t first_instance;
+    hz_mat4 vp;
+} hz_camera_range_t;
+
 typedef struct {
     hz_vector(hz_glyph_instance_t) draw_data;
+    hz_vector(hz_glyph_style_t) styles;
+    hz_vector(hz_camera_range_t) cameras;
     hz_ht_t *unique_glyph_ht;
 } hz_command_list_t;
 
 typedef struct hz_context_t hz_context_t;
 
+// Returns NULL if the context or its caches can't be allocated.
 HZ_DECL hz_context_t *hz_context_create(hz_glyph_cache_opts_t *opts);
 HZ_DECL void hz_context_release (hz_context_t *ctx);
 HZ_DECL void hz_frame_begin(hz_context_t *ctx);
 HZ_DECL void hz_frame_end(hz_context_t *ctx);
+
+typedef struct {
+    // range of the frame's draw_data resolved by this call, ready to draw once
+    // the glyphs below have been rasterized
+    size_t first_instance, instance_count;
+    size_t unique_count;
+    // glyphs newly assigned to a cache slot, these must be rasterized into their slot
+    size_t raster_count;
+    hz_cache_id_t *raster_ids;
+    uint16_t *raster_slots;
+    hz_rect_t *raster_rects; // atlas rect of each slot, to pass to hz_rasterize_sdf
+    hz_mat4 camera; // view-projection matrix of every instance in the range
+} hz_frame_result_t;
+
+// Resolves the cache slot of every glyph instance of the frame in a single pass. Cached
+// glyphs are touched, missing ones get a slot (evicting the least recently used) and are
+// reported for rasterization. Returns HZ_FALSE if the cache could not hold all the unique
+// glyphs of the frame at once, or the camera changed midway, in which case the caller draws
+// the resolved range and calls it again to resolve the next batch. Result arrays live in
+// the frame arena and are overwritten by the next call.
+HZ_DECL hz_bool hz_frame_resolve(hz_context_t *ctx, hz_frame_result_t *result);
 HZ_DECL uint16_t hz_context_stash_font(hz_context_t *ctx, const hz_font_data_t *font);
 HZ_DECL hz_face_t *hz_context_get_face(hz_context_t *ctx, uint16_t font_id);
 HZ_DECL hz_glyph_cache_t *hz_context_get_lru(hz_context_t *ctx);
@@ -846,12 +1322,171 @@ typedef struct {
     float scale;
 } hz_buffer_style_t;
 
-HZ_DECL void hz_draw_buffer(hz_context_t *ctx,
-                            hz_buffer_t *buffer,
-                            uint16_t font_id,
-                            hz_vec3 pos,
-                            hz_buffer_style_t *style,
-                            float px_size);
+// Adds an instance per glyph of the buffer (per layer for color glyphs) to the frame.
+// Returns HZ_ERROR_LIMIT_EXCEEDED if a glyph was larger than HZ_GLYPH_INSTANCE_MAX_SIZE and
+// was drawn clamped, or the frame's style table is full and glyphs were dropped, and
+// HZ_ERROR_OUT_OF_MEMORY if the glyph metrics at px_size can't be allocated.
+HZ_DECL hz_error_t hz_draw_buffer(hz_context_t *ctx,
+                                  hz_buffer_t *buffer,
+                                  uint16_t font_id,
+                                  hz_vec3 pos,
+                                  hz_buffer_style_t *style,
+                                  float px_size);
+
+HZ_DECL hz_bidi_class_t hz_ucd_bidi_class(const hz_ucd_t *ucd, hz_unicode_t c);
+
+#define HZ_BIDI_MAX_DEPTH 125
+
+// A maximal range of characters in logical order with the same embedding level, odd levels are
+// right to left.
+typedef struct {
+    size_t first, count;
+    uint8_t level;
+} hz_bidi_run_t;
+
+typedef struct {
+    uint8_t base_level;
+    uint8_t max_level;
+    size_t char_count;
+    uint8_t *levels; // resolved level of each character, rule L1 applied for the whole paragraph
+    hz_bidi_run_t *runs; // level runs in logical order
+    size_t run_count;
+} hz_bidi_paragraph_t;
+
+// Upper bound of the scratch memory hz_bidi_resolve_paragraph needs for count characters.
+#define HZ_BIDI_SCRATCH_SIZE(count) ((count) * (4 + 7*sizeof(uint32_t) + sizeof(hz_bidi_run_t)) + 12*DEFAULT_ALIGNMENT)
+
+// Resolves the UAX #9 embedding levels of a paragraph in linear time. dir is the paragraph
+// direction, HZ_DIRECTION_INVALID detects it from the first strong character (rules P2, P3).
+// Everything, including the levels and runs of para, is allocated from scratch and is valid until
+// it is reset; nothing is heap allocated. Text without right to left characters, numbers or
+// explicit formatting in a left to right paragraph returns early with a single level 0 run.
+// Returns HZ_FALSE if scratch is too small.
+HZ_DECL hz_bool hz_bidi_resolve_paragraph(const hz_ucd_t *ucd, hz_memory_arena_t *scratch, const hz_unicode_t *chars,
+                                          size_t count, hz_direction_t dir, hz_bidi_paragraph_t *para);
+
+HZ_STATIC HZ_INLINE hz_direction_t hz_bidi_level_direction(uint8_t level)
+{
+    return (level & 1) ? HZ_DIRECTION_RTL : HZ_DIRECTION_LTR;
+}
+
+// Rule L2, fills order with the visual order of count items given their levels, e.g. the runs of
+// a line once they are shaped. Each item is expected to be in visual order itself already.
+HZ_DECL void hz_bidi_reorder(const uint8_t *levels, size_t count, uint32_t *order);
+
+HZ_DECL hz_script_t hz_ucd_script(const hz_ucd_t *ucd, hz_unicode_t c);
+
+// Script_Extensions of c, the scripts it is used with, which is just its script for most
+// characters. Writes up to max scripts and returns how many there are.
+HZ_DECL size_t hz_ucd_script_extensions(const hz_ucd_t *ucd, hz_unicode_t c, hz_script_t *scripts, size_t max);
+
+// A maximal range of characters in logical order written in one script.
+typedef struct {
+    size_t first, count;
+    hz_script_t script;
+} hz_script_run_t;
+
+// Splits text into runs of one script (UAX #24). Inherited characters continue the run they are
+// in, as do characters whose Script_Extensions include the run's script. Common characters join
+// the run before them, or the first run if they start the text, apart from closing brackets which
+// take the script of their opening bracket. Text with no script at all is a single Common run.
+// runs must have room for count runs, returns the number of runs written.
+HZ_DECL size_t hz_itemize_scripts(const hz_ucd_t *ucd, const hz_unicode_t *chars, size_t count, hz_script_run_t *runs);
+
+typedef enum {
+    HZ_LINE_BREAK_NONE,
+    HZ_LINE_BREAK_ALLOWED, // a line may start at this character
+    HZ_LINE_BREAK_MANDATORY, // a line must start at this character
+} hz_line_break_t;
+
+HZ_DECL hz_line_break_class_t hz_ucd_line_break_class(const hz_ucd_t *ucd, hz_unicode_t c);
+
+// Finds the UAX #14 line break opportunities of codepoints in logical order, breaks[i] is the
+// hz_line_break_t before codepoints[i]. As there is no dictionary based segmentation, complex
+// context (SA) characters are combining marks if their general category is Mn or Mc and
+// alphabetic otherwise, so words of Thai, Lao, Khmer or Myanmar text are not broken.
+HZ_DECL void hz_find_line_breaks(const hz_ucd_t *ucd, const hz_unicode_t *codepoints, size_t count, uint8_t *breaks);
+
+typedef enum {
+    HZ_LAYOUT_ALIGN_LEFT    = HZ_FLAG(0),
+    HZ_LAYOUT_ALIGN_RIGHT   = HZ_FLAG(1),
+    HZ_LAYOUT_ALIGN_BOTTOM  = HZ_FLAG(2),
+    HZ_LAYOUT_ALIGN_TOP     = HZ_FLAG(3),
+    HZ_LAYOUT_AUTO_ALIGN    = HZ_FLAG(4),
+    HZ_LAYOUT_JUSTIFY       = HZ_FLAG(5),
+    HZ_LAYOUT_WRAP          = HZ_FLAG(6),
+    HZ_LAYOUT_X_CENTER      = HZ_FLAG(7),
+    HZ_LAYOUT_Y_CENTER      = HZ_FLAG(8),
+    HZ_LAYOUT_BIDI          = HZ_FLAG(9), // items are ordered by their bidi level
+} hz_layout_flags_t;
+
+// A shaped buffer of a paragraph, drawn with font_id at px_size. Buffers shaped right to
+// left are stored in visual order, dir tells the layout to read them backwards. With
+// HZ_LAYOUT_BIDI, level is the item's hz_bidi_run_t level and dir should be
+// hz_bidi_level_direction(level), otherwise items going against the layout direction are reversed.
+typedef struct {
+    hz_buffer_t *buffer;
+    uint16_t font_id;
+    float px_size;
+    hz_direction_t dir;
+    hz_buffer_style_t *style;
+    uint8_t level;
+} hz_layout_item_t;
+
+// Glyphs first_glyph..first_glyph+size of an item's buffer, drawn with the pen at x, y.
+typedef struct {
+    size_t item;
+    size_t first_glyph;
+    size_t size;
+    float x, y;
+} hz_segment_command_t;
+
+typedef struct {
+    size_t first_segment, segment_count;
+    size_t first_char, char_count; // range of the paragraph in logical order
+    float width; // trailing spaces excluded
+    float y; // baseline
+    hz_bool unsafe_break; // the line ends inside a cluster its item flagged unsafe to break
+} hz_line_t;
+
+// Paragraph layout. sx, sy is the baseline origin of the first line and lines go down. With
+// HZ_LAYOUT_WRAP lines are broken to fit max_length, alignment and justification are relative
+// to max_length, or to the widest line if it's 0. v_advance is the distance between baselines,
+// 0 uses the line height of the fonts. ucd gives the line break classes, NULL for the newest version.
+typedef struct {
+    hz_direction_t dir;
+    hz_layout_flags_t flags;
+    float sx, sy, max_length;
+    float v_advance;
+    const hz_ucd_t *ucd;
+    hz_vector(hz_segment_command_t) segments;
+    hz_vector(hz_line_t) lines;
+
+    // scratch kept between builds
+    hz_vector(hz_unicode_t) chars;
+    hz_vector(float) pos; // pen position before each character
+    hz_vector(uint8_t) breaks;
+    hz_vector(size_t) item_offsets;
+    hz_vector(size_t) pieces;
+    hz_vector(uint8_t) piece_levels;
+    hz_vector(uint32_t) piece_order;
+    hz_vector(size_t) ordered_pieces;
+} hz_line_layout_t;
+
+HZ_DECL void hz_line_layout_init(hz_line_layout_t *layout, hz_direction_t dir, hz_layout_flags_t flags,
+                                 float sx, float sy, float max_length);
+HZ_DECL void hz_line_layout_release(hz_line_layout_t *layout);
+
+// Breaks the items into lines and positions them as segments. The items are only read, they
+// are not reshaped: a line whose break falls on a glyph flagged HZ_GLYPH_FLAG_UNSAFE_TO_BREAK
+// is marked unsafe_break, the glyphs around that break can be shaped apart with
+// hz_reshape_line_break. Runs in time linear in the glyph count.
+HZ_DECL void hz_line_layout_build(hz_context_t *ctx, hz_line_layout_t *layout,
+                                  const hz_layout_item_t *items, size_t item_count);
+
+// Draws every segment with hz_draw_buffer, returns the first error it reported.
+HZ_DECL hz_error_t hz_draw_line_layout(hz_context_t *ctx, const hz_line_layout_t *layout,
+                                       const hz_layout_item_t *items);
 
 HZ_DECL void hz_camera_begin_ortho(hz_context_t *ctx, float l, float r, float b, float t);
 
@@ -1708,7 +1708,16 @@ typedef enum hz_script_t {
     HZ_SCRIPT_CHORASMIAN,
     HZ_SCRIPT_DIVES_AKURU,
     HZ_SCRIPT_KHITAN_SMALL_SCRIPT,
-    HZ_SCRIPT_YEZIDI
+    HZ_SCRIPT_YEZIDI,
+    HZ_SCRIPT_CYPRO_MINOAN,
+    HZ_SCRIPT_OLD_UYGHUR,
+    HZ_SCRIPT_TANGSA,
+    HZ_SCRIPT_TOTO,
+    HZ_SCRIPT_VITHKUQI,
+    HZ_SCRIPT_KAWI,
+    HZ_SCRIPT_NAG_MUNDARI,
+    HZ_SCRIPT_UNKNOWN,
+    HZ_SCRIPT_COUNT
 } hz_script_t;
 
 /* Arabic joining */
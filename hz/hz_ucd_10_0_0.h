@@ -1,945 +0,0 @@
-#ifndef HZ_UCD_10_0_0_H
-#define HZ_UCD_10_0_0_H
-
-#include <stdint.h>
-
-#define HZ_UCD_VERSION HZ_MAKE_VERSION(10,0,0)
-
-typedef enum {
-    HZ_JOINING_TYPE_C = 1 << 16,
-    HZ_JOINING_TYPE_D = 1 << 17,
-    HZ_JOINING_TYPE_L = 1 << 18,
-    HZ_JOINING_TYPE_R = 1 << 19,
-    HZ_JOINING_TYPE_T = 1 << 20,
-    HZ_JOINING_TYPE_U = 1 << 21,
-} hz_joining_type_t;
-
-typedef enum {
-    HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_GROUP_E,
-    HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_GROUP_FE,
-    HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_GROUP_HE,
-    HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_GROUP_PE,
-    HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_GROUP_REH,
-    HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_GROUP_HAMZA_ON_HEH_GOAL,
-    HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_GROUP_ZHAIN,
-} hz_joining_group_t;
-
-static int32_t hz_ucd_arabic_joining_k2[612] = {
-       1,  -3,   0,   1,  10,   1,
-     -25,   0,   8,   2,   1, -46,
-       0, -97,   1,   0,-149,-150,
-       2,   0,-173,-176,   0,-191,
-      10,   0,   0,   0,   0,   0,
-       0,   6,   1,-249,   1,   0,
-    -265,-269,-346,   0,   0,   0,
-       0,   1,   0,-401,   0,   1,
-       6,-406,   2,   1,   4,   1,
-       1,   0,-419,   3,   0,   0,
-       1,-445,   0,   0,   4,   0,
-    -475,   0,   0,-511,   4,-521,
-    -536,   0,   1,-540,-547,   0,
-    -597,  16,-588,   0,   0,   3,
-       1,   0,   0,   0,   3,   0,
-       0,   0,-458,   0,   5,   0,
-       0,   2,-409,   0,   0,   0,
-       3,   0,   0,   1,   0,   1,
-       3,-266,   0,   4,   5,   1,
-    -261,-259,   0,-238,   1,   2,
-       1,-228,-217,   1,-212,-202,
-       4,   1,   0,   4,-187,-182,
-       0,   0,   3,   0,   0,   0,
-       2,   0,-148,   1,   1,-143,
-       2,   0,   1,   0,   0, -84,
-       0,   0,   1,   0,   0,   5,
-       8,   0, -29,   0, -13, -10,
-      -2,   0,   5, -11,   0,   7,
-     -19, -20, -21, -24,   4,   1,
-       0,   0, -36,   0,   0,   0,
-       7,   1, -54,   7, -63, -65,
-       0, -72,   0, -75,   1,   0,
-       1,   0,   3, -85,   0,   0,
-     -89,   0,   0, -93, -94,   0,
-       0, -98,-103,   5,-108,   0,
-    -110,   0,   1,-117,   0,-123,
-       1,-127,-129,   0,   0,-140,
-       3,   0,   4,   0,   0,   1,
-      10,-159,   3,  10,   0,-170,
-       1,-174,-175,   6,   2,   0,
-       2,   0,-193,-196,   0,   0,
-       7,   4,-203,-204,   0,   9,
-       1,   0,   0,   1,   0,-235,
-       5,   0,-241,-242,   2,-244,
-    -246,   0,   0,-254,   6,  11,
-       1,   1,   0,   0,   0,-278,
-    -280,-281,   0,-290,-292,-295,
-       0,   0,-302,   0,-310,   0,
-    -321,-323,-325,   0,   0,   0,
-       0,-339,   1,-342,   0,   1,
-    -350,-356,   0,-362,-367,   3,
-       0,-375,   4,   0,   0,   3,
-       0,-394,   1,   0,   0,-407,
-    -408,   2,   9,   0,-417,   0,
-       0,-435,   0,   0,   1,   2,
-    -449,   0,   0,-456,   0,   1,
-       0,-465,   0,   1,   1,-478,
-    -484,   0,-490,-491,   1,   0,
-       0,   1,-508,   0,   2,   1,
-       0,   0,-523,-524,-528,   0,
-       0,   0,-544,   0,-556,-557,
-       1,-562,   1,-565,   0,   0,
-    -581,   2,-591,-593,-594,   0,
-       2,   0,-600,   0,   0,-607,
-       0,-603,   0,-598,   2,-596,
-    -568,-567,   0,   0,-563,-561,
-       1,   5,   3,   0,   1,   0,
-    -534,   5,-516,   0,-514,   2,
-       0,-509,-504,   0,   0,   0,
-    -502,   1,   0,-496,   0,   0,
-       3,-495,-489,   1,   1,-472,
-       0,   0,   5,-471,-462,-457,
-       1,   0,-454,   0,   0,-453,
-       1,-441,-440,   0,   0,-437,
-       0,   0,   3,-422,   0,   4,
-       0,   1,-415,-414,   2,   1,
-       1,-403,   2,-387,-382,   1,
-       3,-379,   0,-378,   0,   0,
-    -377,   0,-371,   0,   0,-370,
-       1,   0,-360,   1,   2,   0,
-       0,   4,-345,   0,-341,-337,
-    -336,-333,-331,-312,   0,   0,
-    -308,-298,-296,-289,-274,   0,
-    -272,   0,   3,   3,-253,   1,
-       3,   0,   0,-243,   0,-239,
-       0,   0,   2,   0,   0,   0,
-       1,   0,   0,   1,   7,-233,
-    -227,-223,  14,-207,-200,   3,
-    -199,-198,   0,   1,-186,   2,
-       0,   0,   1,   0,   4,-163,
-       2,-162,-161,-153,-151,   0,
-       1,   2,   0,-145,   0,-137,
-    -133,   0,   0,-124,-120,   0,
-       6,-116,-115,-109,-105,   0,
-       3, -96, -92,   0, -90,   0,
-       0,   0, -87, -86, -82, -81,
-       0, -78, -77, -74,   0,   0,
-       1,   0, -66, -59,   0, -51,
-       0,  11,   0,   0, -44, -38,
-     -37, -34,   0,   0,   0,   1,
-       0,   0, -33,   7,   0,   0,
-     -12,   4,  21,   0,-602,   0,
-};
-
-static uint32_t hz_ucd_arabic_joining_ucs_codepoints[612] = {
-      125242,    1539,    6279,    1569,    2210,    1838,
-      125187,    2125,    2130,    1701,    1836,    1811,
-        1896,    1787,    1686,   68317,    2148,    1834,
-        6240,    1657,    2020,    1997,    1665,  125226,
-        1824,  125239,    6222,    6190,    1735,    1588,
-        1719,    1817,    2016,   68304,    1882,    6210,
-       68493,    6247,    6243,    2221,    1684,    6181,
-        1681,    6208,    2129,    1605,    2121,  125200,
-        6306,    6209,    6221,    1662,  125186,    6244,
-        6274,    1890,  125236,    1599,   68321,    1812,
-        1740,    2003,    6263,    1718,    2117,    6158,
-       68288,    1593,    1884,    6304,    2211,   68490,
-      125220,    1689,    6309,   68495,    1791,    2024,
-        1683,  125193,  125230,    2231,    1723,    6251,
-        6179,    1609,  125221,    2124,    2022,  125196,
-        1664,    1904,    1691,    2213,   68303,  125224,
-        1658,  125192,    6282,    6248,    6276,    1685,
-        6188,    1671,    1698,    1830,    2128,    6257,
-        8296,    2230,    6292,    2152,    1894,   68484,
-        2236,   68289,    1903,    1711,  125248,    6290,
-        1818,    6277,    2228,    1673,    6310,    1598,
-        1676,    1891,    2010,    2007,    1734,  125210,
-        1589,   68301,    6212,  125222,    1586,  125201,
-        1738,    1816,   68488,    1907,    1872,    2224,
-       68489,    1730,  125191,    1568,    2042,  125240,
-       68335,    6234,    6219,    1577,    1871,    6226,
-        1732,    1876,    1999,    2120,    1536,   68290,
-        2144,    1584,    1587,    6220,    1887,    1581,
-        6303,   68316,    1917,    1674,    6154,    6253,
-       68331,    1825,    2227,    1833,  125250,   68295,
-        6205,    6281,  125232,    6284,    1540,    6197,
-        2025,    1835,    1901,    1591,   68322,  125233,
-        2274,    1583,  125197,    6202,   68524,    1906,
-        8297,    6180,    1709,    1570,   68334,    2218,
-        1810,    1682,    6245,  125204,    2219,    6193,
-        1602,    6191,    6294,    6249,    1908,  125241,
-       68296,  125218,    6224,    1832,    2150,   68333,
-        6312,    1788,    1656,    1874,    6280,  125237,
-      125231,    1690,    1715,    1717,    1745,    1869,
-        6189,  125199,    1576,    2006,   68306,    2015,
-        2233,    6275,    6246,    1696,    1747,    6297,
-      125195,    2217,    1600,  125185,    1837,    1579,
-      125194,    1646,    1724,    1911,    1808,    1820,
-        6260,   68497,  125251,    1695,    1678,    6238,
-        6203,    1707,    1580,    1729,    1826,    1914,
-        1722,    6236,    1606,    6250,  125217,    1667,
-       68526,   68313,   68332,    1827,    1582,    6151,
-      125202,    2131,    1897,    1998,  125229,    1731,
-        6237,    1915,    2009,    1708,    1590,    6299,
-        1595,    1572,   68480,    6186,    8205,    2012,
-        2145,    1694,    1873,    6196,    2119,    1654,
-        6218,    6182,    2220,    6302,  125207,    2136,
-       68482,    1670,    1870,   68483,    6233,    1538,
-        1679,    1702,    1655,    6207,    2214,  125212,
-      125223,   68308,    1700,    2018,  125228,    1823,
-        6200,   68496,    1741,    1575,    1892,    1726,
-        2021,    2226,    1757,    1774,  125214,    1878,
-        1819,    6223,    1571,    2115,    1652,    2019,
-        1742,    1544,    2237,    1710,    1541,    6201,
-       68492,    1814,    1677,  125235,    6252,    6262,
-        1716,    1775,   68315,    1608,   68523,    6176,
-      125234,    6314,    1668,    6216,    6187,    2004,
-       68318,    1829,    1669,    6291,    6213,    1692,
-        1828,    1713,    1675,    2014,    1706,  125225,
-        1666,    1910,    6150,  125205,    2122,    6288,
-        1749,    2216,    1728,    1815,    2208,    1712,
-       68314,    6183,    1880,  125189,    6272,   68305,
-        2013,    6301,    1649,    1573,    1703,    6229,
-        6296,    6287,    2132,   68312,   68291,    2234,
-      125208,    2026,    1687,    2147,    6235,    1877,
-        6178,    2118,    1875,    1733,    1822,    1888,
-        1699,    1881,    6217,    1574,    2001,  125213,
-        2134,    1704,   68293,   68320,    6211,  125211,
-        1905,    2023,    1737,    6286,    1610,  125203,
-       68521,    1603,    1578,    6242,    6232,    2008,
-        1786,    6298,    1913,    6283,    1663,  125198,
-        1879,    6307,    6192,    2215,    1705,    1918,
-        6311,    6198,    2222,  125184,    6241,    1743,
-        2209,   68525,    1661,    2123,  125244,   68297,
-       68307,  125216,   68299,    1680,    1916,    2114,
-        2017,    1893,    1831,    6184,    1537,   68298,
-       68486,  125219,    1746,   68311,    1650,    6256,
-        6225,    1995,  125227,   68487,    1813,    6308,
-        6199,    1714,    2126,    1596,    1651,   68300,
-        2146,    1898,    6228,  125188,  125249,    6300,
-      125209,  125238,    1821,    6195,  125215,    1725,
-        1744,    6206,    1647,    1909,    1895,    6227,
-        6215,    2225,    1900,    1653,    6214,    6255,
-        2127,    1899,    1592,  125245,    1886,    2000,
-        6204,    2116,    1919,    2154,    1736,    6258,
-       68527,    1594,    2212,    1720,    2005,  125190,
-        6185,    2113,   68310,    1659,    6254,    2011,
-        6194,   68522,    2149,    6305,   68324,    2112,
-      125246,    6285,    1889,    1693,    6230,    6177,
-        1597,    1839,    6273,    1996,    1604,    1721,
-        1585,    2133,    6278,    1660,   68309,    2235,
-       68292,    1697,   68494,  125206,    1902,    6295,
-       68319,  125243,    1885,    2223,    2232,  125247,
-        1601,    2151,    1912,    6289,    1547,    1727,
-       68294,   68323,    6261,    1607,    1739,    1672,
-        1883,    2153,    6239,    6293,    1688,    6231,
-       68481,    2002,   68302,    2135,    6259,    1994,
-};
-
-static uint32_t hz_ucd_arabic_joining_data[612] = {
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZHAIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_E,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_HE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-};
-
-#endif /* HZ_UCD_10_0_0_H */
\ No newline at end of file
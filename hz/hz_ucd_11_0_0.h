@@ -1,1032 +0,0 @@
-#ifndef HZ_UCD_11_0_0_H
-#define HZ_UCD_11_0_0_H
-
-#include <stdint.h>
-
-#define HZ_UCD_VERSION HZ_MAKE_VERSION(11,0,0)
-
-typedef enum {
-    HZ_JOINING_TYPE_C = 1 << 16,
-    HZ_JOINING_TYPE_D = 1 << 17,
-    HZ_JOINING_TYPE_L = 1 << 18,
-    HZ_JOINING_TYPE_R = 1 << 19,
-    HZ_JOINING_TYPE_T = 1 << 20,
-    HZ_JOINING_TYPE_U = 1 << 21,
-} hz_joining_type_t;
-
-typedef enum {
-    HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_GROUP_E,
-    HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_GROUP_FE,
-    HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_GROUP_HE,
-    HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_GROUP_PE,
-    HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_GROUP_REH,
-    HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_GROUP_HAMZA_ON_HEH_GOAL,
-    HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_GROUP_ZHAIN,
-} hz_joining_group_t;
-
-static int32_t hz_ucd_arabic_joining_k2[675] = {
-      23,  -6, -12,   5,   0, -22,
-     -24,  12,   1,   0,   0,   1,
-     -86,   0,   0,   2,   0, -89,
-     -91,   2,   0, -96,-108,-131,
-    -139,   0,-163,   2,   0,-190,
-       0,-211,-217,   0,   1,   0,
-    -244,   0,   2,   0,   1,   3,
-    -301,-360,   1,   1,-366,-425,
-    -427,   0,-456,-479,   2,   2,
-       6,-486,   0,   0,-554,-562,
-       0,   0,-593,   0,   0,   0,
-       1,-636,   1,-643,   0,   1,
-    -673,   2,   0,   1,-672,   1,
-    -659,-645,   0,   3,   3,   2,
-       0,   0,   4,   0,   4,   0,
-       1,   0,   0,   0,-565,   3,
-    -534,   6,   0,-514,   3,-511,
-       1,   3,-488,-468,   0,   3,
-       1,   0,   5,   0,   0,   4,
-       3,   0,   0,-412,-410,   1,
-    -407,-399,-385,   0,-341,-338,
-    -319,   0,   0,   0,-249,-245,
-       2,-231,-226,   1,-203,   1,
-       2,-196,-178,   0,-170,   0,
-       3,   0,   0,-133,   2,   0,
-    -124,   1,-117,   6,-112,   1,
-       4,   0,-104,-101, -98, -94,
-       3,   2,   0, -90, -75, -72,
-     -62, -57,   0,   1,   0,   5,
-       0,   0,   9,   0,   0,   0,
-      -3,   3,  -7,   0,   0,  13,
-       3,   0,   6, -28, -33,   3,
-     -36,   2, -46,   0, -55,   2,
-     -61,   2,   0,   0, -71,   8,
-      14, -76, -77,   0, -82, -85,
-       0, -88,   0,   3,   1,   0,
-       1,   0,   5,   0,   6,   5,
-    -105,   0,   0,  11,   3,   4,
-       0,   0,   0,   3,-126,   2,
-       6,   0,   0,   1,-146,-148,
-    -150,   2,   1,-157,   0,   0,
-       0,   0,-169,   1,-171,-172,
-    -173,   3,-177,   1,   0,-183,
-    -186,   0,   0,   0,-195,   2,
-    -199,   1,-209,-210,   0,-212,
-       0,-216,   0,   0,   1,   5,
-    -235,-239,   0,   0,   2,-246,
-       0,   1,-251,-252,   1,-260,
-    -261,   0,   1,   0,-273,-274,
-       0,-276,   0,-284,-295,-297,
-       1,   0,   0,   0,   1,-320,
-       0,   0,   0,-326,-331,   0,
-       1,-339,   1,   0,-351,   2,
-       0,   0,-357,-359,   0,   0,
-       0,   0,   0,   0,-381,-382,
-    -383,   3,   0,-390,   0,-394,
-    -396,  10,   0,   0,   4,   2,
-       5,-415,   0,   0,-419,   0,
-       1,   1,-433,-434,-435,   0,
-       0,   2,-442,-443,   0,   3,
-       5,   0,   0,-458,   0,-462,
-       2,   2,-472,   0,-475,-478,
-       0,   0,-487,   2,   0,-490,
-    -494,-500,-502,-506,-509,   3,
-       6,   0,   0,   1,   0,   3,
-    -537,   0,   0,   0,-549,   0,
-       0,   0,   0,   1,   0,   0,
-       0,-585,-588,   2,   3,   1,
-       1,   0,   0,   1,   3,   0,
-    -618,   0,-622,-624,   0,   0,
-       0,   0,   0,   9,   3,   3,
-       0,   0,   0,   0,-658,   1,
-       0,-665,-669,-670,   1,   1,
-       0,   0,-675,   0,   0,   2,
-       0,-662,   0,-656,   1,-650,
-       0,-648,   0,   0,   0,   1,
-    -640,-639,   0,   5,   1,-633,
-    -631,   0,-628,   0,   1,-621,
-    -614,-610,-608,   0,   0,   0,
-       0,-606,   0,-604,-599,-595,
-       0,   0,   0,   6,   6,-591,
-       1,   0,-582,-568,   0,-567,
-       1,-564,   1,   1,-550,   1,
-    -548,   1,   0,   0,-542,   0,
-       0,-538,-526,-522,   0,-520,
-       0,   0,-515,-489,   1,   1,
-    -473,-467,-459,-457,   2,   0,
-    -450,-446,   1,-444,-441,-438,
-    -437,   1,-426,   1,-418,-416,
-    -406,-400,-391,-387,   0,-374,
-    -367,   1,-365,   0,-363,   2,
-    -355,   0,-354,   0,-352,-345,
-    -335,-325,   0,   0,-323,   0,
-       0,   0,-321,-304,   0,   0,
-    -303,   1,-299,-277,   0,-275,
-       0,-272,   3,   0,   0,-269,
-       0,-268,   6,-253,-248,   0,
-       1,   0,   1,   0,   0,   1,
-    -241,   0,   0,   0,-224,   4,
-    -213,   0,   5,   0,-191,   1,
-       2,-187,-180,   1,   0,   0,
-    -174,   0,   2,   0,   0,-161,
-       0,-160,   0,-159,-155,   1,
-       0,-153,-142,-141,   1,   0,
-       1,-123,-120,-118,   0,-110,
-       1,-107,-100,   4,   0,   2,
-       0, -92,   3,   2,   2,   0,
-       1,   0,   0,   9,   0,   1,
-     -80, -66, -64,   0,   0,  13,
-     -52,   0, -40,   0, -35,   0,
-       0,   0,  14,   2, -23,   8,
-     -17, -15,   0,   1,   0,   2,
-       1,-647,   9,
-};
-
-static uint32_t hz_ucd_arabic_joining_ucs_codepoints[675] = {
-      125202,    6234,    1607,   69444,    1590,    1602,
-        2123,    2022,  125219,    1731,   68874,   68331,
-        1676,    6289,    1708,    1707,   68489,    2008,
-      125186,    1704,    6224,    1837,    1706,  125242,
-        2232,    1692,    2116,    2002,    1683,    1816,
-        2147,    1701,    6257,   68482,    2024,   68883,
-        1718,    1911,   68317,   68524,    2214,   69441,
-       68493,    6150,    1724,    6277,   68884,    1891,
-        6256,    6212,    6290,  125204,    2121,    2218,
-        1721,   69430,    6302,    6306,   68296,   68879,
-        2009,   68295,    1605,   69445,  125235,    6279,
-        2005,   69426,    1667,   68297,    6259,    6194,
-      125199,    2126,    1881,  125231,   68871,    2042,
-        1872,    1596,   68288,    6195,   68527,    1739,
-        2219,    1825,    6243,    2220,    6304,    1908,
-      125203,   69460,    1717,    1604,    1690,    2230,
-      125209,    2013,    2122,  125232,    1821,    6272,
-        1666,    2150,    2118,    6196,   68878,    6180,
-        6230,    1882,   68298,   68488,    1775,   68320,
-        6199,    1824,    1570,    1600,  125245,    6215,
-       68318,    1665,    1675,    1547,    1839,    6299,
-       68314,    6298,    1539,    6281,   68868,  125198,
-       68487,   68307,   69428,    6190,    2210,    1587,
-        1722,   68483,   68321,   69424,    1749,    6293,
-        1572,   69431,    6247,    1709,    6176,    1581,
-        6158,    6186,    1660,   69459,    6185,  125191,
-       68332,    2133,    2128,    1729,    2217,    1696,
-        6296,    6285,    1700,    6300,    2233,   68313,
-        1694,    6191,    1757,   68888,    8205,    6297,
-        1657,    1714,    2134,   68309,    2115,    1887,
-        6231,    6287,    1774,    1919,    2132,    1593,
-        1687,    1689,  125241,   68523,  125195,   69437,
-        6283,  125228,  125189,    1541,    1819,    6253,
-        6258,    1599,    1820,    2000,   68889,    2015,
-       68481,    2021,    6193,    1918,    2026,  125187,
-        1592,   68312,    6203,    6276,    1732,   69442,
-        1576,    1713,    2215,    6305,    1679,   68484,
-        6219,    2231,    6222,  125222,    6244,    6216,
-      125246,  125239,    1736,    1682,    6252,    1813,
-        1892,   69458,   68492,    1875,    1896,   69434,
-        1902,    1835,    1656,    6151,    1788,   68291,
-        1697,   69435,    1807,  125196,    1786,    2007,
-        1606,  125237,    6214,    1996,    1878,  125247,
-        1895,    1699,    2151,    6200,   68294,    6235,
-        6263,    6246,   68310,   68893,    1588,   69837,
-       68875,    6223,   68886,   68866,   68292,    1693,
-        1594,  125211,    1655,   68316,  125226,    1743,
-        1738,    2006,   68522,   68891,  125210,   68299,
-        2144,    1836,    2004,  125229,    1899,    1913,
-      125217,    1668,    1723,    6254,  125233,    1900,
-        2011,    1810,  125251,    2012,    2209,    1579,
-        1695,    1688,    2228,   68525,    6260,    2019,
-        1678,    1670,    2127,  125230,    1659,   68289,
-        1674,    2274,    2236,    1583,    6239,   68895,
-        1608,    6229,    8296,    1685,    1834,  125227,
-        1828,    1664,    1712,    1999,    1691,  125218,
-        1589,    1817,    6255,    1833,   68521,    6209,
-        1591,  125248,   68311,    2221,    1728,    6210,
-        1609,    1884,    6292,   68864,   69443,  125240,
-        1646,    1740,    6201,    1703,    6182,   68867,
-        2025,    1886,    6273,   69457,    6284,    6206,
-        6280,    2114,  125243,   69821,   68319,    1536,
-        2152,    2020,  125197,  125200,  125225,   68480,
-        2010,   68885,    6278,    1568,    2225,    6154,
-       68897,    2014,    1585,    6274,    6262,    1597,
-        6205,    1673,    1741,    2145,   68324,    1650,
-      125214,    1705,    1662,    1916,    6187,    6245,
-        6192,   69433,    1897,    1671,    1811,    1610,
-       68876,    1681,    6295,    1915,    1818,    6282,
-       68304,   68486,    2153,   68293,    2017,    1909,
-        2125,    6188,    1663,   68334,    1830,  125216,
-        1823,    2235,    1880,    1808,    2119,    1838,
-       69427,  125213,    1826,   68308,    1877,    2117,
-        1726,    6237,    2154,    2146,    6311,    6236,
-        1737,    1734,    6309,    1917,    1684,    6248,
-       68882,    6184,   68887,    6218,  125215,   68300,
-        6183,    2136,    6225,    6227,    2208,   68881,
-        6220,    1888,    1873,    6250,    2222,    2227,
-        1711,    1747,   68890,   68872,    1905,    1890,
-        1719,    1715,    2129,    6307,  125193,   68315,
-       69436,    1538,    2023,    1894,    1649,    6197,
-        1574,   68306,    6202,  125188,    1580,    1577,
-        2211,  125220,    1885,    1998,    1745,    6312,
-      125249,   68290,  125238,  125208,    1889,    6314,
-       68303,    1716,   68490,  125184,    6301,    6181,
-        1672,    6275,    6226,   68898,    1680,    1901,
-        6291,    6238,    1647,    1829,   69438,    1544,
-        1586,    1595,    1654,    1720,   68877,    6294,
-       68333,    2001,   68496,   69425,    2212,    6232,
-        8297,   68322,    1702,    1601,  125192,    2112,
-        6189,    1815,   68305,   68323,  125221,    2149,
-       68899,    1742,    1652,    2226,  125212,    6288,
-        2135,   68301,    1725,   68870,   69429,    1727,
-      125223,   68865,    1710,    1735,    1746,  125224,
-        6177,    6211,    2018,    6178,    6233,    1651,
-      125205,    1893,    6228,    1879,    2113,    6261,
-        1914,    1658,   68494,    1582,    2131,    6221,
-        6217,    1995,    6264,    2213,    1787,    1871,
-       68302,   68869,    1578,    6207,    1831,  125206,
-       68873,    1653,    1571,    1698,    1669,  125234,
-      125201,    1904,    1870,    1603,    1907,    1822,
-        1903,    1874,    6179,  125244,    1744,    6241,
-        1827,    1575,    2120,    1569,    1869,    6310,
-        1997,   69439,    2237,    1791,   68880,    1598,
-      125194,    1912,    1733,   68495,    6251,    2130,
-        2003,    1584,    6198,    1730,   68335,    1814,
-        2124,    1537,    2148,  125190,    1686,    6249,
-        6240,    6208,   68497,   69432,    1906,    1540,
-        6242,    2016,    1573,    6204,    2216,  125250,
-        2234,    2224,    1994,    1876,    1677,  125236,
-        6286,  125185,    1832,    6303,  125207,    1812,
-        6213,   68526,    1898,    1883,    1910,   68892,
-        2223,    1661,    6308,
-};
-
-static uint32_t hz_ucd_arabic_joining_data[675] = {
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_E,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_HE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZHAIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-};
-
-#endif /* HZ_UCD_11_0_0_H */
\ No newline at end of file
@@ -1,1033 +0,0 @@
-#ifndef HZ_UCD_12_0_0_H
-#define HZ_UCD_12_0_0_H
-
-#include <stdint.h>
-
-#define HZ_UCD_VERSION HZ_MAKE_VERSION(12,0,0)
-
-typedef enum {
-    HZ_JOINING_TYPE_C = 1 << 16,
-    HZ_JOINING_TYPE_D = 1 << 17,
-    HZ_JOINING_TYPE_L = 1 << 18,
-    HZ_JOINING_TYPE_R = 1 << 19,
-    HZ_JOINING_TYPE_T = 1 << 20,
-    HZ_JOINING_TYPE_U = 1 << 21,
-} hz_joining_type_t;
-
-typedef enum {
-    HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_GROUP_E,
-    HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_GROUP_FE,
-    HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_GROUP_HE,
-    HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_GROUP_PE,
-    HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_GROUP_REH,
-    HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_GROUP_HAMZA_ON_HEH_GOAL,
-    HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_GROUP_ZHAIN,
-} hz_joining_group_t;
-
-static int32_t hz_ucd_arabic_joining_k2[676] = {
-    -674,   0,   0,   4,   0,   4,
-       0,   0,   0,   1,   0,-641,
-    -635,-628,-625,   8,   1,   0,
-       0,   4,-597,-589,   0,-585,
-       5,-570,   0,   6,   0,   0,
-    -569,   1,   0,   0,-557,-552,
-       2,   0,-528,   1,   4,   2,
-       0,   1,   0,   0,-512,-508,
-       1,-504,   0,   1,   0,-487,
-       0,   3,-468,   0,-455,   0,
-    -446,   0,   1,   0,   0,   0,
-    -402,   1,-399,-398,   1,   1,
-       0,-393,-384,-383,-382,   0,
-       0,   1,-376,   0,   1,   0,
-       4,-348,   0,-312,-307,   0,
-       0,-304,   0,   0,-302,   5,
-       1,-300,   0,-287,-278,   3,
-    -274,   0,-271,   0,-247,   0,
-    -244,-242,   0,   3,-240,   1,
-       0,   3,   3,   2,-225,   0,
-       1,   9,-212,   0,   0,   0,
-       0,   0,-188,   0,   0,   3,
-       0,   0,   1,-180,   0,   1,
-       2,   1,-174,   0,-171,-169,
-       2,-160,-153,-145,-134,   0,
-    -127,-121,   1,-119,   4,   0,
-       0,   0,   1,   0,   0, -95,
-       0,   0, -87,   5, -86, -75,
-       0,   0,   7,   0, -30, -27,
-     -25,   0, -19, -16,  -5,   0,
-       1,   2,   9,  -1,   9,  -3,
-       2,  -6,   0,   0,   0,   0,
-       0, -22, -24,   1,   1,   0,
-     -31,   0,   0,   2,   0, -70,
-     -71,   0, -73,  10, -84,   6,
-       6,   0,   1, -94,   4,   1,
-       0,   0,-106,   0,   7,   0,
-    -118,   0,   3,   0,   4,-130,
-       0,-133,   7,-136,   0,   0,
-       1,   0,   0,   0,   0,-156,
-    -159,   0,   0,-167,-168,   4,
-    -170,   0,-173,   3,   8,   1,
-       0,-186,   4,   2,   3,   0,
-    -197,   0,   0,-208,   3,-211,
-       1,   1,   0,   0,   0,   3,
-    -233,-236,-237,   0,   0,   1,
-    -243,   2,   1,   0,   0,   0,
-       1,   1,   6,-277,   1,   0,
-    -288,   0,   0,   0,   5,   0,
-       1,   1,   2,   0,-314,   0,
-    -319,-322,-324,   0,-330,   0,
-    -335,   0,   0,   0,-346,   0,
-    -351,-352,   0,-366,   1,-369,
-       0,   0,   1,   0,   0,   4,
-       0,   0,   0,   0,-396,   2,
-       1,   0,   1,-403,   2,   0,
-       0,-427,   0,-435,   0,   1,
-    -440,   3,   0,-450,-451,-452,
-    -453,-454,   0,   1,   0,-460,
-       0,   0,   1,-473,   0,   3,
-    -485,   0,   2,-488,-502,   0,
-       2,   0,-510,   6,-514,   1,
-    -518,-520,   0,-522,   1,   0,
-       0,   0,-550,-551,   3,-554,
-    -556,   2,-562,-566,   2,   2,
-       2,-577,-578,-581,   1,   0,
-    -587,   0,   0,-592,   0,-596,
-       0,   0,-601,-604,-610,   0,
-       1,   0,   0,-626,-627,   1,
-       0,   0,   1,   0,-647,   0,
-    -650,   0,   0,  20,-662,   2,
-       0,-669,   0,   2,   0,-672,
-    -665,   1,   0,-658,   1,   1,
-       0,-632,   0,-629,   3,-621,
-    -616,   0,-598,   2,-595,-590,
-       0,   3,   1,-543,   2,   0,
-    -533,-521,   1,   1,-486,   0,
-    -479,   0,-467,-466,   0,-459,
-       1,   0,   4,-436,-415,-414,
-       3,   0,   2,   0,-389,   0,
-       3,   5,-381,-377,   0,   0,
-    -373,-370,   0,-364,   1,   0,
-    -342,-338,   2,-332,   0,-328,
-    -316,   1,   0,   0,   1,   0,
-       0,   1,-298,   0,-296,   1,
-    -269,-264,-261,   0,   1,-239,
-    -224,   0,   0,-219,   0,-218,
-       2,-199,-194,   0,   7,   0,
-       3,   0,-162,   0,   6,-155,
-    -154,   0,   3,   0,-151,-144,
-    -138,-131,-125,   1,-115,   0,
-       0,   1,   0,   0,-102, -99,
-      10,   0, -72,   2,   5, -32,
-       5, -20,  14, -18,   6, -14,
-       0,  -2,   7, -36, -37, -47,
-     -88,   0, -93, -96,-108,   0,
-      16,   3,-114,   1,   4,   0,
-    -175,-183,   0,   1,   0,-187,
-       6,   0,-191,   0,   0,-204,
-    -210,   2,   0,  13,   0,-217,
-       4,   0,   1,   0,   0,   0,
-       0,   3,   0,   1,   0,-273,
-       8,-303,   0,   0,   2,   1,
-    -305,   0,   0,   0,-336,   0,
-       0,-367,   2,   0,   1,   0,
-       0,   0,   0,   0,   1,-397,
-       4,-408,-439,-444,   1,   0,
-    -457,-484,   0,-503,   2,   1,
-    -515,   0,   5,   0,-534,   1,
-       0,   0,-568,   1,   1,   1,
-    -586,   0,   8,   0,-618,   0,
-    -649,   1,-659,   0,-660,   1,
-       3,   0,-664,-430,
-};
-
-static uint32_t hz_ucd_arabic_joining_ucs_codepoints[676] = {
-        1722,   68290,    1893,    1869,    1702,  125231,
-        6307,    6154,   68891,    1658,   68892,    1917,
-      125259,   68895,    1825,    1582,    6280,    1570,
-        2124,    1607,    1585,    1813,    6252,   69431,
-       68525,    1829,    1999,    6303,    2208,    1871,
-        2221,    6209,    6242,    2223,    6232,    1666,
-        1581,    6190,   68314,    2117,    1823,   69426,
-        6185,  125203,    6189,    1836,    1573,    6191,
-        1747,    2150,    1647,    6213,   68488,    2126,
-       68897,    1913,    1538,    6231,    2214,  125248,
-      125223,   68521,  125249,   69434,    1697,    6198,
-       69427,    1895,  125209,   68320,    6285,    1892,
-      125184,    1787,    1884,   68876,    1706,    6216,
-      125247,    1995,  125221,    1728,    2147,    1674,
-        6184,   68495,    6158,    6207,    2129,  125226,
-      125204,    6253,    1729,    6247,    1890,    2123,
-        2023,    6272,    6292,   68871,    6212,  125228,
-       69432,    1731,    1757,    1721,    1574,    1998,
-        2134,   68319,    6176,    1579,    1889,   68318,
-        6210,    1909,    1886,    1687,    1888,    1580,
-        6211,    6203,    6309,    1736,    2009,  125230,
-      125193,    2231,    1698,   68304,    1891,    6182,
-        1569,    1997,    1651,    1880,   68323,    1712,
-        2001,   69460,   69435,    1683,    6300,    1605,
-        2003,  125232,  125200,    2212,    6150,    1876,
-      125194,   68880,    1660,    1996,    1838,   68899,
-        6279,    6197,    1873,    1597,    1681,    1912,
-        6254,    1724,    1832,    1594,   68494,   68288,
-        1665,   68300,    2012,    1606,    1667,    6297,
-        2274,  125227,  125238,   68316,   69457,    6222,
-        1740,    2216,   68322,  125210,    1682,    6301,
-        6281,    6277,    1827,   68315,    1807,    1907,
-       68866,    6240,    1669,    1879,  125190,   69429,
-        1719,    6256,    6262,    6188,    1603,    2227,
-        1659,  125206,   69438,    1744,    6230,    2113,
-      125215,  125244,    6180,    2148,    6302,   68889,
-       68312,    1668,    2149,   68526,   68527,   68868,
-      125217,    6178,    6195,    1599,    6255,    2022,
-        1541,    1726,   68483,   68310,    6261,    1743,
-        2112,    6273,    1604,   68877,    2114,    1887,
-        2000,  125239,    6199,    2042,  125243,    1835,
-        6192,  125212,    8296,    1898,    1664,   68887,
-        1831,    1732,   68332,    1661,    6183,   68305,
-        1663,    2016,    6250,    1817,    1742,    2228,
-        1688,  125202,    2154,  125241,    6241,    2019,
-        6235,   68303,    1874,    6226,    1915,    2007,
-        1822,   68879,  125235,   68882,   69425,    1774,
-        1572,    1718,    1820,   68522,    6258,    1715,
-        1910,   68291,    6228,    6284,  125187,    6221,
-        1689,    1899,   68299,    2015,  125195,    1745,
-       68295,    1695,    2234,    1586,   68496,    2151,
-        2233,   69437,   68898,    1741,    1673,    2232,
-        1903,    6238,  125207,    2153,    6204,  125224,
-      125246,   68870,    1908,    2021,    1896,    1679,
-       68302,  125216,    6263,   68884,    1723,    6248,
-        1808,  125213,    2116,    1833,    2230,    1710,
-        1656,    1692,    1812,  125233,    1904,   68334,
-       69439,    1662,    6193,    2213,  125188,    2017,
-        1900,    2018,    2004,  125192,    1788,   69436,
-       69443,    1791,   69441,    2220,    1578,    6259,
-        1540,    6288,    1734,    6282,  125196,    6311,
-       68872,    2118,  125237,    1911,  125229,    1705,
-        1720,    6295,   69821,    2237,    6214,   68865,
-       69433,    2125,    6181,    2217,    1693,    1735,
-        1703,    6227,    1686,  125208,    1749,    1902,
-        1816,   69459,   68306,   68497,    1685,    1709,
-        1881,   68321,    6310,    1746,    1919,    6236,
-        1653,  125225,    6308,    6246,   68890,    1601,
-        1547,   68493,  125218,    1875,   68481,    1882,
-      125220,    1584,  125242,   68885,    1708,    1905,
-        1839,    1676,   69424,    2131,    6306,   68331,
-        1595,    6244,    2210,    6304,    1650,   68893,
-        1657,   68524,    6218,    2119,    6194,    8297,
-      125186,    1684,    1654,   68313,    1670,    6196,
-        2235,    1677,    2225,    2020,    6219,    2006,
-        1571,    2135,    1671,   68324,    1583,    1596,
-       68492,    6275,    1737,    1577,    6249,    1536,
-        1610,   68878,    2145,    1652,   68864,    1837,
-        6223,    6312,    1916,    1725,    1675,    6224,
-        1918,    1727,    1883,    1576,    2115,    1713,
-        6217,  125251,    2211,    6260,    6286,    1598,
-        1691,   68875,   68487,    1649,    6186,  125219,
-        1906,    2008,    1775,    2144,    6233,   68489,
-       68296,    6298,    6187,    2146,    6287,   68881,
-       68307,    1588,    6283,    1646,   68523,    1589,
-        1786,    1690,    1537,    1821,    1716,    1678,
-       68888,    1994,    2127,    6239,   68293,    2002,
-        6251,  125245,    6151,    6299,    1699,   69444,
-      125201,    1819,    2136,    2026,  125211,    1587,
-       68311,  125199,    6243,    1878,    6229,   68309,
-        1814,    1730,    1591,    1544,   68484,    6290,
-       68317,   68335,   68294,    2224,  125240,    6278,
-        1700,  125205,    6289,   68298,    6276,    1680,
-        6245,   68333,    2005,    1897,    2209,    6206,
-       69458,    2130,    1738,  125214,    2010,    2222,
-        2218,    1711,   68482,    1830,    6291,    1815,
-        6220,    1602,    1608,    1826,  125198,  125191,
-       68292,  125197,    2121,    1714,    6305,    6234,
-        1701,   68869,    2128,   68490,    2122,    2152,
-       68874,   68486,    6200,    6314,    1811,    6237,
-        1655,    1810,    6225,    1901,   69445,    6201,
-       69430,    6293,   68480,    1575,    1590,  125222,
-       68289,    6177,   68301,    1894,    6294,    2236,
-       69837,    2014,    1872,    6202,    2226,    1568,
-       68308,    1704,    1834,   69442,    2013,  125185,
-        1824,    2219,    6179,    6215,    1717,    1870,
-       69428,   68886,    2132,    1593,    1696,    6257,
-       68873,    1733,    2024,    8205,    1914,   68867,
-      125236,    1592,    2133,    1609,  125189,    1539,
-        6264,  125234,  125250,    6274,    1694,   68883,
-        6208,    1672,    1600,    1877,    2011,    6296,
-        2025,    1707,    6205,   68297,    1885,    1828,
-        1818,    2215,    1739,    2120,
-};
-
-static uint32_t hz_ucd_arabic_joining_data[676] = {
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZHAIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_E,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA_GOAL,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_HE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-};
-
-#endif /* HZ_UCD_12_0_0_H */
\ No newline at end of file
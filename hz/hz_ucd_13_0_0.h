@@ -1,1083 +0,0 @@
-#ifndef HZ_UCD_13_0_0_H
-#define HZ_UCD_13_0_0_H
-
-#include <stdint.h>
-
-#define HZ_UCD_VERSION HZ_MAKE_VERSION(13,0,0)
-
-typedef enum {
-    HZ_JOINING_TYPE_C = 1 << 16,
-    HZ_JOINING_TYPE_D = 1 << 17,
-    HZ_JOINING_TYPE_L = 1 << 18,
-    HZ_JOINING_TYPE_R = 1 << 19,
-    HZ_JOINING_TYPE_T = 1 << 20,
-    HZ_JOINING_TYPE_U = 1 << 21,
-} hz_joining_type_t;
-
-typedef enum {
-    HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_GROUP_E,
-    HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_GROUP_FE,
-    HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_GROUP_HE,
-    HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_GROUP_PE,
-    HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_GROUP_REH,
-    HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_GROUP_HAMZA_ON_HEH_GOAL,
-    HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_GROUP_ZHAIN,
-} hz_joining_group_t;
-
-static int32_t hz_ucd_arabic_joining_k2[714] = {
-    -713,-665,   1,-660,-633,   0,
-    -575,   0,   0,   9,   0,   0,
-    -508,-423,-420,-390,   4,   4,
-       1,-346,   4,   0,   0,-284,
-       1,-259,   3,   0,   0,-135,
-       8,   3, -84, -81, -50, -29,
-       0, -70,-130,-150,-204,   0,
-    -212,-279,-307,   0,-421,   1,
-       0,   0,   1,-540,   0,   1,
-       1,   0,   1,   0,   0,   0,
-    -651,-645,   0,-632,   0,-631,
-       0,   0,   0,-629,-621,-619,
-       1,   0,-601,   0,   0,   1,
-    -573,   0,   0,-552,-548,   1,
-       0,   0,   0,   0,   0,   0,
-       4,-517,   0,   0,-498,-474,
-       1,   2,-455,   0,-438,   0,
-    -431,   0,   0,   0,   0,   1,
-       1,-413,-407,   2,   0,-384,
-       0,   0,-372,-364,   0,   0,
-    -349,-345,-341,-340,-338,   5,
-    -333,   0,-316,   0,   0,-288,
-       0,   4,   0,   0,   1,   0,
-       1,   0,-208,   0,   2,   1,
-       2,-191,-190,   1,   2,   4,
-       3,-179,   2,   0,-171,-166,
-       2,   0,   0,   0,   4,-116,
-    -114,   0,-110,   0,-106,   0,
-       0,   4, -94,   0,   4,   0,
-       2,   4,   1,   0,  -6,   0,
-       0,  -1,   5,   0, -14,   0,
-     -20, -22,   0,   0, -36, -37,
-     -40, -42, -44, -48,   0, -56,
-     -58,   0,   2,   0, -71,   1,
-       0, -79,   0,   1,   0, -92,
-     -93,   0, -95,   0,   2,   2,
-    -108,   2,   1,   0,   0,   3,
-    -117,   0,   0,   0,   0,-134,
-       0,   0,   0,-142,   0,-148,
-       2,   0,-155,-156,-165,   2,
-       0,-172,   2,   0,   0,-187,
-       0,-189,   0,   0,-199,-203,
-       2,-205,   2,   0,-210,   1,
-      10,   0,-215,   4,-220,-221,
-    -222,   0,-226,-229,-231,-239,
-    -243,   0,-249,-250,   0,-253,
-    -258,   0,   2,-270,-275,   0,
-       0,   1,-286,   7,-292,   0,
-    -301,   0,   0,-308,-312,   0,
-       0,-320,-330,   6,-334,-336,
-       4,   0,   7,-342,   0,   2,
-       0,-348,   0,-356,-357,   1,
-       3,-365,   0,-368,-369,   2,
-       1,   0,   4,-380,-381,-383,
-       2,   0,-389,   2,-394,-399,
-    -400,   2,-408,-411,   4,-415,
-       4,-419,   1,   4,   2,   0,
-    -430,   0,   0,-433,   1,-440,
-       0,   4,-450,   0,   0,   0,
-    -459,-462,   0,-476,   0,   0,
-       0,   0,-490,-493,   0,   0,
-       1,-501,   0,-504,-506,   1,
-       1,   0,   0,-521,   1,-532,
-    -533,   0,-538,   5,   0,   0,
-       0,   0,   0,   0,   2,   0,
-    -558,   2,-561,   0,-566,   3,
-       0,   0,   1,   1,-582,   0,
-       1,-590,   0,   0,   0,-596,
-    -599,-600,   1,   8,   0,-620,
-       0,   0,   2,   1,   2,   1,
-       1,-634,   0,-636,   3,-639,
-       7,   0,   1,-654,-657,-659,
-       1,-663,   0,-668,-670,-671,
-    -673,   3,   0,-679,-682,   0,
-       0,-685,-687,-690,-693,   0,
-    -703,   0,   2,-709,-710,-704,
-       2,   0,   1,-683,-678,   0,
-       1,-649,   0,   0,-635,-623,
-       0,   0,   2,   0,   1,   0,
-       5,-594,-591,   0,   0,-584,
-       0,   2,-571,   0,   0,   0,
-       0,-565,-553,-551,-550,   1,
-    -544,   2,-541,   0,-534,   0,
-       1,   0,   1,-502,-497,-496,
-    -485,   0,   0,-481,-478,   0,
-    -477,   1,-456,   3,-453,-442,
-    -432,   1,   1,-386,-377,   0,
-    -367,   1,   1,-343,   2,   1,
-       0,-314,   3,-304,   3,   1,
-       1,   0,   1,   0,   0,-251,
-       0,   0,-248,-223,   0,-214,
-       1,   0,   3,   1,-188,-183,
-       0,   4,   0,   0,   0,   2,
-      12,   0,-143,   3,-140,   1,
-       2,-124,   0,-123,-118,   0,
-       2,   0,  12,   0,   0,   0,
-       0,   1,  11, -88,   1, -77,
-       0,  10,   0,   0, -62,   0,
-       5,   5, -23,   0,   0, -18,
-       8,   1,  -3, -63,   0,   2,
-       0, -73, -97,   0,-101,-109,
-    -111,   1,   0,   0,-141,-149,
-       0,   0,-176,   0,   0,   0,
-       0,   0,   0,   4,   0,   0,
-    -211,   4,-217,   0,-260,-285,
-       0,-295,   0,   1,   0,   1,
-       0,   0,   0,   4,-360,-374,
-    -379,   0,   3,   4,   6,   0,
-       1,   0,   0,   0,   0,   0,
-       0,   2,   2,-444,   1,   2,
-    -519,   0,   0,   1,-525,   0,
-       2,   0,   4,   0,-542,   0,
-    -560,-567,-595,   1,-613,   6,
-    -630,   2,   0,   3,-638,-677,
-       0,   0,-684,   0,-702,   2,
-       0,-587,   0,-516,   0,-422,
-    -417,   0,-206,   0,  25,   7,
-    -706,   4,   2,   0,   1,   0,
-       2,   1,   1,-577,   0,   1,
-};
-
-static uint32_t hz_ucd_arabic_joining_ucs_codepoints[714] = {
-      125207,    1715,    1572,  125238,    1889,    6185,
-        1744,    1670,    6294,    1678,   68877,    1909,
-        6178,    6286,    1898,   68496,    1538,    6247,
-        6314,    1655,   68311,    6186,    6200,    6299,
-        1723,   69557,    6222,   68879,    6211,    1741,
-       69564,    1595,   68490,    1592,  125213,    6250,
-       68884,    6221,    1902,    6236,    1837,    1812,
-        6194,    1710,    1824,   69460,    1662,    6179,
-        1721,    1743,    2127,    1745,    2236,  125259,
-        6311,    1730,    1677,    1811,    2235,   69561,
-        1585,   68892,    6237,  125196,    1669,    1581,
-       68304,    2232,    1606,    1826,    6195,   68489,
-      125189,    1713,    2112,    2149,    6287,    1739,
-       69569,    2151,    2216,    6284,    2247,    1774,
-      125200,    1916,    6282,  125226,    1813,    1712,
-        6285,   69837,    8205,    6262,    1834,   69442,
-       69444,    1893,   68487,    2234,   68864,   68335,
-        2243,    1683,    6252,    1602,    2214,    6280,
-        2130,    1871,    1682,    1911,    6251,  125225,
-        1679,   68324,    2007,    1896,    6214,    2145,
-        1884,    1878,    1692,    1828,  125246,   68898,
-       68296,    1897,    6235,    2026,    2209,    1904,
-       68310,    1570,   68482,   68899,   68308,   68317,
-        6182,    1698,    2213,    6224,   69572,    6209,
-        2009,   68315,    2129,   69577,    1882,    6306,
-        1589,  125212,   69556,    2011,    2023,    1885,
-        1807,    1876,    1820,    2241,    1912,   69439,
-        6217,    1544,    1706,   69821,    6238,    6193,
-        6191,    1892,    1685,    1910,    1659,    2217,
-      125220,   68300,  125188,    6218,    1573,   69568,
-       68323,    1808,    2239,    1907,    6278,    1814,
-        6308,    2245,   68319,   68873,   69434,    1731,
-        1702,    1817,    2135,    2227,    2146,    2274,
-        1839,   68334,   69570,    1586,    6304,    6190,
-       68289,  125223,   68309,    2115,   69438,    2014,
-       69558,    6151,    1647,   68895,    1720,    2215,
-        1829,   69429,    1686,    6305,    1696,    6297,
-        1704,    1881,  125221,    6187,  125197,    2120,
-        1836,    6241,    2226,    6261,    2022,  125211,
-        1719,    6232,    1674,  125222,    2150,  125203,
-        6253,   69554,   68307,   68881,    1899,    1716,
-        1742,    1536,   68866,    1591,    2144,    6201,
-        1895,    2233,  125248,    1577,   68527,   69443,
-      125217,    6249,  125198,    2152,    6296,   68299,
-        2042,    1810,    1590,    1729,   68869,    6258,
-        6189,    1667,    1666,    1997,    1708,    1690,
-        6219,  125227,    2019,    1833,   68306,   68893,
-      125202,    2147,  125240,    1694,    1594,    6281,
-       68486,    2114,    1588,    6302,  125236,  125244,
-        1906,    6260,    1660,    6293,   68298,    2012,
-       68484,    1874,    1598,    1995,    6259,   69428,
-        1580,    6309,   68882,    1734,    6274,    1583,
-        2017,   68293,    1870,    1574,   68483,    1818,
-        6210,    1757,  125242,   69575,    2123,    1604,
-        2016,    2244,  125247,    1603,    1665,    6307,
-        1568,  125233,    6300,  125185,    6199,    1699,
-        2219,    1541,    1576,   69437,    6154,    6246,
-        1832,   68870,  125237,   69425,   69445,    6279,
-        6226,    6298,    1998,    6283,   68292,   68303,
-        1996,    1593,    6223,   68331,    1705,    2025,
-        1903,   69574,  125235,    6245,    1815,    6181,
-       68883,   68297,    6231,    1575,   68887,   68288,
-        6303,   68316,   69432,  125205,   68314,   68865,
-        1917,   68494,    1687,   68495,   68522,    1605,
-      125249,    1722,    1537,    1680,    1887,   69555,
-        1825,    1787,    6275,    6197,  125215,    2018,
-        6212,    1646,    1654,   69579,  125243,    2148,
-       68891,  125231,    6228,    6196,    1714,    6277,
-        6198,   68880,    1569,   68291,    6292,    1879,
-        1913,    6208,    1738,    2221,   68290,   68318,
-        2004,    1830,   68878,    1596,    6180,    2125,
-        1582,    6158,    2021,    1823,   68525,    6248,
-        2118,    6203,  125228,  125193,    1656,  125234,
-        2237,    1872,  125250,  125210,    8296,    2218,
-        1819,    2113,    6243,    6215,    1684,  125208,
-       68333,   69571,    6257,    1540,   68871,    1831,
-        2211,    2242,    1671,  125199,  125204,    2013,
-       69552,    1994,    1827,    8297,   68523,  125230,
-        6225,    1915,    2208,    1672,   68294,   69459,
-      125232,    6150,    1875,    2153,   69431,    6295,
-        1691,    6273,    1675,   69565,    1599,    1661,
-        2210,    2119,   69458,    1735,    1900,    6288,
-        1890,    1835,    2228,    2122,    6177,  125194,
-        1883,    6183,   68521,    1880,   68497,    1609,
-      125195,    2231,    1676,    6229,    6276,    2126,
-        1578,    2121,   68874,    2136,   69566,    1905,
-        1601,    6188,    2224,    6242,    1689,    1877,
-       68488,   69424,    6255,  125245,    1822,    1888,
-        1816,    1749,    1788,   68868,    2116,    6230,
-        6205,    1725,    6213,    2246,    2020,    2003,
-       68897,    2238,    6289,   69559,    2005,    1579,
-        1695,  125191,    1709,    6263,    1607,   69560,
-       69578,    2212,    2117,    6192,  125229,   68493,
-       68301,    2008,   69441,    1707,   69576,    6239,
-        6176,   68305,    1693,  125184,    1703,   68886,
-        1571,   69562,    2223,    1717,    1718,   68481,
-        1775,  125216,   68889,   69573,    6256,    1608,
-       68526,    6254,    2240,   69427,    1653,   68321,
-        6204,   68867,    1791,  125239,  125209,    1657,
-       69553,   68872,   68890,   68876,    6310,  125192,
-        2015,   69436,    1651,   69567,    1724,    1726,
-        6244,    6301,   68302,    1711,  125201,  125206,
-      125218,    1658,    1821,   68312,    2128,    1838,
-        1901,   68480,    1727,    2010,    1701,   68295,
-      125251,    2024,    1610,    2222,    1547,  125186,
-        6216,    1597,    2220,    6312,   68492,    2006,
-        6184,    6206,    1919,    1649,    6202,    1668,
-       69430,   68875,   69435,   68332,  125187,    6290,
-      125224,    1728,    1539,   69426,    1681,  125241,
-        2000,    1746,    1918,    1914,    2132,    2002,
-        1673,  125219,    1999,    6264,   69433,   68888,
-        1732,   68320,    6233,    6207,    1688,    1894,
-       68885,    2133,    1587,    6220,   68313,    1736,
-        1600,    1700,    1891,    2131,    2225,    1869,
-        2001,   68322,    1786,    6234,    1747,    1650,
-        2230,    1664,    1886,    6227,   69457,  125190,
-       69563,    1740,    1908,    2124,    6240,  125214,
-        6291,    1584,    2134,    1663,   68524,    1733,
-        6272,    2154,    1873,    1652,    1697,    1737,
-};
-
-static uint32_t hz_ucd_arabic_joining_data[714] = {
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_NUN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_WITH_TAIL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAMADH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NUN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNNA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_RA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_HUNDRED,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_JA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FINAL_SEMKATH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_MEM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_DHAMEDH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_SADHE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SWASH_KAF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZAIN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NYA,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DALATH_RISH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TWENTY,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_THAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_E,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_MALAYALAM_BHA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_LAMEDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_PA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NGA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_LLA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH_GOAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAPH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_TTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_DALETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KHAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SADHE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_YODH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_HE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_ZAYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_ALEPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MIM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MALAYALAM_NNA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_T | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_GIMEL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_BETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AFRICAN_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_TEN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_REVERSED_PE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEMKATH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_LLLA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SHIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YUDH_HE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_SYRIAC_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NYA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_TAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_L | HZ_JOINING_GROUP_MANICHAEAN_HETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_KAPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_QAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SAD,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_LAM,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HANIFI_ROHINGYA_KINNA_YA,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_RESH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NOON,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KNOTTED_HEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_TETH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YUDH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_SAMEKH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAMAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MANICHAEAN_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ROHINGYA_YEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_KAF,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_HAH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_FIVE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_TEH_MARBUTA,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BURUSHASKI_YEH_BARREE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_QOPH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_REH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MEEM,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_MANICHAEAN_AYIN,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_C | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_GAF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_STRAIGHT_WAW,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ZHAIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_SEEN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_YEH_BARREE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_AIN,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FARSI_YEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_ALEF,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_DAL,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_MALAYALAM_SSA,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_BEH,
-    HZ_JOINING_TYPE_U | HZ_JOINING_GROUP_NONE,
-    HZ_JOINING_TYPE_D | HZ_JOINING_GROUP_FEH,
-    HZ_JOINING_TYPE_R | HZ_JOINING_GROUP_WAW,
-};
-
-#endif /* HZ_UCD_13_0_0_H */
\ No newline at end of file
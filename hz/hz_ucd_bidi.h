@@ -0,0 +1,72 @@
+#ifndef HZ_UCD_BIDI_H
+#define HZ_UCD_BIDI_H
+
+#include <stdint.h>
+
+// Generated by generate_ucd_headers.c from DerivedBidiClass.txt and BidiBrackets.txt
+
+typedef enum {
+    HZ_BIDI_CLASS_L,
+    HZ_BIDI_CLASS_R,
+    HZ_BIDI_CLASS_AL,
+    HZ_BIDI_CLASS_EN,
+    HZ_BIDI_CLASS_ES,
+    HZ_BIDI_CLASS_ET,
+    HZ_BIDI_CLASS_AN,
+    HZ_BIDI_CLASS_CS,
+    HZ_BIDI_CLASS_NSM,
+    HZ_BIDI_CLASS_BN,
+    HZ_BIDI_CLASS_B,
+    HZ_BIDI_CLASS_S,
+    HZ_BIDI_CLASS_WS,
+    HZ_BIDI_CLASS_ON,
+    HZ_BIDI_CLASS_LRE,
+    HZ_BIDI_CLASS_LRO,
+    HZ_BIDI_CLASS_RLE,
+    HZ_BIDI_CLASS_RLO,
+    HZ_BIDI_CLASS_PDF,
+    HZ_BIDI_CLASS_LRI,
+    HZ_BIDI_CLASS_RLI,
+    HZ_BIDI_CLASS_FSI,
+    HZ_BIDI_CLASS_PDI,
+    HZ_BIDI_CLASS_COUNT
+} hz_bidi_class_t;
+
+static const uint32_t hz_ucd_bidi_brackets[][3] = {
+    {0x0028,0x0029,1},{0x0029,0x0028,2},{0x005B,0x005D,1},{0x005D,0x005B,2},
+    {0x007B,0x007D,1},{0x007D,0x007B,2},{0x0F3A,0x0F3B,1},{0x0F3B,0x0F3A,2},
+    {0x0F3C,0x0F3D,1},{0x0F3D,0x0F3C,2},{0x169B,0x169C,1},{0x169C,0x169B,2},
+    {0x2045,0x2046,1},{0x2046,0x2045,2},{0x207D,0x207E,1},{0x207E,0x207D,2},
+    {0x208D,0x208E,1},{0x208E,0x208D,2},{0x2308,0x2309,1},{0x2309,0x2308,2},
+    {0x230A,0x230B,1},{0x230B,0x230A,2},{0x2329,0x232A,1},{0x232A,0x2329,2},
+    {0x2768,0x2769,1},{0x2769,0x2768,2},{0x276A,0x276B,1},{0x276B,0x276A,2},
+    {0x276C,0x276D,1},{0x276D,0x276C,2},{0x276E,0x276F,1},{0x276F,0x276E,2},
+    {0x2770,0x2771,1},{0x2771,0x2770,2},{0x2772,0x2773,1},{0x2773,0x2772,2},
+    {0x2774,0x2775,1},{0x2775,0x2774,2},{0x27C5,0x27C6,1},{0x27C6,0x27C5,2},
+    {0x27E6,0x27E7,1},{0x27E7,0x27E6,2},{0x27E8,0x27E9,1},{0x27E9,0x27E8,2},
+    {0x27EA,0x27EB,1},{0x27EB,0x27EA,2},{0x27EC,0x27ED,1},{0x27ED,0x27EC,2},
+    {0x27EE,0x27EF,1},{0x27EF,0x27EE,2},{0x2983,0x2984,1},{0x2984,0x2983,2},
+    {0x2985,0x2986,1},{0x2986,0x2985,2},{0x2987,0x2988,1},{0x2988,0x2987,2},
+    {0x2989,0x298A,1},{0x298A,0x2989,2},{0x298B,0x298C,1},{0x298C,0x298B,2},
+    {0x298D,0x2990,1},{0x298E,0x298F,2},{0x298F,0x298E,1},{0x2990,0x298D,2},
+    {0x2991,0x2992,1},{0x2992,0x2991,2},{0x2993,0x2994,1},{0x2994,0x2993,2},
+    {0x2995,0x2996,1},{0x2996,0x2995,2},{0x2997,0x2998,1},{0x2998,0x2997,2},
+    {0x29D8,0x29D9,1},{0x29D9,0x29D8,2},{0x29DA,0x29DB,1},{0x29DB,0x29DA,2},
+    {0x29FC,0x29FD,1},{0x29FD,0x29FC,2},{0x2E22,0x2E23,1},{0x2E23,0x2E22,2},
+    {0x2E24,0x2E25,1},{0x2E25,0x2E24,2},{0x2E26,0x2E27,1},{0x2E27,0x2E26,2},
+    {0x2E28,0x2E29,1},{0x2E29,0x2E28,2},{0x2E55,0x2E56,1},{0x2E56,0x2E55,2},
+    {0x2E57,0x2E58,1},{0x2E58,0x2E57,2},{0x2E59,0x2E5A,1},{0x2E5A,0x2E59,2},
+    {0x2E5B,0x2E5C,1},{0x2E5C,0x2E5B,2},{0x3008,0x3009,1},{0x3009,0x3008,2},
+    {0x300A,0x300B,1},{0x300B,0x300A,2},{0x300C,0x300D,1},{0x300D,0x300C,2},
+    {0x300E,0x300F,1},{0x300F,0x300E,2},{0x3010,0x3011,1},{0x3011,0x3010,2},
+    {0x3014,0x3015,1},{0x3015,0x3014,2},{0x3016,0x3017,1},{0x3017,0x3016,2},
+    {0x3018,0x3019,1},{0x3019,0x3018,2},{0x301A,0x301B,1},{0x301B,0x301A,2},
+    {0xFE59,0xFE5A,1},{0xFE5A,0xFE59,2},{0xFE5B,0xFE5C,1},{0xFE5C,0xFE5B,2},
+    {0xFE5D,0xFE5E,1},{0xFE5E,0xFE5D,2},{0xFF08,0xFF09,1},{0xFF09,0xFF08,2},
+    {0xFF3B,0xFF3D,1},{0xFF3D,0xFF3B,2},{0xFF5B,0xFF5D,1},{0xFF5D,0xFF5B,2},
+    {0xFF5F,0xFF60,1},{0xFF60,0xFF5F,2},{0xFF62,0xFF63,1},{0xFF63,0xFF62,2},
+};
+
+#define HZ_UCD_BIDI_BRACKET_COUNT 128
+
+#endif /* HZ_UCD_BIDI_H */
@@ -0,0 +1,40 @@
+#ifndef HZ_UCD_GENERAL_CATEGORY_H
+#define HZ_UCD_GENERAL_CATEGORY_H
+
+// Generated by generate_ucd_headers.c from DerivedGeneralCategory.txt
+
+typedef enum {
+    HZ_GENERAL_CATEGORY_CN,
+    HZ_GENERAL_CATEGORY_LU,
+    HZ_GENERAL_CATEGORY_LL,
+    HZ_GENERAL_CATEGORY_LT,
+    HZ_GENERAL_CATEGORY_LM,
+    HZ_GENERAL_CATEGORY_LO,
+    HZ_GENERAL_CATEGORY_MN,
+    HZ_GENERAL_CATEGORY_MC,
+    HZ_GENERAL_CATEGORY_ME,
+    HZ_GENERAL_CATEGORY_ND,
+    HZ_GENERAL_CATEGORY_NL,
+    HZ_GENERAL_CATEGORY_NO,
+    HZ_GENERAL_CATEGORY_PC,
+    HZ_GENERAL_CATEGORY_PD,
+    HZ_GENERAL_CATEGORY_PS,
+    HZ_GENERAL_CATEGORY_PE,
+    HZ_GENERAL_CATEGORY_PI,
+    HZ_GENERAL_CATEGORY_PF,
+    HZ_GENERAL_CATEGORY_PO,
+    HZ_GENERAL_CATEGORY_SM,
+    HZ_GENERAL_CATEGORY_SC,
+    HZ_GENERAL_CATEGORY_SK,
+    HZ_GENERAL_CATEGORY_SO,
+    HZ_GENERAL_CATEGORY_ZS,
+    HZ_GENERAL_CATEGORY_ZL,
+    HZ_GENERAL_CATEGORY_ZP,
+    HZ_GENERAL_CATEGORY_CC,
+    HZ_GENERAL_CATEGORY_CF,
+    HZ_GENERAL_CATEGORY_CS,
+    HZ_GENERAL_CATEGORY_CO,
+    HZ_GENERAL_CATEGORY_COUNT
+} hz_general_category_t;
+
+#endif /* HZ_UCD_GENERAL_CATEGORY_H */
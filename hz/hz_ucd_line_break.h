@@ -0,0 +1,55 @@
+#ifndef HZ_UCD_LINE_BREAK_H
+#define HZ_UCD_LINE_BREAK_H
+
+#include <stdint.h>
+
+// Generated by generate_ucd_headers.c from LineBreak.txt
+
+typedef enum {
+    HZ_LINE_BREAK_CLASS_XX,
+    HZ_LINE_BREAK_CLASS_BK,
+    HZ_LINE_BREAK_CLASS_CR,
+    HZ_LINE_BREAK_CLASS_LF,
+    HZ_LINE_BREAK_CLASS_CM,
+    HZ_LINE_BREAK_CLASS_NL,
+    HZ_LINE_BREAK_CLASS_SG,
+    HZ_LINE_BREAK_CLASS_WJ,
+    HZ_LINE_BREAK_CLASS_ZW,
+    HZ_LINE_BREAK_CLASS_GL,
+    HZ_LINE_BREAK_CLASS_SP,
+    HZ_LINE_BREAK_CLASS_ZWJ,
+    HZ_LINE_BREAK_CLASS_B2,
+    HZ_LINE_BREAK_CLASS_BA,
+    HZ_LINE_BREAK_CLASS_BB,
+    HZ_LINE_BREAK_CLASS_HY,
+    HZ_LINE_BREAK_CLASS_CB,
+    HZ_LINE_BREAK_CLASS_CL,
+    HZ_LINE_BREAK_CLASS_CP,
+    HZ_LINE_BREAK_CLASS_EX,
+    HZ_LINE_BREAK_CLASS_IN,
+    HZ_LINE_BREAK_CLASS_NS,
+    HZ_LINE_BREAK_CLASS_OP,
+    HZ_LINE_BREAK_CLASS_QU,
+    HZ_LINE_BREAK_CLASS_IS,
+    HZ_LINE_BREAK_CLASS_NU,
+    HZ_LINE_BREAK_CLASS_PO,
+    HZ_LINE_BREAK_CLASS_PR,
+    HZ_LINE_BREAK_CLASS_SY,
+    HZ_LINE_BREAK_CLASS_AI,
+    HZ_LINE_BREAK_CLASS_AL,
+    HZ_LINE_BREAK_CLASS_CJ,
+    HZ_LINE_BREAK_CLASS_EB,
+    HZ_LINE_BREAK_CLASS_EM,
+    HZ_LINE_BREAK_CLASS_H2,
+    HZ_LINE_BREAK_CLASS_H3,
+    HZ_LINE_BREAK_CLASS_HL,
+    HZ_LINE_BREAK_CLASS_ID,
+    HZ_LINE_BREAK_CLASS_JL,
+    HZ_LINE_BREAK_CLASS_JV,
+    HZ_LINE_BREAK_CLASS_JT,
+    HZ_LINE_BREAK_CLASS_RI,
+    HZ_LINE_BREAK_CLASS_SA,
+    HZ_LINE_BREAK_CLASS_COUNT
+} hz_line_break_class_t;
+
+#endif /* HZ_UCD_LINE_BREAK_H */
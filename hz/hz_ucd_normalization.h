@@ -0,0 +1,2503 @@
+#ifndef HZ_UCD_NORMALIZATION_H
+#define HZ_UCD_NORMALIZATION_H
+
+#include <stdint.h>
+
+// Generated by generate_ucd_headers.c from UnicodeData.txt and DerivedNormalizationProps.txt
+
+// quick check values other than Yes
+#define HZ_UCD_NFD_QC_NO 0x01
+#define HZ_UCD_NFKD_QC_NO 0x02
+#define HZ_UCD_NFC_QC_NO 0x04
+#define HZ_UCD_NFC_QC_MAYBE 0x08
+#define HZ_UCD_NFKC_QC_NO 0x10
+#define HZ_UCD_NFKC_QC_MAYBE 0x20
+
+#define HZ_UCD_QUICK_CHECK_BLOCK_SHIFT 7
+#define HZ_UCD_QUICK_CHECK_BLOCK_COUNT 1525
+
+static const uint16_t hz_ucd_quick_check_stage1[1525] = {
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  0, 10, 11, 12,  0,  0,
+      0,  0, 13, 14, 15,  0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+     26, 27, 28, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 31, 32, 33, 34, 35, 36,
+     37, 38, 39, 40, 41, 42, 43,  0, 44, 45,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0, 46, 47,  0,  0, 48,  0, 49,  0,  0, 50, 51, 52,
+     53, 54, 55, 56, 57, 51, 51, 51,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58, 59, 60,
+      0,  0,  0,  0,  0,  0, 61,  0, 33, 33, 33, 33, 33, 33, 33, 33,
+     33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+     33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+     33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+     33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+     33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 62,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0, 63, 63, 64, 65, 66, 67, 51, 51, 68, 69, 70, 71, 72, 73,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0, 75, 76,  0,  0,  0, 77,  0,  0, 78,  0, 79,  0,  0,  0,  0,
+      0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0, 81, 82,  0,  0,  0,  0, 83, 84, 85, 51, 51, 86, 51, 87,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89, 90,  0,  0,
+      0,  0, 91, 92, 93,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     63, 63, 63, 63, 95,
+};
+
+static const uint8_t hz_ucd_quick_check_stage2[12288] = {
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 0, 0, 0, 0, 0, 0, 0,18, 0,18, 0, 0, 0, 0,18, 0, 0,18,18,18,18, 0, 0,18,18,18, 0,18,18,18, 0,
+     3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0,
+     3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,18,18, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3,18,
+    18, 0, 0, 3, 3, 3, 3, 3, 3,18, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,18,18,18,18,18,18,18,18,18, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3,
+     3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,18,18,18, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3,
+     0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18, 0, 0,
+    18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    40,40,40,40,40, 0,40,40,40,40,40,40,40, 0, 0,40, 0,40, 0,40,40, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0,
+     0, 0, 0,40,40,40,40,40,40, 0, 0, 0, 0,40,40, 0,40,40, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0,
+    23,23,40,23,23,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0, 0, 0, 0,18, 0, 0, 0,23, 0,
+     0, 0, 0, 0,18,19, 3,23, 3, 3, 3, 0, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0,18,18,18,19,19,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18, 0,18,18, 0, 0, 0,18, 0, 0, 0, 0, 0, 0,
+     3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 3, 3, 3, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3,
+     0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40,40,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23,23,23,23,23,23,23,23,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0,23,23, 0,23,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0,23, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23,23,23, 0, 0,23, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,40,40, 0, 0, 0, 0,23,23, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     3, 0,40, 0, 0, 0, 0, 3, 3, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,40,40, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 3, 3,40,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0,23, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0, 0, 0,23, 0, 0, 0, 0,23, 0, 0, 0, 0,23, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0,23,23,18,23,18, 0, 0, 0, 0, 0, 0,
+     0,23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0,
+     0, 0,23, 0, 0, 0, 0,23, 0, 0, 0, 0,23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0,
+     3, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,18,19, 0, 0, 0, 0,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,23, 3,23, 3,23, 3,23, 3,23, 3,23, 3,23, 0, 0,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3,23, 3,18,23,18,
+    18,19, 3, 3, 3, 0, 3, 3, 3,23, 3,23, 3,19,19,19, 3, 3, 3,23, 0, 0, 3, 3, 3, 3, 3,23, 0,19,19,19,
+     3, 3, 3,23, 3, 3, 3, 3, 3, 3, 3,23, 3,19,23,23, 0, 0, 3, 3, 3, 0, 3, 3, 3,23, 3,23, 3,23,18, 0,
+    23,23,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0,18,18, 0,18,18, 0, 0, 0, 0,18, 0,18, 0,
+     0, 0, 0, 0, 0, 0, 0,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18, 0,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18, 0,18,18, 0, 0,18,18,18,18,18, 0, 0,
+    18,18,18, 0,18, 0,23, 0,18, 0,23,23,18,18, 0,18,18,18, 0,18,18,18,18,18,18,18, 0,18,18,18,18,18,
+    18, 0, 0, 0, 0,18,18,18,18,18, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0,18,18, 0,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 3, 0, 0, 3, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
+     3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,23,23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0,18,18,18, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+     3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,40,40,18,18, 0, 3,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+     3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0, 3,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18, 0, 0, 0,18,18, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+     3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23, 0, 0,23, 0,23, 0, 0,23,23,23,23,23,23,23,23,23,23, 0,
+    23, 0,23, 0, 0,23,23, 0, 0, 0,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23, 0, 0,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18, 0, 0, 0, 0, 0,23, 0,23,
+    18,18,18,18,18,18,18,18,18,18,23,23,23,23,23,23,23,23,23,23,23,23,23, 0,23,23,23,23,23, 0,23, 0,
+    23,23, 0,23,23, 0,23,23,23,23,23,23,23,23,23,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18, 0,18,18,18,18, 0, 0, 0, 0,18,18,18, 0,18, 0,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0,
+     0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,
+     0, 0,18,18,18,18,18,18, 0, 0,18,18,18,18,18,18, 0, 0,18,18,18,18,18,18, 0, 0,18,18,18, 0, 0, 0,
+    18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 3, 3,40, 3, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,40, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23,23,
+    23,23,23,23,23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,23,23,23,23,23,
+    23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,
+     0, 0,18, 0, 0,18,18, 0, 0,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18, 0,18, 0,18,18,18,
+    18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18, 0,18,18,18,18, 0, 0,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18, 0,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18, 0,
+    18,18,18,18,18, 0,18, 0, 0, 0,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+     0,18,18, 0,18, 0, 0,18, 0,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18, 0,18, 0,18, 0, 0, 0, 0,
+     0, 0,18, 0, 0, 0, 0,18, 0,18, 0,18, 0,18,18,18, 0,18,18, 0,18, 0, 0,18, 0,18, 0,18, 0,18, 0,18,
+     0,18,18, 0,18, 0, 0,18,18,18,18, 0,18,18,18,18,18,18,18, 0,18,18,18,18, 0,18,18,18,18, 0,18, 0,
+    18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0,
+     0,18,18,18, 0,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0,
+    18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0, 0,18,18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,18,18,18,18,18,18,18,18,18,18, 0, 0, 0, 0, 0, 0,
+    23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#define HZ_UCD_MAX_DECOMPOSITION 18
+
+static const uint32_t hz_ucd_canonical_decompositions[2061][2] = {
+    {0x00C0,0x302},{0x00C1,0x342},{0x00C2,0x382},{0x00C3,0x3C2},{0x00C4,0x402},{0x00C5,0x442},
+    {0x00C7,0x482},{0x00C8,0x4C2},{0x00C9,0x502},{0x00CA,0x542},{0x00CB,0x582},{0x00CC,0x5C2},
+    {0x00CD,0x602},{0x00CE,0x642},{0x00CF,0x682},{0x00D1,0x6C2},{0x00D2,0x702},{0x00D3,0x742},
+    {0x00D4,0x782},{0x00D5,0x7C2},{0x00D6,0x802},{0x00D9,0x842},{0x00DA,0x882},{0x00DB,0x8C2},
+    {0x00DC,0x902},{0x00DD,0x942},{0x00E0,0x982},{0x00E1,0x9C2},{0x00E2,0xA02},{0x00E3,0xA42},
+    {0x00E4,0xA82},{0x00E5,0xAC2},{0x00E7,0xB02},{0x00E8,0xB42},{0x00E9,0xB82},{0x00EA,0xBC2},
+    {0x00EB,0xC02},{0x00EC,0xC42},{0x00ED,0xC82},{0x00EE,0xCC2},{0x00EF,0xD02},{0x00F1,0xD42},
+    {0x00F2,0xD82},{0x00F3,0xDC2},{0x00F4,0xE02},{0x00F5,0xE42},{0x00F6,0xE82},{0x00F9,0xEC2},
+    {0x00FA,0xF02},{0x00FB,0xF42},{0x00FC,0xF82},{0x00FD,0xFC2},{0x00FF,0x1002},{0x0100,0x1042},
+    {0x0101,0x1082},{0x0102,0x10C2},{0x0103,0x1102},{0x0104,0x1142},{0x0105,0x1182},{0x0106,0x11C2},
+    {0x0107,0x1202},{0x0108,0x1242},{0x0109,0x1282},{0x010A,0x12C2},{0x010B,0x1302},{0x010C,0x1342},
+    {0x010D,0x1382},{0x010E,0x13C2},{0x010F,0x1402},{0x0112,0x1442},{0x0113,0x1482},{0x0114,0x14C2},
+    {0x0115,0x1502},{0x0116,0x1542},{0x0117,0x1582},{0x0118,0x15C2},{0x0119,0x1602},{0x011A,0x1642},
+    {0x011B,0x1682},{0x011C,0x16C2},{0x011D,0x1702},{0x011E,0x1742},{0x011F,0x1782},{0x0120,0x17C2},
+    {0x0121,0x1802},{0x0122,0x1842},{0x0123,0x1882},{0x0124,0x18C2},{0x0125,0x1902},{0x0128,0x1942},
+    {0x0129,0x1982},{0x012A,0x19C2},{0x012B,0x1A02},{0x012C,0x1A42},{0x012D,0x1A82},{0x012E,0x1AC2},
+    {0x012F,0x1B02},{0x0130,0x1B42},{0x0134,0x1C02},{0x0135,0x1C42},{0x0136,0x1C82},{0x0137,0x1CC2},
+    {0x0139,0x1D02},{0x013A,0x1D42},{0x013B,0x1D82},{0x013C,0x1DC2},{0x013D,0x1E02},{0x013E,0x1E42},
+    {0x0143,0x1F02},{0x0144,0x1F42},{0x0145,0x1F82},{0x0146,0x1FC2},{0x0147,0x2002},{0x0148,0x2042},
+    {0x014C,0x20C2},{0x014D,0x2102},{0x014E,0x2142},{0x014F,0x2182},{0x0150,0x21C2},{0x0151,0x2202},
+    {0x0154,0x2242},{0x0155,0x2282},{0x0156,0x22C2},{0x0157,0x2302},{0x0158,0x2342},{0x0159,0x2382},
+    {0x015A,0x23C2},{0x015B,0x2402},{0x015C,0x2442},{0x015D,0x2482},{0x015E,0x24C2},{0x015F,0x2502},
+    {0x0160,0x2542},{0x0161,0x2582},{0x0162,0x25C2},{0x0163,0x2602},{0x0164,0x2642},{0x0165,0x2682},
+    {0x0168,0x26C2},{0x0169,0x2702},{0x016A,0x2742},{0x016B,0x2782},{0x016C,0x27C2},{0x016D,0x2802},
+    {0x016E,0x2842},{0x016F,0x2882},{0x0170,0x28C2},{0x0171,0x2902},{0x0172,0x2942},{0x0173,0x2982},
+    {0x0174,0x29C2},{0x0175,0x2A02},{0x0176,0x2A42},{0x0177,0x2A82},{0x0178,0x2AC2},{0x0179,0x2B02},
+    {0x017A,0x2B42},{0x017B,0x2B82},{0x017C,0x2BC2},{0x017D,0x2C02},{0x017E,0x2C42},{0x01A0,0x2CA2},
+    {0x01A1,0x2CE2},{0x01AF,0x2D22},{0x01B0,0x2D62},{0x01CD,0x3042},{0x01CE,0x3082},{0x01CF,0x30C2},
+    {0x01D0,0x3102},{0x01D1,0x3142},{0x01D2,0x3182},{0x01D3,0x31C2},{0x01D4,0x3202},{0x01D5,0x3243},
+    {0x01D6,0x32A3},{0x01D7,0x3303},{0x01D8,0x3363},{0x01D9,0x33C3},{0x01DA,0x3423},{0x01DB,0x3483},
+    {0x01DC,0x34E3},{0x01DE,0x3543},{0x01DF,0x35A3},{0x01E0,0x3603},{0x01E1,0x3663},{0x01E2,0x36C2},
+    {0x01E3,0x3702},{0x01E6,0x3742},{0x01E7,0x3782},{0x01E8,0x37C2},{0x01E9,0x3802},{0x01EA,0x3842},
+    {0x01EB,0x3882},{0x01EC,0x38C3},{0x01ED,0x3923},{0x01EE,0x3982},{0x01EF,0x39C2},{0x01F0,0x3A02},
+    {0x01F4,0x3B02},{0x01F5,0x3B42},{0x01F8,0x3B82},{0x01F9,0x3BC2},{0x01FA,0x3C03},{0x01FB,0x3C63},
+    {0x01FC,0x3CC2},{0x01FD,0x3D02},{0x01FE,0x3D42},{0x01FF,0x3D82},{0x0200,0x3DC2},{0x0201,0x3E02},
+    {0x0202,0x3E42},{0x0203,0x3E82},{0x0204,0x3EC2},{0x0205,0x3F02},{0x0206,0x3F42},{0x0207,0x3F82},
+    {0x0208,0x3FC2},{0x0209,0x4002},{0x020A,0x4042},{0x020B,0x4082},{0x020C,0x40C2},{0x020D,0x4102},
+    {0x020E,0x4142},{0x020F,0x4182},{0x0210,0x41C2},{0x0211,0x4202},{0x0212,0x4242},{0x0213,0x4282},
+    {0x0214,0x42C2},{0x0215,0x4302},{0x0216,0x4342},{0x0217,0x4382},{0x0218,0x43C2},{0x0219,0x4402},
+    {0x021A,0x4442},{0x021B,0x4482},{0x021E,0x44C2},{0x021F,0x4502},{0x0226,0x4542},{0x0227,0x4582},
+    {0x0228,0x45C2},{0x0229,0x4602},{0x022A,0x4643},{0x022B,0x46A3},{0x022C,0x4703},{0x022D,0x4763},
+    {0x022E,0x47C2},{0x022F,0x4802},{0x0230,0x4843},{0x0231,0x48A3},{0x0232,0x4902},{0x0233,0x4942},
+    {0x0340,0x4CC1},{0x0341,0x4CE1},{0x0343,0x4D01},{0x0344,0x4D22},{0x0374,0x4D61},{0x037E,0x4DC1},
+    {0x0385,0x4E22},{0x0386,0x4EC2},{0x0387,0x4F01},{0x0388,0x4F22},{0x0389,0x4F62},{0x038A,0x4FA2},
+    {0x038C,0x4FE2},{0x038E,0x5022},{0x038F,0x5062},{0x0390,0x50A3},{0x03AA,0x5102},{0x03AB,0x5142},
+    {0x03AC,0x5182},{0x03AD,0x51C2},{0x03AE,0x5202},{0x03AF,0x5242},{0x03B0,0x5283},{0x03CA,0x52E2},
+    {0x03CB,0x5322},{0x03CC,0x5362},{0x03CD,0x53A2},{0x03CE,0x53E2},{0x03D3,0x5482},{0x03D4,0x5502},
+    {0x0400,0x5682},{0x0401,0x56C2},{0x0403,0x5702},{0x0407,0x5742},{0x040C,0x5782},{0x040D,0x57C2},
+    {0x040E,0x5802},{0x0419,0x5842},{0x0439,0x5882},{0x0450,0x58C2},{0x0451,0x5902},{0x0453,0x5942},
+    {0x0457,0x5982},{0x045C,0x59C2},{0x045D,0x5A02},{0x045E,0x5A42},{0x0476,0x5A82},{0x0477,0x5AC2},
+    {0x04C1,0x5B02},{0x04C2,0x5B42},{0x04D0,0x5B82},{0x04D1,0x5BC2},{0x04D2,0x5C02},{0x04D3,0x5C42},
+    {0x04D6,0x5C82},{0x04D7,0x5CC2},{0x04DA,0x5D02},{0x04DB,0x5D42},{0x04DC,0x5D82},{0x04DD,0x5DC2},
+    {0x04DE,0x5E02},{0x04DF,0x5E42},{0x04E2,0x5E82},{0x04E3,0x5EC2},{0x04E4,0x5F02},{0x04E5,0x5F42},
+    {0x04E6,0x5F82},{0x04E7,0x5FC2},{0x04EA,0x6002},{0x04EB,0x6042},{0x04EC,0x6082},{0x04ED,0x60C2},
+    {0x04EE,0x6102},{0x04EF,0x6142},{0x04F0,0x6182},{0x04F1,0x61C2},{0x04F2,0x6202},{0x04F3,0x6242},
+    {0x04F4,0x6282},{0x04F5,0x62C2},{0x04F8,0x6302},{0x04F9,0x6342},{0x0622,0x63C2},{0x0623,0x6402},
+    {0x0624,0x6442},{0x0625,0x6482},{0x0626,0x64C2},{0x06C0,0x6602},{0x06C2,0x6642},{0x06D3,0x6682},
+    {0x0929,0x66C2},{0x0931,0x6702},{0x0934,0x6742},{0x0958,0x6782},{0x0959,0x67C2},{0x095A,0x6802},
+    {0x095B,0x6842},{0x095C,0x6882},{0x095D,0x68C2},{0x095E,0x6902},{0x095F,0x6942},{0x09CB,0x6982},
+    {0x09CC,0x69C2},{0x09DC,0x6A02},{0x09DD,0x6A42},{0x09DF,0x6A82},{0x0A33,0x6AC2},{0x0A36,0x6B02},
+    {0x0A59,0x6B42},{0x0A5A,0x6B82},{0x0A5B,0x6BC2},{0x0A5E,0x6C02},{0x0B48,0x6C42},{0x0B4B,0x6C82},
+    {0x0B4C,0x6CC2},{0x0B5C,0x6D02},{0x0B5D,0x6D42},{0x0B94,0x6D82},{0x0BCA,0x6DC2},{0x0BCB,0x6E02},
+    {0x0BCC,0x6E42},{0x0C48,0x6E82},{0x0CC0,0x6EC2},{0x0CC7,0x6F02},{0x0CC8,0x6F42},{0x0CCA,0x6F82},
+    {0x0CCB,0x6FC3},{0x0D4A,0x7022},{0x0D4B,0x7062},{0x0D4C,0x70A2},{0x0DDA,0x70E2},{0x0DDC,0x7122},
+    {0x0DDD,0x7163},{0x0DDE,0x71C2},{0x0F43,0x7322},{0x0F4D,0x7362},{0x0F52,0x73A2},{0x0F57,0x73E2},
+    {0x0F5C,0x7422},{0x0F69,0x7462},{0x0F73,0x74A2},{0x0F75,0x74E2},{0x0F76,0x7522},{0x0F78,0x75C2},
+    {0x0F81,0x7662},{0x0F93,0x76A2},{0x0F9D,0x76E2},{0x0FA2,0x7722},{0x0FA7,0x7762},{0x0FAC,0x77A2},
+    {0x0FB9,0x77E2},{0x1026,0x7822},{0x1B06,0x7882},{0x1B08,0x78C2},{0x1B0A,0x7902},{0x1B0C,0x7942},
+    {0x1B0E,0x7982},{0x1B12,0x79C2},{0x1B3B,0x7A02},{0x1B3D,0x7A42},{0x1B40,0x7A82},{0x1B41,0x7AC2},
+    {0x1B43,0x7B02},{0x1E00,0x8782},{0x1E01,0x87C2},{0x1E02,0x8802},{0x1E03,0x8842},{0x1E04,0x8882},
+    {0x1E05,0x88C2},{0x1E06,0x8902},{0x1E07,0x8942},{0x1E08,0x8983},{0x1E09,0x89E3},{0x1E0A,0x8A42},
+    {0x1E0B,0x8A82},{0x1E0C,0x8AC2},{0x1E0D,0x8B02},{0x1E0E,0x8B42},{0x1E0F,0x8B82},{0x1E10,0x8BC2},
+    {0x1E11,0x8C02},{0x1E12,0x8C42},{0x1E13,0x8C82},{0x1E14,0x8CC3},{0x1E15,0x8D23},{0x1E16,0x8D83},
+    {0x1E17,0x8DE3},{0x1E18,0x8E42},{0x1E19,0x8E82},{0x1E1A,0x8EC2},{0x1E1B,0x8F02},{0x1E1C,0x8F43},
+    {0x1E1D,0x8FA3},{0x1E1E,0x9002},{0x1E1F,0x9042},{0x1E20,0x9082},{0x1E21,0x90C2},{0x1E22,0x9102},
+    {0x1E23,0x9142},{0x1E24,0x9182},{0x1E25,0x91C2},{0x1E26,0x9202},{0x1E27,0x9242},{0x1E28,0x9282},
+    {0x1E29,0x92C2},{0x1E2A,0x9302},{0x1E2B,0x9342},{0x1E2C,0x9382},{0x1E2D,0x93C2},{0x1E2E,0x9403},
+    {0x1E2F,0x9463},{0x1E30,0x94C2},{0x1E31,0x9502},{0x1E32,0x9542},{0x1E33,0x9582},{0x1E34,0x95C2},
+    {0x1E35,0x9602},{0x1E36,0x9642},{0x1E37,0x9682},{0x1E38,0x96C3},{0x1E39,0x9723},{0x1E3A,0x9782},
+    {0x1E3B,0x97C2},{0x1E3C,0x9802},{0x1E3D,0x9842},{0x1E3E,0x9882},{0x1E3F,0x98C2},{0x1E40,0x9902},
+    {0x1E41,0x9942},{0x1E42,0x9982},{0x1E43,0x99C2},{0x1E44,0x9A02},{0x1E45,0x9A42},{0x1E46,0x9A82},
+    {0x1E47,0x9AC2},{0x1E48,0x9B02},{0x1E49,0x9B42},{0x1E4A,0x9B82},{0x1E4B,0x9BC2},{0x1E4C,0x9C03},
+    {0x1E4D,0x9C63},{0x1E4E,0x9CC3},{0x1E4F,0x9D23},{0x1E50,0x9D83},{0x1E51,0x9DE3},{0x1E52,0x9E43},
+    {0x1E53,0x9EA3},{0x1E54,0x9F02},{0x1E55,0x9F42},{0x1E56,0x9F82},{0x1E57,0x9FC2},{0x1E58,0xA002},
+    {0x1E59,0xA042},{0x1E5A,0xA082},{0x1E5B,0xA0C2},{0x1E5C,0xA103},{0x1E5D,0xA163},{0x1E5E,0xA1C2},
+    {0x1E5F,0xA202},{0x1E60,0xA242},{0x1E61,0xA282},{0x1E62,0xA2C2},{0x1E63,0xA302},{0x1E64,0xA343},
+    {0x1E65,0xA3A3},{0x1E66,0xA403},{0x1E67,0xA463},{0x1E68,0xA4C3},{0x1E69,0xA523},{0x1E6A,0xA582},
+    {0x1E6B,0xA5C2},{0x1E6C,0xA602},{0x1E6D,0xA642},{0x1E6E,0xA682},{0x1E6F,0xA6C2},{0x1E70,0xA702},
+    {0x1E71,0xA742},{0x1E72,0xA782},{0x1E73,0xA7C2},{0x1E74,0xA802},{0x1E75,0xA842},{0x1E76,0xA882},
+    {0x1E77,0xA8C2},{0x1E78,0xA903},{0x1E79,0xA963},{0x1E7A,0xA9C3},{0x1E7B,0xAA23},{0x1E7C,0xAA82},
+    {0x1E7D,0xAAC2},{0x1E7E,0xAB02},{0x1E7F,0xAB42},{0x1E80,0xAB82},{0x1E81,0xABC2},{0x1E82,0xAC02},
+    {0x1E83,0xAC42},{0x1E84,0xAC82},{0x1E85,0xACC2},{0x1E86,0xAD02},{0x1E87,0xAD42},{0x1E88,0xAD82},
+    {0x1E89,0xADC2},{0x1E8A,0xAE02},{0x1E8B,0xAE42},{0x1E8C,0xAE82},{0x1E8D,0xAEC2},{0x1E8E,0xAF02},
+    {0x1E8F,0xAF42},{0x1E90,0xAF82},{0x1E91,0xAFC2},{0x1E92,0xB002},{0x1E93,0xB042},{0x1E94,0xB082},
+    {0x1E95,0xB0C2},{0x1E96,0xB102},{0x1E97,0xB142},{0x1E98,0xB182},{0x1E99,0xB1C2},{0x1E9B,0xB242},
+    {0x1EA0,0xB2C2},{0x1EA1,0xB302},{0x1EA2,0xB342},{0x1EA3,0xB382},{0x1EA4,0xB3C3},{0x1EA5,0xB423},
+    {0x1EA6,0xB483},{0x1EA7,0xB4E3},{0x1EA8,0xB543},{0x1EA9,0xB5A3},{0x1EAA,0xB603},{0x1EAB,0xB663},
+    {0x1EAC,0xB6C3},{0x1EAD,0xB723},{0x1EAE,0xB783},{0x1EAF,0xB7E3},{0x1EB0,0xB843},{0x1EB1,0xB8A3},
+    {0x1EB2,0xB903},{0x1EB3,0xB963},{0x1EB4,0xB9C3},{0x1EB5,0xBA23},{0x1EB6,0xBA83},{0x1EB7,0xBAE3},
+    {0x1EB8,0xBB42},{0x1EB9,0xBB82},{0x1EBA,0xBBC2},{0x1EBB,0xBC02},{0x1EBC,0xBC42},{0x1EBD,0xBC82},
+    {0x1EBE,0xBCC3},{0x1EBF,0xBD23},{0x1EC0,0xBD83},{0x1EC1,0xBDE3},{0x1EC2,0xBE43},{0x1EC3,0xBEA3},
+    {0x1EC4,0xBF03},{0x1EC5,0xBF63},{0x1EC6,0xBFC3},{0x1EC7,0xC023},{0x1EC8,0xC082},{0x1EC9,0xC0C2},
+    {0x1ECA,0xC102},{0x1ECB,0xC142},{0x1ECC,0xC182},{0x1ECD,0xC1C2},{0x1ECE,0xC202},{0x1ECF,0xC242},
+    {0x1ED0,0xC283},{0x1ED1,0xC2E3},{0x1ED2,0xC343},{0x1ED3,0xC3A3},{0x1ED4,0xC403},{0x1ED5,0xC463},
+    {0x1ED6,0xC4C3},{0x1ED7,0xC523},{0x1ED8,0xC583},{0x1ED9,0xC5E3},{0x1EDA,0xC643},{0x1EDB,0xC6A3},
+    {0x1EDC,0xC703},{0x1EDD,0xC763},{0x1EDE,0xC7C3},{0x1EDF,0xC823},{0x1EE0,0xC883},{0x1EE1,0xC8E3},
+    {0x1EE2,0xC943},{0x1EE3,0xC9A3},{0x1EE4,0xCA02},{0x1EE5,0xCA42},{0x1EE6,0xCA82},{0x1EE7,0xCAC2},
+    {0x1EE8,0xCB03},{0x1EE9,0xCB63},{0x1EEA,0xCBC3},{0x1EEB,0xCC23},{0x1EEC,0xCC83},{0x1EED,0xCCE3},
+    {0x1EEE,0xCD43},{0x1EEF,0xCDA3},{0x1EF0,0xCE03},{0x1EF1,0xCE63},{0x1EF2,0xCEC2},{0x1EF3,0xCF02},
+    {0x1EF4,0xCF42},{0x1EF5,0xCF82},{0x1EF6,0xCFC2},{0x1EF7,0xD002},{0x1EF8,0xD042},{0x1EF9,0xD082},
+    {0x1F00,0xD0C2},{0x1F01,0xD102},{0x1F02,0xD143},{0x1F03,0xD1A3},{0x1F04,0xD203},{0x1F05,0xD263},
+    {0x1F06,0xD2C3},{0x1F07,0xD323},{0x1F08,0xD382},{0x1F09,0xD3C2},{0x1F0A,0xD403},{0x1F0B,0xD463},
+    {0x1F0C,0xD4C3},{0x1F0D,0xD523},{0x1F0E,0xD583},{0x1F0F,0xD5E3},{0x1F10,0xD642},{0x1F11,0xD682},
+    {0x1F12,0xD6C3},{0x1F13,0xD723},{0x1F14,0xD783},{0x1F15,0xD7E3},{0x1F18,0xD842},{0x1F19,0xD882},
+    {0x1F1A,0xD8C3},{0x1F1B,0xD923},{0x1F1C,0xD983},{0x1F1D,0xD9E3},{0x1F20,0xDA42},{0x1F21,0xDA82},
+    {0x1F22,0xDAC3},{0x1F23,0xDB23},{0x1F24,0xDB83},{0x1F25,0xDBE3},{0x1F26,0xDC43},{0x1F27,0xDCA3},
+    {0x1F28,0xDD02},{0x1F29,0xDD42},{0x1F2A,0xDD83},{0x1F2B,0xDDE3},{0x1F2C,0xDE43},{0x1F2D,0xDEA3},
+    {0x1F2E,0xDF03},{0x1F2F,0xDF63},{0x1F30,0xDFC2},{0x1F31,0xE002},{0x1F32,0xE043},{0x1F33,0xE0A3},
+    {0x1F34,0xE103},{0x1F35,0xE163},{0x1F36,0xE1C3},{0x1F37,0xE223},{0x1F38,0xE282},{0x1F39,0xE2C2},
+    {0x1F3A,0xE303},{0x1F3B,0xE363},{0x1F3C,0xE3C3},{0x1F3D,0xE423},{0x1F3E,0xE483},{0x1F3F,0xE4E3},
+    {0x1F40,0xE542},{0x1F41,0xE582},{0x1F42,0xE5C3},{0x1F43,0xE623},{0x1F44,0xE683},{0x1F45,0xE6E3},
+    {0x1F48,0xE742},{0x1F49,0xE782},{0x1F4A,0xE7C3},{0x1F4B,0xE823},{0x1F4C,0xE883},{0x1F4D,0xE8E3},
+    {0x1F50,0xE942},{0x1F51,0xE982},{0x1F52,0xE9C3},{0x1F53,0xEA23},{0x1F54,0xEA83},{0x1F55,0xEAE3},
+    {0x1F56,0xEB43},{0x1F57,0xEBA3},{0x1F59,0xEC02},{0x1F5B,0xEC43},{0x1F5D,0xECA3},{0x1F5F,0xED03},
+    {0x1F60,0xED62},{0x1F61,0xEDA2},{0x1F62,0xEDE3},{0x1F63,0xEE43},{0x1F64,0xEEA3},{0x1F65,0xEF03},
+    {0x1F66,0xEF63},{0x1F67,0xEFC3},{0x1F68,0xF022},{0x1F69,0xF062},{0x1F6A,0xF0A3},{0x1F6B,0xF103},
+    {0x1F6C,0xF163},{0x1F6D,0xF1C3},{0x1F6E,0xF223},{0x1F6F,0xF283},{0x1F70,0xF2E2},{0x1F71,0xF322},
+    {0x1F72,0xF362},{0x1F73,0xF3A2},{0x1F74,0xF3E2},{0x1F75,0xF422},{0x1F76,0xF462},{0x1F77,0xF4A2},
+    {0x1F78,0xF4E2},{0x1F79,0xF522},{0x1F7A,0xF562},{0x1F7B,0xF5A2},{0x1F7C,0xF5E2},{0x1F7D,0xF622},
+    {0x1F80,0xF663},{0x1F81,0xF6C3},{0x1F82,0xF724},{0x1F83,0xF7A4},{0x1F84,0xF824},{0x1F85,0xF8A4},
+    {0x1F86,0xF924},{0x1F87,0xF9A4},{0x1F88,0xFA23},{0x1F89,0xFA83},{0x1F8A,0xFAE4},{0x1F8B,0xFB64},
+    {0x1F8C,0xFBE4},{0x1F8D,0xFC64},{0x1F8E,0xFCE4},{0x1F8F,0xFD64},{0x1F90,0xFDE3},{0x1F91,0xFE43},
+    {0x1F92,0xFEA4},{0x1F93,0xFF24},{0x1F94,0xFFA4},{0x1F95,0x10024},{0x1F96,0x100A4},{0x1F97,0x10124},
+    {0x1F98,0x101A3},{0x1F99,0x10203},{0x1F9A,0x10264},{0x1F9B,0x102E4},{0x1F9C,0x10364},{0x1F9D,0x103E4},
+    {0x1F9E,0x10464},{0x1F9F,0x104E4},{0x1FA0,0x10563},{0x1FA1,0x105C3},{0x1FA2,0x10624},{0x1FA3,0x106A4},
+    {0x1FA4,0x10724},{0x1FA5,0x107A4},{0x1FA6,0x10824},{0x1FA7,0x108A4},{0x1FA8,0x10923},{0x1FA9,0x10983},
+    {0x1FAA,0x109E4},{0x1FAB,0x10A64},{0x1FAC,0x10AE4},{0x1FAD,0x10B64},{0x1FAE,0x10BE4},{0x1FAF,0x10C64},
+    {0x1FB0,0x10CE2},{0x1FB1,0x10D22},{0x1FB2,0x10D63},{0x1FB3,0x10DC2},{0x1FB4,0x10E03},{0x1FB6,0x10E62},
+    {0x1FB7,0x10EA3},{0x1FB8,0x10F02},{0x1FB9,0x10F42},{0x1FBA,0x10F82},{0x1FBB,0x10FC2},{0x1FBC,0x11002},
+    {0x1FBE,0x11081},{0x1FC1,0x11122},{0x1FC2,0x111C3},{0x1FC3,0x11222},{0x1FC4,0x11263},{0x1FC6,0x112C2},
+    {0x1FC7,0x11303},{0x1FC8,0x11362},{0x1FC9,0x113A2},{0x1FCA,0x113E2},{0x1FCB,0x11422},{0x1FCC,0x11462},
+    {0x1FCD,0x114A2},{0x1FCE,0x11542},{0x1FCF,0x115E2},{0x1FD0,0x11682},{0x1FD1,0x116C2},{0x1FD2,0x11703},
+    {0x1FD3,0x11763},{0x1FD6,0x117C2},{0x1FD7,0x11803},{0x1FD8,0x11862},{0x1FD9,0x118A2},{0x1FDA,0x118E2},
+    {0x1FDB,0x11922},{0x1FDD,0x11962},{0x1FDE,0x11A02},{0x1FDF,0x11AA2},{0x1FE0,0x11B42},{0x1FE1,0x11B82},
+    {0x1FE2,0x11BC3},{0x1FE3,0x11C23},{0x1FE4,0x11C82},{0x1FE5,0x11CC2},{0x1FE6,0x11D02},{0x1FE7,0x11D43},
+    {0x1FE8,0x11DA2},{0x1FE9,0x11DE2},{0x1FEA,0x11E22},{0x1FEB,0x11E62},{0x1FEC,0x11EA2},{0x1FED,0x11EE2},
+    {0x1FEE,0x11F82},{0x1FEF,0x12021},{0x1FF2,0x12043},{0x1FF3,0x120A2},{0x1FF4,0x120E3},{0x1FF6,0x12142},
+    {0x1FF7,0x12183},{0x1FF8,0x121E2},{0x1FF9,0x12222},{0x1FFA,0x12262},{0x1FFB,0x122A2},{0x1FFC,0x122E2},
+    {0x1FFD,0x12321},{0x2000,0x123C1},{0x2001,0x12401},{0x2126,0x134C1},{0x212A,0x13501},{0x212B,0x13522},
+    {0x219A,0x14662},{0x219B,0x146A2},{0x21AE,0x146E2},{0x21CD,0x14722},{0x21CE,0x14762},{0x21CF,0x147A2},
+    {0x2204,0x147E2},{0x2209,0x14822},{0x220C,0x14862},{0x2224,0x148A2},{0x2226,0x148E2},{0x2241,0x14A62},
+    {0x2244,0x14AA2},{0x2247,0x14AE2},{0x2249,0x14B22},{0x2260,0x14B62},{0x2262,0x14BA2},{0x226D,0x14BE2},
+    {0x226E,0x14C22},{0x226F,0x14C62},{0x2270,0x14CA2},{0x2271,0x14CE2},{0x2274,0x14D22},{0x2275,0x14D62},
+    {0x2278,0x14DA2},{0x2279,0x14DE2},{0x2280,0x14E22},{0x2281,0x14E62},{0x2284,0x14EA2},{0x2285,0x14EE2},
+    {0x2288,0x14F22},{0x2289,0x14F62},{0x22AC,0x14FA2},{0x22AD,0x14FE2},{0x22AE,0x15022},{0x22AF,0x15062},
+    {0x22E0,0x150A2},{0x22E1,0x150E2},{0x22E2,0x15122},{0x22E3,0x15162},{0x22EA,0x151A2},{0x22EB,0x151E2},
+    {0x22EC,0x15222},{0x22ED,0x15262},{0x2329,0x152A1},{0x232A,0x152C1},{0x2ADC,0x177E2},{0x304C,0x19422},
+    {0x304E,0x19462},{0x3050,0x194A2},{0x3052,0x194E2},{0x3054,0x19522},{0x3056,0x19562},{0x3058,0x195A2},
+    {0x305A,0x195E2},{0x305C,0x19622},{0x305E,0x19662},{0x3060,0x196A2},{0x3062,0x196E2},{0x3065,0x19722},
+    {0x3067,0x19762},{0x3069,0x197A2},{0x3070,0x197E2},{0x3071,0x19822},{0x3073,0x19862},{0x3074,0x198A2},
+    {0x3076,0x198E2},{0x3077,0x19922},{0x3079,0x19962},{0x307A,0x199A2},{0x307C,0x199E2},{0x307D,0x19A22},
+    {0x3094,0x19A62},{0x309E,0x19B22},{0x30AC,0x19BA2},{0x30AE,0x19BE2},{0x30B0,0x19C22},{0x30B2,0x19C62},
+    {0x30B4,0x19CA2},{0x30B6,0x19CE2},{0x30B8,0x19D22},{0x30BA,0x19D62},{0x30BC,0x19DA2},{0x30BE,0x19DE2},
+    {0x30C0,0x19E22},{0x30C2,0x19E62},{0x30C5,0x19EA2},{0x30C7,0x19EE2},{0x30C9,0x19F22},{0x30D0,0x19F62},
+    {0x30D1,0x19FA2},{0x30D3,0x19FE2},{0x30D4,0x1A022},{0x30D6,0x1A062},{0x30D7,0x1A0A2},{0x30D9,0x1A0E2},
+    {0x30DA,0x1A122},{0x30DC,0x1A162},{0x30DD,0x1A1A2},{0x30F4,0x1A1E2},{0x30F7,0x1A222},{0x30F8,0x1A262},
+    {0x30F9,0x1A2A2},{0x30FA,0x1A2E2},{0x30FE,0x1A322},{0xF900,0x24E81},{0xF901,0x24EA1},{0xF902,0x24EC1},
+    {0xF903,0x24EE1},{0xF904,0x24F01},{0xF905,0x24F21},{0xF906,0x24F41},{0xF907,0x24F61},{0xF908,0x24F81},
+    {0xF909,0x24FA1},{0xF90A,0x24FC1},{0xF90B,0x24FE1},{0xF90C,0x25001},{0xF90D,0x25021},{0xF90E,0x25041},
+    {0xF90F,0x25061},{0xF910,0x25081},{0xF911,0x250A1},{0xF912,0x250C1},{0xF913,0x250E1},{0xF914,0x25101},
+    {0xF915,0x25121},{0xF916,0x25141},{0xF917,0x25161},{0xF918,0x25181},{0xF919,0x251A1},{0xF91A,0x251C1},
+    {0xF91B,0x251E1},{0xF91C,0x25201},{0xF91D,0x25221},{0xF91E,0x25241},{0xF91F,0x25261},{0xF920,0x25281},
+    {0xF921,0x252A1},{0xF922,0x252C1},{0xF923,0x252E1},{0xF924,0x25301},{0xF925,0x25321},{0xF926,0x25341},
+    {0xF927,0x25361},{0xF928,0x25381},{0xF929,0x253A1},{0xF92A,0x253C1},{0xF92B,0x253E1},{0xF92C,0x25401},
+    {0xF92D,0x25421},{0xF92E,0x25441},{0xF92F,0x25461},{0xF930,0x25481},{0xF931,0x254A1},{0xF932,0x254C1},
+    {0xF933,0x254E1},{0xF934,0x25501},{0xF935,0x25521},{0xF936,0x25541},{0xF937,0x25561},{0xF938,0x25581},
+    {0xF939,0x255A1},{0xF93A,0x255C1},{0xF93B,0x255E1},{0xF93C,0x25601},{0xF93D,0x25621},{0xF93E,0x25641},
+    {0xF93F,0x25661},{0xF940,0x25681},{0xF941,0x256A1},{0xF942,0x256C1},{0xF943,0x256E1},{0xF944,0x25701},
+    {0xF945,0x25721},{0xF946,0x25741},{0xF947,0x25761},{0xF948,0x25781},{0xF949,0x257A1},{0xF94A,0x257C1},
+    {0xF94B,0x257E1},{0xF94C,0x25801},{0xF94D,0x25821},{0xF94E,0x25841},{0xF94F,0x25861},{0xF950,0x25881},
+    {0xF951,0x258A1},{0xF952,0x258C1},{0xF953,0x258E1},{0xF954,0x25901},{0xF955,0x25921},{0xF956,0x25941},
+    {0xF957,0x25961},{0xF958,0x25981},{0xF959,0x259A1},{0xF95A,0x259C1},{0xF95B,0x259E1},{0xF95C,0x25A01},
+    {0xF95D,0x25A21},{0xF95E,0x25A41},{0xF95F,0x25A61},{0xF960,0x25A81},{0xF961,0x25AA1},{0xF962,0x25AC1},
+    {0xF963,0x25AE1},{0xF964,0x25B01},{0xF965,0x25B21},{0xF966,0x25B41},{0xF967,0x25B61},{0xF968,0x25B81},
+    {0xF969,0x25BA1},{0xF96A,0x25BC1},{0xF96B,0x25BE1},{0xF96C,0x25C01},{0xF96D,0x25C21},{0xF96E,0x25C41},
+    {0xF96F,0x25C61},{0xF970,0x25C81},{0xF971,0x25CA1},{0xF972,0x25CC1},{0xF973,0x25CE1},{0xF974,0x25D01},
+    {0xF975,0x25D21},{0xF976,0x25D41},{0xF977,0x25D61},{0xF978,0x25D81},{0xF979,0x25DA1},{0xF97A,0x25DC1},
+    {0xF97B,0x25DE1},{0xF97C,0x25E01},{0xF97D,0x25E21},{0xF97E,0x25E41},{0xF97F,0x25E61},{0xF980,0x25E81},
+    {0xF981,0x25EA1},{0xF982,0x25EC1},{0xF983,0x25EE1},{0xF984,0x25F01},{0xF985,0x25F21},{0xF986,0x25F41},
+    {0xF987,0x25F61},{0xF988,0x25F81},{0xF989,0x25FA1},{0xF98A,0x25FC1},{0xF98B,0x25FE1},{0xF98C,0x26001},
+    {0xF98D,0x26021},{0xF98E,0x26041},{0xF98F,0x26061},{0xF990,0x26081},{0xF991,0x260A1},{0xF992,0x260C1},
+    {0xF993,0x260E1},{0xF994,0x26101},{0xF995,0x26121},{0xF996,0x26141},{0xF997,0x26161},{0xF998,0x26181},
+    {0xF999,0x261A1},{0xF99A,0x261C1},{0xF99B,0x261E1},{0xF99C,0x26201},{0xF99D,0x26221},{0xF99E,0x26241},
+    {0xF99F,0x26261},{0xF9A0,0x26281},{0xF9A1,0x262A1},{0xF9A2,0x262C1},{0xF9A3,0x262E1},{0xF9A4,0x26301},
+    {0xF9A5,0x26321},{0xF9A6,0x26341},{0xF9A7,0x26361},{0xF9A8,0x26381},{0xF9A9,0x263A1},{0xF9AA,0x263C1},
+    {0xF9AB,0x263E1},{0xF9AC,0x26401},{0xF9AD,0x26421},{0xF9AE,0x26441},{0xF9AF,0x26461},{0xF9B0,0x26481},
+    {0xF9B1,0x264A1},{0xF9B2,0x264C1},{0xF9B3,0x264E1},{0xF9B4,0x26501},{0xF9B5,0x26521},{0xF9B6,0x26541},
+    {0xF9B7,0x26561},{0xF9B8,0x26581},{0xF9B9,0x265A1},{0xF9BA,0x265C1},{0xF9BB,0x265E1},{0xF9BC,0x26601},
+    {0xF9BD,0x26621},{0xF9BE,0x26641},{0xF9BF,0x26661},{0xF9C0,0x26681},{0xF9C1,0x266A1},{0xF9C2,0x266C1},
+    {0xF9C3,0x266E1},{0xF9C4,0x26701},{0xF9C5,0x26721},{0xF9C6,0x26741},{0xF9C7,0x26761},{0xF9C8,0x26781},
+    {0xF9C9,0x267A1},{0xF9CA,0x267C1},{0xF9CB,0x267E1},{0xF9CC,0x26801},{0xF9CD,0x26821},{0xF9CE,0x26841},
+    {0xF9CF,0x26861},{0xF9D0,0x26881},{0xF9D1,0x268A1},{0xF9D2,0x268C1},{0xF9D3,0x268E1},{0xF9D4,0x26901},
+    {0xF9D5,0x26921},{0xF9D6,0x26941},{0xF9D7,0x26961},{0xF9D8,0x26981},{0xF9D9,0x269A1},{0xF9DA,0x269C1},
+    {0xF9DB,0x269E1},{0xF9DC,0x26A01},{0xF9DD,0x26A21},{0xF9DE,0x26A41},{0xF9DF,0x26A61},{0xF9E0,0x26A81},
+    {0xF9E1,0x26AA1},{0xF9E2,0x26AC1},{0xF9E3,0x26AE1},{0xF9E4,0x26B01},{0xF9E5,0x26B21},{0xF9E6,0x26B41},
+    {0xF9E7,0x26B61},{0xF9E8,0x26B81},{0xF9E9,0x26BA1},{0xF9EA,0x26BC1},{0xF9EB,0x26BE1},{0xF9EC,0x26C01},
+    {0xF9ED,0x26C21},{0xF9EE,0x26C41},{0xF9EF,0x26C61},{0xF9F0,0x26C81},{0xF9F1,0x26CA1},{0xF9F2,0x26CC1},
+    {0xF9F3,0x26CE1},{0xF9F4,0x26D01},{0xF9F5,0x26D21},{0xF9F6,0x26D41},{0xF9F7,0x26D61},{0xF9F8,0x26D81},
+    {0xF9F9,0x26DA1},{0xF9FA,0x26DC1},{0xF9FB,0x26DE1},{0xF9FC,0x26E01},{0xF9FD,0x26E21},{0xF9FE,0x26E41},
+    {0xF9FF,0x26E61},{0xFA00,0x26E81},{0xFA01,0x26EA1},{0xFA02,0x26EC1},{0xFA03,0x26EE1},{0xFA04,0x26F01},
+    {0xFA05,0x26F21},{0xFA06,0x26F41},{0xFA07,0x26F61},{0xFA08,0x26F81},{0xFA09,0x26FA1},{0xFA0A,0x26FC1},
+    {0xFA0B,0x26FE1},{0xFA0C,0x27001},{0xFA0D,0x27021},{0xFA10,0x27041},{0xFA12,0x27061},{0xFA15,0x27081},
+    {0xFA16,0x270A1},{0xFA17,0x270C1},{0xFA18,0x270E1},{0xFA19,0x27101},{0xFA1A,0x27121},{0xFA1B,0x27141},
+    {0xFA1C,0x27161},{0xFA1D,0x27181},{0xFA1E,0x271A1},{0xFA20,0x271C1},{0xFA22,0x271E1},{0xFA25,0x27201},
+    {0xFA26,0x27221},{0xFA2A,0x27241},{0xFA2B,0x27261},{0xFA2C,0x27281},{0xFA2D,0x272A1},{0xFA2E,0x272C1},
+    {0xFA2F,0x272E1},{0xFA30,0x27301},{0xFA31,0x27321},{0xFA32,0x27341},{0xFA33,0x27361},{0xFA34,0x27381},
+    {0xFA35,0x273A1},{0xFA36,0x273C1},{0xFA37,0x273E1},{0xFA38,0x27401},{0xFA39,0x27421},{0xFA3A,0x27441},
+    {0xFA3B,0x27461},{0xFA3C,0x27481},{0xFA3D,0x274A1},{0xFA3E,0x274C1},{0xFA3F,0x274E1},{0xFA40,0x27501},
+    {0xFA41,0x27521},{0xFA42,0x27541},{0xFA43,0x27561},{0xFA44,0x27581},{0xFA45,0x275A1},{0xFA46,0x275C1},
+    {0xFA47,0x275E1},{0xFA48,0x27601},{0xFA49,0x27621},{0xFA4A,0x27641},{0xFA4B,0x27661},{0xFA4C,0x27681},
+    {0xFA4D,0x276A1},{0xFA4E,0x276C1},{0xFA4F,0x276E1},{0xFA50,0x27701},{0xFA51,0x27721},{0xFA52,0x27741},
+    {0xFA53,0x27761},{0xFA54,0x27781},{0xFA55,0x277A1},{0xFA56,0x277C1},{0xFA57,0x277E1},{0xFA58,0x27801},
+    {0xFA59,0x27821},{0xFA5A,0x27841},{0xFA5B,0x27861},{0xFA5C,0x27881},{0xFA5D,0x278A1},{0xFA5E,0x278C1},
+    {0xFA5F,0x278E1},{0xFA60,0x27901},{0xFA61,0x27921},{0xFA62,0x27941},{0xFA63,0x27961},{0xFA64,0x27981},
+    {0xFA65,0x279A1},{0xFA66,0x279C1},{0xFA67,0x279E1},{0xFA68,0x27A01},{0xFA69,0x27A21},{0xFA6A,0x27A41},
+    {0xFA6B,0x27A61},{0xFA6C,0x27A81},{0xFA6D,0x27AA1},{0xFA70,0x27AC1},{0xFA71,0x27AE1},{0xFA72,0x27B01},
+    {0xFA73,0x27B21},{0xFA74,0x27B41},{0xFA75,0x27B61},{0xFA76,0x27B81},{0xFA77,0x27BA1},{0xFA78,0x27BC1},
+    {0xFA79,0x27BE1},{0xFA7A,0x27C01},{0xFA7B,0x27C21},{0xFA7C,0x27C41},{0xFA7D,0x27C61},{0xFA7E,0x27C81},
+    {0xFA7F,0x27CA1},{0xFA80,0x27CC1},{0xFA81,0x27CE1},{0xFA82,0x27D01},{0xFA83,0x27D21},{0xFA84,0x27D41},
+    {0xFA85,0x27D61},{0xFA86,0x27D81},{0xFA87,0x27DA1},{0xFA88,0x27DC1},{0xFA89,0x27DE1},{0xFA8A,0x27E01},
+    {0xFA8B,0x27E21},{0xFA8C,0x27E41},{0xFA8D,0x27E61},{0xFA8E,0x27E81},{0xFA8F,0x27EA1},{0xFA90,0x27EC1},
+    {0xFA91,0x27EE1},{0xFA92,0x27F01},{0xFA93,0x27F21},{0xFA94,0x27F41},{0xFA95,0x27F61},{0xFA96,0x27F81},
+    {0xFA97,0x27FA1},{0xFA98,0x27FC1},{0xFA99,0x27FE1},{0xFA9A,0x28001},{0xFA9B,0x28021},{0xFA9C,0x28041},
+    {0xFA9D,0x28061},{0xFA9E,0x28081},{0xFA9F,0x280A1},{0xFAA0,0x280C1},{0xFAA1,0x280E1},{0xFAA2,0x28101},
+    {0xFAA3,0x28121},{0xFAA4,0x28141},{0xFAA5,0x28161},{0xFAA6,0x28181},{0xFAA7,0x281A1},{0xFAA8,0x281C1},
+    {0xFAA9,0x281E1},{0xFAAA,0x28201},{0xFAAB,0x28221},{0xFAAC,0x28241},{0xFAAD,0x28261},{0xFAAE,0x28281},
+    {0xFAAF,0x282A1},{0xFAB0,0x282C1},{0xFAB1,0x282E1},{0xFAB2,0x28301},{0xFAB3,0x28321},{0xFAB4,0x28341},
+    {0xFAB5,0x28361},{0xFAB6,0x28381},{0xFAB7,0x283A1},{0xFAB8,0x283C1},{0xFAB9,0x283E1},{0xFABA,0x28401},
+    {0xFABB,0x28421},{0xFABC,0x28441},{0xFABD,0x28461},{0xFABE,0x28481},{0xFABF,0x284A1},{0xFAC0,0x284C1},
+    {0xFAC1,0x284E1},{0xFAC2,0x28501},{0xFAC3,0x28521},{0xFAC4,0x28541},{0xFAC5,0x28561},{0xFAC6,0x28581},
+    {0xFAC7,0x285A1},{0xFAC8,0x285C1},{0xFAC9,0x285E1},{0xFACA,0x28601},{0xFACB,0x28621},{0xFACC,0x28641},
+    {0xFACD,0x28661},{0xFACE,0x28681},{0xFACF,0x286A1},{0xFAD0,0x286C1},{0xFAD1,0x286E1},{0xFAD2,0x28701},
+    {0xFAD3,0x28721},{0xFAD4,0x28741},{0xFAD5,0x28761},{0xFAD6,0x28781},{0xFAD7,0x287A1},{0xFAD8,0x287C1},
+    {0xFAD9,0x287E1},{0xFB1D,0x28B42},{0xFB1F,0x28B82},{0xFB2A,0x28D02},{0xFB2B,0x28D42},{0xFB2C,0x28D83},
+    {0xFB2D,0x28DE3},{0xFB2E,0x28E42},{0xFB2F,0x28E82},{0xFB30,0x28EC2},{0xFB31,0x28F02},{0xFB32,0x28F42},
+    {0xFB33,0x28F82},{0xFB34,0x28FC2},{0xFB35,0x29002},{0xFB36,0x29042},{0xFB38,0x29082},{0xFB39,0x290C2},
+    {0xFB3A,0x29102},{0xFB3B,0x29142},{0xFB3C,0x29182},{0xFB3E,0x291C2},{0xFB40,0x29202},{0xFB41,0x29242},
+    {0xFB43,0x29282},{0xFB44,0x292C2},{0xFB46,0x29302},{0xFB47,0x29342},{0xFB48,0x29382},{0xFB49,0x293C2},
+    {0xFB4A,0x29402},{0xFB4B,0x29442},{0xFB4C,0x29482},{0xFB4D,0x294C2},{0xFB4E,0x29502},{0x1109A,0x376C2},
+    {0x1109C,0x37702},{0x110AB,0x37742},{0x1112E,0x37782},{0x1112F,0x377C2},{0x1134B,0x37802},{0x1134C,0x37842},
+    {0x114BB,0x37882},{0x114BC,0x378C2},{0x114BE,0x37902},{0x115BA,0x37942},{0x115BB,0x37982},{0x11938,0x379C2},
+    {0x1D15E,0x37A02},{0x1D15F,0x37A42},{0x1D160,0x37A83},{0x1D161,0x37AE3},{0x1D162,0x37B43},{0x1D163,0x37BA3},
+    {0x1D164,0x37C03},{0x1D1BB,0x37C62},{0x1D1BC,0x37CA2},{0x1D1BD,0x37CE3},{0x1D1BE,0x37D43},{0x1D1BF,0x37DA3},
+    {0x1D1C0,0x37E03},{0x2F800,0x432E1},{0x2F801,0x43301},{0x2F802,0x43321},{0x2F803,0x43341},{0x2F804,0x43361},
+    {0x2F805,0x43381},{0x2F806,0x433A1},{0x2F807,0x433C1},{0x2F808,0x433E1},{0x2F809,0x43401},{0x2F80A,0x43421},
+    {0x2F80B,0x43441},{0x2F80C,0x43461},{0x2F80D,0x43481},{0x2F80E,0x434A1},{0x2F80F,0x434C1},{0x2F810,0x434E1},
+    {0x2F811,0x43501},{0x2F812,0x43521},{0x2F813,0x43541},{0x2F814,0x43561},{0x2F815,0x43581},{0x2F816,0x435A1},
+    {0x2F817,0x435C1},{0x2F818,0x435E1},{0x2F819,0x43601},{0x2F81A,0x43621},{0x2F81B,0x43641},{0x2F81C,0x43661},
+    {0x2F81D,0x43681},{0x2F81E,0x436A1},{0x2F81F,0x436C1},{0x2F820,0x436E1},{0x2F821,0x43701},{0x2F822,0x43721},
+    {0x2F823,0x43741},{0x2F824,0x43761},{0x2F825,0x43781},{0x2F826,0x437A1},{0x2F827,0x437C1},{0x2F828,0x437E1},
+    {0x2F829,0x43801},{0x2F82A,0x43821},{0x2F82B,0x43841},{0x2F82C,0x43861},{0x2F82D,0x43881},{0x2F82E,0x438A1},
+    {0x2F82F,0x438C1},{0x2F830,0x438E1},{0x2F831,0x43901},{0x2F832,0x43921},{0x2F833,0x43941},{0x2F834,0x43961},
+    {0x2F835,0x43981},{0x2F836,0x439A1},{0x2F837,0x439C1},{0x2F838,0x439E1},{0x2F839,0x43A01},{0x2F83A,0x43A21},
+    {0x2F83B,0x43A41},{0x2F83C,0x43A61},{0x2F83D,0x43A81},{0x2F83E,0x43AA1},{0x2F83F,0x43AC1},{0x2F840,0x43AE1},
+    {0x2F841,0x43B01},{0x2F842,0x43B21},{0x2F843,0x43B41},{0x2F844,0x43B61},{0x2F845,0x43B81},{0x2F846,0x43BA1},
+    {0x2F847,0x43BC1},{0x2F848,0x43BE1},{0x2F849,0x43C01},{0x2F84A,0x43C21},{0x2F84B,0x43C41},{0x2F84C,0x43C61},
+    {0x2F84D,0x43C81},{0x2F84E,0x43CA1},{0x2F84F,0x43CC1},{0x2F850,0x43CE1},{0x2F851,0x43D01},{0x2F852,0x43D21},
+    {0x2F853,0x43D41},{0x2F854,0x43D61},{0x2F855,0x43D81},{0x2F856,0x43DA1},{0x2F857,0x43DC1},{0x2F858,0x43DE1},
+    {0x2F859,0x43E01},{0x2F85A,0x43E21},{0x2F85B,0x43E41},{0x2F85C,0x43E61},{0x2F85D,0x43E81},{0x2F85E,0x43EA1},
+    {0x2F85F,0x43EC1},{0x2F860,0x43EE1},{0x2F861,0x43F01},{0x2F862,0x43F21},{0x2F863,0x43F41},{0x2F864,0x43F61},
+    {0x2F865,0x43F81},{0x2F866,0x43FA1},{0x2F867,0x43FC1},{0x2F868,0x43FE1},{0x2F869,0x44001},{0x2F86A,0x44021},
+    {0x2F86B,0x44041},{0x2F86C,0x44061},{0x2F86D,0x44081},{0x2F86E,0x440A1},{0x2F86F,0x440C1},{0x2F870,0x440E1},
+    {0x2F871,0x44101},{0x2F872,0x44121},{0x2F873,0x44141},{0x2F874,0x44161},{0x2F875,0x44181},{0x2F876,0x441A1},
+    {0x2F877,0x441C1},{0x2F878,0x441E1},{0x2F879,0x44201},{0x2F87A,0x44221},{0x2F87B,0x44241},{0x2F87C,0x44261},
+    {0x2F87D,0x44281},{0x2F87E,0x442A1},{0x2F87F,0x442C1},{0x2F880,0x442E1},{0x2F881,0x44301},{0x2F882,0x44321},
+    {0x2F883,0x44341},{0x2F884,0x44361},{0x2F885,0x44381},{0x2F886,0x443A1},{0x2F887,0x443C1},{0x2F888,0x443E1},
+    {0x2F889,0x44401},{0x2F88A,0x44421},{0x2F88B,0x44441},{0x2F88C,0x44461},{0x2F88D,0x44481},{0x2F88E,0x444A1},
+    {0x2F88F,0x444C1},{0x2F890,0x444E1},{0x2F891,0x44501},{0x2F892,0x44521},{0x2F893,0x44541},{0x2F894,0x44561},
+    {0x2F895,0x44581},{0x2F896,0x445A1},{0x2F897,0x445C1},{0x2F898,0x445E1},{0x2F899,0x44601},{0x2F89A,0x44621},
+    {0x2F89B,0x44641},{0x2F89C,0x44661},{0x2F89D,0x44681},{0x2F89E,0x446A1},{0x2F89F,0x446C1},{0x2F8A0,0x446E1},
+    {0x2F8A1,0x44701},{0x2F8A2,0x44721},{0x2F8A3,0x44741},{0x2F8A4,0x44761},{0x2F8A5,0x44781},{0x2F8A6,0x447A1},
+    {0x2F8A7,0x447C1},{0x2F8A8,0x447E1},{0x2F8A9,0x44801},{0x2F8AA,0x44821},{0x2F8AB,0x44841},{0x2F8AC,0x44861},
+    {0x2F8AD,0x44881},{0x2F8AE,0x448A1},{0x2F8AF,0x448C1},{0x2F8B0,0x448E1},{0x2F8B1,0x44901},{0x2F8B2,0x44921},
+    {0x2F8B3,0x44941},{0x2F8B4,0x44961},{0x2F8B5,0x44981},{0x2F8B6,0x449A1},{0x2F8B7,0x449C1},{0x2F8B8,0x449E1},
+    {0x2F8B9,0x44A01},{0x2F8BA,0x44A21},{0x2F8BB,0x44A41},{0x2F8BC,0x44A61},{0x2F8BD,0x44A81},{0x2F8BE,0x44AA1},
+    {0x2F8BF,0x44AC1},{0x2F8C0,0x44AE1},{0x2F8C1,0x44B01},{0x2F8C2,0x44B21},{0x2F8C3,0x44B41},{0x2F8C4,0x44B61},
+    {0x2F8C5,0x44B81},{0x2F8C6,0x44BA1},{0x2F8C7,0x44BC1},{0x2F8C8,0x44BE1},{0x2F8C9,0x44C01},{0x2F8CA,0x44C21},
+    {0x2F8CB,0x44C41},{0x2F8CC,0x44C61},{0x2F8CD,0x44C81},{0x2F8CE,0x44CA1},{0x2F8CF,0x44CC1},{0x2F8D0,0x44CE1},
+    {0x2F8D1,0x44D01},{0x2F8D2,0x44D21},{0x2F8D3,0x44D41},{0x2F8D4,0x44D61},{0x2F8D5,0x44D81},{0x2F8D6,0x44DA1},
+    {0x2F8D7,0x44DC1},{0x2F8D8,0x44DE1},{0x2F8D9,0x44E01},{0x2F8DA,0x44E21},{0x2F8DB,0x44E41},{0x2F8DC,0x44E61},
+    {0x2F8DD,0x44E81},{0x2F8DE,0x44EA1},{0x2F8DF,0x44EC1},{0x2F8E0,0x44EE1},{0x2F8E1,0x44F01},{0x2F8E2,0x44F21},
+    {0x2F8E3,0x44F41},{0x2F8E4,0x44F61},{0x2F8E5,0x44F81},{0x2F8E6,0x44FA1},{0x2F8E7,0x44FC1},{0x2F8E8,0x44FE1},
+    {0x2F8E9,0x45001},{0x2F8EA,0x45021},{0x2F8EB,0x45041},{0x2F8EC,0x45061},{0x2F8ED,0x45081},{0x2F8EE,0x450A1},
+    {0x2F8EF,0x450C1},{0x2F8F0,0x450E1},{0x2F8F1,0x45101},{0x2F8F2,0x45121},{0x2F8F3,0x45141},{0x2F8F4,0x45161},
+    {0x2F8F5,0x45181},{0x2F8F6,0x451A1},{0x2F8F7,0x451C1},{0x2F8F8,0x451E1},{0x2F8F9,0x45201},{0x2F8FA,0x45221},
+    {0x2F8FB,0x45241},{0x2F8FC,0x45261},{0x2F8FD,0x45281},{0x2F8FE,0x452A1},{0x2F8FF,0x452C1},{0x2F900,0x452E1},
+    {0x2F901,0x45301},{0x2F902,0x45321},{0x2F903,0x45341},{0x2F904,0x45361},{0x2F905,0x45381},{0x2F906,0x453A1},
+    {0x2F907,0x453C1},{0x2F908,0x453E1},{0x2F909,0x45401},{0x2F90A,0x45421},{0x2F90B,0x45441},{0x2F90C,0x45461},
+    {0x2F90D,0x45481},{0x2F90E,0x454A1},{0x2F90F,0x454C1},{0x2F910,0x454E1},{0x2F911,0x45501},{0x2F912,0x45521},
+    {0x2F913,0x45541},{0x2F914,0x45561},{0x2F915,0x45581},{0x2F916,0x455A1},{0x2F917,0x455C1},{0x2F918,0x455E1},
+    {0x2F919,0x45601},{0x2F91A,0x45621},{0x2F91B,0x45641},{0x2F91C,0x45661},{0x2F91D,0x45681},{0x2F91E,0x456A1},
+    {0x2F91F,0x456C1},{0x2F920,0x456E1},{0x2F921,0x45701},{0x2F922,0x45721},{0x2F923,0x45741},{0x2F924,0x45761},
+    {0x2F925,0x45781},{0x2F926,0x457A1},{0x2F927,0x457C1},{0x2F928,0x457E1},{0x2F929,0x45801},{0x2F92A,0x45821},
+    {0x2F92B,0x45841},{0x2F92C,0x45861},{0x2F92D,0x45881},{0x2F92E,0x458A1},{0x2F92F,0x458C1},{0x2F930,0x458E1},
+    {0x2F931,0x45901},{0x2F932,0x45921},{0x2F933,0x45941},{0x2F934,0x45961},{0x2F935,0x45981},{0x2F936,0x459A1},
+    {0x2F937,0x459C1},{0x2F938,0x459E1},{0x2F939,0x45A01},{0x2F93A,0x45A21},{0x2F93B,0x45A41},{0x2F93C,0x45A61},
+    {0x2F93D,0x45A81},{0x2F93E,0x45AA1},{0x2F93F,0x45AC1},{0x2F940,0x45AE1},{0x2F941,0x45B01},{0x2F942,0x45B21},
+    {0x2F943,0x45B41},{0x2F944,0x45B61},{0x2F945,0x45B81},{0x2F946,0x45BA1},{0x2F947,0x45BC1},{0x2F948,0x45BE1},
+    {0x2F949,0x45C01},{0x2F94A,0x45C21},{0x2F94B,0x45C41},{0x2F94C,0x45C61},{0x2F94D,0x45C81},{0x2F94E,0x45CA1},
+    {0x2F94F,0x45CC1},{0x2F950,0x45CE1},{0x2F951,0x45D01},{0x2F952,0x45D21},{0x2F953,0x45D41},{0x2F954,0x45D61},
+    {0x2F955,0x45D81},{0x2F956,0x45DA1},{0x2F957,0x45DC1},{0x2F958,0x45DE1},{0x2F959,0x45E01},{0x2F95A,0x45E21},
+    {0x2F95B,0x45E41},{0x2F95C,0x45E61},{0x2F95D,0x45E81},{0x2F95E,0x45EA1},{0x2F95F,0x45EC1},{0x2F960,0x45EE1},
+    {0x2F961,0x45F01},{0x2F962,0x45F21},{0x2F963,0x45F41},{0x2F964,0x45F61},{0x2F965,0x45F81},{0x2F966,0x45FA1},
+    {0x2F967,0x45FC1},{0x2F968,0x45FE1},{0x2F969,0x46001},{0x2F96A,0x46021},{0x2F96B,0x46041},{0x2F96C,0x46061},
+    {0x2F96D,0x46081},{0x2F96E,0x460A1},{0x2F96F,0x460C1},{0x2F970,0x460E1},{0x2F971,0x46101},{0x2F972,0x46121},
+    {0x2F973,0x46141},{0x2F974,0x46161},{0x2F975,0x46181},{0x2F976,0x461A1},{0x2F977,0x461C1},{0x2F978,0x461E1},
+    {0x2F979,0x46201},{0x2F97A,0x46221},{0x2F97B,0x46241},{0x2F97C,0x46261},{0x2F97D,0x46281},{0x2F97E,0x462A1},
+    {0x2F97F,0x462C1},{0x2F980,0x462E1},{0x2F981,0x46301},{0x2F982,0x46321},{0x2F983,0x46341},{0x2F984,0x46361},
+    {0x2F985,0x46381},{0x2F986,0x463A1},{0x2F987,0x463C1},{0x2F988,0x463E1},{0x2F989,0x46401},{0x2F98A,0x46421},
+    {0x2F98B,0x46441},{0x2F98C,0x46461},{0x2F98D,0x46481},{0x2F98E,0x464A1},{0x2F98F,0x464C1},{0x2F990,0x464E1},
+    {0x2F991,0x46501},{0x2F992,0x46521},{0x2F993,0x46541},{0x2F994,0x46561},{0x2F995,0x46581},{0x2F996,0x465A1},
+    {0x2F997,0x465C1},{0x2F998,0x465E1},{0x2F999,0x46601},{0x2F99A,0x46621},{0x2F99B,0x46641},{0x2F99C,0x46661},
+    {0x2F99D,0x46681},{0x2F99E,0x466A1},{0x2F99F,0x466C1},{0x2F9A0,0x466E1},{0x2F9A1,0x46701},{0x2F9A2,0x46721},
+    {0x2F9A3,0x46741},{0x2F9A4,0x46761},{0x2F9A5,0x46781},{0x2F9A6,0x467A1},{0x2F9A7,0x467C1},{0x2F9A8,0x467E1},
+    {0x2F9A9,0x46801},{0x2F9AA,0x46821},{0x2F9AB,0x46841},{0x2F9AC,0x46861},{0x2F9AD,0x46881},{0x2F9AE,0x468A1},
+    {0x2F9AF,0x468C1},{0x2F9B0,0x468E1},{0x2F9B1,0x46901},{0x2F9B2,0x46921},{0x2F9B3,0x46941},{0x2F9B4,0x46961},
+    {0x2F9B5,0x46981},{0x2F9B6,0x469A1},{0x2F9B7,0x469C1},{0x2F9B8,0x469E1},{0x2F9B9,0x46A01},{0x2F9BA,0x46A21},
+    {0x2F9BB,0x46A41},{0x2F9BC,0x46A61},{0x2F9BD,0x46A81},{0x2F9BE,0x46AA1},{0x2F9BF,0x46AC1},{0x2F9C0,0x46AE1},
+    {0x2F9C1,0x46B01},{0x2F9C2,0x46B21},{0x2F9C3,0x46B41},{0x2F9C4,0x46B61},{0x2F9C5,0x46B81},{0x2F9C6,0x46BA1},
+    {0x2F9C7,0x46BC1},{0x2F9C8,0x46BE1},{0x2F9C9,0x46C01},{0x2F9CA,0x46C21},{0x2F9CB,0x46C41},{0x2F9CC,0x46C61},
+    {0x2F9CD,0x46C81},{0x2F9CE,0x46CA1},{0x2F9CF,0x46CC1},{0x2F9D0,0x46CE1},{0x2F9D1,0x46D01},{0x2F9D2,0x46D21},
+    {0x2F9D3,0x46D41},{0x2F9D4,0x46D61},{0x2F9D5,0x46D81},{0x2F9D6,0x46DA1},{0x2F9D7,0x46DC1},{0x2F9D8,0x46DE1},
+    {0x2F9D9,0x46E01},{0x2F9DA,0x46E21},{0x2F9DB,0x46E41},{0x2F9DC,0x46E61},{0x2F9DD,0x46E81},{0x2F9DE,0x46EA1},
+    {0x2F9DF,0x46EC1},{0x2F9E0,0x46EE1},{0x2F9E1,0x46F01},{0x2F9E2,0x46F21},{0x2F9E3,0x46F41},{0x2F9E4,0x46F61},
+    {0x2F9E5,0x46F81},{0x2F9E6,0x46FA1},{0x2F9E7,0x46FC1},{0x2F9E8,0x46FE1},{0x2F9E9,0x47001},{0x2F9EA,0x47021},
+    {0x2F9EB,0x47041},{0x2F9EC,0x47061},{0x2F9ED,0x47081},{0x2F9EE,0x470A1},{0x2F9EF,0x470C1},{0x2F9F0,0x470E1},
+    {0x2F9F1,0x47101},{0x2F9F2,0x47121},{0x2F9F3,0x47141},{0x2F9F4,0x47161},{0x2F9F5,0x47181},{0x2F9F6,0x471A1},
+    {0x2F9F7,0x471C1},{0x2F9F8,0x471E1},{0x2F9F9,0x47201},{0x2F9FA,0x47221},{0x2F9FB,0x47241},{0x2F9FC,0x47261},
+    {0x2F9FD,0x47281},{0x2F9FE,0x472A1},{0x2F9FF,0x472C1},{0x2FA00,0x472E1},{0x2FA01,0x47301},{0x2FA02,0x47321},
+    {0x2FA03,0x47341},{0x2FA04,0x47361},{0x2FA05,0x47381},{0x2FA06,0x473A1},{0x2FA07,0x473C1},{0x2FA08,0x473E1},
+    {0x2FA09,0x47401},{0x2FA0A,0x47421},{0x2FA0B,0x47441},{0x2FA0C,0x47461},{0x2FA0D,0x47481},{0x2FA0E,0x474A1},
+    {0x2FA0F,0x474C1},{0x2FA10,0x474E1},{0x2FA11,0x47501},{0x2FA12,0x47521},{0x2FA13,0x47541},{0x2FA14,0x47561},
+    {0x2FA15,0x47581},{0x2FA16,0x475A1},{0x2FA17,0x475C1},{0x2FA18,0x475E1},{0x2FA19,0x47601},{0x2FA1A,0x47621},
+    {0x2FA1B,0x47641},{0x2FA1C,0x47661},{0x2FA1D,0x47681},
+};
+
+#define HZ_UCD_CANONICAL_DECOMPOSITION_COUNT 2061
+
+static const uint32_t hz_ucd_compat_decompositions[3812][2] = {
+    {0x00A0,0x1},{0x00A8,0x22},{0x00AA,0x61},{0x00AF,0x82},{0x00B2,0xC1},{0x00B3,0xE1},
+    {0x00B4,0x102},{0x00B5,0x141},{0x00B8,0x162},{0x00B9,0x1A1},{0x00BA,0x1C1},{0x00BC,0x1E3},
+    {0x00BD,0x243},{0x00BE,0x2A3},{0x0132,0x1B82},{0x0133,0x1BC2},{0x013F,0x1E82},{0x0140,0x1EC2},
+    {0x0149,0x2082},{0x017F,0x2C81},{0x01C4,0x2DA3},{0x01C5,0x2E03},{0x01C6,0x2E63},{0x01C7,0x2EC2},
+    {0x01C8,0x2F02},{0x01C9,0x2F42},{0x01CA,0x2F82},{0x01CB,0x2FC2},{0x01CC,0x3002},{0x01F1,0x3A42},
+    {0x01F2,0x3A82},{0x01F3,0x3AC2},{0x02B0,0x4981},{0x02B1,0x49A1},{0x02B2,0x49C1},{0x02B3,0x49E1},
+    {0x02B4,0x4A01},{0x02B5,0x4A21},{0x02B6,0x4A41},{0x02B7,0x4A61},{0x02B8,0x4A81},{0x02D8,0x4AA2},
+    {0x02D9,0x4AE2},{0x02DA,0x4B22},{0x02DB,0x4B62},{0x02DC,0x4BA2},{0x02DD,0x4BE2},{0x02E0,0x4C21},
+    {0x02E1,0x4C41},{0x02E2,0x4C61},{0x02E3,0x4C81},{0x02E4,0x4CA1},{0x037A,0x4D82},{0x0384,0x4DE2},
+    {0x0385,0x4E63},{0x03D0,0x5421},{0x03D1,0x5441},{0x03D2,0x5461},{0x03D3,0x54C2},{0x03D4,0x5542},
+    {0x03D5,0x5581},{0x03D6,0x55A1},{0x03F0,0x55C1},{0x03F1,0x55E1},{0x03F2,0x5601},{0x03F4,0x5621},
+    {0x03F5,0x5641},{0x03F9,0x5661},{0x0587,0x6382},{0x0675,0x6502},{0x0676,0x6542},{0x0677,0x6582},
+    {0x0678,0x65C2},{0x0E33,0x7202},{0x0EB3,0x7242},{0x0EDC,0x7282},{0x0EDD,0x72C2},{0x0F0C,0x7301},
+    {0x0F77,0x7563},{0x0F79,0x7603},{0x10FC,0x7861},{0x1D2C,0x7B41},{0x1D2D,0x7B61},{0x1D2E,0x7B81},
+    {0x1D30,0x7BA1},{0x1D31,0x7BC1},{0x1D32,0x7BE1},{0x1D33,0x7C01},{0x1D34,0x7C21},{0x1D35,0x7C41},
+    {0x1D36,0x7C61},{0x1D37,0x7C81},{0x1D38,0x7CA1},{0x1D39,0x7CC1},{0x1D3A,0x7CE1},{0x1D3C,0x7D01},
+    {0x1D3D,0x7D21},{0x1D3E,0x7D41},{0x1D3F,0x7D61},{0x1D40,0x7D81},{0x1D41,0x7DA1},{0x1D42,0x7DC1},
+    {0x1D43,0x7DE1},{0x1D44,0x7E01},{0x1D45,0x7E21},{0x1D46,0x7E41},{0x1D47,0x7E61},{0x1D48,0x7E81},
+    {0x1D49,0x7EA1},{0x1D4A,0x7EC1},{0x1D4B,0x7EE1},{0x1D4C,0x7F01},{0x1D4D,0x7F21},{0x1D4F,0x7F41},
+    {0x1D50,0x7F61},{0x1D51,0x7F81},{0x1D52,0x7FA1},{0x1D53,0x7FC1},{0x1D54,0x7FE1},{0x1D55,0x8001},
+    {0x1D56,0x8021},{0x1D57,0x8041},{0x1D58,0x8061},{0x1D59,0x8081},{0x1D5A,0x80A1},{0x1D5B,0x80C1},
+    {0x1D5C,0x80E1},{0x1D5D,0x8101},{0x1D5E,0x8121},{0x1D5F,0x8141},{0x1D60,0x8161},{0x1D61,0x8181},
+    {0x1D62,0x81A1},{0x1D63,0x81C1},{0x1D64,0x81E1},{0x1D65,0x8201},{0x1D66,0x8221},{0x1D67,0x8241},
+    {0x1D68,0x8261},{0x1D69,0x8281},{0x1D6A,0x82A1},{0x1D78,0x82C1},{0x1D9B,0x82E1},{0x1D9C,0x8301},
+    {0x1D9D,0x8321},{0x1D9E,0x8341},{0x1D9F,0x8361},{0x1DA0,0x8381},{0x1DA1,0x83A1},{0x1DA2,0x83C1},
+    {0x1DA3,0x83E1},{0x1DA4,0x8401},{0x1DA5,0x8421},{0x1DA6,0x8441},{0x1DA7,0x8461},{0x1DA8,0x8481},
+    {0x1DA9,0x84A1},{0x1DAA,0x84C1},{0x1DAB,0x84E1},{0x1DAC,0x8501},{0x1DAD,0x8521},{0x1DAE,0x8541},
+    {0x1DAF,0x8561},{0x1DB0,0x8581},{0x1DB1,0x85A1},{0x1DB2,0x85C1},{0x1DB3,0x85E1},{0x1DB4,0x8601},
+    {0x1DB5,0x8621},{0x1DB6,0x8641},{0x1DB7,0x8661},{0x1DB8,0x8681},{0x1DB9,0x86A1},{0x1DBA,0x86C1},
+    {0x1DBB,0x86E1},{0x1DBC,0x8701},{0x1DBD,0x8721},{0x1DBE,0x8741},{0x1DBF,0x8761},{0x1E9A,0xB202},
+    {0x1E9B,0xB282},{0x1FBD,0x11042},{0x1FBF,0x110A2},{0x1FC0,0x110E2},{0x1FC1,0x11163},{0x1FCD,0x114E3},
+    {0x1FCE,0x11583},{0x1FCF,0x11623},{0x1FDD,0x119A3},{0x1FDE,0x11A43},{0x1FDF,0x11AE3},{0x1FED,0x11F23},
+    {0x1FEE,0x11FC3},{0x1FFD,0x12342},{0x1FFE,0x12382},{0x2000,0x123E1},{0x2001,0x12421},{0x2002,0x12441},
+    {0x2003,0x12461},{0x2004,0x12481},{0x2005,0x124A1},{0x2006,0x124C1},{0x2007,0x124E1},{0x2008,0x12501},
+    {0x2009,0x12521},{0x200A,0x12541},{0x2011,0x12561},{0x2017,0x12582},{0x2024,0x125C1},{0x2025,0x125E2},
+    {0x2026,0x12623},{0x202F,0x12681},{0x2033,0x126A2},{0x2034,0x126E3},{0x2036,0x12742},{0x2037,0x12783},
+    {0x203C,0x127E2},{0x203E,0x12822},{0x2047,0x12862},{0x2048,0x128A2},{0x2049,0x128E2},{0x2057,0x12924},
+    {0x205F,0x129A1},{0x2070,0x129C1},{0x2071,0x129E1},{0x2074,0x12A01},{0x2075,0x12A21},{0x2076,0x12A41},
+    {0x2077,0x12A61},{0x2078,0x12A81},{0x2079,0x12AA1},{0x207A,0x12AC1},{0x207B,0x12AE1},{0x207C,0x12B01},
+    {0x207D,0x12B21},{0x207E,0x12B41},{0x207F,0x12B61},{0x2080,0x12B81},{0x2081,0x12BA1},{0x2082,0x12BC1},
+    {0x2083,0x12BE1},{0x2084,0x12C01},{0x2085,0x12C21},{0x2086,0x12C41},{0x2087,0x12C61},{0x2088,0x12C81},
+    {0x2089,0x12CA1},{0x208A,0x12CC1},{0x208B,0x12CE1},{0x208C,0x12D01},{0x208D,0x12D21},{0x208E,0x12D41},
+    {0x2090,0x12D61},{0x2091,0x12D81},{0x2092,0x12DA1},{0x2093,0x12DC1},{0x2094,0x12DE1},{0x2095,0x12E01},
+    {0x2096,0x12E21},{0x2097,0x12E41},{0x2098,0x12E61},{0x2099,0x12E81},{0x209A,0x12EA1},{0x209B,0x12EC1},
+    {0x209C,0x12EE1},{0x20A8,0x12F02},{0x2100,0x12F43},{0x2101,0x12FA3},{0x2102,0x13001},{0x2103,0x13022},
+    {0x2105,0x13063},{0x2106,0x130C3},{0x2107,0x13121},{0x2109,0x13142},{0x210A,0x13181},{0x210B,0x131A1},
+    {0x210C,0x131C1},{0x210D,0x131E1},{0x210E,0x13201},{0x210F,0x13221},{0x2110,0x13241},{0x2111,0x13261},
+    {0x2112,0x13281},{0x2113,0x132A1},{0x2115,0x132C1},{0x2116,0x132E2},{0x2119,0x13321},{0x211A,0x13341},
+    {0x211B,0x13361},{0x211C,0x13381},{0x211D,0x133A1},{0x2120,0x133C2},{0x2121,0x13403},{0x2122,0x13462},
+    {0x2124,0x134A1},{0x2128,0x134E1},{0x212C,0x13561},{0x212D,0x13581},{0x212F,0x135A1},{0x2130,0x135C1},
+    {0x2131,0x135E1},{0x2133,0x13601},{0x2134,0x13621},{0x2135,0x13641},{0x2136,0x13661},{0x2137,0x13681},
+    {0x2138,0x136A1},{0x2139,0x136C1},{0x213B,0x136E3},{0x213C,0x13741},{0x213D,0x13761},{0x213E,0x13781},
+    {0x213F,0x137A1},{0x2140,0x137C1},{0x2145,0x137E1},{0x2146,0x13801},{0x2147,0x13821},{0x2148,0x13841},
+    {0x2149,0x13861},{0x2150,0x13883},{0x2151,0x138E3},{0x2152,0x13944},{0x2153,0x139C3},{0x2154,0x13A23},
+    {0x2155,0x13A83},{0x2156,0x13AE3},{0x2157,0x13B43},{0x2158,0x13BA3},{0x2159,0x13C03},{0x215A,0x13C63},
+    {0x215B,0x13CC3},{0x215C,0x13D23},{0x215D,0x13D83},{0x215E,0x13DE3},{0x215F,0x13E42},{0x2160,0x13E81},
+    {0x2161,0x13EA2},{0x2162,0x13EE3},{0x2163,0x13F42},{0x2164,0x13F81},{0x2165,0x13FA2},{0x2166,0x13FE3},
+    {0x2167,0x14044},{0x2168,0x140C2},{0x2169,0x14101},{0x216A,0x14122},{0x216B,0x14163},{0x216C,0x141C1},
+    {0x216D,0x141E1},{0x216E,0x14201},{0x216F,0x14221},{0x2170,0x14241},{0x2171,0x14262},{0x2172,0x142A3},
+    {0x2173,0x14302},{0x2174,0x14341},{0x2175,0x14362},{0x2176,0x143A3},{0x2177,0x14404},{0x2178,0x14482},
+    {0x2179,0x144C1},{0x217A,0x144E2},{0x217B,0x14523},{0x217C,0x14581},{0x217D,0x145A1},{0x217E,0x145C1},
+    {0x217F,0x145E1},{0x2189,0x14603},{0x222C,0x14922},{0x222D,0x14963},{0x222F,0x149C2},{0x2230,0x14A03},
+    {0x2460,0x152E1},{0x2461,0x15301},{0x2462,0x15321},{0x2463,0x15341},{0x2464,0x15361},{0x2465,0x15381},
+    {0x2466,0x153A1},{0x2467,0x153C1},{0x2468,0x153E1},{0x2469,0x15402},{0x246A,0x15442},{0x246B,0x15482},
+    {0x246C,0x154C2},{0x246D,0x15502},{0x246E,0x15542},{0x246F,0x15582},{0x2470,0x155C2},{0x2471,0x15602},
+    {0x2472,0x15642},{0x2473,0x15682},{0x2474,0x156C3},{0x2475,0x15723},{0x2476,0x15783},{0x2477,0x157E3},
+    {0x2478,0x15843},{0x2479,0x158A3},{0x247A,0x15903},{0x247B,0x15963},{0x247C,0x159C3},{0x247D,0x15A24},
+    {0x247E,0x15AA4},{0x247F,0x15B24},{0x2480,0x15BA4},{0x2481,0x15C24},{0x2482,0x15CA4},{0x2483,0x15D24},
+    {0x2484,0x15DA4},{0x2485,0x15E24},{0x2486,0x15EA4},{0x2487,0x15F24},{0x2488,0x15FA2},{0x2489,0x15FE2},
+    {0x248A,0x16022},{0x248B,0x16062},{0x248C,0x160A2},{0x248D,0x160E2},{0x248E,0x16122},{0x248F,0x16162},
+    {0x2490,0x161A2},{0x2491,0x161E3},{0x2492,0x16243},{0x2493,0x162A3},{0x2494,0x16303},{0x2495,0x16363},
+    {0x2496,0x163C3},{0x2497,0x16423},{0x2498,0x16483},{0x2499,0x164E3},{0x249A,0x16543},{0x249B,0x165A3},
+    {0x249C,0x16603},{0x249D,0x16663},{0x249E,0x166C3},{0x249F,0x16723},{0x24A0,0x16783},{0x24A1,0x167E3},
+    {0x24A2,0x16843},{0x24A3,0x168A3},{0x24A4,0x16903},{0x24A5,0x16963},{0x24A6,0x169C3},{0x24A7,0x16A23},
+    {0x24A8,0x16A83},{0x24A9,0x16AE3},{0x24AA,0x16B43},{0x24AB,0x16BA3},{0x24AC,0x16C03},{0x24AD,0x16C63},
+    {0x24AE,0x16CC3},{0x24AF,0x16D23},{0x24B0,0x16D83},{0x24B1,0x16DE3},{0x24B2,0x16E43},{0x24B3,0x16EA3},
+    {0x24B4,0x16F03},{0x24B5,0x16F63},{0x24B6,0x16FC1},{0x24B7,0x16FE1},{0x24B8,0x17001},{0x24B9,0x17021},
+    {0x24BA,0x17041},{0x24BB,0x17061},{0x24BC,0x17081},{0x24BD,0x170A1},{0x24BE,0x170C1},{0x24BF,0x170E1},
+    {0x24C0,0x17101},{0x24C1,0x17121},{0x24C2,0x17141},{0x24C3,0x17161},{0x24C4,0x17181},{0x24C5,0x171A1},
+    {0x24C6,0x171C1},{0x24C7,0x171E1},{0x24C8,0x17201},{0x24C9,0x17221},{0x24CA,0x17241},{0x24CB,0x17261},
+    {0x24CC,0x17281},{0x24CD,0x172A1},{0x24CE,0x172C1},{0x24CF,0x172E1},{0x24D0,0x17301},{0x24D1,0x17321},
+    {0x24D2,0x17341},{0x24D3,0x17361},{0x24D4,0x17381},{0x24D5,0x173A1},{0x24D6,0x173C1},{0x24D7,0x173E1},
+    {0x24D8,0x17401},{0x24D9,0x17421},{0x24DA,0x17441},{0x24DB,0x17461},{0x24DC,0x17481},{0x24DD,0x174A1},
+    {0x24DE,0x174C1},{0x24DF,0x174E1},{0x24E0,0x17501},{0x24E1,0x17521},{0x24E2,0x17541},{0x24E3,0x17561},
+    {0x24E4,0x17581},{0x24E5,0x175A1},{0x24E6,0x175C1},{0x24E7,0x175E1},{0x24E8,0x17601},{0x24E9,0x17621},
+    {0x24EA,0x17641},{0x2A0C,0x17664},{0x2A74,0x176E3},{0x2A75,0x17742},{0x2A76,0x17783},{0x2C7C,0x17821},
+    {0x2C7D,0x17841},{0x2D6F,0x17861},{0x2E9F,0x17881},{0x2EF3,0x178A1},{0x2F00,0x178C1},{0x2F01,0x178E1},
+    {0x2F02,0x17901},{0x2F03,0x17921},{0x2F04,0x17941},{0x2F05,0x17961},{0x2F06,0x17981},{0x2F07,0x179A1},
+    {0x2F08,0x179C1},{0x2F09,0x179E1},{0x2F0A,0x17A01},{0x2F0B,0x17A21},{0x2F0C,0x17A41},{0x2F0D,0x17A61},
+    {0x2F0E,0x17A81},{0x2F0F,0x17AA1},{0x2F10,0x17AC1},{0x2F11,0x17AE1},{0x2F12,0x17B01},{0x2F13,0x17B21},
+    {0x2F14,0x17B41},{0x2F15,0x17B61},{0x2F16,0x17B81},{0x2F17,0x17BA1},{0x2F18,0x17BC1},{0x2F19,0x17BE1},
+    {0x2F1A,0x17C01},{0x2F1B,0x17C21},{0x2F1C,0x17C41},{0x2F1D,0x17C61},{0x2F1E,0x17C81},{0x2F1F,0x17CA1},
+    {0x2F20,0x17CC1},{0x2F21,0x17CE1},{0x2F22,0x17D01},{0x2F23,0x17D21},{0x2F24,0x17D41},{0x2F25,0x17D61},
+    {0x2F26,0x17D81},{0x2F27,0x17DA1},{0x2F28,0x17DC1},{0x2F29,0x17DE1},{0x2F2A,0x17E01},{0x2F2B,0x17E21},
+    {0x2F2C,0x17E41},{0x2F2D,0x17E61},{0x2F2E,0x17E81},{0x2F2F,0x17EA1},{0x2F30,0x17EC1},{0x2F31,0x17EE1},
+    {0x2F32,0x17F01},{0x2F33,0x17F21},{0x2F34,0x17F41},{0x2F35,0x17F61},{0x2F36,0x17F81},{0x2F37,0x17FA1},
+    {0x2F38,0x17FC1},{0x2F39,0x17FE1},{0x2F3A,0x18001},{0x2F3B,0x18021},{0x2F3C,0x18041},{0x2F3D,0x18061},
+    {0x2F3E,0x18081},{0x2F3F,0x180A1},{0x2F40,0x180C1},{0x2F41,0x180E1},{0x2F42,0x18101},{0x2F43,0x18121},
+    {0x2F44,0x18141},{0x2F45,0x18161},{0x2F46,0x18181},{0x2F47,0x181A1},{0x2F48,0x181C1},{0x2F49,0x181E1},
+    {0x2F4A,0x18201},{0x2F4B,0x18221},{0x2F4C,0x18241},{0x2F4D,0x18261},{0x2F4E,0x18281},{0x2F4F,0x182A1},
+    {0x2F50,0x182C1},{0x2F51,0x182E1},{0x2F52,0x18301},{0x2F53,0x18321},{0x2F54,0x18341},{0x2F55,0x18361},
+    {0x2F56,0x18381},{0x2F57,0x183A1},{0x2F58,0x183C1},{0x2F59,0x183E1},{0x2F5A,0x18401},{0x2F5B,0x18421},
+    {0x2F5C,0x18441},{0x2F5D,0x18461},{0x2F5E,0x18481},{0x2F5F,0x184A1},{0x2F60,0x184C1},{0x2F61,0x184E1},
+    {0x2F62,0x18501},{0x2F63,0x18521},{0x2F64,0x18541},{0x2F65,0x18561},{0x2F66,0x18581},{0x2F67,0x185A1},
+    {0x2F68,0x185C1},{0x2F69,0x185E1},{0x2F6A,0x18601},{0x2F6B,0x18621},{0x2F6C,0x18641},{0x2F6D,0x18661},
+    {0x2F6E,0x18681},{0x2F6F,0x186A1},{0x2F70,0x186C1},{0x2F71,0x186E1},{0x2F72,0x18701},{0x2F73,0x18721},
+    {0x2F74,0x18741},{0x2F75,0x18761},{0x2F76,0x18781},{0x2F77,0x187A1},{0x2F78,0x187C1},{0x2F79,0x187E1},
+    {0x2F7A,0x18801},{0x2F7B,0x18821},{0x2F7C,0x18841},{0x2F7D,0x18861},{0x2F7E,0x18881},{0x2F7F,0x188A1},
+    {0x2F80,0x188C1},{0x2F81,0x188E1},{0x2F82,0x18901},{0x2F83,0x18921},{0x2F84,0x18941},{0x2F85,0x18961},
+    {0x2F86,0x18981},{0x2F87,0x189A1},{0x2F88,0x189C1},{0x2F89,0x189E1},{0x2F8A,0x18A01},{0x2F8B,0x18A21},
+    {0x2F8C,0x18A41},{0x2F8D,0x18A61},{0x2F8E,0x18A81},{0x2F8F,0x18AA1},{0x2F90,0x18AC1},{0x2F91,0x18AE1},
+    {0x2F92,0x18B01},{0x2F93,0x18B21},{0x2F94,0x18B41},{0x2F95,0x18B61},{0x2F96,0x18B81},{0x2F97,0x18BA1},
+    {0x2F98,0x18BC1},{0x2F99,0x18BE1},{0x2F9A,0x18C01},{0x2F9B,0x18C21},{0x2F9C,0x18C41},{0x2F9D,0x18C61},
+    {0x2F9E,0x18C81},{0x2F9F,0x18CA1},{0x2FA0,0x18CC1},{0x2FA1,0x18CE1},{0x2FA2,0x18D01},{0x2FA3,0x18D21},
+    {0x2FA4,0x18D41},{0x2FA5,0x18D61},{0x2FA6,0x18D81},{0x2FA7,0x18DA1},{0x2FA8,0x18DC1},{0x2FA9,0x18DE1},
+    {0x2FAA,0x18E01},{0x2FAB,0x18E21},{0x2FAC,0x18E41},{0x2FAD,0x18E61},{0x2FAE,0x18E81},{0x2FAF,0x18EA1},
+    {0x2FB0,0x18EC1},{0x2FB1,0x18EE1},{0x2FB2,0x18F01},{0x2FB3,0x18F21},{0x2FB4,0x18F41},{0x2FB5,0x18F61},
+    {0x2FB6,0x18F81},{0x2FB7,0x18FA1},{0x2FB8,0x18FC1},{0x2FB9,0x18FE1},{0x2FBA,0x19001},{0x2FBB,0x19021},
+    {0x2FBC,0x19041},{0x2FBD,0x19061},{0x2FBE,0x19081},{0x2FBF,0x190A1},{0x2FC0,0x190C1},{0x2FC1,0x190E1},
+    {0x2FC2,0x19101},{0x2FC3,0x19121},{0x2FC4,0x19141},{0x2FC5,0x19161},{0x2FC6,0x19181},{0x2FC7,0x191A1},
+    {0x2FC8,0x191C1},{0x2FC9,0x191E1},{0x2FCA,0x19201},{0x2FCB,0x19221},{0x2FCC,0x19241},{0x2FCD,0x19261},
+    {0x2FCE,0x19281},{0x2FCF,0x192A1},{0x2FD0,0x192C1},{0x2FD1,0x192E1},{0x2FD2,0x19301},{0x2FD3,0x19321},
+    {0x2FD4,0x19341},{0x2FD5,0x19361},{0x3000,0x19381},{0x3036,0x193A1},{0x3038,0x193C1},{0x3039,0x193E1},
+    {0x303A,0x19401},{0x309B,0x19AA2},{0x309C,0x19AE2},{0x309F,0x19B62},{0x30FF,0x1A362},{0x3131,0x1A3A1},
+    {0x3132,0x1A3C1},{0x3133,0x1A3E1},{0x3134,0x1A401},{0x3135,0x1A421},{0x3136,0x1A441},{0x3137,0x1A461},
+    {0x3138,0x1A481},{0x3139,0x1A4A1},{0x313A,0x1A4C1},{0x313B,0x1A4E1},{0x313C,0x1A501},{0x313D,0x1A521},
+    {0x313E,0x1A541},{0x313F,0x1A561},{0x3140,0x1A581},{0x3141,0x1A5A1},{0x3142,0x1A5C1},{0x3143,0x1A5E1},
+    {0x3144,0x1A601},{0x3145,0x1A621},{0x3146,0x1A641},{0x3147,0x1A661},{0x3148,0x1A681},{0x3149,0x1A6A1},
+    {0x314A,0x1A6C1},{0x314B,0x1A6E1},{0x314C,0x1A701},{0x314D,0x1A721},{0x314E,0x1A741},{0x314F,0x1A761},
+    {0x3150,0x1A781},{0x3151,0x1A7A1},{0x3152,0x1A7C1},{0x3153,0x1A7E1},{0x3154,0x1A801},{0x3155,0x1A821},
+    {0x3156,0x1A841},{0x3157,0x1A861},{0x3158,0x1A881},{0x3159,0x1A8A1},{0x315A,0x1A8C1},{0x315B,0x1A8E1},
+    {0x315C,0x1A901},{0x315D,0x1A921},{0x315E,0x1A941},{0x315F,0x1A961},{0x3160,0x1A981},{0x3161,0x1A9A1},
+    {0x3162,0x1A9C1},{0x3163,0x1A9E1},{0x3164,0x1AA01},{0x3165,0x1AA21},{0x3166,0x1AA41},{0x3167,0x1AA61},
+    {0x3168,0x1AA81},{0x3169,0x1AAA1},{0x316A,0x1AAC1},{0x316B,0x1AAE1},{0x316C,0x1AB01},{0x316D,0x1AB21},
+    {0x316E,0x1AB41},{0x316F,0x1AB61},{0x3170,0x1AB81},{0x3171,0x1ABA1},{0x3172,0x1ABC1},{0x3173,0x1ABE1},
+    {0x3174,0x1AC01},{0x3175,0x1AC21},{0x3176,0x1AC41},{0x3177,0x1AC61},{0x3178,0x1AC81},{0x3179,0x1ACA1},
+    {0x317A,0x1ACC1},{0x317B,0x1ACE1},{0x317C,0x1AD01},{0x317D,0x1AD21},{0x317E,0x1AD41},{0x317F,0x1AD61},
+    {0x3180,0x1AD81},{0x3181,0x1ADA1},{0x3182,0x1ADC1},{0x3183,0x1ADE1},{0x3184,0x1AE01},{0x3185,0x1AE21},
+    {0x3186,0x1AE41},{0x3187,0x1AE61},{0x3188,0x1AE81},{0x3189,0x1AEA1},{0x318A,0x1AEC1},{0x318B,0x1AEE1},
+    {0x318C,0x1AF01},{0x318D,0x1AF21},{0x318E,0x1AF41},{0x3192,0x1AF61},{0x3193,0x1AF81},{0x3194,0x1AFA1},
+    {0x3195,0x1AFC1},{0x3196,0x1AFE1},{0x3197,0x1B001},{0x3198,0x1B021},{0x3199,0x1B041},{0x319A,0x1B061},
+    {0x319B,0x1B081},{0x319C,0x1B0A1},{0x319D,0x1B0C1},{0x319E,0x1B0E1},{0x319F,0x1B101},{0x3200,0x1B123},
+    {0x3201,0x1B183},{0x3202,0x1B1E3},{0x3203,0x1B243},{0x3204,0x1B2A3},{0x3205,0x1B303},{0x3206,0x1B363},
+    {0x3207,0x1B3C3},{0x3208,0x1B423},{0x3209,0x1B483},{0x320A,0x1B4E3},{0x320B,0x1B543},{0x320C,0x1B5A3},
+    {0x320D,0x1B603},{0x320E,0x1B664},{0x320F,0x1B6E4},{0x3210,0x1B764},{0x3211,0x1B7E4},{0x3212,0x1B864},
+    {0x3213,0x1B8E4},{0x3214,0x1B964},{0x3215,0x1B9E4},{0x3216,0x1BA64},{0x3217,0x1BAE4},{0x3218,0x1BB64},
+    {0x3219,0x1BBE4},{0x321A,0x1BC64},{0x321B,0x1BCE4},{0x321C,0x1BD64},{0x321D,0x1BDE7},{0x321E,0x1BEC6},
+    {0x3220,0x1BF83},{0x3221,0x1BFE3},{0x3222,0x1C043},{0x3223,0x1C0A3},{0x3224,0x1C103},{0x3225,0x1C163},
+    {0x3226,0x1C1C3},{0x3227,0x1C223},{0x3228,0x1C283},{0x3229,0x1C2E3},{0x322A,0x1C343},{0x322B,0x1C3A3},
+    {0x322C,0x1C403},{0x322D,0x1C463},{0x322E,0x1C4C3},{0x322F,0x1C523},{0x3230,0x1C583},{0x3231,0x1C5E3},
+    {0x3232,0x1C643},{0x3233,0x1C6A3},{0x3234,0x1C703},{0x3235,0x1C763},{0x3236,0x1C7C3},{0x3237,0x1C823},
+    {0x3238,0x1C883},{0x3239,0x1C8E3},{0x323A,0x1C943},{0x323B,0x1C9A3},{0x323C,0x1CA03},{0x323D,0x1CA63},
+    {0x323E,0x1CAC3},{0x323F,0x1CB23},{0x3240,0x1CB83},{0x3241,0x1CBE3},{0x3242,0x1CC43},{0x3243,0x1CCA3},
+    {0x3244,0x1CD01},{0x3245,0x1CD21},{0x3246,0x1CD41},{0x3247,0x1CD61},{0x3250,0x1CD83},{0x3251,0x1CDE2},
+    {0x3252,0x1CE22},{0x3253,0x1CE62},{0x3254,0x1CEA2},{0x3255,0x1CEE2},{0x3256,0x1CF22},{0x3257,0x1CF62},
+    {0x3258,0x1CFA2},{0x3259,0x1CFE2},{0x325A,0x1D022},{0x325B,0x1D062},{0x325C,0x1D0A2},{0x325D,0x1D0E2},
+    {0x325E,0x1D122},{0x325F,0x1D162},{0x3260,0x1D1A1},{0x3261,0x1D1C1},{0x3262,0x1D1E1},{0x3263,0x1D201},
+    {0x3264,0x1D221},{0x3265,0x1D241},{0x3266,0x1D261},{0x3267,0x1D281},{0x3268,0x1D2A1},{0x3269,0x1D2C1},
+    {0x326A,0x1D2E1},{0x326B,0x1D301},{0x326C,0x1D321},{0x326D,0x1D341},{0x326E,0x1D362},{0x326F,0x1D3A2},
+    {0x3270,0x1D3E2},{0x3271,0x1D422},{0x3272,0x1D462},{0x3273,0x1D4A2},{0x3274,0x1D4E2},{0x3275,0x1D522},
+    {0x3276,0x1D562},{0x3277,0x1D5A2},{0x3278,0x1D5E2},{0x3279,0x1D622},{0x327A,0x1D662},{0x327B,0x1D6A2},
+    {0x327C,0x1D6E5},{0x327D,0x1D784},{0x327E,0x1D802},{0x3280,0x1D841},{0x3281,0x1D861},{0x3282,0x1D881},
+    {0x3283,0x1D8A1},{0x3284,0x1D8C1},{0x3285,0x1D8E1},{0x3286,0x1D901},{0x3287,0x1D921},{0x3288,0x1D941},
+    {0x3289,0x1D961},{0x328A,0x1D981},{0x328B,0x1D9A1},{0x328C,0x1D9C1},{0x328D,0x1D9E1},{0x328E,0x1DA01},
+    {0x328F,0x1DA21},{0x3290,0x1DA41},{0x3291,0x1DA61},{0x3292,0x1DA81},{0x3293,0x1DAA1},{0x3294,0x1DAC1},
+    {0x3295,0x1DAE1},{0x3296,0x1DB01},{0x3297,0x1DB21},{0x3298,0x1DB41},{0x3299,0x1DB61},{0x329A,0x1DB81},
+    {0x329B,0x1DBA1},{0x329C,0x1DBC1},{0x329D,0x1DBE1},{0x329E,0x1DC01},{0x329F,0x1DC21},{0x32A0,0x1DC41},
+    {0x32A1,0x1DC61},{0x32A2,0x1DC81},{0x32A3,0x1DCA1},{0x32A4,0x1DCC1},{0x32A5,0x1DCE1},{0x32A6,0x1DD01},
+    {0x32A7,0x1DD21},{0x32A8,0x1DD41},{0x32A9,0x1DD61},{0x32AA,0x1DD81},{0x32AB,0x1DDA1},{0x32AC,0x1DDC1},
+    {0x32AD,0x1DDE1},{0x32AE,0x1DE01},{0x32AF,0x1DE21},{0x32B0,0x1DE41},{0x32B1,0x1DE62},{0x32B2,0x1DEA2},
+    {0x32B3,0x1DEE2},{0x32B4,0x1DF22},{0x32B5,0x1DF62},{0x32B6,0x1DFA2},{0x32B7,0x1DFE2},{0x32B8,0x1E022},
+    {0x32B9,0x1E062},{0x32BA,0x1E0A2},{0x32BB,0x1E0E2},{0x32BC,0x1E122},{0x32BD,0x1E162},{0x32BE,0x1E1A2},
+    {0x32BF,0x1E1E2},{0x32C0,0x1E222},{0x32C1,0x1E262},{0x32C2,0x1E2A2},{0x32C3,0x1E2E2},{0x32C4,0x1E322},
+    {0x32C5,0x1E362},{0x32C6,0x1E3A2},{0x32C7,0x1E3E2},{0x32C8,0x1E422},{0x32C9,0x1E463},{0x32CA,0x1E4C3},
+    {0x32CB,0x1E523},{0x32CC,0x1E582},{0x32CD,0x1E5C3},{0x32CE,0x1E622},{0x32CF,0x1E663},{0x32D0,0x1E6C1},
+    {0x32D1,0x1E6E1},{0x32D2,0x1E701},{0x32D3,0x1E721},{0x32D4,0x1E741},{0x32D5,0x1E761},{0x32D6,0x1E781},
+    {0x32D7,0x1E7A1},{0x32D8,0x1E7C1},{0x32D9,0x1E7E1},{0x32DA,0x1E801},{0x32DB,0x1E821},{0x32DC,0x1E841},
+    {0x32DD,0x1E861},{0x32DE,0x1E881},{0x32DF,0x1E8A1},{0x32E0,0x1E8C1},{0x32E1,0x1E8E1},{0x32E2,0x1E901},
+    {0x32E3,0x1E921},{0x32E4,0x1E941},{0x32E5,0x1E961},{0x32E6,0x1E981},{0x32E7,0x1E9A1},{0x32E8,0x1E9C1},
+    {0x32E9,0x1E9E1},{0x32EA,0x1EA01},{0x32EB,0x1EA21},{0x32EC,0x1EA41},{0x32ED,0x1EA61},{0x32EE,0x1EA81},
+    {0x32EF,0x1EAA1},{0x32F0,0x1EAC1},{0x32F1,0x1EAE1},{0x32F2,0x1EB01},{0x32F3,0x1EB21},{0x32F4,0x1EB41},
+    {0x32F5,0x1EB61},{0x32F6,0x1EB81},{0x32F7,0x1EBA1},{0x32F8,0x1EBC1},{0x32F9,0x1EBE1},{0x32FA,0x1EC01},
+    {0x32FB,0x1EC21},{0x32FC,0x1EC41},{0x32FD,0x1EC61},{0x32FE,0x1EC81},{0x32FF,0x1ECA2},{0x3300,0x1ECE5},
+    {0x3301,0x1ED84},{0x3302,0x1EE05},{0x3303,0x1EEA3},{0x3304,0x1EF05},{0x3305,0x1EFA3},{0x3306,0x1F003},
+    {0x3307,0x1F066},{0x3308,0x1F124},{0x3309,0x1F1A3},{0x330A,0x1F203},{0x330B,0x1F263},{0x330C,0x1F2C4},
+    {0x330D,0x1F344},{0x330E,0x1F3C4},{0x330F,0x1F444},{0x3310,0x1F4C4},{0x3311,0x1F544},{0x3312,0x1F5C4},
+    {0x3313,0x1F646},{0x3314,0x1F702},{0x3315,0x1F746},{0x3316,0x1F806},{0x3317,0x1F8C5},{0x3318,0x1F964},
+    {0x3319,0x1F9E6},{0x331A,0x1FAA6},{0x331B,0x1FB64},{0x331C,0x1FBE3},{0x331D,0x1FC43},{0x331E,0x1FCA4},
+    {0x331F,0x1FD24},{0x3320,0x1FDA5},{0x3321,0x1FE45},{0x3322,0x1FEE3},{0x3323,0x1FF43},{0x3324,0x1FFA4},
+    {0x3325,0x20023},{0x3326,0x20083},{0x3327,0x200E2},{0x3328,0x20122},{0x3329,0x20163},{0x332A,0x201C3},
+    {0x332B,0x20226},{0x332C,0x202E4},{0x332D,0x20365},{0x332E,0x20406},{0x332F,0x204C4},{0x3330,0x20543},
+    {0x3331,0x205A3},{0x3332,0x20606},{0x3333,0x206C4},{0x3334,0x20746},{0x3335,0x20803},{0x3336,0x20865},
+    {0x3337,0x20903},{0x3338,0x20964},{0x3339,0x209E3},{0x333A,0x20A44},{0x333B,0x20AC5},{0x333C,0x20B64},
+    {0x333D,0x20BE5},{0x333E,0x20C84},{0x333F,0x20D02},{0x3340,0x20D45},{0x3341,0x20DE3},{0x3342,0x20E43},
+    {0x3343,0x20EA4},{0x3344,0x20F23},{0x3345,0x20F83},{0x3346,0x20FE3},{0x3347,0x21045},{0x3348,0x210E4},
+    {0x3349,0x21162},{0x334A,0x211A6},{0x334B,0x21263},{0x334C,0x212C5},{0x334D,0x21364},{0x334E,0x213E4},
+    {0x334F,0x21463},{0x3350,0x214C3},{0x3351,0x21524},{0x3352,0x215A2},{0x3353,0x215E4},{0x3354,0x21665},
+    {0x3355,0x21702},{0x3356,0x21746},{0x3357,0x21803},{0x3358,0x21862},{0x3359,0x218A2},{0x335A,0x218E2},
+    {0x335B,0x21922},{0x335C,0x21962},{0x335D,0x219A2},{0x335E,0x219E2},{0x335F,0x21A22},{0x3360,0x21A62},
+    {0x3361,0x21AA2},{0x3362,0x21AE3},{0x3363,0x21B43},{0x3364,0x21BA3},{0x3365,0x21C03},{0x3366,0x21C63},
+    {0x3367,0x21CC3},{0x3368,0x21D23},{0x3369,0x21D83},{0x336A,0x21DE3},{0x336B,0x21E43},{0x336C,0x21EA3},
+    {0x336D,0x21F03},{0x336E,0x21F63},{0x336F,0x21FC3},{0x3370,0x22023},{0x3371,0x22083},{0x3372,0x220E2},
+    {0x3373,0x22122},{0x3374,0x22163},{0x3375,0x221C2},{0x3376,0x22202},{0x3377,0x22242},{0x3378,0x22283},
+    {0x3379,0x222E3},{0x337A,0x22342},{0x337B,0x22382},{0x337C,0x223C2},{0x337D,0x22402},{0x337E,0x22442},
+    {0x337F,0x22484},{0x3380,0x22502},{0x3381,0x22542},{0x3382,0x22582},{0x3383,0x225C2},{0x3384,0x22602},
+    {0x3385,0x22642},{0x3386,0x22682},{0x3387,0x226C2},{0x3388,0x22703},{0x3389,0x22764},{0x338A,0x227E2},
+    {0x338B,0x22822},{0x338C,0x22862},{0x338D,0x228A2},{0x338E,0x228E2},{0x338F,0x22922},{0x3390,0x22962},
+    {0x3391,0x229A3},{0x3392,0x22A03},{0x3393,0x22A63},{0x3394,0x22AC3},{0x3395,0x22B22},{0x3396,0x22B62},
+    {0x3397,0x22BA2},{0x3398,0x22BE2},{0x3399,0x22C22},{0x339A,0x22C62},{0x339B,0x22CA2},{0x339C,0x22CE2},
+    {0x339D,0x22D22},{0x339E,0x22D62},{0x339F,0x22DA3},{0x33A0,0x22E03},{0x33A1,0x22E62},{0x33A2,0x22EA3},
+    {0x33A3,0x22F03},{0x33A4,0x22F63},{0x33A5,0x22FC2},{0x33A6,0x23003},{0x33A7,0x23063},{0x33A8,0x230C4},
+    {0x33A9,0x23142},{0x33AA,0x23183},{0x33AB,0x231E3},{0x33AC,0x23243},{0x33AD,0x232A3},{0x33AE,0x23305},
+    {0x33AF,0x233A6},{0x33B0,0x23462},{0x33B1,0x234A2},{0x33B2,0x234E2},{0x33B3,0x23522},{0x33B4,0x23562},
+    {0x33B5,0x235A2},{0x33B6,0x235E2},{0x33B7,0x23622},{0x33B8,0x23662},{0x33B9,0x236A2},{0x33BA,0x236E2},
+    {0x33BB,0x23722},{0x33BC,0x23762},{0x33BD,0x237A2},{0x33BE,0x237E2},{0x33BF,0x23822},{0x33C0,0x23862},
+    {0x33C1,0x238A2},{0x33C2,0x238E4},{0x33C3,0x23962},{0x33C4,0x239A2},{0x33C5,0x239E2},{0x33C6,0x23A24},
+    {0x33C7,0x23AA3},{0x33C8,0x23B02},{0x33C9,0x23B42},{0x33CA,0x23B82},{0x33CB,0x23BC2},{0x33CC,0x23C02},
+    {0x33CD,0x23C42},{0x33CE,0x23C82},{0x33CF,0x23CC2},{0x33D0,0x23D02},{0x33D1,0x23D42},{0x33D2,0x23D83},
+    {0x33D3,0x23DE2},{0x33D4,0x23E22},{0x33D5,0x23E63},{0x33D6,0x23EC3},{0x33D7,0x23F22},{0x33D8,0x23F64},
+    {0x33D9,0x23FE3},{0x33DA,0x24042},{0x33DB,0x24082},{0x33DC,0x240C2},{0x33DD,0x24102},{0x33DE,0x24143},
+    {0x33DF,0x241A3},{0x33E0,0x24202},{0x33E1,0x24242},{0x33E2,0x24282},{0x33E3,0x242C2},{0x33E4,0x24302},
+    {0x33E5,0x24342},{0x33E6,0x24382},{0x33E7,0x243C2},{0x33E8,0x24402},{0x33E9,0x24443},{0x33EA,0x244A3},
+    {0x33EB,0x24503},{0x33EC,0x24563},{0x33ED,0x245C3},{0x33EE,0x24623},{0x33EF,0x24683},{0x33F0,0x246E3},
+    {0x33F1,0x24743},{0x33F2,0x247A3},{0x33F3,0x24803},{0x33F4,0x24863},{0x33F5,0x248C3},{0x33F6,0x24923},
+    {0x33F7,0x24983},{0x33F8,0x249E3},{0x33F9,0x24A43},{0x33FA,0x24AA3},{0x33FB,0x24B03},{0x33FC,0x24B63},
+    {0x33FD,0x24BC3},{0x33FE,0x24C23},{0x33FF,0x24C83},{0xA69C,0x24CE1},{0xA69D,0x24D01},{0xA770,0x24D21},
+    {0xA7F2,0x24D41},{0xA7F3,0x24D61},{0xA7F4,0x24D81},{0xA7F8,0x24DA1},{0xA7F9,0x24DC1},{0xAB5C,0x24DE1},
+    {0xAB5D,0x24E01},{0xAB5E,0x24E21},{0xAB5F,0x24E41},{0xAB69,0x24E61},{0xFB00,0x28802},{0xFB01,0x28842},
+    {0xFB02,0x28882},{0xFB03,0x288C3},{0xFB04,0x28923},{0xFB05,0x28982},{0xFB06,0x289C2},{0xFB13,0x28A02},
+    {0xFB14,0x28A42},{0xFB15,0x28A82},{0xFB16,0x28AC2},{0xFB17,0x28B02},{0xFB20,0x28BC1},{0xFB21,0x28BE1},
+    {0xFB22,0x28C01},{0xFB23,0x28C21},{0xFB24,0x28C41},{0xFB25,0x28C61},{0xFB26,0x28C81},{0xFB27,0x28CA1},
+    {0xFB28,0x28CC1},{0xFB29,0x28CE1},{0xFB4F,0x29542},{0xFB50,0x29581},{0xFB51,0x295A1},{0xFB52,0x295C1},
+    {0xFB53,0x295E1},{0xFB54,0x29601},{0xFB55,0x29621},{0xFB56,0x29641},{0xFB57,0x29661},{0xFB58,0x29681},
+    {0xFB59,0x296A1},{0xFB5A,0x296C1},{0xFB5B,0x296E1},{0xFB5C,0x29701},{0xFB5D,0x29721},{0xFB5E,0x29741},
+    {0xFB5F,0x29761},{0xFB60,0x29781},{0xFB61,0x297A1},{0xFB62,0x297C1},{0xFB63,0x297E1},{0xFB64,0x29801},
+    {0xFB65,0x29821},{0xFB66,0x29841},{0xFB67,0x29861},{0xFB68,0x29881},{0xFB69,0x298A1},{0xFB6A,0x298C1},
+    {0xFB6B,0x298E1},{0xFB6C,0x29901},{0xFB6D,0x29921},{0xFB6E,0x29941},{0xFB6F,0x29961},{0xFB70,0x29981},
+    {0xFB71,0x299A1},{0xFB72,0x299C1},{0xFB73,0x299E1},{0xFB74,0x29A01},{0xFB75,0x29A21},{0xFB76,0x29A41},
+    {0xFB77,0x29A61},{0xFB78,0x29A81},{0xFB79,0x29AA1},{0xFB7A,0x29AC1},{0xFB7B,0x29AE1},{0xFB7C,0x29B01},
+    {0xFB7D,0x29B21},{0xFB7E,0x29B41},{0xFB7F,0x29B61},{0xFB80,0x29B81},{0xFB81,0x29BA1},{0xFB82,0x29BC1},
+    {0xFB83,0x29BE1},{0xFB84,0x29C01},{0xFB85,0x29C21},{0xFB86,0x29C41},{0xFB87,0x29C61},{0xFB88,0x29C81},
+    {0xFB89,0x29CA1},{0xFB8A,0x29CC1},{0xFB8B,0x29CE1},{0xFB8C,0x29D01},{0xFB8D,0x29D21},{0xFB8E,0x29D41},
+    {0xFB8F,0x29D61},{0xFB90,0x29D81},{0xFB91,0x29DA1},{0xFB92,0x29DC1},{0xFB93,0x29DE1},{0xFB94,0x29E01},
+    {0xFB95,0x29E21},{0xFB96,0x29E41},{0xFB97,0x29E61},{0xFB98,0x29E81},{0xFB99,0x29EA1},{0xFB9A,0x29EC1},
+    {0xFB9B,0x29EE1},{0xFB9C,0x29F01},{0xFB9D,0x29F21},{0xFB9E,0x29F41},{0xFB9F,0x29F61},{0xFBA0,0x29F81},
+    {0xFBA1,0x29FA1},{0xFBA2,0x29FC1},{0xFBA3,0x29FE1},{0xFBA4,0x2A002},{0xFBA5,0x2A042},{0xFBA6,0x2A081},
+    {0xFBA7,0x2A0A1},{0xFBA8,0x2A0C1},{0xFBA9,0x2A0E1},{0xFBAA,0x2A101},{0xFBAB,0x2A121},{0xFBAC,0x2A141},
+    {0xFBAD,0x2A161},{0xFBAE,0x2A181},{0xFBAF,0x2A1A1},{0xFBB0,0x2A1C2},{0xFBB1,0x2A202},{0xFBD3,0x2A241},
+    {0xFBD4,0x2A261},{0xFBD5,0x2A281},{0xFBD6,0x2A2A1},{0xFBD7,0x2A2C1},{0xFBD8,0x2A2E1},{0xFBD9,0x2A301},
+    {0xFBDA,0x2A321},{0xFBDB,0x2A341},{0xFBDC,0x2A361},{0xFBDD,0x2A382},{0xFBDE,0x2A3C1},{0xFBDF,0x2A3E1},
+    {0xFBE0,0x2A401},{0xFBE1,0x2A421},{0xFBE2,0x2A441},{0xFBE3,0x2A461},{0xFBE4,0x2A481},{0xFBE5,0x2A4A1},
+    {0xFBE6,0x2A4C1},{0xFBE7,0x2A4E1},{0xFBE8,0x2A501},{0xFBE9,0x2A521},{0xFBEA,0x2A543},{0xFBEB,0x2A5A3},
+    {0xFBEC,0x2A603},{0xFBED,0x2A663},{0xFBEE,0x2A6C3},{0xFBEF,0x2A723},{0xFBF0,0x2A783},{0xFBF1,0x2A7E3},
+    {0xFBF2,0x2A843},{0xFBF3,0x2A8A3},{0xFBF4,0x2A903},{0xFBF5,0x2A963},{0xFBF6,0x2A9C3},{0xFBF7,0x2AA23},
+    {0xFBF8,0x2AA83},{0xFBF9,0x2AAE3},{0xFBFA,0x2AB43},{0xFBFB,0x2ABA3},{0xFBFC,0x2AC01},{0xFBFD,0x2AC21},
+    {0xFBFE,0x2AC41},{0xFBFF,0x2AC61},{0xFC00,0x2AC83},{0xFC01,0x2ACE3},{0xFC02,0x2AD43},{0xFC03,0x2ADA3},
+    {0xFC04,0x2AE03},{0xFC05,0x2AE62},{0xFC06,0x2AEA2},{0xFC07,0x2AEE2},{0xFC08,0x2AF22},{0xFC09,0x2AF62},
+    {0xFC0A,0x2AFA2},{0xFC0B,0x2AFE2},{0xFC0C,0x2B022},{0xFC0D,0x2B062},{0xFC0E,0x2B0A2},{0xFC0F,0x2B0E2},
+    {0xFC10,0x2B122},{0xFC11,0x2B162},{0xFC12,0x2B1A2},{0xFC13,0x2B1E2},{0xFC14,0x2B222},{0xFC15,0x2B262},
+    {0xFC16,0x2B2A2},{0xFC17,0x2B2E2},{0xFC18,0x2B322},{0xFC19,0x2B362},{0xFC1A,0x2B3A2},{0xFC1B,0x2B3E2},
+    {0xFC1C,0x2B422},{0xFC1D,0x2B462},{0xFC1E,0x2B4A2},{0xFC1F,0x2B4E2},{0xFC20,0x2B522},{0xFC21,0x2B562},
+    {0xFC22,0x2B5A2},{0xFC23,0x2B5E2},{0xFC24,0x2B622},{0xFC25,0x2B662},{0xFC26,0x2B6A2},{0xFC27,0x2B6E2},
+    {0xFC28,0x2B722},{0xFC29,0x2B762},{0xFC2A,0x2B7A2},{0xFC2B,0x2B7E2},{0xFC2C,0x2B822},{0xFC2D,0x2B862},
+    {0xFC2E,0x2B8A2},{0xFC2F,0x2B8E2},{0xFC30,0x2B922},{0xFC31,0x2B962},{0xFC32,0x2B9A2},{0xFC33,0x2B9E2},
+    {0xFC34,0x2BA22},{0xFC35,0x2BA62},{0xFC36,0x2BAA2},{0xFC37,0x2BAE2},{0xFC38,0x2BB22},{0xFC39,0x2BB62},
+    {0xFC3A,0x2BBA2},{0xFC3B,0x2BBE2},{0xFC3C,0x2BC22},{0xFC3D,0x2BC62},{0xFC3E,0x2BCA2},{0xFC3F,0x2BCE2},
+    {0xFC40,0x2BD22},{0xFC41,0x2BD62},{0xFC42,0x2BDA2},{0xFC43,0x2BDE2},{0xFC44,0x2BE22},{0xFC45,0x2BE62},
+    {0xFC46,0x2BEA2},{0xFC47,0x2BEE2},{0xFC48,0x2BF22},{0xFC49,0x2BF62},{0xFC4A,0x2BFA2},{0xFC4B,0x2BFE2},
+    {0xFC4C,0x2C022},{0xFC4D,0x2C062},{0xFC4E,0x2C0A2},{0xFC4F,0x2C0E2},{0xFC50,0x2C122},{0xFC51,0x2C162},
+    {0xFC52,0x2C1A2},{0xFC53,0x2C1E2},{0xFC54,0x2C222},{0xFC55,0x2C262},{0xFC56,0x2C2A2},{0xFC57,0x2C2E2},
+    {0xFC58,0x2C322},{0xFC59,0x2C362},{0xFC5A,0x2C3A2},{0xFC5B,0x2C3E2},{0xFC5C,0x2C422},{0xFC5D,0x2C462},
+    {0xFC5E,0x2C4A3},{0xFC5F,0x2C503},{0xFC60,0x2C563},{0xFC61,0x2C5C3},{0xFC62,0x2C623},{0xFC63,0x2C683},
+    {0xFC64,0x2C6E3},{0xFC65,0x2C743},{0xFC66,0x2C7A3},{0xFC67,0x2C803},{0xFC68,0x2C863},{0xFC69,0x2C8C3},
+    {0xFC6A,0x2C922},{0xFC6B,0x2C962},{0xFC6C,0x2C9A2},{0xFC6D,0x2C9E2},{0xFC6E,0x2CA22},{0xFC6F,0x2CA62},
+    {0xFC70,0x2CAA2},{0xFC71,0x2CAE2},{0xFC72,0x2CB22},{0xFC73,0x2CB62},{0xFC74,0x2CBA2},{0xFC75,0x2CBE2},
+    {0xFC76,0x2CC22},{0xFC77,0x2CC62},{0xFC78,0x2CCA2},{0xFC79,0x2CCE2},{0xFC7A,0x2CD22},{0xFC7B,0x2CD62},
+    {0xFC7C,0x2CDA2},{0xFC7D,0x2CDE2},{0xFC7E,0x2CE22},{0xFC7F,0x2CE62},{0xFC80,0x2CEA2},{0xFC81,0x2CEE2},
+    {0xFC82,0x2CF22},{0xFC83,0x2CF62},{0xFC84,0x2CFA2},{0xFC85,0x2CFE2},{0xFC86,0x2D022},{0xFC87,0x2D062},
+    {0xFC88,0x2D0A2},{0xFC89,0x2D0E2},{0xFC8A,0x2D122},{0xFC8B,0x2D162},{0xFC8C,0x2D1A2},{0xFC8D,0x2D1E2},
+    {0xFC8E,0x2D222},{0xFC8F,0x2D262},{0xFC90,0x2D2A2},{0xFC91,0x2D2E2},{0xFC92,0x2D322},{0xFC93,0x2D362},
+    {0xFC94,0x2D3A2},{0xFC95,0x2D3E2},{0xFC96,0x2D422},{0xFC97,0x2D463},{0xFC98,0x2D4C3},{0xFC99,0x2D523},
+    {0xFC9A,0x2D583},{0xFC9B,0x2D5E3},{0xFC9C,0x2D642},{0xFC9D,0x2D682},{0xFC9E,0x2D6C2},{0xFC9F,0x2D702},
+    {0xFCA0,0x2D742},{0xFCA1,0x2D782},{0xFCA2,0x2D7C2},{0xFCA3,0x2D802},{0xFCA4,0x2D842},{0xFCA5,0x2D882},
+    {0xFCA6,0x2D8C2},{0xFCA7,0x2D902},{0xFCA8,0x2D942},{0xFCA9,0x2D982},{0xFCAA,0x2D9C2},{0xFCAB,0x2DA02},
+    {0xFCAC,0x2DA42},{0xFCAD,0x2DA82},{0xFCAE,0x2DAC2},{0xFCAF,0x2DB02},{0xFCB0,0x2DB42},{0xFCB1,0x2DB82},
+    {0xFCB2,0x2DBC2},{0xFCB3,0x2DC02},{0xFCB4,0x2DC42},{0xFCB5,0x2DC82},{0xFCB6,0x2DCC2},{0xFCB7,0x2DD02},
+    {0xFCB8,0x2DD42},{0xFCB9,0x2DD82},{0xFCBA,0x2DDC2},{0xFCBB,0x2DE02},{0xFCBC,0x2DE42},{0xFCBD,0x2DE82},
+    {0xFCBE,0x2DEC2},{0xFCBF,0x2DF02},{0xFCC0,0x2DF42},{0xFCC1,0x2DF82},{0xFCC2,0x2DFC2},{0xFCC3,0x2E002},
+    {0xFCC4,0x2E042},{0xFCC5,0x2E082},{0xFCC6,0x2E0C2},{0xFCC7,0x2E102},{0xFCC8,0x2E142},{0xFCC9,0x2E182},
+    {0xFCCA,0x2E1C2},{0xFCCB,0x2E202},{0xFCCC,0x2E242},{0xFCCD,0x2E282},{0xFCCE,0x2E2C2},{0xFCCF,0x2E302},
+    {0xFCD0,0x2E342},{0xFCD1,0x2E382},{0xFCD2,0x2E3C2},{0xFCD3,0x2E402},{0xFCD4,0x2E442},{0xFCD5,0x2E482},
+    {0xFCD6,0x2E4C2},{0xFCD7,0x2E502},{0xFCD8,0x2E542},{0xFCD9,0x2E582},{0xFCDA,0x2E5C2},{0xFCDB,0x2E602},
+    {0xFCDC,0x2E642},{0xFCDD,0x2E682},{0xFCDE,0x2E6C2},{0xFCDF,0x2E703},{0xFCE0,0x2E763},{0xFCE1,0x2E7C2},
+    {0xFCE2,0x2E802},{0xFCE3,0x2E842},{0xFCE4,0x2E882},{0xFCE5,0x2E8C2},{0xFCE6,0x2E902},{0xFCE7,0x2E942},
+    {0xFCE8,0x2E982},{0xFCE9,0x2E9C2},{0xFCEA,0x2EA02},{0xFCEB,0x2EA42},{0xFCEC,0x2EA82},{0xFCED,0x2EAC2},
+    {0xFCEE,0x2EB02},{0xFCEF,0x2EB42},{0xFCF0,0x2EB82},{0xFCF1,0x2EBC2},{0xFCF2,0x2EC03},{0xFCF3,0x2EC63},
+    {0xFCF4,0x2ECC3},{0xFCF5,0x2ED22},{0xFCF6,0x2ED62},{0xFCF7,0x2EDA2},{0xFCF8,0x2EDE2},{0xFCF9,0x2EE22},
+    {0xFCFA,0x2EE62},{0xFCFB,0x2EEA2},{0xFCFC,0x2EEE2},{0xFCFD,0x2EF22},{0xFCFE,0x2EF62},{0xFCFF,0x2EFA2},
+    {0xFD00,0x2EFE2},{0xFD01,0x2F022},{0xFD02,0x2F062},{0xFD03,0x2F0A2},{0xFD04,0x2F0E2},{0xFD05,0x2F122},
+    {0xFD06,0x2F162},{0xFD07,0x2F1A2},{0xFD08,0x2F1E2},{0xFD09,0x2F222},{0xFD0A,0x2F262},{0xFD0B,0x2F2A2},
+    {0xFD0C,0x2F2E2},{0xFD0D,0x2F322},{0xFD0E,0x2F362},{0xFD0F,0x2F3A2},{0xFD10,0x2F3E2},{0xFD11,0x2F422},
+    {0xFD12,0x2F462},{0xFD13,0x2F4A2},{0xFD14,0x2F4E2},{0xFD15,0x2F522},{0xFD16,0x2F562},{0xFD17,0x2F5A2},
+    {0xFD18,0x2F5E2},{0xFD19,0x2F622},{0xFD1A,0x2F662},{0xFD1B,0x2F6A2},{0xFD1C,0x2F6E2},{0xFD1D,0x2F722},
+    {0xFD1E,0x2F762},{0xFD1F,0x2F7A2},{0xFD20,0x2F7E2},{0xFD21,0x2F822},{0xFD22,0x2F862},{0xFD23,0x2F8A2},
+    {0xFD24,0x2F8E2},{0xFD25,0x2F922},{0xFD26,0x2F962},{0xFD27,0x2F9A2},{0xFD28,0x2F9E2},{0xFD29,0x2FA22},
+    {0xFD2A,0x2FA62},{0xFD2B,0x2FAA2},{0xFD2C,0x2FAE2},{0xFD2D,0x2FB22},{0xFD2E,0x2FB62},{0xFD2F,0x2FBA2},
+    {0xFD30,0x2FBE2},{0xFD31,0x2FC22},{0xFD32,0x2FC62},{0xFD33,0x2FCA2},{0xFD34,0x2FCE2},{0xFD35,0x2FD22},
+    {0xFD36,0x2FD62},{0xFD37,0x2FDA2},{0xFD38,0x2FDE2},{0xFD39,0x2FE22},{0xFD3A,0x2FE62},{0xFD3B,0x2FEA2},
+    {0xFD3C,0x2FEE2},{0xFD3D,0x2FF22},{0xFD50,0x2FF63},{0xFD51,0x2FFC3},{0xFD52,0x30023},{0xFD53,0x30083},
+    {0xFD54,0x300E3},{0xFD55,0x30143},{0xFD56,0x301A3},{0xFD57,0x30203},{0xFD58,0x30263},{0xFD59,0x302C3},
+    {0xFD5A,0x30323},{0xFD5B,0x30383},{0xFD5C,0x303E3},{0xFD5D,0x30443},{0xFD5E,0x304A3},{0xFD5F,0x30503},
+    {0xFD60,0x30563},{0xFD61,0x305C3},{0xFD62,0x30623},{0xFD63,0x30683},{0xFD64,0x306E3},{0xFD65,0x30743},
+    {0xFD66,0x307A3},{0xFD67,0x30803},{0xFD68,0x30863},{0xFD69,0x308C3},{0xFD6A,0x30923},{0xFD6B,0x30983},
+    {0xFD6C,0x309E3},{0xFD6D,0x30A43},{0xFD6E,0x30AA3},{0xFD6F,0x30B03},{0xFD70,0x30B63},{0xFD71,0x30BC3},
+    {0xFD72,0x30C23},{0xFD73,0x30C83},{0xFD74,0x30CE3},{0xFD75,0x30D43},{0xFD76,0x30DA3},{0xFD77,0x30E03},
+    {0xFD78,0x30E63},{0xFD79,0x30EC3},{0xFD7A,0x30F23},{0xFD7B,0x30F83},{0xFD7C,0x30FE3},{0xFD7D,0x31043},
+    {0xFD7E,0x310A3},{0xFD7F,0x31103},{0xFD80,0x31163},{0xFD81,0x311C3},{0xFD82,0x31223},{0xFD83,0x31283},
+    {0xFD84,0x312E3},{0xFD85,0x31343},{0xFD86,0x313A3},{0xFD87,0x31403},{0xFD88,0x31463},{0xFD89,0x314C3},
+    {0xFD8A,0x31523},{0xFD8B,0x31583},{0xFD8C,0x315E3},{0xFD8D,0x31643},{0xFD8E,0x316A3},{0xFD8F,0x31703},
+    {0xFD92,0x31763},{0xFD93,0x317C3},{0xFD94,0x31823},{0xFD95,0x31883},{0xFD96,0x318E3},{0xFD97,0x31943},
+    {0xFD98,0x319A3},{0xFD99,0x31A03},{0xFD9A,0x31A63},{0xFD9B,0x31AC3},{0xFD9C,0x31B23},{0xFD9D,0x31B83},
+    {0xFD9E,0x31BE3},{0xFD9F,0x31C43},{0xFDA0,0x31CA3},{0xFDA1,0x31D03},{0xFDA2,0x31D63},{0xFDA3,0x31DC3},
+    {0xFDA4,0x31E23},{0xFDA5,0x31E83},{0xFDA6,0x31EE3},{0xFDA7,0x31F43},{0xFDA8,0x31FA3},{0xFDA9,0x32003},
+    {0xFDAA,0x32063},{0xFDAB,0x320C3},{0xFDAC,0x32123},{0xFDAD,0x32183},{0xFDAE,0x321E3},{0xFDAF,0x32243},
+    {0xFDB0,0x322A3},{0xFDB1,0x32303},{0xFDB2,0x32363},{0xFDB3,0x323C3},{0xFDB4,0x32423},{0xFDB5,0x32483},
+    {0xFDB6,0x324E3},{0xFDB7,0x32543},{0xFDB8,0x325A3},{0xFDB9,0x32603},{0xFDBA,0x32663},{0xFDBB,0x326C3},
+    {0xFDBC,0x32723},{0xFDBD,0x32783},{0xFDBE,0x327E3},{0xFDBF,0x32843},{0xFDC0,0x328A3},{0xFDC1,0x32903},
+    {0xFDC2,0x32963},{0xFDC3,0x329C3},{0xFDC4,0x32A23},{0xFDC5,0x32A83},{0xFDC6,0x32AE3},{0xFDC7,0x32B43},
+    {0xFDF0,0x32BA3},{0xFDF1,0x32C03},{0xFDF2,0x32C64},{0xFDF3,0x32CE4},{0xFDF4,0x32D64},{0xFDF5,0x32DE4},
+    {0xFDF6,0x32E64},{0xFDF7,0x32EE4},{0xFDF8,0x32F64},{0xFDF9,0x32FE3},{0xFDFA,0x33052},{0xFDFB,0x33288},
+    {0xFDFC,0x33384},{0xFE10,0x33401},{0xFE11,0x33421},{0xFE12,0x33441},{0xFE13,0x33461},{0xFE14,0x33481},
+    {0xFE15,0x334A1},{0xFE16,0x334C1},{0xFE17,0x334E1},{0xFE18,0x33501},{0xFE19,0x33523},{0xFE30,0x33582},
+    {0xFE31,0x335C1},{0xFE32,0x335E1},{0xFE33,0x33601},{0xFE34,0x33621},{0xFE35,0x33641},{0xFE36,0x33661},
+    {0xFE37,0x33681},{0xFE38,0x336A1},{0xFE39,0x336C1},{0xFE3A,0x336E1},{0xFE3B,0x33701},{0xFE3C,0x33721},
+    {0xFE3D,0x33741},{0xFE3E,0x33761},{0xFE3F,0x33781},{0xFE40,0x337A1},{0xFE41,0x337C1},{0xFE42,0x337E1},
+    {0xFE43,0x33801},{0xFE44,0x33821},{0xFE47,0x33841},{0xFE48,0x33861},{0xFE49,0x33882},{0xFE4A,0x338C2},
+    {0xFE4B,0x33902},{0xFE4C,0x33942},{0xFE4D,0x33981},{0xFE4E,0x339A1},{0xFE4F,0x339C1},{0xFE50,0x339E1},
+    {0xFE51,0x33A01},{0xFE52,0x33A21},{0xFE54,0x33A41},{0xFE55,0x33A61},{0xFE56,0x33A81},{0xFE57,0x33AA1},
+    {0xFE58,0x33AC1},{0xFE59,0x33AE1},{0xFE5A,0x33B01},{0xFE5B,0x33B21},{0xFE5C,0x33B41},{0xFE5D,0x33B61},
+    {0xFE5E,0x33B81},{0xFE5F,0x33BA1},{0xFE60,0x33BC1},{0xFE61,0x33BE1},{0xFE62,0x33C01},{0xFE63,0x33C21},
+    {0xFE64,0x33C41},{0xFE65,0x33C61},{0xFE66,0x33C81},{0xFE68,0x33CA1},{0xFE69,0x33CC1},{0xFE6A,0x33CE1},
+    {0xFE6B,0x33D01},{0xFE70,0x33D22},{0xFE71,0x33D62},{0xFE72,0x33DA2},{0xFE74,0x33DE2},{0xFE76,0x33E22},
+    {0xFE77,0x33E62},{0xFE78,0x33EA2},{0xFE79,0x33EE2},{0xFE7A,0x33F22},{0xFE7B,0x33F62},{0xFE7C,0x33FA2},
+    {0xFE7D,0x33FE2},{0xFE7E,0x34022},{0xFE7F,0x34062},{0xFE80,0x340A1},{0xFE81,0x340C2},{0xFE82,0x34102},
+    {0xFE83,0x34142},{0xFE84,0x34182},{0xFE85,0x341C2},{0xFE86,0x34202},{0xFE87,0x34242},{0xFE88,0x34282},
+    {0xFE89,0x342C2},{0xFE8A,0x34302},{0xFE8B,0x34342},{0xFE8C,0x34382},{0xFE8D,0x343C1},{0xFE8E,0x343E1},
+    {0xFE8F,0x34401},{0xFE90,0x34421},{0xFE91,0x34441},{0xFE92,0x34461},{0xFE93,0x34481},{0xFE94,0x344A1},
+    {0xFE95,0x344C1},{0xFE96,0x344E1},{0xFE97,0x34501},{0xFE98,0x34521},{0xFE99,0x34541},{0xFE9A,0x34561},
+    {0xFE9B,0x34581},{0xFE9C,0x345A1},{0xFE9D,0x345C1},{0xFE9E,0x345E1},{0xFE9F,0x34601},{0xFEA0,0x34621},
+    {0xFEA1,0x34641},{0xFEA2,0x34661},{0xFEA3,0x34681},{0xFEA4,0x346A1},{0xFEA5,0x346C1},{0xFEA6,0x346E1},
+    {0xFEA7,0x34701},{0xFEA8,0x34721},{0xFEA9,0x34741},{0xFEAA,0x34761},{0xFEAB,0x34781},{0xFEAC,0x347A1},
+    {0xFEAD,0x347C1},{0xFEAE,0x347E1},{0xFEAF,0x34801},{0xFEB0,0x34821},{0xFEB1,0x34841},{0xFEB2,0x34861},
+    {0xFEB3,0x34881},{0xFEB4,0x348A1},{0xFEB5,0x348C1},{0xFEB6,0x348E1},{0xFEB7,0x34901},{0xFEB8,0x34921},
+    {0xFEB9,0x34941},{0xFEBA,0x34961},{0xFEBB,0x34981},{0xFEBC,0x349A1},{0xFEBD,0x349C1},{0xFEBE,0x349E1},
+    {0xFEBF,0x34A01},{0xFEC0,0x34A21},{0xFEC1,0x34A41},{0xFEC2,0x34A61},{0xFEC3,0x34A81},{0xFEC4,0x34AA1},
+    {0xFEC5,0x34AC1},{0xFEC6,0x34AE1},{0xFEC7,0x34B01},{0xFEC8,0x34B21},{0xFEC9,0x34B41},{0xFECA,0x34B61},
+    {0xFECB,0x34B81},{0xFECC,0x34BA1},{0xFECD,0x34BC1},{0xFECE,0x34BE1},{0xFECF,0x34C01},{0xFED0,0x34C21},
+    {0xFED1,0x34C41},{0xFED2,0x34C61},{0xFED3,0x34C81},{0xFED4,0x34CA1},{0xFED5,0x34CC1},{0xFED6,0x34CE1},
+    {0xFED7,0x34D01},{0xFED8,0x34D21},{0xFED9,0x34D41},{0xFEDA,0x34D61},{0xFEDB,0x34D81},{0xFEDC,0x34DA1},
+    {0xFEDD,0x34DC1},{0xFEDE,0x34DE1},{0xFEDF,0x34E01},{0xFEE0,0x34E21},{0xFEE1,0x34E41},{0xFEE2,0x34E61},
+    {0xFEE3,0x34E81},{0xFEE4,0x34EA1},{0xFEE5,0x34EC1},{0xFEE6,0x34EE1},{0xFEE7,0x34F01},{0xFEE8,0x34F21},
+    {0xFEE9,0x34F41},{0xFEEA,0x34F61},{0xFEEB,0x34F81},{0xFEEC,0x34FA1},{0xFEED,0x34FC1},{0xFEEE,0x34FE1},
+    {0xFEEF,0x35001},{0xFEF0,0x35021},{0xFEF1,0x35041},{0xFEF2,0x35061},{0xFEF3,0x35081},{0xFEF4,0x350A1},
+    {0xFEF5,0x350C3},{0xFEF6,0x35123},{0xFEF7,0x35183},{0xFEF8,0x351E3},{0xFEF9,0x35243},{0xFEFA,0x352A3},
+    {0xFEFB,0x35302},{0xFEFC,0x35342},{0xFF01,0x35381},{0xFF02,0x353A1},{0xFF03,0x353C1},{0xFF04,0x353E1},
+    {0xFF05,0x35401},{0xFF06,0x35421},{0xFF07,0x35441},{0xFF08,0x35461},{0xFF09,0x35481},{0xFF0A,0x354A1},
+    {0xFF0B,0x354C1},{0xFF0C,0x354E1},{0xFF0D,0x35501},{0xFF0E,0x35521},{0xFF0F,0x35541},{0xFF10,0x35561},
+    {0xFF11,0x35581},{0xFF12,0x355A1},{0xFF13,0x355C1},{0xFF14,0x355E1},{0xFF15,0x35601},{0xFF16,0x35621},
+    {0xFF17,0x35641},{0xFF18,0x35661},{0xFF19,0x35681},{0xFF1A,0x356A1},{0xFF1B,0x356C1},{0xFF1C,0x356E1},
+    {0xFF1D,0x35701},{0xFF1E,0x35721},{0xFF1F,0x35741},{0xFF20,0x35761},{0xFF21,0x35781},{0xFF22,0x357A1},
+    {0xFF23,0x357C1},{0xFF24,0x357E1},{0xFF25,0x35801},{0xFF26,0x35821},{0xFF27,0x35841},{0xFF28,0x35861},
+    {0xFF29,0x35881},{0xFF2A,0x358A1},{0xFF2B,0x358C1},{0xFF2C,0x358E1},{0xFF2D,0x35901},{0xFF2E,0x35921},
+    {0xFF2F,0x35941},{0xFF30,0x35961},{0xFF31,0x35981},{0xFF32,0x359A1},{0xFF33,0x359C1},{0xFF34,0x359E1},
+    {0xFF35,0x35A01},{0xFF36,0x35A21},{0xFF37,0x35A41},{0xFF38,0x35A61},{0xFF39,0x35A81},{0xFF3A,0x35AA1},
+    {0xFF3B,0x35AC1},{0xFF3C,0x35AE1},{0xFF3D,0x35B01},{0xFF3E,0x35B21},{0xFF3F,0x35B41},{0xFF40,0x35B61},
+    {0xFF41,0x35B81},{0xFF42,0x35BA1},{0xFF43,0x35BC1},{0xFF44,0x35BE1},{0xFF45,0x35C01},{0xFF46,0x35C21},
+    {0xFF47,0x35C41},{0xFF48,0x35C61},{0xFF49,0x35C81},{0xFF4A,0x35CA1},{0xFF4B,0x35CC1},{0xFF4C,0x35CE1},
+    {0xFF4D,0x35D01},{0xFF4E,0x35D21},{0xFF4F,0x35D41},{0xFF50,0x35D61},{0xFF51,0x35D81},{0xFF52,0x35DA1},
+    {0xFF53,0x35DC1},{0xFF54,0x35DE1},{0xFF55,0x35E01},{0xFF56,0x35E21},{0xFF57,0x35E41},{0xFF58,0x35E61},
+    {0xFF59,0x35E81},{0xFF5A,0x35EA1},{0xFF5B,0x35EC1},{0xFF5C,0x35EE1},{0xFF5D,0x35F01},{0xFF5E,0x35F21},
+    {0xFF5F,0x35F41},{0xFF60,0x35F61},{0xFF61,0x35F81},{0xFF62,0x35FA1},{0xFF63,0x35FC1},{0xFF64,0x35FE1},
+    {0xFF65,0x36001},{0xFF66,0x36021},{0xFF67,0x36041},{0xFF68,0x36061},{0xFF69,0x36081},{0xFF6A,0x360A1},
+    {0xFF6B,0x360C1},{0xFF6C,0x360E1},{0xFF6D,0x36101},{0xFF6E,0x36121},{0xFF6F,0x36141},{0xFF70,0x36161},
+    {0xFF71,0x36181},{0xFF72,0x361A1},{0xFF73,0x361C1},{0xFF74,0x361E1},{0xFF75,0x36201},{0xFF76,0x36221},
+    {0xFF77,0x36241},{0xFF78,0x36261},{0xFF79,0x36281},{0xFF7A,0x362A1},{0xFF7B,0x362C1},{0xFF7C,0x362E1},
+    {0xFF7D,0x36301},{0xFF7E,0x36321},{0xFF7F,0x36341},{0xFF80,0x36361},{0xFF81,0x36381},{0xFF82,0x363A1},
+    {0xFF83,0x363C1},{0xFF84,0x363E1},{0xFF85,0x36401},{0xFF86,0x36421},{0xFF87,0x36441},{0xFF88,0x36461},
+    {0xFF89,0x36481},{0xFF8A,0x364A1},{0xFF8B,0x364C1},{0xFF8C,0x364E1},{0xFF8D,0x36501},{0xFF8E,0x36521},
+    {0xFF8F,0x36541},{0xFF90,0x36561},{0xFF91,0x36581},{0xFF92,0x365A1},{0xFF93,0x365C1},{0xFF94,0x365E1},
+    {0xFF95,0x36601},{0xFF96,0x36621},{0xFF97,0x36641},{0xFF98,0x36661},{0xFF99,0x36681},{0xFF9A,0x366A1},
+    {0xFF9B,0x366C1},{0xFF9C,0x366E1},{0xFF9D,0x36701},{0xFF9E,0x36721},{0xFF9F,0x36741},{0xFFA0,0x36761},
+    {0xFFA1,0x36781},{0xFFA2,0x367A1},{0xFFA3,0x367C1},{0xFFA4,0x367E1},{0xFFA5,0x36801},{0xFFA6,0x36821},
+    {0xFFA7,0x36841},{0xFFA8,0x36861},{0xFFA9,0x36881},{0xFFAA,0x368A1},{0xFFAB,0x368C1},{0xFFAC,0x368E1},
+    {0xFFAD,0x36901},{0xFFAE,0x36921},{0xFFAF,0x36941},{0xFFB0,0x36961},{0xFFB1,0x36981},{0xFFB2,0x369A1},
+    {0xFFB3,0x369C1},{0xFFB4,0x369E1},{0xFFB5,0x36A01},{0xFFB6,0x36A21},{0xFFB7,0x36A41},{0xFFB8,0x36A61},
+    {0xFFB9,0x36A81},{0xFFBA,0x36AA1},{0xFFBB,0x36AC1},{0xFFBC,0x36AE1},{0xFFBD,0x36B01},{0xFFBE,0x36B21},
+    {0xFFC2,0x36B41},{0xFFC3,0x36B61},{0xFFC4,0x36B81},{0xFFC5,0x36BA1},{0xFFC6,0x36BC1},{0xFFC7,0x36BE1},
+    {0xFFCA,0x36C01},{0xFFCB,0x36C21},{0xFFCC,0x36C41},{0xFFCD,0x36C61},{0xFFCE,0x36C81},{0xFFCF,0x36CA1},
+    {0xFFD2,0x36CC1},{0xFFD3,0x36CE1},{0xFFD4,0x36D01},{0xFFD5,0x36D21},{0xFFD6,0x36D41},{0xFFD7,0x36D61},
+    {0xFFDA,0x36D81},{0xFFDB,0x36DA1},{0xFFDC,0x36DC1},{0xFFE0,0x36DE1},{0xFFE1,0x36E01},{0xFFE2,0x36E21},
+    {0xFFE3,0x36E42},{0xFFE4,0x36E81},{0xFFE5,0x36EA1},{0xFFE6,0x36EC1},{0xFFE8,0x36EE1},{0xFFE9,0x36F01},
+    {0xFFEA,0x36F21},{0xFFEB,0x36F41},{0xFFEC,0x36F61},{0xFFED,0x36F81},{0xFFEE,0x36FA1},{0x10781,0x36FC1},
+    {0x10782,0x36FE1},{0x10783,0x37001},{0x10784,0x37021},{0x10785,0x37041},{0x10787,0x37061},{0x10788,0x37081},
+    {0x10789,0x370A1},{0x1078A,0x370C1},{0x1078B,0x370E1},{0x1078C,0x37101},{0x1078D,0x37121},{0x1078E,0x37141},
+    {0x1078F,0x37161},{0x10790,0x37181},{0x10791,0x371A1},{0x10792,0x371C1},{0x10793,0x371E1},{0x10794,0x37201},
+    {0x10795,0x37221},{0x10796,0x37241},{0x10797,0x37261},{0x10798,0x37281},{0x10799,0x372A1},{0x1079A,0x372C1},
+    {0x1079B,0x372E1},{0x1079C,0x37301},{0x1079D,0x37321},{0x1079E,0x37341},{0x1079F,0x37361},{0x107A0,0x37381},
+    {0x107A1,0x373A1},{0x107A2,0x373C1},{0x107A3,0x373E1},{0x107A4,0x37401},{0x107A5,0x37421},{0x107A6,0x37441},
+    {0x107A7,0x37461},{0x107A8,0x37481},{0x107A9,0x374A1},{0x107AA,0x374C1},{0x107AB,0x374E1},{0x107AC,0x37501},
+    {0x107AD,0x37521},{0x107AE,0x37541},{0x107AF,0x37561},{0x107B0,0x37581},{0x107B2,0x375A1},{0x107B3,0x375C1},
+    {0x107B4,0x375E1},{0x107B5,0x37601},{0x107B6,0x37621},{0x107B7,0x37641},{0x107B8,0x37661},{0x107B9,0x37681},
+    {0x107BA,0x376A1},{0x1D400,0x37E61},{0x1D401,0x37E81},{0x1D402,0x37EA1},{0x1D403,0x37EC1},{0x1D404,0x37EE1},
+    {0x1D405,0x37F01},{0x1D406,0x37F21},{0x1D407,0x37F41},{0x1D408,0x37F61},{0x1D409,0x37F81},{0x1D40A,0x37FA1},
+    {0x1D40B,0x37FC1},{0x1D40C,0x37FE1},{0x1D40D,0x38001},{0x1D40E,0x38021},{0x1D40F,0x38041},{0x1D410,0x38061},
+    {0x1D411,0x38081},{0x1D412,0x380A1},{0x1D413,0x380C1},{0x1D414,0x380E1},{0x1D415,0x38101},{0x1D416,0x38121},
+    {0x1D417,0x38141},{0x1D418,0x38161},{0x1D419,0x38181},{0x1D41A,0x381A1},{0x1D41B,0x381C1},{0x1D41C,0x381E1},
+    {0x1D41D,0x38201},{0x1D41E,0x38221},{0x1D41F,0x38241},{0x1D420,0x38261},{0x1D421,0x38281},{0x1D422,0x382A1},
+    {0x1D423,0x382C1},{0x1D424,0x382E1},{0x1D425,0x38301},{0x1D426,0x38321},{0x1D427,0x38341},{0x1D428,0x38361},
+    {0x1D429,0x38381},{0x1D42A,0x383A1},{0x1D42B,0x383C1},{0x1D42C,0x383E1},{0x1D42D,0x38401},{0x1D42E,0x38421},
+    {0x1D42F,0x38441},{0x1D430,0x38461},{0x1D431,0x38481},{0x1D432,0x384A1},{0x1D433,0x384C1},{0x1D434,0x384E1},
+    {0x1D435,0x38501},{0x1D436,0x38521},{0x1D437,0x38541},{0x1D438,0x38561},{0x1D439,0x38581},{0x1D43A,0x385A1},
+    {0x1D43B,0x385C1},{0x1D43C,0x385E1},{0x1D43D,0x38601},{0x1D43E,0x38621},{0x1D43F,0x38641},{0x1D440,0x38661},
+    {0x1D441,0x38681},{0x1D442,0x386A1},{0x1D443,0x386C1},{0x1D444,0x386E1},{0x1D445,0x38701},{0x1D446,0x38721},
+    {0x1D447,0x38741},{0x1D448,0x38761},{0x1D449,0x38781},{0x1D44A,0x387A1},{0x1D44B,0x387C1},{0x1D44C,0x387E1},
+    {0x1D44D,0x38801},{0x1D44E,0x38821},{0x1D44F,0x38841},{0x1D450,0x38861},{0x1D451,0x38881},{0x1D452,0x388A1},
+    {0x1D453,0x388C1},{0x1D454,0x388E1},{0x1D456,0x38901},{0x1D457,0x38921},{0x1D458,0x38941},{0x1D459,0x38961},
+    {0x1D45A,0x38981},{0x1D45B,0x389A1},{0x1D45C,0x389C1},{0x1D45D,0x389E1},{0x1D45E,0x38A01},{0x1D45F,0x38A21},
+    {0x1D460,0x38A41},{0x1D461,0x38A61},{0x1D462,0x38A81},{0x1D463,0x38AA1},{0x1D464,0x38AC1},{0x1D465,0x38AE1},
+    {0x1D466,0x38B01},{0x1D467,0x38B21},{0x1D468,0x38B41},{0x1D469,0x38B61},{0x1D46A,0x38B81},{0x1D46B,0x38BA1},
+    {0x1D46C,0x38BC1},{0x1D46D,0x38BE1},{0x1D46E,0x38C01},{0x1D46F,0x38C21},{0x1D470,0x38C41},{0x1D471,0x38C61},
+    {0x1D472,0x38C81},{0x1D473,0x38CA1},{0x1D474,0x38CC1},{0x1D475,0x38CE1},{0x1D476,0x38D01},{0x1D477,0x38D21},
+    {0x1D478,0x38D41},{0x1D479,0x38D61},{0x1D47A,0x38D81},{0x1D47B,0x38DA1},{0x1D47C,0x38DC1},{0x1D47D,0x38DE1},
+    {0x1D47E,0x38E01},{0x1D47F,0x38E21},{0x1D480,0x38E41},{0x1D481,0x38E61},{0x1D482,0x38E81},{0x1D483,0x38EA1},
+    {0x1D484,0x38EC1},{0x1D485,0x38EE1},{0x1D486,0x38F01},{0x1D487,0x38F21},{0x1D488,0x38F41},{0x1D489,0x38F61},
+    {0x1D48A,0x38F81},{0x1D48B,0x38FA1},{0x1D48C,0x38FC1},{0x1D48D,0x38FE1},{0x1D48E,0x39001},{0x1D48F,0x39021},
+    {0x1D490,0x39041},{0x1D491,0x39061},{0x1D492,0x39081},{0x1D493,0x390A1},{0x1D494,0x390C1},{0x1D495,0x390E1},
+    {0x1D496,0x39101},{0x1D497,0x39121},{0x1D498,0x39141},{0x1D499,0x39161},{0x1D49A,0x39181},{0x1D49B,0x391A1},
+    {0x1D49C,0x391C1},{0x1D49E,0x391E1},{0x1D49F,0x39201},{0x1D4A2,0x39221},{0x1D4A5,0x39241},{0x1D4A6,0x39261},
+    {0x1D4A9,0x39281},{0x1D4AA,0x392A1},{0x1D4AB,0x392C1},{0x1D4AC,0x392E1},{0x1D4AE,0x39301},{0x1D4AF,0x39321},
+    {0x1D4B0,0x39341},{0x1D4B1,0x39361},{0x1D4B2,0x39381},{0x1D4B3,0x393A1},{0x1D4B4,0x393C1},{0x1D4B5,0x393E1},
+    {0x1D4B6,0x39401},{0x1D4B7,0x39421},{0x1D4B8,0x39441},{0x1D4B9,0x39461},{0x1D4BB,0x39481},{0x1D4BD,0x394A1},
+    {0x1D4BE,0x394C1},{0x1D4BF,0x394E1},{0x1D4C0,0x39501},{0x1D4C1,0x39521},{0x1D4C2,0x39541},{0x1D4C3,0x39561},
+    {0x1D4C5,0x39581},{0x1D4C6,0x395A1},{0x1D4C7,0x395C1},{0x1D4C8,0x395E1},{0x1D4C9,0x39601},{0x1D4CA,0x39621},
+    {0x1D4CB,0x39641},{0x1D4CC,0x39661},{0x1D4CD,0x39681},{0x1D4CE,0x396A1},{0x1D4CF,0x396C1},{0x1D4D0,0x396E1},
+    {0x1D4D1,0x39701},{0x1D4D2,0x39721},{0x1D4D3,0x39741},{0x1D4D4,0x39761},{0x1D4D5,0x39781},{0x1D4D6,0x397A1},
+    {0x1D4D7,0x397C1},{0x1D4D8,0x397E1},{0x1D4D9,0x39801},{0x1D4DA,0x39821},{0x1D4DB,0x39841},{0x1D4DC,0x39861},
+    {0x1D4DD,0x39881},{0x1D4DE,0x398A1},{0x1D4DF,0x398C1},{0x1D4E0,0x398E1},{0x1D4E1,0x39901},{0x1D4E2,0x39921},
+    {0x1D4E3,0x39941},{0x1D4E4,0x39961},{0x1D4E5,0x39981},{0x1D4E6,0x399A1},{0x1D4E7,0x399C1},{0x1D4E8,0x399E1},
+    {0x1D4E9,0x39A01},{0x1D4EA,0x39A21},{0x1D4EB,0x39A41},{0x1D4EC,0x39A61},{0x1D4ED,0x39A81},{0x1D4EE,0x39AA1},
+    {0x1D4EF,0x39AC1},{0x1D4F0,0x39AE1},{0x1D4F1,0x39B01},{0x1D4F2,0x39B21},{0x1D4F3,0x39B41},{0x1D4F4,0x39B61},
+    {0x1D4F5,0x39B81},{0x1D4F6,0x39BA1},{0x1D4F7,0x39BC1},{0x1D4F8,0x39BE1},{0x1D4F9,0x39C01},{0x1D4FA,0x39C21},
+    {0x1D4FB,0x39C41},{0x1D4FC,0x39C61},{0x1D4FD,0x39C81},{0x1D4FE,0x39CA1},{0x1D4FF,0x39CC1},{0x1D500,0x39CE1},
+    {0x1D501,0x39D01},{0x1D502,0x39D21},{0x1D503,0x39D41},{0x1D504,0x39D61},{0x1D505,0x39D81},{0x1D507,0x39DA1},
+    {0x1D508,0x39DC1},{0x1D509,0x39DE1},{0x1D50A,0x39E01},{0x1D50D,0x39E21},{0x1D50E,0x39E41},{0x1D50F,0x39E61},
+    {0x1D510,0x39E81},{0x1D511,0x39EA1},{0x1D512,0x39EC1},{0x1D513,0x39EE1},{0x1D514,0x39F01},{0x1D516,0x39F21},
+    {0x1D517,0x39F41},{0x1D518,0x39F61},{0x1D519,0x39F81},{0x1D51A,0x39FA1},{0x1D51B,0x39FC1},{0x1D51C,0x39FE1},
+    {0x1D51E,0x3A001},{0x1D51F,0x3A021},{0x1D520,0x3A041},{0x1D521,0x3A061},{0x1D522,0x3A081},{0x1D523,0x3A0A1},
+    {0x1D524,0x3A0C1},{0x1D525,0x3A0E1},{0x1D526,0x3A101},{0x1D527,0x3A121},{0x1D528,0x3A141},{0x1D529,0x3A161},
+    {0x1D52A,0x3A181},{0x1D52B,0x3A1A1},{0x1D52C,0x3A1C1},{0x1D52D,0x3A1E1},{0x1D52E,0x3A201},{0x1D52F,0x3A221},
+    {0x1D530,0x3A241},{0x1D531,0x3A261},{0x1D532,0x3A281},{0x1D533,0x3A2A1},{0x1D534,0x3A2C1},{0x1D535,0x3A2E1},
+    {0x1D536,0x3A301},{0x1D537,0x3A321},{0x1D538,0x3A341},{0x1D539,0x3A361},{0x1D53B,0x3A381},{0x1D53C,0x3A3A1},
+    {0x1D53D,0x3A3C1},{0x1D53E,0x3A3E1},{0x1D540,0x3A401},{0x1D541,0x3A421},{0x1D542,0x3A441},{0x1D543,0x3A461},
+    {0x1D544,0x3A481},{0x1D546,0x3A4A1},{0x1D54A,0x3A4C1},{0x1D54B,0x3A4E1},{0x1D54C,0x3A501},{0x1D54D,0x3A521},
+    {0x1D54E,0x3A541},{0x1D54F,0x3A561},{0x1D550,0x3A581},{0x1D552,0x3A5A1},{0x1D553,0x3A5C1},{0x1D554,0x3A5E1},
+    {0x1D555,0x3A601},{0x1D556,0x3A621},{0x1D557,0x3A641},{0x1D558,0x3A661},{0x1D559,0x3A681},{0x1D55A,0x3A6A1},
+    {0x1D55B,0x3A6C1},{0x1D55C,0x3A6E1},{0x1D55D,0x3A701},{0x1D55E,0x3A721},{0x1D55F,0x3A741},{0x1D560,0x3A761},
+    {0x1D561,0x3A781},{0x1D562,0x3A7A1},{0x1D563,0x3A7C1},{0x1D564,0x3A7E1},{0x1D565,0x3A801},{0x1D566,0x3A821},
+    {0x1D567,0x3A841},{0x1D568,0x3A861},{0x1D569,0x3A881},{0x1D56A,0x3A8A1},{0x1D56B,0x3A8C1},{0x1D56C,0x3A8E1},
+    {0x1D56D,0x3A901},{0x1D56E,0x3A921},{0x1D56F,0x3A941},{0x1D570,0x3A961},{0x1D571,0x3A981},{0x1D572,0x3A9A1},
+    {0x1D573,0x3A9C1},{0x1D574,0x3A9E1},{0x1D575,0x3AA01},{0x1D576,0x3AA21},{0x1D577,0x3AA41},{0x1D578,0x3AA61},
+    {0x1D579,0x3AA81},{0x1D57A,0x3AAA1},{0x1D57B,0x3AAC1},{0x1D57C,0x3AAE1},{0x1D57D,0x3AB01},{0x1D57E,0x3AB21},
+    {0x1D57F,0x3AB41},{0x1D580,0x3AB61},{0x1D581,0x3AB81},{0x1D582,0x3ABA1},{0x1D583,0x3ABC1},{0x1D584,0x3ABE1},
+    {0x1D585,0x3AC01},{0x1D586,0x3AC21},{0x1D587,0x3AC41},{0x1D588,0x3AC61},{0x1D589,0x3AC81},{0x1D58A,0x3ACA1},
+    {0x1D58B,0x3ACC1},{0x1D58C,0x3ACE1},{0x1D58D,0x3AD01},{0x1D58E,0x3AD21},{0x1D58F,0x3AD41},{0x1D590,0x3AD61},
+    {0x1D591,0x3AD81},{0x1D592,0x3ADA1},{0x1D593,0x3ADC1},{0x1D594,0x3ADE1},{0x1D595,0x3AE01},{0x1D596,0x3AE21},
+    {0x1D597,0x3AE41},{0x1D598,0x3AE61},{0x1D599,0x3AE81},{0x1D59A,0x3AEA1},{0x1D59B,0x3AEC1},{0x1D59C,0x3AEE1},
+    {0x1D59D,0x3AF01},{0x1D59E,0x3AF21},{0x1D59F,0x3AF41},{0x1D5A0,0x3AF61},{0x1D5A1,0x3AF81},{0x1D5A2,0x3AFA1},
+    {0x1D5A3,0x3AFC1},{0x1D5A4,0x3AFE1},{0x1D5A5,0x3B001},{0x1D5A6,0x3B021},{0x1D5A7,0x3B041},{0x1D5A8,0x3B061},
+    {0x1D5A9,0x3B081},{0x1D5AA,0x3B0A1},{0x1D5AB,0x3B0C1},{0x1D5AC,0x3B0E1},{0x1D5AD,0x3B101},{0x1D5AE,0x3B121},
+    {0x1D5AF,0x3B141},{0x1D5B0,0x3B161},{0x1D5B1,0x3B181},{0x1D5B2,0x3B1A1},{0x1D5B3,0x3B1C1},{0x1D5B4,0x3B1E1},
+    {0x1D5B5,0x3B201},{0x1D5B6,0x3B221},{0x1D5B7,0x3B241},{0x1D5B8,0x3B261},{0x1D5B9,0x3B281},{0x1D5BA,0x3B2A1},
+    {0x1D5BB,0x3B2C1},{0x1D5BC,0x3B2E1},{0x1D5BD,0x3B301},{0x1D5BE,0x3B321},{0x1D5BF,0x3B341},{0x1D5C0,0x3B361},
+    {0x1D5C1,0x3B381},{0x1D5C2,0x3B3A1},{0x1D5C3,0x3B3C1},{0x1D5C4,0x3B3E1},{0x1D5C5,0x3B401},{0x1D5C6,0x3B421},
+    {0x1D5C7,0x3B441},{0x1D5C8,0x3B461},{0x1D5C9,0x3B481},{0x1D5CA,0x3B4A1},{0x1D5CB,0x3B4C1},{0x1D5CC,0x3B4E1},
+    {0x1D5CD,0x3B501},{0x1D5CE,0x3B521},{0x1D5CF,0x3B541},{0x1D5D0,0x3B561},{0x1D5D1,0x3B581},{0x1D5D2,0x3B5A1},
+    {0x1D5D3,0x3B5C1},{0x1D5D4,0x3B5E1},{0x1D5D5,0x3B601},{0x1D5D6,0x3B621},{0x1D5D7,0x3B641},{0x1D5D8,0x3B661},
+    {0x1D5D9,0x3B681},{0x1D5DA,0x3B6A1},{0x1D5DB,0x3B6C1},{0x1D5DC,0x3B6E1},{0x1D5DD,0x3B701},{0x1D5DE,0x3B721},
+    {0x1D5DF,0x3B741},{0x1D5E0,0x3B761},{0x1D5E1,0x3B781},{0x1D5E2,0x3B7A1},{0x1D5E3,0x3B7C1},{0x1D5E4,0x3B7E1},
+    {0x1D5E5,0x3B801},{0x1D5E6,0x3B821},{0x1D5E7,0x3B841},{0x1D5E8,0x3B861},{0x1D5E9,0x3B881},{0x1D5EA,0x3B8A1},
+    {0x1D5EB,0x3B8C1},{0x1D5EC,0x3B8E1},{0x1D5ED,0x3B901},{0x1D5EE,0x3B921},{0x1D5EF,0x3B941},{0x1D5F0,0x3B961},
+    {0x1D5F1,0x3B981},{0x1D5F2,0x3B9A1},{0x1D5F3,0x3B9C1},{0x1D5F4,0x3B9E1},{0x1D5F5,0x3BA01},{0x1D5F6,0x3BA21},
+    {0x1D5F7,0x3BA41},{0x1D5F8,0x3BA61},{0x1D5F9,0x3BA81},{0x1D5FA,0x3BAA1},{0x1D5FB,0x3BAC1},{0x1D5FC,0x3BAE1},
+    {0x1D5FD,0x3BB01},{0x1D5FE,0x3BB21},{0x1D5FF,0x3BB41},{0x1D600,0x3BB61},{0x1D601,0x3BB81},{0x1D602,0x3BBA1},
+    {0x1D603,0x3BBC1},{0x1D604,0x3BBE1},{0x1D605,0x3BC01},{0x1D606,0x3BC21},{0x1D607,0x3BC41},{0x1D608,0x3BC61},
+    {0x1D609,0x3BC81},{0x1D60A,0x3BCA1},{0x1D60B,0x3BCC1},{0x1D60C,0x3BCE1},{0x1D60D,0x3BD01},{0x1D60E,0x3BD21},
+    {0x1D60F,0x3BD41},{0x1D610,0x3BD61},{0x1D611,0x3BD81},{0x1D612,0x3BDA1},{0x1D613,0x3BDC1},{0x1D614,0x3BDE1},
+    {0x1D615,0x3BE01},{0x1D616,0x3BE21},{0x1D617,0x3BE41},{0x1D618,0x3BE61},{0x1D619,0x3BE81},{0x1D61A,0x3BEA1},
+    {0x1D61B,0x3BEC1},{0x1D61C,0x3BEE1},{0x1D61D,0x3BF01},{0x1D61E,0x3BF21},{0x1D61F,0x3BF41},{0x1D620,0x3BF61},
+    {0x1D621,0x3BF81},{0x1D622,0x3BFA1},{0x1D623,0x3BFC1},{0x1D624,0x3BFE1},{0x1D625,0x3C001},{0x1D626,0x3C021},
+    {0x1D627,0x3C041},{0x1D628,0x3C061},{0x1D629,0x3C081},{0x1D62A,0x3C0A1},{0x1D62B,0x3C0C1},{0x1D62C,0x3C0E1},
+    {0x1D62D,0x3C101},{0x1D62E,0x3C121},{0x1D62F,0x3C141},{0x1D630,0x3C161},{0x1D631,0x3C181},{0x1D632,0x3C1A1},
+    {0x1D633,0x3C1C1},{0x1D634,0x3C1E1},{0x1D635,0x3C201},{0x1D636,0x3C221},{0x1D637,0x3C241},{0x1D638,0x3C261},
+    {0x1D639,0x3C281},{0x1D63A,0x3C2A1},{0x1D63B,0x3C2C1},{0x1D63C,0x3C2E1},{0x1D63D,0x3C301},{0x1D63E,0x3C321},
+    {0x1D63F,0x3C341},{0x1D640,0x3C361},{0x1D641,0x3C381},{0x1D642,0x3C3A1},{0x1D643,0x3C3C1},{0x1D644,0x3C3E1},
+    {0x1D645,0x3C401},{0x1D646,0x3C421},{0x1D647,0x3C441},{0x1D648,0x3C461},{0x1D649,0x3C481},{0x1D64A,0x3C4A1},
+    {0x1D64B,0x3C4C1},{0x1D64C,0x3C4E1},{0x1D64D,0x3C501},{0x1D64E,0x3C521},{0x1D64F,0x3C541},{0x1D650,0x3C561},
+    {0x1D651,0x3C581},{0x1D652,0x3C5A1},{0x1D653,0x3C5C1},{0x1D654,0x3C5E1},{0x1D655,0x3C601},{0x1D656,0x3C621},
+    {0x1D657,0x3C641},{0x1D658,0x3C661},{0x1D659,0x3C681},{0x1D65A,0x3C6A1},{0x1D65B,0x3C6C1},{0x1D65C,0x3C6E1},
+    {0x1D65D,0x3C701},{0x1D65E,0x3C721},{0x1D65F,0x3C741},{0x1D660,0x3C761},{0x1D661,0x3C781},{0x1D662,0x3C7A1},
+    {0x1D663,0x3C7C1},{0x1D664,0x3C7E1},{0x1D665,0x3C801},{0x1D666,0x3C821},{0x1D667,0x3C841},{0x1D668,0x3C861},
+    {0x1D669,0x3C881},{0x1D66A,0x3C8A1},{0x1D66B,0x3C8C1},{0x1D66C,0x3C8E1},{0x1D66D,0x3C901},{0x1D66E,0x3C921},
+    {0x1D66F,0x3C941},{0x1D670,0x3C961},{0x1D671,0x3C981},{0x1D672,0x3C9A1},{0x1D673,0x3C9C1},{0x1D674,0x3C9E1},
+    {0x1D675,0x3CA01},{0x1D676,0x3CA21},{0x1D677,0x3CA41},{0x1D678,0x3CA61},{0x1D679,0x3CA81},{0x1D67A,0x3CAA1},
+    {0x1D67B,0x3CAC1},{0x1D67C,0x3CAE1},{0x1D67D,0x3CB01},{0x1D67E,0x3CB21},{0x1D67F,0x3CB41},{0x1D680,0x3CB61},
+    {0x1D681,0x3CB81},{0x1D682,0x3CBA1},{0x1D683,0x3CBC1},{0x1D684,0x3CBE1},{0x1D685,0x3CC01},{0x1D686,0x3CC21},
+    {0x1D687,0x3CC41},{0x1D688,0x3CC61},{0x1D689,0x3CC81},{0x1D68A,0x3CCA1},{0x1D68B,0x3CCC1},{0x1D68C,0x3CCE1},
+    {0x1D68D,0x3CD01},{0x1D68E,0x3CD21},{0x1D68F,0x3CD41},{0x1D690,0x3CD61},{0x1D691,0x3CD81},{0x1D692,0x3CDA1},
+    {0x1D693,0x3CDC1},{0x1D694,0x3CDE1},{0x1D695,0x3CE01},{0x1D696,0x3CE21},{0x1D697,0x3CE41},{0x1D698,0x3CE61},
+    {0x1D699,0x3CE81},{0x1D69A,0x3CEA1},{0x1D69B,0x3CEC1},{0x1D69C,0x3CEE1},{0x1D69D,0x3CF01},{0x1D69E,0x3CF21},
+    {0x1D69F,0x3CF41},{0x1D6A0,0x3CF61},{0x1D6A1,0x3CF81},{0x1D6A2,0x3CFA1},{0x1D6A3,0x3CFC1},{0x1D6A4,0x3CFE1},
+    {0x1D6A5,0x3D001},{0x1D6A8,0x3D021},{0x1D6A9,0x3D041},{0x1D6AA,0x3D061},{0x1D6AB,0x3D081},{0x1D6AC,0x3D0A1},
+    {0x1D6AD,0x3D0C1},{0x1D6AE,0x3D0E1},{0x1D6AF,0x3D101},{0x1D6B0,0x3D121},{0x1D6B1,0x3D141},{0x1D6B2,0x3D161},
+    {0x1D6B3,0x3D181},{0x1D6B4,0x3D1A1},{0x1D6B5,0x3D1C1},{0x1D6B6,0x3D1E1},{0x1D6B7,0x3D201},{0x1D6B8,0x3D221},
+    {0x1D6B9,0x3D241},{0x1D6BA,0x3D261},{0x1D6BB,0x3D281},{0x1D6BC,0x3D2A1},{0x1D6BD,0x3D2C1},{0x1D6BE,0x3D2E1},
+    {0x1D6BF,0x3D301},{0x1D6C0,0x3D321},{0x1D6C1,0x3D341},{0x1D6C2,0x3D361},{0x1D6C3,0x3D381},{0x1D6C4,0x3D3A1},
+    {0x1D6C5,0x3D3C1},{0x1D6C6,0x3D3E1},{0x1D6C7,0x3D401},{0x1D6C8,0x3D421},{0x1D6C9,0x3D441},{0x1D6CA,0x3D461},
+    {0x1D6CB,0x3D481},{0x1D6CC,0x3D4A1},{0x1D6CD,0x3D4C1},{0x1D6CE,0x3D4E1},{0x1D6CF,0x3D501},{0x1D6D0,0x3D521},
+    {0x1D6D1,0x3D541},{0x1D6D2,0x3D561},{0x1D6D3,0x3D581},{0x1D6D4,0x3D5A1},{0x1D6D5,0x3D5C1},{0x1D6D6,0x3D5E1},
+    {0x1D6D7,0x3D601},{0x1D6D8,0x3D621},{0x1D6D9,0x3D641},{0x1D6DA,0x3D661},{0x1D6DB,0x3D681},{0x1D6DC,0x3D6A1},
+    {0x1D6DD,0x3D6C1},{0x1D6DE,0x3D6E1},{0x1D6DF,0x3D701},{0x1D6E0,0x3D721},{0x1D6E1,0x3D741},{0x1D6E2,0x3D761},
+    {0x1D6E3,0x3D781},{0x1D6E4,0x3D7A1},{0x1D6E5,0x3D7C1},{0x1D6E6,0x3D7E1},{0x1D6E7,0x3D801},{0x1D6E8,0x3D821},
+    {0x1D6E9,0x3D841},{0x1D6EA,0x3D861},{0x1D6EB,0x3D881},{0x1D6EC,0x3D8A1},{0x1D6ED,0x3D8C1},{0x1D6EE,0x3D8E1},
+    {0x1D6EF,0x3D901},{0x1D6F0,0x3D921},{0x1D6F1,0x3D941},{0x1D6F2,0x3D961},{0x1D6F3,0x3D981},{0x1D6F4,0x3D9A1},
+    {0x1D6F5,0x3D9C1},{0x1D6F6,0x3D9E1},{0x1D6F7,0x3DA01},{0x1D6F8,0x3DA21},{0x1D6F9,0x3DA41},{0x1D6FA,0x3DA61},
+    {0x1D6FB,0x3DA81},{0x1D6FC,0x3DAA1},{0x1D6FD,0x3DAC1},{0x1D6FE,0x3DAE1},{0x1D6FF,0x3DB01},{0x1D700,0x3DB21},
+    {0x1D701,0x3DB41},{0x1D702,0x3DB61},{0x1D703,0x3DB81},{0x1D704,0x3DBA1},{0x1D705,0x3DBC1},{0x1D706,0x3DBE1},
+    {0x1D707,0x3DC01},{0x1D708,0x3DC21},{0x1D709,0x3DC41},{0x1D70A,0x3DC61},{0x1D70B,0x3DC81},{0x1D70C,0x3DCA1},
+    {0x1D70D,0x3DCC1},{0x1D70E,0x3DCE1},{0x1D70F,0x3DD01},{0x1D710,0x3DD21},{0x1D711,0x3DD41},{0x1D712,0x3DD61},
+    {0x1D713,0x3DD81},{0x1D714,0x3DDA1},{0x1D715,0x3DDC1},{0x1D716,0x3DDE1},{0x1D717,0x3DE01},{0x1D718,0x3DE21},
+    {0x1D719,0x3DE41},{0x1D71A,0x3DE61},{0x1D71B,0x3DE81},{0x1D71C,0x3DEA1},{0x1D71D,0x3DEC1},{0x1D71E,0x3DEE1},
+    {0x1D71F,0x3DF01},{0x1D720,0x3DF21},{0x1D721,0x3DF41},{0x1D722,0x3DF61},{0x1D723,0x3DF81},{0x1D724,0x3DFA1},
+    {0x1D725,0x3DFC1},{0x1D726,0x3DFE1},{0x1D727,0x3E001},{0x1D728,0x3E021},{0x1D729,0x3E041},{0x1D72A,0x3E061},
+    {0x1D72B,0x3E081},{0x1D72C,0x3E0A1},{0x1D72D,0x3E0C1},{0x1D72E,0x3E0E1},{0x1D72F,0x3E101},{0x1D730,0x3E121},
+    {0x1D731,0x3E141},{0x1D732,0x3E161},{0x1D733,0x3E181},{0x1D734,0x3E1A1},{0x1D735,0x3E1C1},{0x1D736,0x3E1E1},
+    {0x1D737,0x3E201},{0x1D738,0x3E221},{0x1D739,0x3E241},{0x1D73A,0x3E261},{0x1D73B,0x3E281},{0x1D73C,0x3E2A1},
+    {0x1D73D,0x3E2C1},{0x1D73E,0x3E2E1},{0x1D73F,0x3E301},{0x1D740,0x3E321},{0x1D741,0x3E341},{0x1D742,0x3E361},
+    {0x1D743,0x3E381},{0x1D744,0x3E3A1},{0x1D745,0x3E3C1},{0x1D746,0x3E3E1},{0x1D747,0x3E401},{0x1D748,0x3E421},
+    {0x1D749,0x3E441},{0x1D74A,0x3E461},{0x1D74B,0x3E481},{0x1D74C,0x3E4A1},{0x1D74D,0x3E4C1},{0x1D74E,0x3E4E1},
+    {0x1D74F,0x3E501},{0x1D750,0x3E521},{0x1D751,0x3E541},{0x1D752,0x3E561},{0x1D753,0x3E581},{0x1D754,0x3E5A1},
+    {0x1D755,0x3E5C1},{0x1D756,0x3E5E1},{0x1D757,0x3E601},{0x1D758,0x3E621},{0x1D759,0x3E641},{0x1D75A,0x3E661},
+    {0x1D75B,0x3E681},{0x1D75C,0x3E6A1},{0x1D75D,0x3E6C1},{0x1D75E,0x3E6E1},{0x1D75F,0x3E701},{0x1D760,0x3E721},
+    {0x1D761,0x3E741},{0x1D762,0x3E761},{0x1D763,0x3E781},{0x1D764,0x3E7A1},{0x1D765,0x3E7C1},{0x1D766,0x3E7E1},
+    {0x1D767,0x3E801},{0x1D768,0x3E821},{0x1D769,0x3E841},{0x1D76A,0x3E861},{0x1D76B,0x3E881},{0x1D76C,0x3E8A1},
+    {0x1D76D,0x3E8C1},{0x1D76E,0x3E8E1},{0x1D76F,0x3E901},{0x1D770,0x3E921},{0x1D771,0x3E941},{0x1D772,0x3E961},
+    {0x1D773,0x3E981},{0x1D774,0x3E9A1},{0x1D775,0x3E9C1},{0x1D776,0x3E9E1},{0x1D777,0x3EA01},{0x1D778,0x3EA21},
+    {0x1D779,0x3EA41},{0x1D77A,0x3EA61},{0x1D77B,0x3EA81},{0x1D77C,0x3EAA1},{0x1D77D,0x3EAC1},{0x1D77E,0x3EAE1},
+    {0x1D77F,0x3EB01},{0x1D780,0x3EB21},{0x1D781,0x3EB41},{0x1D782,0x3EB61},{0x1D783,0x3EB81},{0x1D784,0x3EBA1},
+    {0x1D785,0x3EBC1},{0x1D786,0x3EBE1},{0x1D787,0x3EC01},{0x1D788,0x3EC21},{0x1D789,0x3EC41},{0x1D78A,0x3EC61},
+    {0x1D78B,0x3EC81},{0x1D78C,0x3ECA1},{0x1D78D,0x3ECC1},{0x1D78E,0x3ECE1},{0x1D78F,0x3ED01},{0x1D790,0x3ED21},
+    {0x1D791,0x3ED41},{0x1D792,0x3ED61},{0x1D793,0x3ED81},{0x1D794,0x3EDA1},{0x1D795,0x3EDC1},{0x1D796,0x3EDE1},
+    {0x1D797,0x3EE01},{0x1D798,0x3EE21},{0x1D799,0x3EE41},{0x1D79A,0x3EE61},{0x1D79B,0x3EE81},{0x1D79C,0x3EEA1},
+    {0x1D79D,0x3EEC1},{0x1D79E,0x3EEE1},{0x1D79F,0x3EF01},{0x1D7A0,0x3EF21},{0x1D7A1,0x3EF41},{0x1D7A2,0x3EF61},
+    {0x1D7A3,0x3EF81},{0x1D7A4,0x3EFA1},{0x1D7A5,0x3EFC1},{0x1D7A6,0x3EFE1},{0x1D7A7,0x3F001},{0x1D7A8,0x3F021},
+    {0x1D7A9,0x3F041},{0x1D7AA,0x3F061},{0x1D7AB,0x3F081},{0x1D7AC,0x3F0A1},{0x1D7AD,0x3F0C1},{0x1D7AE,0x3F0E1},
+    {0x1D7AF,0x3F101},{0x1D7B0,0x3F121},{0x1D7B1,0x3F141},{0x1D7B2,0x3F161},{0x1D7B3,0x3F181},{0x1D7B4,0x3F1A1},
+    {0x1D7B5,0x3F1C1},{0x1D7B6,0x3F1E1},{0x1D7B7,0x3F201},{0x1D7B8,0x3F221},{0x1D7B9,0x3F241},{0x1D7BA,0x3F261},
+    {0x1D7BB,0x3F281},{0x1D7BC,0x3F2A1},{0x1D7BD,0x3F2C1},{0x1D7BE,0x3F2E1},{0x1D7BF,0x3F301},{0x1D7C0,0x3F321},
+    {0x1D7C1,0x3F341},{0x1D7C2,0x3F361},{0x1D7C3,0x3F381},{0x1D7C4,0x3F3A1},{0x1D7C5,0x3F3C1},{0x1D7C6,0x3F3E1},
+    {0x1D7C7,0x3F401},{0x1D7C8,0x3F421},{0x1D7C9,0x3F441},{0x1D7CA,0x3F461},{0x1D7CB,0x3F481},{0x1D7CE,0x3F4A1},
+    {0x1D7CF,0x3F4C1},{0x1D7D0,0x3F4E1},{0x1D7D1,0x3F501},{0x1D7D2,0x3F521},{0x1D7D3,0x3F541},{0x1D7D4,0x3F561},
+    {0x1D7D5,0x3F581},{0x1D7D6,0x3F5A1},{0x1D7D7,0x3F5C1},{0x1D7D8,0x3F5E1},{0x1D7D9,0x3F601},{0x1D7DA,0x3F621},
+    {0x1D7DB,0x3F641},{0x1D7DC,0x3F661},{0x1D7DD,0x3F681},{0x1D7DE,0x3F6A1},{0x1D7DF,0x3F6C1},{0x1D7E0,0x3F6E1},
+    {0x1D7E1,0x3F701},{0x1D7E2,0x3F721},{0x1D7E3,0x3F741},{0x1D7E4,0x3F761},{0x1D7E5,0x3F781},{0x1D7E6,0x3F7A1},
+    {0x1D7E7,0x3F7C1},{0x1D7E8,0x3F7E1},{0x1D7E9,0x3F801},{0x1D7EA,0x3F821},{0x1D7EB,0x3F841},{0x1D7EC,0x3F861},
+    {0x1D7ED,0x3F881},{0x1D7EE,0x3F8A1},{0x1D7EF,0x3F8C1},{0x1D7F0,0x3F8E1},{0x1D7F1,0x3F901},{0x1D7F2,0x3F921},
+    {0x1D7F3,0x3F941},{0x1D7F4,0x3F961},{0x1D7F5,0x3F981},{0x1D7F6,0x3F9A1},{0x1D7F7,0x3F9C1},{0x1D7F8,0x3F9E1},
+    {0x1D7F9,0x3FA01},{0x1D7FA,0x3FA21},{0x1D7FB,0x3FA41},{0x1D7FC,0x3FA61},{0x1D7FD,0x3FA81},{0x1D7FE,0x3FAA1},
+    {0x1D7FF,0x3FAC1},{0x1E030,0x3FAE1},{0x1E031,0x3FB01},{0x1E032,0x3FB21},{0x1E033,0x3FB41},{0x1E034,0x3FB61},
+    {0x1E035,0x3FB81},{0x1E036,0x3FBA1},{0x1E037,0x3FBC1},{0x1E038,0x3FBE1},{0x1E039,0x3FC01},{0x1E03A,0x3FC21},
+    {0x1E03B,0x3FC41},{0x1E03C,0x3FC61},{0x1E03D,0x3FC81},{0x1E03E,0x3FCA1},{0x1E03F,0x3FCC1},{0x1E040,0x3FCE1},
+    {0x1E041,0x3FD01},{0x1E042,0x3FD21},{0x1E043,0x3FD41},{0x1E044,0x3FD61},{0x1E045,0x3FD81},{0x1E046,0x3FDA1},
+    {0x1E047,0x3FDC1},{0x1E048,0x3FDE1},{0x1E049,0x3FE01},{0x1E04A,0x3FE21},{0x1E04B,0x3FE41},{0x1E04C,0x3FE61},
+    {0x1E04D,0x3FE81},{0x1E04E,0x3FEA1},{0x1E04F,0x3FEC1},{0x1E050,0x3FEE1},{0x1E051,0x3FF01},{0x1E052,0x3FF21},
+    {0x1E053,0x3FF41},{0x1E054,0x3FF61},{0x1E055,0x3FF81},{0x1E056,0x3FFA1},{0x1E057,0x3FFC1},{0x1E058,0x3FFE1},
+    {0x1E059,0x40001},{0x1E05A,0x40021},{0x1E05B,0x40041},{0x1E05C,0x40061},{0x1E05D,0x40081},{0x1E05E,0x400A1},
+    {0x1E05F,0x400C1},{0x1E060,0x400E1},{0x1E061,0x40101},{0x1E062,0x40121},{0x1E063,0x40141},{0x1E064,0x40161},
+    {0x1E065,0x40181},{0x1E066,0x401A1},{0x1E067,0x401C1},{0x1E068,0x401E1},{0x1E069,0x40201},{0x1E06A,0x40221},
+    {0x1E06B,0x40241},{0x1E06C,0x40261},{0x1E06D,0x40281},{0x1EE00,0x402A1},{0x1EE01,0x402C1},{0x1EE02,0x402E1},
+    {0x1EE03,0x40301},{0x1EE05,0x40321},{0x1EE06,0x40341},{0x1EE07,0x40361},{0x1EE08,0x40381},{0x1EE09,0x403A1},
+    {0x1EE0A,0x403C1},{0x1EE0B,0x403E1},{0x1EE0C,0x40401},{0x1EE0D,0x40421},{0x1EE0E,0x40441},{0x1EE0F,0x40461},
+    {0x1EE10,0x40481},{0x1EE11,0x404A1},{0x1EE12,0x404C1},{0x1EE13,0x404E1},{0x1EE14,0x40501},{0x1EE15,0x40521},
+    {0x1EE16,0x40541},{0x1EE17,0x40561},{0x1EE18,0x40581},{0x1EE19,0x405A1},{0x1EE1A,0x405C1},{0x1EE1B,0x405E1},
+    {0x1EE1C,0x40601},{0x1EE1D,0x40621},{0x1EE1E,0x40641},{0x1EE1F,0x40661},{0x1EE21,0x40681},{0x1EE22,0x406A1},
+    {0x1EE24,0x406C1},{0x1EE27,0x406E1},{0x1EE29,0x40701},{0x1EE2A,0x40721},{0x1EE2B,0x40741},{0x1EE2C,0x40761},
+    {0x1EE2D,0x40781},{0x1EE2E,0x407A1},{0x1EE2F,0x407C1},{0x1EE30,0x407E1},{0x1EE31,0x40801},{0x1EE32,0x40821},
+    {0x1EE34,0x40841},{0x1EE35,0x40861},{0x1EE36,0x40881},{0x1EE37,0x408A1},{0x1EE39,0x408C1},{0x1EE3B,0x408E1},
+    {0x1EE42,0x40901},{0x1EE47,0x40921},{0x1EE49,0x40941},{0x1EE4B,0x40961},{0x1EE4D,0x40981},{0x1EE4E,0x409A1},
+    {0x1EE4F,0x409C1},{0x1EE51,0x409E1},{0x1EE52,0x40A01},{0x1EE54,0x40A21},{0x1EE57,0x40A41},{0x1EE59,0x40A61},
+    {0x1EE5B,0x40A81},{0x1EE5D,0x40AA1},{0x1EE5F,0x40AC1},{0x1EE61,0x40AE1},{0x1EE62,0x40B01},{0x1EE64,0x40B21},
+    {0x1EE67,0x40B41},{0x1EE68,0x40B61},{0x1EE69,0x40B81},{0x1EE6A,0x40BA1},{0x1EE6C,0x40BC1},{0x1EE6D,0x40BE1},
+    {0x1EE6E,0x40C01},{0x1EE6F,0x40C21},{0x1EE70,0x40C41},{0x1EE71,0x40C61},{0x1EE72,0x40C81},{0x1EE74,0x40CA1},
+    {0x1EE75,0x40CC1},{0x1EE76,0x40CE1},{0x1EE77,0x40D01},{0x1EE79,0x40D21},{0x1EE7A,0x40D41},{0x1EE7B,0x40D61},
+    {0x1EE7C,0x40D81},{0x1EE7E,0x40DA1},{0x1EE80,0x40DC1},{0x1EE81,0x40DE1},{0x1EE82,0x40E01},{0x1EE83,0x40E21},
+    {0x1EE84,0x40E41},{0x1EE85,0x40E61},{0x1EE86,0x40E81},{0x1EE87,0x40EA1},{0x1EE88,0x40EC1},{0x1EE89,0x40EE1},
+    {0x1EE8B,0x40F01},{0x1EE8C,0x40F21},{0x1EE8D,0x40F41},{0x1EE8E,0x40F61},{0x1EE8F,0x40F81},{0x1EE90,0x40FA1},
+    {0x1EE91,0x40FC1},{0x1EE92,0x40FE1},{0x1EE93,0x41001},{0x1EE94,0x41021},{0x1EE95,0x41041},{0x1EE96,0x41061},
+    {0x1EE97,0x41081},{0x1EE98,0x410A1},{0x1EE99,0x410C1},{0x1EE9A,0x410E1},{0x1EE9B,0x41101},{0x1EEA1,0x41121},
+    {0x1EEA2,0x41141},{0x1EEA3,0x41161},{0x1EEA5,0x41181},{0x1EEA6,0x411A1},{0x1EEA7,0x411C1},{0x1EEA8,0x411E1},
+    {0x1EEA9,0x41201},{0x1EEAB,0x41221},{0x1EEAC,0x41241},{0x1EEAD,0x41261},{0x1EEAE,0x41281},{0x1EEAF,0x412A1},
+    {0x1EEB0,0x412C1},{0x1EEB1,0x412E1},{0x1EEB2,0x41301},{0x1EEB3,0x41321},{0x1EEB4,0x41341},{0x1EEB5,0x41361},
+    {0x1EEB6,0x41381},{0x1EEB7,0x413A1},{0x1EEB8,0x413C1},{0x1EEB9,0x413E1},{0x1EEBA,0x41401},{0x1EEBB,0x41421},
+    {0x1F100,0x41442},{0x1F101,0x41482},{0x1F102,0x414C2},{0x1F103,0x41502},{0x1F104,0x41542},{0x1F105,0x41582},
+    {0x1F106,0x415C2},{0x1F107,0x41602},{0x1F108,0x41642},{0x1F109,0x41682},{0x1F10A,0x416C2},{0x1F110,0x41703},
+    {0x1F111,0x41763},{0x1F112,0x417C3},{0x1F113,0x41823},{0x1F114,0x41883},{0x1F115,0x418E3},{0x1F116,0x41943},
+    {0x1F117,0x419A3},{0x1F118,0x41A03},{0x1F119,0x41A63},{0x1F11A,0x41AC3},{0x1F11B,0x41B23},{0x1F11C,0x41B83},
+    {0x1F11D,0x41BE3},{0x1F11E,0x41C43},{0x1F11F,0x41CA3},{0x1F120,0x41D03},{0x1F121,0x41D63},{0x1F122,0x41DC3},
+    {0x1F123,0x41E23},{0x1F124,0x41E83},{0x1F125,0x41EE3},{0x1F126,0x41F43},{0x1F127,0x41FA3},{0x1F128,0x42003},
+    {0x1F129,0x42063},{0x1F12A,0x420C3},{0x1F12B,0x42121},{0x1F12C,0x42141},{0x1F12D,0x42162},{0x1F12E,0x421A2},
+    {0x1F130,0x421E1},{0x1F131,0x42201},{0x1F132,0x42221},{0x1F133,0x42241},{0x1F134,0x42261},{0x1F135,0x42281},
+    {0x1F136,0x422A1},{0x1F137,0x422C1},{0x1F138,0x422E1},{0x1F139,0x42301},{0x1F13A,0x42321},{0x1F13B,0x42341},
+    {0x1F13C,0x42361},{0x1F13D,0x42381},{0x1F13E,0x423A1},{0x1F13F,0x423C1},{0x1F140,0x423E1},{0x1F141,0x42401},
+    {0x1F142,0x42421},{0x1F143,0x42441},{0x1F144,0x42461},{0x1F145,0x42481},{0x1F146,0x424A1},{0x1F147,0x424C1},
+    {0x1F148,0x424E1},{0x1F149,0x42501},{0x1F14A,0x42522},{0x1F14B,0x42562},{0x1F14C,0x425A2},{0x1F14D,0x425E2},
+    {0x1F14E,0x42623},{0x1F14F,0x42682},{0x1F16A,0x426C2},{0x1F16B,0x42702},{0x1F16C,0x42742},{0x1F190,0x42782},
+    {0x1F200,0x427C2},{0x1F201,0x42802},{0x1F202,0x42841},{0x1F210,0x42861},{0x1F211,0x42881},{0x1F212,0x428A1},
+    {0x1F213,0x428C2},{0x1F214,0x42901},{0x1F215,0x42921},{0x1F216,0x42941},{0x1F217,0x42961},{0x1F218,0x42981},
+    {0x1F219,0x429A1},{0x1F21A,0x429C1},{0x1F21B,0x429E1},{0x1F21C,0x42A01},{0x1F21D,0x42A21},{0x1F21E,0x42A41},
+    {0x1F21F,0x42A61},{0x1F220,0x42A81},{0x1F221,0x42AA1},{0x1F222,0x42AC1},{0x1F223,0x42AE1},{0x1F224,0x42B01},
+    {0x1F225,0x42B21},{0x1F226,0x42B41},{0x1F227,0x42B61},{0x1F228,0x42B81},{0x1F229,0x42BA1},{0x1F22A,0x42BC1},
+    {0x1F22B,0x42BE1},{0x1F22C,0x42C01},{0x1F22D,0x42C21},{0x1F22E,0x42C41},{0x1F22F,0x42C61},{0x1F230,0x42C81},
+    {0x1F231,0x42CA1},{0x1F232,0x42CC1},{0x1F233,0x42CE1},{0x1F234,0x42D01},{0x1F235,0x42D21},{0x1F236,0x42D41},
+    {0x1F237,0x42D61},{0x1F238,0x42D81},{0x1F239,0x42DA1},{0x1F23A,0x42DC1},{0x1F23B,0x42DE1},{0x1F240,0x42E03},
+    {0x1F241,0x42E63},{0x1F242,0x42EC3},{0x1F243,0x42F23},{0x1F244,0x42F83},{0x1F245,0x42FE3},{0x1F246,0x43043},
+    {0x1F247,0x430A3},{0x1F248,0x43103},{0x1F250,0x43161},{0x1F251,0x43181},{0x1FBF0,0x431A1},{0x1FBF1,0x431C1},
+    {0x1FBF2,0x431E1},{0x1FBF3,0x43201},{0x1FBF4,0x43221},{0x1FBF5,0x43241},{0x1FBF6,0x43261},{0x1FBF7,0x43281},
+    {0x1FBF8,0x432A1},{0x1FBF9,0x432C1},
+};
+
+#define HZ_UCD_COMPAT_DECOMPOSITION_COUNT 3812
+
+static const uint32_t hz_ucd_decomposition_data[9141] = {
+    0x0020,0x0020,0x0308,0x0061,0x0020,0x0304,0x0032,0x0033,0x0020,0x0301,0x03BC,0x0020,
+    0x0327,0x0031,0x006F,0x0031,0x2044,0x0034,0x0031,0x2044,0x0032,0x0033,0x2044,0x0034,
+    0x0041,0x0300,0x0041,0x0301,0x0041,0x0302,0x0041,0x0303,0x0041,0x0308,0x0041,0x030A,
+    0x0043,0x0327,0x0045,0x0300,0x0045,0x0301,0x0045,0x0302,0x0045,0x0308,0x0049,0x0300,
+    0x0049,0x0301,0x0049,0x0302,0x0049,0x0308,0x004E,0x0303,0x004F,0x0300,0x004F,0x0301,
+    0x004F,0x0302,0x004F,0x0303,0x004F,0x0308,0x0055,0x0300,0x0055,0x0301,0x0055,0x0302,
+    0x0055,0x0308,0x0059,0x0301,0x0061,0x0300,0x0061,0x0301,0x0061,0x0302,0x0061,0x0303,
+    0x0061,0x0308,0x0061,0x030A,0x0063,0x0327,0x0065,0x0300,0x0065,0x0301,0x0065,0x0302,
+    0x0065,0x0308,0x0069,0x0300,0x0069,0x0301,0x0069,0x0302,0x0069,0x0308,0x006E,0x0303,
+    0x006F,0x0300,0x006F,0x0301,0x006F,0x0302,0x006F,0x0303,0x006F,0x0308,0x0075,0x0300,
+    0x0075,0x0301,0x0075,0x0302,0x0075,0x0308,0x0079,0x0301,0x0079,0x0308,0x0041,0x0304,
+    0x0061,0x0304,0x0041,0x0306,0x0061,0x0306,0x0041,0x0328,0x0061,0x0328,0x0043,0x0301,
+    0x0063,0x0301,0x0043,0x0302,0x0063,0x0302,0x0043,0x0307,0x0063,0x0307,0x0043,0x030C,
+    0x0063,0x030C,0x0044,0x030C,0x0064,0x030C,0x0045,0x0304,0x0065,0x0304,0x0045,0x0306,
+    0x0065,0x0306,0x0045,0x0307,0x0065,0x0307,0x0045,0x0328,0x0065,0x0328,0x0045,0x030C,
+    0x0065,0x030C,0x0047,0x0302,0x0067,0x0302,0x0047,0x0306,0x0067,0x0306,0x0047,0x0307,
+    0x0067,0x0307,0x0047,0x0327,0x0067,0x0327,0x0048,0x0302,0x0068,0x0302,0x0049,0x0303,
+    0x0069,0x0303,0x0049,0x0304,0x0069,0x0304,0x0049,0x0306,0x0069,0x0306,0x0049,0x0328,
+    0x0069,0x0328,0x0049,0x0307,0x0049,0x004A,0x0069,0x006A,0x004A,0x0302,0x006A,0x0302,
+    0x004B,0x0327,0x006B,0x0327,0x004C,0x0301,0x006C,0x0301,0x004C,0x0327,0x006C,0x0327,
+    0x004C,0x030C,0x006C,0x030C,0x004C,0x00B7,0x006C,0x00B7,0x004E,0x0301,0x006E,0x0301,
+    0x004E,0x0327,0x006E,0x0327,0x004E,0x030C,0x006E,0x030C,0x02BC,0x006E,0x004F,0x0304,
+    0x006F,0x0304,0x004F,0x0306,0x006F,0x0306,0x004F,0x030B,0x006F,0x030B,0x0052,0x0301,
+    0x0072,0x0301,0x0052,0x0327,0x0072,0x0327,0x0052,0x030C,0x0072,0x030C,0x0053,0x0301,
+    0x0073,0x0301,0x0053,0x0302,0x0073,0x0302,0x0053,0x0327,0x0073,0x0327,0x0053,0x030C,
+    0x0073,0x030C,0x0054,0x0327,0x0074,0x0327,0x0054,0x030C,0x0074,0x030C,0x0055,0x0303,
+    0x0075,0x0303,0x0055,0x0304,0x0075,0x0304,0x0055,0x0306,0x0075,0x0306,0x0055,0x030A,
+    0x0075,0x030A,0x0055,0x030B,0x0075,0x030B,0x0055,0x0328,0x0075,0x0328,0x0057,0x0302,
+    0x0077,0x0302,0x0059,0x0302,0x0079,0x0302,0x0059,0x0308,0x005A,0x0301,0x007A,0x0301,
+    0x005A,0x0307,0x007A,0x0307,0x005A,0x030C,0x007A,0x030C,0x0073,0x004F,0x031B,0x006F,
+    0x031B,0x0055,0x031B,0x0075,0x031B,0x0044,0x005A,0x030C,0x0044,0x007A,0x030C,0x0064,
+    0x007A,0x030C,0x004C,0x004A,0x004C,0x006A,0x006C,0x006A,0x004E,0x004A,0x004E,0x006A,
+    0x006E,0x006A,0x0041,0x030C,0x0061,0x030C,0x0049,0x030C,0x0069,0x030C,0x004F,0x030C,
+    0x006F,0x030C,0x0055,0x030C,0x0075,0x030C,0x0055,0x0308,0x0304,0x0075,0x0308,0x0304,
+    0x0055,0x0308,0x0301,0x0075,0x0308,0x0301,0x0055,0x0308,0x030C,0x0075,0x0308,0x030C,
+    0x0055,0x0308,0x0300,0x0075,0x0308,0x0300,0x0041,0x0308,0x0304,0x0061,0x0308,0x0304,
+    0x0041,0x0307,0x0304,0x0061,0x0307,0x0304,0x00C6,0x0304,0x00E6,0x0304,0x0047,0x030C,
+    0x0067,0x030C,0x004B,0x030C,0x006B,0x030C,0x004F,0x0328,0x006F,0x0328,0x004F,0x0328,
+    0x0304,0x006F,0x0328,0x0304,0x01B7,0x030C,0x0292,0x030C,0x006A,0x030C,0x0044,0x005A,
+    0x0044,0x007A,0x0064,0x007A,0x0047,0x0301,0x0067,0x0301,0x004E,0x0300,0x006E,0x0300,
+    0x0041,0x030A,0x0301,0x0061,0x030A,0x0301,0x00C6,0x0301,0x00E6,0x0301,0x00D8,0x0301,
+    0x00F8,0x0301,0x0041,0x030F,0x0061,0x030F,0x0041,0x0311,0x0061,0x0311,0x0045,0x030F,
+    0x0065,0x030F,0x0045,0x0311,0x0065,0x0311,0x0049,0x030F,0x0069,0x030F,0x0049,0x0311,
+    0x0069,0x0311,0x004F,0x030F,0x006F,0x030F,0x004F,0x0311,0x006F,0x0311,0x0052,0x030F,
+    0x0072,0x030F,0x0052,0x0311,0x0072,0x0311,0x0055,0x030F,0x0075,0x030F,0x0055,0x0311,
+    0x0075,0x0311,0x0053,0x0326,0x0073,0x0326,0x0054,0x0326,0x0074,0x0326,0x0048,0x030C,
+    0x0068,0x030C,0x0041,0x0307,0x0061,0x0307,0x0045,0x0327,0x0065,0x0327,0x004F,0x0308,
+    0x0304,0x006F,0x0308,0x0304,0x004F,0x0303,0x0304,0x006F,0x0303,0x0304,0x004F,0x0307,
+    0x006F,0x0307,0x004F,0x0307,0x0304,0x006F,0x0307,0x0304,0x0059,0x0304,0x0079,0x0304,
+    0x0068,0x0266,0x006A,0x0072,0x0279,0x027B,0x0281,0x0077,0x0079,0x0020,0x0306,0x0020,
+    0x0307,0x0020,0x030A,0x0020,0x0328,0x0020,0x0303,0x0020,0x030B,0x0263,0x006C,0x0073,
+    0x0078,0x0295,0x0300,0x0301,0x0313,0x0308,0x0301,0x02B9,0x0020,0x0345,0x003B,0x0020,
+    0x0301,0x00A8,0x0301,0x0020,0x0308,0x0301,0x0391,0x0301,0x00B7,0x0395,0x0301,0x0397,
+    0x0301,0x0399,0x0301,0x039F,0x0301,0x03A5,0x0301,0x03A9,0x0301,0x03B9,0x0308,0x0301,
+    0x0399,0x0308,0x03A5,0x0308,0x03B1,0x0301,0x03B5,0x0301,0x03B7,0x0301,0x03B9,0x0301,
+    0x03C5,0x0308,0x0301,0x03B9,0x0308,0x03C5,0x0308,0x03BF,0x0301,0x03C5,0x0301,0x03C9,
+    0x0301,0x03B2,0x03B8,0x03A5,0x03D2,0x0301,0x03A5,0x0301,0x03D2,0x0308,0x03A5,0x0308,
+    0x03C6,0x03C0,0x03BA,0x03C1,0x03C2,0x0398,0x03B5,0x03A3,0x0415,0x0300,0x0415,0x0308,
+    0x0413,0x0301,0x0406,0x0308,0x041A,0x0301,0x0418,0x0300,0x0423,0x0306,0x0418,0x0306,
+    0x0438,0x0306,0x0435,0x0300,0x0435,0x0308,0x0433,0x0301,0x0456,0x0308,0x043A,0x0301,
+    0x0438,0x0300,0x0443,0x0306,0x0474,0x030F,0x0475,0x030F,0x0416,0x0306,0x0436,0x0306,
+    0x0410,0x0306,0x0430,0x0306,0x0410,0x0308,0x0430,0x0308,0x0415,0x0306,0x0435,0x0306,
+    0x04D8,0x0308,0x04D9,0x0308,0x0416,0x0308,0x0436,0x0308,0x0417,0x0308,0x0437,0x0308,
+    0x0418,0x0304,0x0438,0x0304,0x0418,0x0308,0x0438,0x0308,0x041E,0x0308,0x043E,0x0308,
+    0x04E8,0x0308,0x04E9,0x0308,0x042D,0x0308,0x044D,0x0308,0x0423,0x0304,0x0443,0x0304,
+    0x0423,0x0308,0x0443,0x0308,0x0423,0x030B,0x0443,0x030B,0x0427,0x0308,0x0447,0x0308,
+    0x042B,0x0308,0x044B,0x0308,0x0565,0x0582,0x0627,0x0653,0x0627,0x0654,0x0648,0x0654,
+    0x0627,0x0655,0x064A,0x0654,0x0627,0x0674,0x0648,0x0674,0x06C7,0x0674,0x064A,0x0674,
+    0x06D5,0x0654,0x06C1,0x0654,0x06D2,0x0654,0x0928,0x093C,0x0930,0x093C,0x0933,0x093C,
+    0x0915,0x093C,0x0916,0x093C,0x0917,0x093C,0x091C,0x093C,0x0921,0x093C,0x0922,0x093C,
+    0x092B,0x093C,0x092F,0x093C,0x09C7,0x09BE,0x09C7,0x09D7,0x09A1,0x09BC,0x09A2,0x09BC,
+    0x09AF,0x09BC,0x0A32,0x0A3C,0x0A38,0x0A3C,0x0A16,0x0A3C,0x0A17,0x0A3C,0x0A1C,0x0A3C,
+    0x0A2B,0x0A3C,0x0B47,0x0B56,0x0B47,0x0B3E,0x0B47,0x0B57,0x0B21,0x0B3C,0x0B22,0x0B3C,
+    0x0B92,0x0BD7,0x0BC6,0x0BBE,0x0BC7,0x0BBE,0x0BC6,0x0BD7,0x0C46,0x0C56,0x0CBF,0x0CD5,
+    0x0CC6,0x0CD5,0x0CC6,0x0CD6,0x0CC6,0x0CC2,0x0CC6,0x0CC2,0x0CD5,0x0D46,0x0D3E,0x0D47,
+    0x0D3E,0x0D46,0x0D57,0x0DD9,0x0DCA,0x0DD9,0x0DCF,0x0DD9,0x0DCF,0x0DCA,0x0DD9,0x0DDF,
+    0x0E4D,0x0E32,0x0ECD,0x0EB2,0x0EAB,0x0E99,0x0EAB,0x0EA1,0x0F0B,0x0F42,0x0FB7,0x0F4C,
+    0x0FB7,0x0F51,0x0FB7,0x0F56,0x0FB7,0x0F5B,0x0FB7,0x0F40,0x0FB5,0x0F71,0x0F72,0x0F71,
+    0x0F74,0x0FB2,0x0F80,0x0FB2,0x0F71,0x0F80,0x0FB3,0x0F80,0x0FB3,0x0F71,0x0F80,0x0F71,
+    0x0F80,0x0F92,0x0FB7,0x0F9C,0x0FB7,0x0FA1,0x0FB7,0x0FA6,0x0FB7,0x0FAB,0x0FB7,0x0F90,
+    0x0FB5,0x1025,0x102E,0x10DC,0x1B05,0x1B35,0x1B07,0x1B35,0x1B09,0x1B35,0x1B0B,0x1B35,
+    0x1B0D,0x1B35,0x1B11,0x1B35,0x1B3A,0x1B35,0x1B3C,0x1B35,0x1B3E,0x1B35,0x1B3F,0x1B35,
+    0x1B42,0x1B35,0x0041,0x00C6,0x0042,0x0044,0x0045,0x018E,0x0047,0x0048,0x0049,0x004A,
+    0x004B,0x004C,0x004D,0x004E,0x004F,0x0222,0x0050,0x0052,0x0054,0x0055,0x0057,0x0061,
+    0x0250,0x0251,0x1D02,0x0062,0x0064,0x0065,0x0259,0x025B,0x025C,0x0067,0x006B,0x006D,
+    0x014B,0x006F,0x0254,0x1D16,0x1D17,0x0070,0x0074,0x0075,0x1D1D,0x026F,0x0076,0x1D25,
+    0x03B2,0x03B3,0x03B4,0x03C6,0x03C7,0x0069,0x0072,0x0075,0x0076,0x03B2,0x03B3,0x03C1,
+    0x03C6,0x03C7,0x043D,0x0252,0x0063,0x0255,0x00F0,0x025C,0x0066,0x025F,0x0261,0x0265,
+    0x0268,0x0269,0x026A,0x1D7B,0x029D,0x026D,0x1D85,0x029F,0x0271,0x0270,0x0272,0x0273,
+    0x0274,0x0275,0x0278,0x0282,0x0283,0x01AB,0x0289,0x028A,0x1D1C,0x028B,0x028C,0x007A,
+    0x0290,0x0291,0x0292,0x03B8,0x0041,0x0325,0x0061,0x0325,0x0042,0x0307,0x0062,0x0307,
+    0x0042,0x0323,0x0062,0x0323,0x0042,0x0331,0x0062,0x0331,0x0043,0x0327,0x0301,0x0063,
+    0x0327,0x0301,0x0044,0x0307,0x0064,0x0307,0x0044,0x0323,0x0064,0x0323,0x0044,0x0331,
+    0x0064,0x0331,0x0044,0x0327,0x0064,0x0327,0x0044,0x032D,0x0064,0x032D,0x0045,0x0304,
+    0x0300,0x0065,0x0304,0x0300,0x0045,0x0304,0x0301,0x0065,0x0304,0x0301,0x0045,0x032D,
+    0x0065,0x032D,0x0045,0x0330,0x0065,0x0330,0x0045,0x0327,0x0306,0x0065,0x0327,0x0306,
+    0x0046,0x0307,0x0066,0x0307,0x0047,0x0304,0x0067,0x0304,0x0048,0x0307,0x0068,0x0307,
+    0x0048,0x0323,0x0068,0x0323,0x0048,0x0308,0x0068,0x0308,0x0048,0x0327,0x0068,0x0327,
+    0x0048,0x032E,0x0068,0x032E,0x0049,0x0330,0x0069,0x0330,0x0049,0x0308,0x0301,0x0069,
+    0x0308,0x0301,0x004B,0x0301,0x006B,0x0301,0x004B,0x0323,0x006B,0x0323,0x004B,0x0331,
+    0x006B,0x0331,0x004C,0x0323,0x006C,0x0323,0x004C,0x0323,0x0304,0x006C,0x0323,0x0304,
+    0x004C,0x0331,0x006C,0x0331,0x004C,0x032D,0x006C,0x032D,0x004D,0x0301,0x006D,0x0301,
+    0x004D,0x0307,0x006D,0x0307,0x004D,0x0323,0x006D,0x0323,0x004E,0x0307,0x006E,0x0307,
+    0x004E,0x0323,0x006E,0x0323,0x004E,0x0331,0x006E,0x0331,0x004E,0x032D,0x006E,0x032D,
+    0x004F,0x0303,0x0301,0x006F,0x0303,0x0301,0x004F,0x0303,0x0308,0x006F,0x0303,0x0308,
+    0x004F,0x0304,0x0300,0x006F,0x0304,0x0300,0x004F,0x0304,0x0301,0x006F,0x0304,0x0301,
+    0x0050,0x0301,0x0070,0x0301,0x0050,0x0307,0x0070,0x0307,0x0052,0x0307,0x0072,0x0307,
+    0x0052,0x0323,0x0072,0x0323,0x0052,0x0323,0x0304,0x0072,0x0323,0x0304,0x0052,0x0331,
+    0x0072,0x0331,0x0053,0x0307,0x0073,0x0307,0x0053,0x0323,0x0073,0x0323,0x0053,0x0301,
+    0x0307,0x0073,0x0301,0x0307,0x0053,0x030C,0x0307,0x0073,0x030C,0x0307,0x0053,0x0323,
+    0x0307,0x0073,0x0323,0x0307,0x0054,0x0307,0x0074,0x0307,0x0054,0x0323,0x0074,0x0323,
+    0x0054,0x0331,0x0074,0x0331,0x0054,0x032D,0x0074,0x032D,0x0055,0x0324,0x0075,0x0324,
+    0x0055,0x0330,0x0075,0x0330,0x0055,0x032D,0x0075,0x032D,0x0055,0x0303,0x0301,0x0075,
+    0x0303,0x0301,0x0055,0x0304,0x0308,0x0075,0x0304,0x0308,0x0056,0x0303,0x0076,0x0303,
+    0x0056,0x0323,0x0076,0x0323,0x0057,0x0300,0x0077,0x0300,0x0057,0x0301,0x0077,0x0301,
+    0x0057,0x0308,0x0077,0x0308,0x0057,0x0307,0x0077,0x0307,0x0057,0x0323,0x0077,0x0323,
+    0x0058,0x0307,0x0078,0x0307,0x0058,0x0308,0x0078,0x0308,0x0059,0x0307,0x0079,0x0307,
+    0x005A,0x0302,0x007A,0x0302,0x005A,0x0323,0x007A,0x0323,0x005A,0x0331,0x007A,0x0331,
+    0x0068,0x0331,0x0074,0x0308,0x0077,0x030A,0x0079,0x030A,0x0061,0x02BE,0x017F,0x0307,
+    0x0073,0x0307,0x0041,0x0323,0x0061,0x0323,0x0041,0x0309,0x0061,0x0309,0x0041,0x0302,
+    0x0301,0x0061,0x0302,0x0301,0x0041,0x0302,0x0300,0x0061,0x0302,0x0300,0x0041,0x0302,
+    0x0309,0x0061,0x0302,0x0309,0x0041,0x0302,0x0303,0x0061,0x0302,0x0303,0x0041,0x0323,
+    0x0302,0x0061,0x0323,0x0302,0x0041,0x0306,0x0301,0x0061,0x0306,0x0301,0x0041,0x0306,
+    0x0300,0x0061,0x0306,0x0300,0x0041,0x0306,0x0309,0x0061,0x0306,0x0309,0x0041,0x0306,
+    0x0303,0x0061,0x0306,0x0303,0x0041,0x0323,0x0306,0x0061,0x0323,0x0306,0x0045,0x0323,
+    0x0065,0x0323,0x0045,0x0309,0x0065,0x0309,0x0045,0x0303,0x0065,0x0303,0x0045,0x0302,
+    0x0301,0x0065,0x0302,0x0301,0x0045,0x0302,0x0300,0x0065,0x0302,0x0300,0x0045,0x0302,
+    0x0309,0x0065,0x0302,0x0309,0x0045,0x0302,0x0303,0x0065,0x0302,0x0303,0x0045,0x0323,
+    0x0302,0x0065,0x0323,0x0302,0x0049,0x0309,0x0069,0x0309,0x0049,0x0323,0x0069,0x0323,
+    0x004F,0x0323,0x006F,0x0323,0x004F,0x0309,0x006F,0x0309,0x004F,0x0302,0x0301,0x006F,
+    0x0302,0x0301,0x004F,0x0302,0x0300,0x006F,0x0302,0x0300,0x004F,0x0302,0x0309,0x006F,
+    0x0302,0x0309,0x004F,0x0302,0x0303,0x006F,0x0302,0x0303,0x004F,0x0323,0x0302,0x006F,
+    0x0323,0x0302,0x004F,0x031B,0x0301,0x006F,0x031B,0x0301,0x004F,0x031B,0x0300,0x006F,
+    0x031B,0x0300,0x004F,0x031B,0x0309,0x006F,0x031B,0x0309,0x004F,0x031B,0x0303,0x006F,
+    0x031B,0x0303,0x004F,0x031B,0x0323,0x006F,0x031B,0x0323,0x0055,0x0323,0x0075,0x0323,
+    0x0055,0x0309,0x0075,0x0309,0x0055,0x031B,0x0301,0x0075,0x031B,0x0301,0x0055,0x031B,
+    0x0300,0x0075,0x031B,0x0300,0x0055,0x031B,0x0309,0x0075,0x031B,0x0309,0x0055,0x031B,
+    0x0303,0x0075,0x031B,0x0303,0x0055,0x031B,0x0323,0x0075,0x031B,0x0323,0x0059,0x0300,
+    0x0079,0x0300,0x0059,0x0323,0x0079,0x0323,0x0059,0x0309,0x0079,0x0309,0x0059,0x0303,
+    0x0079,0x0303,0x03B1,0x0313,0x03B1,0x0314,0x03B1,0x0313,0x0300,0x03B1,0x0314,0x0300,
+    0x03B1,0x0313,0x0301,0x03B1,0x0314,0x0301,0x03B1,0x0313,0x0342,0x03B1,0x0314,0x0342,
+    0x0391,0x0313,0x0391,0x0314,0x0391,0x0313,0x0300,0x0391,0x0314,0x0300,0x0391,0x0313,
+    0x0301,0x0391,0x0314,0x0301,0x0391,0x0313,0x0342,0x0391,0x0314,0x0342,0x03B5,0x0313,
+    0x03B5,0x0314,0x03B5,0x0313,0x0300,0x03B5,0x0314,0x0300,0x03B5,0x0313,0x0301,0x03B5,
+    0x0314,0x0301,0x0395,0x0313,0x0395,0x0314,0x0395,0x0313,0x0300,0x0395,0x0314,0x0300,
+    0x0395,0x0313,0x0301,0x0395,0x0314,0x0301,0x03B7,0x0313,0x03B7,0x0314,0x03B7,0x0313,
+    0x0300,0x03B7,0x0314,0x0300,0x03B7,0x0313,0x0301,0x03B7,0x0314,0x0301,0x03B7,0x0313,
+    0x0342,0x03B7,0x0314,0x0342,0x0397,0x0313,0x0397,0x0314,0x0397,0x0313,0x0300,0x0397,
+    0x0314,0x0300,0x0397,0x0313,0x0301,0x0397,0x0314,0x0301,0x0397,0x0313,0x0342,0x0397,
+    0x0314,0x0342,0x03B9,0x0313,0x03B9,0x0314,0x03B9,0x0313,0x0300,0x03B9,0x0314,0x0300,
+    0x03B9,0x0313,0x0301,0x03B9,0x0314,0x0301,0x03B9,0x0313,0x0342,0x03B9,0x0314,0x0342,
+    0x0399,0x0313,0x0399,0x0314,0x0399,0x0313,0x0300,0x0399,0x0314,0x0300,0x0399,0x0313,
+    0x0301,0x0399,0x0314,0x0301,0x0399,0x0313,0x0342,0x0399,0x0314,0x0342,0x03BF,0x0313,
+    0x03BF,0x0314,0x03BF,0x0313,0x0300,0x03BF,0x0314,0x0300,0x03BF,0x0313,0x0301,0x03BF,
+    0x0314,0x0301,0x039F,0x0313,0x039F,0x0314,0x039F,0x0313,0x0300,0x039F,0x0314,0x0300,
+    0x039F,0x0313,0x0301,0x039F,0x0314,0x0301,0x03C5,0x0313,0x03C5,0x0314,0x03C5,0x0313,
+    0x0300,0x03C5,0x0314,0x0300,0x03C5,0x0313,0x0301,0x03C5,0x0314,0x0301,0x03C5,0x0313,
+    0x0342,0x03C5,0x0314,0x0342,0x03A5,0x0314,0x03A5,0x0314,0x0300,0x03A5,0x0314,0x0301,
+    0x03A5,0x0314,0x0342,0x03C9,0x0313,0x03C9,0x0314,0x03C9,0x0313,0x0300,0x03C9,0x0314,
+    0x0300,0x03C9,0x0313,0x0301,0x03C9,0x0314,0x0301,0x03C9,0x0313,0x0342,0x03C9,0x0314,
+    0x0342,0x03A9,0x0313,0x03A9,0x0314,0x03A9,0x0313,0x0300,0x03A9,0x0314,0x0300,0x03A9,
+    0x0313,0x0301,0x03A9,0x0314,0x0301,0x03A9,0x0313,0x0342,0x03A9,0x0314,0x0342,0x03B1,
+    0x0300,0x03B1,0x0301,0x03B5,0x0300,0x03B5,0x0301,0x03B7,0x0300,0x03B7,0x0301,0x03B9,
+    0x0300,0x03B9,0x0301,0x03BF,0x0300,0x03BF,0x0301,0x03C5,0x0300,0x03C5,0x0301,0x03C9,
+    0x0300,0x03C9,0x0301,0x03B1,0x0313,0x0345,0x03B1,0x0314,0x0345,0x03B1,0x0313,0x0300,
+    0x0345,0x03B1,0x0314,0x0300,0x0345,0x03B1,0x0313,0x0301,0x0345,0x03B1,0x0314,0x0301,
+    0x0345,0x03B1,0x0313,0x0342,0x0345,0x03B1,0x0314,0x0342,0x0345,0x0391,0x0313,0x0345,
+    0x0391,0x0314,0x0345,0x0391,0x0313,0x0300,0x0345,0x0391,0x0314,0x0300,0x0345,0x0391,
+    0x0313,0x0301,0x0345,0x0391,0x0314,0x0301,0x0345,0x0391,0x0313,0x0342,0x0345,0x0391,
+    0x0314,0x0342,0x0345,0x03B7,0x0313,0x0345,0x03B7,0x0314,0x0345,0x03B7,0x0313,0x0300,
+    0x0345,0x03B7,0x0314,0x0300,0x0345,0x03B7,0x0313,0x0301,0x0345,0x03B7,0x0314,0x0301,
+    0x0345,0x03B7,0x0313,0x0342,0x0345,0x03B7,0x0314,0x0342,0x0345,0x0397,0x0313,0x0345,
+    0x0397,0x0314,0x0345,0x0397,0x0313,0x0300,0x0345,0x0397,0x0314,0x0300,0x0345,0x0397,
+    0x0313,0x0301,0x0345,0x0397,0x0314,0x0301,0x0345,0x0397,0x0313,0x0342,0x0345,0x0397,
+    0x0314,0x0342,0x0345,0x03C9,0x0313,0x0345,0x03C9,0x0314,0x0345,0x03C9,0x0313,0x0300,
+    0x0345,0x03C9,0x0314,0x0300,0x0345,0x03C9,0x0313,0x0301,0x0345,0x03C9,0x0314,0x0301,
+    0x0345,0x03C9,0x0313,0x0342,0x0345,0x03C9,0x0314,0x0342,0x0345,0x03A9,0x0313,0x0345,
+    0x03A9,0x0314,0x0345,0x03A9,0x0313,0x0300,0x0345,0x03A9,0x0314,0x0300,0x0345,0x03A9,
+    0x0313,0x0301,0x0345,0x03A9,0x0314,0x0301,0x0345,0x03A9,0x0313,0x0342,0x0345,0x03A9,
+    0x0314,0x0342,0x0345,0x03B1,0x0306,0x03B1,0x0304,0x03B1,0x0300,0x0345,0x03B1,0x0345,
+    0x03B1,0x0301,0x0345,0x03B1,0x0342,0x03B1,0x0342,0x0345,0x0391,0x0306,0x0391,0x0304,
+    0x0391,0x0300,0x0391,0x0301,0x0391,0x0345,0x0020,0x0313,0x03B9,0x0020,0x0313,0x0020,
+    0x0342,0x00A8,0x0342,0x0020,0x0308,0x0342,0x03B7,0x0300,0x0345,0x03B7,0x0345,0x03B7,
+    0x0301,0x0345,0x03B7,0x0342,0x03B7,0x0342,0x0345,0x0395,0x0300,0x0395,0x0301,0x0397,
+    0x0300,0x0397,0x0301,0x0397,0x0345,0x1FBF,0x0300,0x0020,0x0313,0x0300,0x1FBF,0x0301,
+    0x0020,0x0313,0x0301,0x1FBF,0x0342,0x0020,0x0313,0x0342,0x03B9,0x0306,0x03B9,0x0304,
+    0x03B9,0x0308,0x0300,0x03B9,0x0308,0x0301,0x03B9,0x0342,0x03B9,0x0308,0x0342,0x0399,
+    0x0306,0x0399,0x0304,0x0399,0x0300,0x0399,0x0301,0x1FFE,0x0300,0x0020,0x0314,0x0300,
+    0x1FFE,0x0301,0x0020,0x0314,0x0301,0x1FFE,0x0342,0x0020,0x0314,0x0342,0x03C5,0x0306,
+    0x03C5,0x0304,0x03C5,0x0308,0x0300,0x03C5,0x0308,0x0301,0x03C1,0x0313,0x03C1,0x0314,
+    0x03C5,0x0342,0x03C5,0x0308,0x0342,0x03A5,0x0306,0x03A5,0x0304,0x03A5,0x0300,0x03A5,
+    0x0301,0x03A1,0x0314,0x00A8,0x0300,0x0020,0x0308,0x0300,0x00A8,0x0301,0x0020,0x0308,
+    0x0301,0x0060,0x03C9,0x0300,0x0345,0x03C9,0x0345,0x03C9,0x0301,0x0345,0x03C9,0x0342,
+    0x03C9,0x0342,0x0345,0x039F,0x0300,0x039F,0x0301,0x03A9,0x0300,0x03A9,0x0301,0x03A9,
+    0x0345,0x00B4,0x0020,0x0301,0x0020,0x0314,0x2002,0x0020,0x2003,0x0020,0x0020,0x0020,
+    0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x2010,0x0020,0x0333,0x002E,0x002E,
+    0x002E,0x002E,0x002E,0x002E,0x0020,0x2032,0x2032,0x2032,0x2032,0x2032,0x2035,0x2035,
+    0x2035,0x2035,0x2035,0x0021,0x0021,0x0020,0x0305,0x003F,0x003F,0x003F,0x0021,0x0021,
+    0x003F,0x2032,0x2032,0x2032,0x2032,0x0020,0x0030,0x0069,0x0034,0x0035,0x0036,0x0037,
+    0x0038,0x0039,0x002B,0x2212,0x003D,0x0028,0x0029,0x006E,0x0030,0x0031,0x0032,0x0033,
+    0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x002B,0x2212,0x003D,0x0028,0x0029,0x0061,
+    0x0065,0x006F,0x0078,0x0259,0x0068,0x006B,0x006C,0x006D,0x006E,0x0070,0x0073,0x0074,
+    0x0052,0x0073,0x0061,0x002F,0x0063,0x0061,0x002F,0x0073,0x0043,0x00B0,0x0043,0x0063,
+    0x002F,0x006F,0x0063,0x002F,0x0075,0x0190,0x00B0,0x0046,0x0067,0x0048,0x0048,0x0048,
+    0x0068,0x0127,0x0049,0x0049,0x004C,0x006C,0x004E,0x004E,0x006F,0x0050,0x0051,0x0052,
+    0x0052,0x0052,0x0053,0x004D,0x0054,0x0045,0x004C,0x0054,0x004D,0x005A,0x03A9,0x005A,
+    0x004B,0x0041,0x030A,0x0042,0x0043,0x0065,0x0045,0x0046,0x004D,0x006F,0x05D0,0x05D1,
+    0x05D2,0x05D3,0x0069,0x0046,0x0041,0x0058,0x03C0,0x03B3,0x0393,0x03A0,0x2211,0x0044,
+    0x0064,0x0065,0x0069,0x006A,0x0031,0x2044,0x0037,0x0031,0x2044,0x0039,0x0031,0x2044,
+    0x0031,0x0030,0x0031,0x2044,0x0033,0x0032,0x2044,0x0033,0x0031,0x2044,0x0035,0x0032,
+    0x2044,0x0035,0x0033,0x2044,0x0035,0x0034,0x2044,0x0035,0x0031,0x2044,0x0036,0x0035,
+    0x2044,0x0036,0x0031,0x2044,0x0038,0x0033,0x2044,0x0038,0x0035,0x2044,0x0038,0x0037,
+    0x2044,0x0038,0x0031,0x2044,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0049,0x0056,
+    0x0056,0x0056,0x0049,0x0056,0x0049,0x0049,0x0056,0x0049,0x0049,0x0049,0x0049,0x0058,
+    0x0058,0x0058,0x0049,0x0058,0x0049,0x0049,0x004C,0x0043,0x0044,0x004D,0x0069,0x0069,
+    0x0069,0x0069,0x0069,0x0069,0x0069,0x0076,0x0076,0x0076,0x0069,0x0076,0x0069,0x0069,
+    0x0076,0x0069,0x0069,0x0069,0x0069,0x0078,0x0078,0x0078,0x0069,0x0078,0x0069,0x0069,
+    0x006C,0x0063,0x0064,0x006D,0x0030,0x2044,0x0033,0x2190,0x0338,0x2192,0x0338,0x2194,
+    0x0338,0x21D0,0x0338,0x21D4,0x0338,0x21D2,0x0338,0x2203,0x0338,0x2208,0x0338,0x220B,
+    0x0338,0x2223,0x0338,0x2225,0x0338,0x222B,0x222B,0x222B,0x222B,0x222B,0x222E,0x222E,
+    0x222E,0x222E,0x222E,0x223C,0x0338,0x2243,0x0338,0x2245,0x0338,0x2248,0x0338,0x003D,
+    0x0338,0x2261,0x0338,0x224D,0x0338,0x003C,0x0338,0x003E,0x0338,0x2264,0x0338,0x2265,
+    0x0338,0x2272,0x0338,0x2273,0x0338,0x2276,0x0338,0x2277,0x0338,0x227A,0x0338,0x227B,
+    0x0338,0x2282,0x0338,0x2283,0x0338,0x2286,0x0338,0x2287,0x0338,0x22A2,0x0338,0x22A8,
+    0x0338,0x22A9,0x0338,0x22AB,0x0338,0x227C,0x0338,0x227D,0x0338,0x2291,0x0338,0x2292,
+    0x0338,0x22B2,0x0338,0x22B3,0x0338,0x22B4,0x0338,0x22B5,0x0338,0x3008,0x3009,0x0031,
+    0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x0031,0x0030,0x0031,0x0031,
+    0x0031,0x0032,0x0031,0x0033,0x0031,0x0034,0x0031,0x0035,0x0031,0x0036,0x0031,0x0037,
+    0x0031,0x0038,0x0031,0x0039,0x0032,0x0030,0x0028,0x0031,0x0029,0x0028,0x0032,0x0029,
+    0x0028,0x0033,0x0029,0x0028,0x0034,0x0029,0x0028,0x0035,0x0029,0x0028,0x0036,0x0029,
+    0x0028,0x0037,0x0029,0x0028,0x0038,0x0029,0x0028,0x0039,0x0029,0x0028,0x0031,0x0030,
+    0x0029,0x0028,0x0031,0x0031,0x0029,0x0028,0x0031,0x0032,0x0029,0x0028,0x0031,0x0033,
+    0x0029,0x0028,0x0031,0x0034,0x0029,0x0028,0x0031,0x0035,0x0029,0x0028,0x0031,0x0036,
+    0x0029,0x0028,0x0031,0x0037,0x0029,0x0028,0x0031,0x0038,0x0029,0x0028,0x0031,0x0039,
+    0x0029,0x0028,0x0032,0x0030,0x0029,0x0031,0x002E,0x0032,0x002E,0x0033,0x002E,0x0034,
+    0x002E,0x0035,0x002E,0x0036,0x002E,0x0037,0x002E,0x0038,0x002E,0x0039,0x002E,0x0031,
+    0x0030,0x002E,0x0031,0x0031,0x002E,0x0031,0x0032,0x002E,0x0031,0x0033,0x002E,0x0031,
+    0x0034,0x002E,0x0031,0x0035,0x002E,0x0031,0x0036,0x002E,0x0031,0x0037,0x002E,0x0031,
+    0x0038,0x002E,0x0031,0x0039,0x002E,0x0032,0x0030,0x002E,0x0028,0x0061,0x0029,0x0028,
+    0x0062,0x0029,0x0028,0x0063,0x0029,0x0028,0x0064,0x0029,0x0028,0x0065,0x0029,0x0028,
+    0x0066,0x0029,0x0028,0x0067,0x0029,0x0028,0x0068,0x0029,0x0028,0x0069,0x0029,0x0028,
+    0x006A,0x0029,0x0028,0x006B,0x0029,0x0028,0x006C,0x0029,0x0028,0x006D,0x0029,0x0028,
+    0x006E,0x0029,0x0028,0x006F,0x0029,0x0028,0x0070,0x0029,0x0028,0x0071,0x0029,0x0028,
+    0x0072,0x0029,0x0028,0x0073,0x0029,0x0028,0x0074,0x0029,0x0028,0x0075,0x0029,0x0028,
+    0x0076,0x0029,0x0028,0x0077,0x0029,0x0028,0x0078,0x0029,0x0028,0x0079,0x0029,0x0028,
+    0x007A,0x0029,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,0x004A,
+    0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,0x0056,
+    0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,
+    0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,
+    0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0030,0x222B,0x222B,0x222B,0x222B,0x003A,
+    0x003A,0x003D,0x003D,0x003D,0x003D,0x003D,0x003D,0x2ADD,0x0338,0x006A,0x0056,0x2D61,
+    0x6BCD,0x9F9F,0x4E00,0x4E28,0x4E36,0x4E3F,0x4E59,0x4E85,0x4E8C,0x4EA0,0x4EBA,0x513F,
+    0x5165,0x516B,0x5182,0x5196,0x51AB,0x51E0,0x51F5,0x5200,0x529B,0x52F9,0x5315,0x531A,
+    0x5338,0x5341,0x535C,0x5369,0x5382,0x53B6,0x53C8,0x53E3,0x56D7,0x571F,0x58EB,0x5902,
+    0x590A,0x5915,0x5927,0x5973,0x5B50,0x5B80,0x5BF8,0x5C0F,0x5C22,0x5C38,0x5C6E,0x5C71,
+    0x5DDB,0x5DE5,0x5DF1,0x5DFE,0x5E72,0x5E7A,0x5E7F,0x5EF4,0x5EFE,0x5F0B,0x5F13,0x5F50,
+    0x5F61,0x5F73,0x5FC3,0x6208,0x6236,0x624B,0x652F,0x6534,0x6587,0x6597,0x65A4,0x65B9,
+    0x65E0,0x65E5,0x66F0,0x6708,0x6728,0x6B20,0x6B62,0x6B79,0x6BB3,0x6BCB,0x6BD4,0x6BDB,
+    0x6C0F,0x6C14,0x6C34,0x706B,0x722A,0x7236,0x723B,0x723F,0x7247,0x7259,0x725B,0x72AC,
+    0x7384,0x7389,0x74DC,0x74E6,0x7518,0x751F,0x7528,0x7530,0x758B,0x7592,0x7676,0x767D,
+    0x76AE,0x76BF,0x76EE,0x77DB,0x77E2,0x77F3,0x793A,0x79B8,0x79BE,0x7A74,0x7ACB,0x7AF9,
+    0x7C73,0x7CF8,0x7F36,0x7F51,0x7F8A,0x7FBD,0x8001,0x800C,0x8012,0x8033,0x807F,0x8089,
+    0x81E3,0x81EA,0x81F3,0x81FC,0x820C,0x821B,0x821F,0x826E,0x8272,0x8278,0x864D,0x866B,
+    0x8840,0x884C,0x8863,0x897E,0x898B,0x89D2,0x8A00,0x8C37,0x8C46,0x8C55,0x8C78,0x8C9D,
+    0x8D64,0x8D70,0x8DB3,0x8EAB,0x8ECA,0x8F9B,0x8FB0,0x8FB5,0x9091,0x9149,0x91C6,0x91CC,
+    0x91D1,0x9577,0x9580,0x961C,0x96B6,0x96B9,0x96E8,0x9751,0x975E,0x9762,0x9769,0x97CB,
+    0x97ED,0x97F3,0x9801,0x98A8,0x98DB,0x98DF,0x9996,0x9999,0x99AC,0x9AA8,0x9AD8,0x9ADF,
+    0x9B25,0x9B2F,0x9B32,0x9B3C,0x9B5A,0x9CE5,0x9E75,0x9E7F,0x9EA5,0x9EBB,0x9EC3,0x9ECD,
+    0x9ED1,0x9EF9,0x9EFD,0x9F0E,0x9F13,0x9F20,0x9F3B,0x9F4A,0x9F52,0x9F8D,0x9F9C,0x9FA0,
+    0x0020,0x3012,0x5341,0x5344,0x5345,0x304B,0x3099,0x304D,0x3099,0x304F,0x3099,0x3051,
+    0x3099,0x3053,0x3099,0x3055,0x3099,0x3057,0x3099,0x3059,0x3099,0x305B,0x3099,0x305D,
+    0x3099,0x305F,0x3099,0x3061,0x3099,0x3064,0x3099,0x3066,0x3099,0x3068,0x3099,0x306F,
+    0x3099,0x306F,0x309A,0x3072,0x3099,0x3072,0x309A,0x3075,0x3099,0x3075,0x309A,0x3078,
+    0x3099,0x3078,0x309A,0x307B,0x3099,0x307B,0x309A,0x3046,0x3099,0x0020,0x3099,0x0020,
+    0x309A,0x309D,0x3099,0x3088,0x308A,0x30AB,0x3099,0x30AD,0x3099,0x30AF,0x3099,0x30B1,
+    0x3099,0x30B3,0x3099,0x30B5,0x3099,0x30B7,0x3099,0x30B9,0x3099,0x30BB,0x3099,0x30BD,
+    0x3099,0x30BF,0x3099,0x30C1,0x3099,0x30C4,0x3099,0x30C6,0x3099,0x30C8,0x3099,0x30CF,
+    0x3099,0x30CF,0x309A,0x30D2,0x3099,0x30D2,0x309A,0x30D5,0x3099,0x30D5,0x309A,0x30D8,
+    0x3099,0x30D8,0x309A,0x30DB,0x3099,0x30DB,0x309A,0x30A6,0x3099,0x30EF,0x3099,0x30F0,
+    0x3099,0x30F1,0x3099,0x30F2,0x3099,0x30FD,0x3099,0x30B3,0x30C8,0x1100,0x1101,0x11AA,
+    0x1102,0x11AC,0x11AD,0x1103,0x1104,0x1105,0x11B0,0x11B1,0x11B2,0x11B3,0x11B4,0x11B5,
+    0x111A,0x1106,0x1107,0x1108,0x1121,0x1109,0x110A,0x110B,0x110C,0x110D,0x110E,0x110F,
+    0x1110,0x1111,0x1112,0x1161,0x1162,0x1163,0x1164,0x1165,0x1166,0x1167,0x1168,0x1169,
+    0x116A,0x116B,0x116C,0x116D,0x116E,0x116F,0x1170,0x1171,0x1172,0x1173,0x1174,0x1175,
+    0x1160,0x1114,0x1115,0x11C7,0x11C8,0x11CC,0x11CE,0x11D3,0x11D7,0x11D9,0x111C,0x11DD,
+    0x11DF,0x111D,0x111E,0x1120,0x1122,0x1123,0x1127,0x1129,0x112B,0x112C,0x112D,0x112E,
+    0x112F,0x1132,0x1136,0x1140,0x1147,0x114C,0x11F1,0x11F2,0x1157,0x1158,0x1159,0x1184,
+    0x1185,0x1188,0x1191,0x1192,0x1194,0x119E,0x11A1,0x4E00,0x4E8C,0x4E09,0x56DB,0x4E0A,
+    0x4E2D,0x4E0B,0x7532,0x4E59,0x4E19,0x4E01,0x5929,0x5730,0x4EBA,0x0028,0x1100,0x0029,
+    0x0028,0x1102,0x0029,0x0028,0x1103,0x0029,0x0028,0x1105,0x0029,0x0028,0x1106,0x0029,
+    0x0028,0x1107,0x0029,0x0028,0x1109,0x0029,0x0028,0x110B,0x0029,0x0028,0x110C,0x0029,
+    0x0028,0x110E,0x0029,0x0028,0x110F,0x0029,0x0028,0x1110,0x0029,0x0028,0x1111,0x0029,
+    0x0028,0x1112,0x0029,0x0028,0x1100,0x1161,0x0029,0x0028,0x1102,0x1161,0x0029,0x0028,
+    0x1103,0x1161,0x0029,0x0028,0x1105,0x1161,0x0029,0x0028,0x1106,0x1161,0x0029,0x0028,
+    0x1107,0x1161,0x0029,0x0028,0x1109,0x1161,0x0029,0x0028,0x110B,0x1161,0x0029,0x0028,
+    0x110C,0x1161,0x0029,0x0028,0x110E,0x1161,0x0029,0x0028,0x110F,0x1161,0x0029,0x0028,
+    0x1110,0x1161,0x0029,0x0028,0x1111,0x1161,0x0029,0x0028,0x1112,0x1161,0x0029,0x0028,
+    0x110C,0x116E,0x0029,0x0028,0x110B,0x1169,0x110C,0x1165,0x11AB,0x0029,0x0028,0x110B,
+    0x1169,0x1112,0x116E,0x0029,0x0028,0x4E00,0x0029,0x0028,0x4E8C,0x0029,0x0028,0x4E09,
+    0x0029,0x0028,0x56DB,0x0029,0x0028,0x4E94,0x0029,0x0028,0x516D,0x0029,0x0028,0x4E03,
+    0x0029,0x0028,0x516B,0x0029,0x0028,0x4E5D,0x0029,0x0028,0x5341,0x0029,0x0028,0x6708,
+    0x0029,0x0028,0x706B,0x0029,0x0028,0x6C34,0x0029,0x0028,0x6728,0x0029,0x0028,0x91D1,
+    0x0029,0x0028,0x571F,0x0029,0x0028,0x65E5,0x0029,0x0028,0x682A,0x0029,0x0028,0x6709,
+    0x0029,0x0028,0x793E,0x0029,0x0028,0x540D,0x0029,0x0028,0x7279,0x0029,0x0028,0x8CA1,
+    0x0029,0x0028,0x795D,0x0029,0x0028,0x52B4,0x0029,0x0028,0x4EE3,0x0029,0x0028,0x547C,
+    0x0029,0x0028,0x5B66,0x0029,0x0028,0x76E3,0x0029,0x0028,0x4F01,0x0029,0x0028,0x8CC7,
+    0x0029,0x0028,0x5354,0x0029,0x0028,0x796D,0x0029,0x0028,0x4F11,0x0029,0x0028,0x81EA,
+    0x0029,0x0028,0x81F3,0x0029,0x554F,0x5E7C,0x6587,0x7B8F,0x0050,0x0054,0x0045,0x0032,
+    0x0031,0x0032,0x0032,0x0032,0x0033,0x0032,0x0034,0x0032,0x0035,0x0032,0x0036,0x0032,
+    0x0037,0x0032,0x0038,0x0032,0x0039,0x0033,0x0030,0x0033,0x0031,0x0033,0x0032,0x0033,
+    0x0033,0x0033,0x0034,0x0033,0x0035,0x1100,0x1102,0x1103,0x1105,0x1106,0x1107,0x1109,
+    0x110B,0x110C,0x110E,0x110F,0x1110,0x1111,0x1112,0x1100,0x1161,0x1102,0x1161,0x1103,
+    0x1161,0x1105,0x1161,0x1106,0x1161,0x1107,0x1161,0x1109,0x1161,0x110B,0x1161,0x110C,
+    0x1161,0x110E,0x1161,0x110F,0x1161,0x1110,0x1161,0x1111,0x1161,0x1112,0x1161,0x110E,
+    0x1161,0x11B7,0x1100,0x1169,0x110C,0x116E,0x110B,0x1174,0x110B,0x116E,0x4E00,0x4E8C,
+    0x4E09,0x56DB,0x4E94,0x516D,0x4E03,0x516B,0x4E5D,0x5341,0x6708,0x706B,0x6C34,0x6728,
+    0x91D1,0x571F,0x65E5,0x682A,0x6709,0x793E,0x540D,0x7279,0x8CA1,0x795D,0x52B4,0x79D8,
+    0x7537,0x5973,0x9069,0x512A,0x5370,0x6CE8,0x9805,0x4F11,0x5199,0x6B63,0x4E0A,0x4E2D,
+    0x4E0B,0x5DE6,0x53F3,0x533B,0x5B97,0x5B66,0x76E3,0x4F01,0x8CC7,0x5354,0x591C,0x0033,
+    0x0036,0x0033,0x0037,0x0033,0x0038,0x0033,0x0039,0x0034,0x0030,0x0034,0x0031,0x0034,
+    0x0032,0x0034,0x0033,0x0034,0x0034,0x0034,0x0035,0x0034,0x0036,0x0034,0x0037,0x0034,
+    0x0038,0x0034,0x0039,0x0035,0x0030,0x0031,0x6708,0x0032,0x6708,0x0033,0x6708,0x0034,
+    0x6708,0x0035,0x6708,0x0036,0x6708,0x0037,0x6708,0x0038,0x6708,0x0039,0x6708,0x0031,
+    0x0030,0x6708,0x0031,0x0031,0x6708,0x0031,0x0032,0x6708,0x0048,0x0067,0x0065,0x0072,
+    0x0067,0x0065,0x0056,0x004C,0x0054,0x0044,0x30A2,0x30A4,0x30A6,0x30A8,0x30AA,0x30AB,
+    0x30AD,0x30AF,0x30B1,0x30B3,0x30B5,0x30B7,0x30B9,0x30BB,0x30BD,0x30BF,0x30C1,0x30C4,
+    0x30C6,0x30C8,0x30CA,0x30CB,0x30CC,0x30CD,0x30CE,0x30CF,0x30D2,0x30D5,0x30D8,0x30DB,
+    0x30DE,0x30DF,0x30E0,0x30E1,0x30E2,0x30E4,0x30E6,0x30E8,0x30E9,0x30EA,0x30EB,0x30EC,
+    0x30ED,0x30EF,0x30F0,0x30F1,0x30F2,0x4EE4,0x548C,0x30A2,0x30CF,0x309A,0x30FC,0x30C8,
+    0x30A2,0x30EB,0x30D5,0x30A1,0x30A2,0x30F3,0x30D8,0x309A,0x30A2,0x30A2,0x30FC,0x30EB,
+    0x30A4,0x30CB,0x30F3,0x30AF,0x3099,0x30A4,0x30F3,0x30C1,0x30A6,0x30A9,0x30F3,0x30A8,
+    0x30B9,0x30AF,0x30FC,0x30C8,0x3099,0x30A8,0x30FC,0x30AB,0x30FC,0x30AA,0x30F3,0x30B9,
+    0x30AA,0x30FC,0x30E0,0x30AB,0x30A4,0x30EA,0x30AB,0x30E9,0x30C3,0x30C8,0x30AB,0x30ED,
+    0x30EA,0x30FC,0x30AB,0x3099,0x30ED,0x30F3,0x30AB,0x3099,0x30F3,0x30DE,0x30AD,0x3099,
+    0x30AB,0x3099,0x30AD,0x3099,0x30CB,0x30FC,0x30AD,0x30E5,0x30EA,0x30FC,0x30AD,0x3099,
+    0x30EB,0x30BF,0x3099,0x30FC,0x30AD,0x30ED,0x30AD,0x30ED,0x30AF,0x3099,0x30E9,0x30E0,
+    0x30AD,0x30ED,0x30E1,0x30FC,0x30C8,0x30EB,0x30AD,0x30ED,0x30EF,0x30C3,0x30C8,0x30AF,
+    0x3099,0x30E9,0x30E0,0x30AF,0x3099,0x30E9,0x30E0,0x30C8,0x30F3,0x30AF,0x30EB,0x30BB,
+    0x3099,0x30A4,0x30ED,0x30AF,0x30ED,0x30FC,0x30CD,0x30B1,0x30FC,0x30B9,0x30B3,0x30EB,
+    0x30CA,0x30B3,0x30FC,0x30DB,0x309A,0x30B5,0x30A4,0x30AF,0x30EB,0x30B5,0x30F3,0x30C1,
+    0x30FC,0x30E0,0x30B7,0x30EA,0x30F3,0x30AF,0x3099,0x30BB,0x30F3,0x30C1,0x30BB,0x30F3,
+    0x30C8,0x30BF,0x3099,0x30FC,0x30B9,0x30C6,0x3099,0x30B7,0x30C8,0x3099,0x30EB,0x30C8,
+    0x30F3,0x30CA,0x30CE,0x30CE,0x30C3,0x30C8,0x30CF,0x30A4,0x30C4,0x30CF,0x309A,0x30FC,
+    0x30BB,0x30F3,0x30C8,0x30CF,0x309A,0x30FC,0x30C4,0x30CF,0x3099,0x30FC,0x30EC,0x30EB,
+    0x30D2,0x309A,0x30A2,0x30B9,0x30C8,0x30EB,0x30D2,0x309A,0x30AF,0x30EB,0x30D2,0x309A,
+    0x30B3,0x30D2,0x3099,0x30EB,0x30D5,0x30A1,0x30E9,0x30C3,0x30C8,0x3099,0x30D5,0x30A3,
+    0x30FC,0x30C8,0x30D5,0x3099,0x30C3,0x30B7,0x30A7,0x30EB,0x30D5,0x30E9,0x30F3,0x30D8,
+    0x30AF,0x30BF,0x30FC,0x30EB,0x30D8,0x309A,0x30BD,0x30D8,0x309A,0x30CB,0x30D2,0x30D8,
+    0x30EB,0x30C4,0x30D8,0x309A,0x30F3,0x30B9,0x30D8,0x309A,0x30FC,0x30B7,0x3099,0x30D8,
+    0x3099,0x30FC,0x30BF,0x30DB,0x309A,0x30A4,0x30F3,0x30C8,0x30DB,0x3099,0x30EB,0x30C8,
+    0x30DB,0x30F3,0x30DB,0x309A,0x30F3,0x30C8,0x3099,0x30DB,0x30FC,0x30EB,0x30DB,0x30FC,
+    0x30F3,0x30DE,0x30A4,0x30AF,0x30ED,0x30DE,0x30A4,0x30EB,0x30DE,0x30C3,0x30CF,0x30DE,
+    0x30EB,0x30AF,0x30DE,0x30F3,0x30B7,0x30E7,0x30F3,0x30DF,0x30AF,0x30ED,0x30F3,0x30DF,
+    0x30EA,0x30DF,0x30EA,0x30CF,0x3099,0x30FC,0x30EB,0x30E1,0x30AB,0x3099,0x30E1,0x30AB,
+    0x3099,0x30C8,0x30F3,0x30E1,0x30FC,0x30C8,0x30EB,0x30E4,0x30FC,0x30C8,0x3099,0x30E4,
+    0x30FC,0x30EB,0x30E6,0x30A2,0x30F3,0x30EA,0x30C3,0x30C8,0x30EB,0x30EA,0x30E9,0x30EB,
+    0x30D2,0x309A,0x30FC,0x30EB,0x30FC,0x30D5,0x3099,0x30EB,0x30EC,0x30E0,0x30EC,0x30F3,
+    0x30C8,0x30B1,0x3099,0x30F3,0x30EF,0x30C3,0x30C8,0x0030,0x70B9,0x0031,0x70B9,0x0032,
+    0x70B9,0x0033,0x70B9,0x0034,0x70B9,0x0035,0x70B9,0x0036,0x70B9,0x0037,0x70B9,0x0038,
+    0x70B9,0x0039,0x70B9,0x0031,0x0030,0x70B9,0x0031,0x0031,0x70B9,0x0031,0x0032,0x70B9,
+    0x0031,0x0033,0x70B9,0x0031,0x0034,0x70B9,0x0031,0x0035,0x70B9,0x0031,0x0036,0x70B9,
+    0x0031,0x0037,0x70B9,0x0031,0x0038,0x70B9,0x0031,0x0039,0x70B9,0x0032,0x0030,0x70B9,
+    0x0032,0x0031,0x70B9,0x0032,0x0032,0x70B9,0x0032,0x0033,0x70B9,0x0032,0x0034,0x70B9,
+    0x0068,0x0050,0x0061,0x0064,0x0061,0x0041,0x0055,0x0062,0x0061,0x0072,0x006F,0x0056,
+    0x0070,0x0063,0x0064,0x006D,0x0064,0x006D,0x0032,0x0064,0x006D,0x0033,0x0049,0x0055,
+    0x5E73,0x6210,0x662D,0x548C,0x5927,0x6B63,0x660E,0x6CBB,0x682A,0x5F0F,0x4F1A,0x793E,
+    0x0070,0x0041,0x006E,0x0041,0x03BC,0x0041,0x006D,0x0041,0x006B,0x0041,0x004B,0x0042,
+    0x004D,0x0042,0x0047,0x0042,0x0063,0x0061,0x006C,0x006B,0x0063,0x0061,0x006C,0x0070,
+    0x0046,0x006E,0x0046,0x03BC,0x0046,0x03BC,0x0067,0x006D,0x0067,0x006B,0x0067,0x0048,
+    0x007A,0x006B,0x0048,0x007A,0x004D,0x0048,0x007A,0x0047,0x0048,0x007A,0x0054,0x0048,
+    0x007A,0x03BC,0x006C,0x006D,0x006C,0x0064,0x006C,0x006B,0x006C,0x0066,0x006D,0x006E,
+    0x006D,0x03BC,0x006D,0x006D,0x006D,0x0063,0x006D,0x006B,0x006D,0x006D,0x006D,0x0032,
+    0x0063,0x006D,0x0032,0x006D,0x0032,0x006B,0x006D,0x0032,0x006D,0x006D,0x0033,0x0063,
+    0x006D,0x0033,0x006D,0x0033,0x006B,0x006D,0x0033,0x006D,0x2215,0x0073,0x006D,0x2215,
+    0x0073,0x0032,0x0050,0x0061,0x006B,0x0050,0x0061,0x004D,0x0050,0x0061,0x0047,0x0050,
+    0x0061,0x0072,0x0061,0x0064,0x0072,0x0061,0x0064,0x2215,0x0073,0x0072,0x0061,0x0064,
+    0x2215,0x0073,0x0032,0x0070,0x0073,0x006E,0x0073,0x03BC,0x0073,0x006D,0x0073,0x0070,
+    0x0056,0x006E,0x0056,0x03BC,0x0056,0x006D,0x0056,0x006B,0x0056,0x004D,0x0056,0x0070,
+    0x0057,0x006E,0x0057,0x03BC,0x0057,0x006D,0x0057,0x006B,0x0057,0x004D,0x0057,0x006B,
+    0x03A9,0x004D,0x03A9,0x0061,0x002E,0x006D,0x002E,0x0042,0x0071,0x0063,0x0063,0x0063,
+    0x0064,0x0043,0x2215,0x006B,0x0067,0x0043,0x006F,0x002E,0x0064,0x0042,0x0047,0x0079,
+    0x0068,0x0061,0x0048,0x0050,0x0069,0x006E,0x004B,0x004B,0x004B,0x004D,0x006B,0x0074,
+    0x006C,0x006D,0x006C,0x006E,0x006C,0x006F,0x0067,0x006C,0x0078,0x006D,0x0062,0x006D,
+    0x0069,0x006C,0x006D,0x006F,0x006C,0x0050,0x0048,0x0070,0x002E,0x006D,0x002E,0x0050,
+    0x0050,0x004D,0x0050,0x0052,0x0073,0x0072,0x0053,0x0076,0x0057,0x0062,0x0056,0x2215,
+    0x006D,0x0041,0x2215,0x006D,0x0031,0x65E5,0x0032,0x65E5,0x0033,0x65E5,0x0034,0x65E5,
+    0x0035,0x65E5,0x0036,0x65E5,0x0037,0x65E5,0x0038,0x65E5,0x0039,0x65E5,0x0031,0x0030,
+    0x65E5,0x0031,0x0031,0x65E5,0x0031,0x0032,0x65E5,0x0031,0x0033,0x65E5,0x0031,0x0034,
+    0x65E5,0x0031,0x0035,0x65E5,0x0031,0x0036,0x65E5,0x0031,0x0037,0x65E5,0x0031,0x0038,
+    0x65E5,0x0031,0x0039,0x65E5,0x0032,0x0030,0x65E5,0x0032,0x0031,0x65E5,0x0032,0x0032,
+    0x65E5,0x0032,0x0033,0x65E5,0x0032,0x0034,0x65E5,0x0032,0x0035,0x65E5,0x0032,0x0036,
+    0x65E5,0x0032,0x0037,0x65E5,0x0032,0x0038,0x65E5,0x0032,0x0039,0x65E5,0x0033,0x0030,
+    0x65E5,0x0033,0x0031,0x65E5,0x0067,0x0061,0x006C,0x044A,0x044C,0xA76F,0x0043,0x0046,
+    0x0051,0x0126,0x0153,0xA727,0xAB37,0x026B,0xAB52,0x028D,0x8C48,0x66F4,0x8ECA,0x8CC8,
+    0x6ED1,0x4E32,0x53E5,0x9F9C,0x9F9C,0x5951,0x91D1,0x5587,0x5948,0x61F6,0x7669,0x7F85,
+    0x863F,0x87BA,0x88F8,0x908F,0x6A02,0x6D1B,0x70D9,0x73DE,0x843D,0x916A,0x99F1,0x4E82,
+    0x5375,0x6B04,0x721B,0x862D,0x9E1E,0x5D50,0x6FEB,0x85CD,0x8964,0x62C9,0x81D8,0x881F,
+    0x5ECA,0x6717,0x6D6A,0x72FC,0x90CE,0x4F86,0x51B7,0x52DE,0x64C4,0x6AD3,0x7210,0x76E7,
+    0x8001,0x8606,0x865C,0x8DEF,0x9732,0x9B6F,0x9DFA,0x788C,0x797F,0x7DA0,0x83C9,0x9304,
+    0x9E7F,0x8AD6,0x58DF,0x5F04,0x7C60,0x807E,0x7262,0x78CA,0x8CC2,0x96F7,0x58D8,0x5C62,
+    0x6A13,0x6DDA,0x6F0F,0x7D2F,0x7E37,0x964B,0x52D2,0x808B,0x51DC,0x51CC,0x7A1C,0x7DBE,
+    0x83F1,0x9675,0x8B80,0x62CF,0x6A02,0x8AFE,0x4E39,0x5BE7,0x6012,0x7387,0x7570,0x5317,
+    0x78FB,0x4FBF,0x5FA9,0x4E0D,0x6CCC,0x6578,0x7D22,0x53C3,0x585E,0x7701,0x8449,0x8AAA,
+    0x6BBA,0x8FB0,0x6C88,0x62FE,0x82E5,0x63A0,0x7565,0x4EAE,0x5169,0x51C9,0x6881,0x7CE7,
+    0x826F,0x8AD2,0x91CF,0x52F5,0x5442,0x5973,0x5EEC,0x65C5,0x6FFE,0x792A,0x95AD,0x9A6A,
+    0x9E97,0x9ECE,0x529B,0x66C6,0x6B77,0x8F62,0x5E74,0x6190,0x6200,0x649A,0x6F23,0x7149,
+    0x7489,0x79CA,0x7DF4,0x806F,0x8F26,0x84EE,0x9023,0x934A,0x5217,0x52A3,0x54BD,0x70C8,
+    0x88C2,0x8AAA,0x5EC9,0x5FF5,0x637B,0x6BAE,0x7C3E,0x7375,0x4EE4,0x56F9,0x5BE7,0x5DBA,
+    0x601C,0x73B2,0x7469,0x7F9A,0x8046,0x9234,0x96F6,0x9748,0x9818,0x4F8B,0x79AE,0x91B4,
+    0x96B8,0x60E1,0x4E86,0x50DA,0x5BEE,0x5C3F,0x6599,0x6A02,0x71CE,0x7642,0x84FC,0x907C,
+    0x9F8D,0x6688,0x962E,0x5289,0x677B,0x67F3,0x6D41,0x6E9C,0x7409,0x7559,0x786B,0x7D10,
+    0x985E,0x516D,0x622E,0x9678,0x502B,0x5D19,0x6DEA,0x8F2A,0x5F8B,0x6144,0x6817,0x7387,
+    0x9686,0x5229,0x540F,0x5C65,0x6613,0x674E,0x68A8,0x6CE5,0x7406,0x75E2,0x7F79,0x88CF,
+    0x88E1,0x91CC,0x96E2,0x533F,0x6EBA,0x541D,0x71D0,0x7498,0x85FA,0x96A3,0x9C57,0x9E9F,
+    0x6797,0x6DCB,0x81E8,0x7ACB,0x7B20,0x7C92,0x72C0,0x7099,0x8B58,0x4EC0,0x8336,0x523A,
+    0x5207,0x5EA6,0x62D3,0x7CD6,0x5B85,0x6D1E,0x66B4,0x8F3B,0x884C,0x964D,0x898B,0x5ED3,
+    0x5140,0x55C0,0x585A,0x6674,0x51DE,0x732A,0x76CA,0x793C,0x795E,0x7965,0x798F,0x9756,
+    0x7CBE,0x7FBD,0x8612,0x8AF8,0x9038,0x90FD,0x98EF,0x98FC,0x9928,0x9DB4,0x90DE,0x96B7,
+    0x4FAE,0x50E7,0x514D,0x52C9,0x52E4,0x5351,0x559D,0x5606,0x5668,0x5840,0x58A8,0x5C64,
+    0x5C6E,0x6094,0x6168,0x618E,0x61F2,0x654F,0x65E2,0x6691,0x6885,0x6D77,0x6E1A,0x6F22,
+    0x716E,0x722B,0x7422,0x7891,0x793E,0x7949,0x7948,0x7950,0x7956,0x795D,0x798D,0x798E,
+    0x7A40,0x7A81,0x7BC0,0x7DF4,0x7E09,0x7E41,0x7F72,0x8005,0x81ED,0x8279,0x8279,0x8457,
+    0x8910,0x8996,0x8B01,0x8B39,0x8CD3,0x8D08,0x8FB6,0x9038,0x96E3,0x97FF,0x983B,0x6075,
+    0x242EE,0x8218,0x4E26,0x51B5,0x5168,0x4F80,0x5145,0x5180,0x52C7,0x52FA,0x559D,0x5555,
+    0x5599,0x55E2,0x585A,0x58B3,0x5944,0x5954,0x5A62,0x5B28,0x5ED2,0x5ED9,0x5F69,0x5FAD,
+    0x60D8,0x614E,0x6108,0x618E,0x6160,0x61F2,0x6234,0x63C4,0x641C,0x6452,0x6556,0x6674,
+    0x6717,0x671B,0x6756,0x6B79,0x6BBA,0x6D41,0x6EDB,0x6ECB,0x6F22,0x701E,0x716E,0x77A7,
+    0x7235,0x72AF,0x732A,0x7471,0x7506,0x753B,0x761D,0x761F,0x76CA,0x76DB,0x76F4,0x774A,
+    0x7740,0x78CC,0x7AB1,0x7BC0,0x7C7B,0x7D5B,0x7DF4,0x7F3E,0x8005,0x8352,0x83EF,0x8779,
+    0x8941,0x8986,0x8996,0x8ABF,0x8AF8,0x8ACB,0x8B01,0x8AFE,0x8AED,0x8B39,0x8B8A,0x8D08,
+    0x8F38,0x9072,0x9199,0x9276,0x967C,0x96E3,0x9756,0x97DB,0x97FF,0x980B,0x983B,0x9B12,
+    0x9F9C,0x2284A,0x22844,0x233D5,0x3B9D,0x4018,0x4039,0x25249,0x25CD0,0x27ED3,0x9F43,0x9F8E,
+    0x0066,0x0066,0x0066,0x0069,0x0066,0x006C,0x0066,0x0066,0x0069,0x0066,0x0066,0x006C,
+    0x0073,0x0074,0x0073,0x0074,0x0574,0x0576,0x0574,0x0565,0x0574,0x056B,0x057E,0x0576,
+    0x0574,0x056D,0x05D9,0x05B4,0x05F2,0x05B7,0x05E2,0x05D0,0x05D3,0x05D4,0x05DB,0x05DC,
+    0x05DD,0x05E8,0x05EA,0x002B,0x05E9,0x05C1,0x05E9,0x05C2,0x05E9,0x05BC,0x05C1,0x05E9,
+    0x05BC,0x05C2,0x05D0,0x05B7,0x05D0,0x05B8,0x05D0,0x05BC,0x05D1,0x05BC,0x05D2,0x05BC,
+    0x05D3,0x05BC,0x05D4,0x05BC,0x05D5,0x05BC,0x05D6,0x05BC,0x05D8,0x05BC,0x05D9,0x05BC,
+    0x05DA,0x05BC,0x05DB,0x05BC,0x05DC,0x05BC,0x05DE,0x05BC,0x05E0,0x05BC,0x05E1,0x05BC,
+    0x05E3,0x05BC,0x05E4,0x05BC,0x05E6,0x05BC,0x05E7,0x05BC,0x05E8,0x05BC,0x05E9,0x05BC,
+    0x05EA,0x05BC,0x05D5,0x05B9,0x05D1,0x05BF,0x05DB,0x05BF,0x05E4,0x05BF,0x05D0,0x05DC,
+    0x0671,0x0671,0x067B,0x067B,0x067B,0x067B,0x067E,0x067E,0x067E,0x067E,0x0680,0x0680,
+    0x0680,0x0680,0x067A,0x067A,0x067A,0x067A,0x067F,0x067F,0x067F,0x067F,0x0679,0x0679,
+    0x0679,0x0679,0x06A4,0x06A4,0x06A4,0x06A4,0x06A6,0x06A6,0x06A6,0x06A6,0x0684,0x0684,
+    0x0684,0x0684,0x0683,0x0683,0x0683,0x0683,0x0686,0x0686,0x0686,0x0686,0x0687,0x0687,
+    0x0687,0x0687,0x068D,0x068D,0x068C,0x068C,0x068E,0x068E,0x0688,0x0688,0x0698,0x0698,
+    0x0691,0x0691,0x06A9,0x06A9,0x06A9,0x06A9,0x06AF,0x06AF,0x06AF,0x06AF,0x06B3,0x06B3,
+    0x06B3,0x06B3,0x06B1,0x06B1,0x06B1,0x06B1,0x06BA,0x06BA,0x06BB,0x06BB,0x06BB,0x06BB,
+    0x06D5,0x0654,0x06D5,0x0654,0x06C1,0x06C1,0x06C1,0x06C1,0x06BE,0x06BE,0x06BE,0x06BE,
+    0x06D2,0x06D2,0x06D2,0x0654,0x06D2,0x0654,0x06AD,0x06AD,0x06AD,0x06AD,0x06C7,0x06C7,
+    0x06C6,0x06C6,0x06C8,0x06C8,0x06C7,0x0674,0x06CB,0x06CB,0x06C5,0x06C5,0x06C9,0x06C9,
+    0x06D0,0x06D0,0x06D0,0x06D0,0x0649,0x0649,0x064A,0x0654,0x0627,0x064A,0x0654,0x0627,
+    0x064A,0x0654,0x06D5,0x064A,0x0654,0x06D5,0x064A,0x0654,0x0648,0x064A,0x0654,0x0648,
+    0x064A,0x0654,0x06C7,0x064A,0x0654,0x06C7,0x064A,0x0654,0x06C6,0x064A,0x0654,0x06C6,
+    0x064A,0x0654,0x06C8,0x064A,0x0654,0x06C8,0x064A,0x0654,0x06D0,0x064A,0x0654,0x06D0,
+    0x064A,0x0654,0x06D0,0x064A,0x0654,0x0649,0x064A,0x0654,0x0649,0x064A,0x0654,0x0649,
+    0x06CC,0x06CC,0x06CC,0x06CC,0x064A,0x0654,0x062C,0x064A,0x0654,0x062D,0x064A,0x0654,
+    0x0645,0x064A,0x0654,0x0649,0x064A,0x0654,0x064A,0x0628,0x062C,0x0628,0x062D,0x0628,
+    0x062E,0x0628,0x0645,0x0628,0x0649,0x0628,0x064A,0x062A,0x062C,0x062A,0x062D,0x062A,
+    0x062E,0x062A,0x0645,0x062A,0x0649,0x062A,0x064A,0x062B,0x062C,0x062B,0x0645,0x062B,
+    0x0649,0x062B,0x064A,0x062C,0x062D,0x062C,0x0645,0x062D,0x062C,0x062D,0x0645,0x062E,
+    0x062C,0x062E,0x062D,0x062E,0x0645,0x0633,0x062C,0x0633,0x062D,0x0633,0x062E,0x0633,
+    0x0645,0x0635,0x062D,0x0635,0x0645,0x0636,0x062C,0x0636,0x062D,0x0636,0x062E,0x0636,
+    0x0645,0x0637,0x062D,0x0637,0x0645,0x0638,0x0645,0x0639,0x062C,0x0639,0x0645,0x063A,
+    0x062C,0x063A,0x0645,0x0641,0x062C,0x0641,0x062D,0x0641,0x062E,0x0641,0x0645,0x0641,
+    0x0649,0x0641,0x064A,0x0642,0x062D,0x0642,0x0645,0x0642,0x0649,0x0642,0x064A,0x0643,
+    0x0627,0x0643,0x062C,0x0643,0x062D,0x0643,0x062E,0x0643,0x0644,0x0643,0x0645,0x0643,
+    0x0649,0x0643,0x064A,0x0644,0x062C,0x0644,0x062D,0x0644,0x062E,0x0644,0x0645,0x0644,
+    0x0649,0x0644,0x064A,0x0645,0x062C,0x0645,0x062D,0x0645,0x062E,0x0645,0x0645,0x0645,
+    0x0649,0x0645,0x064A,0x0646,0x062C,0x0646,0x062D,0x0646,0x062E,0x0646,0x0645,0x0646,
+    0x0649,0x0646,0x064A,0x0647,0x062C,0x0647,0x0645,0x0647,0x0649,0x0647,0x064A,0x064A,
+    0x062C,0x064A,0x062D,0x064A,0x062E,0x064A,0x0645,0x064A,0x0649,0x064A,0x064A,0x0630,
+    0x0670,0x0631,0x0670,0x0649,0x0670,0x0020,0x064C,0x0651,0x0020,0x064D,0x0651,0x0020,
+    0x064E,0x0651,0x0020,0x064F,0x0651,0x0020,0x0650,0x0651,0x0020,0x0651,0x0670,0x064A,
+    0x0654,0x0631,0x064A,0x0654,0x0632,0x064A,0x0654,0x0645,0x064A,0x0654,0x0646,0x064A,
+    0x0654,0x0649,0x064A,0x0654,0x064A,0x0628,0x0631,0x0628,0x0632,0x0628,0x0645,0x0628,
+    0x0646,0x0628,0x0649,0x0628,0x064A,0x062A,0x0631,0x062A,0x0632,0x062A,0x0645,0x062A,
+    0x0646,0x062A,0x0649,0x062A,0x064A,0x062B,0x0631,0x062B,0x0632,0x062B,0x0645,0x062B,
+    0x0646,0x062B,0x0649,0x062B,0x064A,0x0641,0x0649,0x0641,0x064A,0x0642,0x0649,0x0642,
+    0x064A,0x0643,0x0627,0x0643,0x0644,0x0643,0x0645,0x0643,0x0649,0x0643,0x064A,0x0644,
+    0x0645,0x0644,0x0649,0x0644,0x064A,0x0645,0x0627,0x0645,0x0645,0x0646,0x0631,0x0646,
+    0x0632,0x0646,0x0645,0x0646,0x0646,0x0646,0x0649,0x0646,0x064A,0x0649,0x0670,0x064A,
+    0x0631,0x064A,0x0632,0x064A,0x0645,0x064A,0x0646,0x064A,0x0649,0x064A,0x064A,0x064A,
+    0x0654,0x062C,0x064A,0x0654,0x062D,0x064A,0x0654,0x062E,0x064A,0x0654,0x0645,0x064A,
+    0x0654,0x0647,0x0628,0x062C,0x0628,0x062D,0x0628,0x062E,0x0628,0x0645,0x0628,0x0647,
+    0x062A,0x062C,0x062A,0x062D,0x062A,0x062E,0x062A,0x0645,0x062A,0x0647,0x062B,0x0645,
+    0x062C,0x062D,0x062C,0x0645,0x062D,0x062C,0x062D,0x0645,0x062E,0x062C,0x062E,0x0645,
+    0x0633,0x062C,0x0633,0x062D,0x0633,0x062E,0x0633,0x0645,0x0635,0x062D,0x0635,0x062E,
+    0x0635,0x0645,0x0636,0x062C,0x0636,0x062D,0x0636,0x062E,0x0636,0x0645,0x0637,0x062D,
+    0x0638,0x0645,0x0639,0x062C,0x0639,0x0645,0x063A,0x062C,0x063A,0x0645,0x0641,0x062C,
+    0x0641,0x062D,0x0641,0x062E,0x0641,0x0645,0x0642,0x062D,0x0642,0x0645,0x0643,0x062C,
+    0x0643,0x062D,0x0643,0x062E,0x0643,0x0644,0x0643,0x0645,0x0644,0x062C,0x0644,0x062D,
+    0x0644,0x062E,0x0644,0x0645,0x0644,0x0647,0x0645,0x062C,0x0645,0x062D,0x0645,0x062E,
+    0x0645,0x0645,0x0646,0x062C,0x0646,0x062D,0x0646,0x062E,0x0646,0x0645,0x0646,0x0647,
+    0x0647,0x062C,0x0647,0x0645,0x0647,0x0670,0x064A,0x062C,0x064A,0x062D,0x064A,0x062E,
+    0x064A,0x0645,0x064A,0x0647,0x064A,0x0654,0x0645,0x064A,0x0654,0x0647,0x0628,0x0645,
+    0x0628,0x0647,0x062A,0x0645,0x062A,0x0647,0x062B,0x0645,0x062B,0x0647,0x0633,0x0645,
+    0x0633,0x0647,0x0634,0x0645,0x0634,0x0647,0x0643,0x0644,0x0643,0x0645,0x0644,0x0645,
+    0x0646,0x0645,0x0646,0x0647,0x064A,0x0645,0x064A,0x0647,0x0640,0x064E,0x0651,0x0640,
+    0x064F,0x0651,0x0640,0x0650,0x0651,0x0637,0x0649,0x0637,0x064A,0x0639,0x0649,0x0639,
+    0x064A,0x063A,0x0649,0x063A,0x064A,0x0633,0x0649,0x0633,0x064A,0x0634,0x0649,0x0634,
+    0x064A,0x062D,0x0649,0x062D,0x064A,0x062C,0x0649,0x062C,0x064A,0x062E,0x0649,0x062E,
+    0x064A,0x0635,0x0649,0x0635,0x064A,0x0636,0x0649,0x0636,0x064A,0x0634,0x062C,0x0634,
+    0x062D,0x0634,0x062E,0x0634,0x0645,0x0634,0x0631,0x0633,0x0631,0x0635,0x0631,0x0636,
+    0x0631,0x0637,0x0649,0x0637,0x064A,0x0639,0x0649,0x0639,0x064A,0x063A,0x0649,0x063A,
+    0x064A,0x0633,0x0649,0x0633,0x064A,0x0634,0x0649,0x0634,0x064A,0x062D,0x0649,0x062D,
+    0x064A,0x062C,0x0649,0x062C,0x064A,0x062E,0x0649,0x062E,0x064A,0x0635,0x0649,0x0635,
+    0x064A,0x0636,0x0649,0x0636,0x064A,0x0634,0x062C,0x0634,0x062D,0x0634,0x062E,0x0634,
+    0x0645,0x0634,0x0631,0x0633,0x0631,0x0635,0x0631,0x0636,0x0631,0x0634,0x062C,0x0634,
+    0x062D,0x0634,0x062E,0x0634,0x0645,0x0633,0x0647,0x0634,0x0647,0x0637,0x0645,0x0633,
+    0x062C,0x0633,0x062D,0x0633,0x062E,0x0634,0x062C,0x0634,0x062D,0x0634,0x062E,0x0637,
+    0x0645,0x0638,0x0645,0x0627,0x064B,0x0627,0x064B,0x062A,0x062C,0x0645,0x062A,0x062D,
+    0x062C,0x062A,0x062D,0x062C,0x062A,0x062D,0x0645,0x062A,0x062E,0x0645,0x062A,0x0645,
+    0x062C,0x062A,0x0645,0x062D,0x062A,0x0645,0x062E,0x062C,0x0645,0x062D,0x062C,0x0645,
+    0x062D,0x062D,0x0645,0x064A,0x062D,0x0645,0x0649,0x0633,0x062D,0x062C,0x0633,0x062C,
+    0x062D,0x0633,0x062C,0x0649,0x0633,0x0645,0x062D,0x0633,0x0645,0x062D,0x0633,0x0645,
+    0x062C,0x0633,0x0645,0x0645,0x0633,0x0645,0x0645,0x0635,0x062D,0x062D,0x0635,0x062D,
+    0x062D,0x0635,0x0645,0x0645,0x0634,0x062D,0x0645,0x0634,0x062D,0x0645,0x0634,0x062C,
+    0x064A,0x0634,0x0645,0x062E,0x0634,0x0645,0x062E,0x0634,0x0645,0x0645,0x0634,0x0645,
+    0x0645,0x0636,0x062D,0x0649,0x0636,0x062E,0x0645,0x0636,0x062E,0x0645,0x0637,0x0645,
+    0x062D,0x0637,0x0645,0x062D,0x0637,0x0645,0x0645,0x0637,0x0645,0x064A,0x0639,0x062C,
+    0x0645,0x0639,0x0645,0x0645,0x0639,0x0645,0x0645,0x0639,0x0645,0x0649,0x063A,0x0645,
+    0x0645,0x063A,0x0645,0x064A,0x063A,0x0645,0x0649,0x0641,0x062E,0x0645,0x0641,0x062E,
+    0x0645,0x0642,0x0645,0x062D,0x0642,0x0645,0x0645,0x0644,0x062D,0x0645,0x0644,0x062D,
+    0x064A,0x0644,0x062D,0x0649,0x0644,0x062C,0x062C,0x0644,0x062C,0x062C,0x0644,0x062E,
+    0x0645,0x0644,0x062E,0x0645,0x0644,0x0645,0x062D,0x0644,0x0645,0x062D,0x0645,0x062D,
+    0x062C,0x0645,0x062D,0x0645,0x0645,0x062D,0x064A,0x0645,0x062C,0x062D,0x0645,0x062C,
+    0x0645,0x0645,0x062E,0x062C,0x0645,0x062E,0x0645,0x0645,0x062C,0x062E,0x0647,0x0645,
+    0x062C,0x0647,0x0645,0x0645,0x0646,0x062D,0x0645,0x0646,0x062D,0x0649,0x0646,0x062C,
+    0x0645,0x0646,0x062C,0x0645,0x0646,0x062C,0x0649,0x0646,0x0645,0x064A,0x0646,0x0645,
+    0x0649,0x064A,0x0645,0x0645,0x064A,0x0645,0x0645,0x0628,0x062E,0x064A,0x062A,0x062C,
+    0x064A,0x062A,0x062C,0x0649,0x062A,0x062E,0x064A,0x062A,0x062E,0x0649,0x062A,0x0645,
+    0x064A,0x062A,0x0645,0x0649,0x062C,0x0645,0x064A,0x062C,0x062D,0x0649,0x062C,0x0645,
+    0x0649,0x0633,0x062E,0x0649,0x0635,0x062D,0x064A,0x0634,0x062D,0x064A,0x0636,0x062D,
+    0x064A,0x0644,0x062C,0x064A,0x0644,0x0645,0x064A,0x064A,0x062D,0x064A,0x064A,0x062C,
+    0x064A,0x064A,0x0645,0x064A,0x0645,0x0645,0x064A,0x0642,0x0645,0x064A,0x0646,0x062D,
+    0x064A,0x0642,0x0645,0x062D,0x0644,0x062D,0x0645,0x0639,0x0645,0x064A,0x0643,0x0645,
+    0x064A,0x0646,0x062C,0x062D,0x0645,0x062E,0x064A,0x0644,0x062C,0x0645,0x0643,0x0645,
+    0x0645,0x0644,0x062C,0x0645,0x0646,0x062C,0x062D,0x062C,0x062D,0x064A,0x062D,0x062C,
+    0x064A,0x0645,0x062C,0x064A,0x0641,0x0645,0x064A,0x0628,0x062D,0x064A,0x0643,0x0645,
+    0x0645,0x0639,0x062C,0x0645,0x0635,0x0645,0x0645,0x0633,0x062E,0x064A,0x0646,0x062C,
+    0x064A,0x0635,0x0644,0x06D2,0x0642,0x0644,0x06D2,0x0627,0x0644,0x0644,0x0647,0x0627,
+    0x0643,0x0628,0x0631,0x0645,0x062D,0x0645,0x062F,0x0635,0x0644,0x0639,0x0645,0x0631,
+    0x0633,0x0648,0x0644,0x0639,0x0644,0x064A,0x0647,0x0648,0x0633,0x0644,0x0645,0x0635,
+    0x0644,0x0649,0x0635,0x0644,0x0649,0x0020,0x0627,0x0644,0x0644,0x0647,0x0020,0x0639,
+    0x0644,0x064A,0x0647,0x0020,0x0648,0x0633,0x0644,0x0645,0x062C,0x0644,0x0020,0x062C,
+    0x0644,0x0627,0x0644,0x0647,0x0631,0x06CC,0x0627,0x0644,0x002C,0x3001,0x3002,0x003A,
+    0x003B,0x0021,0x003F,0x3016,0x3017,0x002E,0x002E,0x002E,0x002E,0x002E,0x2014,0x2013,
+    0x005F,0x005F,0x0028,0x0029,0x007B,0x007D,0x3014,0x3015,0x3010,0x3011,0x300A,0x300B,
+    0x3008,0x3009,0x300C,0x300D,0x300E,0x300F,0x005B,0x005D,0x0020,0x0305,0x0020,0x0305,
+    0x0020,0x0305,0x0020,0x0305,0x005F,0x005F,0x005F,0x002C,0x3001,0x002E,0x003B,0x003A,
+    0x003F,0x0021,0x2014,0x0028,0x0029,0x007B,0x007D,0x3014,0x3015,0x0023,0x0026,0x002A,
+    0x002B,0x002D,0x003C,0x003E,0x003D,0x005C,0x0024,0x0025,0x0040,0x0020,0x064B,0x0640,
+    0x064B,0x0020,0x064C,0x0020,0x064D,0x0020,0x064E,0x0640,0x064E,0x0020,0x064F,0x0640,
+    0x064F,0x0020,0x0650,0x0640,0x0650,0x0020,0x0651,0x0640,0x0651,0x0020,0x0652,0x0640,
+    0x0652,0x0621,0x0627,0x0653,0x0627,0x0653,0x0627,0x0654,0x0627,0x0654,0x0648,0x0654,
+    0x0648,0x0654,0x0627,0x0655,0x0627,0x0655,0x064A,0x0654,0x064A,0x0654,0x064A,0x0654,
+    0x064A,0x0654,0x0627,0x0627,0x0628,0x0628,0x0628,0x0628,0x0629,0x0629,0x062A,0x062A,
+    0x062A,0x062A,0x062B,0x062B,0x062B,0x062B,0x062C,0x062C,0x062C,0x062C,0x062D,0x062D,
+    0x062D,0x062D,0x062E,0x062E,0x062E,0x062E,0x062F,0x062F,0x0630,0x0630,0x0631,0x0631,
+    0x0632,0x0632,0x0633,0x0633,0x0633,0x0633,0x0634,0x0634,0x0634,0x0634,0x0635,0x0635,
+    0x0635,0x0635,0x0636,0x0636,0x0636,0x0636,0x0637,0x0637,0x0637,0x0637,0x0638,0x0638,
+    0x0638,0x0638,0x0639,0x0639,0x0639,0x0639,0x063A,0x063A,0x063A,0x063A,0x0641,0x0641,
+    0x0641,0x0641,0x0642,0x0642,0x0642,0x0642,0x0643,0x0643,0x0643,0x0643,0x0644,0x0644,
+    0x0644,0x0644,0x0645,0x0645,0x0645,0x0645,0x0646,0x0646,0x0646,0x0646,0x0647,0x0647,
+    0x0647,0x0647,0x0648,0x0648,0x0649,0x0649,0x064A,0x064A,0x064A,0x064A,0x0644,0x0627,
+    0x0653,0x0644,0x0627,0x0653,0x0644,0x0627,0x0654,0x0644,0x0627,0x0654,0x0644,0x0627,
+    0x0655,0x0644,0x0627,0x0655,0x0644,0x0627,0x0644,0x0627,0x0021,0x0022,0x0023,0x0024,
+    0x0025,0x0026,0x0027,0x0028,0x0029,0x002A,0x002B,0x002C,0x002D,0x002E,0x002F,0x0030,
+    0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x003A,0x003B,0x003C,
+    0x003D,0x003E,0x003F,0x0040,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,
+    0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,
+    0x0055,0x0056,0x0057,0x0058,0x0059,0x005A,0x005B,0x005C,0x005D,0x005E,0x005F,0x0060,
+    0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,0x006C,
+    0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,
+    0x0079,0x007A,0x007B,0x007C,0x007D,0x007E,0x2985,0x2986,0x3002,0x300C,0x300D,0x3001,
+    0x30FB,0x30F2,0x30A1,0x30A3,0x30A5,0x30A7,0x30A9,0x30E3,0x30E5,0x30E7,0x30C3,0x30FC,
+    0x30A2,0x30A4,0x30A6,0x30A8,0x30AA,0x30AB,0x30AD,0x30AF,0x30B1,0x30B3,0x30B5,0x30B7,
+    0x30B9,0x30BB,0x30BD,0x30BF,0x30C1,0x30C4,0x30C6,0x30C8,0x30CA,0x30CB,0x30CC,0x30CD,
+    0x30CE,0x30CF,0x30D2,0x30D5,0x30D8,0x30DB,0x30DE,0x30DF,0x30E0,0x30E1,0x30E2,0x30E4,
+    0x30E6,0x30E8,0x30E9,0x30EA,0x30EB,0x30EC,0x30ED,0x30EF,0x30F3,0x3099,0x309A,0x1160,
+    0x1100,0x1101,0x11AA,0x1102,0x11AC,0x11AD,0x1103,0x1104,0x1105,0x11B0,0x11B1,0x11B2,
+    0x11B3,0x11B4,0x11B5,0x111A,0x1106,0x1107,0x1108,0x1121,0x1109,0x110A,0x110B,0x110C,
+    0x110D,0x110E,0x110F,0x1110,0x1111,0x1112,0x1161,0x1162,0x1163,0x1164,0x1165,0x1166,
+    0x1167,0x1168,0x1169,0x116A,0x116B,0x116C,0x116D,0x116E,0x116F,0x1170,0x1171,0x1172,
+    0x1173,0x1174,0x1175,0x00A2,0x00A3,0x00AC,0x0020,0x0304,0x00A6,0x00A5,0x20A9,0x2502,
+    0x2190,0x2191,0x2192,0x2193,0x25A0,0x25CB,0x02D0,0x02D1,0x00E6,0x0299,0x0253,0x02A3,
+    0xAB66,0x02A5,0x02A4,0x0256,0x0257,0x1D91,0x0258,0x025E,0x02A9,0x0264,0x0262,0x0260,
+    0x029B,0x0127,0x029C,0x0267,0x0284,0x02AA,0x02AB,0x026C,0x1DF04,0xA78E,0x026E,0x1DF05,
+    0x028E,0x1DF06,0x00F8,0x0276,0x0277,0x0071,0x027A,0x1DF08,0x027D,0x027E,0x0280,0x02A8,
+    0x02A6,0xAB67,0x02A7,0x0288,0x2C71,0x028F,0x02A1,0x02A2,0x0298,0x01C0,0x01C1,0x01C2,
+    0x1DF0A,0x1DF1E,0x11099,0x110BA,0x1109B,0x110BA,0x110A5,0x110BA,0x11131,0x11127,0x11132,0x11127,
+    0x11347,0x1133E,0x11347,0x11357,0x114B9,0x114BA,0x114B9,0x114B0,0x114B9,0x114BD,0x115B8,0x115AF,
+    0x115B9,0x115AF,0x11935,0x11930,0x1D157,0x1D165,0x1D158,0x1D165,0x1D158,0x1D165,0x1D16E,0x1D158,
+    0x1D165,0x1D16F,0x1D158,0x1D165,0x1D170,0x1D158,0x1D165,0x1D171,0x1D158,0x1D165,0x1D172,0x1D1B9,
+    0x1D165,0x1D1BA,0x1D165,0x1D1B9,0x1D165,0x1D16E,0x1D1BA,0x1D165,0x1D16E,0x1D1B9,0x1D165,0x1D16F,
+    0x1D1BA,0x1D165,0x1D16F,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,
+    0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,
+    0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,
+    0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,
+    0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,0x0042,0x0043,0x0044,0x0045,
+    0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,
+    0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,
+    0x0064,0x0065,0x0066,0x0067,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,0x0070,
+    0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,0x0042,
+    0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,
+    0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,0x005A,
+    0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,0x006C,
+    0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,
+    0x0079,0x007A,0x0041,0x0043,0x0044,0x0047,0x004A,0x004B,0x004E,0x004F,0x0050,0x0051,
+    0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,0x0064,
+    0x0066,0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x0070,0x0071,0x0072,0x0073,
+    0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,0x0042,0x0043,0x0044,0x0045,
+    0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,
+    0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,
+    0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,
+    0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,
+    0x0042,0x0044,0x0045,0x0046,0x0047,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,
+    0x0051,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,0x0061,0x0062,0x0063,0x0064,
+    0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,0x0070,
+    0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,0x0042,
+    0x0044,0x0045,0x0046,0x0047,0x0049,0x004A,0x004B,0x004C,0x004D,0x004F,0x0053,0x0054,
+    0x0055,0x0056,0x0057,0x0058,0x0059,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,
+    0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,
+    0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,0x0042,0x0043,0x0044,0x0045,
+    0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,
+    0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,
+    0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,
+    0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,
+    0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,
+    0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,
+    0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,
+    0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,
+    0x0078,0x0079,0x007A,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,
+    0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,
+    0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,
+    0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,
+    0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,0x0042,0x0043,0x0044,0x0045,
+    0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,
+    0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,
+    0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,
+    0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0041,
+    0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,
+    0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,0x0056,0x0057,0x0058,0x0059,
+    0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,
+    0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,
+    0x0078,0x0079,0x007A,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,
+    0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,
+    0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,
+    0x0068,0x0069,0x006A,0x006B,0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,
+    0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x0131,0x0237,0x0391,0x0392,0x0393,
+    0x0394,0x0395,0x0396,0x0397,0x0398,0x0399,0x039A,0x039B,0x039C,0x039D,0x039E,0x039F,
+    0x03A0,0x03A1,0x0398,0x03A3,0x03A4,0x03A5,0x03A6,0x03A7,0x03A8,0x03A9,0x2207,0x03B1,
+    0x03B2,0x03B3,0x03B4,0x03B5,0x03B6,0x03B7,0x03B8,0x03B9,0x03BA,0x03BB,0x03BC,0x03BD,
+    0x03BE,0x03BF,0x03C0,0x03C1,0x03C2,0x03C3,0x03C4,0x03C5,0x03C6,0x03C7,0x03C8,0x03C9,
+    0x2202,0x03B5,0x03B8,0x03BA,0x03C6,0x03C1,0x03C0,0x0391,0x0392,0x0393,0x0394,0x0395,
+    0x0396,0x0397,0x0398,0x0399,0x039A,0x039B,0x039C,0x039D,0x039E,0x039F,0x03A0,0x03A1,
+    0x0398,0x03A3,0x03A4,0x03A5,0x03A6,0x03A7,0x03A8,0x03A9,0x2207,0x03B1,0x03B2,0x03B3,
+    0x03B4,0x03B5,0x03B6,0x03B7,0x03B8,0x03B9,0x03BA,0x03BB,0x03BC,0x03BD,0x03BE,0x03BF,
+    0x03C0,0x03C1,0x03C2,0x03C3,0x03C4,0x03C5,0x03C6,0x03C7,0x03C8,0x03C9,0x2202,0x03B5,
+    0x03B8,0x03BA,0x03C6,0x03C1,0x03C0,0x0391,0x0392,0x0393,0x0394,0x0395,0x0396,0x0397,
+    0x0398,0x0399,0x039A,0x039B,0x039C,0x039D,0x039E,0x039F,0x03A0,0x03A1,0x0398,0x03A3,
+    0x03A4,0x03A5,0x03A6,0x03A7,0x03A8,0x03A9,0x2207,0x03B1,0x03B2,0x03B3,0x03B4,0x03B5,
+    0x03B6,0x03B7,0x03B8,0x03B9,0x03BA,0x03BB,0x03BC,0x03BD,0x03BE,0x03BF,0x03C0,0x03C1,
+    0x03C2,0x03C3,0x03C4,0x03C5,0x03C6,0x03C7,0x03C8,0x03C9,0x2202,0x03B5,0x03B8,0x03BA,
+    0x03C6,0x03C1,0x03C0,0x0391,0x0392,0x0393,0x0394,0x0395,0x0396,0x0397,0x0398,0x0399,
+    0x039A,0x039B,0x039C,0x039D,0x039E,0x039F,0x03A0,0x03A1,0x0398,0x03A3,0x03A4,0x03A5,
+    0x03A6,0x03A7,0x03A8,0x03A9,0x2207,0x03B1,0x03B2,0x03B3,0x03B4,0x03B5,0x03B6,0x03B7,
+    0x03B8,0x03B9,0x03BA,0x03BB,0x03BC,0x03BD,0x03BE,0x03BF,0x03C0,0x03C1,0x03C2,0x03C3,
+    0x03C4,0x03C5,0x03C6,0x03C7,0x03C8,0x03C9,0x2202,0x03B5,0x03B8,0x03BA,0x03C6,0x03C1,
+    0x03C0,0x0391,0x0392,0x0393,0x0394,0x0395,0x0396,0x0397,0x0398,0x0399,0x039A,0x039B,
+    0x039C,0x039D,0x039E,0x039F,0x03A0,0x03A1,0x0398,0x03A3,0x03A4,0x03A5,0x03A6,0x03A7,
+    0x03A8,0x03A9,0x2207,0x03B1,0x03B2,0x03B3,0x03B4,0x03B5,0x03B6,0x03B7,0x03B8,0x03B9,
+    0x03BA,0x03BB,0x03BC,0x03BD,0x03BE,0x03BF,0x03C0,0x03C1,0x03C2,0x03C3,0x03C4,0x03C5,
+    0x03C6,0x03C7,0x03C8,0x03C9,0x2202,0x03B5,0x03B8,0x03BA,0x03C6,0x03C1,0x03C0,0x03DC,
+    0x03DD,0x0030,0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x0030,
+    0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x0030,0x0031,0x0032,
+    0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x0030,0x0031,0x0032,0x0033,0x0034,
+    0x0035,0x0036,0x0037,0x0038,0x0039,0x0030,0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,
+    0x0037,0x0038,0x0039,0x0430,0x0431,0x0432,0x0433,0x0434,0x0435,0x0436,0x0437,0x0438,
+    0x043A,0x043B,0x043C,0x043E,0x043F,0x0440,0x0441,0x0442,0x0443,0x0444,0x0445,0x0446,
+    0x0447,0x0448,0x044B,0x044D,0x044E,0xA689,0x04D9,0x0456,0x0458,0x04E9,0x04AF,0x04CF,
+    0x0430,0x0431,0x0432,0x0433,0x0434,0x0435,0x0436,0x0437,0x0438,0x043A,0x043B,0x043E,
+    0x043F,0x0441,0x0443,0x0444,0x0445,0x0446,0x0447,0x0448,0x044A,0x044B,0x0491,0x0456,
+    0x0455,0x045F,0x04AB,0xA651,0x04B1,0x0627,0x0628,0x062C,0x062F,0x0648,0x0632,0x062D,
+    0x0637,0x064A,0x0643,0x0644,0x0645,0x0646,0x0633,0x0639,0x0641,0x0635,0x0642,0x0631,
+    0x0634,0x062A,0x062B,0x062E,0x0630,0x0636,0x0638,0x063A,0x066E,0x06BA,0x06A1,0x066F,
+    0x0628,0x062C,0x0647,0x062D,0x064A,0x0643,0x0644,0x0645,0x0646,0x0633,0x0639,0x0641,
+    0x0635,0x0642,0x0634,0x062A,0x062B,0x062E,0x0636,0x063A,0x062C,0x062D,0x064A,0x0644,
+    0x0646,0x0633,0x0639,0x0635,0x0642,0x0634,0x062E,0x0636,0x063A,0x06BA,0x066F,0x0628,
+    0x062C,0x0647,0x062D,0x0637,0x064A,0x0643,0x0645,0x0646,0x0633,0x0639,0x0641,0x0635,
+    0x0642,0x0634,0x062A,0x062B,0x062E,0x0636,0x0638,0x063A,0x066E,0x06A1,0x0627,0x0628,
+    0x062C,0x062F,0x0647,0x0648,0x0632,0x062D,0x0637,0x064A,0x0644,0x0645,0x0646,0x0633,
+    0x0639,0x0641,0x0635,0x0642,0x0631,0x0634,0x062A,0x062B,0x062E,0x0630,0x0636,0x0638,
+    0x063A,0x0628,0x062C,0x062F,0x0648,0x0632,0x062D,0x0637,0x064A,0x0644,0x0645,0x0646,
+    0x0633,0x0639,0x0641,0x0635,0x0642,0x0631,0x0634,0x062A,0x062B,0x062E,0x0630,0x0636,
+    0x0638,0x063A,0x0030,0x002E,0x0030,0x002C,0x0031,0x002C,0x0032,0x002C,0x0033,0x002C,
+    0x0034,0x002C,0x0035,0x002C,0x0036,0x002C,0x0037,0x002C,0x0038,0x002C,0x0039,0x002C,
+    0x0028,0x0041,0x0029,0x0028,0x0042,0x0029,0x0028,0x0043,0x0029,0x0028,0x0044,0x0029,
+    0x0028,0x0045,0x0029,0x0028,0x0046,0x0029,0x0028,0x0047,0x0029,0x0028,0x0048,0x0029,
+    0x0028,0x0049,0x0029,0x0028,0x004A,0x0029,0x0028,0x004B,0x0029,0x0028,0x004C,0x0029,
+    0x0028,0x004D,0x0029,0x0028,0x004E,0x0029,0x0028,0x004F,0x0029,0x0028,0x0050,0x0029,
+    0x0028,0x0051,0x0029,0x0028,0x0052,0x0029,0x0028,0x0053,0x0029,0x0028,0x0054,0x0029,
+    0x0028,0x0055,0x0029,0x0028,0x0056,0x0029,0x0028,0x0057,0x0029,0x0028,0x0058,0x0029,
+    0x0028,0x0059,0x0029,0x0028,0x005A,0x0029,0x3014,0x0053,0x3015,0x0043,0x0052,0x0043,
+    0x0044,0x0057,0x005A,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,0x0047,0x0048,0x0049,
+    0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,
+    0x0056,0x0057,0x0058,0x0059,0x005A,0x0048,0x0056,0x004D,0x0056,0x0053,0x0044,0x0053,
+    0x0053,0x0050,0x0050,0x0056,0x0057,0x0043,0x004D,0x0043,0x004D,0x0044,0x004D,0x0052,
+    0x0044,0x004A,0x307B,0x304B,0x30B3,0x30B3,0x30B5,0x624B,0x5B57,0x53CC,0x30C6,0x3099,
+    0x4E8C,0x591A,0x89E3,0x5929,0x4EA4,0x6620,0x7121,0x6599,0x524D,0x5F8C,0x518D,0x65B0,
+    0x521D,0x7D42,0x751F,0x8CA9,0x58F0,0x5439,0x6F14,0x6295,0x6355,0x4E00,0x4E09,0x904A,
+    0x5DE6,0x4E2D,0x53F3,0x6307,0x8D70,0x6253,0x7981,0x7A7A,0x5408,0x6E80,0x6709,0x6708,
+    0x7533,0x5272,0x55B6,0x914D,0x3014,0x672C,0x3015,0x3014,0x4E09,0x3015,0x3014,0x4E8C,
+    0x3015,0x3014,0x5B89,0x3015,0x3014,0x70B9,0x3015,0x3014,0x6253,0x3015,0x3014,0x76D7,
+    0x3015,0x3014,0x52DD,0x3015,0x3014,0x6557,0x3015,0x5F97,0x53EF,0x0030,0x0031,0x0032,
+    0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x4E3D,0x4E38,0x4E41,0x20122,0x4F60,
+    0x4FAE,0x4FBB,0x5002,0x507A,0x5099,0x50E7,0x50CF,0x349E,0x2063A,0x514D,0x5154,0x5164,
+    0x5177,0x2051C,0x34B9,0x5167,0x518D,0x2054B,0x5197,0x51A4,0x4ECC,0x51AC,0x51B5,0x291DF,
+    0x51F5,0x5203,0x34DF,0x523B,0x5246,0x5272,0x5277,0x3515,0x52C7,0x52C9,0x52E4,0x52FA,
+    0x5305,0x5306,0x5317,0x5349,0x5351,0x535A,0x5373,0x537D,0x537F,0x537F,0x537F,0x20A2C,
+    0x7070,0x53CA,0x53DF,0x20B63,0x53EB,0x53F1,0x5406,0x549E,0x5438,0x5448,0x5468,0x54A2,
+    0x54F6,0x5510,0x5553,0x5563,0x5584,0x5584,0x5599,0x55AB,0x55B3,0x55C2,0x5716,0x5606,
+    0x5717,0x5651,0x5674,0x5207,0x58EE,0x57CE,0x57F4,0x580D,0x578B,0x5832,0x5831,0x58AC,
+    0x214E4,0x58F2,0x58F7,0x5906,0x591A,0x5922,0x5962,0x216A8,0x216EA,0x59EC,0x5A1B,0x5A27,
+    0x59D8,0x5A66,0x36EE,0x36FC,0x5B08,0x5B3E,0x5B3E,0x219C8,0x5BC3,0x5BD8,0x5BE7,0x5BF3,
+    0x21B18,0x5BFF,0x5C06,0x5F53,0x5C22,0x3781,0x5C60,0x5C6E,0x5CC0,0x5C8D,0x21DE4,0x5D43,
+    0x21DE6,0x5D6E,0x5D6B,0x5D7C,0x5DE1,0x5DE2,0x382F,0x5DFD,0x5E28,0x5E3D,0x5E69,0x3862,
+    0x22183,0x387C,0x5EB0,0x5EB3,0x5EB6,0x5ECA,0x2A392,0x5EFE,0x22331,0x22331,0x8201,0x5F22,
+    0x5F22,0x38C7,0x232B8,0x261DA,0x5F62,0x5F6B,0x38E3,0x5F9A,0x5FCD,0x5FD7,0x5FF9,0x6081,
+    0x393A,0x391C,0x6094,0x226D4,0x60C7,0x6148,0x614C,0x614E,0x614C,0x617A,0x618E,0x61B2,
+    0x61A4,0x61AF,0x61DE,0x61F2,0x61F6,0x6210,0x621B,0x625D,0x62B1,0x62D4,0x6350,0x22B0C,
+    0x633D,0x62FC,0x6368,0x6383,0x63E4,0x22BF1,0x6422,0x63C5,0x63A9,0x3A2E,0x6469,0x647E,
+    0x649D,0x6477,0x3A6C,0x654F,0x656C,0x2300A,0x65E3,0x66F8,0x6649,0x3B19,0x6691,0x3B08,
+    0x3AE4,0x5192,0x5195,0x6700,0x669C,0x80AD,0x43D9,0x6717,0x671B,0x6721,0x675E,0x6753,
+    0x233C3,0x3B49,0x67FA,0x6785,0x6852,0x6885,0x2346D,0x688E,0x681F,0x6914,0x3B9D,0x6942,
+    0x69A3,0x69EA,0x6AA8,0x236A3,0x6ADB,0x3C18,0x6B21,0x238A7,0x6B54,0x3C4E,0x6B72,0x6B9F,
+    0x6BBA,0x6BBB,0x23A8D,0x21D0B,0x23AFA,0x6C4E,0x23CBC,0x6CBF,0x6CCD,0x6C67,0x6D16,0x6D3E,
+    0x6D77,0x6D41,0x6D69,0x6D78,0x6D85,0x23D1E,0x6D34,0x6E2F,0x6E6E,0x3D33,0x6ECB,0x6EC7,
+    0x23ED1,0x6DF9,0x6F6E,0x23F5E,0x23F8E,0x6FC6,0x7039,0x701E,0x701B,0x3D96,0x704A,0x707D,
+    0x7077,0x70AD,0x20525,0x7145,0x24263,0x719C,0x243AB,0x7228,0x7235,0x7250,0x24608,0x7280,
+    0x7295,0x24735,0x24814,0x737A,0x738B,0x3EAC,0x73A5,0x3EB8,0x3EB8,0x7447,0x745C,0x7471,
+    0x7485,0x74CA,0x3F1B,0x7524,0x24C36,0x753E,0x24C92,0x7570,0x2219F,0x7610,0x24FA1,0x24FB8,
+    0x25044,0x3FFC,0x4008,0x76F4,0x250F3,0x250F2,0x25119,0x25133,0x771E,0x771F,0x771F,0x774A,
+    0x4039,0x778B,0x4046,0x4096,0x2541D,0x784E,0x788C,0x78CC,0x40E3,0x25626,0x7956,0x2569A,
+    0x256C5,0x798F,0x79EB,0x412F,0x7A40,0x7A4A,0x7A4F,0x2597C,0x25AA7,0x25AA7,0x7AEE,0x4202,
+    0x25BAB,0x7BC6,0x7BC9,0x4227,0x25C80,0x7CD2,0x42A0,0x7CE8,0x7CE3,0x7D00,0x25F86,0x7D63,
+    0x4301,0x7DC7,0x7E02,0x7E45,0x4334,0x26228,0x26247,0x4359,0x262D9,0x7F7A,0x2633E,0x7F95,
+    0x7FFA,0x8005,0x264DA,0x26523,0x8060,0x265A8,0x8070,0x2335F,0x43D5,0x80B2,0x8103,0x440B,
+    0x813E,0x5AB5,0x267A7,0x267B5,0x23393,0x2339C,0x8201,0x8204,0x8F9E,0x446B,0x8291,0x828B,
+    0x829D,0x52B3,0x82B1,0x82B3,0x82BD,0x82E6,0x26B3C,0x82E5,0x831D,0x8363,0x83AD,0x8323,
+    0x83BD,0x83E7,0x8457,0x8353,0x83CA,0x83CC,0x83DC,0x26C36,0x26D6B,0x26CD5,0x452B,0x84F1,
+    0x84F3,0x8516,0x273CA,0x8564,0x26F2C,0x455D,0x4561,0x26FB1,0x270D2,0x456B,0x8650,0x865C,
+    0x8667,0x8669,0x86A9,0x8688,0x870E,0x86E2,0x8779,0x8728,0x876B,0x8786,0x45D7,0x87E1,
+    0x8801,0x45F9,0x8860,0x8863,0x27667,0x88D7,0x88DE,0x4635,0x88FA,0x34BB,0x278AE,0x27966,
+    0x46BE,0x46C7,0x8AA0,0x8AED,0x8B8A,0x8C55,0x27CA8,0x8CAB,0x8CC1,0x8D1B,0x8D77,0x27F2F,
+    0x20804,0x8DCB,0x8DBC,0x8DF0,0x208DE,0x8ED4,0x8F38,0x285D2,0x285ED,0x9094,0x90F1,0x9111,
+    0x2872E,0x911B,0x9238,0x92D7,0x92D8,0x927C,0x93F9,0x9415,0x28BFA,0x958B,0x4995,0x95B7,
+    0x28D77,0x49E6,0x96C3,0x5DB2,0x9723,0x29145,0x2921A,0x4A6E,0x4A76,0x97E0,0x2940A,0x4AB2,
+    0x29496,0x980B,0x980B,0x9829,0x295B6,0x98E2,0x4B33,0x9929,0x99A7,0x99C2,0x99FE,0x4BCE,
+    0x29B30,0x9B12,0x9C40,0x9CFD,0x4CCE,0x4CED,0x9D67,0x2A0CE,0x4CF8,0x2A105,0x2A20E,0x2A291,
+    0x9EBB,0x4D56,0x9EF9,0x9EFE,0x9F05,0x9F0F,0x9F16,0x9F3B,0x2A600,
+};
+
+static const uint32_t hz_ucd_compositions[941][3] = {
+    {0x003C,0x0338,0x226E},{0x003D,0x0338,0x2260},{0x003E,0x0338,0x226F},{0x0041,0x0300,0x00C0},
+    {0x0041,0x0301,0x00C1},{0x0041,0x0302,0x00C2},{0x0041,0x0303,0x00C3},{0x0041,0x0304,0x0100},
+    {0x0041,0x0306,0x0102},{0x0041,0x0307,0x0226},{0x0041,0x0308,0x00C4},{0x0041,0x0309,0x1EA2},
+    {0x0041,0x030A,0x00C5},{0x0041,0x030C,0x01CD},{0x0041,0x030F,0x0200},{0x0041,0x0311,0x0202},
+    {0x0041,0x0323,0x1EA0},{0x0041,0x0325,0x1E00},{0x0041,0x0328,0x0104},{0x0042,0x0307,0x1E02},
+    {0x0042,0x0323,0x1E04},{0x0042,0x0331,0x1E06},{0x0043,0x0301,0x0106},{0x0043,0x0302,0x0108},
+    {0x0043,0x0307,0x010A},{0x0043,0x030C,0x010C},{0x0043,0x0327,0x00C7},{0x0044,0x0307,0x1E0A},
+    {0x0044,0x030C,0x010E},{0x0044,0x0323,0x1E0C},{0x0044,0x0327,0x1E10},{0x0044,0x032D,0x1E12},
+    {0x0044,0x0331,0x1E0E},{0x0045,0x0300,0x00C8},{0x0045,0x0301,0x00C9},{0x0045,0x0302,0x00CA},
+    {0x0045,0x0303,0x1EBC},{0x0045,0x0304,0x0112},{0x0045,0x0306,0x0114},{0x0045,0x0307,0x0116},
+    {0x0045,0x0308,0x00CB},{0x0045,0x0309,0x1EBA},{0x0045,0x030C,0x011A},{0x0045,0x030F,0x0204},
+    {0x0045,0x0311,0x0206},{0x0045,0x0323,0x1EB8},{0x0045,0x0327,0x0228},{0x0045,0x0328,0x0118},
+    {0x0045,0x032D,0x1E18},{0x0045,0x0330,0x1E1A},{0x0046,0x0307,0x1E1E},{0x0047,0x0301,0x01F4},
+    {0x0047,0x0302,0x011C},{0x0047,0x0304,0x1E20},{0x0047,0x0306,0x011E},{0x0047,0x0307,0x0120},
+    {0x0047,0x030C,0x01E6},{0x0047,0x0327,0x0122},{0x0048,0x0302,0x0124},{0x0048,0x0307,0x1E22},
+    {0x0048,0x0308,0x1E26},{0x0048,0x030C,0x021E},{0x0048,0x0323,0x1E24},{0x0048,0x0327,0x1E28},
+    {0x0048,0x032E,0x1E2A},{0x0049,0x0300,0x00CC},{0x0049,0x0301,0x00CD},{0x0049,0x0302,0x00CE},
+    {0x0049,0x0303,0x0128},{0x0049,0x0304,0x012A},{0x0049,0x0306,0x012C},{0x0049,0x0307,0x0130},
+    {0x0049,0x0308,0x00CF},{0x0049,0x0309,0x1EC8},{0x0049,0x030C,0x01CF},{0x0049,0x030F,0x0208},
+    {0x0049,0x0311,0x020A},{0x0049,0x0323,0x1ECA},{0x0049,0x0328,0x012E},{0x0049,0x0330,0x1E2C},
+    {0x004A,0x0302,0x0134},{0x004B,0x0301,0x1E30},{0x004B,0x030C,0x01E8},{0x004B,0x0323,0x1E32},
+    {0x004B,0x0327,0x0136},{0x004B,0x0331,0x1E34},{0x004C,0x0301,0x0139},{0x004C,0x030C,0x013D},
+    {0x004C,0x0323,0x1E36},{0x004C,0x0327,0x013B},{0x004C,0x032D,0x1E3C},{0x004C,0x0331,0x1E3A},
+    {0x004D,0x0301,0x1E3E},{0x004D,0x0307,0x1E40},{0x004D,0x0323,0x1E42},{0x004E,0x0300,0x01F8},
+    {0x004E,0x0301,0x0143},{0x004E,0x0303,0x00D1},{0x004E,0x0307,0x1E44},{0x004E,0x030C,0x0147},
+    {0x004E,0x0323,0x1E46},{0x004E,0x0327,0x0145},{0x004E,0x032D,0x1E4A},{0x004E,0x0331,0x1E48},
+    {0x004F,0x0300,0x00D2},{0x004F,0x0301,0x00D3},{0x004F,0x0302,0x00D4},{0x004F,0x0303,0x00D5},
+    {0x004F,0x0304,0x014C},{0x004F,0x0306,0x014E},{0x004F,0x0307,0x022E},{0x004F,0x0308,0x00D6},
+    {0x004F,0x0309,0x1ECE},{0x004F,0x030B,0x0150},{0x004F,0x030C,0x01D1},{0x004F,0x030F,0x020C},
+    {0x004F,0x0311,0x020E},{0x004F,0x031B,0x01A0},{0x004F,0x0323,0x1ECC},{0x004F,0x0328,0x01EA},
+    {0x0050,0x0301,0x1E54},{0x0050,0x0307,0x1E56},{0x0052,0x0301,0x0154},{0x0052,0x0307,0x1E58},
+    {0x0052,0x030C,0x0158},{0x0052,0x030F,0x0210},{0x0052,0x0311,0x0212},{0x0052,0x0323,0x1E5A},
+    {0x0052,0x0327,0x0156},{0x0052,0x0331,0x1E5E},{0x0053,0x0301,0x015A},{0x0053,0x0302,0x015C},
+    {0x0053,0x0307,0x1E60},{0x0053,0x030C,0x0160},{0x0053,0x0323,0x1E62},{0x0053,0x0326,0x0218},
+    {0x0053,0x0327,0x015E},{0x0054,0x0307,0x1E6A},{0x0054,0x030C,0x0164},{0x0054,0x0323,0x1E6C},
+    {0x0054,0x0326,0x021A},{0x0054,0x0327,0x0162},{0x0054,0x032D,0x1E70},{0x0054,0x0331,0x1E6E},
+    {0x0055,0x0300,0x00D9},{0x0055,0x0301,0x00DA},{0x0055,0x0302,0x00DB},{0x0055,0x0303,0x0168},
+    {0x0055,0x0304,0x016A},{0x0055,0x0306,0x016C},{0x0055,0x0308,0x00DC},{0x0055,0x0309,0x1EE6},
+    {0x0055,0x030A,0x016E},{0x0055,0x030B,0x0170},{0x0055,0x030C,0x01D3},{0x0055,0x030F,0x0214},
+    {0x0055,0x0311,0x0216},{0x0055,0x031B,0x01AF},{0x0055,0x0323,0x1EE4},{0x0055,0x0324,0x1E72},
+    {0x0055,0x0328,0x0172},{0x0055,0x032D,0x1E76},{0x0055,0x0330,0x1E74},{0x0056,0x0303,0x1E7C},
+    {0x0056,0x0323,0x1E7E},{0x0057,0x0300,0x1E80},{0x0057,0x0301,0x1E82},{0x0057,0x0302,0x0174},
+    {0x0057,0x0307,0x1E86},{0x0057,0x0308,0x1E84},{0x0057,0x0323,0x1E88},{0x0058,0x0307,0x1E8A},
+    {0x0058,0x0308,0x1E8C},{0x0059,0x0300,0x1EF2},{0x0059,0x0301,0x00DD},{0x0059,0x0302,0x0176},
+    {0x0059,0x0303,0x1EF8},{0x0059,0x0304,0x0232},{0x0059,0x0307,0x1E8E},{0x0059,0x0308,0x0178},
+    {0x0059,0x0309,0x1EF6},{0x0059,0x0323,0x1EF4},{0x005A,0x0301,0x0179},{0x005A,0x0302,0x1E90},
+    {0x005A,0x0307,0x017B},{0x005A,0x030C,0x017D},{0x005A,0x0323,0x1E92},{0x005A,0x0331,0x1E94},
+    {0x0061,0x0300,0x00E0},{0x0061,0x0301,0x00E1},{0x0061,0x0302,0x00E2},{0x0061,0x0303,0x00E3},
+    {0x0061,0x0304,0x0101},{0x0061,0x0306,0x0103},{0x0061,0x0307,0x0227},{0x0061,0x0308,0x00E4},
+    {0x0061,0x0309,0x1EA3},{0x0061,0x030A,0x00E5},{0x0061,0x030C,0x01CE},{0x0061,0x030F,0x0201},
+    {0x0061,0x0311,0x0203},{0x0061,0x0323,0x1EA1},{0x0061,0x0325,0x1E01},{0x0061,0x0328,0x0105},
+    {0x0062,0x0307,0x1E03},{0x0062,0x0323,0x1E05},{0x0062,0x0331,0x1E07},{0x0063,0x0301,0x0107},
+    {0x0063,0x0302,0x0109},{0x0063,0x0307,0x010B},{0x0063,0x030C,0x010D},{0x0063,0x0327,0x00E7},
+    {0x0064,0x0307,0x1E0B},{0x0064,0x030C,0x010F},{0x0064,0x0323,0x1E0D},{0x0064,0x0327,0x1E11},
+    {0x0064,0x032D,0x1E13},{0x0064,0x0331,0x1E0F},{0x0065,0x0300,0x00E8},{0x0065,0x0301,0x00E9},
+    {0x0065,0x0302,0x00EA},{0x0065,0x0303,0x1EBD},{0x0065,0x0304,0x0113},{0x0065,0x0306,0x0115},
+    {0x0065,0x0307,0x0117},{0x0065,0x0308,0x00EB},{0x0065,0x0309,0x1EBB},{0x0065,0x030C,0x011B},
+    {0x0065,0x030F,0x0205},{0x0065,0x0311,0x0207},{0x0065,0x0323,0x1EB9},{0x0065,0x0327,0x0229},
+    {0x0065,0x0328,0x0119},{0x0065,0x032D,0x1E19},{0x0065,0x0330,0x1E1B},{0x0066,0x0307,0x1E1F},
+    {0x0067,0x0301,0x01F5},{0x0067,0x0302,0x011D},{0x0067,0x0304,0x1E21},{0x0067,0x0306,0x011F},
+    {0x0067,0x0307,0x0121},{0x0067,0x030C,0x01E7},{0x0067,0x0327,0x0123},{0x0068,0x0302,0x0125},
+    {0x0068,0x0307,0x1E23},{0x0068,0x0308,0x1E27},{0x0068,0x030C,0x021F},{0x0068,0x0323,0x1E25},
+    {0x0068,0x0327,0x1E29},{0x0068,0x032E,0x1E2B},{0x0068,0x0331,0x1E96},{0x0069,0x0300,0x00EC},
+    {0x0069,0x0301,0x00ED},{0x0069,0x0302,0x00EE},{0x0069,0x0303,0x0129},{0x0069,0x0304,0x012B},
+    {0x0069,0x0306,0x012D},{0x0069,0x0308,0x00EF},{0x0069,0x0309,0x1EC9},{0x0069,0x030C,0x01D0},
+    {0x0069,0x030F,0x0209},{0x0069,0x0311,0x020B},{0x0069,0x0323,0x1ECB},{0x0069,0x0328,0x012F},
+    {0x0069,0x0330,0x1E2D},{0x006A,0x0302,0x0135},{0x006A,0x030C,0x01F0},{0x006B,0x0301,0x1E31},
+    {0x006B,0x030C,0x01E9},{0x006B,0x0323,0x1E33},{0x006B,0x0327,0x0137},{0x006B,0x0331,0x1E35},
+    {0x006C,0x0301,0x013A},{0x006C,0x030C,0x013E},{0x006C,0x0323,0x1E37},{0x006C,0x0327,0x013C},
+    {0x006C,0x032D,0x1E3D},{0x006C,0x0331,0x1E3B},{0x006D,0x0301,0x1E3F},{0x006D,0x0307,0x1E41},
+    {0x006D,0x0323,0x1E43},{0x006E,0x0300,0x01F9},{0x006E,0x0301,0x0144},{0x006E,0x0303,0x00F1},
+    {0x006E,0x0307,0x1E45},{0x006E,0x030C,0x0148},{0x006E,0x0323,0x1E47},{0x006E,0x0327,0x0146},
+    {0x006E,0x032D,0x1E4B},{0x006E,0x0331,0x1E49},{0x006F,0x0300,0x00F2},{0x006F,0x0301,0x00F3},
+    {0x006F,0x0302,0x00F4},{0x006F,0x0303,0x00F5},{0x006F,0x0304,0x014D},{0x006F,0x0306,0x014F},
+    {0x006F,0x0307,0x022F},{0x006F,0x0308,0x00F6},{0x006F,0x0309,0x1ECF},{0x006F,0x030B,0x0151},
+    {0x006F,0x030C,0x01D2},{0x006F,0x030F,0x020D},{0x006F,0x0311,0x020F},{0x006F,0x031B,0x01A1},
+    {0x006F,0x0323,0x1ECD},{0x006F,0x0328,0x01EB},{0x0070,0x0301,0x1E55},{0x0070,0x0307,0x1E57},
+    {0x0072,0x0301,0x0155},{0x0072,0x0307,0x1E59},{0x0072,0x030C,0x0159},{0x0072,0x030F,0x0211},
+    {0x0072,0x0311,0x0213},{0x0072,0x0323,0x1E5B},{0x0072,0x0327,0x0157},{0x0072,0x0331,0x1E5F},
+    {0x0073,0x0301,0x015B},{0x0073,0x0302,0x015D},{0x0073,0x0307,0x1E61},{0x0073,0x030C,0x0161},
+    {0x0073,0x0323,0x1E63},{0x0073,0x0326,0x0219},{0x0073,0x0327,0x015F},{0x0074,0x0307,0x1E6B},
+    {0x0074,0x0308,0x1E97},{0x0074,0x030C,0x0165},{0x0074,0x0323,0x1E6D},{0x0074,0x0326,0x021B},
+    {0x0074,0x0327,0x0163},{0x0074,0x032D,0x1E71},{0x0074,0x0331,0x1E6F},{0x0075,0x0300,0x00F9},
+    {0x0075,0x0301,0x00FA},{0x0075,0x0302,0x00FB},{0x0075,0x0303,0x0169},{0x0075,0x0304,0x016B},
+    {0x0075,0x0306,0x016D},{0x0075,0x0308,0x00FC},{0x0075,0x0309,0x1EE7},{0x0075,0x030A,0x016F},
+    {0x0075,0x030B,0x0171},{0x0075,0x030C,0x01D4},{0x0075,0x030F,0x0215},{0x0075,0x0311,0x0217},
+    {0x0075,0x031B,0x01B0},{0x0075,0x0323,0x1EE5},{0x0075,0x0324,0x1E73},{0x0075,0x0328,0x0173},
+    {0x0075,0x032D,0x1E77},{0x0075,0x0330,0x1E75},{0x0076,0x0303,0x1E7D},{0x0076,0x0323,0x1E7F},
+    {0x0077,0x0300,0x1E81},{0x0077,0x0301,0x1E83},{0x0077,0x0302,0x0175},{0x0077,0x0307,0x1E87},
+    {0x0077,0x0308,0x1E85},{0x0077,0x030A,0x1E98},{0x0077,0x0323,0x1E89},{0x0078,0x0307,0x1E8B},
+    {0x0078,0x0308,0x1E8D},{0x0079,0x0300,0x1EF3},{0x0079,0x0301,0x00FD},{0x0079,0x0302,0x0177},
+    {0x0079,0x0303,0x1EF9},{0x0079,0x0304,0x0233},{0x0079,0x0307,0x1E8F},{0x0079,0x0308,0x00FF},
+    {0x0079,0x0309,0x1EF7},{0x0079,0x030A,0x1E99},{0x0079,0x0323,0x1EF5},{0x007A,0x0301,0x017A},
+    {0x007A,0x0302,0x1E91},{0x007A,0x0307,0x017C},{0x007A,0x030C,0x017E},{0x007A,0x0323,0x1E93},
+    {0x007A,0x0331,0x1E95},{0x00A8,0x0300,0x1FED},{0x00A8,0x0301,0x0385},{0x00A8,0x0342,0x1FC1},
+    {0x00C2,0x0300,0x1EA6},{0x00C2,0x0301,0x1EA4},{0x00C2,0x0303,0x1EAA},{0x00C2,0x0309,0x1EA8},
+    {0x00C4,0x0304,0x01DE},{0x00C5,0x0301,0x01FA},{0x00C6,0x0301,0x01FC},{0x00C6,0x0304,0x01E2},
+    {0x00C7,0x0301,0x1E08},{0x00CA,0x0300,0x1EC0},{0x00CA,0x0301,0x1EBE},{0x00CA,0x0303,0x1EC4},
+    {0x00CA,0x0309,0x1EC2},{0x00CF,0x0301,0x1E2E},{0x00D4,0x0300,0x1ED2},{0x00D4,0x0301,0x1ED0},
+    {0x00D4,0x0303,0x1ED6},{0x00D4,0x0309,0x1ED4},{0x00D5,0x0301,0x1E4C},{0x00D5,0x0304,0x022C},
+    {0x00D5,0x0308,0x1E4E},{0x00D6,0x0304,0x022A},{0x00D8,0x0301,0x01FE},{0x00DC,0x0300,0x01DB},
+    {0x00DC,0x0301,0x01D7},{0x00DC,0x0304,0x01D5},{0x00DC,0x030C,0x01D9},{0x00E2,0x0300,0x1EA7},
+    {0x00E2,0x0301,0x1EA5},{0x00E2,0x0303,0x1EAB},{0x00E2,0x0309,0x1EA9},{0x00E4,0x0304,0x01DF},
+    {0x00E5,0x0301,0x01FB},{0x00E6,0x0301,0x01FD},{0x00E6,0x0304,0x01E3},{0x00E7,0x0301,0x1E09},
+    {0x00EA,0x0300,0x1EC1},{0x00EA,0x0301,0x1EBF},{0x00EA,0x0303,0x1EC5},{0x00EA,0x0309,0x1EC3},
+    {0x00EF,0x0301,0x1E2F},{0x00F4,0x0300,0x1ED3},{0x00F4,0x0301,0x1ED1},{0x00F4,0x0303,0x1ED7},
+    {0x00F4,0x0309,0x1ED5},{0x00F5,0x0301,0x1E4D},{0x00F5,0x0304,0x022D},{0x00F5,0x0308,0x1E4F},
+    {0x00F6,0x0304,0x022B},{0x00F8,0x0301,0x01FF},{0x00FC,0x0300,0x01DC},{0x00FC,0x0301,0x01D8},
+    {0x00FC,0x0304,0x01D6},{0x00FC,0x030C,0x01DA},{0x0102,0x0300,0x1EB0},{0x0102,0x0301,0x1EAE},
+    {0x0102,0x0303,0x1EB4},{0x0102,0x0309,0x1EB2},{0x0103,0x0300,0x1EB1},{0x0103,0x0301,0x1EAF},
+    {0x0103,0x0303,0x1EB5},{0x0103,0x0309,0x1EB3},{0x0112,0x0300,0x1E14},{0x0112,0x0301,0x1E16},
+    {0x0113,0x0300,0x1E15},{0x0113,0x0301,0x1E17},{0x014C,0x0300,0x1E50},{0x014C,0x0301,0x1E52},
+    {0x014D,0x0300,0x1E51},{0x014D,0x0301,0x1E53},{0x015A,0x0307,0x1E64},{0x015B,0x0307,0x1E65},
+    {0x0160,0x0307,0x1E66},{0x0161,0x0307,0x1E67},{0x0168,0x0301,0x1E78},{0x0169,0x0301,0x1E79},
+    {0x016A,0x0308,0x1E7A},{0x016B,0x0308,0x1E7B},{0x017F,0x0307,0x1E9B},{0x01A0,0x0300,0x1EDC},
+    {0x01A0,0x0301,0x1EDA},{0x01A0,0x0303,0x1EE0},{0x01A0,0x0309,0x1EDE},{0x01A0,0x0323,0x1EE2},
+    {0x01A1,0x0300,0x1EDD},{0x01A1,0x0301,0x1EDB},{0x01A1,0x0303,0x1EE1},{0x01A1,0x0309,0x1EDF},
+    {0x01A1,0x0323,0x1EE3},{0x01AF,0x0300,0x1EEA},{0x01AF,0x0301,0x1EE8},{0x01AF,0x0303,0x1EEE},
+    {0x01AF,0x0309,0x1EEC},{0x01AF,0x0323,0x1EF0},{0x01B0,0x0300,0x1EEB},{0x01B0,0x0301,0x1EE9},
+    {0x01B0,0x0303,0x1EEF},{0x01B0,0x0309,0x1EED},{0x01B0,0x0323,0x1EF1},{0x01B7,0x030C,0x01EE},
+    {0x01EA,0x0304,0x01EC},{0x01EB,0x0304,0x01ED},{0x0226,0x0304,0x01E0},{0x0227,0x0304,0x01E1},
+    {0x0228,0x0306,0x1E1C},{0x0229,0x0306,0x1E1D},{0x022E,0x0304,0x0230},{0x022F,0x0304,0x0231},
+    {0x0292,0x030C,0x01EF},{0x0391,0x0300,0x1FBA},{0x0391,0x0301,0x0386},{0x0391,0x0304,0x1FB9},
+    {0x0391,0x0306,0x1FB8},{0x0391,0x0313,0x1F08},{0x0391,0x0314,0x1F09},{0x0391,0x0345,0x1FBC},
+    {0x0395,0x0300,0x1FC8},{0x0395,0x0301,0x0388},{0x0395,0x0313,0x1F18},{0x0395,0x0314,0x1F19},
+    {0x0397,0x0300,0x1FCA},{0x0397,0x0301,0x0389},{0x0397,0x0313,0x1F28},{0x0397,0x0314,0x1F29},
+    {0x0397,0x0345,0x1FCC},{0x0399,0x0300,0x1FDA},{0x0399,0x0301,0x038A},{0x0399,0x0304,0x1FD9},
+    {0x0399,0x0306,0x1FD8},{0x0399,0x0308,0x03AA},{0x0399,0x0313,0x1F38},{0x0399,0x0314,0x1F39},
+    {0x039F,0x0300,0x1FF8},{0x039F,0x0301,0x038C},{0x039F,0x0313,0x1F48},{0x039F,0x0314,0x1F49},
+    {0x03A1,0x0314,0x1FEC},{0x03A5,0x0300,0x1FEA},{0x03A5,0x0301,0x038E},{0x03A5,0x0304,0x1FE9},
+    {0x03A5,0x0306,0x1FE8},{0x03A5,0x0308,0x03AB},{0x03A5,0x0314,0x1F59},{0x03A9,0x0300,0x1FFA},
+    {0x03A9,0x0301,0x038F},{0x03A9,0x0313,0x1F68},{0x03A9,0x0314,0x1F69},{0x03A9,0x0345,0x1FFC},
+    {0x03AC,0x0345,0x1FB4},{0x03AE,0x0345,0x1FC4},{0x03B1,0x0300,0x1F70},{0x03B1,0x0301,0x03AC},
+    {0x03B1,0x0304,0x1FB1},{0x03B1,0x0306,0x1FB0},{0x03B1,0x0313,0x1F00},{0x03B1,0x0314,0x1F01},
+    {0x03B1,0x0342,0x1FB6},{0x03B1,0x0345,0x1FB3},{0x03B5,0x0300,0x1F72},{0x03B5,0x0301,0x03AD},
+    {0x03B5,0x0313,0x1F10},{0x03B5,0x0314,0x1F11},{0x03B7,0x0300,0x1F74},{0x03B7,0x0301,0x03AE},
+    {0x03B7,0x0313,0x1F20},{0x03B7,0x0314,0x1F21},{0x03B7,0x0342,0x1FC6},{0x03B7,0x0345,0x1FC3},
+    {0x03B9,0x0300,0x1F76},{0x03B9,0x0301,0x03AF},{0x03B9,0x0304,0x1FD1},{0x03B9,0x0306,0x1FD0},
+    {0x03B9,0x0308,0x03CA},{0x03B9,0x0313,0x1F30},{0x03B9,0x0314,0x1F31},{0x03B9,0x0342,0x1FD6},
+    {0x03BF,0x0300,0x1F78},{0x03BF,0x0301,0x03CC},{0x03BF,0x0313,0x1F40},{0x03BF,0x0314,0x1F41},
+    {0x03C1,0x0313,0x1FE4},{0x03C1,0x0314,0x1FE5},{0x03C5,0x0300,0x1F7A},{0x03C5,0x0301,0x03CD},
+    {0x03C5,0x0304,0x1FE1},{0x03C5,0x0306,0x1FE0},{0x03C5,0x0308,0x03CB},{0x03C5,0x0313,0x1F50},
+    {0x03C5,0x0314,0x1F51},{0x03C5,0x0342,0x1FE6},{0x03C9,0x0300,0x1F7C},{0x03C9,0x0301,0x03CE},
+    {0x03C9,0x0313,0x1F60},{0x03C9,0x0314,0x1F61},{0x03C9,0x0342,0x1FF6},{0x03C9,0x0345,0x1FF3},
+    {0x03CA,0x0300,0x1FD2},{0x03CA,0x0301,0x0390},{0x03CA,0x0342,0x1FD7},{0x03CB,0x0300,0x1FE2},
+    {0x03CB,0x0301,0x03B0},{0x03CB,0x0342,0x1FE7},{0x03CE,0x0345,0x1FF4},{0x03D2,0x0301,0x03D3},
+    {0x03D2,0x0308,0x03D4},{0x0406,0x0308,0x0407},{0x0410,0x0306,0x04D0},{0x0410,0x0308,0x04D2},
+    {0x0413,0x0301,0x0403},{0x0415,0x0300,0x0400},{0x0415,0x0306,0x04D6},{0x0415,0x0308,0x0401},
+    {0x0416,0x0306,0x04C1},{0x0416,0x0308,0x04DC},{0x0417,0x0308,0x04DE},{0x0418,0x0300,0x040D},
+    {0x0418,0x0304,0x04E2},{0x0418,0x0306,0x0419},{0x0418,0x0308,0x04E4},{0x041A,0x0301,0x040C},
+    {0x041E,0x0308,0x04E6},{0x0423,0x0304,0x04EE},{0x0423,0x0306,0x040E},{0x0423,0x0308,0x04F0},
+    {0x0423,0x030B,0x04F2},{0x0427,0x0308,0x04F4},{0x042B,0x0308,0x04F8},{0x042D,0x0308,0x04EC},
+    {0x0430,0x0306,0x04D1},{0x0430,0x0308,0x04D3},{0x0433,0x0301,0x0453},{0x0435,0x0300,0x0450},
+    {0x0435,0x0306,0x04D7},{0x0435,0x0308,0x0451},{0x0436,0x0306,0x04C2},{0x0436,0x0308,0x04DD},
+    {0x0437,0x0308,0x04DF},{0x0438,0x0300,0x045D},{0x0438,0x0304,0x04E3},{0x0438,0x0306,0x0439},
+    {0x0438,0x0308,0x04E5},{0x043A,0x0301,0x045C},{0x043E,0x0308,0x04E7},{0x0443,0x0304,0x04EF},
+    {0x0443,0x0306,0x045E},{0x0443,0x0308,0x04F1},{0x0443,0x030B,0x04F3},{0x0447,0x0308,0x04F5},
+    {0x044B,0x0308,0x04F9},{0x044D,0x0308,0x04ED},{0x0456,0x0308,0x0457},{0x0474,0x030F,0x0476},
+    {0x0475,0x030F,0x0477},{0x04D8,0x0308,0x04DA},{0x04D9,0x0308,0x04DB},{0x04E8,0x0308,0x04EA},
+    {0x04E9,0x0308,0x04EB},{0x0627,0x0653,0x0622},{0x0627,0x0654,0x0623},{0x0627,0x0655,0x0625},
+    {0x0648,0x0654,0x0624},{0x064A,0x0654,0x0626},{0x06C1,0x0654,0x06C2},{0x06D2,0x0654,0x06D3},
+    {0x06D5,0x0654,0x06C0},{0x0928,0x093C,0x0929},{0x0930,0x093C,0x0931},{0x0933,0x093C,0x0934},
+    {0x09C7,0x09BE,0x09CB},{0x09C7,0x09D7,0x09CC},{0x0B47,0x0B3E,0x0B4B},{0x0B47,0x0B56,0x0B48},
+    {0x0B47,0x0B57,0x0B4C},{0x0B92,0x0BD7,0x0B94},{0x0BC6,0x0BBE,0x0BCA},{0x0BC6,0x0BD7,0x0BCC},
+    {0x0BC7,0x0BBE,0x0BCB},{0x0C46,0x0C56,0x0C48},{0x0CBF,0x0CD5,0x0CC0},{0x0CC6,0x0CC2,0x0CCA},
+    {0x0CC6,0x0CD5,0x0CC7},{0x0CC6,0x0CD6,0x0CC8},{0x0CCA,0x0CD5,0x0CCB},{0x0D46,0x0D3E,0x0D4A},
+    {0x0D46,0x0D57,0x0D4C},{0x0D47,0x0D3E,0x0D4B},{0x0DD9,0x0DCA,0x0DDA},{0x0DD9,0x0DCF,0x0DDC},
+    {0x0DD9,0x0DDF,0x0DDE},{0x0DDC,0x0DCA,0x0DDD},{0x1025,0x102E,0x1026},{0x1B05,0x1B35,0x1B06},
+    {0x1B07,0x1B35,0x1B08},{0x1B09,0x1B35,0x1B0A},{0x1B0B,0x1B35,0x1B0C},{0x1B0D,0x1B35,0x1B0E},
+    {0x1B11,0x1B35,0x1B12},{0x1B3A,0x1B35,0x1B3B},{0x1B3C,0x1B35,0x1B3D},{0x1B3E,0x1B35,0x1B40},
+    {0x1B3F,0x1B35,0x1B41},{0x1B42,0x1B35,0x1B43},{0x1E36,0x0304,0x1E38},{0x1E37,0x0304,0x1E39},
+    {0x1E5A,0x0304,0x1E5C},{0x1E5B,0x0304,0x1E5D},{0x1E62,0x0307,0x1E68},{0x1E63,0x0307,0x1E69},
+    {0x1EA0,0x0302,0x1EAC},{0x1EA0,0x0306,0x1EB6},{0x1EA1,0x0302,0x1EAD},{0x1EA1,0x0306,0x1EB7},
+    {0x1EB8,0x0302,0x1EC6},{0x1EB9,0x0302,0x1EC7},{0x1ECC,0x0302,0x1ED8},{0x1ECD,0x0302,0x1ED9},
+    {0x1F00,0x0300,0x1F02},{0x1F00,0x0301,0x1F04},{0x1F00,0x0342,0x1F06},{0x1F00,0x0345,0x1F80},
+    {0x1F01,0x0300,0x1F03},{0x1F01,0x0301,0x1F05},{0x1F01,0x0342,0x1F07},{0x1F01,0x0345,0x1F81},
+    {0x1F02,0x0345,0x1F82},{0x1F03,0x0345,0x1F83},{0x1F04,0x0345,0x1F84},{0x1F05,0x0345,0x1F85},
+    {0x1F06,0x0345,0x1F86},{0x1F07,0x0345,0x1F87},{0x1F08,0x0300,0x1F0A},{0x1F08,0x0301,0x1F0C},
+    {0x1F08,0x0342,0x1F0E},{0x1F08,0x0345,0x1F88},{0x1F09,0x0300,0x1F0B},{0x1F09,0x0301,0x1F0D},
+    {0x1F09,0x0342,0x1F0F},{0x1F09,0x0345,0x1F89},{0x1F0A,0x0345,0x1F8A},{0x1F0B,0x0345,0x1F8B},
+    {0x1F0C,0x0345,0x1F8C},{0x1F0D,0x0345,0x1F8D},{0x1F0E,0x0345,0x1F8E},{0x1F0F,0x0345,0x1F8F},
+    {0x1F10,0x0300,0x1F12},{0x1F10,0x0301,0x1F14},{0x1F11,0x0300,0x1F13},{0x1F11,0x0301,0x1F15},
+    {0x1F18,0x0300,0x1F1A},{0x1F18,0x0301,0x1F1C},{0x1F19,0x0300,0x1F1B},{0x1F19,0x0301,0x1F1D},
+    {0x1F20,0x0300,0x1F22},{0x1F20,0x0301,0x1F24},{0x1F20,0x0342,0x1F26},{0x1F20,0x0345,0x1F90},
+    {0x1F21,0x0300,0x1F23},{0x1F21,0x0301,0x1F25},{0x1F21,0x0342,0x1F27},{0x1F21,0x0345,0x1F91},
+    {0x1F22,0x0345,0x1F92},{0x1F23,0x0345,0x1F93},{0x1F24,0x0345,0x1F94},{0x1F25,0x0345,0x1F95},
+    {0x1F26,0x0345,0x1F96},{0x1F27,0x0345,0x1F97},{0x1F28,0x0300,0x1F2A},{0x1F28,0x0301,0x1F2C},
+    {0x1F28,0x0342,0x1F2E},{0x1F28,0x0345,0x1F98},{0x1F29,0x0300,0x1F2B},{0x1F29,0x0301,0x1F2D},
+    {0x1F29,0x0342,0x1F2F},{0x1F29,0x0345,0x1F99},{0x1F2A,0x0345,0x1F9A},{0x1F2B,0x0345,0x1F9B},
+    {0x1F2C,0x0345,0x1F9C},{0x1F2D,0x0345,0x1F9D},{0x1F2E,0x0345,0x1F9E},{0x1F2F,0x0345,0x1F9F},
+    {0x1F30,0x0300,0x1F32},{0x1F30,0x0301,0x1F34},{0x1F30,0x0342,0x1F36},{0x1F31,0x0300,0x1F33},
+    {0x1F31,0x0301,0x1F35},{0x1F31,0x0342,0x1F37},{0x1F38,0x0300,0x1F3A},{0x1F38,0x0301,0x1F3C},
+    {0x1F38,0x0342,0x1F3E},{0x1F39,0x0300,0x1F3B},{0x1F39,0x0301,0x1F3D},{0x1F39,0x0342,0x1F3F},
+    {0x1F40,0x0300,0x1F42},{0x1F40,0x0301,0x1F44},{0x1F41,0x0300,0x1F43},{0x1F41,0x0301,0x1F45},
+    {0x1F48,0x0300,0x1F4A},{0x1F48,0x0301,0x1F4C},{0x1F49,0x0300,0x1F4B},{0x1F49,0x0301,0x1F4D},
+    {0x1F50,0x0300,0x1F52},{0x1F50,0x0301,0x1F54},{0x1F50,0x0342,0x1F56},{0x1F51,0x0300,0x1F53},
+    {0x1F51,0x0301,0x1F55},{0x1F51,0x0342,0x1F57},{0x1F59,0x0300,0x1F5B},{0x1F59,0x0301,0x1F5D},
+    {0x1F59,0x0342,0x1F5F},{0x1F60,0x0300,0x1F62},{0x1F60,0x0301,0x1F64},{0x1F60,0x0342,0x1F66},
+    {0x1F60,0x0345,0x1FA0},{0x1F61,0x0300,0x1F63},{0x1F61,0x0301,0x1F65},{0x1F61,0x0342,0x1F67},
+    {0x1F61,0x0345,0x1FA1},{0x1F62,0x0345,0x1FA2},{0x1F63,0x0345,0x1FA3},{0x1F64,0x0345,0x1FA4},
+    {0x1F65,0x0345,0x1FA5},{0x1F66,0x0345,0x1FA6},{0x1F67,0x0345,0x1FA7},{0x1F68,0x0300,0x1F6A},
+    {0x1F68,0x0301,0x1F6C},{0x1F68,0x0342,0x1F6E},{0x1F68,0x0345,0x1FA8},{0x1F69,0x0300,0x1F6B},
+    {0x1F69,0x0301,0x1F6D},{0x1F69,0x0342,0x1F6F},{0x1F69,0x0345,0x1FA9},{0x1F6A,0x0345,0x1FAA},
+    {0x1F6B,0x0345,0x1FAB},{0x1F6C,0x0345,0x1FAC},{0x1F6D,0x0345,0x1FAD},{0x1F6E,0x0345,0x1FAE},
+    {0x1F6F,0x0345,0x1FAF},{0x1F70,0x0345,0x1FB2},{0x1F74,0x0345,0x1FC2},{0x1F7C,0x0345,0x1FF2},
+    {0x1FB6,0x0345,0x1FB7},{0x1FBF,0x0300,0x1FCD},{0x1FBF,0x0301,0x1FCE},{0x1FBF,0x0342,0x1FCF},
+    {0x1FC6,0x0345,0x1FC7},{0x1FF6,0x0345,0x1FF7},{0x1FFE,0x0300,0x1FDD},{0x1FFE,0x0301,0x1FDE},
+    {0x1FFE,0x0342,0x1FDF},{0x2190,0x0338,0x219A},{0x2192,0x0338,0x219B},{0x2194,0x0338,0x21AE},
+    {0x21D0,0x0338,0x21CD},{0x21D2,0x0338,0x21CF},{0x21D4,0x0338,0x21CE},{0x2203,0x0338,0x2204},
+    {0x2208,0x0338,0x2209},{0x220B,0x0338,0x220C},{0x2223,0x0338,0x2224},{0x2225,0x0338,0x2226},
+    {0x223C,0x0338,0x2241},{0x2243,0x0338,0x2244},{0x2245,0x0338,0x2247},{0x2248,0x0338,0x2249},
+    {0x224D,0x0338,0x226D},{0x2261,0x0338,0x2262},{0x2264,0x0338,0x2270},{0x2265,0x0338,0x2271},
+    {0x2272,0x0338,0x2274},{0x2273,0x0338,0x2275},{0x2276,0x0338,0x2278},{0x2277,0x0338,0x2279},
+    {0x227A,0x0338,0x2280},{0x227B,0x0338,0x2281},{0x227C,0x0338,0x22E0},{0x227D,0x0338,0x22E1},
+    {0x2282,0x0338,0x2284},{0x2283,0x0338,0x2285},{0x2286,0x0338,0x2288},{0x2287,0x0338,0x2289},
+    {0x2291,0x0338,0x22E2},{0x2292,0x0338,0x22E3},{0x22A2,0x0338,0x22AC},{0x22A8,0x0338,0x22AD},
+    {0x22A9,0x0338,0x22AE},{0x22AB,0x0338,0x22AF},{0x22B2,0x0338,0x22EA},{0x22B3,0x0338,0x22EB},
+    {0x22B4,0x0338,0x22EC},{0x22B5,0x0338,0x22ED},{0x3046,0x3099,0x3094},{0x304B,0x3099,0x304C},
+    {0x304D,0x3099,0x304E},{0x304F,0x3099,0x3050},{0x3051,0x3099,0x3052},{0x3053,0x3099,0x3054},
+    {0x3055,0x3099,0x3056},{0x3057,0x3099,0x3058},{0x3059,0x3099,0x305A},{0x305B,0x3099,0x305C},
+    {0x305D,0x3099,0x305E},{0x305F,0x3099,0x3060},{0x3061,0x3099,0x3062},{0x3064,0x3099,0x3065},
+    {0x3066,0x3099,0x3067},{0x3068,0x3099,0x3069},{0x306F,0x3099,0x3070},{0x306F,0x309A,0x3071},
+    {0x3072,0x3099,0x3073},{0x3072,0x309A,0x3074},{0x3075,0x3099,0x3076},{0x3075,0x309A,0x3077},
+    {0x3078,0x3099,0x3079},{0x3078,0x309A,0x307A},{0x307B,0x3099,0x307C},{0x307B,0x309A,0x307D},
+    {0x309D,0x3099,0x309E},{0x30A6,0x3099,0x30F4},{0x30AB,0x3099,0x30AC},{0x30AD,0x3099,0x30AE},
+    {0x30AF,0x3099,0x30B0},{0x30B1,0x3099,0x30B2},{0x30B3,0x3099,0x30B4},{0x30B5,0x3099,0x30B6},
+    {0x30B7,0x3099,0x30B8},{0x30B9,0x3099,0x30BA},{0x30BB,0x3099,0x30BC},{0x30BD,0x3099,0x30BE},
+    {0x30BF,0x3099,0x30C0},{0x30C1,0x3099,0x30C2},{0x30C4,0x3099,0x30C5},{0x30C6,0x3099,0x30C7},
+    {0x30C8,0x3099,0x30C9},{0x30CF,0x3099,0x30D0},{0x30CF,0x309A,0x30D1},{0x30D2,0x3099,0x30D3},
+    {0x30D2,0x309A,0x30D4},{0x30D5,0x3099,0x30D6},{0x30D5,0x309A,0x30D7},{0x30D8,0x3099,0x30D9},
+    {0x30D8,0x309A,0x30DA},{0x30DB,0x3099,0x30DC},{0x30DB,0x309A,0x30DD},{0x30EF,0x3099,0x30F7},
+    {0x30F0,0x3099,0x30F8},{0x30F1,0x3099,0x30F9},{0x30F2,0x3099,0x30FA},{0x30FD,0x3099,0x30FE},
+    {0x11099,0x110BA,0x1109A},{0x1109B,0x110BA,0x1109C},{0x110A5,0x110BA,0x110AB},{0x11131,0x11127,0x1112E},
+    {0x11132,0x11127,0x1112F},{0x11347,0x1133E,0x1134B},{0x11347,0x11357,0x1134C},{0x114B9,0x114B0,0x114BC},
+    {0x114B9,0x114BA,0x114BB},{0x114B9,0x114BD,0x114BE},{0x115B8,0x115AF,0x115BA},{0x115B9,0x115AF,0x115BB},
+    {0x11935,0x11930,0x11938},
+};
+
+#define HZ_UCD_COMPOSITION_COUNT 941
+
+#endif /* HZ_UCD_NORMALIZATION_H */
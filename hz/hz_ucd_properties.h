@@ -0,0 +1,1794 @@
+#ifndef HZ_UCD_PROPERTIES_H
+#define HZ_UCD_PROPERTIES_H
+
+#include <stdint.h>
+
+// Generated by generate_ucd_headers.c from DerivedGeneralCategory.txt, Scripts.txt, ScriptExtensions.txt,
+// DerivedBidiClass.txt, BidiMirroring.txt, LineBreak.txt, DerivedJoiningType.txt, ArabicShaping.txt
+// and UnicodeData.txt
+
+typedef struct {
+    int16_t mirror_offset; // Bidi_Mirroring_Glyph minus the codepoint, zero if there is none
+    uint8_t general_category; // hz_general_category_t
+    uint8_t script; // hz_script_t
+    uint8_t script_value; // script or HZ_UCD_SCRIPT_EXTENSIONS_BASE plus its extension set
+    uint8_t bidi_class; // hz_bidi_class_t
+    uint8_t line_break; // hz_line_break_class_t
+    uint8_t joining_type; // hz_joining_type_t flag is 1 << (16 + joining_type)
+    uint8_t joining_group; // hz_joining_group_t
+    uint8_t combining_class;
+} hz_ucd_record_t;
+
+#define HZ_UCD_PROPERTIES_SHIFT1 9
+#define HZ_UCD_PROPERTIES_SHIFT2 3
+#define HZ_UCD_PROPERTIES_MASK2 0x3f
+#define HZ_UCD_PROPERTIES_MASK3 0x7
+
+static const uint16_t hz_ucd_properties_stage1[2177] = {
+    0,64,128,192,256,320,384,448,512,576,640,704,768,832,896,960,
+    1024,1088,1152,1216,1280,1344,1408,1472,1536,1600,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1728,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1792,1856,1920,1984,2048,2112,2176,2240,2304,2368,2432,2496,2560,2176,2240,2304,
+    2368,2432,2496,2560,2176,2240,2304,2368,2432,2496,2560,2624,2688,2688,2688,2688,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2816,2880,2944,3008,
+    3072,3136,3200,3264,3328,3392,3456,3520,3584,3648,3712,3776,3840,3904,3968,4032,
+    4096,4160,4224,4288,4288,4288,4288,4352,4416,4480,4544,4288,4288,4288,4288,4288,
+    4288,4288,4608,4672,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4736,4800,4288,4864,4928,4928,4928,4928,4928,4928,4928,4928,
+    4928,4928,4928,4992,4928,5056,5120,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,5184,5248,5312,4288,4288,4288,4288,5376,4288,
+    4288,4288,4288,4288,4288,4288,4288,5440,5504,5568,5632,5696,5760,5824,4288,5888,
+    5952,6016,6080,6144,6208,6272,6336,6400,6464,6528,6592,6656,6720,6784,6848,6912,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,6976,1664,1664,1664,1664,1664,1664,1664,7040,7104,1664,1664,1664,
+    1664,1664,1664,1664,1664,1664,1664,7168,1664,1664,1664,1664,1664,1664,1664,1664,
+    1664,1664,1664,1664,1664,7232,6848,6848,6848,6848,6848,6848,1664,7296,6848,6912,
+    1664,1664,1664,1664,1664,1664,1664,1664,1664,7360,1664,1664,1664,1664,1664,1664,
+    1664,7424,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,
+    6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,
+    6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,
+    6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,
+    6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,
+    6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,
+    6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6848,6912,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    7552,7616,7616,7616,7616,7616,7616,7616,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,
+    4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,4288,7488,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,7680,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,
+    2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,2752,7680,
+    0,
+};
+
+static const uint16_t hz_ucd_properties_stage2[7745] = {
+    0,8,0,16,24,32,40,48,56,64,64,72,80,88,88,96,
+    104,0,0,0,112,120,128,136,64,64,144,152,88,88,160,88,
+    168,168,168,168,168,168,168,176,176,184,168,168,168,168,168,192,
+    200,208,216,224,232,240,248,256,264,272,176,280,168,168,288,168,
+    168,168,168,168,168,168,296,304,312,168,88,88,88,88,88,88,
+    88,88,320,88,88,88,328,336,344,352,360,368,376,384,392,392,
+    400,400,408,416,424,432,440,448,456,464,472,480,488,496,504,512,
+    520,528,536,544,552,560,568,568,568,576,584,592,600,608,616,624,
+    632,632,632,632,632,632,640,640,640,640,640,640,648,648,648,648,
+    656,664,648,648,648,648,648,648,672,680,648,648,648,648,648,648,
+    648,648,648,648,648,648,688,696,696,696,704,712,720,720,720,720,
+    720,728,736,744,752,760,768,776,784,792,800,800,800,808,816,792,
+    824,832,840,848,856,864,872,880,888,896,904,912,920,928,936,944,
+    952,960,968,976,984,992,1000,1008,1016,1024,1032,1040,1048,1056,1064,1072,
+    1080,1088,1096,1104,1112,1120,1128,1136,1144,1152,1160,1168,1176,1184,1192,1200,
+    1208,1208,1208,1208,1216,1224,1232,1240,1248,1256,1264,1264,1264,1272,1280,1288,
+    1296,1296,1304,1312,1320,1328,1336,1344,1352,1360,1368,1376,1384,1392,1400,1400,
+    1408,1416,1424,1432,1440,1448,1456,1464,1472,1480,1488,840,1496,1504,1512,1520,
+    1528,1536,1536,1536,1536,1536,1536,1544,1552,1560,1568,1536,1576,1584,1592,1536,
+    1600,1608,1616,1624,1624,1632,1640,1648,1656,1664,1672,1680,1688,1696,1704,1712,
+    1720,1728,1736,1744,1744,1752,1760,1768,1776,1784,1792,1800,1808,1816,1824,1832,
+    1840,1848,1856,1864,1864,1872,1880,1888,1896,1904,1912,1832,1920,1928,1936,1944,
+    1952,1960,1968,1976,1976,1984,1992,2000,2008,2016,2024,2032,2040,2048,2056,1832,
+    2064,2072,2080,2088,2096,2072,2104,2112,2120,2128,2136,1832,2144,2152,2160,2168,
+    2176,2184,2192,2200,2200,2192,2200,2208,2216,2224,2232,2240,2248,2256,2264,2272,
+    2280,2288,2296,2304,2304,2296,2312,2320,2328,2336,2344,2352,2360,2368,2376,1832,
+    2384,2392,2400,2408,2408,2408,2408,2416,2424,2432,2440,2448,2456,2464,2472,2480,
+    2488,2496,2504,2512,2496,2496,2520,2528,2504,2536,2544,2552,2560,2568,2576,1832,
+    2584,2592,2592,2592,2592,2592,2600,2608,2616,2624,2632,2640,1832,1832,1832,1832,
+    2648,2656,2664,2664,2672,2664,2680,2688,2696,2704,2712,2720,1832,1832,1832,1832,
+    2728,2736,2744,2752,2760,2768,2776,2784,2792,2800,2792,2792,2792,2808,2816,2824,
+    2832,2840,2848,2856,2848,2848,2848,2864,2872,2880,2888,2896,1832,1832,1832,1832,
+    2904,2904,2904,2904,2904,2912,2920,2928,2936,2944,2952,2960,2968,2976,2984,2904,
+    2992,3000,3008,3016,3024,3024,3024,3024,3032,3040,3048,3048,3048,3048,3048,3056,
+    3064,3064,3064,3064,3064,3064,3064,3064,3064,3064,3064,3064,3072,3072,3072,3072,
+    3072,3072,3072,3072,3072,3080,3080,3080,3080,3080,3080,3080,3080,3080,3080,3080,
+    3088,3088,3088,3088,3088,3088,3088,3088,3088,3096,3104,3096,3088,3088,3088,3088,
+    3088,3096,3088,3088,3088,3088,3096,3104,3096,3088,3104,3088,3088,3088,3088,3088,
+    3088,3088,3096,3088,3088,3088,3088,3088,3088,3088,3088,3112,3120,3128,3136,3144,
+    3088,3088,3152,3160,3168,3168,3168,3168,3168,3168,3168,3168,3168,3168,3176,3184,
+    3192,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,
+    3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,
+    3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,
+    3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,
+    3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3200,3208,3200,3200,
+    3216,3224,3224,3232,3240,3240,3240,3240,3240,3240,3240,3240,3240,3248,3256,3264,
+    3272,3272,3280,3288,3296,3296,3304,1832,3312,3312,3320,1832,3328,3336,3344,1832,
+    3352,3352,3352,3352,3352,3352,3360,3368,3376,3384,3392,3400,3408,3416,3424,3432,
+    3440,3448,3456,3464,3472,3472,3472,3472,3480,3472,3472,3472,3472,3472,3472,3488,
+    3496,3472,3472,3472,3472,3504,3200,3200,3200,3200,3200,3200,3200,3200,3512,1832,
+    3520,3520,3520,3528,3536,3544,3552,3560,3568,3576,3584,3584,3584,3592,3600,1832,
+    3608,3608,3608,3608,3608,3616,3608,3608,3608,3624,3632,3640,3648,3648,3648,3648,
+    3656,3656,3664,3672,3680,3680,3680,3680,3680,3680,3688,3696,3704,3712,3720,3728,
+    3736,3744,3736,3744,3752,3760,3768,3776,3784,3792,1832,1832,1832,1832,1832,1832,
+    3800,3808,3808,3808,3808,3808,3816,3824,3832,3840,3848,3856,3864,3872,3880,3888,
+    3896,3904,3904,3904,3912,3920,3928,3936,3944,3944,3944,3944,3952,3960,3968,3976,
+    3984,3984,3984,3984,3992,4000,4008,4016,4024,4032,4040,4048,4056,4056,4056,4064,
+    640,4072,3024,3024,3024,3024,3024,4080,4088,1832,4096,4104,4112,4120,4128,4136,
+    88,88,88,88,4144,4152,328,328,328,328,328,4160,4168,4176,88,4184,
+    88,88,88,4192,328,328,328,4200,4208,4216,4224,400,400,400,4232,4240,
+    168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,168,
+    168,168,4248,4256,168,168,168,168,168,168,168,168,168,168,168,168,
+    568,544,4264,4272,568,544,568,544,4264,4272,568,4280,568,544,568,4264,
+    568,4288,568,4288,568,4288,4296,4304,4312,4320,4328,4336,568,4344,4352,4360,
+    4368,4376,4384,4392,4400,4408,4416,4424,4432,4440,4448,4456,4464,4472,4480,4488,
+    4496,4504,328,4512,4520,4528,4536,4544,4552,4560,4568,4576,4584,4592,4600,1832,
+    4608,4616,4624,4632,4640,4648,4656,4664,4672,4680,4688,4696,4704,4712,4704,4720,
+    4728,4736,4744,4752,4760,4768,4776,4776,4776,4784,4792,4776,4776,4776,4800,4808,
+    4816,4824,4832,4840,4848,4856,4864,4872,4880,4888,4896,4808,4904,4912,4920,4920,
+    4928,4936,4944,4952,4960,4968,4920,4976,4808,4984,4992,4920,4920,5000,5008,5016,
+    4776,5024,5032,5040,5048,5056,5064,5072,5072,5072,5072,5072,5072,5072,5072,5080,
+    4776,4776,5088,5096,4808,4808,5104,4776,4776,4776,4776,4800,5048,4776,5112,4776,
+    4776,4776,4776,4776,5120,1832,1832,1832,4776,5128,1832,1832,5136,5136,5136,5136,
+    5136,5144,5144,5152,5160,5160,5160,5160,5160,5160,5160,5160,5160,5168,5136,5176,
+    5184,5184,5184,5184,5184,5184,5184,5184,5184,5192,5184,5184,5184,5184,5200,4776,
+    5184,5184,5208,4776,5216,5224,5232,5240,5248,5256,5224,4776,5208,5264,4776,4808,
+    5272,5280,5288,5296,4776,4776,4776,5304,5312,4776,4776,4776,5320,5328,4776,5336,
+    4776,4776,4776,5344,4776,5352,4776,5360,5368,5376,5384,5392,5400,5408,5416,5424,
+    5432,5440,4776,4776,4776,4776,4776,4776,4776,4776,5264,5448,5456,5464,5472,5136,
+    5136,5136,5480,4776,4776,4776,4776,4776,5488,5496,5504,5512,5520,5464,4808,4808,
+    5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,
+    5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,5528,
+    4808,4808,4808,4808,4808,4808,4808,4808,4808,4808,4808,4808,4808,4808,4808,4808,
+    5536,5544,5552,5560,5568,4920,4808,5576,5584,5592,5600,5608,4808,5616,5624,5632,
+    4808,4808,4808,4808,4808,5640,5648,5648,4808,4808,4808,4808,5648,4808,4808,5656,
+    5664,5664,5664,5664,5672,5680,5664,5664,5664,5664,5688,5696,5704,5712,5592,5720,
+    4776,4776,4776,4776,4776,4776,4808,4808,5728,5736,5744,5224,4776,4776,5752,4776,
+    4776,4776,5760,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,5768,
+    5776,5776,5776,5776,5776,5776,5784,5784,5784,5784,5784,5784,5792,5800,5808,5816,
+    608,608,608,608,608,608,608,608,608,608,608,608,5824,5832,5840,5848,
+    3048,3048,3048,3048,5856,5864,5872,5872,5872,5872,5872,5872,5872,5880,5888,5896,
+    3088,3088,3104,1832,3104,3104,3104,3104,3104,3104,3104,3104,5904,5904,5904,5904,
+    5912,5920,5928,5936,5944,5952,5960,5968,5976,5984,5992,6000,1832,1832,1832,1832,
+    6008,6008,6008,6016,6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6024,1832,
+    6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,
+    6008,6008,6008,6008,6008,6008,6008,6008,6008,6008,6032,1832,1832,1832,5368,6040,
+    6048,6056,6064,6072,6080,6088,6096,6104,6112,6120,6128,6128,6136,6128,6128,6128,
+    6144,6152,6160,6168,6176,6184,6192,6192,6200,6192,6192,6192,6208,6216,6224,6232,
+    6240,6248,6248,6248,6248,6248,6256,6264,6264,6264,6264,6264,6264,6264,6264,6264,
+    6264,6272,6280,6288,6248,6248,6248,6248,6296,6296,6296,6296,6304,1832,6312,6312,
+    6320,6320,6320,6328,6336,6344,6288,6288,6288,6352,6360,6368,6320,6320,6320,6376,
+    6336,6344,6288,6288,6288,6288,6384,6368,6288,6392,6400,6400,6400,6400,6400,6408,
+    6400,6400,6400,6400,6400,6400,6400,6400,6400,6400,6400,6288,6288,6288,6416,6424,
+    6432,6432,6432,6432,6432,6432,6432,6432,6432,6432,6432,6440,6288,6288,6288,6448,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,4776,4776,4776,4776,4776,4776,4776,4776,
+    6464,6464,6472,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,6464,
+    6464,6480,6488,6488,6488,6488,6488,6488,6496,1832,6504,6504,6504,6504,6504,6512,
+    6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,
+    6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,6520,
+    6520,6528,6520,6520,6536,6544,1832,1832,648,648,648,648,648,6552,6560,6568,
+    648,648,648,6576,6584,6584,6584,6584,6584,6584,6584,6584,6592,6600,6608,1832,
+    6616,392,6624,6632,6640,168,184,168,168,168,168,168,168,168,6648,6656,
+    168,6664,6672,168,168,6680,6688,168,6696,6704,6712,6720,1832,1832,6728,6736,
+    6744,6752,6760,6760,6768,6776,6784,6792,6800,6800,6800,6800,6800,6800,6808,1832,
+    6816,6824,6824,6824,6824,6824,6832,6840,6848,6856,6864,6872,6880,6880,6888,6896,
+    6904,6912,6920,6920,6928,6936,6944,6944,6952,6960,6968,6976,3064,3064,3064,6984,
+    6992,7000,7000,7000,7000,7000,7008,7016,7024,7032,7040,7048,7056,2904,3008,7064,
+    7072,7072,7072,7072,7072,7080,7088,1832,7096,7104,7112,7120,2904,2904,7128,7136,
+    7144,7144,7144,7144,7144,7144,7152,7160,7168,1832,1832,7176,7184,7192,7200,1832,
+    7208,7208,7208,1832,3104,3104,88,88,88,88,88,7216,7224,7232,7240,7240,
+    7240,7240,7240,7240,7240,7240,7240,7240,7184,7184,7184,7184,7248,7256,7264,7272,
+    7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,
+    7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,
+    7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,
+    7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,
+    7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,
+    7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,
+    7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,
+    7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,
+    7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,
+    7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,
+    7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,
+    7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,
+    7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,
+    7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,
+    7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,
+    7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,
+    7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,
+    7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,
+    7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,
+    7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,
+    7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,
+    7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,
+    7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,
+    7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,
+    7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,
+    7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,
+    7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,
+    7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,
+    7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,
+    7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,
+    7288,7288,7288,7280,7288,7288,7296,7288,7288,7288,7280,7288,7288,7296,7288,7288,
+    7288,7280,7288,7288,7304,1832,3072,3072,7312,7320,3080,3080,3080,3080,3080,7328,
+    7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,
+    7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,
+    7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,
+    7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,7336,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,7352,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,7360,7368,7368,7368,7368,
+    7376,1832,7384,7392,800,7400,7408,7416,7424,800,7432,7432,7432,7432,7432,7432,
+    7432,7432,7432,7432,7432,7432,7440,7448,7456,1240,7464,7432,7432,7432,7432,7432,
+    7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,
+    7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,
+    7432,7432,7432,7432,7432,7432,7432,7472,7480,7480,7432,7432,7432,7432,7432,7432,
+    7432,7432,7488,7432,7432,7432,7432,7432,7432,7496,7504,7504,7504,7504,7512,7520,
+    7528,7528,7536,7544,7552,7560,7568,7576,7584,7592,7600,7608,7616,7624,7632,7432,
+    7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7432,7640,
+    7648,7656,7664,7672,7680,7688,7688,7696,7704,7712,7712,7720,7728,6312,7736,6192,
+    6192,6192,6192,7744,6264,6264,6264,6272,7752,7752,7752,7760,7768,7776,7504,7784,
+    7792,7800,7792,7792,7808,7792,7792,7816,7792,7824,7792,7824,1832,1832,1832,1832,
+    7792,7792,7792,7792,7792,7792,7792,7792,7792,7792,7792,7792,7792,7792,7792,7832,
+    7840,7848,7848,7848,7848,7848,7856,7864,7872,7872,7872,7872,7872,7872,7880,7888,
+    7896,7904,4776,7912,7920,1832,1832,1832,1832,1832,5072,5072,5072,5072,5072,7928,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    7936,7936,7936,7944,7952,7952,7952,7952,7952,7952,7960,1832,7968,7976,7976,7984,
+    7992,7992,7992,7992,8000,8008,8016,8016,8024,8032,8040,8040,8040,8040,8048,8056,
+    8064,8064,8064,8072,8080,8080,8080,8080,8088,8080,8096,1832,1832,1832,1832,1832,
+    8104,8104,8104,8104,8104,8112,8112,8112,8112,8112,8120,8120,8120,8120,8120,8120,
+    8128,8128,8128,8136,8144,8152,8160,8160,8160,8160,8168,8176,8176,8176,8176,8184,
+    8192,8192,8192,8192,8192,1832,8200,8200,8200,8200,8200,8200,8208,8216,8224,8232,
+    8224,8232,8240,8248,8256,8248,8256,8264,1832,1832,1832,1832,1832,1832,1832,1832,
+    8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,
+    8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,8272,
+    8272,8272,8272,8272,8272,8272,8280,1832,8272,8272,8288,1832,8272,1832,1832,1832,
+    8296,328,328,328,328,328,8304,8312,1832,1832,1832,1832,1832,1832,1832,1832,
+    8320,8328,8336,8336,8336,8336,8344,8352,8360,8360,8368,8376,8384,8384,8392,8400,
+    8408,8408,8408,8416,8424,8432,792,792,792,792,792,792,8440,8440,8448,8456,
+    8464,8464,8472,8480,8488,8488,8488,8496,792,792,792,792,792,792,792,792,
+    8504,8504,8504,8504,8512,8512,8512,8520,8528,8528,8536,8528,8528,8528,8528,8528,
+    8544,8552,8560,8568,8576,8576,8584,8592,8600,8608,8616,8624,8632,8632,8632,8640,
+    8648,8648,8648,8656,792,792,792,792,8664,8672,8680,8688,8696,8704,8712,792,
+    8720,8720,8720,8720,8720,8720,8728,8736,8744,8744,8752,8760,8768,8768,8776,8784,
+    8792,8800,8808,8816,792,8824,792,792,792,792,792,792,792,792,792,792,
+    8832,8832,8832,8832,8832,8832,8832,8832,8832,8840,792,792,792,792,792,792,
+    8848,8848,8848,8848,8848,8848,8856,792,8864,8864,8864,8864,8864,8864,8872,8880,
+    8888,8896,8904,8912,8920,1240,8928,8936,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,8944,8944,8944,8952,
+    8960,8960,8960,8960,8960,8968,8976,792,1240,1240,1240,1240,1240,1240,1240,8984,
+    8992,8992,8992,9000,9008,792,9016,9024,9032,9040,9048,9056,1240,1240,9064,9072,
+    9080,9088,792,792,792,792,9096,9104,9112,9120,792,792,9128,9128,9136,792,
+    9144,9152,9152,9152,9152,9152,9152,9160,9168,9176,9184,9192,9200,9208,9216,9224,
+    9232,9240,9240,9240,9240,9240,9248,9256,9264,9272,9280,9280,9280,9288,9296,9304,
+    9312,9320,9320,9320,9328,9336,9344,9352,9360,1832,9368,9368,9368,9368,9376,1832,
+    9384,9392,9392,9392,9392,9392,9400,9408,9416,9424,9432,9440,9448,9456,9464,1832,
+    9472,9472,9480,9472,9472,9488,9496,9504,9512,1832,1832,1832,1832,1832,1832,1832,
+    9520,9528,9536,9544,9536,9552,9560,9560,9560,9560,9560,9568,9576,9584,9592,9600,
+    9608,9616,9624,9632,9632,9640,9648,9656,9664,9672,9680,9688,9696,9704,9704,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    9712,9712,9712,9712,9712,9712,9720,9728,9736,9744,9752,9760,9768,1832,1832,1832,
+    9776,9776,9776,9776,9776,9776,9784,9792,9800,1832,9808,9816,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    9824,9824,9824,9824,9824,9832,9840,9848,9856,9864,9872,9880,1832,1832,1832,1832,
+    9888,9888,9888,9888,9888,9888,9896,9904,9912,1832,9920,9928,9936,9944,1832,1832,
+    9952,9952,9952,9952,9952,9960,9968,9976,9984,9992,1832,1832,1832,1832,1832,1832,
+    10000,10000,10000,10008,10016,10024,10032,10040,10048,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    10056,10056,10056,10056,10056,10064,10072,10080,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,10088,10088,10088,10088,10096,10096,10096,10096,10104,10112,10120,10128,
+    10136,10144,10152,10160,10160,10160,10168,10176,10184,1832,10192,10200,1832,1832,1832,1832,
+    1832,1832,1832,1832,10208,10216,10208,10208,10208,10208,10224,10232,10240,1832,1832,1832,
+    10248,10256,10264,10264,10264,10264,10272,10280,10288,1832,10296,10304,10312,10312,10312,10312,
+    10312,10320,10328,10336,10344,1832,3200,3200,10352,10352,10352,10352,10352,10352,10352,10360,
+    10368,10376,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    10384,10392,10384,10384,10384,10400,10408,10416,10424,1832,10432,10440,10448,10456,10464,10472,
+    10472,10472,10480,10488,10488,10496,10504,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    10512,10520,10528,10528,10528,10528,10536,10544,10552,1832,10560,10568,10576,10584,10592,10592,
+    10592,10600,10608,10616,10624,10632,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,10640,10640,10648,10656,
+    10664,10672,10680,10672,10672,10672,10688,10696,10704,10712,10720,10728,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,10736,1832,10744,10744,10752,10760,10768,10776,10784,10792,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10808,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    10816,10816,10816,10816,10816,10816,10816,10816,10816,10816,10816,10816,10816,10824,10832,1832,
+    10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,10800,
+    10800,10800,10800,10800,10800,10800,10800,10800,10840,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,10848,10848,10848,10848,10848,10848,10848,10848,10848,10848,10848,10848,10856,1832,
+    10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,
+    10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,
+    10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,
+    10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,
+    10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10872,10864,10864,10864,10864,
+    10880,10888,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,
+    10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10896,
+    10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,10864,
+    10864,10864,10864,10864,10864,10864,10904,10912,10920,10928,10936,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,
+    10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,
+    10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,10944,
+    10944,10944,10944,10944,10944,10944,10944,10944,10944,10952,10944,10944,10944,10944,10944,10944,
+    10944,10944,10944,10944,10944,10944,10944,10944,10960,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,
+    6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,
+    6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,
+    6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,6584,
+    6584,6584,6584,6584,6584,6584,6584,10968,10976,10976,10976,10984,10992,11000,11008,11008,
+    11008,11008,11008,11008,11008,11008,11008,11016,11024,11032,11040,11040,11040,11048,11056,1832,
+    11064,11064,11064,11064,11064,11064,11072,11080,11088,1832,11096,11104,11112,11064,11064,11120,
+    11064,11064,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,11128,11128,11128,11128,11136,11136,11136,11136,
+    11144,11144,11152,11160,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    11168,11168,11168,11168,11168,11168,11168,11168,11168,11176,11184,11192,11192,11192,11192,11192,
+    11192,11200,11208,11216,1832,1832,1832,1832,1832,1832,1832,1832,11224,1832,11232,1832,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,1832,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,11240,
+    11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,
+    11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,
+    11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,
+    11248,11248,11248,11248,11248,11248,11248,11248,11248,11248,11256,1832,1832,1832,1832,1832,
+    11240,11264,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,11272,11280,
+    11288,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,
+    6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,6128,
+    6128,6128,6128,6128,11296,1832,11304,1832,1832,1832,11312,1832,11320,1832,11328,11328,
+    11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,
+    11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,
+    11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11328,11336,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    11344,11344,11344,11344,11344,11344,11344,11344,11344,11344,11344,11344,11344,11352,11344,11360,
+    11344,11368,11344,11376,11384,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    7528,7528,7528,7528,7528,11392,7528,7528,11400,1832,5072,5072,5072,5072,5072,5072,
+    5072,5072,5072,5072,5072,5072,5072,5072,11408,1832,1832,1832,1832,1832,1832,1832,
+    5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,
+    5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,5072,11416,1832,
+    5072,5072,5072,5072,11424,11432,5072,5072,5072,5072,5072,5072,11440,11448,11456,11464,
+    11472,11480,5072,5072,5072,11488,5072,5072,5072,5072,5072,5072,5072,11496,1832,1832,
+    7896,7896,7896,7896,7896,7896,7896,7896,11504,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,11512,11512,11520,1832,11512,11512,11520,1832,
+    4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,5120,1832,11528,11528,11536,11544,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    11552,11552,11552,11560,11568,11568,11576,11552,11552,11584,11592,11568,11568,11552,11552,11552,
+    11560,11568,11568,11600,11608,11616,11584,11624,11632,11568,11552,11552,11552,11560,11568,11568,
+    11640,11648,11656,11664,11568,11568,11568,11672,11680,11688,11696,11568,11568,11576,11552,11552,
+    11584,11568,11568,11568,11552,11552,11552,11560,11568,11568,11576,11552,11552,11584,11568,11568,
+    11568,11552,11552,11552,11560,11568,11568,11576,11552,11552,11584,11568,11568,11568,11552,11552,
+    11552,11560,11568,11568,11704,11552,11552,11552,11712,11568,11568,11720,11728,11552,11552,11736,
+    11568,11568,11744,11576,11552,11552,11752,11568,11568,11760,11768,11552,11552,11776,11568,11568,
+    11568,11784,11552,11552,11552,11712,11568,11568,11720,11792,40,40,40,40,40,40,
+    11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,
+    11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,
+    11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,
+    11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,11800,
+    11808,11808,11808,11808,11808,11808,11816,11824,11808,11808,11808,11808,11808,11832,11840,11800,
+    11848,11856,1832,11864,11872,11808,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    88,11880,88,7376,11888,11896,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    11904,11912,11912,11920,11928,11936,11944,11944,11944,11944,11944,11944,11944,11952,1832,1832,
+    1832,11960,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    11968,11968,11968,11968,11968,11976,11984,11992,12000,12008,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,12016,12016,12016,12024,1832,1832,12032,12032,12032,12032,12032,12040,12048,12056,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,12064,12064,12064,12072,12080,12088,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,3104,12096,3088,3104,
+    12104,12104,12104,12104,12104,12104,12104,12104,12104,12104,12104,12104,12104,12104,12104,12104,
+    12104,12104,12104,12104,12104,12104,12104,12104,12112,12120,12128,792,792,792,792,792,
+    12136,12136,12136,12136,12144,12152,12152,12152,12160,12168,12176,12184,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,12192,12200,
+    12200,12200,12200,12200,12200,12208,12216,1240,792,792,792,792,792,792,792,792,
+    12192,12200,12200,12200,12200,12224,12200,12232,1240,1240,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    12240,7432,7432,7432,12248,12256,12264,12272,12280,12288,12248,12296,12248,12264,12264,12304,
+    7432,12312,7432,12320,12328,12312,7432,12320,1240,1240,1240,1240,1240,1240,12336,1240,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,792,
+    5368,5368,5368,5368,5368,12344,5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,
+    5368,5368,12344,7368,5368,12352,12360,5368,12360,5368,12360,5368,5368,5368,12368,7368,
+    5144,12376,5160,5160,5160,12384,5160,5160,5160,5160,5160,5160,5160,12392,5160,5160,
+    5160,5160,5160,5160,5160,12400,7368,7368,7368,7368,7368,7368,12408,12416,12416,12416,
+    12424,7368,6432,6432,6432,6432,6432,12432,6432,12440,12448,7368,12368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,5368,
+    12456,5368,5368,12464,5368,5368,12472,12480,12488,12496,5368,5368,5368,5368,5368,12504,
+    5368,5368,5368,5368,5368,5368,5368,5368,12512,12520,12528,5368,12536,12520,12520,12544,
+    12552,12560,12568,5368,12576,12584,12592,5368,5368,5368,5368,5368,5368,5368,5368,5368,
+    5336,5368,12600,4776,5360,5368,12608,4776,4776,12616,5368,5368,5368,5368,12624,12632,
+    5368,5368,12640,5368,5368,5368,5368,5368,5368,5368,5112,12648,5368,5368,5112,12616,
+    5368,5368,5368,5368,5368,5368,5368,5368,12656,12664,4776,4776,4776,4776,12672,12680,
+    5368,5368,5368,5368,12688,5368,12696,5368,12528,12704,5368,12712,5368,12720,5368,12720,
+    4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,12728,12736,
+    4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,5360,12744,5368,12344,12752,7368,
+    4776,12760,4776,4776,4776,4776,4776,4776,4776,7368,4776,12768,4776,4776,4776,4776,
+    4776,7368,4776,4776,4776,12776,12744,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    4776,12784,5368,12520,12792,5368,12520,12800,5368,5368,5368,5368,5368,5368,12560,5368,
+    5368,5368,5368,5368,5368,5368,12808,12816,5368,12656,12824,12832,5368,5368,5368,5368,
+    4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,12760,7368,5368,12368,5368,12720,
+    5368,12752,5368,5368,5368,5368,5368,12840,12848,12856,5368,12344,5368,12752,12520,12864,
+    4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,4776,
+    4776,4776,12872,4776,4776,4776,4776,4776,4776,5128,1832,1832,1832,1832,40,12880,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,12888,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,7368,7368,7368,7368,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,7360,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,7352,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,7360,7368,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,12896,7368,7368,7368,
+    6456,6456,6456,7352,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,12904,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,6456,
+    6456,6456,6456,6456,6456,6456,7368,7368,7368,7368,7368,7368,7368,7368,7368,7368,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,
+    1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,1832,12912,
+    12920,7504,7504,7504,12928,12928,12928,12928,12928,12928,12928,12928,12928,12928,12928,12928,
+    7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,
+    7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,
+    7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7528,7504,7504,
+    7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,
+    7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,
+    7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,
+    7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,7504,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,
+    7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,7344,12936,
+    0,
+};
+
+static const uint16_t hz_ucd_properties_stage3[12945] = {
+    1,1,1,1,1,1,1,1,1,2,3,4,5,6,1,1,
+    1,1,1,1,7,7,7,8,9,10,11,12,13,14,15,11,
+    16,17,15,18,19,20,19,21,22,22,22,22,22,22,22,22,
+    22,22,19,23,24,25,26,10,15,27,27,27,27,27,27,27,
+    27,27,27,27,27,27,27,27,27,27,27,28,29,30,31,32,
+    31,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+    33,33,33,28,34,35,25,1,1,1,1,1,1,36,1,1,
+    37,38,39,13,13,13,40,41,42,40,43,44,25,45,40,31,
+    46,47,48,48,49,50,41,41,42,48,43,51,52,52,52,38,
+    27,27,27,27,27,27,27,53,27,27,27,27,27,27,27,33,
+    33,33,33,33,33,33,33,53,27,33,27,33,27,33,27,33,
+    33,27,33,27,33,27,33,27,33,33,27,33,27,33,27,33,
+    27,27,33,27,33,27,33,33,33,27,27,33,27,33,27,27,
+    33,27,27,27,33,33,27,27,27,27,33,27,27,33,27,27,
+    27,33,33,33,27,27,33,27,27,33,27,33,27,33,27,27,
+    33,27,33,33,27,33,27,27,33,27,27,27,33,27,33,27,
+    27,33,33,54,27,33,33,33,54,54,54,54,27,55,33,27,
+    55,33,27,55,33,27,33,27,33,27,33,27,33,33,27,33,
+    33,27,55,33,27,33,27,27,27,33,27,33,33,33,33,33,
+    33,33,27,27,33,27,27,33,33,27,33,27,27,27,27,33,
+    33,33,33,33,54,33,33,33,56,56,56,56,56,56,56,56,
+    56,57,57,58,58,58,58,58,58,58,31,31,31,31,57,59,
+    60,59,59,59,60,59,57,57,61,58,31,31,31,31,31,31,
+    42,42,42,42,31,42,31,49,56,56,56,56,56,31,31,31,
+    31,31,62,62,57,31,58,31,31,31,31,31,31,31,31,31,
+    63,63,63,63,63,63,63,63,63,63,63,63,63,64,65,65,
+    65,65,64,66,65,65,65,65,65,67,67,65,65,65,65,67,
+    67,65,65,65,65,65,65,65,65,65,65,65,68,68,68,68,
+    68,65,65,65,65,63,63,63,63,63,69,63,63,70,63,65,
+    65,65,63,63,63,65,65,71,63,63,63,65,65,65,65,63,
+    64,65,65,63,72,73,73,72,73,73,72,74,74,74,74,74,
+    74,74,74,74,74,74,74,74,75,76,75,76,57,77,75,76,
+    78,78,79,76,76,76,23,75,78,78,78,78,77,31,75,15,
+    75,75,75,78,75,78,75,75,76,75,75,75,75,75,75,75,
+    75,75,75,75,75,75,75,75,75,75,78,75,75,75,75,75,
+    75,75,75,75,76,76,76,76,76,76,76,76,76,76,76,76,
+    76,76,76,76,76,76,76,75,76,76,75,75,75,76,76,76,
+    75,76,75,76,75,76,75,76,75,76,80,81,80,81,80,81,
+    80,81,80,81,80,81,80,81,76,76,76,76,75,76,82,75,
+    76,75,75,76,76,75,75,75,83,83,83,83,83,83,83,83,
+    84,84,84,84,84,84,84,84,83,84,83,84,83,84,83,84,
+    83,84,85,86,87,88,88,87,89,89,83,84,83,84,83,84,
+    83,83,84,83,84,83,84,83,84,83,84,83,84,83,84,84,
+    78,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+    90,90,90,90,90,90,90,78,78,91,92,92,92,92,92,92,
+    93,93,93,93,93,93,93,93,93,94,95,78,78,96,96,97,
+    98,99,100,100,100,100,99,100,100,100,101,99,100,100,100,100,
+    100,100,99,99,99,99,99,99,100,100,99,100,100,101,102,100,
+    103,104,105,106,107,108,109,110,111,112,112,113,114,115,116,117,
+    118,119,120,118,100,99,121,111,98,98,98,98,98,98,98,98,
+    122,122,122,122,122,122,122,122,122,122,122,98,98,98,98,122,
+    122,122,122,118,118,98,98,98,123,123,123,123,123,124,125,125,
+    126,127,127,128,129,130,131,131,132,132,132,132,132,132,132,132,
+    133,134,135,136,137,138,138,139,140,141,142,142,143,142,140,142,
+    144,145,144,144,146,146,146,147,147,148,148,149,149,150,150,151,
+    151,152,152,153,153,154,154,154,155,156,157,158,159,160,161,162,
+    143,140,140,163,164,165,166,167,168,169,170,171,171,172,173,132,
+    132,132,132,132,173,132,132,173,174,174,174,174,174,174,174,174,
+    174,174,127,175,175,176,144,157,177,142,142,142,141,142,143,143,
+    140,144,144,144,144,144,144,144,144,146,146,146,146,146,146,146,
+    147,147,147,147,147,147,147,147,147,148,148,148,148,148,148,148,
+    148,148,149,149,149,150,150,151,152,156,156,156,156,156,156,157,
+    157,153,178,153,158,158,158,153,153,153,153,153,153,159,159,159,
+    159,161,161,161,161,179,180,146,145,181,181,182,143,143,143,143,
+    143,143,143,143,154,183,154,143,140,140,184,184,185,145,132,132,
+    132,132,132,132,132,124,131,132,132,132,132,173,132,186,186,132,
+    132,131,173,132,132,173,147,148,187,187,187,187,187,187,187,187,
+    187,187,149,150,152,188,188,180,189,189,189,189,189,189,189,189,
+    189,189,189,189,189,189,190,191,192,193,194,195,195,196,196,197,
+    198,199,200,201,201,202,203,204,205,206,207,208,209,210,211,212,
+    213,214,196,215,216,194,195,196,217,218,217,217,218,217,217,218,
+    218,218,217,218,218,217,218,217,217,217,218,217,218,217,218,217,
+    218,217,217,190,190,219,220,221,144,144,144,144,144,144,144,146,
+    146,147,147,148,149,152,152,152,156,156,153,153,153,160,160,161,
+    161,161,159,148,148,149,146,146,149,148,146,142,142,154,154,140,
+    143,143,222,222,146,149,149,158,223,223,223,223,223,223,223,223,
+    223,223,223,223,223,223,224,224,224,224,224,224,224,224,224,224,
+    224,223,190,190,190,190,190,190,190,190,190,190,190,190,190,190,
+    225,225,225,225,225,225,225,225,225,225,226,226,226,226,226,226,
+    226,226,226,226,226,226,226,226,226,226,226,227,227,227,227,227,
+    227,227,228,227,229,229,230,231,232,233,234,98,98,228,235,235,
+    236,236,236,236,236,236,236,236,236,236,236,236,236,236,237,237,
+    237,237,238,237,237,237,237,237,237,237,237,237,238,237,237,237,
+    238,237,237,237,237,237,98,98,239,239,239,239,239,239,239,239,
+    239,239,239,239,239,239,239,98,240,241,241,241,241,241,240,240,
+    241,240,241,241,241,241,241,241,241,241,241,241,240,241,240,240,
+    240,242,242,242,98,98,243,98,244,245,246,247,248,249,250,251,
+    252,253,254,190,190,190,190,190,142,142,142,142,142,142,142,142,
+    142,142,142,255,255,255,256,141,257,161,146,151,151,153,258,190,
+    123,123,190,190,190,190,190,190,132,173,173,173,132,132,132,132,
+    144,144,146,151,156,157,159,160,140,140,148,143,259,141,147,150,
+    153,260,148,152,158,157,144,144,144,148,140,261,262,263,144,144,
+    144,146,153,152,262,146,146,159,153,186,132,132,132,132,132,173,
+    173,173,173,173,132,132,132,132,132,132,124,173,132,132,173,132,
+    132,173,132,132,132,173,173,173,264,265,266,132,132,132,173,132,
+    132,173,173,132,132,132,132,132,267,267,267,268,269,269,269,269,
+    269,269,269,269,269,269,269,269,269,269,267,268,270,269,268,268,
+    268,267,267,267,267,267,267,267,267,268,268,268,268,271,268,268,
+    269,272,273,63,63,267,267,267,269,269,267,267,274,275,276,276,
+    276,276,276,276,276,276,276,276,277,278,269,269,269,269,269,269,
+    279,280,281,281,78,279,279,279,279,279,279,279,279,78,78,279,
+    279,78,78,279,279,279,279,279,279,279,279,279,279,279,279,279,
+    279,78,279,279,279,279,279,279,279,78,279,78,78,78,279,279,
+    279,279,78,78,282,279,281,281,281,280,280,280,280,78,78,281,
+    281,78,78,281,281,283,279,78,78,78,78,78,78,78,78,281,
+    78,78,78,78,279,279,78,279,279,279,280,280,78,78,284,284,
+    284,284,284,284,284,284,284,284,279,279,285,285,286,286,286,286,
+    286,287,288,289,279,290,291,78,78,292,292,293,78,294,294,294,
+    294,294,294,78,78,78,78,294,294,78,78,294,294,294,294,294,
+    294,294,294,294,294,294,294,294,294,78,294,294,294,294,294,294,
+    294,78,294,294,78,294,294,78,294,294,78,78,295,78,293,293,
+    293,292,292,78,78,78,78,292,292,78,78,292,292,296,78,78,
+    78,292,78,78,78,78,78,78,78,294,294,294,294,78,294,78,
+    78,78,78,78,78,78,297,297,297,297,297,297,297,297,297,297,
+    292,292,294,294,294,292,298,78,78,78,78,78,78,78,78,78,
+    78,299,299,300,78,301,301,301,301,301,301,301,301,301,78,301,
+    301,301,78,301,301,301,301,301,301,301,301,301,301,301,301,301,
+    301,78,301,301,301,301,301,301,301,78,301,301,78,301,301,301,
+    301,301,78,78,302,301,300,300,300,299,299,299,299,299,78,299,
+    299,300,78,300,300,303,78,78,301,78,78,78,78,78,78,78,
+    301,301,299,299,78,78,304,304,304,304,304,304,304,304,304,304,
+    305,306,78,78,78,78,78,78,78,301,299,299,299,299,299,299,
+    78,307,308,308,78,309,309,309,309,309,309,309,309,78,78,309,
+    309,78,78,309,309,309,309,309,309,309,309,309,309,309,309,309,
+    309,78,309,309,309,309,309,309,309,78,309,309,78,309,309,309,
+    309,309,78,78,310,309,308,307,308,307,307,307,307,78,78,308,
+    308,78,78,308,308,311,78,78,78,78,78,78,78,307,307,308,
+    78,78,78,78,309,309,78,309,309,309,307,307,78,78,312,312,
+    312,312,312,312,312,312,312,312,313,309,314,314,314,314,314,314,
+    78,78,315,316,78,316,316,316,316,316,316,78,78,78,316,316,
+    316,78,316,316,316,316,78,78,78,316,316,78,316,78,316,316,
+    78,78,78,316,316,78,78,78,316,316,316,316,316,316,316,316,
+    316,316,78,78,78,78,317,317,315,317,317,78,78,78,317,317,
+    317,78,317,317,317,318,78,78,316,78,78,78,78,78,78,317,
+    78,78,78,78,78,78,319,319,319,319,319,319,319,319,319,319,
+    320,320,320,321,322,322,322,322,322,323,322,78,78,78,78,78,
+    324,325,325,325,324,326,326,326,326,326,326,326,326,78,326,326,
+    326,78,326,326,326,326,326,326,326,326,326,326,326,326,326,326,
+    326,326,78,78,327,326,324,324,324,325,325,325,325,78,324,324,
+    324,78,324,324,324,328,78,78,78,78,78,78,78,329,330,78,
+    326,326,326,78,78,326,78,78,326,326,324,324,78,78,331,331,
+    331,331,331,331,331,331,331,331,78,78,78,78,78,78,78,332,
+    333,333,333,333,333,333,333,334,335,336,337,337,338,335,335,335,
+    335,335,335,335,335,78,335,335,335,78,335,335,335,335,335,335,
+    335,335,335,335,335,335,335,335,335,335,335,335,78,335,335,335,
+    335,335,78,78,339,335,337,340,337,337,337,337,337,78,340,337,
+    337,78,337,337,336,341,78,78,78,78,78,78,78,337,337,78,
+    78,78,78,78,78,335,335,78,335,335,336,336,78,78,342,342,
+    342,342,342,342,342,342,342,342,78,335,335,337,78,78,78,78,
+    343,343,344,344,345,345,345,345,345,345,345,345,345,78,345,345,
+    345,78,345,345,345,345,345,345,345,345,345,345,345,345,345,345,
+    345,345,345,346,346,345,344,344,344,343,343,343,343,78,344,344,
+    344,78,344,344,344,346,345,347,78,78,78,78,345,345,345,344,
+    348,348,348,348,348,348,348,345,345,345,343,343,78,78,349,349,
+    349,349,349,349,349,349,349,349,348,348,348,348,348,348,348,348,
+    348,350,345,345,345,345,345,345,78,351,352,352,78,353,353,353,
+    353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,78,
+    78,78,353,353,353,353,353,353,353,353,78,353,353,353,353,353,
+    353,353,353,353,78,353,78,78,78,78,354,78,78,78,78,352,
+    352,352,351,351,351,78,351,78,352,352,352,352,352,352,352,352,
+    78,78,78,78,78,78,355,355,355,355,355,355,355,355,355,355,
+    78,78,352,352,356,78,78,78,78,357,357,357,357,357,357,357,
+    357,357,357,357,357,357,357,357,357,358,357,357,358,358,358,358,
+    359,359,360,78,78,78,78,13,357,357,357,357,357,357,361,358,
+    362,362,362,362,358,358,358,363,364,364,364,364,364,364,364,364,
+    364,364,365,365,78,78,78,78,78,366,366,78,366,78,366,366,
+    366,366,366,78,366,366,366,366,366,366,366,366,366,366,366,366,
+    366,366,366,366,78,366,78,366,366,367,366,366,367,367,367,367,
+    368,368,369,367,367,366,78,78,366,366,366,366,366,78,370,78,
+    371,371,371,371,367,367,367,78,372,372,372,372,372,372,372,372,
+    372,372,78,78,366,366,366,366,373,374,374,374,375,376,375,375,
+    377,375,375,378,377,379,379,379,379,379,377,380,379,380,380,380,
+    381,381,380,380,380,380,380,380,382,382,382,382,382,382,382,382,
+    382,382,383,383,383,383,383,383,383,383,383,383,384,381,380,381,
+    380,385,386,387,386,387,388,388,373,373,373,373,373,373,373,373,
+    78,373,373,373,373,373,373,373,373,373,373,373,373,78,78,78,
+    78,389,390,391,392,391,391,391,391,391,390,390,390,390,391,393,
+    390,391,394,394,395,378,394,394,373,373,373,373,373,391,391,391,
+    391,391,391,391,391,391,391,391,78,391,391,391,391,391,391,391,
+    391,391,391,391,391,78,384,384,380,380,380,380,380,380,381,380,
+    380,380,380,380,380,78,380,380,375,375,378,375,376,396,396,396,
+    396,377,377,78,78,78,78,78,397,397,397,397,397,397,397,397,
+    397,397,397,398,398,399,399,399,399,398,399,399,399,399,399,400,
+    398,401,401,398,398,399,399,397,402,402,402,402,402,402,402,402,
+    402,402,403,403,404,404,404,404,397,397,397,397,397,397,398,398,
+    399,399,397,397,397,397,399,399,399,397,398,398,398,397,397,398,
+    398,398,398,398,398,398,397,397,397,399,399,399,399,397,397,397,
+    397,397,399,398,398,399,399,398,398,398,398,398,398,405,397,398,
+    406,406,406,406,406,406,406,406,406,406,398,398,398,399,407,407,
+    408,408,408,408,408,408,408,408,408,408,408,408,408,408,78,408,
+    78,78,78,78,78,408,78,78,409,409,409,409,409,409,409,409,
+    409,409,409,410,411,409,409,409,412,412,412,412,412,412,412,412,
+    413,413,413,413,413,413,413,413,414,414,414,414,414,414,414,414,
+    415,415,415,415,415,415,415,415,415,78,415,415,415,415,78,78,
+    415,415,415,415,415,415,415,78,415,415,415,78,78,416,416,416,
+    417,418,417,417,417,417,417,417,417,419,419,419,419,419,419,419,
+    419,419,419,419,419,419,419,419,419,419,419,419,419,78,78,78,
+    420,420,420,420,420,420,420,420,420,420,78,78,78,78,78,78,
+    421,421,421,421,421,421,421,421,421,421,421,421,421,421,78,78,
+    422,422,422,422,422,422,78,78,423,424,424,424,424,424,424,424,
+    424,424,424,424,424,424,424,424,424,424,424,424,424,425,426,424,
+    427,428,428,428,428,428,428,428,428,428,428,428,428,428,428,428,
+    428,428,428,429,430,78,78,78,431,431,431,431,431,431,431,431,
+    431,431,431,432,432,432,433,433,433,431,431,431,431,431,431,431,
+    431,78,78,78,78,78,78,78,434,434,434,434,434,434,434,434,
+    434,434,435,435,436,437,78,78,78,78,78,78,78,78,78,434,
+    438,438,438,438,438,438,438,438,438,438,439,439,440,441,441,78,
+    442,442,442,442,442,442,442,442,442,442,443,443,78,78,78,78,
+    444,444,444,444,444,444,444,444,444,444,444,444,444,78,444,444,
+    444,78,445,445,78,78,78,78,446,446,446,446,446,446,446,446,
+    446,446,446,446,447,447,448,447,447,447,447,447,447,447,448,448,
+    448,448,448,448,448,448,447,448,448,447,447,447,447,447,447,447,
+    447,447,449,447,450,450,451,452,450,453,450,454,446,455,78,78,
+    456,456,456,456,456,456,456,456,456,456,78,78,78,78,78,78,
+    457,457,457,457,457,457,457,457,457,457,78,78,78,78,78,78,
+    458,458,459,459,460,461,462,463,464,464,465,466,466,466,467,466,
+    468,468,468,468,468,468,468,468,468,468,78,78,78,78,78,78,
+    469,469,469,469,469,469,469,469,469,469,469,470,469,469,469,469,
+    469,78,78,78,78,78,78,78,471,471,471,471,471,466,466,469,
+    469,472,469,78,78,78,78,78,424,424,424,424,424,424,78,78,
+    473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,78,
+    474,474,474,475,475,475,475,474,474,475,475,475,78,78,78,78,
+    475,475,474,475,475,475,475,475,475,476,477,478,78,78,78,78,
+    479,78,78,78,480,480,481,481,481,481,481,481,481,481,481,481,
+    482,482,482,482,482,482,482,482,482,482,482,482,482,482,78,78,
+    482,482,482,482,482,78,78,78,483,483,483,483,483,483,483,483,
+    483,483,483,483,78,78,78,78,483,483,78,78,78,78,78,78,
+    484,484,484,484,484,484,484,484,484,484,485,78,78,78,486,486,
+    487,487,487,487,487,487,487,487,488,488,488,488,488,488,488,488,
+    488,488,488,488,488,488,488,489,490,491,491,492,78,78,493,493,
+    494,494,494,494,494,494,494,494,494,494,494,494,494,495,496,495,
+    496,496,496,496,496,496,496,78,497,495,496,495,495,496,496,496,
+    496,496,496,496,496,495,495,495,495,495,495,496,496,498,498,498,
+    498,498,498,498,498,78,78,499,500,500,500,500,500,500,500,500,
+    500,500,78,78,78,78,78,78,501,501,501,501,501,501,501,502,
+    501,501,501,501,501,501,78,78,63,63,63,63,63,65,65,65,
+    65,65,65,63,63,65,503,65,65,63,63,65,65,63,63,63,
+    63,63,65,63,63,63,63,78,504,504,504,504,505,506,506,506,
+    506,506,506,506,506,506,506,506,506,506,506,506,507,505,504,504,
+    504,504,504,505,504,505,505,505,505,505,504,505,508,506,506,506,
+    506,506,506,506,506,78,78,78,509,509,509,509,509,509,509,509,
+    509,509,510,510,511,510,510,510,510,512,512,512,512,512,512,512,
+    512,512,512,513,514,513,513,513,513,513,513,513,512,512,512,512,
+    512,512,512,512,512,510,510,78,515,515,516,517,517,517,517,517,
+    517,517,517,517,517,517,517,517,517,516,515,515,515,515,516,516,
+    515,515,518,519,515,515,517,517,520,520,520,520,520,520,520,520,
+    520,520,517,517,517,517,517,517,521,521,521,521,521,521,521,521,
+    521,521,521,521,521,521,522,523,524,524,523,523,523,524,523,524,
+    524,524,525,525,78,78,78,78,78,78,78,78,526,526,526,526,
+    527,527,527,527,527,527,527,527,527,527,527,527,528,528,528,528,
+    528,528,528,528,529,529,529,529,529,529,529,529,528,528,529,530,
+    78,78,78,531,531,531,531,531,532,532,532,532,532,532,532,532,
+    532,532,78,78,78,527,527,527,533,533,533,533,533,533,533,533,
+    533,533,534,534,534,534,534,534,534,534,534,534,534,534,534,534,
+    535,535,535,535,535,535,536,536,84,78,78,78,78,78,78,78,
+    408,408,408,78,78,408,408,408,537,537,537,537,537,537,537,537,
+    538,539,538,540,541,542,542,543,542,543,544,539,543,543,545,545,
+    546,547,541,541,541,541,541,541,541,548,549,550,550,542,550,550,
+    550,550,551,552,553,549,549,554,555,555,556,78,78,78,78,78,
+    33,33,33,33,33,33,76,76,76,76,76,84,56,56,56,56,
+    56,56,56,56,56,79,79,79,79,79,56,56,56,56,79,79,
+    79,79,79,33,33,33,33,33,557,33,33,33,33,33,33,33,
+    33,33,33,56,56,56,56,56,56,56,56,56,56,56,56,79,
+    69,69,65,63,63,63,63,63,63,63,65,63,63,73,558,65,
+    67,63,63,63,63,63,63,63,63,63,63,63,63,63,64,559,
+    560,65,561,63,72,65,63,65,27,33,27,33,27,33,33,33,
+    33,33,33,33,33,33,27,33,76,76,76,76,76,76,78,78,
+    75,75,75,75,75,75,78,78,78,75,78,75,78,75,78,75,
+    562,562,562,562,562,562,562,562,76,76,76,76,76,78,76,76,
+    75,75,75,75,562,77,76,77,77,77,76,76,76,78,76,76,
+    75,75,75,75,562,77,77,77,76,76,76,76,78,78,76,76,
+    75,75,75,75,78,77,77,77,75,75,75,75,75,77,77,77,
+    78,78,76,76,76,78,76,76,75,75,75,75,562,563,77,78,
+    564,564,564,564,564,564,564,565,564,564,564,566,567,568,569,570,
+    571,572,571,571,573,574,41,15,575,576,577,575,575,576,577,575,
+    41,41,15,15,578,578,578,579,580,581,582,583,584,585,586,587,
+    14,14,14,14,14,588,588,588,15,589,590,41,591,591,15,32,
+    32,15,15,15,592,16,593,591,591,591,15,15,15,15,15,15,
+    15,15,25,15,32,15,579,588,579,579,579,579,15,579,579,564,
+    594,595,595,595,595,596,597,598,599,600,601,601,601,601,601,601,
+    602,56,78,78,48,602,602,602,602,602,603,603,25,16,593,604,
+    602,48,48,48,48,602,602,602,602,602,603,603,25,16,593,78,
+    56,56,56,56,56,78,78,78,13,13,13,13,13,13,13,39,
+    13,13,13,13,13,13,13,13,13,13,13,13,13,13,39,13,
+    13,13,13,39,13,13,39,13,39,605,605,605,605,605,605,605,
+    605,605,605,605,605,605,605,605,63,63,68,68,63,63,63,63,
+    68,68,68,63,63,503,503,503,503,63,503,503,503,68,68,63,
+    65,63,68,68,65,65,65,65,606,78,78,78,78,78,78,78,
+    40,40,607,608,40,609,40,607,40,608,50,607,607,607,50,50,
+    607,607,607,610,40,607,611,40,25,607,607,607,607,607,40,40,
+    40,609,609,40,607,40,75,40,607,40,27,612,607,607,613,50,
+    607,607,27,607,50,614,614,614,614,50,40,40,50,50,607,607,
+    25,25,25,25,25,607,50,50,50,50,40,25,40,40,33,396,
+    615,615,615,615,52,52,615,615,615,615,615,52,615,615,52,615,
+    616,616,616,616,616,616,616,616,616,616,616,616,617,617,617,617,
+    616,616,617,617,617,617,617,617,617,617,617,27,33,617,617,617,
+    617,52,40,40,78,78,78,78,53,53,53,53,53,609,609,609,
+    609,609,25,25,40,40,40,40,25,40,40,25,40,40,25,40,
+    40,40,40,40,40,40,25,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,25,25,40,40,53,40,53,40,40,40,
+    40,40,40,40,25,25,25,25,25,25,25,25,25,25,25,25,
+    53,25,53,53,25,25,25,53,618,619,619,620,621,621,25,53,
+    25,53,18,47,25,622,25,25,25,25,53,25,25,53,53,623,
+    624,625,626,53,627,53,25,53,53,53,53,53,53,25,53,25,
+    25,25,25,25,53,53,53,53,25,25,25,25,628,629,25,25,
+    25,25,25,630,25,631,25,25,53,25,25,25,632,25,25,25,
+    25,25,628,633,634,633,25,25,53,53,25,25,628,629,628,629,
+    634,633,628,629,25,25,628,629,634,633,634,633,634,633,634,633,
+    634,633,628,629,634,633,628,629,634,633,634,633,25,25,25,634,
+    633,634,633,25,25,53,25,25,635,53,25,25,25,25,25,25,
+    25,25,634,633,25,53,636,25,637,638,25,638,25,25,25,25,
+    639,25,25,25,25,25,25,53,25,634,633,634,633,640,25,25,
+    634,633,25,25,25,25,634,633,634,633,634,633,634,633,25,641,
+    634,633,642,642,642,25,631,631,25,25,643,643,643,644,644,25,
+    16,593,16,593,40,40,40,40,40,40,609,40,40,40,40,40,
+    40,40,645,645,40,40,40,40,25,25,40,40,40,40,40,40,
+    40,16,593,40,40,40,40,40,40,40,40,40,40,40,396,396,
+    396,396,396,396,396,396,396,396,396,396,396,40,25,40,40,40,
+    40,40,40,40,40,396,40,40,40,40,40,25,25,25,25,25,
+    25,25,25,25,40,40,40,40,645,645,645,645,40,40,40,40,
+    40,40,40,40,40,40,40,78,40,40,40,78,78,78,78,78,
+    52,52,52,52,52,52,52,52,48,48,48,48,48,48,48,48,
+    48,48,48,48,646,646,646,646,646,646,646,646,646,646,646,646,
+    646,646,52,52,52,52,52,52,52,52,52,52,52,52,52,615,
+    609,609,609,609,609,609,609,609,609,609,609,609,40,40,40,40,
+    609,609,609,609,609,40,40,40,40,40,609,609,609,609,40,40,
+    609,609,40,609,609,609,609,609,609,609,40,40,40,40,40,40,
+    40,40,609,609,40,40,609,53,40,40,40,40,609,609,40,40,
+    609,53,40,40,40,40,609,609,609,40,40,609,40,40,609,609,
+    40,40,40,40,40,40,40,609,645,645,645,645,40,609,609,40,
+    40,609,40,40,40,40,609,609,40,40,40,40,645,645,609,609,
+    645,40,645,645,645,647,645,645,40,645,645,645,40,40,40,40,
+    609,40,609,40,40,40,40,40,609,609,40,609,609,609,40,609,
+    645,609,609,40,609,609,40,53,40,40,40,40,40,40,40,645,
+    40,40,40,40,40,40,609,609,40,40,40,40,396,40,40,40,
+    40,40,40,40,40,645,645,645,645,645,645,645,645,645,645,645,
+    645,609,609,609,609,645,40,645,645,645,609,645,645,609,609,609,
+    645,645,609,609,645,609,609,645,645,645,40,609,40,40,40,40,
+    609,609,645,609,609,609,609,609,609,645,645,645,645,645,609,645,
+    645,647,645,609,609,645,645,645,645,645,645,645,645,40,40,40,
+    645,645,647,647,647,647,40,40,40,40,40,648,648,648,648,648,
+    648,40,649,649,645,40,40,40,16,593,16,593,16,593,16,593,
+    16,593,16,593,16,593,52,52,52,52,52,52,40,40,40,40,
+    25,25,25,634,633,16,593,25,634,633,25,24,25,26,25,25,
+    25,25,25,25,25,634,633,25,25,25,25,25,650,634,633,25,
+    25,25,634,633,634,633,16,593,651,651,651,651,651,651,651,651,
+    25,25,25,16,593,16,593,16,593,16,593,16,593,652,653,654,
+    655,16,593,16,593,16,593,16,593,25,25,656,25,25,25,25,
+    657,25,25,658,634,633,25,25,659,25,25,25,25,25,25,25,
+    634,633,25,25,634,633,25,25,25,25,25,25,25,25,25,634,
+    633,634,633,25,634,633,25,25,16,593,16,593,25,25,25,25,
+    634,633,25,25,25,25,25,25,25,25,25,25,25,660,25,25,
+    634,633,25,25,16,593,25,25,25,25,25,634,633,634,633,25,
+    25,25,25,25,634,633,25,25,25,634,633,634,633,634,633,634,
+    633,634,633,634,633,634,633,634,633,634,633,25,25,25,634,633,
+    634,633,634,633,634,633,25,634,633,634,633,634,633,634,633,25,
+    25,25,25,25,25,25,661,25,25,25,25,662,663,662,25,25,
+    25,25,25,25,634,633,664,25,633,634,633,25,25,25,25,25,
+    25,25,25,25,25,40,40,25,25,25,25,25,25,40,40,40,
+    40,40,40,40,40,609,609,609,40,40,40,40,78,78,40,40,
+    40,40,40,40,40,40,78,40,40,40,40,40,40,40,665,40,
+    666,666,666,666,666,666,666,666,667,667,667,667,667,667,667,667,
+    27,33,27,27,27,33,33,27,33,27,33,27,33,27,27,27,
+    27,33,27,33,33,27,33,33,33,33,33,33,56,56,27,27,
+    80,81,80,81,81,668,668,668,668,668,668,80,81,80,81,669,
+    669,669,80,81,78,78,78,78,78,670,671,671,671,672,670,671,
+    409,409,409,409,409,409,78,409,78,78,78,78,78,409,78,78,
+    673,673,673,673,673,673,673,673,78,78,78,78,78,78,78,674,
+    675,78,78,78,78,78,78,78,78,78,78,78,78,78,78,676,
+    677,677,677,677,677,677,677,677,11,11,589,590,589,590,11,11,
+    11,589,590,11,589,590,579,579,579,579,579,579,579,579,15,571,
+    38,579,678,15,589,590,15,15,589,590,16,593,16,593,16,593,
+    16,593,579,579,579,579,10,57,579,579,15,579,579,15,15,15,
+    15,15,573,573,579,579,579,15,571,579,577,679,579,579,579,579,
+    579,579,579,15,579,15,579,579,40,40,15,10,10,16,593,16,
+    593,16,593,16,593,571,78,78,680,680,680,680,680,680,680,680,
+    680,680,78,680,680,680,680,680,680,680,680,680,78,78,78,78,
+    680,680,680,680,680,680,78,78,645,645,645,645,78,78,78,78,
+    564,681,681,682,645,683,684,685,686,687,686,687,686,687,686,687,
+    686,687,645,688,686,687,686,687,686,687,686,687,689,690,691,691,
+    645,685,685,685,685,685,685,685,685,685,692,693,694,695,696,696,
+    697,698,698,698,698,699,645,688,685,685,685,683,700,701,702,702,
+    78,703,704,703,704,703,704,703,704,703,704,704,704,704,704,704,
+    704,704,704,704,704,704,704,704,704,704,704,703,704,704,704,704,
+    704,704,704,703,704,703,704,703,704,704,704,704,704,704,703,704,
+    704,704,704,704,704,703,703,78,78,705,705,706,706,707,707,704,
+    708,709,710,709,710,709,710,709,710,709,710,710,710,710,710,710,
+    710,710,710,710,710,710,710,710,710,710,710,709,710,710,710,710,
+    710,710,710,709,710,709,710,709,710,710,710,710,710,710,709,710,
+    710,710,710,710,710,709,709,710,710,710,710,711,712,713,713,710,
+    78,78,78,78,78,714,714,714,714,714,714,714,714,714,714,714,
+    78,715,715,715,715,715,715,715,715,715,715,715,715,715,715,715,
+    715,715,715,715,715,715,715,78,716,716,717,717,717,717,716,716,
+    716,716,716,716,716,716,716,716,702,702,702,702,702,702,702,702,
+    702,702,702,702,78,78,78,78,709,709,709,709,709,709,709,709,
+    718,718,718,718,718,718,718,718,718,718,718,718,718,719,719,78,
+    717,717,717,717,717,717,717,717,717,717,716,716,716,716,716,716,
+    720,720,720,720,720,720,720,720,645,721,721,721,721,721,721,721,
+    721,721,721,721,721,721,721,721,718,718,718,718,719,719,719,722,
+    716,721,721,721,721,721,721,721,716,716,716,716,645,645,645,645,
+    723,723,723,723,723,723,723,723,723,723,723,723,723,723,723,716,
+    716,722,722,722,722,722,722,645,645,645,645,716,716,716,716,716,
+    722,722,722,722,722,722,722,722,722,722,722,722,722,722,645,645,
+    716,716,716,716,716,716,716,645,724,724,724,724,724,724,724,724,
+    725,725,725,725,725,725,725,725,725,725,725,725,725,726,725,725,
+    725,725,725,725,725,78,78,78,727,727,727,727,727,727,727,727,
+    727,727,727,727,727,727,727,78,728,728,728,728,728,728,728,728,
+    729,729,729,729,729,729,730,730,731,731,731,731,731,731,731,731,
+    731,731,731,731,732,733,734,733,735,735,735,735,735,735,735,735,
+    735,735,731,731,78,78,78,78,83,84,83,84,83,84,736,87,
+    89,89,89,737,677,677,677,677,677,677,677,677,677,677,737,738,
+    83,84,83,84,557,557,677,677,739,739,739,739,739,739,739,739,
+    739,739,739,739,739,739,740,740,740,740,740,740,740,740,740,740,
+    741,741,742,743,743,743,743,743,744,744,744,744,744,744,744,744,
+    31,31,31,31,31,31,31,57,57,57,57,57,57,57,57,57,
+    31,31,27,33,27,33,27,33,56,33,33,33,33,33,33,33,
+    33,27,33,27,33,27,27,33,57,745,745,27,33,27,33,54,
+    27,33,27,33,33,33,27,33,27,33,27,27,27,27,27,33,
+    27,27,27,27,27,33,27,33,27,33,27,33,27,27,27,27,
+    33,27,33,78,78,78,78,78,27,33,78,33,78,33,27,33,
+    27,33,78,78,78,78,78,78,78,78,56,56,56,27,33,54,
+    56,56,33,54,54,54,54,54,746,746,747,746,746,746,748,746,
+    746,746,746,747,746,746,746,746,746,746,746,746,746,746,746,746,
+    746,746,746,749,749,747,747,749,750,750,750,750,748,78,78,78,
+    751,751,751,752,752,752,753,753,754,755,78,78,78,78,78,78,
+    756,756,756,756,756,756,756,756,756,756,757,758,759,759,760,760,
+    761,761,762,762,762,762,762,762,762,762,762,762,762,762,762,762,
+    762,762,762,762,761,761,761,761,761,761,761,761,761,761,761,761,
+    761,761,761,761,763,764,78,78,78,78,78,78,78,78,765,765,
+    766,766,766,766,766,766,766,766,766,766,78,78,78,78,78,78,
+    767,767,767,767,767,767,767,767,767,768,269,769,269,269,269,269,
+    277,277,277,269,770,269,269,267,771,771,771,771,771,771,771,771,
+    771,771,772,772,772,772,772,772,772,772,772,772,772,772,772,772,
+    772,772,772,772,772,772,773,773,773,773,773,774,774,774,775,776,
+    777,777,777,777,777,777,777,777,777,777,777,777,777,777,777,778,
+    778,778,778,778,778,778,778,778,778,778,779,780,78,78,78,78,
+    78,78,78,78,78,78,78,781,412,412,412,412,412,78,78,78,
+    782,782,782,783,784,784,784,784,784,784,784,784,784,784,784,784,
+    784,784,784,785,783,783,782,782,782,782,783,783,782,782,783,783,
+    786,787,787,787,787,787,787,788,788,788,787,787,787,787,78,789,
+    790,790,790,790,790,790,790,790,790,790,78,78,78,78,787,787,
+    397,397,397,397,397,399,791,397,406,406,397,397,397,397,397,78,
+    792,792,792,792,792,792,792,792,792,793,793,793,793,793,793,794,
+    794,793,793,794,794,793,793,78,792,792,792,793,792,792,792,792,
+    792,792,792,792,793,794,78,78,795,795,795,795,795,795,795,795,
+    795,795,78,78,796,797,797,797,791,397,397,397,397,397,397,407,
+    407,407,397,398,399,398,397,397,798,798,798,798,798,798,798,798,
+    799,798,799,799,800,798,798,799,799,798,798,798,798,798,799,799,
+    798,799,798,78,78,78,78,78,78,78,78,798,798,801,802,802,
+    803,803,803,803,803,803,803,803,803,803,803,804,805,805,804,804,
+    806,806,803,807,807,804,808,78,78,415,415,415,415,415,415,78,
+    33,33,33,745,56,56,56,56,33,33,33,33,33,76,33,33,
+    33,56,31,31,78,78,78,78,422,422,422,422,422,422,422,422,
+    803,803,803,804,804,805,804,804,805,804,804,806,804,808,78,78,
+    809,809,809,809,809,809,809,809,809,809,78,78,78,78,78,78,
+    810,811,811,811,811,811,811,811,811,811,811,811,811,811,811,811,
+    811,811,811,811,810,811,811,811,811,811,811,811,78,78,78,78,
+    413,413,413,413,413,413,413,78,78,78,78,414,414,414,414,414,
+    414,414,414,414,78,78,78,78,812,812,812,812,812,812,812,812,
+    813,813,813,813,813,813,813,813,724,724,724,724,724,724,814,814,
+    724,724,814,814,814,814,814,814,814,814,814,814,814,814,814,814,
+    33,33,33,33,33,33,33,78,78,78,78,93,93,93,93,93,
+    78,78,78,78,78,122,815,122,122,816,122,122,122,122,122,122,
+    122,122,122,122,122,122,122,98,122,122,122,122,122,98,122,98,
+    122,122,98,122,122,98,122,122,141,141,141,141,141,141,141,141,
+    141,141,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+    257,257,257,190,190,190,190,190,190,190,190,141,141,141,141,141,
+    141,141,141,141,141,141,817,818,131,131,131,131,131,131,131,131,
+    190,190,141,141,141,141,141,141,190,190,190,190,190,190,190,131,
+    596,596,596,596,596,596,596,596,141,141,819,141,141,141,141,141,
+    141,141,141,141,128,820,131,131,821,821,821,821,821,821,821,821,
+    23,822,822,23,23,10,10,577,823,578,78,78,78,78,78,78,
+    63,63,63,63,63,63,63,65,65,65,65,65,65,65,677,677,
+    824,825,825,826,826,577,823,577,823,577,823,577,823,577,823,577,
+    823,577,823,577,823,682,682,577,823,824,824,824,824,826,826,826,
+    827,824,827,78,591,828,10,10,825,16,593,16,593,16,593,829,
+    824,824,830,831,832,833,834,78,824,13,14,824,78,78,78,78,
+    141,141,141,141,141,190,141,141,141,141,141,141,141,190,190,594,
+    78,10,824,829,13,14,824,824,16,593,824,830,827,831,827,835,
+    836,836,836,836,836,836,836,836,836,836,828,591,837,834,838,10,
+    824,839,839,839,839,839,839,839,839,839,839,839,839,839,839,839,
+    839,839,839,28,824,35,840,826,840,841,841,841,841,841,841,841,
+    841,841,841,841,841,841,841,841,841,841,841,28,834,35,834,16,
+    593,681,686,687,681,711,710,709,712,710,710,710,710,710,710,710,
+    710,710,710,710,710,710,842,842,78,78,715,715,715,715,715,715,
+    78,78,715,715,715,78,78,78,39,13,834,840,645,13,13,78,
+    40,25,25,25,25,40,40,78,596,843,843,843,844,609,596,596,
+    845,845,845,845,845,845,845,845,845,845,845,845,78,845,845,845,
+    845,845,845,845,845,845,845,78,845,845,845,78,845,845,78,845,
+    845,845,845,845,845,845,78,78,845,845,845,78,78,78,78,78,
+    846,847,848,78,78,78,78,849,849,849,849,849,849,849,849,849,
+    849,849,849,849,78,78,78,850,850,850,850,850,850,850,850,850,
+    851,851,851,851,851,851,851,851,851,851,851,851,851,852,852,852,
+    852,853,853,853,853,853,853,853,853,853,853,853,853,853,853,853,
+    853,853,852,852,853,854,854,78,40,40,40,40,40,78,78,78,
+    853,78,78,78,78,78,78,78,396,396,396,396,396,65,78,78,
+    855,855,855,855,855,855,855,855,855,855,855,855,855,78,78,78,
+    856,856,856,856,856,856,856,856,856,78,78,78,78,78,78,78,
+    857,858,858,858,858,858,858,858,858,858,858,858,858,858,858,858,
+    858,858,858,858,78,78,78,78,859,859,859,859,859,859,859,859,
+    860,860,860,860,78,78,78,78,78,78,78,78,78,859,859,859,
+    861,861,861,861,861,861,861,861,861,862,861,861,861,861,861,861,
+    861,861,862,78,78,78,78,78,863,863,863,863,863,863,863,863,
+    863,863,863,863,863,863,864,864,864,864,864,78,78,78,78,78,
+    865,865,865,865,865,865,865,865,865,865,865,865,865,865,78,866,
+    867,867,867,867,867,867,867,867,867,867,867,867,78,78,78,78,
+    868,869,869,869,869,869,78,78,870,870,870,870,870,870,870,870,
+    871,871,871,871,871,871,871,871,872,872,872,872,872,872,872,872,
+    873,873,873,873,873,873,873,873,873,873,873,873,873,873,78,78,
+    874,874,874,874,874,874,874,874,874,874,78,78,78,78,78,78,
+    875,875,875,875,875,875,875,875,875,875,875,875,78,78,78,78,
+    876,876,876,876,876,876,876,876,876,876,876,876,78,78,78,78,
+    877,877,877,877,877,877,877,877,878,878,878,878,878,878,878,878,
+    878,878,878,878,78,78,78,78,78,78,78,78,78,78,78,879,
+    880,880,880,880,880,880,880,880,880,880,880,78,880,880,880,880,
+    880,880,880,78,880,880,78,881,881,881,881,881,881,881,881,881,
+    881,881,78,881,881,881,881,881,881,881,78,881,881,78,78,78,
+    882,882,882,882,882,882,882,882,882,882,882,882,882,882,882,78,
+    882,882,882,882,882,882,78,78,56,56,56,56,56,56,78,56,
+    56,78,56,56,56,56,56,56,56,56,56,78,78,78,78,78,
+    883,883,883,883,883,883,98,98,883,98,883,883,883,883,883,883,
+    883,883,883,883,883,883,883,883,883,883,883,883,883,883,98,883,
+    883,98,98,98,883,98,98,883,884,884,884,884,884,884,884,884,
+    884,884,884,884,884,884,98,885,886,886,886,886,886,886,886,886,
+    887,887,887,887,887,887,887,887,887,887,887,887,887,887,887,888,
+    888,889,889,889,889,889,889,889,890,890,890,890,890,890,890,890,
+    890,890,890,890,890,890,890,98,98,98,98,98,98,98,98,891,
+    891,891,891,891,891,891,891,891,892,892,892,892,892,892,892,892,
+    892,892,892,98,892,892,98,98,98,98,98,893,893,893,893,893,
+    894,894,894,894,894,894,894,894,894,894,894,894,894,894,895,895,
+    895,895,895,895,98,98,98,896,897,897,897,897,897,897,897,897,
+    897,897,98,98,98,98,98,898,899,899,899,899,899,899,899,899,
+    900,900,900,900,900,900,900,900,98,98,98,98,901,901,900,900,
+    901,901,901,901,901,901,901,901,98,98,901,901,901,901,901,901,
+    902,903,903,903,98,903,903,98,98,98,98,98,903,904,903,905,
+    902,902,902,902,98,902,902,902,98,902,902,902,902,902,902,902,
+    902,902,902,902,902,902,902,902,902,902,902,902,902,902,98,98,
+    905,906,904,98,98,98,98,907,908,908,908,908,908,908,908,908,
+    908,98,98,98,98,98,98,98,909,909,909,909,909,909,909,909,
+    910,98,98,98,98,98,98,98,911,911,911,911,911,911,911,911,
+    911,911,911,911,911,912,912,913,914,914,914,914,914,914,914,914,
+    914,914,914,914,914,915,915,915,916,917,917,918,918,919,920,921,
+    922,923,923,920,920,924,925,926,927,927,927,928,929,930,931,932,
+    933,934,934,935,935,936,937,937,937,938,920,920,939,940,941,98,
+    98,98,98,942,943,944,945,946,947,947,948,947,947,947,949,98,
+    950,950,950,950,950,950,950,950,950,950,950,950,950,950,98,98,
+    98,951,951,951,951,951,951,951,952,952,952,952,952,952,952,952,
+    952,952,952,952,952,952,98,98,953,953,953,953,953,953,953,953,
+    954,954,954,954,954,954,954,954,954,954,954,98,98,98,98,98,
+    955,955,955,955,955,955,955,955,956,957,956,957,957,957,956,956,
+    956,957,956,956,957,956,957,957,956,957,98,98,98,98,98,98,
+    98,958,958,958,958,98,98,98,98,959,959,959,959,960,960,961,
+    962,962,962,962,962,962,962,962,962,98,98,98,98,98,98,98,
+    963,963,963,963,963,963,963,963,963,963,963,98,98,98,98,98,
+    964,964,964,964,964,964,964,964,964,964,964,98,98,98,98,98,
+    98,98,965,965,965,965,965,965,966,967,968,967,967,967,967,967,
+    967,968,967,967,967,967,967,967,967,967,967,967,967,967,967,967,
+    967,969,967,967,968,967,969,967,969,967,970,969,971,971,971,971,
+    972,972,972,972,972,972,972,972,972,972,190,190,190,190,190,190,
+    973,973,973,973,973,973,973,973,973,973,973,973,973,973,973,98,
+    974,974,974,974,974,974,974,974,974,974,98,975,975,976,98,98,
+    974,974,98,98,98,98,98,98,190,190,190,190,190,173,173,173,
+    977,977,977,977,977,977,977,977,977,977,977,977,977,978,978,978,
+    978,978,978,978,978,978,978,977,979,979,979,980,979,979,979,979,
+    979,979,979,979,979,979,979,979,979,979,979,979,979,981,982,982,
+    983,983,983,982,983,982,982,982,982,984,984,984,985,986,986,986,
+    986,986,190,190,190,190,190,190,987,987,987,987,988,988,987,987,
+    987,987,987,987,987,987,987,987,987,987,989,990,989,990,991,991,
+    991,991,98,98,98,98,98,98,992,993,992,992,994,994,994,993,
+    992,994,994,992,992,994,992,992,993,992,994,994,992,995,995,995,
+    995,996,997,998,98,98,98,98,999,999,999,999,999,999,999,999,
+    999,999,999,999,999,999,999,98,1000,1001,1000,1002,1002,1002,1002,1002,
+    1002,1002,1002,1002,1002,1002,1002,1002,1001,1001,1001,1001,1001,1001,1001,1001,
+    1001,1001,1001,1001,1001,1001,1003,1004,1004,1005,1005,1005,1005,1005,78,78,
+    78,78,1006,1006,1006,1006,1006,1006,1006,1006,1006,1006,1006,1006,1006,1006,
+    1006,1006,1006,1006,1006,1006,1007,1007,1007,1007,1007,1007,1007,1007,1007,1007,
+    1003,1002,1002,1001,1001,1002,78,78,78,78,78,78,78,78,78,1003,
+    1008,1008,1009,1010,1010,1010,1010,1010,1010,1010,1010,1010,1010,1010,1010,1010,
+    1009,1009,1009,1008,1008,1008,1008,1009,1009,1011,1012,1013,1013,1014,1015,1015,
+    1015,1015,1008,78,78,78,78,78,78,78,78,78,78,1014,78,78,
+    1016,1016,1016,1016,1016,1016,1016,1016,1016,78,78,78,78,78,78,78,
+    1017,1017,1017,1017,1017,1017,1017,1017,1017,1017,78,78,78,78,78,78,
+    1018,1018,1018,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,1019,
+    1019,1019,1019,1019,1019,1019,1019,1020,1020,1020,1020,1020,1021,1020,1020,1020,
+    1020,1020,1020,1022,1022,78,1023,1023,1023,1023,1023,1023,1023,1023,1023,1023,
+    1024,1024,1024,1024,1019,1021,1021,1019,1025,1025,1025,1025,1025,1025,1025,1025,
+    1025,1025,1025,1026,1027,1028,1025,78,1029,1029,1030,1031,1031,1031,1031,1031,
+    1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1030,1030,1030,1029,1029,
+    1029,1029,1029,1029,1029,1029,1029,1030,1032,1031,1031,1031,1031,1033,1033,1034,
+    1033,1029,1035,1029,1029,1034,1030,1029,1036,1036,1036,1036,1036,1036,1036,1036,
+    1036,1036,1031,1037,1031,1033,1033,1033,78,1038,1038,1038,1038,1038,1038,1038,
+    1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,1038,78,78,78,
+    1039,1039,1039,1039,1039,1039,1039,1039,1039,1039,78,1039,1039,1039,1039,1039,
+    1039,1039,1039,1039,1040,1040,1040,1041,1041,1041,1040,1040,1041,1042,1043,1041,
+    1044,1044,1045,1044,1044,1045,1041,1039,1039,1041,78,78,78,78,78,78,
+    1046,1046,1046,1046,1046,1046,1046,78,1046,78,1046,1046,1046,1046,78,1046,
+    1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,1046,78,1046,
+    1046,1047,78,78,78,78,78,78,1048,1048,1048,1048,1048,1048,1048,1048,
+    1048,1048,1048,1048,1048,1048,1048,1049,1050,1050,1050,1049,1049,1049,1049,1049,
+    1049,1051,1052,78,78,78,78,78,1053,1053,1053,1053,1053,1053,1053,1053,
+    1053,1053,78,78,78,78,78,78,1054,1055,1056,1057,78,1058,1058,1058,
+    1058,1058,1058,1058,1058,78,78,1058,1058,78,78,1058,1058,1058,1058,1058,
+    1058,1058,1058,1058,1058,1058,1058,1058,1058,78,1058,1058,1058,1058,1058,1058,
+    1058,78,1058,1058,78,1058,1058,1058,1058,1058,78,1059,1060,1058,1056,1056,
+    1054,1056,1056,1056,1056,78,78,1056,1056,78,78,1056,1056,1061,78,78,
+    1058,78,78,78,78,78,78,1056,78,78,78,78,78,1058,1058,1058,
+    1058,1058,1056,1056,78,78,1062,1062,1062,1062,1062,1062,1062,78,78,78,
+    1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1063,1064,1064,1064,
+    1065,1065,1065,1065,1065,1065,1065,1065,1064,1064,1066,1065,1065,1064,1067,1063,
+    1063,1063,1063,1068,1068,1068,1068,1069,1070,1070,1070,1070,1070,1070,1070,1070,
+    1070,1070,1068,1068,78,1069,1071,1063,1063,1063,78,78,78,78,78,78,
+    1072,1072,1072,1072,1072,1072,1072,1072,1073,1073,1073,1074,1074,1074,1074,1074,
+    1074,1073,1074,1073,1073,1073,1073,1074,1074,1073,1075,1076,1072,1072,1077,1072,
+    1078,1078,1078,1078,1078,1078,1078,1078,1078,1078,78,78,78,78,78,78,
+    1079,1079,1079,1079,1079,1079,1079,1079,1079,1079,1079,1079,1079,1079,1079,1080,
+    1080,1080,1081,1081,1081,1081,78,78,1080,1080,1080,1080,1081,1081,1080,1082,
+    1083,1084,1085,1085,1086,1086,1087,1087,1087,1085,1085,1085,1085,1085,1085,1085,
+    1085,1085,1085,1085,1085,1085,1085,1085,1079,1079,1079,1079,1081,1081,78,78,
+    1088,1088,1088,1088,1088,1088,1088,1088,1089,1089,1089,1090,1090,1090,1090,1090,
+    1090,1090,1090,1089,1089,1090,1089,1091,1090,1092,1092,1093,1088,78,78,78,
+    1094,1094,1094,1094,1094,1094,1094,1094,1094,1094,78,78,78,78,78,78,
+    1095,1095,1095,1095,1095,1095,1095,1095,1095,1095,1095,1095,1095,78,78,78,
+    1096,1096,1096,1096,1096,1096,1096,1096,1096,1096,1096,1097,1098,1097,1098,1098,
+    1097,1097,1097,1097,1097,1097,1099,1100,1096,1101,78,78,78,78,78,78,
+    1102,1102,1102,1102,1102,1102,1102,1102,1102,1102,78,78,78,78,78,78,
+    1103,1103,1103,1103,1103,1103,1103,1103,1103,1103,1103,78,78,1104,1104,1104,
+    1105,1105,1104,1104,1104,1104,1105,1104,1104,1104,1104,1106,78,78,78,78,
+    1107,1107,1107,1107,1107,1107,1107,1107,1107,1107,1108,1108,1109,1109,1109,1110,
+    1103,1103,1103,1103,1103,1103,1103,78,1111,1111,1111,1111,1111,1111,1111,1111,
+    1111,1111,1111,1111,1112,1112,1112,1113,1113,1113,1113,1113,1113,1113,1113,1113,
+    1112,1114,1115,1116,78,78,78,78,1117,1117,1117,1117,1117,1117,1117,1117,
+    1118,1118,1118,1118,1118,1118,1118,1118,1119,1119,1119,1119,1119,1119,1119,1119,
+    1119,1119,1120,1120,1120,1120,1120,1120,1120,1120,1120,78,78,78,78,78,
+    78,78,78,78,78,78,78,1121,1122,1122,1122,1122,1122,1122,1122,78,
+    78,1122,78,78,1122,1122,1122,1122,1122,1122,1122,1122,78,1122,1122,78,
+    1122,1122,1122,1122,1122,1122,1122,1122,1123,1123,1123,1123,1123,1123,78,1123,
+    1123,78,78,1124,1124,1125,1126,1122,1123,1122,1123,1127,1128,1128,1128,78,
+    1129,1129,1129,1129,1129,1129,1129,1129,1129,1129,78,78,78,78,78,78,
+    1130,1130,1130,1130,1130,1130,1130,1130,78,78,1130,1130,1130,1130,1130,1130,
+    1130,1131,1131,1131,1132,1132,1132,1132,78,78,1132,1132,1131,1131,1131,1131,
+    1133,1130,1134,1130,1131,78,78,78,1135,1136,1136,1136,1136,1136,1136,1137,
+    1137,1136,1136,1135,1135,1135,1135,1135,1135,1135,1135,1135,1135,1135,1135,1135,
+    1135,1135,1135,1136,1138,1136,1136,1136,1136,1139,1135,1136,1136,1136,1136,1140,
+    1141,1142,1142,1142,1142,1140,1141,1138,1143,1144,1144,1144,1144,1144,1144,1145,
+    1145,1144,1144,1144,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,1143,
+    1143,1143,1144,1144,1144,1144,1144,1144,1144,1144,1144,1144,1144,1144,1144,1145,
+    1144,1146,1147,1147,1147,1143,1148,1148,1148,1147,1147,78,78,78,78,78,
+    1149,1149,1149,1149,1149,1149,1149,1149,1149,78,78,78,78,78,78,78,
+    770,770,770,770,770,770,770,770,770,770,78,78,78,78,78,78,
+    1150,1150,1150,1150,1150,1150,1150,1150,1150,78,1150,1150,1150,1150,1150,1150,
+    1150,1150,1150,1150,1150,1150,1150,1151,1152,1152,1152,1152,1152,1152,1152,78,
+    1152,1152,1152,1152,1152,1152,1151,1153,1150,1154,1154,1154,1154,1154,78,78,
+    1155,1155,1155,1155,1155,1155,1155,1155,1155,1155,1156,1156,1156,1156,1156,1156,
+    1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,1156,78,78,78,
+    1157,1158,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,1159,
+    78,78,1160,1160,1160,1160,1160,1160,1160,1160,1160,1160,1160,1160,1160,1160,
+    78,1161,1160,1160,1160,1160,1160,1160,1160,1161,1160,1160,1161,1160,1160,78,
+    1162,1162,1162,1162,1162,1162,1162,78,1162,1162,78,1162,1162,1162,1162,1162,
+    1162,1162,1162,1162,1162,1162,1162,1162,1162,1163,1163,1163,1163,1163,1163,78,
+    78,78,1163,78,1163,1163,78,1163,1163,1163,1164,1163,1165,1165,1162,1163,
+    1166,1166,1166,1166,1166,1166,1166,1166,1166,1166,78,78,78,78,78,78,
+    1167,1167,1167,1167,1167,1167,78,1167,1167,78,1167,1167,1167,1167,1167,1167,
+    1167,1167,1167,1167,1167,1167,1167,1167,1167,1167,1168,1168,1168,1168,1168,78,
+    1169,1169,78,1168,1168,1169,1168,1170,1167,78,78,78,78,78,78,78,
+    1171,1171,1171,1171,1171,1171,1171,1171,1171,1171,78,78,78,78,78,78,
+    1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1172,1173,1173,1174,1174,1175,
+    1175,78,78,78,78,78,78,78,1176,1176,1177,1178,1177,1177,1177,1177,
+    1177,1177,1177,1177,1177,1177,1177,1177,1177,78,1177,1177,1177,1177,1177,1177,
+    1177,1177,1177,1177,1178,1178,1176,1176,1176,1176,1176,78,78,78,1178,1178,
+    1176,1179,1180,1181,1181,1182,1182,1182,1182,1182,1182,1182,1182,1182,1182,1182,
+    1183,1183,1183,1183,1183,1183,1183,1183,1183,1183,78,78,78,78,78,78,
+    728,78,78,78,78,78,78,78,1184,1184,1184,1184,1184,1184,1184,1184,
+    320,320,1184,320,1184,322,322,322,322,322,322,322,322,1185,1185,1185,
+    1185,322,322,322,322,322,322,322,322,322,322,322,322,322,322,322,
+    322,322,78,78,78,78,78,78,78,78,78,78,78,78,78,1186,
+    1187,1187,1187,1187,1187,1187,1187,1187,1187,1187,78,78,78,78,78,78,
+    1188,1188,1188,1188,1188,1188,1188,1188,1188,1188,1188,1188,1188,1188,1188,78,
+    1189,1189,1189,1189,1189,78,78,78,1187,1187,1187,1187,78,78,78,78,
+    1190,1190,1190,1190,1190,1190,1190,1190,1190,1191,1191,78,78,78,78,78,
+    1192,1192,1192,1192,1192,1192,1192,1192,1193,1193,1193,1194,1194,1194,1192,1192,
+    1192,1192,1194,1192,1192,1192,1193,1194,1193,1194,1192,1192,1192,1192,1192,1192,
+    1192,1193,1194,1194,1192,1192,1192,1192,1195,1195,1195,1195,1195,1195,1195,1196,
+    1197,1195,1195,1195,1196,1197,1196,1197,1198,1192,1192,1192,1192,1192,1192,1198,
+    1198,1198,1198,1198,1198,1198,1198,1198,1198,1198,1198,1198,1198,1198,78,78,
+    1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1199,1200,1201,
+    1199,1199,1199,1199,1199,1199,1199,78,739,78,78,78,78,78,78,78,
+    1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,1202,78,
+    1203,1203,1203,1203,1203,1203,1203,1203,1203,1203,78,78,78,78,1204,1204,
+    1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,1205,78,
+    1206,1206,1206,1206,1206,1206,1206,1206,1206,1206,78,78,78,78,78,78,
+    1207,1207,1207,1207,1207,1207,1207,1207,1207,1207,1207,1207,1207,1207,78,78,
+    1208,1208,1208,1208,1208,1209,78,78,1210,1210,1210,1210,1210,1210,1210,1210,
+    1211,1211,1211,1211,1211,1211,1211,1212,1212,1212,1213,1213,1214,1214,1214,1214,
+    1215,1215,1215,1215,1212,1214,78,78,1216,1216,1216,1216,1216,1216,1216,1216,
+    1216,1216,78,1217,1217,1217,1217,1217,1217,1217,78,1210,1210,1210,1210,1210,
+    78,78,78,78,78,1210,1210,1210,1218,1218,1218,1218,1218,1218,1218,1218,
+    1219,1219,1219,1219,1219,1219,1219,1219,1220,1220,1220,1220,1220,1220,1220,1220,
+    1220,1220,1220,1220,1220,1220,1220,1221,1221,1222,1222,78,78,78,78,78,
+    1223,1223,1223,1223,1223,1223,1223,1223,1223,1223,1223,78,78,78,78,1224,
+    1223,1225,1225,1225,1225,1225,1225,1225,1225,1225,1225,1225,1225,1225,1225,1225,
+    78,78,78,78,78,78,78,1224,1224,1224,1224,1226,1226,1226,1226,1226,
+    1226,1226,1226,1226,1226,1226,1226,1226,1227,1228,1229,683,1230,78,78,78,
+    1231,1231,78,78,78,78,78,78,1232,1232,1232,1232,1232,1232,1232,1232,
+    1233,1233,1233,1233,1233,1233,1233,1233,1233,1233,1233,1233,1233,1233,78,78,
+    1232,78,78,78,78,78,78,78,1234,1234,1234,1234,78,1234,1234,1234,
+    1234,1234,1234,1234,78,1234,1234,78,710,704,704,704,704,704,704,704,
+    710,710,710,78,78,78,78,78,78,78,703,78,78,78,78,78,
+    703,703,703,78,78,709,78,78,78,78,78,78,709,709,709,709,
+    1235,1235,1235,1235,1235,1235,1235,1235,1235,1235,1235,1235,78,78,78,78,
+    1236,1236,1236,1236,1236,1236,1236,1236,1236,1236,1236,78,78,78,78,78,
+    1236,1236,1236,1236,1236,78,78,78,1236,78,78,78,78,78,78,78,
+    1236,1236,78,78,1237,1238,1239,1240,1241,1241,1241,1241,78,78,78,78,
+    821,821,821,821,821,821,78,78,821,821,821,821,821,821,821,78,
+    396,396,396,396,78,78,78,78,396,396,396,396,396,396,78,78,
+    396,396,396,396,396,396,396,78,78,396,396,396,396,396,396,396,
+    396,396,396,396,396,1242,1242,68,68,68,396,396,396,1243,1242,1242,
+    1242,1242,1242,601,601,601,601,601,601,601,601,65,65,65,65,65,
+    65,65,65,396,396,63,63,63,63,63,65,65,396,396,396,396,
+    396,396,63,63,63,63,396,396,396,40,40,78,78,78,78,78,
+    853,853,1244,1244,1244,853,78,78,1245,1245,1245,1245,1245,1245,1245,1245,
+    1245,1245,1245,1245,78,78,78,78,1246,1246,1246,1246,1246,1246,1246,1246,
+    1246,1246,1245,1245,1245,1245,1245,1245,1245,78,78,78,78,78,78,78,
+    607,607,607,607,607,607,607,607,607,607,50,50,50,50,50,50,
+    50,50,50,50,50,50,50,50,50,50,50,50,607,607,607,607,
+    607,607,607,607,607,607,50,50,50,50,50,50,50,78,50,50,
+    50,50,50,50,607,78,607,607,78,78,607,78,78,607,607,78,
+    78,607,607,607,607,78,607,607,50,50,78,50,78,50,50,50,
+    50,50,50,50,78,50,50,50,50,50,50,50,607,607,78,607,
+    607,607,607,78,78,607,607,607,607,607,607,607,607,78,607,607,
+    607,607,607,607,607,78,50,50,607,607,78,607,607,607,607,78,
+    607,607,607,607,607,78,607,78,78,78,607,607,607,607,607,607,
+    607,78,50,50,50,50,50,50,50,50,50,50,50,50,78,78,
+    607,1247,50,50,50,50,50,50,50,50,50,25,50,50,50,50,
+    50,50,607,607,607,607,607,607,607,607,607,1247,50,50,50,50,
+    50,50,50,50,50,25,50,50,607,607,607,607,607,1247,50,50,
+    50,50,50,50,50,50,50,25,50,50,50,50,50,50,607,607,
+    607,607,607,607,607,607,607,1247,50,25,50,50,50,50,50,50,
+    50,50,607,50,78,78,22,22,1248,1248,1248,1248,1248,1248,1248,1248,
+    1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1248,
+    1248,1248,1248,1249,1249,1249,1249,1249,1249,1249,1249,1249,1249,1248,1248,1248,
+    1248,1248,1248,1248,1248,1249,1248,1248,1248,1248,1248,1248,1249,1248,1248,1250,
+    1250,1250,1250,1251,78,78,78,78,78,78,78,1249,1249,1249,1249,1249,
+    78,1249,1249,1249,1249,1249,1249,1249,33,33,54,33,33,33,33,33,
+    78,78,78,78,78,33,33,33,33,33,33,78,78,78,78,78,
+    1252,1252,1252,1252,1252,1252,1252,78,1252,1252,1252,1252,1252,1252,1252,1252,
+    1252,78,78,1252,1252,1252,1252,1252,1252,1252,78,1252,1252,78,1252,1252,
+    1252,1252,1252,78,78,78,78,78,557,557,557,557,557,557,557,557,
+    557,557,557,557,557,557,78,78,78,78,78,78,78,78,78,677,
+    1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,1253,78,78,78,
+    1254,1254,1254,1254,1254,1254,1254,1255,1255,1255,1255,1255,1255,1255,78,78,
+    1256,1256,1256,1256,1256,1256,1256,1256,1256,1256,78,78,78,78,1253,1257,
+    1258,1258,1258,1258,1258,1258,1258,1258,1258,1258,1258,1258,1258,1258,1259,78,
+    1260,1260,1260,1260,1260,1260,1260,1260,1260,1260,1260,1260,1261,1261,1261,1261,
+    1262,1262,1262,1262,1262,1262,1262,1262,1262,1262,78,78,78,78,78,1263,
+    1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1264,1265,1266,1266,1267,1268,
+    1269,1269,1269,1269,1269,1269,1269,1269,1269,1269,78,78,78,78,78,78,
+    415,415,415,415,78,415,415,78,1270,1270,1270,1270,1270,1270,1270,1270,
+    1270,1270,1270,1270,1270,98,98,1271,1271,1271,1271,1271,1271,1271,1271,1271,
+    1272,1272,1272,1272,1272,1272,1272,98,1273,1273,1273,1273,1273,1273,1273,1273,
+    1273,1273,1274,1274,1274,1274,1274,1274,1274,1274,1274,1274,1274,1274,1274,1274,
+    1274,1274,1274,1274,1275,1275,1275,1275,1275,1275,1276,1277,98,98,98,98,
+    1278,1278,1278,1278,1278,1278,1278,1278,1278,1278,98,98,98,98,1279,1279,
+    190,1280,1280,1280,1280,1280,1280,1280,1280,1280,1280,1280,1280,1280,1280,1280,
+    1280,1280,1280,1280,1281,1280,1280,1280,1282,1280,1280,1280,1280,190,190,190,
+    1280,1280,1280,1280,1280,1280,1283,1280,1280,1280,1280,1280,1280,1280,190,190,
+    141,141,141,141,190,141,141,141,190,141,141,190,141,190,190,141,
+    190,141,141,141,141,141,141,141,141,141,141,190,141,141,141,141,
+    190,141,190,141,190,190,190,190,190,190,141,190,190,190,190,141,
+    190,141,190,141,190,141,141,141,190,141,190,141,190,141,190,141,
+    190,141,141,141,141,190,141,190,141,141,190,141,141,141,141,141,
+    141,141,141,141,190,190,190,190,190,141,141,141,190,141,141,141,
+    125,125,190,190,190,190,190,190,645,645,645,645,814,814,814,814,
+    645,645,645,645,645,645,645,814,814,645,645,645,645,645,645,645,
+    645,645,645,645,645,645,814,814,48,48,48,52,52,645,645,645,
+    646,646,646,646,646,646,396,40,646,646,40,40,40,645,645,645,
+    646,646,646,646,646,645,814,814,814,814,814,814,814,814,1284,1284,
+    1284,1284,1284,1284,1284,1284,1284,1284,1285,722,722,814,814,814,814,814,
+    722,722,722,722,814,814,814,814,722,814,814,814,814,814,814,814,
+    716,716,814,814,814,814,814,814,645,645,645,645,645,647,645,645,
+    645,645,645,645,40,40,645,645,645,645,645,645,645,40,40,645,
+    645,645,645,645,40,645,645,645,645,645,647,647,647,645,645,647,
+    645,645,647,647,647,645,645,645,645,645,645,1286,1286,1286,1286,1286,
+    645,645,647,647,645,645,647,647,647,647,647,647,647,647,647,647,
+    647,645,645,645,645,645,645,645,645,645,645,645,645,645,647,647,
+    647,645,645,645,647,645,645,645,645,647,647,647,645,647,647,647,
+    645,645,645,645,645,645,645,647,645,647,645,645,645,645,645,645,
+    40,645,40,645,40,645,645,645,645,645,647,645,645,645,645,40,
+    645,40,40,645,645,645,645,645,645,645,645,645,645,645,645,40,
+    645,645,40,40,40,40,40,40,40,40,645,645,645,645,645,645,
+    645,645,645,645,647,647,645,645,645,645,647,645,645,645,645,645,
+    647,645,645,645,645,647,647,645,40,40,40,40,645,645,645,645,
+    645,645,645,645,645,647,647,647,645,645,645,647,647,647,647,647,
+    40,40,40,40,40,40,648,648,648,1287,1287,1287,40,40,40,40,
+    645,645,645,647,645,645,645,645,645,645,645,645,647,647,647,645,
+    645,645,645,645,647,645,645,645,814,814,814,814,645,645,645,645,
+    645,645,645,645,645,814,814,814,40,40,40,40,645,645,645,814,
+    814,814,814,645,645,645,645,645,645,645,814,814,814,814,814,814,
+    645,814,814,814,814,814,814,814,40,40,40,40,814,814,814,814,
+    40,40,814,814,814,814,814,814,40,40,40,40,40,40,814,814,
+    40,40,40,40,647,645,645,647,645,645,645,645,645,645,647,645,
+    647,647,645,645,647,647,647,645,645,645,645,645,645,647,647,645,
+    647,647,645,647,645,645,645,645,645,647,647,647,647,647,647,647,
+    647,647,647,647,647,647,645,645,645,645,645,645,645,645,814,645,
+    645,645,645,647,647,647,814,814,814,814,814,814,814,814,645,645,
+    647,814,814,814,814,814,814,814,40,40,40,78,40,40,40,40,
+    22,22,78,78,78,78,78,78,814,814,814,814,814,814,596,596,
+    724,814,814,814,814,814,814,814,724,724,724,814,814,814,814,814,
+    78,78,78,78,78,78,596,596,596,601,596,596,596,596,596,596,
+    601,601,601,601,601,601,601,601,813,813,813,813,813,813,596,596,
+    0,
+};
+
+static const hz_ucd_record_t hz_ucd_records[1289] = {
+    {0,0,164,164,0,0,0,0,0},{0,26,0,0,9,4,0,0,0},{0,26,0,0,11,13,0,0,0},{0,26,0,0,10,3,0,0,0},
+    {0,26,0,0,11,1,0,0,0},{0,26,0,0,12,1,0,0,0},{0,26,0,0,10,2,0,0,0},{0,26,0,0,10,4,0,0,0},
+    {0,26,0,0,11,4,0,0,0},{0,23,0,0,12,10,0,0,0},{0,18,0,0,13,19,0,0,0},{0,18,0,0,13,23,0,0,0},
+    {0,18,0,0,5,30,0,0,0},{0,20,0,0,5,27,0,0,0},{0,18,0,0,5,26,0,0,0},{0,18,0,0,13,30,0,0,0},
+    {1,14,0,0,13,22,0,0,0},{-1,15,0,0,13,18,0,0,0},{0,19,0,0,4,27,0,0,0},{0,18,0,0,7,24,0,0,0},
+    {0,13,0,0,4,15,0,0,0},{0,18,0,0,7,28,0,0,0},{0,9,0,0,3,25,0,0,0},{0,18,0,0,13,24,0,0,0},
+    {2,19,0,0,13,30,0,0,0},{0,19,0,0,13,30,0,0,0},{-2,19,0,0,13,30,0,0,0},{0,1,1,1,0,30,0,0,0},
+    {2,14,0,0,13,22,0,0,0},{0,18,0,0,13,27,0,0,0},{-2,15,0,0,13,18,0,0,0},{0,21,0,0,13,30,0,0,0},
+    {0,12,0,0,13,30,0,0,0},{0,2,1,1,0,30,0,0,0},{0,19,0,0,13,13,0,0,0},{-2,15,0,0,13,17,0,0,0},
+    {0,26,0,0,10,5,0,0,0},{0,23,0,0,7,9,0,0,0},{0,18,0,0,13,22,0,0,0},{0,20,0,0,5,26,0,0,0},
+    {0,22,0,0,13,30,0,0,0},{0,18,0,0,13,29,0,0,0},{0,21,0,0,13,29,0,0,0},{0,5,1,1,0,29,0,0,0},
+    {16,16,0,0,13,23,0,0,0},{0,27,0,0,9,13,5,0,0},{0,22,0,0,5,26,0,0,0},{0,19,0,0,5,27,0,0,0},
+    {0,11,0,0,3,29,0,0,0},{0,21,0,0,13,14,0,0,0},{0,2,0,0,0,30,0,0,0},{-16,17,0,0,13,23,0,0,0},
+    {0,11,0,0,13,29,0,0,0},{0,19,0,0,13,29,0,0,0},{0,5,1,1,0,30,0,0,0},{0,3,1,1,0,30,0,0,0},
+    {0,4,1,1,0,30,0,0,0},{0,4,0,0,13,30,0,0,0},{0,4,0,0,0,30,0,0,0},{0,4,0,0,13,29,0,0,0},
+    {0,4,0,0,13,14,0,0,0},{0,4,0,0,0,29,0,0,0},{0,21,35,35,13,30,0,0,0},{0,6,41,41,8,4,5,0,230},
+    {0,6,41,41,8,4,5,0,232},{0,6,41,41,8,4,5,0,220},{0,6,41,41,8,4,5,0,216},{0,6,41,41,8,4,5,0,202},
+    {0,6,41,41,8,4,5,0,1},{0,6,41,165,8,4,5,0,230},{0,6,41,165,8,4,5,0,240},{0,6,41,41,8,9,5,0,0},
+    {0,6,41,41,8,9,5,0,233},{0,6,41,41,8,9,5,0,234},{0,6,41,166,8,4,5,0,230},{0,1,2,2,0,30,0,0,0},
+    {0,2,2,2,0,30,0,0,0},{0,21,2,2,13,30,0,0,0},{0,0,164,164,0,0,0,0,0},{0,4,2,2,0,30,0,0,0},
+    {0,1,55,55,0,30,0,0,0},{0,2,55,55,0,30,0,0,0},{0,19,2,2,13,30,0,0,0},{0,1,3,3,0,30,0,0,0},
+    {0,2,3,3,0,30,0,0,0},{0,22,3,3,0,30,0,0,0},{0,6,3,167,8,4,5,0,230},{0,6,3,168,8,4,5,0,230},
+    {0,6,41,169,8,4,5,0,230},{0,8,3,3,8,4,5,0,0},{0,1,4,4,0,30,0,0,0},{0,4,4,4,0,30,0,0,0},
+    {0,18,4,4,0,30,0,0,0},{0,2,4,4,0,30,0,0,0},{0,18,4,4,0,24,0,0,0},{0,13,4,4,13,13,0,0,0},
+    {0,22,4,4,13,30,0,0,0},{0,20,4,4,5,27,0,0,0},{0,0,164,164,1,0,0,0,0},{0,6,5,5,8,4,5,0,220},
+    {0,6,5,5,8,4,5,0,230},{0,6,5,5,8,4,5,0,222},{0,6,5,5,8,4,5,0,228},{0,6,5,5,8,4,5,0,10},
+    {0,6,5,5,8,4,5,0,11},{0,6,5,5,8,4,5,0,12},{0,6,5,5,8,4,5,0,13},{0,6,5,5,8,4,5,0,14},
+    {0,6,5,5,8,4,5,0,15},{0,6,5,5,8,4,5,0,16},{0,6,5,5,8,4,5,0,17},{0,6,5,5,8,4,5,0,18},
+    {0,6,5,5,8,4,5,0,19},{0,6,5,5,8,4,5,0,20},{0,6,5,5,8,4,5,0,21},{0,6,5,5,8,4,5,0,22},
+    {0,13,5,5,1,13,0,0,0},{0,6,5,5,8,4,5,0,23},{0,18,5,5,1,30,0,0,0},{0,6,5,5,8,4,5,0,24},
+    {0,6,5,5,8,4,5,0,25},{0,18,5,5,1,19,0,0,0},{0,5,5,5,1,36,0,0,0},{0,27,6,6,6,30,0,0,0},
+    {0,27,0,0,6,30,0,0,0},{0,19,6,6,13,30,0,0,0},{0,19,6,6,2,30,0,0,0},{0,18,6,6,5,26,0,0,0},
+    {0,20,6,6,2,26,0,0,0},{0,18,0,170,7,24,0,0,0},{0,18,6,6,2,24,0,0,0},{0,22,6,6,13,30,0,0,0},
+    {0,6,6,6,8,4,5,0,230},{0,6,6,6,8,4,5,0,30},{0,6,6,6,8,4,5,0,31},{0,6,6,6,8,4,5,0,32},
+    {0,18,0,170,2,19,0,0,0},{0,27,6,171,2,4,5,0,0},{0,18,6,6,2,19,0,0,0},{0,18,0,172,2,19,0,0,0},
+    {0,5,6,6,2,30,2,97,0},{0,5,6,6,2,30,0,0,0},{0,5,6,6,2,30,4,6,0},{0,5,6,6,2,30,4,96,0},
+    {0,5,6,6,2,30,2,7,0},{0,5,6,6,2,30,4,91,0},{0,5,6,6,2,30,2,19,0},{0,5,6,6,2,30,4,10,0},
+    {0,5,6,6,2,30,4,78,0},{0,5,6,6,2,30,2,83,0},{0,5,6,6,2,30,2,81,0},{0,5,6,6,2,30,2,89,0},
+    {0,5,6,6,2,30,2,4,0},{0,5,6,6,2,30,2,17,0},{0,5,6,6,2,30,2,13,0},{0,4,0,173,2,30,1,0,0},
+    {0,5,6,6,2,30,2,15,0},{0,5,6,6,2,30,2,76,0},{0,5,6,6,2,30,2,26,0},{0,5,6,6,2,30,2,30,0},
+    {0,5,6,6,2,30,2,70,0},{0,5,6,6,2,30,2,72,0},{0,5,6,6,2,30,2,23,0},{0,6,41,174,8,4,5,0,27},
+    {0,6,41,174,8,4,5,0,28},{0,6,41,174,8,4,5,0,29},{0,6,41,174,8,4,5,0,30},{0,6,41,174,8,4,5,0,31},
+    {0,6,41,174,8,4,5,0,32},{0,6,41,174,8,4,5,0,33},{0,6,41,174,8,4,5,0,34},{0,6,41,174,8,4,5,0,230},
+    {0,6,41,174,8,4,5,0,220},{0,6,6,6,8,4,5,0,220},{0,9,6,175,6,25,0,0,0},{0,18,6,6,6,25,0,0,0},
+    {0,18,6,6,2,30,0,0,0},{0,6,41,174,8,4,5,0,35},{0,5,6,6,2,30,2,87,0},{0,5,6,6,2,30,2,74,0},
+    {0,5,6,6,2,30,2,29,0},{0,5,6,6,2,30,2,24,0},{0,5,6,6,2,30,4,92,0},{0,5,6,6,2,30,4,99,0},
+    {0,5,6,6,2,30,4,98,0},{0,18,6,176,2,19,0,0,0},{0,4,6,6,2,30,0,0,0},{0,9,6,6,3,25,0,0,0},
+    {0,22,6,6,2,30,0,0,0},{0,18,7,7,2,30,0,0,0},{0,0,164,164,2,0,0,0,0},{0,27,7,7,2,30,5,0,0},
+    {0,5,7,7,2,30,4,5,0},{0,6,7,7,8,4,5,0,36},{0,5,7,7,2,30,2,8,0},{0,5,7,7,2,30,2,18,0},
+    {0,5,7,7,2,30,4,11,0},{0,5,7,7,2,30,4,22,0},{0,5,7,7,2,30,4,88,0},{0,5,7,7,2,30,4,102,0},
+    {0,5,7,7,2,30,2,25,0},{0,5,7,7,2,30,2,93,0},{0,5,7,7,2,30,2,100,0},{0,5,7,7,2,30,4,101,0},
+    {0,5,7,7,2,30,2,27,0},{0,5,7,7,2,30,2,31,0},{0,5,7,7,2,30,2,71,0},{0,5,7,7,2,30,2,73,0},
+    {0,5,7,7,2,30,2,84,0},{0,5,7,7,2,30,2,16,0},{0,5,7,7,2,30,2,12,0},{0,5,7,7,2,30,2,75,0},
+    {0,5,7,7,2,30,2,79,0},{0,5,7,7,2,30,4,82,0},{0,5,7,7,2,30,2,77,0},{0,5,7,7,2,30,2,85,0},
+    {0,5,7,7,2,30,4,90,0},{0,6,7,7,8,4,5,0,230},{0,6,7,7,8,4,5,0,220},{0,5,7,7,2,30,4,103,0},
+    {0,5,7,7,2,30,2,28,0},{0,5,7,7,2,30,2,14,0},{0,5,6,6,2,30,2,9,0},{0,5,8,8,2,30,0,0,0},
+    {0,6,8,8,8,4,5,0,0},{0,9,66,66,1,25,0,0,0},{0,5,66,66,1,30,2,0,0},{0,6,66,66,8,4,5,0,230},
+    {0,6,66,66,8,4,5,0,220},{0,4,66,66,1,30,0,0,0},{0,22,66,66,13,30,0,0,0},{0,18,66,66,13,30,0,0,0},
+    {0,18,66,66,13,24,0,0,0},{0,18,66,66,13,19,0,0,0},{0,4,66,66,1,30,1,0,0},{0,20,66,66,1,27,0,0,0},
+    {0,5,82,82,1,30,0,0,0},{0,6,82,82,8,4,5,0,230},{0,4,82,82,1,30,0,0,0},{0,18,82,82,1,30,0,0,0},
+    {0,5,95,95,1,30,4,0,0},{0,5,95,95,1,30,2,0,0},{0,6,95,95,8,4,5,0,220},{0,18,95,95,1,30,0,0,0},
+    {0,5,7,7,2,30,2,36,0},{0,5,7,7,2,30,0,33,0},{0,5,7,7,2,30,2,39,0},{0,5,7,7,2,30,2,42,0},
+    {0,5,7,7,2,30,2,37,0},{0,5,7,7,2,30,2,38,0},{0,5,7,7,2,30,0,32,0},{0,5,7,7,2,30,4,40,0},
+    {0,5,7,7,2,30,2,34,0},{0,5,7,7,2,30,4,35,0},{0,5,7,7,2,30,4,41,0},{0,5,6,6,2,30,1,0,0},
+    {0,5,6,6,2,30,2,94,0},{0,21,6,6,2,30,0,0,0},{0,5,6,6,2,30,4,95,0},{0,5,6,6,2,30,4,80,0},
+    {0,5,6,6,2,30,4,86,0},{0,5,6,6,2,30,2,1,0},{0,5,6,6,2,30,2,3,0},{0,5,6,6,2,30,2,2,0},
+    {0,6,6,6,8,4,5,0,27},{0,6,6,6,8,4,5,0,28},{0,6,6,6,8,4,5,0,29},{0,6,9,9,8,4,5,0,0},
+    {0,7,9,9,0,4,0,0,0},{0,5,9,9,0,30,0,0,0},{0,6,9,9,8,4,5,0,7},{0,6,9,9,8,4,5,0,9},
+    {0,6,41,177,8,4,5,0,230},{0,6,41,178,8,4,5,0,220},{0,18,0,179,0,13,0,0,0},{0,18,0,180,0,13,0,0,0},
+    {0,9,9,181,0,25,0,0,0},{0,18,9,9,0,30,0,0,0},{0,4,9,9,0,30,0,0,0},{0,5,10,10,0,30,0,0,0},
+    {0,6,10,10,8,4,5,0,0},{0,7,10,10,0,4,0,0,0},{0,6,10,10,8,4,5,0,7},{0,6,10,10,8,4,5,0,9},
+    {0,9,10,182,0,25,0,0,0},{0,20,10,10,5,26,0,0,0},{0,11,10,10,0,30,0,0,0},{0,11,10,10,0,26,0,0,0},
+    {0,22,10,10,0,30,0,0,0},{0,20,10,10,5,27,0,0,0},{0,18,10,10,0,30,0,0,0},{0,6,10,10,8,4,5,0,230},
+    {0,6,11,11,8,4,5,0,0},{0,7,11,11,0,4,0,0,0},{0,5,11,11,0,30,0,0,0},{0,6,11,11,8,4,5,0,7},
+    {0,6,11,11,8,4,5,0,9},{0,9,11,183,0,25,0,0,0},{0,18,11,11,0,30,0,0,0},{0,6,12,12,8,4,5,0,0},
+    {0,7,12,12,0,4,0,0,0},{0,5,12,12,0,30,0,0,0},{0,6,12,12,8,4,5,0,7},{0,6,12,12,8,4,5,0,9},
+    {0,9,12,184,0,25,0,0,0},{0,18,12,12,0,30,0,0,0},{0,20,12,12,5,27,0,0,0},{0,6,13,13,8,4,5,0,0},
+    {0,7,13,13,0,4,0,0,0},{0,5,13,13,0,30,0,0,0},{0,6,13,13,8,4,5,0,7},{0,6,13,13,8,4,5,0,9},
+    {0,9,13,13,0,25,0,0,0},{0,22,13,13,0,30,0,0,0},{0,11,13,13,0,30,0,0,0},{0,6,14,14,8,4,5,0,0},
+    {0,5,14,14,0,30,0,0,0},{0,7,14,14,0,4,0,0,0},{0,6,14,14,8,4,5,0,9},{0,9,14,185,0,25,0,0,0},
+    {0,11,14,185,0,30,0,0,0},{0,22,14,185,13,30,0,0,0},{0,22,14,14,13,30,0,0,0},{0,20,14,14,5,27,0,0,0},
+    {0,6,15,15,8,4,5,0,0},{0,7,15,15,0,4,0,0,0},{0,5,15,15,0,30,0,0,0},{0,6,15,15,8,4,5,0,7},
+    {0,6,15,15,8,4,5,0,9},{0,6,15,15,8,4,5,0,84},{0,6,15,15,8,4,5,0,91},{0,9,15,15,0,25,0,0,0},
+    {0,18,15,15,0,14,0,0,0},{0,11,15,15,13,30,0,0,0},{0,22,15,15,0,30,0,0,0},{0,5,16,16,0,30,0,0,0},
+    {0,6,16,16,8,4,5,0,0},{0,7,16,16,0,4,0,0,0},{0,18,16,16,0,14,0,0,0},{0,6,16,16,8,4,5,0,7},
+    {0,6,16,16,0,4,5,0,0},{0,6,16,16,8,4,5,0,9},{0,9,16,186,0,25,0,0,0},{0,6,17,17,8,4,5,0,0},
+    {0,7,17,17,0,4,0,0,0},{0,5,17,17,0,30,0,0,0},{0,6,17,17,8,4,5,0,9},{0,22,17,17,0,30,0,0,0},
+    {0,11,17,17,0,30,0,0,0},{0,9,17,17,0,25,0,0,0},{0,22,17,17,0,26,0,0,0},{0,6,19,19,8,4,5,0,0},
+    {0,7,19,19,0,4,0,0,0},{0,5,19,19,0,30,0,0,0},{0,6,19,19,8,4,5,0,9},{0,9,19,19,0,25,0,0,0},
+    {0,18,19,19,0,30,0,0,0},{0,5,20,20,0,42,0,0,0},{0,6,20,20,8,42,5,0,0},{0,6,20,20,8,42,5,0,103},
+    {0,6,20,20,8,42,5,0,9},{0,4,20,20,0,42,0,0,0},{0,6,20,20,8,42,5,0,107},{0,18,20,20,0,30,0,0,0},
+    {0,9,20,20,0,25,0,0,0},{0,18,20,20,0,13,0,0,0},{0,5,21,21,0,42,0,0,0},{0,6,21,21,8,42,5,0,0},
+    {0,6,21,21,8,42,5,0,118},{0,6,21,21,8,42,5,0,9},{0,4,21,21,0,42,0,0,0},{0,6,21,21,8,42,5,0,122},
+    {0,9,21,21,0,25,0,0,0},{0,5,22,22,0,30,0,0,0},{0,22,22,22,0,14,0,0,0},{0,18,22,22,0,14,0,0,0},
+    {0,18,22,22,0,30,0,0,0},{0,18,22,22,0,9,0,0,0},{0,18,22,22,0,13,0,0,0},{0,18,22,22,0,19,0,0,0},
+    {0,22,22,22,0,30,0,0,0},{0,6,22,22,8,4,5,0,220},{0,9,22,22,0,25,0,0,0},{0,11,22,22,0,30,0,0,0},
+    {0,22,22,22,0,13,0,0,0},{0,6,22,22,8,4,5,0,216},{1,14,22,22,13,22,0,0,0},{-1,15,22,22,13,17,0,0,0},
+    {0,7,22,22,0,4,0,0,0},{0,6,22,22,8,4,5,0,129},{0,6,22,22,8,4,5,0,130},{0,6,22,22,8,4,5,0,0},
+    {0,6,22,22,8,4,5,0,132},{0,7,22,22,0,13,0,0,0},{0,6,22,22,8,4,5,0,230},{0,6,22,22,8,4,5,0,9},
+    {0,22,0,0,0,30,0,0,0},{0,5,23,23,0,42,0,0,0},{0,7,23,23,0,42,0,0,0},{0,6,23,23,8,42,5,0,0},
+    {0,6,23,23,8,42,5,0,7},{0,6,23,23,8,42,5,0,9},{0,9,23,187,0,25,0,0,0},{0,18,23,23,0,13,0,0,0},
+    {0,18,23,23,0,30,0,0,0},{0,6,23,23,8,42,5,0,220},{0,9,23,23,0,25,0,0,0},{0,22,23,23,0,42,0,0,0},
+    {0,1,24,24,0,30,0,0,0},{0,2,24,24,0,30,0,0,0},{0,18,0,188,0,30,0,0,0},{0,4,24,24,0,30,0,0,0},
+    {0,5,25,25,0,38,0,0,0},{0,5,25,25,0,39,0,0,0},{0,5,25,25,0,40,0,0,0},{0,5,26,26,0,30,0,0,0},
+    {0,6,26,26,8,4,5,0,230},{0,18,26,26,0,30,0,0,0},{0,18,26,26,0,13,0,0,0},{0,11,26,26,0,30,0,0,0},
+    {0,22,26,26,13,30,0,0,0},{0,1,27,27,0,30,0,0,0},{0,2,27,27,0,30,0,0,0},{0,13,28,28,13,13,0,0,0},
+    {0,5,28,28,0,30,0,0,0},{0,22,28,28,0,30,0,0,0},{0,18,28,28,0,30,0,0,0},{0,23,29,29,12,13,0,0,0},
+    {0,5,29,29,0,30,0,0,0},{1,14,29,29,13,22,0,0,0},{-1,15,29,29,13,17,0,0,0},{0,5,30,30,0,30,0,0,0},
+    {0,18,0,0,0,13,0,0,0},{0,10,30,30,0,30,0,0,0},{0,5,42,42,0,30,0,0,0},{0,6,42,42,8,4,5,0,0},
+    {0,6,42,42,8,4,5,0,9},{0,7,42,42,0,4,0,0,9},{0,5,43,43,0,30,0,0,0},{0,6,43,43,8,4,5,0,0},
+    {0,7,43,43,0,4,0,0,9},{0,18,0,189,0,13,0,0,0},{0,5,44,44,0,30,0,0,0},{0,6,44,44,8,4,5,0,0},
+    {0,5,45,45,0,30,0,0,0},{0,6,45,45,8,4,5,0,0},{0,5,31,31,0,42,0,0,0},{0,6,31,31,8,42,5,0,0},
+    {0,7,31,31,0,42,0,0,0},{0,6,31,31,8,42,5,0,9},{0,18,31,31,0,13,0,0,0},{0,18,31,31,0,21,0,0,0},
+    {0,4,31,31,0,42,0,0,0},{0,18,31,31,0,30,0,0,0},{0,20,31,31,5,27,0,0,0},{0,6,31,31,8,42,5,0,230},
+    {0,9,31,31,0,25,0,0,0},{0,11,31,31,13,30,0,0,0},{0,18,32,32,13,30,0,0,0},{0,18,0,190,13,19,0,0,0},
+    {0,18,32,32,13,13,0,0,0},{0,18,0,190,13,13,0,0,0},{0,13,32,32,13,14,0,0,0},{0,18,32,32,13,30,2,0,0},
+    {0,18,32,32,13,19,0,0,0},{0,18,32,32,13,30,1,0,0},{0,6,32,32,8,4,5,0,0},{0,27,32,32,9,9,0,0,0},
+    {0,9,32,32,0,25,0,0,0},{0,5,32,32,0,30,2,0,0},{0,4,32,32,0,30,2,0,0},{0,5,32,32,0,30,0,0,0},
+    {0,6,32,32,8,4,5,0,228},{0,5,46,46,0,30,0,0,0},{0,6,46,46,8,4,5,0,0},{0,7,46,46,0,4,0,0,0},
+    {0,6,46,46,8,4,5,0,222},{0,6,46,46,8,4,5,0,230},{0,6,46,46,8,4,5,0,220},{0,22,46,46,13,30,0,0,0},
+    {0,18,46,46,13,19,0,0,0},{0,9,46,46,0,25,0,0,0},{0,5,47,47,0,42,0,0,0},{0,5,56,56,0,42,0,0,0},
+    {0,9,56,56,0,25,0,0,0},{0,11,56,56,0,42,0,0,0},{0,22,56,56,13,42,0,0,0},{0,22,31,31,13,30,0,0,0},
+    {0,5,54,54,0,30,0,0,0},{0,6,54,54,8,4,5,0,230},{0,6,54,54,8,4,5,0,220},{0,7,54,54,0,4,0,0,0},
+    {0,6,54,54,8,4,5,0,0},{0,18,54,54,0,30,0,0,0},{0,5,78,78,0,42,0,0,0},{0,7,78,78,0,42,0,0,0},
+    {0,6,78,78,8,42,5,0,0},{0,6,78,78,8,42,5,0,9},{0,6,78,78,8,42,5,0,230},{0,6,78,78,8,4,5,0,220},
+    {0,9,78,78,0,25,0,0,0},{0,18,78,78,0,42,0,0,0},{0,4,78,78,0,42,0,0,0},{0,8,41,41,8,4,5,0,0},
+    {0,6,62,62,8,4,5,0,0},{0,7,62,62,0,4,0,0,0},{0,5,62,62,0,30,0,0,0},{0,6,62,62,8,4,5,0,7},
+    {0,7,62,62,0,4,0,0,9},{0,9,62,62,0,25,0,0,0},{0,18,62,62,0,13,0,0,0},{0,18,62,62,0,30,0,0,0},
+    {0,22,62,62,0,30,0,0,0},{0,6,62,62,8,4,5,0,230},{0,6,62,62,8,4,5,0,220},{0,6,67,67,8,4,5,0,0},
+    {0,7,67,67,0,4,0,0,0},{0,5,67,67,0,30,0,0,0},{0,7,67,67,0,4,0,0,9},{0,6,67,67,8,4,5,0,9},
+    {0,9,67,67,0,25,0,0,0},{0,5,93,93,0,30,0,0,0},{0,6,93,93,8,4,5,0,7},{0,7,93,93,0,4,0,0,0},
+    {0,6,93,93,8,4,5,0,0},{0,7,93,93,0,4,0,0,9},{0,18,93,93,0,30,0,0,0},{0,5,68,68,0,30,0,0,0},
+    {0,7,68,68,0,4,0,0,0},{0,6,68,68,8,4,5,0,0},{0,6,68,68,8,4,5,0,7},{0,18,68,68,0,13,0,0,0},
+    {0,9,68,68,0,25,0,0,0},{0,9,69,69,0,25,0,0,0},{0,5,69,69,0,30,0,0,0},{0,4,69,69,0,30,0,0,0},
+    {0,18,69,69,0,13,0,0,0},{0,18,67,67,0,30,0,0,0},{0,6,41,191,8,4,5,0,230},{0,6,41,192,8,4,5,0,230},
+    {0,18,0,193,0,30,0,0,0},{0,6,41,192,8,4,5,0,1},{0,6,41,194,8,4,5,0,220},{0,6,41,195,8,4,5,0,220},
+    {0,6,41,196,8,4,5,0,230},{0,6,41,192,8,4,5,0,220},{0,6,41,195,8,4,5,0,230},{0,7,0,197,0,4,0,0,0},
+    {0,5,0,198,0,30,0,0,0},{0,5,0,197,0,30,0,0,0},{0,5,0,199,0,30,0,0,0},{0,5,0,200,0,30,0,0,0},
+    {0,5,0,193,0,30,0,0,0},{0,6,41,201,8,4,5,0,230},{0,7,0,202,0,4,0,0,0},{0,6,41,203,8,4,5,0,230},
+    {0,5,0,204,0,30,0,0,0},{0,4,3,3,0,30,0,0,0},{0,6,41,41,8,4,5,0,214},{0,6,41,41,8,4,5,0,228},
+    {0,6,41,205,8,4,5,0,228},{0,6,41,206,8,4,5,0,218},{0,3,2,2,0,30,0,0,0},{0,21,2,2,13,14,0,0,0},
+    {0,23,0,0,12,13,0,0,0},{0,23,0,0,12,9,0,0,0},{0,27,0,0,9,8,5,0,0},{0,27,41,41,9,4,0,0,0},
+    {0,27,41,41,9,11,1,0,0},{0,27,0,0,0,4,5,0,0},{0,27,0,0,1,4,5,0,0},{0,13,0,0,13,13,0,0,0},
+    {0,13,0,0,13,9,0,0,0},{0,13,0,0,13,12,0,0,0},{0,13,0,0,13,29,0,0,0},{0,16,0,0,13,23,0,0,0},
+    {0,17,0,0,13,23,0,0,0},{0,14,0,0,13,22,0,0,0},{0,18,0,0,13,20,0,0,0},{0,18,0,0,13,13,0,0,0},
+    {0,24,0,0,12,1,0,0,0},{0,25,0,0,10,1,0,0,0},{0,27,0,0,14,4,5,0,0},{0,27,0,0,16,4,5,0,0},
+    {0,27,0,0,18,4,5,0,0},{0,27,0,0,15,4,5,0,0},{0,27,0,0,17,4,5,0,0},{0,23,0,207,7,9,0,0,0},
+    {0,18,0,0,13,26,0,0,0},{1,16,0,0,13,23,0,0,0},{-1,17,0,0,13,23,0,0,0},{0,18,0,0,13,21,0,0,0},
+    {0,19,0,0,7,24,0,0,0},{-1,15,0,0,13,17,0,0,0},{0,27,0,0,9,7,5,0,0},{0,27,0,0,9,30,5,0,0},
+    {0,0,164,164,9,0,0,0,0},{0,27,0,0,19,4,0,0,0},{0,27,0,0,20,4,0,0,0},{0,27,0,0,21,4,0,0,0},
+    {0,27,0,0,22,4,0,0,0},{0,27,0,0,9,4,5,0,0},{0,11,0,0,3,30,0,0,0},{0,19,0,0,4,30,0,0,0},
+    {0,4,1,1,0,29,0,0,0},{0,0,164,164,5,27,0,0,0},{0,6,41,208,8,4,5,0,230},{0,1,0,0,0,30,0,0,0},
+    {0,22,0,0,13,26,0,0,0},{0,22,0,0,13,29,0,0,0},{0,2,0,0,0,29,0,0,0},{0,22,0,0,13,27,0,0,0},
+    {0,1,1,1,0,29,0,0,0},{0,22,0,0,5,30,0,0,0},{0,5,0,0,0,30,0,0,0},{0,11,0,0,13,30,0,0,0},
+    {0,10,1,1,0,29,0,0,0},{0,10,1,1,0,30,0,0,0},{3,19,0,0,13,29,0,0,0},{3,19,0,0,13,30,0,0,0},
+    {-3,19,0,0,13,29,0,0,0},{-3,19,0,0,13,30,0,0,0},{2016,19,0,0,13,29,0,0,0},{2527,19,0,0,13,29,0,0,0},
+    {1923,19,0,0,13,29,0,0,0},{1914,19,0,0,13,30,0,0,0},{1918,19,0,0,13,30,0,0,0},{2250,19,0,0,13,30,0,0,0},
+    {1,19,0,0,13,29,0,0,0},{-1,19,0,0,13,29,0,0,0},{138,19,0,0,13,30,0,0,0},{7,19,0,0,13,30,0,0,0},
+    {-7,19,0,0,13,29,0,0,0},{-1,19,0,0,13,30,0,0,0},{1,19,0,0,13,30,0,0,0},{1824,19,0,0,13,30,0,0,0},
+    {2104,19,0,0,13,30,0,0,0},{2108,19,0,0,13,30,0,0,0},{2106,19,0,0,13,30,0,0,0},{1316,19,0,0,13,30,0,0,0},
+    {-138,19,0,0,13,30,0,0,0},{0,19,0,0,13,20,0,0,0},{8,19,0,0,13,30,0,0,0},{-8,19,0,0,13,30,0,0,0},
+    {-7,19,0,0,13,30,0,0,0},{0,22,0,0,13,37,0,0,0},{0,22,0,0,0,29,0,0,0},{0,22,0,0,13,32,0,0,0},
+    {0,22,0,0,13,23,0,0,0},{0,22,0,0,13,19,0,0,0},{-1316,19,0,0,13,30,0,0,0},{0,22,53,53,0,30,0,0,0},
+    {3,14,0,0,13,22,0,0,0},{1,15,0,0,13,17,0,0,0},{-1,14,0,0,13,22,0,0,0},{-3,15,0,0,13,17,0,0,0},
+    {-1914,19,0,0,13,30,0,0,0},{-1918,19,0,0,13,30,0,0,0},{-1923,19,0,0,13,30,0,0,0},{-1824,19,0,0,13,30,0,0,0},
+    {-2016,19,0,0,13,30,0,0,0},{-2104,19,0,0,13,30,0,0,0},{-2106,19,0,0,13,30,0,0,0},{-2108,19,0,0,13,30,0,0,0},
+    {-2250,19,0,0,13,30,0,0,0},{-2527,22,0,0,13,30,0,0,0},{0,1,57,57,0,30,0,0,0},{0,2,57,57,0,30,0,0,0},
+    {0,22,55,55,13,30,0,0,0},{0,6,55,55,8,4,5,0,230},{0,18,55,55,13,19,0,0,0},{0,18,55,55,13,13,0,0,0},
+    {0,11,55,55,13,30,0,0,0},{0,5,58,58,0,30,0,0,0},{0,4,58,58,0,30,0,0,0},{0,18,58,58,0,13,0,0,0},
+    {0,6,58,58,8,4,5,0,9},{0,6,3,3,8,4,5,0,230},{0,13,0,0,13,30,0,0,0},{0,18,0,209,13,13,0,0,0},
+    {0,22,36,36,13,37,0,0,0},{0,18,0,210,13,17,0,0,0},{0,18,0,211,13,37,0,0,0},{0,4,36,36,0,21,0,0,0},
+    {0,5,0,212,0,37,0,0,0},{0,10,36,36,0,37,0,0,0},{1,14,0,210,13,22,0,0,0},{-1,15,0,210,13,17,0,0,0},
+    {0,22,0,211,13,37,0,0,0},{0,13,0,211,13,21,0,0,0},{0,14,0,211,13,22,0,0,0},{0,15,0,211,13,17,0,0,0},
+    {0,6,41,213,8,4,5,0,218},{0,6,41,213,8,4,5,0,228},{0,6,41,213,8,4,5,0,232},{0,6,41,213,8,4,5,0,222},
+    {0,7,25,25,0,4,0,0,224},{0,13,0,211,13,37,0,0,0},{0,4,0,214,0,37,0,0,0},{0,4,0,214,0,4,0,0,0},
+    {0,5,0,215,0,21,0,0,0},{0,18,0,215,13,37,0,0,0},{0,22,0,212,13,37,0,0,0},{0,5,33,33,0,31,0,0,0},
+    {0,5,33,33,0,37,0,0,0},{0,6,41,216,8,4,5,0,8},{0,21,0,214,13,21,0,0,0},{0,4,33,33,0,21,0,0,0},
+    {0,13,0,214,13,21,0,0,0},{0,5,34,34,0,31,0,0,0},{0,5,34,34,0,37,0,0,0},{0,18,0,210,13,21,0,0,0},
+    {0,4,0,214,0,31,0,0,0},{0,4,34,34,0,21,0,0,0},{0,5,35,35,0,37,0,0,0},{0,5,25,25,0,37,0,0,0},
+    {0,22,0,212,0,37,0,0,0},{0,11,0,212,0,37,0,0,0},{0,22,25,25,0,37,0,0,0},{0,22,25,25,13,37,0,0,0},
+    {0,11,0,0,0,29,0,0,0},{0,11,0,0,13,37,0,0,0},{0,22,0,0,0,37,0,0,0},{0,22,34,34,0,37,0,0,0},
+    {0,5,36,36,0,37,0,0,0},{0,5,37,37,0,37,0,0,0},{0,4,37,37,0,21,0,0,0},{0,22,37,37,13,37,0,0,0},
+    {0,5,83,83,0,30,0,0,0},{0,4,83,83,0,30,0,0,0},{0,18,83,83,0,13,0,0,0},{0,5,70,70,0,30,0,0,0},
+    {0,4,70,70,0,30,0,0,0},{0,18,70,70,13,13,0,0,0},{0,18,70,70,13,19,0,0,0},{0,9,70,70,0,25,0,0,0},
+    {0,5,3,3,0,30,0,0,0},{0,18,3,3,13,30,0,0,0},{0,4,3,3,13,30,0,0,0},{0,5,84,84,0,30,0,0,0},
+    {0,10,84,84,0,30,0,0,0},{0,6,84,84,8,4,5,0,230},{0,18,84,84,0,30,0,0,0},{0,18,84,84,0,13,0,0,0},
+    {0,21,0,217,13,30,0,0,0},{0,21,0,0,0,30,0,0,0},{0,5,59,59,0,30,0,0,0},{0,6,59,59,8,4,5,0,0},
+    {0,6,59,59,8,4,5,0,9},{0,7,59,59,0,4,0,0,0},{0,22,59,59,13,30,0,0,0},{0,11,0,218,0,30,0,0,0},
+    {0,11,0,219,0,30,0,0,0},{0,22,0,220,0,30,0,0,0},{0,20,0,220,5,26,0,0,0},{0,22,0,220,5,30,0,0,0},
+    {0,5,65,65,0,30,2,0,0},{0,5,65,65,0,30,3,0,0},{0,5,65,65,0,30,0,0,0},{0,18,65,65,13,14,0,0,0},
+    {0,18,65,65,13,19,0,0,0},{0,7,71,71,0,4,0,0,0},{0,5,71,71,0,30,0,0,0},{0,6,71,71,8,4,5,0,9},
+    {0,6,71,71,8,4,5,0,0},{0,18,71,71,0,13,0,0,0},{0,9,71,71,0,25,0,0,0},{0,6,9,9,8,4,5,0,230},
+    {0,6,9,221,8,4,5,0,230},{0,5,9,222,0,30,0,0,0},{0,18,9,9,0,14,0,0,0},{0,9,72,72,0,25,0,0,0},
+    {0,5,72,72,0,30,0,0,0},{0,6,72,72,8,4,5,0,0},{0,6,72,72,8,4,5,0,220},{0,18,0,223,0,13,0,0,0},
+    {0,18,72,72,0,13,0,0,0},{0,5,73,73,0,30,0,0,0},{0,6,73,73,8,4,5,0,0},{0,7,73,73,0,4,0,0,0},
+    {0,7,73,73,0,4,0,0,9},{0,18,73,73,0,30,0,0,0},{0,6,85,85,8,4,5,0,0},{0,7,85,85,0,4,0,0,0},
+    {0,5,85,85,0,30,0,0,0},{0,6,85,85,8,4,5,0,7},{0,7,85,85,0,4,0,0,9},{0,18,85,85,0,30,0,0,0},
+    {0,18,85,85,0,13,0,0,0},{0,4,0,224,0,30,0,0,0},{0,9,85,85,0,25,0,0,0},{0,4,23,23,0,42,0,0,0},
+    {0,5,77,77,0,30,0,0,0},{0,6,77,77,8,4,5,0,0},{0,7,77,77,0,4,0,0,0},{0,9,77,77,0,25,0,0,0},
+    {0,18,77,77,0,30,0,0,0},{0,18,77,77,0,13,0,0,0},{0,5,79,79,0,42,0,0,0},{0,6,79,79,8,42,5,0,230},
+    {0,6,79,79,8,42,5,0,220},{0,4,79,79,0,42,0,0,0},{0,18,79,79,0,42,0,0,0},{0,5,86,86,0,30,0,0,0},
+    {0,7,86,86,0,4,0,0,0},{0,6,86,86,8,4,5,0,0},{0,18,86,86,0,13,0,0,0},{0,4,86,86,0,30,0,0,0},
+    {0,6,86,86,8,4,5,0,9},{0,9,86,86,0,25,0,0,0},{0,5,25,25,0,34,0,0,0},{0,5,25,25,0,35,0,0,0},
+    {0,28,164,164,0,6,0,0,0},{0,29,164,164,0,0,0,0,0},{0,0,164,164,0,37,0,0,0},{0,6,5,5,8,4,5,0,26},
+    {0,19,5,5,4,30,0,0,0},{0,15,0,225,13,17,0,0,0},{0,14,0,225,13,22,0,0,0},{0,5,6,226,2,30,0,0,0},
+    {0,22,6,226,13,30,0,0,0},{0,6,41,41,8,4,5,0,0},{0,18,0,0,13,17,0,0,0},{0,15,0,0,13,17,0,0,0},
+    {0,18,0,0,13,37,0,0,0},{0,13,0,0,13,37,0,0,0},{0,12,0,0,13,37,0,0,0},{0,18,0,0,7,17,0,0,0},
+    {0,18,0,0,7,21,0,0,0},{0,18,0,0,5,37,0,0,0},{0,19,0,0,4,37,0,0,0},{0,13,0,0,4,37,0,0,0},
+    {1,19,0,0,13,37,0,0,0},{-1,19,0,0,13,37,0,0,0},{0,19,0,0,13,37,0,0,0},{0,18,0,0,7,37,0,0,0},
+    {0,9,0,0,3,37,0,0,0},{2,19,0,0,13,37,0,0,0},{-2,19,0,0,13,37,0,0,0},{0,1,1,1,0,37,0,0,0},
+    {0,21,0,0,13,37,0,0,0},{0,2,1,1,0,37,0,0,0},{0,4,0,214,0,21,0,0,0},{0,27,0,0,13,4,5,0,0},
+    {0,22,0,0,13,16,0,0,0},{0,5,48,48,0,30,0,0,0},{0,18,0,227,0,13,0,0,0},{0,18,0,227,13,13,0,0,0},
+    {0,18,0,228,0,13,0,0,0},{0,11,0,229,0,30,0,0,0},{0,22,0,228,0,30,0,0,0},{0,10,2,2,13,30,0,0,0},
+    {0,11,2,2,13,30,0,0,0},{0,22,2,2,13,30,0,0,0},{0,22,2,2,0,30,0,0,0},{0,5,74,74,0,30,0,0,0},
+    {0,5,75,75,0,30,0,0,0},{0,6,41,230,8,4,5,0,220},{0,11,0,231,3,30,0,0,0},{0,5,38,38,0,30,0,0,0},
+    {0,11,38,38,0,30,0,0,0},{0,5,39,39,0,30,0,0,0},{0,10,39,39,0,30,0,0,0},{0,5,120,120,0,30,0,0,0},
+    {0,6,120,120,8,4,5,0,230},{0,5,49,49,0,30,0,0,0},{0,18,49,49,0,13,0,0,0},{0,5,60,60,0,30,0,0,0},
+    {0,18,60,60,0,13,0,0,0},{0,10,60,60,0,30,0,0,0},{0,1,40,40,0,30,0,0,0},{0,2,40,40,0,30,0,0,0},
+    {0,5,50,50,0,30,0,0,0},{0,5,51,51,0,30,0,0,0},{0,9,51,51,0,25,0,0,0},{0,1,136,136,0,30,0,0,0},
+    {0,2,136,136,0,30,0,0,0},{0,5,106,106,0,30,0,0,0},{0,5,103,103,0,30,0,0,0},{0,18,103,103,0,30,0,0,0},
+    {0,1,161,161,0,30,0,0,0},{0,2,161,161,0,30,0,0,0},{0,5,110,110,0,30,0,0,0},{0,5,52,52,1,30,0,0,0},
+    {0,5,87,87,1,30,0,0,0},{0,18,87,87,1,13,0,0,0},{0,11,87,87,1,30,0,0,0},{0,5,118,118,1,30,0,0,0},
+    {0,22,118,118,1,30,0,0,0},{0,11,118,118,1,30,0,0,0},{0,5,117,117,1,30,0,0,0},{0,11,117,117,1,30,0,0,0},
+    {0,5,128,128,1,30,0,0,0},{0,11,128,128,1,30,0,0,0},{0,5,64,64,1,30,0,0,0},{0,11,64,64,1,30,0,0,0},
+    {0,18,64,64,13,13,0,0,0},{0,5,76,76,1,30,0,0,0},{0,18,76,76,1,30,0,0,0},{0,5,98,98,1,30,0,0,0},
+    {0,5,97,97,1,30,0,0,0},{0,11,97,97,1,30,0,0,0},{0,5,61,61,1,30,0,0,0},{0,6,61,61,8,4,5,0,0},
+    {0,6,61,61,8,4,5,0,220},{0,6,61,61,8,4,5,0,230},{0,6,61,61,8,4,5,0,1},{0,6,61,61,8,4,5,0,9},
+    {0,11,61,61,1,30,0,0,0},{0,18,61,61,1,13,0,0,0},{0,18,61,61,1,30,0,0,0},{0,5,88,88,1,30,0,0,0},
+    {0,11,88,88,1,30,0,0,0},{0,18,88,88,1,30,0,0,0},{0,5,116,116,1,30,0,0,0},{0,11,116,116,1,30,0,0,0},
+    {0,5,112,112,1,30,2,43,0},{0,5,112,112,1,30,2,45,0},{0,5,112,112,1,30,2,49,0},{0,5,112,112,1,30,4,46,0},
+    {0,5,112,112,1,30,0,0,0},{0,5,112,112,1,30,4,67,0},{0,22,112,112,1,30,0,0,0},{0,5,112,112,1,30,4,69,0},
+    {0,5,112,112,1,30,3,50,0},{0,5,112,112,1,30,4,64,0},{0,5,112,112,1,30,4,68,0},{0,5,112,112,1,30,4,52,0},
+    {0,5,112,112,1,30,2,53,0},{0,5,112,112,1,30,2,47,0},{0,5,112,112,1,30,2,65,0},{0,5,112,112,1,30,2,54,0},
+    {0,5,112,112,1,30,3,55,0},{0,5,112,112,1,30,2,61,0},{0,5,112,112,1,30,2,44,0},{0,5,112,112,1,30,2,57,0},
+    {0,5,112,112,1,30,4,60,0},{0,5,112,112,1,30,2,58,0},{0,5,112,112,1,30,4,59,0},{0,5,112,112,1,30,4,62,0},
+    {0,6,112,112,8,4,5,0,230},{0,6,112,112,8,4,5,0,220},{0,11,112,112,1,30,2,56,0},{0,11,112,112,1,30,2,48,0},
+    {0,11,112,112,1,30,2,63,0},{0,11,112,112,1,30,2,66,0},{0,11,112,112,1,30,4,51,0},{0,18,112,112,1,13,0,0,0},
+    {0,18,112,232,1,13,0,0,0},{0,18,112,112,1,20,0,0,0},{0,5,80,80,1,30,0,0,0},{0,18,80,80,13,13,0,0,0},
+    {0,5,89,89,1,30,0,0,0},{0,11,89,89,1,30,0,0,0},{0,5,90,90,1,30,0,0,0},{0,11,90,90,1,30,0,0,0},
+    {0,5,121,121,1,30,2,0,0},{0,5,121,121,1,30,4,0,0},{0,18,121,121,1,30,0,0,0},{0,11,121,121,1,30,4,0,0},
+    {0,11,121,121,1,30,2,0,0},{0,11,121,121,1,30,0,0,0},{0,5,91,91,1,30,0,0,0},{0,1,130,130,1,30,0,0,0},
+    {0,2,130,130,1,30,0,0,0},{0,11,130,130,1,30,0,0,0},{0,5,146,146,2,30,3,0,0},{0,5,146,146,2,30,2,0,0},
+    {0,5,146,146,2,30,2,21,0},{0,5,146,146,2,30,2,20,0},{0,5,146,146,2,30,4,0,0},{0,6,146,146,8,4,5,0,230},
+    {0,9,146,146,6,25,0,0,0},{0,11,6,6,6,30,0,0,0},{0,5,156,156,1,30,0,0,0},{0,6,156,156,8,4,5,0,230},
+    {0,13,156,156,1,13,0,0,0},{0,5,148,148,1,30,0,0,0},{0,11,148,148,1,30,0,0,0},{0,5,147,147,2,30,2,0,0},
+    {0,5,147,147,2,30,4,0,0},{0,5,147,147,2,30,0,0,0},{0,6,147,147,8,4,5,0,220},{0,6,147,147,8,4,5,0,230},
+    {0,11,147,147,2,30,2,0,0},{0,11,147,147,2,30,4,0,0},{0,18,147,147,2,30,0,0,0},{0,5,158,158,1,30,2,0,0},
+    {0,5,158,158,1,30,4,0,0},{0,6,158,158,8,4,5,0,230},{0,6,158,158,8,4,5,0,220},{0,18,158,158,1,30,0,0,0},
+    {0,5,153,153,1,30,2,0,0},{0,5,153,153,1,30,0,0,0},{0,5,153,153,1,30,4,0,0},{0,11,153,153,1,30,0,0,0},
+    {0,11,153,153,1,30,4,0,0},{0,11,153,153,1,30,2,0,0},{0,11,153,153,1,30,3,0,0},{0,5,149,149,1,30,0,0,0},
+    {0,7,94,94,0,4,0,0,0},{0,6,94,94,8,4,5,0,0},{0,5,94,94,0,30,0,0,0},{0,6,94,94,8,4,5,0,9},
+    {0,18,94,94,0,13,0,0,0},{0,18,94,94,0,30,0,0,0},{0,11,94,94,13,30,0,0,0},{0,9,94,94,0,25,0,0,0},
+    {0,6,92,92,8,4,5,0,0},{0,7,92,92,0,4,0,0,0},{0,5,92,92,0,30,0,0,0},{0,6,92,92,8,4,5,0,9},
+    {0,6,92,92,8,4,5,0,7},{0,18,92,92,0,30,0,0,0},{0,27,92,92,0,30,0,0,0},{0,18,92,92,0,13,0,0,0},
+    {0,5,101,101,0,30,0,0,0},{0,9,101,101,0,25,0,0,0},{0,6,96,96,8,4,5,0,230},{0,5,96,96,0,30,0,0,0},
+    {0,6,96,96,8,4,5,0,0},{0,7,96,96,0,4,0,0,0},{0,6,96,96,8,4,5,0,9},{0,9,96,96,0,25,0,0,0},
+    {0,18,96,96,0,13,0,0,0},{0,5,111,111,0,30,0,0,0},{0,6,111,111,8,4,5,0,7},{0,18,111,111,0,30,0,0,0},
+    {0,18,111,111,0,14,0,0,0},{0,6,100,100,8,4,5,0,0},{0,7,100,100,0,4,0,0,0},{0,5,100,100,0,30,0,0,0},
+    {0,7,100,100,0,4,0,0,9},{0,18,100,100,0,13,0,0,0},{0,18,100,100,0,30,0,0,0},{0,6,100,100,8,4,5,0,7},
+    {0,9,100,100,0,25,0,0,0},{0,18,100,100,0,14,0,0,0},{0,11,19,19,0,30,0,0,0},{0,5,109,109,0,30,0,0,0},
+    {0,7,109,109,0,4,0,0,0},{0,6,109,109,8,4,5,0,0},{0,7,109,109,0,4,0,0,9},{0,6,109,109,8,4,5,0,7},
+    {0,18,109,109,0,13,0,0,0},{0,18,109,109,0,30,0,0,0},{0,5,129,129,0,30,0,0,0},{0,18,129,129,0,13,0,0,0},
+    {0,5,123,123,0,30,0,0,0},{0,6,123,123,8,4,5,0,0},{0,7,123,123,0,4,0,0,0},{0,6,123,123,8,4,5,0,7},
+    {0,6,123,123,8,4,5,0,9},{0,9,123,123,0,25,0,0,0},{0,6,107,107,8,4,5,0,0},{0,6,107,233,8,4,5,0,0},
+    {0,7,107,107,0,4,0,0,0},{0,7,107,233,0,4,0,0,0},{0,5,107,107,0,30,0,0,0},{0,6,41,234,8,4,5,0,7},
+    {0,6,107,233,8,4,5,0,7},{0,7,107,107,0,4,0,0,9},{0,6,107,107,8,4,5,0,230},{0,5,135,135,0,30,0,0,0},
+    {0,7,135,135,0,4,0,0,0},{0,6,135,135,8,4,5,0,0},{0,6,135,135,8,4,5,0,9},{0,6,135,135,8,4,5,0,7},
+    {0,18,135,135,0,13,0,0,0},{0,18,135,135,0,30,0,0,0},{0,9,135,135,0,25,0,0,0},{0,6,135,135,8,4,5,0,230},
+    {0,5,124,124,0,30,0,0,0},{0,7,124,124,0,4,0,0,0},{0,6,124,124,8,4,5,0,0},{0,6,124,124,8,4,5,0,9},
+    {0,6,124,124,8,4,5,0,7},{0,18,124,124,0,30,0,0,0},{0,9,124,124,0,25,0,0,0},{0,5,122,122,0,30,0,0,0},
+    {0,7,122,122,0,4,0,0,0},{0,6,122,122,8,4,5,0,0},{0,6,122,122,8,4,5,0,9},{0,6,122,122,8,4,5,0,7},
+    {0,18,122,122,0,14,0,0,0},{0,18,122,122,0,13,0,0,0},{0,18,122,122,0,19,0,0,0},{0,18,122,122,0,30,0,0,0},
+    {0,5,114,114,0,30,0,0,0},{0,7,114,114,0,4,0,0,0},{0,6,114,114,8,4,5,0,0},{0,6,114,114,8,4,5,0,9},
+    {0,18,114,114,0,13,0,0,0},{0,18,114,114,0,30,0,0,0},{0,9,114,114,0,25,0,0,0},{0,18,32,32,13,14,0,0,0},
+    {0,5,102,102,0,30,0,0,0},{0,6,102,102,8,4,5,0,0},{0,7,102,102,0,4,0,0,0},{0,7,102,102,0,4,0,0,9},
+    {0,6,102,102,8,4,5,0,7},{0,18,102,102,0,30,0,0,0},{0,9,102,102,0,25,0,0,0},{0,5,126,126,0,42,0,0,0},
+    {0,6,126,126,8,42,5,0,0},{0,7,126,126,0,42,0,0,0},{0,6,126,126,8,42,5,0,9},{0,9,126,126,0,25,0,0,0},
+    {0,11,126,126,0,42,0,0,0},{0,18,126,126,0,13,0,0,0},{0,22,126,126,0,42,0,0,0},{0,5,142,142,0,30,0,0,0},
+    {0,7,142,142,0,4,0,0,0},{0,6,142,142,8,4,5,0,0},{0,6,142,142,8,4,5,0,9},{0,6,142,142,8,4,5,0,7},
+    {0,18,142,142,0,30,0,0,0},{0,1,125,125,0,30,0,0,0},{0,2,125,125,0,30,0,0,0},{0,9,125,125,0,25,0,0,0},
+    {0,11,125,125,0,30,0,0,0},{0,5,125,125,0,30,0,0,0},{0,5,154,154,0,30,0,0,0},{0,7,154,154,0,4,0,0,0},
+    {0,6,154,154,8,4,5,0,0},{0,7,154,154,0,4,0,0,9},{0,6,154,154,8,4,5,0,9},{0,6,154,154,8,4,5,0,7},
+    {0,18,154,154,0,13,0,0,0},{0,9,154,154,0,25,0,0,0},{0,5,150,150,0,30,0,0,0},{0,7,150,150,0,4,0,0,0},
+    {0,6,150,150,8,4,5,0,0},{0,6,150,150,8,4,5,0,9},{0,18,150,150,0,14,0,0,0},{0,5,141,141,0,30,0,0,0},
+    {0,6,141,141,8,4,5,0,0},{0,6,141,141,0,4,5,0,0},{0,6,141,141,8,4,5,0,9},{0,7,141,141,0,4,0,0,0},
+    {0,18,141,141,0,14,0,0,0},{0,18,141,141,0,30,0,0,0},{0,18,141,141,0,13,0,0,0},{0,5,140,140,0,30,0,0,0},
+    {0,6,140,140,8,4,5,0,0},{0,7,140,140,0,4,0,0,0},{0,6,140,140,8,4,5,0,9},{0,18,140,140,0,13,0,0,0},
+    {0,18,140,140,0,14,0,0,0},{0,5,119,119,0,30,0,0,0},{0,5,133,133,0,30,0,0,0},{0,7,133,133,0,4,0,0,0},
+    {0,6,133,133,8,4,5,0,0},{0,6,133,133,0,4,5,0,9},{0,18,133,133,0,13,0,0,0},{0,9,133,133,0,25,0,0,0},
+    {0,11,133,133,0,30,0,0,0},{0,18,134,134,0,14,0,0,0},{0,18,134,134,0,19,0,0,0},{0,5,134,134,0,30,0,0,0},
+    {0,6,134,134,8,4,5,0,0},{0,7,134,134,0,4,0,0,0},{0,5,138,138,0,30,0,0,0},{0,6,138,138,8,4,5,0,0},
+    {0,6,138,138,8,4,5,0,7},{0,6,138,138,8,4,5,0,9},{0,9,138,138,0,25,0,0,0},{0,5,143,143,0,30,0,0,0},
+    {0,7,143,143,0,4,0,0,0},{0,6,143,143,8,4,5,0,0},{0,6,143,143,8,4,5,0,9},{0,9,143,143,0,25,0,0,0},
+    {0,5,144,144,0,30,0,0,0},{0,6,144,144,8,4,5,0,0},{0,7,144,144,0,4,0,0,0},{0,18,144,144,0,30,0,0,0},
+    {0,6,162,162,8,4,5,0,0},{0,5,162,162,0,30,0,0,0},{0,7,162,162,0,4,0,0,0},{0,7,162,162,0,4,0,0,9},
+    {0,6,162,162,8,4,5,0,9},{0,18,162,162,0,13,0,0,0},{0,18,162,162,0,37,0,0,0},{0,9,162,162,0,25,0,0,0},
+    {0,11,14,14,0,30,0,0,0},{0,20,14,14,5,26,0,0,0},{0,18,14,14,0,13,0,0,0},{0,5,63,63,0,30,0,0,0},
+    {0,10,63,63,0,30,0,0,0},{0,18,63,63,0,13,0,0,0},{0,5,157,157,0,30,0,0,0},{0,18,157,157,0,30,0,0,0},
+    {0,5,81,81,0,30,0,0,0},{0,5,81,81,0,22,0,0,0},{0,5,81,81,0,17,0,0,0},{0,27,81,81,0,9,5,0,0},
+    {0,27,81,81,0,22,5,0,0},{0,27,81,81,0,17,5,0,0},{0,6,81,81,8,4,5,0,0},{0,5,127,127,0,30,0,0,0},
+    {0,5,127,127,0,22,0,0,0},{0,5,127,127,0,17,0,0,0},{0,5,115,115,0,30,0,0,0},{0,9,115,115,0,25,0,0,0},
+    {0,18,115,115,0,13,0,0,0},{0,5,159,159,0,30,0,0,0},{0,9,159,159,0,25,0,0,0},{0,5,104,104,0,30,0,0,0},
+    {0,6,104,104,8,4,5,0,1},{0,18,104,104,0,13,0,0,0},{0,5,108,108,0,30,0,0,0},{0,6,108,108,8,4,5,0,230},
+    {0,18,108,108,0,13,0,0,0},{0,18,108,108,0,30,0,0,0},{0,22,108,108,0,30,0,0,0},{0,4,108,108,0,30,0,0,0},
+    {0,9,108,108,0,25,0,0,0},{0,11,108,108,0,30,0,0,0},{0,1,145,145,0,30,0,0,0},{0,2,145,145,0,30,0,0,0},
+    {0,11,145,145,0,30,0,0,0},{0,18,145,145,0,13,0,0,0},{0,18,145,145,0,30,0,0,0},{0,5,99,99,0,30,0,0,0},
+    {0,6,99,99,8,4,5,0,0},{0,7,99,99,0,4,0,0,0},{0,4,99,99,0,30,0,0,0},{0,4,137,137,0,21,0,0,0},
+    {0,4,139,139,0,21,0,0,0},{0,18,36,36,13,21,0,0,0},{0,6,155,155,8,9,5,0,0},{0,7,36,36,0,4,0,0,6},
+    {0,5,137,137,0,37,0,0,0},{0,5,155,155,0,30,0,0,0},{0,4,34,34,0,30,0,0,0},{0,5,139,139,0,37,0,0,0},
+    {0,5,105,105,0,30,0,0,0},{0,22,105,105,0,30,0,0,0},{0,6,105,105,8,4,5,0,0},{0,6,105,105,8,4,5,0,1},
+    {0,18,105,105,0,13,0,0,0},{0,27,0,235,9,4,5,0,0},{0,7,0,0,0,4,0,0,216},{0,7,0,0,0,4,0,0,226},
+    {0,6,2,2,8,4,5,0,230},{0,11,0,0,0,30,0,0,0},{0,11,0,212,0,30,0,0,0},{0,19,0,0,0,30,0,0,0},
+    {0,22,131,131,0,30,0,0,0},{0,6,131,131,8,4,5,0,0},{0,18,131,131,0,13,0,0,0},{0,18,131,131,0,30,0,0,0},
+    {0,6,57,57,8,4,5,0,230},{0,5,151,151,0,30,0,0,0},{0,6,151,151,8,4,5,0,230},{0,4,151,151,0,30,0,0,0},
+    {0,9,151,151,0,25,0,0,0},{0,22,151,151,0,30,0,0,0},{0,5,160,160,0,30,0,0,0},{0,6,160,160,8,4,5,0,230},
+    {0,5,152,152,0,30,0,0,0},{0,6,152,152,8,4,5,0,230},{0,9,152,152,0,25,0,0,0},{0,20,152,152,5,27,0,0,0},
+    {0,5,163,163,0,30,0,0,0},{0,4,163,163,0,30,0,0,0},{0,6,163,163,8,4,5,0,232},{0,6,163,163,8,4,5,0,220},
+    {0,6,163,163,8,4,5,0,230},{0,9,163,163,0,25,0,0,0},{0,5,113,113,1,30,0,0,0},{0,11,113,113,1,30,0,0,0},
+    {0,6,113,113,8,4,5,0,220},{0,1,132,132,1,30,2,0,0},{0,2,132,132,1,30,2,0,0},{0,6,132,132,8,4,5,0,230},
+    {0,6,132,132,8,4,5,0,7},{0,4,132,132,1,30,5,0,0},{0,9,132,132,1,25,0,0,0},{0,18,132,132,1,22,0,0,0},
+    {0,11,0,0,2,30,0,0,0},{0,22,0,0,2,26,0,0,0},{0,20,0,0,2,26,0,0,0},{0,22,0,0,2,30,0,0,0},
+    {0,22,0,0,0,41,0,0,0},{0,22,33,33,0,37,0,0,0},{0,21,0,0,13,33,0,0,0},{0,22,0,0,13,21,0,0,0},
+    {0,0,164,164,0,0,0,0,0},
+};
+
+#endif /* HZ_UCD_PROPERTIES_H */
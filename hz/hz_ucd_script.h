@@ -0,0 +1,93 @@
+#ifndef HZ_UCD_SCRIPT_H
+#define HZ_UCD_SCRIPT_H
+
+#include <stdint.h>
+
+// Generated by generate_ucd_headers.c from Scripts.txt and ScriptExtensions.txt
+
+// values from HZ_UCD_SCRIPT_EXTENSIONS_BASE on index hz_ucd_script_extension_offsets
+#define HZ_UCD_SCRIPT_EXTENSIONS_BASE 165
+
+static const uint16_t hz_ucd_script_extension_offsets[71] = {
+      0,  3,  6, 10, 14, 18, 26, 31, 40, 51, 55, 60, 64, 79, 93,115,
+    138,144,149,153,157,161,165,170,174,180,184,190,193,197,201,205,
+    213,217,221,224,234,239,242,246,249,253,256,260,265,269,277,284,
+    287,291,295,300,304,308,324,339,352,356,360,365,369,373,377,382,
+    386,391,395,399,403,407,411,
+};
+
+static const uint8_t hz_ucd_script_extension_data[414] = {
+    41,1,2,
+    41,1,1,
+    3,2,3,120,
+    3,2,3,57,
+    41,2,3,1,
+    0,6,6,66,146,7,8,156,
+    6,3,6,7,8,
+    0,7,132,6,66,146,7,8,156,
+    0,9,132,6,95,112,158,121,146,147,7,
+    41,2,6,7,
+    6,3,6,8,156,
+    6,2,6,146,
+    41,13,10,9,107,12,11,16,1,17,13,100,14,15,124,
+    41,12,10,9,107,12,11,16,1,17,13,14,15,124,
+    0,20,10,9,142,143,138,107,12,11,16,111,17,150,13,123,19,59,102,14,15,124,
+    0,21,10,9,142,143,138,107,12,11,16,46,111,17,150,13,123,19,59,102,14,15,124,
+    9,4,9,142,92,111,
+    10,3,10,96,59,
+    11,2,11,129,
+    12,2,12,109,
+    14,2,107,14,
+    16,2,16,150,
+    23,3,96,23,47,
+    0,2,24,1,
+    0,4,44,43,45,42,
+    0,2,32,65,
+    41,4,10,9,107,16,
+    41,1,9,
+    0,2,9,107,
+    41,2,10,9,
+    41,2,9,100,
+    41,6,9,16,17,13,14,15,
+    0,2,10,9,
+    0,2,9,150,
+    0,1,9,
+    0,8,10,9,107,16,150,13,15,124,
+    41,3,9,107,16,
+    0,1,10,
+    41,2,9,107,
+    0,1,150,
+    41,2,3,7,
+    41,1,7,
+    0,2,1,32,
+    41,3,9,107,1,
+    0,2,3,57,
+    0,6,35,25,36,33,34,37,
+    0,5,35,25,36,33,34,
+    0,1,36,
+    41,2,35,36,
+    0,2,33,34,
+    0,3,36,33,34,
+    41,2,33,34,
+    0,2,36,1,
+    0,14,9,142,12,11,109,16,92,111,17,114,150,123,102,124,
+    0,13,9,142,12,11,109,16,92,111,114,150,123,102,124,
+    0,11,9,142,12,11,109,92,111,114,123,102,124,
+    9,2,10,9,
+    9,2,9,14,
+    0,3,72,1,23,
+    0,2,54,85,
+    0,2,6,66,
+    6,2,6,8,
+    0,3,157,52,48,
+    0,2,52,48,
+    0,3,52,110,48,
+    41,2,6,55,
+    0,2,6,55,
+    112,2,112,158,
+    107,2,107,14,
+    41,2,107,14,
+    0,1,105,
+};
+
+#endif /* HZ_UCD_SCRIPT_H */
@@ -0,0 +1,207 @@
+#ifndef HZ_UCD_VERSIONS_H
+#define HZ_UCD_VERSIONS_H
+
+#include <stdint.h>
+
+// Generated by generate_ucd_headers.c from UnicodeData.txt, Scripts.txt, LineBreak.txt and
+// ArabicShaping.txt of each UCD version
+// Included by hz.c only, the tables stay out of the public header
+
+#define HZ_UCD_VERSION_COUNT 18
+
+// version, first run in hz_ucd_version_deltas and number of runs of the codepoints whose values
+// differ from the version after it, the newest version has none
+static const uint32_t hz_ucd_versions[18][3] = {
+    {HZ_MAKE_VERSION(4,1,0),994,35},{HZ_MAKE_VERSION(5,0,0),905,89},{HZ_MAKE_VERSION(5,1,0),808,97},
+    {HZ_MAKE_VERSION(5,2,0),702,106},{HZ_MAKE_VERSION(6,0,0),612,90},{HZ_MAKE_VERSION(6,1,0),611,1},
+    {HZ_MAKE_VERSION(6,2,0),600,11},{HZ_MAKE_VERSION(6,3,0),459,141},{HZ_MAKE_VERSION(7,0,0),396,63},
+    {HZ_MAKE_VERSION(8,0,0),341,55},{HZ_MAKE_VERSION(9,0,0),298,43},{HZ_MAKE_VERSION(10,0,0),238,60},
+    {HZ_MAKE_VERSION(11,0,0),178,60},{HZ_MAKE_VERSION(12,0,0),177,1},{HZ_MAKE_VERSION(12,1,0),115,62},
+    {HZ_MAKE_VERSION(13,0,0),37,78},{HZ_MAKE_VERSION(14,0,0),0,37},{HZ_MAKE_VERSION(15,0,0),0,0},
+};
+
+// general category, script, bidi class, line break class, joining type and joining group
+static const uint8_t hz_ucd_version_records[19][6] = {
+    {0,164,0,0,0,0},{27,41,9,4,5,0},{27,0,19,4,5,0},{27,0,20,4,5,0},{0,164,2,0,0,0},{0,164,5,0,0,0},
+    {0,164,1,0,0,0},{5,95,1,30,0,0},{27,92,0,30,5,0},{6,32,8,4,0,0},{5,95,1,30,2,0},{5,95,1,30,4,0},
+    {18,32,13,30,0,0},{27,32,9,9,5,0},{5,32,0,30,0,0},{4,32,0,30,0,0},{6,32,8,4,5,0},{5,6,2,30,2,97},
+    {5,6,2,30,2,72},
+};
+
+// first codepoint | (length - 1) << 21 and the index in hz_ucd_version_records of runs of codepoints
+static const uint32_t hz_ucd_version_deltas[1029][2] = {
+    {0xCF3,0},{0xECE,0},{0x200C,1},{0x2066,2},{0x2067,3},{0x410EFD,4},
+    {0x41123F,0},{0x1211B00,0},{0x2011F00,0},{0x5011F12,0},{0x3611F3E,0},{0x1342F,0},
+    {0x3813439,0},{0x1B132,0},{0x1B155,0},{0x261D2C0,0},{0xA1DF25,0},{0x7A1E030,0},
+    {0x1E08F,0},{0x521E4D0,0},{0x1F6DC,0},{0x41F774,0},{0x81F77B,0},{0x1F7D9,0},
+    {0x41FA75,0},{0x21FA87,0},{0x41FAAD,0},{0x41FABB,0},{0x1FABF,0},{0x21FACE,0},
+    {0x21FADA,0},{0x1FAE8,0},{0x21FAF7,0},{0x2B739,0},{0xFFE31350,0},{0xFFE31B50,0},
+    {0xBE32350,0},{0x61D,4},{0x3C00870,4},{0x200890,4},{0xE00898,4},{0x8B5,4},
+    {0x14008C8,4},{0xC3C,0},{0xC5D,0},{0xCDD,0},{0x170D,0},{0x1715,0},
+    {0x171F,0},{0x180F,0},{0x1A01AC1,0},{0x1B4C,0},{0x201B7D,0},{0x1DFA,0},
+    {0x20C0,5},{0x2C2F,0},{0x2C5F,0},{0x1402E53,0},{0x409FFD,0},{0x20A7C0,0},
+    {0x20A7D0,0},{0xA7D3,0},{0x80A7D5,0},{0x40A7F2,0},{0xFBC2,4},{0x1E0FD40,4},
+    {0xFDCF,4},{0x20FDFE,4},{0x1410570,0},{0x1C1057C,0},{0xC1058C,0},{0x210594,0},
+    {0x1410597,0},{0x1C105A3,0},{0xC105B3,0},{0x2105BB,0},{0xA10780,0},{0x5210787,0},
+    {0x10107B2,0},{0x3210F70,6},{0xA11070,0},{0x110C2,0},{0x116B9,0},{0xC11740,0},
+    {0x1E11AB0,0},{0xC412F90,0},{0x9C16A70,0},{0x1216AC0,0},{0x61AFF0,0},{0xC1AFF5,0},
+    {0x21AFFD,0},{0x61B11F,0},{0x5A1CF00,0},{0x2C1CF30,0},{0xE61CF50,0},{0x21D1E9,0},
+    {0x3C1DF00,0},{0x3C1E290,0},{0xC1E7E0,0},{0x61E7E8,0},{0x21E7ED,0},{0x1C1E7F0,0},
+    {0x41F6DD,0},{0x1F7F0,0},{0x1F979,0},{0x1F9CC,0},{0x21FA7B,0},{0x61FAA9,0},
+    {0x61FAB7,0},{0x41FAC3,0},{0x41FAD7,0},{0xE1FAE0,0},{0xC1FAF0,0},{0x22A6DE,0},
+    {0x62B735,0},{0x400856,7},{0x12008BE,4},{0xB55,0},{0xD04,0},{0xD81,0},
+    {0x201ABF,0},{0x2B97,0},{0x402E50,0},{0x8031BB,0},{0x1204DB6,0},{0x1809FF0,0},
+    {0x60A7C7,0},{0x20A7F5,0},{0xA82C,0},{0x60AB68,0},{0x1019C,0},{0x5210E80,6},
+    {0x410EAB,6},{0x210EB0,6},{0x3610FB0,6},{0x11147,0},{0x2111CE,0},{0x1145A,0},
+    {0x211460,0},{0xC11900,0},{0x11909,0},{0xE1190C,0},{0x211915,0},{0x3A11918,0},
+    {0x211937,0},{0x161193B,0},{0x1211950,0},{0x11FB0,0},{0x16FE4,0},{0x216FF0,0},
+    {0x3C418AF3,0},{0x1018D00,0},{0x41F10D,0},{0x41F16D,0},{0x1F1AD,0},{0x21F6D6,0},
+    {0x21F6FB,0},{0x21F8B0,0},{0x1F90C,0},{0x1F972,0},{0x21F977,0},{0x21F9A3,0},
+    {0x41F9AB,0},{0x1F9CB,0},{0x1FA74,0},{0x61FA83,0},{0x241FA96,0},{0xC1FAB0,0},
+    {0x41FAC0,0},{0xC1FAD0,0},{0x1241FB00,0},{0x6C1FB94,0},{0x121FBF0,0},{0xC2A6D7,0},
+    {0xFFE30000,0},{0xFFE30800,0},{0x69431000,0},{0x32FF,0},{0xC77,0},{0xE86,0},
+    {0xE89,0},{0xE8C,0},{0xA00E8E,0},{0xE98,0},{0xEA0,0},{0x200EA8,0},
+    {0xEAC,0},{0xEBA,0},{0x1CFA,0},{0x2BC9,0},{0x2BFF,0},{0x2E4F,0},
+    {0xA0A7BA,0},{0x80A7C2,0},{0x20AB66,0},{0x2C10FE0,6},{0x1145F,0},{0x116B8,0},
+    {0xE119A0,0},{0x5A119AA,0},{0x14119DA,0},{0x211A84,0},{0x6211FC0,0},{0x11FFF,0},
+    {0x1013430,0},{0xA16F45,0},{0x16F4F,0},{0x1016F7F,0},{0x216FE2,0},{0xA187F2,0},
+    {0x41B150,0},{0x61B164,0},{0x581E100,0},{0x1A1E130,0},{0x121E140,0},{0x21E14E,0},
+    {0x721E2C0,0},{0x1E2FF,0},{0x1E94B,6},{0x781ED01,4},{0x1F16C,0},{0x1F6D5,0},
+    {0x1F6FA,0},{0x161F7E0,0},{0x41F90D,0},{0x1F93F,0},{0x1F971,0},{0x1F97B,0},
+    {0xA1F9A5,0},{0x21F9AE,0},{0xA1F9BA,0},{0xE1F9C3,0},{0x41F9CD,0},{0xA61FA00,0},
+    {0x61FA70,0},{0x41FA78,0},{0x41FA80,0},{0xA1FA90,0},{0x560,0},{0x588,0},
+    {0x5EF,6},{0x4007FD,6},{0x8D3,4},{0x9FE,0},{0xA76,0},{0xC04,0},
+    {0xC84,0},{0x1878,0},{0x5401C90,0},{0x401CBD,0},{0x402BBA,0},{0x3002BD3,0},
+    {0x1C02BF0,0},{0x802E4A,0},{0x312F,0},{0x809FEB,0},{0xA7AF,0},{0x20A7B8,0},
+    {0x20A8FE,0},{0x210A34,6},{0x10A48,6},{0x4E10D00,4},{0x1210D30,4},{0x4E10F00,6},
+    {0x5210F30,4},{0x110BD,8},{0x110CD,0},{0x411144,0},{0x1133B,0},{0x1145E,0},
+    {0x1171A,0},{0x7611800,0},{0x11A9D,0},{0xA11D60,0},{0x211D67,0},{0x4811D6A,0},
+    {0x211D90,0},{0xA11D93,0},{0x1211DA0,0},{0x3011EE0,0},{0xB416E40,0},{0x8187ED,0},
+    {0x261D2E0,0},{0xC1D372,0},{0x861EC71,4},{0x1F12F,0},{0x1F6F9,0},{0x61F7D5,0},
+    {0x41F94D,0},{0x81F96C,0},{0x61F973,0},{0x1F97A,0},{0x61F97C,0},{0x141F998,0},
+    {0x121F9B0,0},{0x21F9C1,0},{0x301F9E7,0},{0x1A1FA60,0},{0x1400860,4},{0x2009FC,0},
+    {0xA00AFA,0},{0xD00,0},{0x200D3B,0},{0x1CF7,0},{0x601DF6,0},{0x20BF,5},
+    {0x23FF,0},{0x2BD2,0},{0x802E45,0},{0x312E,0},{0x2809FD6,0},{0x41032D,0},
+    {0x8E11A00,0},{0x6611A50,0},{0x2C11A86,0},{0x811A9E,0},{0xC11D00,0},{0x211D08,0},
+    {0x5611D0B,0},{0x11D3A,0},{0x211D3C,0},{0x1011D3F,0},{0x1211D50,0},{0x16FE1,0},
+    {0x2381B002,0},{0x3161B170,0},{0xA1F260,0},{0x21F6D3,0},{0x21F6F7,0},{0x161F900,0},
+    {0x1F91F,0},{0xE1F928,0},{0x21F931,0},{0x1F94C,0},{0x181F95F,0},{0xA1F992,0},
+    {0x2C1F9D0,0},{0xFFE2CEB0,0},{0xFFE2D6B0,0},{0xFFE2DEB0,0},{0xA602E6B0,0},{0xE008B6,4},
+    {0x1C008D4,4},{0xC80,0},{0xD4F,0},{0x400D54,0},{0xC00D58,0},{0x400D76,0},
+    {0x201885,9},{0x1001C80,0},{0x1DFB,0},{0x6023FB,0},{0x202E43,0},{0xA7AE,0},
+    {0xA8C5,0},{0x21018D,0},{0x46104B0,0},{0x46104D8,0},{0x1123E,0},{0xB211400,0},
+    {0x1145B,0},{0x1145D,0},{0x1811660,0},{0x1011C00,0},{0x5811C0A,0},{0x1A11C38,0},
+    {0x3811C50,0},{0x3E11C70,0},{0x2A11C92,0},{0x1A11CA9,0},{0x16FE0,0},{0xFFE17000,0},
+    {0xFFE17800,0},{0xFD818000,0},{0x5E418800,0},{0xC1E000,0},{0x201E008,0},{0xC1E01B,0},
+    {0x21E023,0},{0x81E026,0},{0x941E900,6},{0x121E950,6},{0x21E95E,6},{0x221F19B,0},
+    {0x1F23B,0},{0x1F57A,0},{0x1F5A4,0},{0x21F6D1,0},{0x41F6F4,0},{0xA1F919,0},
+    {0xE1F920,0},{0x1F930,0},{0x161F933,0},{0x161F940,0},{0x1C1F950,0},{0x181F985,0},
+    {0x847,10},{0x84F,11},{0x2008B3,4},{0x8E3,4},{0xAF9,0},{0xC5A,0},
+    {0xD5F,0},{0x13F5,0},{0xA013F8,0},{0x20BE,5},{0x20218A,0},{0x602BEC,0},
+    {0x1009FCD,0},{0xA69E,0},{0xA78F,0},{0xA0A7B2,0},{0x20A8FC,0},{0x60AB60,0},
+    {0x9E0AB70,0},{0x20FE2E,0},{0x24108E0,6},{0x2108F4,6},{0x8108FB,6},{0x2109BC,6},
+    {0x1E109C0,6},{0x5A109D2,6},{0x6410C80,6},{0x6410CC0,6},{0xA10CFA,6},{0x6111C9,0},
+    {0x8111DB,0},{0xC11280,0},{0x11288,0},{0x61128A,0},{0x1C1128F,0},{0x141129F,0},
+    {0x11300,0},{0x11350,0},{0x26115CA,0},{0x3211700,0},{0x1C1171D,0},{0x1E11730,0},
+    {0x12399,0},{0x18612480,0},{0x48C14400,0},{0x141D1DE,0},{0x5161D800,0},{0x81DA9B,0},
+    {0x1C1DAA1,0},{0x41F32D,0},{0x21F37E,0},{0x81F3CF,0},{0xE1F3F8,0},{0x1F4FF,0},
+    {0x81F54B,0},{0x21F643,0},{0x1F6D0,0},{0x101F910,0},{0x81F980,0},{0x1F9C0,0},
+    {0xFFE2B820,0},{0xFFE2C020,0},{0xD022C820,0},{0x37F,0},{0xE00528,0},{0x20058D,0},
+    {0x605,4},{0x8A1,4},{0xA008AD,4},{0x8FF,4},{0x978,0},{0x980,0},
+    {0xC00,0},{0xC34,0},{0xC81,0},{0xD01,0},{0x1200DE6,0},{0xE016F1,0},
+    {0x20191D,0},{0x1C01AB0,0},{0x201CF8,0},{0x1C01DE7,0},{0x4020BB,5},{0xC023F4,0},
+    {0x2700,0},{0x402B4D,0},{0x3202B5A,0},{0x3E02B76,0},{0x4202B98,0},{0x1602BBD,0},
+    {0xE02BCA,0},{0xC02E3C,0},{0xA0A698,0},{0x160A794,0},{0x40A7AB,0},{0x20A7B0,0},
+    {0xA7F7,0},{0x3C0A9E0,0},{0x60AA7C,0},{0x5E0AB30,0},{0x20AB64,0},{0xC0FE27,0},
+    {0x21018B,0},{0x101A0,0},{0x36102E0,0},{0x1031F,0},{0x5410350,0},{0x4E10500,0},
+    {0x6610530,0},{0x1056F,0},{0x26C10600,0},{0x2A10740,0},{0xE10760,0},{0x7C10860,6},
+    {0x10108A7,6},{0x3E10A80,6},{0x4C10AC0,6},{0x1610AEB,6},{0x2210B80,6},{0x610B99,6},
+    {0xC10BA9,6},{0x1107F,0},{0x4C11150,0},{0x111CD,0},{0x111DA,0},{0x26111E1,0},
+    {0x2211200,0},{0x5411213,0},{0x74112B0,0},{0x12112F0,0},{0x411301,0},{0xE11305,0},
+    {0x21130F,0},{0x2A11313,0},{0xC1132A,0},{0x211332,0},{0x811335,0},{0x101133C,0},
+    {0x211347,0},{0x41134B,0},{0x11357,0},{0xC1135D,0},{0xC11366,0},{0x811370,0},
+    {0x8E11480,0},{0x12114D0,0},{0x6A11580,0},{0x22115B8,0},{0x8811600,0},{0x1211650,0},
+    {0xA4118A0,0},{0x118FF,0},{0x7011AC0,0},{0x521236F,0},{0x1612463,0},{0x12474,0},
+    {0x3C16A40,0},{0x1216A60,0},{0x216A6E,0},{0x3A16AD0,0},{0xA16AF0,0},{0x8A16B00,0},
+    {0x1216B50,0},{0xC16B5B,0},{0x2816B63,0},{0x2416B7D,0},{0xD41BC00,0},{0x181BC70,0},
+    {0x101BC80,0},{0x121BC90,0},{0xE1BC9C,0},{0x1881E800,6},{0x1E1E8C7,6},{0x1F0BF,0},
+    {0x2A1F0E0,0},{0x21F10B,0},{0x161F321,0},{0x1F336,0},{0x1F37D,0},{0x161F394,0},
+    {0x1F3C5,0},{0x61F3CB,0},{0x161F3D4,0},{0xC1F3F1,0},{0x1F43F,0},{0x1F441,0},
+    {0x1F4F8,0},{0x21F4FD,0},{0x21F53E,0},{0xC1F544,0},{0x221F568,0},{0x501F57B,0},
+    {0xAA1F5A5,0},{0x21F641,0},{0x5E1F650,0},{0x121F6C6,0},{0x181F6E0,0},{0x61F6F0,0},
+    {0xA81F780,0},{0x161F800,0},{0x6E1F810,0},{0x121F850,0},{0x4E1F860,0},{0x3A1F890,0},
+    {0x61C,4},{0x1807,12},{0x180A,12},{0x180E,13},{0x4401820,14},{0x1843,15},
+    {0x6601844,14},{0x201885,16},{0x4201887,14},{0x18AA,14},{0x602066,0},{0x20BA,5},
+    {0x58F,0},{0x604,4},{0x2A00840,7},{0x8A0,4},{0x14008A2,4},{0x34008E4,4},
+    {0xAF0,0},{0x200EDE,0},{0x10C7,0},{0x10CD,0},{0x4010FD,0},{0x401BAB,0},
+    {0xA01BBA,0},{0xE01CC0,0},{0x601CF3,0},{0x27CB,0},{0x27CD,0},{0x202CF2,0},
+    {0x2D27,0},{0x2D2D,0},{0x202D66,0},{0x1202E32,0},{0x9FCC,0},{0xE0A674,0},
+    {0xA69F,0},{0x20A792,0},{0xA7AA,0},{0x20A7F8,0},{0x2C0AAE0,0},{0x20FA2E,0},
+    {0x6E10980,6},{0x2109BE,6},{0x30110D0,0},{0x12110F0,0},{0x6811100,0},{0x1A11136,0},
+    {0x9011180,0},{0x12111D0,0},{0x6E11680,0},{0x12116C0,0},{0x8816F00,0},{0x5C16F50,0},
+    {0x2016F8F,0},{0x61EE00,4},{0x341EE05,4},{0x21EE21,4},{0x1EE24,4},{0x1EE27,4},
+    {0x121EE29,4},{0x61EE34,4},{0x1EE39,4},{0x1EE3B,4},{0x1EE42,4},{0x1EE47,4},
+    {0x1EE49,4},{0x1EE4B,4},{0x41EE4D,4},{0x21EE51,4},{0x1EE54,4},{0x1EE57,4},
+    {0x1EE59,4},{0x1EE5B,4},{0x1EE5D,4},{0x1EE5F,4},{0x21EE61,4},{0x1EE64,4},
+    {0x61EE67,4},{0xC1EE6C,4},{0x61EE74,4},{0x61EE79,4},{0x1EE7E,4},{0x121EE80,4},
+    {0x201EE8B,4},{0x41EEA1,4},{0x81EEA5,4},{0x201EEAB,4},{0x21EEF0,4},{0x21F16A,0},
+    {0x61F540,0},{0x1F600,0},{0x1F611,0},{0x1F615,0},{0x1F617,0},{0x1F619,0},
+    {0x1F61B,0},{0x1F61F,0},{0x21F626,0},{0x1F62C,0},{0x21F62E,0},{0x1F634,0},
+    {0x200526,0},{0x620,4},{0x65F,4},{0x3600840,6},{0x85E,6},{0x20093A,0},
+    {0x94F,0},{0x200956,0},{0x800973,0},{0xA00B72,0},{0xD29,0},{0xD3A,0},
+    {0xD4E,0},{0x600F8C,0},{0x200FD9,0},{0x20135D,0},{0x6601BC0,0},{0x601BFC,0},
+    {0x1DFC,0},{0xE02095,0},{0x20B9,5},{0x14023E9,0},{0x26CE,0},{0x26E2,0},
+    {0x6026E4,0},{0x2705,0},{0x20270A,0},{0x2728,0},{0x274C,0},{0x274E,0},
+    {0x402753,0},{0x20275F,0},{0x402795,0},{0x27B0,0},{0x27BF,0},{0x2027CE,0},
+    {0x2D70,0},{0x2D7F,0},{0x4031B8,0},{0x20A660,0},{0x20A78D,0},{0x20A790,0},
+    {0x120A7A0,0},{0xA7FA,0},{0xA0AB01,0},{0xA0AB09,0},{0xA0AB11,0},{0xC0AB20,0},
+    {0xC0AB28,0},{0x1E0FBB2,4},{0x9A11000,0},{0x3A11052,0},{0x47016800,0},{0x21B000,0},
+    {0x1C1F0A0,0},{0x1A1F0B1,0},{0x1C1F0C1,0},{0x1C1F0D1,0},{0x1F130,0},{0x141F132,0},
+    {0x1F13E,0},{0x21F140,0},{0x41F143,0},{0x41F147,0},{0xE1F14F,0},{0xC1F158,0},
+    {0x121F160,0},{0x101F170,0},{0x1F17A,0},{0x21F17D,0},{0x121F180,0},{0x21F18E,0},
+    {0x121F191,0},{0x321F1E6,0},{0x21F201,0},{0x101F232,0},{0x21F250,0},{0x401F300,0},
+    {0xA1F330,0},{0x8A1F337,0},{0x261F380,0},{0x481F3A0,0},{0x81F3C6,0},{0x201F3E0,0},
+    {0x7C1F400,0},{0x1F440,0},{0x16A1F442,0},{0x61F4F9,0},{0x7A1F500,0},{0x2E1F550,0},
+    {0x81F5FB,0},{0x1E1F601,0},{0x41F612,0},{0x1F616,0},{0x1F618,0},{0x1F61A,0},
+    {0x41F61C,0},{0xA1F620,0},{0x61F628,0},{0x1F62D,0},{0x61F630,0},{0x161F635,0},
+    {0x141F645,0},{0x8A1F680,0},{0xE61F700,0},{0x1BA2B740,0},{0x200524,0},{0x40063D,17},
+    {0x6BD,18},{0x6CC,17},{0x6CE,17},{0x200775,17},{0x5A00800,6},{0x1C00830,6},
+    {0x900,0},{0x94E,0},{0x955,0},{0x200979,0},{0x9FB,0},{0x600FD5,0},
+    {0x60109A,0},{0x80115A,0},{0x8011A3,0},{0xA011FA,0},{0x1400,0},{0x1001677,0},
+    {0x8A018B0,0},{0x2019AA,0},{0x19DA,0},{0x7C01A20,0},{0x3801A60,0},{0x1401A7F,0},
+    {0x1201A90,0},{0x1A01AA0,0},{0x4401CD0,0},{0x1DFD,0},{0x4020B6,5},{0x402150,0},
+    {0x2189,0},{0x23E8,0},{0x20269E,0},{0x4026BD,0},{0x12026C4,0},{0x24026CF,0},
+    {0x26E3,0},{0x2E026E8,0},{0x2757,0},{0x802B55,0},{0x2C70,0},{0x202C7E,0},
+    {0xC02CEB,0},{0x2E31,0},{0x1603244,0},{0xE09FC4,0},{0x5E0A4D0,0},{0xAE0A6A0,0},
+    {0x120A830,0},{0x360A8E0,0},{0x380A960,0},{0x9A0A980,0},{0x140A9CF,0},{0x20A9DE,0},
+    {0x360AA60,0},{0x840AA80,0},{0x80AADB,0},{0x5A0ABC0,0},{0x120ABF0,0},{0x2C0D7B0,0},
+    {0x600D7CB,0},{0x40FA6B,0},{0x2A10840,6},{0x1010857,6},{0x21091A,6},{0x3E10A60,6},
+    {0x6A10B00,6},{0x3810B39,6},{0x3410B58,6},{0xE10B78,6},{0x9010C00,6},{0x3C10E60,6},
+    {0x8211080,0},{0x85C13000,0},{0x141F100,0},{0x3C1F110,0},{0x1F131,0},{0x1F13D,0},
+    {0x1F13F,0},{0x1F142,0},{0x1F146,0},{0x81F14A,0},{0x1F157,0},{0x1F15F,0},
+    {0x1F179,0},{0x21F17B,0},{0x1F17F,0},{0x61F18A,0},{0x1F190,0},{0x1F200,0},
+    {0x421F210,0},{0x101F240,0},{0xFFE2A700,0},{0xFFE2AF00,0},{0x682B700,0},{0x600370,0},
+    {0x200376,0},{0x3CF,0},{0x487,0},{0x1E00514,0},{0x800606,4},{0x800616,4},
+    {0x80063B,4},{0x220076E,4},{0x200971,0},{0xA51,0},{0xA75,0},{0xB44,0},
+    {0x200B62,0},{0xBD0,0},{0xC3D,0},{0x200C58,0},{0x200C62,0},{0xE00C78,0},
+    {0xD3D,0},{0xD44,0},{0x200D62,0},{0xA00D70,0},{0xC00D79,0},{0x200F6B,0},
+    {0xFCE,0},{0x400FD2,0},{0x1022,0},{0x1028,0},{0x102B,0},{0x401033,0},
+    {0xA0103A,0},{0x7E0105A,0},{0x20109E,0},{0x18AA,0},{0x5401B80,0},{0x1601BAE,0},
+    {0x6E01C00,0},{0x1C01C3B,0},{0x6401C4D,0},{0x3601DCB,0},{0x601E9C,0},{0xA01EFA,0},
+    {0x2064,0},{0x20F0,0},{0x214F,0},{0x602185,0},{0x269D,0},{0x12026B3,0},
+    {0x6026C0,0},{0x27CC,0},{0x6027EC,0},{0x802B1B,0},{0x5002B24,0},{0x802B50,0},
+    {0x402C6D,0},{0x402C71,0},{0xA02C78,0},{0x3E02DE0,0},{0x602E18,0},{0x2402E1E,0},
+    {0x312D,0},{0x26031D0,0},{0xE09FBC,0},{0x2560A500,0},{0x3E0A640,0},{0x220A662,0},
+    {0x360A67C,0},{0x80A71B,0},{0xD40A722,0},{0x80A7FB,0},{0x880A880,0},{0x160A8CE,0},
+    {0xA60A900,0},{0xA95F,0},{0x6C0AA00,0},{0x1A0AA40,0},{0x120AA50,0},{0x60AA5C,0},
+    {0x40FE24,0},{0x1610190,0},{0x5A101D0,0},{0x3810280,0},{0x60102A0,0},{0x3210920,6},
+    {0x1093F,6},{0x1D129,0},{0x561F000,0},{0xC61F030,0},{0x1A00242,0},{0x40037B,0},
+    {0x4CF,0},{0xA004FA,0},{0x600510,0},{0x5BA,6},{0x74007C0,6},{0x20097B,0},
+    {0x20097E,0},{0x200CE2,0},{0x200CF1,0},{0x9601B00,0},{0x5801B50,0},{0xC01DC4,0},
+    {0x201DFE,0},{0x6020EC,0},{0x20214D,0},{0x2184,0},{0x16023DC,0},{0x26B2,0},
+    {0x6027C7,0},{0xC02B14,0},{0x602B20,0},{0x1802C60,0},{0x602C74,0},{0x60A717,0},
+    {0x20A720,0},{0x6E0A840,0},{0x3210900,6},{0x1091F,6},{0x6DC12000,0},{0xC412400,0},
+    {0x612470,0},{0x221D360,0},{0x21D7CA,0},
+};
+
+#endif /* HZ_UCD_VERSIONS_H */
@@ -0,0 +1,152 @@
+// Tests of the shelf atlas packer and of the glyph cache using it: rects never overlap or leave
+// the atlas, glyphs of one size class share shelves, freed shelves are reused, and cached glyphs
+// keep their rect across frames.
+//
+// usage: hz_atlas_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+static int rects_overlap(hz_rect_t a, hz_rect_t b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static int rects_disjoint_and_inside(const hz_rect_t *rects, size_t count, int width, int height) {
+    for (size_t i = 0; i < count; ++i) {
+        hz_rect_t r = rects[i];
+        if (r.x < 0 || r.y < 0 || r.x + r.w > width || r.y + r.h > height) return 0;
+        for (size_t j = 0; j < i; ++j)
+            if (rects_overlap(r, rects[j])) return 0;
+    }
+    return 1;
+}
+
+static void test_size_classes(void) {
+    HZ_TEST_CHECK(hz_atlas_size_class(1) == 8 && hz_atlas_size_class(8) == 8);
+    HZ_TEST_CHECK(hz_atlas_size_class(9) == 10 && hz_atlas_size_class(16) == 16);
+    HZ_TEST_CHECK(hz_atlas_size_class(17) == 20 && hz_atlas_size_class(100) == 112);
+}
+
+static void test_packer(void) {
+    hz_atlas_packer_t p;
+    hz_atlas_packer_init(&p, 128, 128);
+
+    // same size class, same shelf side by side
+    hz_rect_t a, b;
+    HZ_TEST_CHECK(hz_atlas_packer_alloc(&p, 10, 10, &a) == 0);
+    HZ_TEST_CHECK(hz_atlas_packer_alloc(&p, 12, 9, &b) == 0);
+    HZ_TEST_CHECK(a.x == 0 && a.y == 0 && b.x == 10 && b.y == 0);
+    HZ_TEST_CHECK(hz_atlas_packer_alloc(&p, 129, 10, &a) == -1);
+    hz_atlas_packer_release(&p);
+
+    // fill the atlas with rects of pseudo random sizes
+    hz_rect_t rects[1024];
+    size_t count = 0;
+    long area = 0;
+    uint32_t seed = 1;
+    hz_atlas_packer_init(&p, 128, 128);
+    while (count < 1024) {
+        seed = seed * 1103515245u + 12345u;
+        int w = 4 + (seed >> 16) % 20, h = 4 + (seed >> 8) % 28;
+        if (hz_atlas_packer_alloc(&p, w, h, &rects[count]) < 0) break;
+        area += w * h;
+        ++count;
+    }
+
+    HZ_TEST_CHECK(count > 20 && count < 1024);
+    HZ_TEST_CHECK(rects_disjoint_and_inside(rects, count, 128, 128));
+
+    hz_atlas_stats_t stats = hz_atlas_packer_stats(&p);
+    HZ_TEST_CHECK(stats.fill_ratio == (float)area / (128.0f * 128.0f));
+    HZ_TEST_CHECK(stats.fragmentation >= 0.0f && stats.fragmentation < 1.0f);
+    HZ_TEST_CHECK(stats.shelf_count == (int)hz_vector_size(p.shelves));
+
+    // two emptied shelves merge into one a taller rect fits in
+    int h = p.shelves[0].h + p.shelves[1].h;
+    hz_atlas_packer_merge_shelves(&p, 0, 2);
+    HZ_TEST_CHECK(p.shelves[0].y == 0 && p.shelves[0].h == h && p.shelves[0].x == 0);
+    HZ_TEST_CHECK(hz_atlas_packer_alloc(&p, 128, h, &a) == 0 && a.y == 0);
+
+    // emptying the top shelf gives its height back
+    int last = (int)hz_vector_size(p.shelves) - 1, top = p.shelves[last].y;
+    hz_atlas_packer_clear_shelf(&p, last);
+    HZ_TEST_CHECK(p.top <= top);
+    hz_atlas_packer_release(&p);
+}
+
+static void test_glyph_cache(hz_font_data_t *font_data) {
+    hz_glyph_cache_opts_t opts = {0};
+    opts.width = opts.height = 64;
+    opts.x_cells = opts.y_cells = 4; // glyphs are 16px tall
+    opts.padd = 1.0f;
+    opts.packing = HZ_GLYPH_CACHE_PACKING_SHELF;
+    opts.max_glyphs = 32;
+
+    hz_context_t *ctx = hz_context_create(&opts);
+    if (!HZ_TEST_CHECK(ctx != NULL)) return;
+    uint16_t font_id = hz_context_stash_font(ctx, font_data);
+    hz_command_list_t *cmds = hz_command_list_get(ctx);
+    hz_frame_result_t r;
+
+    hz_frame_begin(ctx);
+    for (uint16_t glyph = 1; glyph <= 8; ++glyph) {
+        hz_glyph_instance_t g = {0};
+        g.lru_id.font_id = font_id;
+        g.lru_id.glyph_id = glyph;
+        hz_vector_push_back(cmds->draw_data, g);
+    }
+
+    HZ_TEST_CHECK(hz_frame_resolve(ctx, &r));
+    HZ_TEST_CHECK(r.raster_count == 8);
+    HZ_TEST_CHECK(rects_disjoint_and_inside(r.raster_rects, r.raster_count, 64, 64));
+    hz_frame_end(ctx);
+
+    hz_atlas_stats_t stats = hz_glyph_cache_stats(hz_context_get_lru(ctx));
+    HZ_TEST_CHECK(stats.glyph_count == 8 && stats.fill_ratio > 0.0f);
+
+    // cached glyphs are not rasterized again
+    hz_frame_begin(ctx);
+    hz_glyph_instance_t g = {0};
+    g.lru_id.font_id = font_id;
+    g.lru_id.glyph_id = 2;
+    hz_vector_push_back(cmds->draw_data, g);
+    HZ_TEST_CHECK(hz_frame_resolve(ctx, &r));
+    HZ_TEST_CHECK(r.raster_count == 0 && r.unique_count == 1);
+    hz_frame_end(ctx);
+
+    hz_context_release(ctx);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    test_size_classes();
+    test_packer();
+
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/HzTestLayout.ttf", argv[1]);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0))) {
+        hz_font_t *font = hz_stbtt_font_create(&info);
+        hz_font_data_t *font_data = hz_font_data_create(font);
+        test_glyph_cache(font_data);
+        hz_font_data_release(font_data);
+        hz_face_destroy(hz_font_get_face(font));
+        hz_font_destroy(font);
+    }
+
+    free(data);
+    hz_deinit();
+    return hz_test_report("atlas");
+}
@@ -0,0 +1,119 @@
+// Tests of the UAX #9 bidi algorithm: resolved levels of paragraphs exercising the paragraph,
+// explicit, weak, neutral, bracket pair and implicit rules, the level runs, and reordering by L2.
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define MAX_CHARS 12
+
+#define ALEF 0x05D0 // R
+#define BET 0x05D1 // R
+#define GIMEL 0x05D2 // R
+#define ARABIC_ALEF 0x0627 // AL
+#define RLI 0x2067
+#define LRI 0x2066
+#define PDI 0x2069
+#define RLE 0x202B
+#define PDF 0x202C
+
+typedef struct {
+    const char *name;
+    hz_direction_t dir;
+    hz_unicode_t chars[MAX_CHARS];
+    size_t count;
+    uint8_t base_level;
+    uint8_t levels[MAX_CHARS];
+} bidi_test_t;
+
+static const bidi_test_t bidi_tests[] = {
+    {"left to right", HZ_DIRECTION_INVALID, {'a', 'b', 'c'}, 3, 0, {0, 0, 0}},
+    {"right to left", HZ_DIRECTION_INVALID, {ALEF, BET, GIMEL}, 3, 1, {1, 1, 1}},
+    // P2, numbers are not strong
+    {"first strong", HZ_DIRECTION_INVALID, {'1', '2', ' ', ALEF}, 4, 1, {2, 2, 1, 1}},
+    // N1 and N2, spaces between different directions take the embedding direction
+    {"mixed", HZ_DIRECTION_INVALID, {'a', 'b', ' ', ALEF, BET, ' ', 'c', 'd'}, 8, 0, {0, 0, 0, 1, 1, 0, 0, 0}},
+    // W7 keeps the number european after R, I1 raises it
+    {"number after R", HZ_DIRECTION_LTR, {'a', ' ', ALEF, '1', '2'}, 5, 0, {0, 0, 1, 2, 2}},
+    // W2, european digits after AL are arabic numbers
+    {"number after AL", HZ_DIRECTION_INVALID, {ARABIC_ALEF, '1', '2'}, 3, 1, {1, 2, 2}},
+    // W4 and W5, separators and terminators join the number
+    {"separators", HZ_DIRECTION_RTL, {ALEF, ' ', '1', ',', '2', ' ', '$', '3'}, 8, 1, {1, 1, 2, 2, 2, 1, 2, 2}},
+    // X5a to X6a, the isolate initiator and PDI are neutrals of the outer sequence
+    {"isolate", HZ_DIRECTION_LTR, {'a', RLI, 'b', ALEF, PDI, 'c'}, 6, 0, {0, 0, 2, 1, 0, 0}},
+    {"nested isolates", HZ_DIRECTION_RTL, {ALEF, LRI, 'a', RLI, BET, PDI, PDI, GIMEL}, 8, 1, {1, 1, 2, 2, 3, 2, 1, 1}},
+    // X2 and X9, embedding controls are removed and take the level of the character before them
+    {"embedding", HZ_DIRECTION_LTR, {'a', RLE, 'b', PDF, 'c'}, 5, 0, {0, 0, 2, 2, 0}},
+    // N0, brackets take the direction established before them
+    {"brackets", HZ_DIRECTION_RTL, {ALEF, '(', 'b', ')', GIMEL}, 5, 1, {1, 1, 2, 1, 1}},
+    {"brackets against", HZ_DIRECTION_RTL, {'a', '(', 'b', ')', ALEF}, 5, 1, {2, 2, 2, 2, 1}},
+    // L1, trailing whitespace goes back to the paragraph level
+    {"trailing whitespace", HZ_DIRECTION_RTL, {'a', ' ', 'b', ' ', '\t'}, 5, 1, {2, 2, 2, 1, 1}},
+};
+
+static void run_bidi_test(const bidi_test_t *test) {
+    static uint8_t mem[HZ_BIDI_SCRATCH_SIZE(MAX_CHARS)];
+    hz_memory_arena_t scratch = hz_memory_arena_create(mem, sizeof mem);
+    hz_bidi_paragraph_t para;
+
+    int ok = hz_bidi_resolve_paragraph(NULL, &scratch, test->chars, test->count, test->dir, &para)
+        && para.base_level == test->base_level && para.char_count == test->count
+        && !memcmp(para.levels, test->levels, test->count);
+
+    // the runs cover the paragraph in order with the levels of their characters
+    size_t next = 0;
+    for (size_t r = 0; ok && r < para.run_count; ++r) {
+        const hz_bidi_run_t *run = &para.runs[r];
+        ok &= run->first == next && run->count > 0;
+        for (size_t i = run->first; ok && i < run->first + run->count; ++i)
+            ok &= para.levels[i] == run->level;
+        ok &= r == 0 || para.runs[r - 1].level != run->level;
+        next = run->first + run->count;
+    }
+
+    if (!HZ_TEST_CHECK(ok && next == test->count))
+        fprintf(stderr, "  in \"%s\"\n", test->name);
+}
+
+static void test_reorder(void) {
+    uint32_t order[4];
+
+    const uint8_t mixed[] = {0, 1, 1, 0};
+    hz_bidi_reorder(mixed, 4, order);
+    HZ_TEST_CHECK(order[0] == 0 && order[1] == 2 && order[2] == 1 && order[3] == 3);
+
+    // the level 2 pair is reversed, then everything from level 1
+    const uint8_t nested[] = {1, 2, 2, 1};
+    hz_bidi_reorder(nested, 4, order);
+    HZ_TEST_CHECK(order[0] == 3 && order[1] == 1 && order[2] == 2 && order[3] == 0);
+}
+
+static void test_scratch(void) {
+    // left to right text returns early, other text needs the scratch
+    static uint8_t mem[64];
+    hz_memory_arena_t scratch = hz_memory_arena_create(mem, sizeof mem);
+    hz_bidi_paragraph_t para;
+
+    hz_unicode_t ltr[MAX_CHARS] = {'a', 'b', 'c', ' ', 'd', 'e', 'f', ' ', 'g', 'h', 'i', 'j'};
+    HZ_TEST_CHECK(hz_bidi_resolve_paragraph(NULL, &scratch, ltr, MAX_CHARS, HZ_DIRECTION_INVALID, &para));
+    HZ_TEST_CHECK(para.base_level == 0 && para.run_count == 1 && para.runs[0].count == MAX_CHARS);
+
+    hz_memory_arena_reset(&scratch);
+    hz_unicode_t rtl[MAX_CHARS] = {ALEF, BET, GIMEL, ' ', ALEF, BET, GIMEL, ' ', 'a', 'b', '1', '2'};
+    HZ_TEST_CHECK(!hz_bidi_resolve_paragraph(NULL, &scratch, rtl, MAX_CHARS, HZ_DIRECTION_INVALID, &para));
+}
+
+int main(void) {
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(bidi_tests); ++i)
+        run_bidi_test(&bidi_tests[i]);
+    test_reorder();
+    test_scratch();
+
+    hz_deinit();
+    return hz_test_report("bidi");
+}
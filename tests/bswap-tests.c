@@ -0,0 +1,96 @@
+// Tests of the block byte swaps the parser reads big-endian arrays with: every length from an empty block to
+// past a few vectors, starting at every offset so the vector loads are unaligned, matches swapping the values
+// one at a time and leaves the values around the block alone.
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define MAX_COUNT 80 // five AVX2 vectors of 16-bit values
+#define MAX_OFFSET 8
+#define GUARD 4
+
+// Distinct bytes, so a byte moved to the wrong place changes the value.
+static uint8_t pattern_byte(size_t i) {
+    return (uint8_t)(i * 37 + 11);
+}
+
+static uint64_t load_le(const uint8_t *p, size_t width) {
+    uint64_t v = 0;
+    for (size_t k = 0; k < width; ++k)
+        v |= (uint64_t)p[k] << (8 * k);
+    return v;
+}
+
+static uint64_t load_be(const uint8_t *p, size_t width) {
+    uint64_t v = 0;
+    for (size_t k = 0; k < width; ++k)
+        v = v << 8 | p[k];
+    return v;
+}
+
+static void swap_block(void *values, size_t count, size_t width) {
+    switch (width) {
+        case 2: hz_bswap_u16_block(values, count); break;
+        case 4: hz_bswap_u32_block(values, count); break;
+        case 8: hz_bswap_u64_block(values, count); break;
+    }
+}
+
+// Reads values as their bytes, the expected results don't depend on the byte order of the host.
+static void test_width(size_t width) {
+    static uint64_t storage[(MAX_OFFSET + MAX_COUNT + 2 * GUARD) * 8 / sizeof(uint64_t)];
+    uint8_t *bytes = (uint8_t *)storage, original[sizeof storage];
+    for (size_t i = 0; i < sizeof storage; ++i)
+        original[i] = pattern_byte(i);
+
+    int ok = 1;
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset) {
+        for (size_t count = 0; count <= MAX_COUNT; ++count) {
+            memcpy(bytes, original, sizeof storage);
+            size_t first = (GUARD + offset) * width, last = first + count * width;
+            swap_block(bytes + first, count, width);
+
+            for (size_t i = first; i < last; i += width)
+                ok &= load_le(bytes + i, width) == load_be(original + i, width);
+            ok &= !memcmp(bytes, original, first);
+            ok &= !memcmp(bytes + last, original + last, sizeof storage - last);
+        }
+    }
+
+    if (!HZ_TEST_CHECK(ok))
+        fprintf(stderr, "  of %zu-bit values\n", width * 8);
+}
+
+static void test_values(void) {
+    uint16_t u16[] = {0x0102, 0xA0B0, 0x00FF};
+    hz_bswap_u16_block(u16, 3);
+    HZ_TEST_CHECK(u16[0] == 0x0201 && u16[1] == 0xB0A0 && u16[2] == 0xFF00);
+
+    uint32_t u32[] = {0x01020304, 0xDEADBEEF};
+    hz_bswap_u32_block(u32, 2);
+    HZ_TEST_CHECK(u32[0] == 0x04030201 && u32[1] == 0xEFBEADDE);
+
+    uint64_t u64[] = {0x0102030405060708};
+    hz_bswap_u64_block(u64, 1);
+    HZ_TEST_CHECK(u64[0] == 0x0807060504030201);
+
+    // swapping twice gives the values back
+    uint32_t twice[MAX_COUNT];
+    for (size_t i = 0; i < MAX_COUNT; ++i)
+        twice[i] = (uint32_t)i * 0x01010101u + 0x00102030u;
+    hz_bswap_u32_block(twice, MAX_COUNT);
+    hz_bswap_u32_block(twice, MAX_COUNT);
+    int ok = 1;
+    for (size_t i = 0; i < MAX_COUNT; ++i)
+        ok &= twice[i] == (uint32_t)i * 0x01010101u + 0x00102030u;
+    HZ_TEST_CHECK(ok);
+}
+
+int main(void) {
+    test_width(2);
+    test_width(4);
+    test_width(8);
+    test_values();
+    return hz_test_report("bswap");
+}
@@ -0,0 +1,156 @@
+// Tests of hz_draw_buffer: the instances it adds to the frame, and that quads too large for the
+// instance's fixed point sizes, a full style table and running out of memory are reported.
+//
+// usage: hz_draw_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+// glyph ids of HzTestLayout.ttf, A and V are 300x500 rectangles
+enum { L_SPACE = 1, L_A, L_V };
+
+static int failing_allocs = 0;
+
+static void *test_allocator_fn(void *user, hz_allocator_cmd_t cmd, void *ptr, size_t size, size_t align) {
+    (void)user; (void)align;
+    switch (cmd) {
+        case HZ_CMD_ALLOC: return failing_allocs ? NULL : malloc(size);
+        case HZ_CMD_REALLOC: return failing_allocs ? NULL : realloc(ptr, size);
+        case HZ_CMD_FREE: free(ptr); return NULL;
+        default: return NULL;
+    }
+}
+
+static hz_index_t glyphs[2] = {L_A, L_V};
+static hz_glyph_metrics_t metrics[2] = {{300, 0, 0, 0}, {300, 0, 0, 0}};
+
+static hz_buffer_t test_buffer(size_t count) {
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    buffer.glyph_count = count;
+    buffer.glyph_indices = glyphs;
+    buffer.glyph_metrics = metrics;
+    return buffer;
+}
+
+static hz_buffer_style_t style_with_color(float red) {
+    hz_buffer_style_t style = {0};
+    style.col = (hz_vec4){red, 0.0f, 0.0f, 1.0f};
+    return style;
+}
+
+static void test_instances(hz_context_t *ctx, uint16_t font_id) {
+    hz_command_list_t *cmds = hz_command_list_get(ctx);
+    hz_buffer_t buffer = test_buffer(2);
+    hz_buffer_style_t style = style_with_color(1.0f);
+
+    hz_frame_begin(ctx);
+    HZ_TEST_CHECK(hz_draw_buffer(ctx, &buffer, font_id, (hz_vec3){0.0f, 0.0f, 0.0f}, &style, 32.0f) == HZ_OK);
+    HZ_TEST_CHECK(hz_vector_size(cmds->draw_data) == 2 && hz_vector_size(cmds->styles) == 1);
+    if (hz_vector_size(cmds->draw_data) == 2) {
+        hz_glyph_instance_t a = cmds->draw_data[0], v = cmds->draw_data[1];
+        HZ_TEST_CHECK(a.lru_id.glyph_id == L_A && v.lru_id.glyph_id == L_V);
+        HZ_TEST_CHECK(a.style == 0 && v.style == 0);
+        HZ_TEST_CHECK(a.w == v.w && a.h == v.h && a.w > 0);
+        HZ_TEST_CHECK(abs(a.w * 5 - a.h * 3) <= 8); // 300x500, give or take the rounding
+        HZ_TEST_CHECK(v.x > a.x);
+    }
+
+    // at this size the glyph is taller than an instance can be, it's drawn clamped
+    HZ_TEST_CHECK(hz_draw_buffer(ctx, &buffer, font_id, (hz_vec3){0.0f, 0.0f, 0.0f}, &style, 10000.0f)
+                  == HZ_ERROR_LIMIT_EXCEEDED);
+    HZ_TEST_CHECK(hz_vector_size(cmds->draw_data) == 4);
+    if (hz_vector_size(cmds->draw_data) == 4)
+        HZ_TEST_CHECK(cmds->draw_data[2].h == 65535 && cmds->draw_data[2].w < 65535);
+    hz_frame_end(ctx);
+}
+
+static void test_style_limit(hz_context_t *ctx, uint16_t font_id) {
+    hz_command_list_t *cmds = hz_command_list_get(ctx);
+    hz_buffer_t buffer = test_buffer(1);
+
+    // every draw call with a new style takes an entry, until the table is full
+    hz_frame_begin(ctx);
+    int ok = 1;
+    for (int i = 0; i < HZ_MAX_FRAME_STYLES; ++i) {
+        hz_buffer_style_t style = style_with_color((float)(i & 255) / 255.0f);
+        style.shear = (float)(i >> 8) / 255.0f;
+        ok &= hz_draw_buffer(ctx, &buffer, font_id, (hz_vec3){0.0f, 0.0f, 0.0f}, &style, 16.0f) == HZ_OK;
+    }
+    HZ_TEST_CHECK(ok);
+    HZ_TEST_CHECK(hz_vector_size(cmds->styles) == HZ_MAX_FRAME_STYLES);
+
+    hz_buffer_style_t style = style_with_color(0.5f);
+    HZ_TEST_CHECK(hz_draw_buffer(ctx, &buffer, font_id, (hz_vec3){0.0f, 0.0f, 0.0f}, &style, 16.0f)
+                  == HZ_ERROR_LIMIT_EXCEEDED);
+    HZ_TEST_CHECK(hz_vector_size(cmds->draw_data) == HZ_MAX_FRAME_STYLES);
+    hz_frame_end(ctx);
+
+    // the next frame starts with an empty table
+    hz_frame_begin(ctx);
+    HZ_TEST_CHECK(hz_draw_buffer(ctx, &buffer, font_id, (hz_vec3){0.0f, 0.0f, 0.0f}, &style, 16.0f) == HZ_OK);
+    hz_frame_end(ctx);
+}
+
+static void test_out_of_memory(hz_context_t *ctx, uint16_t font_id) {
+    hz_command_list_t *cmds = hz_command_list_get(ctx);
+    hz_buffer_t buffer = test_buffer(2);
+    hz_buffer_style_t style = style_with_color(1.0f);
+
+    // a size drawn for the first time needs the glyph boxes at that size
+    hz_frame_begin(ctx);
+    failing_allocs = 1;
+    HZ_TEST_CHECK(hz_draw_buffer(ctx, &buffer, font_id, (hz_vec3){0.0f, 0.0f, 0.0f}, &style, 48.0f)
+                  == HZ_ERROR_OUT_OF_MEMORY);
+    failing_allocs = 0;
+    HZ_TEST_CHECK(hz_vector_size(cmds->draw_data) == 0);
+
+    // and they are allocated again on the next call
+    HZ_TEST_CHECK(hz_draw_buffer(ctx, &buffer, font_id, (hz_vec3){0.0f, 0.0f, 0.0f}, &style, 48.0f) == HZ_OK);
+    HZ_TEST_CHECK(hz_vector_size(cmds->draw_data) == 2);
+    hz_frame_end(ctx);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+    hz_set_allocator_fn(test_allocator_fn);
+
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/HzTestLayout.ttf", argv[1]);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0))) {
+        hz_font_t *font = hz_stbtt_font_create(&info);
+        hz_font_data_t *font_data = hz_font_data_create(font);
+
+        hz_glyph_cache_opts_t opts = {0};
+        opts.width = opts.height = 64;
+        opts.x_cells = opts.y_cells = 4;
+        hz_context_t *ctx = hz_context_create(&opts);
+        if (HZ_TEST_CHECK(ctx != NULL)) {
+            uint16_t font_id = hz_context_stash_font(ctx, font_data);
+            test_instances(ctx, font_id);
+            test_style_limit(ctx, font_id);
+            test_out_of_memory(ctx, font_id);
+            hz_context_release(ctx);
+        }
+
+        hz_font_data_release(font_data);
+        hz_face_destroy(hz_font_get_face(font));
+        hz_font_destroy(font);
+    }
+
+    free(data);
+    hz_deinit();
+    return hz_test_report("draw");
+}
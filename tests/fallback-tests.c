@@ -0,0 +1,172 @@
+// Tests of font fallback: the font of the chain each character is found in, the runs hz_shape_fallback splits
+// text into, marks staying with the font of their base, characters no font covers, and the order of the runs
+// of right to left text.
+//
+// usage: hz_fallback_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define GRAVE 0x0300 // only in HzTestLayout
+
+// glyph ids of HzTestLayout.ttf
+enum { L_A = 2, L_V, L_a, L_k, L_l, L_ACUTE, L_GRAVE };
+// glyph ids of HzTestGlyf.ttf, mapped from A to D
+enum { G_BOX = 1, G_DOT, G_BOXDOT, G_OUTER };
+// glyph ids of HzTestVar.ttf
+enum { V_A = 2, V_ACUTE = 6 };
+
+typedef struct {
+    char *data;
+    stbtt_fontinfo info;
+    hz_font_t *font;
+    hz_font_data_t *font_data;
+} test_font_t;
+
+static int test_font_load(test_font_t *f, const char *fonts_dir, const char *name) {
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/%s", fonts_dir, name);
+    f->data = hz_test_read_file(path, &size);
+    if (!f->data || !stbtt_InitFont(&f->info, (const unsigned char *)f->data, 0)) return 0;
+
+    f->font = hz_stbtt_font_create(&f->info);
+    f->font_data = hz_font_data_create(f->font);
+    return 1;
+}
+
+static void test_font_release(test_font_t *f) {
+    if (f->font) {
+        hz_font_data_release(f->font_data);
+        hz_face_destroy(hz_font_get_face(f->font));
+        hz_font_destroy(f->font);
+    }
+
+    free(f->data);
+}
+
+// Checks the glyphs, clusters and fonts of a buffer.
+static int buffer_is(const hz_buffer_t *buffer, size_t count, const hz_index_t *glyphs, const uint32_t *clusters,
+                     const uint16_t *fonts) {
+    if (buffer->glyph_count != count) return 0;
+    if (count && !(buffer->attrib_flags & HZ_GLYPH_ATTRIB_FONT_INDEX_BIT)) return 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (buffer->glyph_indices[i] != glyphs[i] || buffer->clusters[i] != clusters[i]
+            || buffer->font_indices[i] != fonts[i])
+            return 0;
+    }
+
+    return 1;
+}
+
+static void test_find_font(hz_font_data_t *layout, hz_font_data_t *glyf) {
+    hz_fallback_chain_t *chain = hz_fallback_chain_create();
+    hz_fallback_chain_add_font(chain, layout);
+    hz_fallback_chain_add_font(chain, glyf);
+
+    // the first font covering a character wins
+    HZ_TEST_CHECK(hz_fallback_chain_find_font(chain, 'A') == 0);
+    HZ_TEST_CHECK(hz_fallback_chain_find_font(chain, 'a') == 0);
+    HZ_TEST_CHECK(hz_fallback_chain_find_font(chain, 'B') == 1);
+    HZ_TEST_CHECK(hz_fallback_chain_find_font(chain, 'D') == 1);
+    HZ_TEST_CHECK(hz_fallback_chain_find_font(chain, GRAVE) == 0);
+    HZ_TEST_CHECK(hz_fallback_chain_find_font(chain, 'z') == -1);
+    HZ_TEST_CHECK(hz_fallback_chain_find_font(chain, 0x10FFFF) == -1);
+
+    hz_fallback_chain_destroy(chain);
+}
+
+static void shape(hz_shaper_t *shaper, hz_fallback_chain_t *chain, const char *text, hz_buffer_t *buffer) {
+    hz_buffer_init(buffer);
+    hz_shape_fallback(shaper, chain, HZ_ENCODING_UTF8, text, buffer);
+}
+
+static void test_runs(hz_shaper_t *shaper, hz_font_data_t *layout, hz_font_data_t *glyf) {
+    hz_fallback_chain_t *chain = hz_fallback_chain_create();
+    hz_fallback_chain_add_font(chain, layout);
+    hz_fallback_chain_add_font(chain, glyf);
+    hz_buffer_t buffer;
+
+    // a run of each font
+    hz_shaper_set_direction(shaper, HZ_DIRECTION_LTR);
+    shape(shaper, chain, "AaBC", &buffer);
+    HZ_TEST_CHECK(buffer_is(&buffer, 4, (hz_index_t[]){L_A, L_a, G_DOT, G_BOXDOT},
+                            (uint32_t[]){0, 1, 2, 3}, (uint16_t[]){0, 0, 1, 1}));
+    hz_buffer_release(&buffer);
+
+    // and back, a mark its base's font doesn't have goes to the first font that does
+    shape(shaper, chain, "BkD\xcc\x80", &buffer);
+    HZ_TEST_CHECK(buffer_is(&buffer, 4, (hz_index_t[]){G_DOT, L_k, G_OUTER, L_GRAVE},
+                            (uint32_t[]){0, 1, 2, 3}, (uint16_t[]){1, 0, 1, 0}));
+    hz_buffer_release(&buffer);
+
+    // characters no font has stay in the run they are in, or go to the first font at the start
+    shape(shaper, chain, "zBzA", &buffer);
+    HZ_TEST_CHECK(buffer_is(&buffer, 4, (hz_index_t[]){0, G_DOT, 0, L_A},
+                            (uint32_t[]){0, 1, 2, 3}, (uint16_t[]){0, 1, 1, 0}));
+    hz_buffer_release(&buffer);
+
+    // right to left, the later runs go in front
+    hz_shaper_set_direction(shaper, HZ_DIRECTION_RTL);
+    shape(shaper, chain, "AaBC", &buffer);
+    HZ_TEST_CHECK(buffer_is(&buffer, 4, (hz_index_t[]){G_BOXDOT, G_DOT, L_a, L_A},
+                            (uint32_t[]){3, 2, 1, 0}, (uint16_t[]){1, 1, 0, 0}));
+    hz_buffer_release(&buffer);
+    hz_shaper_set_direction(shaper, HZ_DIRECTION_LTR);
+
+    shape(shaper, chain, "", &buffer);
+    HZ_TEST_CHECK(buffer.glyph_count == 0);
+    hz_buffer_release(&buffer);
+
+    hz_fallback_chain_destroy(chain);
+}
+
+static void test_marks(hz_shaper_t *shaper, hz_font_data_t *var, hz_font_data_t *layout) {
+    hz_fallback_chain_t *chain = hz_fallback_chain_create();
+    hz_fallback_chain_add_font(chain, var);
+    hz_fallback_chain_add_font(chain, layout);
+    hz_buffer_t buffer;
+
+    // the acute is in both fonts, it stays with the k of the second rather than going to the first
+    shape(shaper, chain, "Ak\xcc\x81" "A\xcc\x81", &buffer);
+    HZ_TEST_CHECK(buffer_is(&buffer, 5, (hz_index_t[]){V_A, L_k, L_ACUTE, V_A, V_ACUTE},
+                            (uint32_t[]){0, 1, 2, 3, 4}, (uint16_t[]){0, 1, 1, 0, 0}));
+    hz_buffer_release(&buffer);
+
+    hz_fallback_chain_destroy(chain);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    test_font_t layout = {0}, glyf = {0}, var = {0};
+    if (HZ_TEST_CHECK(test_font_load(&layout, argv[1], "HzTestLayout.ttf")
+                      && test_font_load(&glyf, argv[1], "HzTestGlyf.ttf")
+                      && test_font_load(&var, argv[1], "HzTestVar.ttf"))) {
+        // no features, the glyphs are the ones the cmaps map to
+        hz_shaper_t *shaper = hz_shaper_create();
+        hz_shaper_set_script(shaper, HZ_SCRIPT_LATIN);
+        hz_shaper_set_language(shaper, HZ_LANGUAGE_ENGLISH);
+
+        test_find_font(layout.font_data, glyf.font_data);
+        test_runs(shaper, layout.font_data, glyf.font_data);
+        test_marks(shaper, var.font_data, layout.font_data);
+        hz_shaper_destroy(shaper);
+    }
+
+    test_font_release(&layout);
+    test_font_release(&glyf);
+    test_font_release(&var);
+    hz_deinit();
+    return hz_test_report("fallback");
+}
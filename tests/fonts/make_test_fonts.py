@@ -0,0 +1,333 @@
+# Builds the small fonts the tests run on. Requires fontTools, see requirements.txt.
+#
+#   HzTestLayout.ttf  pair and chained context GPOS, mark-to-base and mark-to-mark, cursive
+#   HzTestVar.ttf     wght axis with HVAR, varied GPOS anchors and a FeatureVariations substitution
+#   HzTestColr.ttf    COLR v0 layers and a v1 paint graph over a CPAL palette, with cycles and a layer bomb
+#   HzTestArabic.ttf  isol, init, medi and fina forms of beh, and of a letter added in Unicode 6.1
+#   HzTestGlyf.ttf    composite glyphs placed by offsets and by matching points, nested
+#   HzTestGlyf.woff2  HzTestGlyf.ttf with the glyf, loca and hmtx transforms, needs brotli
+#   HzTestBadGlyf.woff2  the same with a glyph stream too short for the triplets of the last simple glyph
+#
+# Run from this directory: python3 make_test_fonts.py
+
+import os
+import struct
+import tempfile
+
+from fontTools import varLib
+from fontTools.designspaceLib import AxisDescriptor, DesignSpaceDocument, RuleDescriptor, SourceDescriptor
+from fontTools.feaLib.builder import addOpenTypeFeaturesFromString
+from fontTools.fontBuilder import FontBuilder
+from fontTools.pens.ttGlyphPen import TTGlyphPen
+from fontTools.ttLib import TTFont
+from fontTools.ttLib.woff2 import WOFF2FlavorData
+from fontTools.ttLib.tables import otTables as ot
+from fontTools.ttLib.tables._g_l_y_f import Glyph, GlyphComponent
+
+TIMESTAMP = 3786825600  # 2024-01-01, in seconds since 1904
+
+
+def rect(w, h):
+    pen = TTGlyphPen(None)
+    pen.moveTo((0, 0))
+    pen.lineTo((0, h))
+    pen.lineTo((w, h))
+    pen.lineTo((w, 0))
+    pen.closePath()
+    return pen.glyph()
+
+
+def build(family, style, glyphs, cmap, advances, heights=None):
+    fb = FontBuilder(1000, isTTF=True)
+    fb.setupGlyphOrder(glyphs)
+    fb.setupCharacterMap(cmap)
+    fb.setupGlyf({n: rect(max(advances[n], 50) // 2, (heights or {}).get(n, 500)) for n in glyphs})
+    fb.setupHorizontalMetrics({n: (advances[n], 0) for n in glyphs})
+    fb.setupHorizontalHeader(ascent=800, descent=-200)
+    fb.setupNameTable({"familyName": family, "styleName": style})
+    fb.setupOS2()
+    fb.setupPost()
+    # fixed timestamps, so rebuilding a font that didn't change gives the same file
+    fb.updateHead(created=TIMESTAMP, modified=TIMESTAMP)
+    fb.font.recalcTimestamp = False
+    return fb
+
+
+LAYOUT_FEA = """
+languagesystem DFLT dflt;
+languagesystem latn dflt;
+
+markClass [acutecomb gravecomb] <anchor 0 500> @TOP;
+
+lookup SHIFT_V {
+    pos V <-100 20 0 0>;
+} SHIFT_V;
+
+lookup WIDEN {
+    pos [k l] <0 0 30 0>;
+} WIDEN;
+
+lookup NARROW_A {
+    pos A <0 0 -50 0>;
+} NARROW_A;
+
+feature kern {
+    # chained context format 1
+    pos A V' lookup SHIFT_V a;
+    # three glyphs of lookahead, usMaxContext is 4
+    pos A' lookup NARROW_A V a k;
+    # chained context format 3, marks are skipped
+    lookup CLASS_CONTEXT {
+        lookupflag IgnoreMarks;
+        pos [A V] [k l]' lookup WIDEN [a k];
+    } CLASS_CONTEXT;
+    pos V a -40;
+} kern;
+
+feature mark {
+    pos base [A a] <anchor 250 600> mark @TOP;
+} mark;
+
+feature mkmk {
+    pos mark [acutecomb gravecomb] <anchor 0 800> mark @TOP;
+} mkmk;
+
+feature curs {
+    pos cursive k <anchor 0 100> <anchor 400 200>;
+    pos cursive l <anchor 50 150> <anchor 450 300>;
+} curs;
+
+table GDEF {
+    GlyphClassDef [A V a k l], , [acutecomb gravecomb], ;
+} GDEF;
+"""
+
+
+def make_layout():
+    glyphs = [".notdef", "space", "A", "V", "a", "k", "l", "acutecomb", "gravecomb"]
+    cmap = {0x20: "space", 0x41: "A", 0x56: "V", 0x61: "a", 0x6B: "k", 0x6C: "l",
+            0x300: "gravecomb", 0x301: "acutecomb"}
+    advances = {".notdef": 500, "space": 250, "A": 600, "V": 600, "a": 500, "k": 500, "l": 450,
+                "acutecomb": 0, "gravecomb": 0}
+    fb = build("HzTestLayout", "Regular", glyphs, cmap, advances)
+    addOpenTypeFeaturesFromString(fb.font, LAYOUT_FEA)
+    fb.save("HzTestLayout.ttf")
+
+
+def make_var_master(bold):
+    glyphs = [".notdef", "space", "A", "V", "a", "a.alt", "acutecomb"]
+    cmap = {0x20: "space", 0x41: "A", 0x56: "V", 0x61: "a", 0x301: "acutecomb"}
+    advances = {".notdef": 500, "space": 250, "A": 600 + 100 * bold, "V": 600 + 120 * bold,
+                "a": 500 + 80 * bold, "a.alt": 520 + 90 * bold, "acutecomb": 0}
+    fb = build("HzTestVar", "Bold" if bold else "Light", glyphs, cmap, advances,
+               {n: 500 + 100 * bold for n in glyphs})
+    fea = """
+languagesystem DFLT dflt;
+languagesystem latn dflt;
+markClass acutecomb <anchor 0 %d> @TOP;
+feature kern { pos A V %d; pos V a %d; } kern;
+feature mark { pos base a <anchor 250 %d> mark @TOP; pos base A <anchor 300 %d> mark @TOP; } mark;
+table GDEF { GlyphClassDef [A V a a.alt], , [acutecomb], ; } GDEF;
+""" % (500 + 50 * bold, -80 - 70 * bold, -40 - 30 * bold, 520 + 100 * bold, 700 + 60 * bold)
+    addOpenTypeFeaturesFromString(fb.font, fea)
+    return fb.font
+
+
+def make_var():
+    with tempfile.TemporaryDirectory() as tmp:
+        ds = DesignSpaceDocument()
+        axis = AxisDescriptor()
+        axis.tag, axis.name = "wght", "Weight"
+        axis.minimum, axis.default, axis.maximum = 100, 100, 900
+        axis.map = [(100, 100), (400, 300), (900, 900)]
+        ds.addAxis(axis)
+        for bold, weight in ((0, 100), (1, 900)):
+            path = os.path.join(tmp, "master%d.ttf" % bold)
+            make_var_master(bold).save(path)
+            source = SourceDescriptor()
+            source.path, source.location = path, {"Weight": weight}
+            ds.addSource(source)
+        rule = RuleDescriptor()
+        rule.name = "alt"
+        rule.conditionSets = [[{"name": "Weight", "minimum": 600, "maximum": 900}]]
+        rule.subs = [("a", "a.alt")]
+        ds.addRule(rule)
+        vf, _, _ = varLib.build(ds)
+        vf["head"].created = vf["head"].modified = TIMESTAMP
+        vf.recalcTimestamp = False
+        vf.save("HzTestVar.ttf")
+
+
+def make_colr():
+    glyphs = [".notdef", "A", "B", "C", "D", "E", "F", "G", "H", "l0", "l1", "l2"]
+    cmap = {0x41 + i: chr(0x41 + i) for i in range(8)}
+    fb = build("HzTestColr", "Regular", glyphs, cmap, {n: 600 for n in glyphs})
+    fb.setupCPAL([[(1, 0, 0, 1), (0, 1, 0, 1), (0, 0, 1, 0.5)]])
+
+    def solid(index, alpha=1.0):
+        return {"Format": ot.PaintFormat.PaintSolid, "PaletteIndex": index, "Alpha": alpha}
+
+    fb.setupCOLR({
+        # v0 layers
+        "A": [("l0", 0), ("l1", 1)],
+        # v1 layers, the second uses the foreground color, the third nests the paint of C
+        "B": {"Format": ot.PaintFormat.PaintColrLayers, "Layers": [
+            {"Format": ot.PaintFormat.PaintGlyph, "Paint": solid(2), "Glyph": "l2"},
+            {"Format": ot.PaintFormat.PaintGlyph, "Paint": solid(0xFFFF, 0.5), "Glyph": "l0"},
+            {"Format": ot.PaintFormat.PaintColrGlyph, "Glyph": "C"}]},
+        "C": {"Format": ot.PaintFormat.PaintGlyph, "Paint": solid(1, 0.25), "Glyph": "l1"},
+        # E draws itself, F and G draw each other
+        "E": {"Format": ot.PaintFormat.PaintColrLayers, "Layers": [
+            {"Format": ot.PaintFormat.PaintGlyph, "Paint": solid(0), "Glyph": "l0"},
+            {"Format": ot.PaintFormat.PaintColrGlyph, "Glyph": "E"}]},
+        "F": {"Format": ot.PaintFormat.PaintColrGlyph, "Glyph": "G"},
+        "G": {"Format": ot.PaintFormat.PaintColrLayers, "Layers": [
+            {"Format": ot.PaintFormat.PaintGlyph, "Paint": solid(1), "Glyph": "l1"},
+            {"Format": ot.PaintFormat.PaintColrGlyph, "Glyph": "F"}]},
+        # 200 references to C, each 200 layers of C, far more layers than a glyph may have
+        "H": {"Format": ot.PaintFormat.PaintColrLayers, "Layers": [
+            {"Format": ot.PaintFormat.PaintColrLayers, "Layers": [
+                {"Format": ot.PaintFormat.PaintColrGlyph, "Glyph": "C"}] * 200}] * 200},
+    })
+    fb.save("HzTestColr.ttf")
+
+
+ARABIC_FEA = """
+languagesystem DFLT dflt;
+languagesystem arab dflt;
+
+feature isol {
+    sub beh by beh.isol;
+} isol;
+
+feature init {
+    sub [beh behv] by [beh.init behv.init];
+} init;
+
+feature medi {
+    sub beh by beh.medi;
+} medi;
+
+feature fina {
+    sub [beh alef] by [beh.fina alef.fina];
+} fina;
+
+table GDEF {
+    GlyphClassDef [beh beh.isol beh.init beh.medi beh.fina behv behv.init alef alef.fina hamza tatweel], ,
+        [fatha], ;
+} GDEF;
+"""
+
+
+def make_arabic():
+    glyphs = [".notdef", "space", "beh", "beh.isol", "beh.init", "beh.medi", "beh.fina", "behv", "behv.init",
+              "alef", "alef.fina", "hamza", "tatweel", "fatha", "zwj"]
+    cmap = {0x20: "space", 0x621: "hamza", 0x627: "alef", 0x628: "beh", 0x640: "tatweel", 0x64E: "fatha",
+            0x8A0: "behv", 0x200D: "zwj"}
+    advances = {n: 500 for n in glyphs}
+    advances.update({"space": 250, "fatha": 0, "zwj": 0})
+    fb = build("HzTestArabic", "Regular", glyphs, cmap, advances)
+    addOpenTypeFeaturesFromString(fb.font, ARABIC_FEA)
+    fb.save("HzTestArabic.ttf")
+
+
+def component(name, x=0, y=0, points=None):
+    c = GlyphComponent()
+    c.glyphName = name
+    c.flags = 0
+    if points is not None:
+        c.firstPt, c.secondPt = points  # point of the glyph so far, point of the component
+    else:
+        c.x, c.y = x, y
+    return c
+
+
+def composite(*components):
+    g = Glyph()
+    g.numberOfContours = -1
+    g.components = list(components)
+    return g
+
+
+def make_glyf():
+    glyphs = [".notdef", "box", "dot", "boxdot", "outer"]
+    fb = FontBuilder(1000, isTTF=True)
+    fb.setupGlyphOrder(glyphs)
+    fb.setupCharacterMap({0x41 + i: n for i, n in enumerate(glyphs[1:])})
+    fb.setupGlyf({
+        ".notdef": rect(250, 500),
+        "box": rect(100, 100),
+        "dot": rect(10, 10),
+        # the dot's first point is put on the box's third, (100, 100)
+        "boxdot": composite(component("box"), component("dot", points=(2, 0))),
+        # boxdot nested after another component, its points are still numbered from its own start
+        "outer": composite(component("box", 500, 0), component("boxdot", 0, 200)),
+    })
+    fb.setupHorizontalMetrics({n: (600, 0) for n in glyphs})
+    fb.setupHorizontalHeader(ascent=800, descent=-200)
+    fb.setupNameTable({"familyName": "HzTestGlyf", "styleName": "Regular"})
+    fb.setupOS2()
+    fb.setupPost()
+    fb.updateHead(created=TIMESTAMP, modified=TIMESTAMP)
+    fb.font.recalcTimestamp = False
+    fb.save("HzTestGlyf.ttf")
+
+
+def read_base128(data, offset):
+    value = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        value = value << 7 | byte & 0x7F
+        if not byte & 0x80:
+            return value, offset
+
+
+def make_woff2():
+    import brotli
+
+    font = TTFont("HzTestGlyf.ttf", recalcTimestamp=False)
+    font.flavor = "woff2"
+    font.flavorData = WOFF2FlavorData(transformedTables={"glyf", "loca", "hmtx"})
+    font.save("HzTestGlyf.woff2")
+
+    # find the transformed glyf table in the decompressed stream, tables are in directory order
+    with open("HzTestGlyf.woff2", "rb") as f:
+        data = f.read()
+    num_tables, = struct.unpack(">H", data[12:14])
+    compressed_size, = struct.unpack(">I", data[20:24])
+    offset, glyf_offset, stream_offset = 48, None, 0
+    for _ in range(num_tables):
+        flags = data[offset]
+        offset += 1
+        tag = data[offset:offset + 4] if flags & 63 == 63 else None
+        offset += 4 if flags & 63 == 63 else 0
+        length, offset = read_base128(data, offset)
+        if flags & 63 == 10:  # glyf, transformed
+            length, offset = read_base128(data, offset)
+            glyf_offset = stream_offset
+        elif flags >> 6 != (3 if flags & 63 == 11 else 0):
+            length, offset = read_base128(data, offset)
+        stream_offset += length
+
+    # move the last three bytes of the glyph stream to the composite stream, totals stay the same
+    stream = bytearray(brotli.decompress(data[offset:offset + compressed_size]))
+    glyph_size, composite_size = struct.unpack(">II", stream[glyf_offset + 20:glyf_offset + 28])
+    stream[glyf_offset + 20:glyf_offset + 28] = struct.pack(">II", glyph_size - 3, composite_size + 3)
+
+    compressed = brotli.compress(bytes(stream))
+    bad = bytearray(data[:offset]) + compressed
+    bad += b"\0" * (-len(bad) % 4)
+    bad[8:12] = struct.pack(">I", len(bad))
+    bad[20:24] = struct.pack(">I", len(compressed))
+    with open("HzTestBadGlyf.woff2", "wb") as f:
+        f.write(bad)
+
+
+if __name__ == "__main__":
+    make_layout()
+    make_var()
+    make_colr()
+    make_arabic()
+    make_glyf()
+    make_woff2()
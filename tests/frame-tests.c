@@ -0,0 +1,109 @@
+// Tests of hz_frame_resolve with grid packing: glyphs are deduplicated per batch, cached glyphs
+// are reused without rasterizing again, the least recently used slot is evicted, and a frame
+// with more unique glyphs than slots is resolved in several batches.
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define SLOT_COUNT 4
+
+static hz_cache_id_t glyph_id(uint16_t glyph) {
+    hz_cache_id_t id;
+    id.font_id = 0;
+    id.glyph_id = glyph;
+    return id;
+}
+
+// Starts a frame drawing the glyphs of `glyphs`, one instance each.
+static void frame_with_glyphs(hz_context_t *ctx, const uint16_t *glyphs, size_t count) {
+    hz_command_list_t *cmds = hz_command_list_get(ctx);
+    hz_frame_begin(ctx);
+
+    for (size_t i = 0; i < count; ++i) {
+        hz_glyph_instance_t g = {0};
+        g.lru_id = glyph_id(glyphs[i]);
+        hz_vector_push_back(cmds->draw_data, g);
+    }
+}
+
+static uint16_t slot_of(hz_context_t *ctx, size_t instance) {
+    return hz_command_list_get(ctx)->draw_data[instance].slot;
+}
+
+static int rastered(const hz_frame_result_t *r, uint16_t glyph) {
+    for (size_t i = 0; i < r->raster_count; ++i)
+        if (r->raster_ids[i].glyph_id == glyph) return 1;
+    return 0;
+}
+
+static void test_dedup_and_reuse(hz_context_t *ctx, hz_glyph_cache_opts_t *opts) {
+    hz_frame_result_t r;
+
+    const uint16_t first[] = {10, 11, 10, 12};
+    frame_with_glyphs(ctx, first, 4);
+    HZ_TEST_CHECK(hz_frame_resolve(ctx, &r));
+    HZ_TEST_CHECK(r.first_instance == 0 && r.instance_count == 4);
+    HZ_TEST_CHECK(r.unique_count == 3 && r.raster_count == 3);
+    HZ_TEST_CHECK(slot_of(ctx, 0) == slot_of(ctx, 2));
+    HZ_TEST_CHECK(slot_of(ctx, 0) != slot_of(ctx, 1) && slot_of(ctx, 1) != slot_of(ctx, 3));
+
+    int rects_match = 1;
+    for (size_t i = 0; i < r.raster_count; ++i) {
+        hz_rect_t cell = hz_glyph_cache_compute_cell_rect(opts, r.raster_slots[i]);
+        rects_match &= !memcmp(&cell, &r.raster_rects[i], sizeof cell);
+    }
+    HZ_TEST_CHECK(rects_match);
+    hz_frame_end(ctx);
+
+    // 10 and 12 are cached, 13 takes the last free slot and 14 evicts 11, the least recently used
+    uint16_t slot_10 = slot_of(ctx, 0), slot_11 = slot_of(ctx, 1);
+    const uint16_t second[] = {12, 10, 13, 14};
+    frame_with_glyphs(ctx, second, 4);
+    HZ_TEST_CHECK(hz_frame_resolve(ctx, &r));
+    HZ_TEST_CHECK(r.raster_count == 2 && rastered(&r, 13) && rastered(&r, 14));
+    HZ_TEST_CHECK(slot_of(ctx, 1) == slot_10);
+    HZ_TEST_CHECK(slot_of(ctx, 3) == slot_11);
+    hz_frame_end(ctx);
+}
+
+static void test_batches(hz_context_t *ctx) {
+    hz_frame_result_t r;
+
+    // six unique glyphs don't fit in four slots at once
+    const uint16_t glyphs[] = {20, 21, 22, 23, 20, 24, 25};
+    frame_with_glyphs(ctx, glyphs, 7);
+
+    HZ_TEST_CHECK(!hz_frame_resolve(ctx, &r));
+    HZ_TEST_CHECK(r.first_instance == 0 && r.instance_count == 5);
+    HZ_TEST_CHECK(r.unique_count == SLOT_COUNT && r.raster_count == SLOT_COUNT);
+    HZ_TEST_CHECK(slot_of(ctx, 0) == slot_of(ctx, 4));
+
+    HZ_TEST_CHECK(hz_frame_resolve(ctx, &r));
+    HZ_TEST_CHECK(r.first_instance == 5 && r.instance_count == 2);
+    HZ_TEST_CHECK(r.unique_count == 2 && r.raster_count == 2);
+    HZ_TEST_CHECK(slot_of(ctx, 5) != slot_of(ctx, 6));
+    hz_frame_end(ctx);
+}
+
+int main(void) {
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    hz_glyph_cache_opts_t opts = {0};
+    opts.width = opts.height = 64;
+    opts.x_cells = opts.y_cells = 2;
+    opts.packing = HZ_GLYPH_CACHE_PACKING_GRID;
+
+    hz_context_t *ctx = hz_context_create(&opts);
+    if (HZ_TEST_CHECK(ctx != NULL)) {
+        test_dedup_and_reuse(ctx, &opts);
+        test_batches(ctx);
+        hz_context_release(ctx);
+    }
+
+    hz_deinit();
+    return hz_test_report("frame");
+}
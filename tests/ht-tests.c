@@ -0,0 +1,135 @@
+// Tests of the hz_ht_t hash table: lookups across growth and removal, iteration, and that running
+// out of memory at any allocation is reported instead of leaving a broken table.
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+// allocator that fails every allocation once allocs_left reaches 0
+typedef struct {
+    int allocs_left;
+    int live; // blocks allocated and not yet freed
+} failing_allocator_t;
+
+static void *failing_allocator_fn(void *user, hz_allocator_cmd_t cmd, void *ptr, size_t size, size_t align) {
+    failing_allocator_t *fa = user;
+    (void)align;
+
+    switch (cmd) {
+        case HZ_CMD_ALLOC:
+            if (fa->allocs_left == 0) return NULL;
+            --fa->allocs_left;
+            ++fa->live;
+            return malloc(size);
+        case HZ_CMD_FREE:
+            if (ptr != NULL) --fa->live, free(ptr);
+            return NULL;
+        default:
+            return NULL;
+    }
+}
+
+static void test_insert_search_remove(void) {
+    failing_allocator_t fa = {-1, 0};
+    hz_allocator_t alctr = {failing_allocator_fn, &fa};
+    hz_ht_t *ht = hz_ht_create(&alctr, 4);
+    if (!HZ_TEST_CHECK(ht != NULL)) return;
+
+    int ok = 1;
+    for (uint32_t k = 0; k < 10000; ++k)
+        ok &= hz_ht_insert(ht, k * 2654435761u, k);
+    HZ_TEST_CHECK(ok);
+    HZ_TEST_CHECK(hz_ht_size(ht) == 10000);
+
+    // replacing keeps the size
+    HZ_TEST_CHECK(hz_ht_insert(ht, 0, 42) && hz_ht_size(ht) == 10000);
+
+    hz_ht_iter_t it;
+    ok = 1;
+    for (uint32_t k = 1; k < 10000; ++k)
+        ok &= hz_ht_search(ht, k * 2654435761u, &it) && *it.ptr_value == k;
+    HZ_TEST_CHECK(ok);
+    HZ_TEST_CHECK(hz_ht_search(ht, 0, &it) && *it.ptr_value == 42);
+
+    ok = 1;
+    for (uint32_t k = 0; k < 10000; k += 2)
+        ok &= hz_ht_remove(ht, k * 2654435761u);
+    HZ_TEST_CHECK(ok);
+    HZ_TEST_CHECK(!hz_ht_remove(ht, 0));
+    HZ_TEST_CHECK(hz_ht_size(ht) == 5000);
+
+    // the entries left behind the removed ones are still found
+    ok = 1;
+    for (uint32_t k = 0; k < 10000; ++k)
+        ok &= hz_ht_search(ht, k * 2654435761u, &it) == (k & 1);
+    HZ_TEST_CHECK(ok);
+
+    size_t visited = 0;
+    for (it = hz_ht_iter_begin(ht); hz_ht_iter_valid(&it); hz_ht_iter_next(ht, &it))
+        visited += (*it.ptr_value & 1) && it.key == *it.ptr_value * 2654435761u;
+    HZ_TEST_CHECK(visited == 5000);
+
+    hz_ht_destroy(ht);
+    HZ_TEST_CHECK(fa.live == 0);
+}
+
+static void test_out_of_memory(void) {
+    // the table and its three bucket arrays are four allocations, each of them may fail
+    for (int n = 0; n < 4; ++n) {
+        failing_allocator_t fa = {n, 0};
+        hz_allocator_t alctr = {failing_allocator_fn, &fa};
+        HZ_TEST_CHECK(hz_ht_create(&alctr, 16) == NULL);
+        HZ_TEST_CHECK(fa.live == 0);
+    }
+
+    // growing fails, the table keeps what it had
+    failing_allocator_t fa = {4, 0};
+    hz_allocator_t alctr = {failing_allocator_fn, &fa};
+    hz_ht_t *ht = hz_ht_create(&alctr, 16);
+    if (!HZ_TEST_CHECK(ht != NULL)) return;
+
+    uint32_t inserted = 0;
+    while (inserted < 1000 && hz_ht_insert(ht, inserted, inserted + 1))
+        ++inserted;
+    HZ_TEST_CHECK(inserted < 1000);
+    HZ_TEST_CHECK(hz_ht_size(ht) == inserted);
+
+    hz_ht_iter_t it;
+    int ok = 1;
+    for (uint32_t k = 0; k < inserted; ++k)
+        ok &= hz_ht_search(ht, k, &it) && *it.ptr_value == k + 1;
+    HZ_TEST_CHECK(ok);
+
+    hz_ht_destroy(ht);
+    HZ_TEST_CHECK(fa.live == 0);
+}
+
+static void test_arena(void) {
+    static uint8_t mem[1 << 16];
+    hz_memory_arena_t arena = hz_memory_arena_create(mem, sizeof mem);
+    hz_ht_t *ht = hz_ht_create_arena(&arena, 64);
+    if (!HZ_TEST_CHECK(ht != NULL)) return;
+
+    HZ_TEST_CHECK(hz_ht_insert(ht, 7, 8));
+    hz_ht_iter_t it;
+    HZ_TEST_CHECK(hz_ht_search(ht, 7, &it) && *it.ptr_value == 8);
+    hz_ht_destroy(ht);
+
+    // an arena too small for the buckets
+    hz_memory_arena_t small = hz_memory_arena_create(mem, 128);
+    HZ_TEST_CHECK(hz_ht_create_arena(&small, 64) == NULL);
+}
+
+int main(void) {
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    test_insert_search_remove();
+    test_out_of_memory();
+    test_arena();
+
+    hz_deinit();
+    return hz_test_report("hash table");
+}
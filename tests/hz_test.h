@@ -0,0 +1,50 @@
+// Helpers shared by the test programs: checks that count failures and a file reader.
+
+#ifndef HZ_TEST_H
+#define HZ_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t hz_test_count = 0, hz_test_failures = 0;
+
+static int hz_test_check(int ok, const char *expr, const char *file, int line) {
+    ++hz_test_count;
+    if (!ok) {
+        ++hz_test_failures;
+        fprintf(stderr, "%s:%d: FAIL %s\n", file, line, expr);
+    }
+
+    return ok;
+}
+
+// Checks a condition, prints it with its location when it doesn't hold and evaluates to it.
+#define HZ_TEST_CHECK(cond) hz_test_check(!!(cond), #cond, __FILE__, __LINE__)
+
+static char *hz_test_read_file(const char *filename, size_t *out_size) {
+    FILE *fp = fopen(filename,"rb");
+    char *data = NULL;
+
+    if (fp) {
+        fseek(fp,0,SEEK_END);
+        *out_size = ftell(fp);
+        fseek(fp,0,SEEK_SET);
+        data = malloc(*out_size);
+        if (data && fread(data,1,*out_size,fp) != *out_size) {
+            free(data);
+            data = NULL;
+        }
+        fclose(fp);
+    }
+
+    return data;
+}
+
+// Prints the summary line and returns the exit status of the test program.
+static int hz_test_report(const char *name) {
+    printf("%s: %zu/%zu checks passed\n", name, hz_test_count - hz_test_failures, hz_test_count);
+    return hz_test_failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#endif /* HZ_TEST_H */
@@ -0,0 +1,211 @@
+// Tests of script itemization (UAX #24) and of hz_shape_auto built on it: the runs of one script, the
+// runs of mixed text joined in visual order, the shapers it caches per script and language, the UCD
+// version it is given, and that running out of memory is reported.
+//
+// usage: hz_itemize_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define MAX_CHARS 12
+#define MAX_RUNS 4
+
+#define ALEF 0x05D0
+#define BET 0x05D1
+#define GIMEL 0x05D2
+#define SHEVA 0x05B0 // Inherited
+#define BEH 0x0628
+#define TATWEEL 0x0640 // Common, used with Arabic and Syriac
+
+// glyph ids of HzTestLayout.ttf, it has no Hebrew so those characters map to .notdef
+enum { L_NOTDEF = 0, L_SPACE, L_A, L_V };
+
+typedef struct {
+    const char *name;
+    hz_unicode_t chars[MAX_CHARS];
+    size_t count;
+    size_t run_count;
+    hz_script_run_t runs[MAX_RUNS];
+} itemize_test_t;
+
+static const itemize_test_t itemize_tests[] = {
+    {"latin", {'a', 'b', ' ', 'c'}, 4, 1, {{0, 4, HZ_SCRIPT_LATIN}}},
+    {"common only", {'1', '2', ' ', '3'}, 4, 1, {{0, 4, HZ_SCRIPT_COMMON}}},
+    // leading common characters join the first script
+    {"leading common", {'1', ' ', 'a', 'b'}, 4, 1, {{0, 4, HZ_SCRIPT_LATIN}}},
+    // common characters stay with the text before them
+    {"mixed", {'a', 'b', ' ', ALEF, BET}, 5, 2, {{0, 3, HZ_SCRIPT_LATIN}, {3, 2, HZ_SCRIPT_HEBREW}}},
+    // marks stay with their base
+    {"inherited", {ALEF, SHEVA, BET, SHEVA}, 4, 1, {{0, 4, HZ_SCRIPT_HEBREW}}},
+    // a character used with the run's script continues it
+    {"extensions", {BEH, TATWEEL, BEH}, 3, 1, {{0, 3, HZ_SCRIPT_ARABIC}}},
+    // the closing bracket goes back to the script of its opening bracket
+    {"brackets", {ALEF, ' ', '(', 'a', 'b', ')', ' ', GIMEL}, 8, 3,
+        {{0, 3, HZ_SCRIPT_HEBREW}, {3, 2, HZ_SCRIPT_LATIN}, {5, 3, HZ_SCRIPT_HEBREW}}},
+    {"leading bracket", {'(', ALEF, ')', 'a'}, 4, 2, {{0, 3, HZ_SCRIPT_HEBREW}, {3, 1, HZ_SCRIPT_LATIN}}},
+};
+
+static void run_itemize_test(const itemize_test_t *test) {
+    hz_script_run_t runs[MAX_CHARS];
+    size_t run_count = hz_itemize_scripts(NULL, test->chars, test->count, runs);
+
+    int ok = run_count == test->run_count;
+    for (size_t i = 0; ok && i < run_count; ++i)
+        ok &= runs[i].first == test->runs[i].first && runs[i].count == test->runs[i].count
+            && runs[i].script == test->runs[i].script;
+    if (!HZ_TEST_CHECK(ok))
+        fprintf(stderr, "  in \"%s\"\n", test->name);
+}
+
+static int buffer_is(const hz_buffer_t *buffer, size_t count, const hz_index_t *glyphs, const uint32_t *clusters) {
+    if (buffer->glyph_count != count) return 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (buffer->glyph_indices[i] != glyphs[i] || buffer->clusters[i] != clusters[i])
+            return 0;
+    }
+
+    return 1;
+}
+
+// Fails allocations of at least fail_from bytes.
+static size_t fail_from = SIZE_MAX;
+
+static void *test_allocator_fn(void *user, hz_allocator_cmd_t cmd, void *ptr, size_t size, size_t align) {
+    (void)user; (void)align;
+    switch (cmd) {
+        case HZ_CMD_ALLOC: return size >= fail_from ? NULL : malloc(size);
+        case HZ_CMD_REALLOC: return size >= fail_from ? NULL : realloc(ptr, size);
+        case HZ_CMD_FREE: free(ptr); return NULL;
+        default: return NULL;
+    }
+}
+
+static void test_shape_auto(hz_font_data_t *font_data) {
+    // "AV אב", a left to right paragraph with a right to left run at its end
+    static const hz_index_t ltr_glyphs[] = {L_A, L_V, L_SPACE, L_NOTDEF, L_NOTDEF};
+    static const uint32_t ltr_clusters[] = {0, 1, 2, 4, 3};
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    HZ_TEST_CHECK(hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, "AV \xd7\x90\xd7\x91", HZ_DIRECTION_INVALID,
+                                HZ_LANGUAGE_ENGLISH, &buffer) == HZ_OK);
+    HZ_TEST_CHECK(buffer_is(&buffer, 5, ltr_glyphs, ltr_clusters));
+    hz_buffer_release(&buffer);
+
+    // "אב AV", the space between the scripts takes the paragraph's direction, the Latin run comes first
+    static const hz_index_t rtl_glyphs[] = {L_A, L_V, L_SPACE, L_NOTDEF, L_NOTDEF};
+    static const uint32_t rtl_clusters[] = {3, 4, 2, 1, 0};
+    hz_buffer_init(&buffer);
+    HZ_TEST_CHECK(hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, "\xd7\x90\xd7\x91 AV", HZ_DIRECTION_INVALID,
+                                HZ_LANGUAGE_ENGLISH, &buffer) == HZ_OK);
+    HZ_TEST_CHECK(buffer_is(&buffer, 5, rtl_glyphs, rtl_clusters));
+    hz_buffer_release(&buffer);
+
+    // more languages than the font data keeps shapers for, evicted shapers are set up again the same way
+    static const hz_language_t languages[] = {
+        HZ_LANGUAGE_ENGLISH, HZ_LANGUAGE_FRENCH, HZ_LANGUAGE_GERMAN, HZ_LANGUAGE_SPANISH,
+        HZ_LANGUAGE_ITALIAN, HZ_LANGUAGE_ENGLISH,
+    };
+    int ok = 1;
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(languages); ++i) {
+        hz_buffer_init(&buffer);
+        ok &= hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, "AV \xd7\x90\xd7\x91", HZ_DIRECTION_INVALID,
+                            languages[i], &buffer) == HZ_OK;
+        ok &= buffer_is(&buffer, 5, ltr_glyphs, ltr_clusters);
+        hz_buffer_release(&buffer);
+    }
+    HZ_TEST_CHECK(ok);
+
+    // two marks added in 15.0 were AL defaults in 14.0, the runs follow the version of the properties
+    hz_ucd_t *v14 = hz_ucd_create(HZ_MAKE_VERSION(14,0,0));
+    const char *marks = "A\xf0\x90\xbb\xbd\xf0\x90\xbb\xbe";
+    static const hz_index_t marks_glyphs[] = {L_A, L_NOTDEF, L_NOTDEF};
+    hz_buffer_init(&buffer);
+    HZ_TEST_CHECK(hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, marks, HZ_DIRECTION_LTR,
+                                HZ_LANGUAGE_ENGLISH, &buffer) == HZ_OK);
+    HZ_TEST_CHECK(buffer_is(&buffer, 3, marks_glyphs, (uint32_t[]){0, 1, 2}));
+    hz_buffer_release(&buffer);
+    hz_buffer_init(&buffer);
+    HZ_TEST_CHECK(v14 != NULL && hz_shape_auto(font_data, v14, HZ_ENCODING_UTF8, marks, HZ_DIRECTION_LTR,
+                                               HZ_LANGUAGE_ENGLISH, &buffer) == HZ_OK);
+    HZ_TEST_CHECK(buffer_is(&buffer, 3, marks_glyphs, (uint32_t[]){0, 2, 1}));
+    hz_buffer_release(&buffer);
+    hz_ucd_destroy(v14);
+
+    // empty text shapes to nothing
+    hz_buffer_init(&buffer);
+    HZ_TEST_CHECK(hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, "", HZ_DIRECTION_INVALID,
+                                HZ_LANGUAGE_ENGLISH, &buffer) == HZ_OK);
+    HZ_TEST_CHECK(buffer.glyph_count == 0);
+    hz_buffer_release(&buffer);
+}
+
+static void test_out_of_memory(hz_font_t *font) {
+    hz_font_data_t *font_data = hz_font_data_create(font);
+    const char *text = "AV \xd7\x90\xd7\x91";
+    hz_buffer_t buffer;
+
+    // the scratch of the runs
+    hz_buffer_init(&buffer);
+    fail_from = HZ_BIDI_SCRATCH_SIZE(5);
+    HZ_TEST_CHECK(hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, text, HZ_DIRECTION_INVALID,
+                                HZ_LANGUAGE_ENGLISH, &buffer) == HZ_ERROR_OUT_OF_MEMORY);
+    HZ_TEST_CHECK(buffer.glyph_count == 0);
+    hz_buffer_release(&buffer);
+
+    // the first shaper of a font data, the scratch of five characters is much smaller
+    hz_buffer_init(&buffer);
+    fail_from = 4096;
+    HZ_TEST_CHECK(hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, text, HZ_DIRECTION_INVALID,
+                                HZ_LANGUAGE_ENGLISH, &buffer) == HZ_ERROR_OUT_OF_MEMORY);
+    HZ_TEST_CHECK(buffer.glyph_count == 0);
+    hz_buffer_release(&buffer);
+
+    // nothing was cached, the next call works
+    fail_from = SIZE_MAX;
+    hz_buffer_init(&buffer);
+    HZ_TEST_CHECK(hz_shape_auto(font_data, NULL, HZ_ENCODING_UTF8, text, HZ_DIRECTION_INVALID,
+                                HZ_LANGUAGE_ENGLISH, &buffer) == HZ_OK);
+    HZ_TEST_CHECK(buffer.glyph_count == 5);
+    hz_buffer_release(&buffer);
+
+    hz_font_data_release(font_data);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+    hz_set_allocator_fn(test_allocator_fn);
+
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(itemize_tests); ++i)
+        run_itemize_test(&itemize_tests[i]);
+
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/HzTestLayout.ttf", argv[1]);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0))) {
+        hz_font_t *font = hz_stbtt_font_create(&info);
+        hz_font_data_t *font_data = hz_font_data_create(font);
+
+        test_shape_auto(font_data);
+        test_out_of_memory(font);
+
+        hz_font_data_release(font_data);
+        hz_face_destroy(hz_font_get_face(font));
+        hz_font_destroy(font);
+    }
+
+    free(data);
+    hz_deinit();
+    return hz_test_report("itemize");
+}
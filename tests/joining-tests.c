@@ -0,0 +1,127 @@
+// Tests of Arabic joining forms: the isol, init, medi and fina forms the joining types give, right joining and
+// non joining characters breaking the chain, join causing characters, marks being skipped over, and the forms
+// following the UCD version of the shaper.
+//
+// usage: hz_joining_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define MAX_GLYPHS 8
+
+// glyph ids of HzTestArabic.ttf
+enum {
+    A_SPACE = 1, A_BEH, A_BEH_ISOL, A_BEH_INIT, A_BEH_MEDI, A_BEH_FINA, A_BEHV, A_BEHV_INIT,
+    A_ALEF, A_ALEF_FINA, A_HAMZA, A_TATWEEL, A_FATHA, A_ZWJ
+};
+
+typedef struct {
+    const char *name;
+    const char *text;
+    size_t glyph_count;
+    hz_index_t glyphs[MAX_GLYPHS]; // in logical order
+} joining_test_t;
+
+#define BEH "\xd8\xa8"
+#define ALEF "\xd8\xa7"     // R
+#define HAMZA "\xd8\xa1"    // U
+#define TATWEEL "\xd9\x80"  // C
+#define FATHA "\xd9\x8e"    // T
+#define ZWJ "\xe2\x80\x8d"  // C
+#define BEHV "\xe0\xa2\xa0" // D, added in 6.1
+
+static const joining_test_t joining_tests[] = {
+    {"isolated", BEH, 1, {A_BEH_ISOL}},
+    {"pair", BEH BEH, 2, {A_BEH_INIT, A_BEH_FINA}},
+    {"medial", BEH BEH BEH BEH, 4, {A_BEH_INIT, A_BEH_MEDI, A_BEH_MEDI, A_BEH_FINA}},
+    // alef joins to the right only, the beh after it starts again
+    {"right joining", BEH ALEF BEH BEH, 4, {A_BEH_INIT, A_ALEF_FINA, A_BEH_INIT, A_BEH_FINA}},
+    {"right joining alone", ALEF BEH, 2, {A_ALEF, A_BEH_ISOL}},
+    {"non joining", BEH HAMZA BEH, 3, {A_BEH_ISOL, A_HAMZA, A_BEH_ISOL}},
+    {"space", BEH " " BEH, 3, {A_BEH_ISOL, A_SPACE, A_BEH_ISOL}},
+    // join causing characters join on both sides without changing form
+    {"tatweel", BEH TATWEEL BEH, 3, {A_BEH_INIT, A_TATWEEL, A_BEH_FINA}},
+    {"zwj", BEH ZWJ, 2, {A_BEH_INIT, A_ZWJ}},
+    // marks are skipped over, the ones after the last letter too
+    {"marks", BEH FATHA BEH FATHA FATHA BEH FATHA, 7,
+        {A_BEH_INIT, A_FATHA, A_BEH_MEDI, A_FATHA, A_FATHA, A_BEH_FINA, A_FATHA}},
+    {"leading mark", FATHA BEH, 2, {A_FATHA, A_BEH_ISOL}},
+    {"new letter", BEHV BEH, 2, {A_BEHV_INIT, A_BEH_FINA}},
+};
+
+// Shapes right to left and checks the glyphs in logical order.
+static int shape_is(hz_shaper_t *shaper, hz_font_data_t *font_data, const char *text, size_t count,
+                    const hz_index_t *glyphs) {
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    hz_shape_sz1(shaper, font_data, HZ_ENCODING_UTF8, text, &buffer);
+
+    int ok = buffer.glyph_count == count;
+    for (size_t i = 0; ok && i < count; ++i)
+        ok &= buffer.glyph_indices[count - 1 - i] == glyphs[i];
+
+    hz_buffer_release(&buffer);
+    return ok;
+}
+
+static void run_joining_test(hz_shaper_t *shaper, hz_font_data_t *font_data, const joining_test_t *test) {
+    if (!HZ_TEST_CHECK(shape_is(shaper, font_data, test->text, test->glyph_count, test->glyphs)))
+        fprintf(stderr, "  in \"%s\"\n", test->name);
+}
+
+static void test_versions(hz_shaper_t *shaper, hz_font_data_t *font_data) {
+    // U+08A0 isn't assigned in 6.0 and doesn't join
+    hz_ucd_t *v6 = hz_ucd_create(HZ_MAKE_VERSION(6,0,0));
+    if (HZ_TEST_CHECK(v6 != NULL)) {
+        hz_shaper_set_ucd(shaper, v6);
+        HZ_TEST_CHECK(shape_is(shaper, font_data, BEHV BEH, 2, (hz_index_t[]){A_BEHV, A_BEH_ISOL}));
+        HZ_TEST_CHECK(shape_is(shaper, font_data, BEH BEH, 2, (hz_index_t[]){A_BEH_INIT, A_BEH_FINA}));
+        hz_shaper_set_ucd(shaper, NULL);
+        hz_ucd_destroy(v6);
+    }
+
+    HZ_TEST_CHECK(shape_is(shaper, font_data, BEHV BEH, 2, (hz_index_t[]){A_BEHV_INIT, A_BEH_FINA}));
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/HzTestArabic.ttf", argv[1]);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0))) {
+        hz_font_t *font = hz_stbtt_font_create(&info);
+        hz_font_data_t *font_data = hz_font_data_create(font);
+
+        hz_feature_t features[] = {HZ_FEATURE_ISOL, HZ_FEATURE_FINA, HZ_FEATURE_MEDI, HZ_FEATURE_INIT};
+        hz_shaper_t *shaper = hz_shaper_create();
+        hz_shaper_set_script(shaper, HZ_SCRIPT_ARABIC);
+        hz_shaper_set_language(shaper, HZ_LANGUAGE_ARABIC);
+        hz_shaper_set_direction(shaper, HZ_DIRECTION_RTL);
+        hz_shaper_set_features(shaper, HZ_ARRAY_SIZE(features), features);
+
+        for (size_t i = 0; i < HZ_ARRAY_SIZE(joining_tests); ++i)
+            run_joining_test(shaper, font_data, &joining_tests[i]);
+        test_versions(shaper, font_data);
+
+        hz_shaper_destroy(shaper);
+        hz_font_data_release(font_data);
+        hz_face_destroy(hz_font_get_face(font));
+        hz_font_destroy(font);
+    }
+
+    free(data);
+    hz_deinit();
+    return hz_test_report("joining");
+}
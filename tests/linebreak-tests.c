@@ -0,0 +1,188 @@
+// Tests of UAX #14 line breaking and of the paragraph layout built on it: break opportunities,
+// complex context and East Asian punctuation, wrapping, lines ending inside a cluster flagged unsafe
+// to break, and reshaping around such a break.
+//
+// usage: hz_linebreak_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define N HZ_LINE_BREAK_NONE
+#define A HZ_LINE_BREAK_ALLOWED
+#define M HZ_LINE_BREAK_MANDATORY
+
+// glyph ids of HzTestLayout.ttf
+enum { L_SPACE = 1, L_A, L_V, L_a };
+
+typedef struct {
+    const char *name;
+    hz_unicode_t chars[8];
+    size_t count;
+    uint8_t breaks[8];
+} break_test_t;
+
+static const break_test_t break_tests[] = {
+    {"words", {'a', 'b', ' ', 'c', ' ', ' ', 'd'}, 7, {N, N, N, A, N, N, A}},
+    {"newlines", {'a', '\r', '\n', 'b', '\n', '\n'}, 6, {N, N, N, M, N, M}},
+    {"punctuation", {'(', 'a', ')', ',', ' ', 'b', '-', 'c'}, 8, {N, N, N, N, N, A, N, A}},
+    {"numbers", {'$', '1', '.', '5', '%', ' ', 'x', '1'}, 8, {N, N, N, N, N, N, A, N}},
+    {"ideographs", {0x4E00, 0x4E8C, 0x3002, 0x4E09}, 4, {N, A, N, A}},
+    // LB30, no break before an opening parenthesis unless it's East Asian wide
+    {"parenthesis", {'a', '(', 'b', 0x3008, 'c', 0xFF08, 'd'}, 7, {N, N, N, A, N, A, N}},
+    // Thai words are not broken, SA marks attach to what comes before them like any other mark
+    {"complex context", {0x0E01, 0x0E32, 0x0E23, ' ', 0x0E01, 0x0E34}, 6, {N, N, N, N, A, N}},
+    {"complex context mark", {')', 0x0E34, 'a'}, 3, {N, N, N}},
+    {"regional indicators", {0x1F1EB, 0x1F1F7, 0x1F1E9, 0x1F1EA}, 4, {N, N, A, N}},
+    {"zero width space", {'a', 0x200B, 'b', 0x2060, 'c'}, 5, {N, N, A, N, N}},
+};
+
+static void run_break_test(const break_test_t *test) {
+    uint8_t breaks[8];
+    hz_find_line_breaks(NULL, test->chars, test->count, breaks);
+    if (!HZ_TEST_CHECK(!memcmp(breaks, test->breaks, test->count)))
+        fprintf(stderr, "  in \"%s\"\n", test->name);
+}
+
+static void test_layout(hz_context_t *ctx, uint16_t font_id) {
+    // "AV AV AV" with the advances of the font
+    hz_unicode_t codepoints[8] = {'A', 'V', ' ', 'A', 'V', ' ', 'A', 'V'};
+    hz_index_t glyphs[8] = {L_A, L_V, L_SPACE, L_A, L_V, L_SPACE, L_A, L_V};
+    hz_glyph_metrics_t metrics[8];
+    uint8_t flags[8] = {0};
+    for (int i = 0; i < 8; ++i)
+        metrics[i] = (hz_glyph_metrics_t){glyphs[i] == L_SPACE ? 250 : 600, 0, 0, 0};
+
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    buffer.glyph_count = 8;
+    buffer.codepoints = codepoints;
+    buffer.glyph_indices = glyphs;
+    buffer.glyph_metrics = metrics;
+    buffer.glyph_flags = flags;
+    buffer.attrib_flags = HZ_GLYPH_ATTRIB_FLAGS_BIT;
+
+    hz_buffer_style_t style = {0};
+    hz_layout_item_t item = {&buffer, font_id, 20.0f, HZ_DIRECTION_LTR, &style, 0};
+
+    hz_line_layout_t layout;
+    hz_line_layout_init(&layout, HZ_DIRECTION_LTR, 0, 0.0f, 0.0f, 0.0f);
+    hz_line_layout_build(ctx, &layout, &item, 1);
+    HZ_TEST_CHECK(hz_vector_size(layout.lines) == 1);
+
+    // two words fit on a line, the space after them hangs
+    float two_words = layout.pos[5];
+    layout.flags = HZ_LAYOUT_WRAP;
+    layout.max_length = two_words + 1.0f;
+    hz_line_layout_build(ctx, &layout, &item, 1);
+    HZ_TEST_CHECK(hz_vector_size(layout.lines) == 2);
+    if (hz_vector_size(layout.lines) == 2) {
+        HZ_TEST_CHECK(layout.lines[0].first_char == 0 && layout.lines[0].char_count == 6);
+        HZ_TEST_CHECK(layout.lines[0].width == two_words);
+        HZ_TEST_CHECK(layout.lines[1].first_char == 6 && layout.lines[1].char_count == 2);
+        HZ_TEST_CHECK(!layout.lines[0].unsafe_break && !layout.lines[1].unsafe_break);
+    }
+
+    // a line starting inside a cluster the shaping flagged
+    flags[6] = HZ_GLYPH_FLAG_UNSAFE_TO_BREAK;
+    hz_line_layout_build(ctx, &layout, &item, 1);
+    HZ_TEST_CHECK(hz_vector_size(layout.lines) == 2 && layout.lines[0].unsafe_break);
+
+    // the same with the item shaped right to left, glyphs in visual order
+    hz_unicode_t rtl_codepoints[8];
+    hz_index_t rtl_glyphs[8];
+    uint8_t rtl_flags[8];
+    for (int i = 0; i < 8; ++i) {
+        rtl_codepoints[i] = codepoints[7 - i];
+        rtl_glyphs[i] = glyphs[7 - i];
+        rtl_flags[i] = flags[7 - i];
+    }
+    buffer.codepoints = rtl_codepoints;
+    buffer.glyph_indices = rtl_glyphs;
+    buffer.glyph_flags = rtl_flags;
+    item.dir = HZ_DIRECTION_RTL;
+    hz_line_layout_build(ctx, &layout, &item, 1);
+    HZ_TEST_CHECK(hz_vector_size(layout.lines) == 2 && layout.lines[0].unsafe_break);
+
+    hz_line_layout_release(&layout);
+}
+
+static void test_reshape_line_break(hz_font_data_t *font_data) {
+    hz_shaper_t *shaper = hz_shaper_create();
+    hz_feature_t features[] = {HZ_FEATURE_KERN};
+    hz_shaper_set_script(shaper, HZ_SCRIPT_LATIN);
+    hz_shaper_set_language(shaper, HZ_LANGUAGE_ENGLISH);
+    hz_shaper_set_direction(shaper, HZ_DIRECTION_LTR);
+    hz_shaper_set_features(shaper, 1, features);
+
+    // V is kerned with the a after it
+    hz_shaped_text_t text;
+    hz_shaped_text_init(&text);
+    hz_shape_text(shaper, font_data, HZ_ENCODING_UTF8, "AAVa", &text);
+    HZ_TEST_CHECK(text.buffer.glyph_count == 4 && text.buffer.glyph_metrics[2].xAdvance == 560);
+
+    // split between V and a, each side is shaped without the other
+    hz_line_break_reshape_t r;
+    hz_buffer_init(&r.before);
+    hz_buffer_init(&r.after);
+    hz_reshape_line_break(shaper, font_data, &text, 3, &r);
+    HZ_TEST_CHECK(r.first_char <= 2 && r.end_char == 4);
+    HZ_TEST_CHECK(r.before.glyph_count == 3 - r.first_char && r.after.glyph_count == 1);
+    if (r.before.glyph_count && r.after.glyph_count) {
+        size_t v = r.before.glyph_count - 1;
+        HZ_TEST_CHECK(r.before.glyph_indices[v] == L_V && r.before.glyph_metrics[v].xAdvance == 600);
+        HZ_TEST_CHECK(r.before.clusters[v] == 2 && r.after.clusters[0] == 3);
+        HZ_TEST_CHECK(r.after.glyph_indices[0] == L_a);
+    }
+
+    // the text itself is unchanged
+    HZ_TEST_CHECK(text.buffer.glyph_count == 4 && text.buffer.glyph_metrics[2].xAdvance == 560);
+
+    hz_buffer_release(&r.before);
+    hz_buffer_release(&r.after);
+    hz_shaped_text_release(&text);
+    hz_shaper_destroy(shaper);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(break_tests); ++i)
+        run_break_test(&break_tests[i]);
+
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/HzTestLayout.ttf", argv[1]);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0))) {
+        hz_font_t *font = hz_stbtt_font_create(&info);
+        hz_font_data_t *font_data = hz_font_data_create(font);
+
+        hz_glyph_cache_opts_t opts = {0};
+        opts.width = opts.height = 64;
+        opts.x_cells = opts.y_cells = 4;
+        hz_context_t *ctx = hz_context_create(&opts);
+        if (HZ_TEST_CHECK(ctx != NULL)) {
+            test_layout(ctx, hz_context_stash_font(ctx, font_data));
+            hz_context_release(ctx);
+        }
+
+        test_reshape_line_break(font_data);
+        hz_font_data_release(font_data);
+        hz_face_destroy(hz_font_get_face(font));
+        hz_font_destroy(font);
+    }
+
+    free(data);
+    hz_deinit();
+    return hz_test_report("line break");
+}
@@ -0,0 +1,191 @@
+// Tests of Unicode normalization (UAX #15): cases in the format of NormalizationTest.txt checked
+// against its conformance invariants, normalization invariants over every code point, and text
+// passing the quick check being left as is.
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define MAX_CHARS 24 // more than the 18 of U+FDFA, the longest decomposition
+
+// The columns of NormalizationTest.txt, zero terminated: source, NFC, NFD, NFKC and NFKD.
+typedef struct {
+    const char *name;
+    hz_unicode_t c[5][MAX_CHARS];
+} normalization_test_t;
+
+static const normalization_test_t normalization_tests[] = {
+    {"composition", {{0x0041, 0x0301}, {0x00C1}, {0x0041, 0x0301}, {0x00C1}, {0x0041, 0x0301}}},
+    // a singleton decomposition, excluded from composition
+    {"singleton", {{0x212B}, {0x00C5}, {0x0041, 0x030A}, {0x00C5}, {0x0041, 0x030A}}},
+    {"reordering", {
+        {0x1E0B, 0x0323},
+        {0x1E0D, 0x0307},
+        {0x0064, 0x0323, 0x0307},
+        {0x1E0D, 0x0307},
+        {0x0064, 0x0323, 0x0307},
+    }},
+    {"reordering, no composite", {
+        {0x0071, 0x0307, 0x0323},
+        {0x0071, 0x0323, 0x0307},
+        {0x0071, 0x0323, 0x0307},
+        {0x0071, 0x0323, 0x0307},
+        {0x0071, 0x0323, 0x0307},
+    }},
+    // the example of UAX #15
+    {"long s", {{0x1E9B, 0x0323}, {0x1E9B, 0x0323}, {0x017F, 0x0323, 0x0307}, {0x1E69}, {0x0073, 0x0323, 0x0307}}},
+    // a mark of the same class in between blocks the composition
+    {"blocked", {
+        {0x0061, 0x0305, 0x0301},
+        {0x0061, 0x0305, 0x0301},
+        {0x0061, 0x0305, 0x0301},
+        {0x0061, 0x0305, 0x0301},
+        {0x0061, 0x0305, 0x0301},
+    }},
+    {"exclusion", {{0x0958}, {0x0915, 0x093C}, {0x0915, 0x093C}, {0x0915, 0x093C}, {0x0915, 0x093C}}},
+    {"two starters", {{0x0B47, 0x0B3E}, {0x0B4B}, {0x0B47, 0x0B3E}, {0x0B4B}, {0x0B47, 0x0B3E}}},
+    {"hangul lv", {{0xAC00}, {0xAC00}, {0x1100, 0x1161}, {0xAC00}, {0x1100, 0x1161}}},
+    {"hangul jamo", {{0x1100, 0x1161, 0x11A8}, {0xAC01}, {0x1100, 0x1161, 0x11A8}, {0xAC01}, {0x1100, 0x1161, 0x11A8}}},
+    {"hangul lv and t", {{0xAC00, 0x11A8}, {0xAC01}, {0x1100, 0x1161, 0x11A8}, {0xAC01}, {0x1100, 0x1161, 0x11A8}}},
+    {"ligature", {{0xFB01}, {0xFB01}, {0xFB01}, {0x0066, 0x0069}, {0x0066, 0x0069}}},
+    {"superscript", {{0x0078, 0x2075}, {0x0078, 0x2075}, {0x0078, 0x2075}, {0x0078, 0x0035}, {0x0078, 0x0035}}},
+    {"supplementary", {{0x1D15E}, {0x1D157, 0x1D165}, {0x1D157, 0x1D165}, {0x1D157, 0x1D165}, {0x1D157, 0x1D165}}},
+    {"after ascii", {
+        {0x0061, 0x0062, 0x0063, 0x00E9, 0x0064, 0x0065, 0x0301, 0x0066},
+        {0x0061, 0x0062, 0x0063, 0x00E9, 0x0064, 0x00E9, 0x0066},
+        {0x0061, 0x0062, 0x0063, 0x0065, 0x0301, 0x0064, 0x0065, 0x0301, 0x0066},
+        {0x0061, 0x0062, 0x0063, 0x00E9, 0x0064, 0x00E9, 0x0066},
+        {0x0061, 0x0062, 0x0063, 0x0065, 0x0301, 0x0064, 0x0065, 0x0301, 0x0066},
+    }},
+    {"long segment", {
+        {0x0061, 0x0301, 0x0316, 0x0301, 0x0316, 0x0301, 0x0316, 0x0301, 0x0316, 0x0301, 0x0316, 0x0301, 0x0316},
+        {0x00E1, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301},
+        {0x0061, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301},
+        {0x00E1, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301},
+        {0x0061, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301},
+    }},
+};
+
+static size_t chars_length(const hz_unicode_t *chars) {
+    size_t n = 0;
+    while (n < MAX_CHARS && chars[n]) ++n;
+    return n;
+}
+
+// Checks that normalizing chars to nf gives expected.
+static int normalizes_to(const hz_unicode_t *chars, size_t count, hz_normalization_form_t nf,
+                         const hz_unicode_t *expected, size_t expected_count) {
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    hz_vector_push_many(buffer.codepoints, chars, count);
+    HzBuffero_nf(&buffer, nf);
+
+    int ok = hz_vector_size(buffer.codepoints) == expected_count
+        && !memcmp(buffer.codepoints, expected, expected_count * sizeof(hz_unicode_t));
+    hz_buffer_release(&buffer);
+    return ok;
+}
+
+static void run_normalization_test(const normalization_test_t *test) {
+    size_t n[5];
+    for (int i = 0; i < 5; ++i)
+        n[i] = chars_length(test->c[i]);
+
+    // c2 == toNFC(c1..c3), c4 == toNFC(c4..c5), c3 == toNFD(c1..c3), c5 == toNFD(c4..c5),
+    // c4 == toNFKC(c1..c5) and c5 == toNFKD(c1..c5)
+    int ok = 1;
+    for (int i = 0; i < 5; ++i) {
+        int canonical = i < 3 ? 1 : 3;
+        ok &= normalizes_to(test->c[i], n[i], HZ_NFC, test->c[canonical], n[canonical]);
+        ok &= normalizes_to(test->c[i], n[i], HZ_NFD, test->c[canonical + 1], n[canonical + 1]);
+        ok &= normalizes_to(test->c[i], n[i], HZ_NFKC, test->c[3], n[3]);
+        ok &= normalizes_to(test->c[i], n[i], HZ_NFKD, test->c[4], n[4]);
+    }
+
+    if (!HZ_TEST_CHECK(ok))
+        fprintf(stderr, "  in \"%s\"\n", test->name);
+}
+
+// Normalizes chars to nf into out, which has room for MAX_CHARS characters, returns the length.
+static size_t normalize(const hz_unicode_t *chars, size_t count, hz_normalization_form_t nf, hz_unicode_t *out) {
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    hz_vector_push_many(buffer.codepoints, chars, count);
+    HzBuffero_nf(&buffer, nf);
+
+    size_t n = hz_vector_size(buffer.codepoints);
+    memcpy(out, buffer.codepoints, HZ_MIN(n, MAX_CHARS) * sizeof(hz_unicode_t));
+    hz_buffer_release(&buffer);
+    return n;
+}
+
+static void test_every_code_point(void) {
+    // each form is stable, and composing the decomposed form gives the composed one
+    size_t failures = 0;
+    for (hz_unicode_t c = 0; c <= 0x10FFFF; ++c) {
+        if (c >= 0xD800 && c <= 0xDFFF) continue;
+
+        hz_unicode_t nfd[MAX_CHARS], nfkd[MAX_CHARS], nfc[MAX_CHARS], nfkc[MAX_CHARS], again[MAX_CHARS];
+        size_t nfd_n = normalize(&c, 1, HZ_NFD, nfd), nfkd_n = normalize(&c, 1, HZ_NFKD, nfkd);
+        size_t nfc_n = normalize(&c, 1, HZ_NFC, nfc), nfkc_n = normalize(&c, 1, HZ_NFKC, nfkc);
+        if (nfd_n > MAX_CHARS || nfkd_n > MAX_CHARS || nfc_n > MAX_CHARS || nfkc_n > MAX_CHARS) {
+            ++failures;
+            continue;
+        }
+
+        int ok = normalize(nfd, nfd_n, HZ_NFD, again) == nfd_n && !memcmp(again, nfd, nfd_n * sizeof c);
+        ok &= normalize(nfkd, nfkd_n, HZ_NFKD, again) == nfkd_n && !memcmp(again, nfkd, nfkd_n * sizeof c);
+        ok &= normalize(nfd, nfd_n, HZ_NFC, again) == nfc_n && !memcmp(again, nfc, nfc_n * sizeof c);
+        ok &= normalize(nfkd, nfkd_n, HZ_NFKC, again) == nfkc_n && !memcmp(again, nfkc, nfkc_n * sizeof c);
+        ok &= normalize(nfc, nfc_n, HZ_NFD, again) == nfd_n && !memcmp(again, nfd, nfd_n * sizeof c);
+        if (!ok) {
+            if (failures < 8) fprintf(stderr, "  at U+%04X\n", c);
+            ++failures;
+        }
+    }
+
+    HZ_TEST_CHECK(failures == 0);
+}
+
+static void test_quick_check(void) {
+    // normalized text isn't copied
+    const hz_unicode_t text[] = {'a', 0x00E9, ' ', 0x4E00, 0xAC00};
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    hz_vector_push_many(buffer.codepoints, text, 5);
+    hz_unicode_t *before = buffer.codepoints;
+    HzBuffero_nfc(&buffer);
+    HZ_TEST_CHECK(buffer.codepoints == before && hz_vector_size(buffer.codepoints) == 5);
+    HZ_TEST_CHECK(!memcmp(buffer.codepoints, text, sizeof text));
+    hz_buffer_release(&buffer);
+
+    // longer than a vector of the fast path, the decomposable character is past it
+    hz_unicode_t long_text[20];
+    for (int i = 0; i < 20; ++i) long_text[i] = 'a' + i;
+    long_text[17] = 0x212B;
+    hz_unicode_t expected[20];
+    memcpy(expected, long_text, sizeof long_text);
+    expected[17] = 0x00C5;
+    HZ_TEST_CHECK(normalizes_to(long_text, 20, HZ_NFC, expected, 20));
+
+    // and empty text
+    hz_buffer_init(&buffer);
+    HzBuffero_nfd(&buffer);
+    HZ_TEST_CHECK(hz_vector_size(buffer.codepoints) == 0);
+    hz_buffer_release(&buffer);
+}
+
+int main(void) {
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(normalization_tests); ++i)
+        run_normalization_test(&normalization_tests[i]);
+    test_every_code_point();
+    test_quick_check();
+
+    hz_deinit();
+    return hz_test_report("normalization");
+}
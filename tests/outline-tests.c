@@ -0,0 +1,155 @@
+// Tests of glyph outlines: the scale and translation applied on output, fetching a batch of
+// glyphs at once gives the same curves as fetching them one by one, the result doesn't depend
+// on what the outline cache holds, and composite glyphs are placed like the glyf spec says.
+//
+// usage: hz_outline_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+// glyph ids of HzTestLayout.ttf, A and V are 300x500 rectangles, a 250x500
+enum { L_SPACE = 1, L_A, L_V, L_a };
+// glyph ids of HzTestGlyf.ttf
+enum { G_BOX = 1, G_DOT, G_BOXDOT, G_OUTER };
+
+static int vec2_eq(hz_vec2 a, float x, float y) {
+    return a.x == x && a.y == y;
+}
+
+static int draw_data_equal(const hz_shape_draw_data_t *a, const hz_shape_draw_data_t *b) {
+    size_t vert_count = hz_vector_size(a->verts), contour_count = hz_vector_size(a->contours);
+    return vert_count == hz_vector_size(b->verts) && contour_count == hz_vector_size(b->contours)
+        && !memcmp(a->verts, b->verts, sizeof(*a->verts) * vert_count)
+        && !memcmp(a->contours, b->contours, sizeof(*a->contours) * contour_count);
+}
+
+static void test_transform(hz_face_t *face) {
+    hz_shape_draw_data_t dd = {0};
+    hz_face_get_glyph_shape(face, &dd, (hz_vec2){10.0f, 20.0f}, 0.5f, L_A);
+
+    HZ_TEST_CHECK(hz_vector_size(dd.contours) == 1 && hz_vector_size(dd.verts) == 4);
+    if (hz_vector_size(dd.verts) == 4) {
+        HZ_TEST_CHECK(dd.contours[0].first_curve == 0 && dd.contours[0].curve_count == 4);
+        HZ_TEST_CHECK(vec2_eq(dd.contours[0].origin, 10.0f, 20.0f));
+
+        // the corners of the 300x500 rectangle, halved and moved
+        float min_x = 1e9f, min_y = 1e9f, max_x = -1e9f, max_y = -1e9f;
+        int lines = 1;
+        for (int i = 0; i < 4; ++i) {
+            hz_vec2 p = dd.verts[i].v2;
+            min_x = p.x < min_x ? p.x : min_x; max_x = p.x > max_x ? p.x : max_x;
+            min_y = p.y < min_y ? p.y : min_y; max_y = p.y > max_y ? p.y : max_y;
+            lines &= dd.verts[i].type == HZ_VERTEX_TYPE_LINE;
+            if (i) lines &= vec2_eq(dd.verts[i].v1, dd.verts[i - 1].v2.x, dd.verts[i - 1].v2.y);
+        }
+
+        HZ_TEST_CHECK(lines);
+        HZ_TEST_CHECK(min_x == 10.0f && min_y == 20.0f && max_x == 160.0f && max_y == 270.0f);
+    }
+
+    hz_shape_draw_data_clear(&dd);
+}
+
+static void test_batch(hz_face_t *face) {
+    hz_glyph_shape_request_t reqs[4] = {
+        {L_A, {0.0f, 0.0f}, 1.0f},
+        {L_V, {100.0f, 0.0f}, 0.25f},
+        {L_a, {0.0f, 0.0f}, 1.0f},
+        {L_A, {-5.0f, 7.0f}, 2.0f},
+    };
+
+    hz_shape_draw_data_t one = {0}, batch = {0}, uncached = {0};
+    for (int i = 0; i < 4; ++i)
+        hz_face_get_glyph_shape(face, &one, reqs[i].translate, reqs[i].scale, reqs[i].glyph);
+
+    hz_face_get_glyph_shapes(face, &batch, reqs, 4);
+    HZ_TEST_CHECK(draw_data_equal(&one, &batch));
+    HZ_TEST_CHECK(reqs[0].first_contour == 0 && reqs[0].contour_count == 1);
+    HZ_TEST_CHECK(reqs[1].first_contour == 1 && reqs[1].contour_count == 1);
+    HZ_TEST_CHECK(reqs[2].first_contour == 2 && reqs[2].contour_count == 1);
+    HZ_TEST_CHECK(reqs[3].first_contour == 3 && reqs[3].contour_count == 1);
+
+    // a cache holding only the last outline decodes the others again, to the same curves
+    hz_face_set_outline_cache_size(face, 0);
+    hz_face_get_glyph_shapes(face, &uncached, reqs, 4);
+    HZ_TEST_CHECK(draw_data_equal(&one, &uncached));
+
+    hz_shape_draw_data_t *all[] = {&one, &batch, &uncached};
+    for (int i = 0; i < 3; ++i)
+        hz_shape_draw_data_clear(all[i]);
+}
+
+// Checks that contour `contour` of the glyph spans the box (x0,y0)-(x1,y1).
+static int contour_box_is(const hz_shape_draw_data_t *dd, size_t contour, float x0, float y0, float x1, float y1) {
+    if (contour >= hz_vector_size(dd->contours)) return 0;
+
+    const hz_contour_t *c = &dd->contours[contour];
+    float min_x = c->origin.x, min_y = c->origin.y, max_x = c->origin.x, max_y = c->origin.y;
+    for (uint32_t i = c->first_curve; i < c->first_curve + c->curve_count; ++i) {
+        hz_vec2 p = dd->verts[i].v2;
+        min_x = p.x < min_x ? p.x : min_x; max_x = p.x > max_x ? p.x : max_x;
+        min_y = p.y < min_y ? p.y : min_y; max_y = p.y > max_y ? p.y : max_y;
+    }
+
+    return min_x == x0 && min_y == y0 && max_x == x1 && max_y == y1;
+}
+
+static void test_composites(hz_face_t *face) {
+    hz_shape_draw_data_t dd = {0};
+
+    // the dot is moved so its first point lands on the third point of the box
+    hz_face_get_glyph_shape(face, &dd, (hz_vec2){0.0f, 0.0f}, 1.0f, G_BOXDOT);
+    HZ_TEST_CHECK(hz_vector_size(dd.contours) == 2);
+    HZ_TEST_CHECK(contour_box_is(&dd, 0, 0.0f, 0.0f, 100.0f, 100.0f));
+    HZ_TEST_CHECK(contour_box_is(&dd, 1, 100.0f, 100.0f, 110.0f, 110.0f));
+    hz_shape_draw_data_clear(&dd);
+
+    // nested after another component, boxdot matches points with its own box and is then moved up
+    hz_face_get_glyph_shape(face, &dd, (hz_vec2){0.0f, 0.0f}, 1.0f, G_OUTER);
+    HZ_TEST_CHECK(hz_vector_size(dd.contours) == 3);
+    HZ_TEST_CHECK(contour_box_is(&dd, 0, 500.0f, 0.0f, 600.0f, 100.0f));
+    HZ_TEST_CHECK(contour_box_is(&dd, 1, 0.0f, 200.0f, 100.0f, 300.0f));
+    HZ_TEST_CHECK(contour_box_is(&dd, 2, 100.0f, 300.0f, 110.0f, 310.0f));
+    hz_shape_draw_data_clear(&dd);
+}
+
+static void run_font_tests(const char *fonts_dir, const char *name, void (*tests)(hz_face_t *)) {
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/%s", fonts_dir, name);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0))) {
+        hz_font_t *font = hz_stbtt_font_create(&info);
+        hz_face_t *face = hz_font_get_face(font);
+        tests(face);
+        hz_face_destroy(face);
+        hz_font_destroy(font);
+    }
+
+    free(data);
+}
+
+static void layout_font_tests(hz_face_t *face) {
+    test_transform(face);
+    test_batch(face);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    run_font_tests(argv[1], "HzTestLayout.ttf", layout_font_tests);
+    run_font_tests(argv[1], "HzTestGlyf.ttf", test_composites);
+
+    hz_deinit();
+    return hz_test_report("outline");
+}
@@ -0,0 +1,189 @@
+// Tests of incremental reshaping: every edit applied with hz_reshape_edit gives the same glyphs as
+// shaping the edited text from scratch, including edits whose effect reaches as far as the font's
+// maximum context, and glyphs are all flagged unsafe to break when they can't be tracked. Shaping again
+// reuses the shaper's scratch.
+//
+// usage: hz_reshape_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+// glyph ids of HzTestLayout.ttf
+enum { L_SPACE = 1, L_A, L_V, L_a, L_k, L_l, L_ACUTE, L_GRAVE };
+
+typedef struct {
+    const char *name;
+    const char *text;
+    size_t offset, deleted;
+    const char *inserted;
+    const char *result; // text after the edit, shaped from scratch to compare
+} edit_test_t;
+
+static const edit_test_t edit_tests[] = {
+    {"insert", "AV Va", 2, 0, "a", "AVa Va"},
+    {"delete", "AVa kl", 2, 1, NULL, "AV kl"},
+    {"replace", "VAka", 1, 2, "Va", "VVaa"},
+    // A is narrowed by a rule looking three glyphs ahead, to the k replacing l
+    {"max context", "AVal", 3, 1, "k", "AVak"},
+    {"max context, removed", "AVak", 3, 1, "l", "AVal"},
+    // marks don't count as context, and are reshaped with their base
+    {"marks", "Al\xcc\x81k", 3, 1, "a", "Al\xcc\x81" "a"},
+    {"insert mark", "AVak", 1, 0, "\xcc\x80", "A\xcc\x80Vak"},
+    {"start", "Vak", 0, 0, "A", "AVak"},
+    {"end", "AV", 2, 0, "ak", "AVak"},
+    {"everything", "AV", 0, 2, "kk", "kk"},
+};
+
+static int buffers_equal(const hz_buffer_t *a, const hz_buffer_t *b) {
+    if (a->glyph_count != b->glyph_count) return 0;
+
+    for (size_t i = 0; i < a->glyph_count; ++i) {
+        if (a->glyph_indices[i] != b->glyph_indices[i] || a->clusters[i] != b->clusters[i]
+            || memcmp(&a->glyph_metrics[i], &b->glyph_metrics[i], sizeof a->glyph_metrics[i]))
+            return 0;
+    }
+
+    return 1;
+}
+
+static void run_edit_test(hz_shaper_t *shaper, hz_font_data_t *font_data, const edit_test_t *test) {
+    hz_shaped_text_t edited, expected;
+    hz_shaped_text_init(&edited);
+    hz_shaped_text_init(&expected);
+
+    hz_shape_text(shaper, font_data, HZ_ENCODING_UTF8, test->text, &edited);
+    hz_reshape_edit(shaper, font_data, &edited, test->offset, test->deleted, HZ_ENCODING_UTF8, test->inserted);
+    hz_shape_text(shaper, font_data, HZ_ENCODING_UTF8, test->result, &expected);
+
+    int ok = hz_vector_size(edited.chars) == hz_vector_size(expected.chars)
+        && !memcmp(edited.chars, expected.chars, hz_vector_size(edited.chars) * sizeof(hz_unicode_t))
+        && buffers_equal(&edited.buffer, &expected.buffer);
+    if (!HZ_TEST_CHECK(ok))
+        fprintf(stderr, "  in \"%s\"\n", test->name);
+
+    hz_shaped_text_release(&edited);
+    hz_shaped_text_release(&expected);
+}
+
+// Fails allocations of fail_size bytes, like the per character scratch of a text that long.
+static size_t fail_size = 0;
+
+static void *test_allocator_fn(void *user, hz_allocator_cmd_t cmd, void *ptr, size_t size, size_t align) {
+    (void)user; (void)align;
+    switch (cmd) {
+        case HZ_CMD_ALLOC: return size == fail_size ? NULL : malloc(size);
+        case HZ_CMD_REALLOC: return realloc(ptr, size);
+        case HZ_CMD_FREE: free(ptr); return NULL;
+        default: return NULL;
+    }
+}
+
+static void test_untracked(hz_shaper_t *shaper, hz_font_data_t *font_data) {
+    const char *s = "AVak kk VVa Akl";
+    hz_shaped_text_t text;
+    hz_shaped_text_init(&text);
+
+    fail_size = strlen(s);
+    hz_shape_text(shaper, font_data, HZ_ENCODING_UTF8, s, &text);
+    fail_size = 0;
+
+    int all_unsafe = text.buffer.glyph_count == strlen(s);
+    for (size_t i = 0; i < text.buffer.glyph_count; ++i)
+        all_unsafe &= (text.buffer.glyph_flags[i] & HZ_GLYPH_FLAG_UNSAFE_TO_BREAK) != 0;
+    HZ_TEST_CHECK(all_unsafe);
+
+    // edits are still right, they reshape everything
+    hz_reshape_edit(shaper, font_data, &text, 5, 2, HZ_ENCODING_UTF8, "Va");
+    hz_shaped_text_t expected;
+    hz_shaped_text_init(&expected);
+    hz_shape_text(shaper, font_data, HZ_ENCODING_UTF8, "AVak Va VVa Akl", &expected);
+    HZ_TEST_CHECK(buffers_equal(&text.buffer, &expected.buffer));
+
+    hz_shaped_text_release(&text);
+    hz_shaped_text_release(&expected);
+}
+
+static hz_shaper_t *create_shaper(void) {
+    hz_shaper_t *shaper = hz_shaper_create();
+    hz_feature_t features[] = {HZ_FEATURE_KERN, HZ_FEATURE_MARK};
+    hz_shaper_set_script(shaper, HZ_SCRIPT_LATIN);
+    hz_shaper_set_language(shaper, HZ_LANGUAGE_ENGLISH);
+    hz_shaper_set_direction(shaper, HZ_DIRECTION_LTR);
+    hz_shaper_set_features(shaper, 2, features);
+    return shaper;
+}
+
+static int32_t shape_first_advance(hz_shaper_t *shaper, hz_font_data_t *font_data, const char *s) {
+    hz_shaped_text_t text;
+    hz_shaped_text_init(&text);
+    hz_shape_text(shaper, font_data, HZ_ENCODING_UTF8, s, &text);
+    int32_t advance = text.buffer.glyph_count ? text.buffer.glyph_metrics[0].xAdvance : -1;
+    hz_shaped_text_release(&text);
+    return advance;
+}
+
+static void test_scratch(hz_font_data_t *font_data) {
+    hz_shaper_t *shaper = create_shaper();
+    size_t attachments_size = sizeof(int32_t) * 7 * 4; // the mark attachments of four glyphs
+
+    // without the mark attachments nothing is positioned, the A keeps its advance
+    fail_size = attachments_size;
+    HZ_TEST_CHECK(shape_first_advance(shaper, font_data, "AVak") == 600);
+    fail_size = 0;
+    HZ_TEST_CHECK(shape_first_advance(shaper, font_data, "AVak") == 550);
+
+    // the scratch is kept, as many glyphs again don't allocate it
+    fail_size = attachments_size;
+    HZ_TEST_CHECK(shape_first_advance(shaper, font_data, "AVak") == 550);
+    HZ_TEST_CHECK(shape_first_advance(shaper, font_data, "Va") == 560);
+    fail_size = 0;
+
+    hz_shaper_destroy(shaper);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+    hz_set_allocator_fn(test_allocator_fn);
+
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/HzTestLayout.ttf", argv[1]);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0))) {
+        hz_font_t *font = hz_stbtt_font_create(&info);
+        hz_font_data_t *font_data = hz_font_data_create(font);
+
+        hz_shaper_t *shaper = create_shaper();
+
+        // the rule reaching three glyphs ahead applies
+        hz_shaped_text_t text;
+        hz_shaped_text_init(&text);
+        hz_shape_text(shaper, font_data, HZ_ENCODING_UTF8, "AVak", &text);
+        HZ_TEST_CHECK(text.buffer.glyph_count == 4 && text.buffer.glyph_metrics[0].xAdvance == 550);
+        hz_shaped_text_release(&text);
+
+        for (size_t i = 0; i < HZ_ARRAY_SIZE(edit_tests); ++i)
+            run_edit_test(shaper, font_data, &edit_tests[i]);
+        test_untracked(shaper, font_data);
+        test_scratch(font_data);
+
+        hz_shaper_destroy(shaper);
+        hz_font_data_release(font_data);
+        hz_face_destroy(hz_font_get_face(font));
+        hz_font_destroy(font);
+    }
+
+    free(data);
+    hz_deinit();
+    return hz_test_report("reshape");
+}
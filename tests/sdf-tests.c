@@ -0,0 +1,102 @@
+// Tests of the CPU SDF rasterizer: a glyph rendered alone and in a batch gives the same cell, and
+// a batch reports the error of each job and returns the first one.
+//
+// usage: hz_sdf_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define ATLAS_SIZE 64
+#define CELL_SIZE 32
+
+// glyph ids of HzTestLayout.ttf, A and V are 300x500 rectangles
+enum { L_SPACE = 1, L_A, L_V };
+
+static int failing_allocs = 0;
+
+static void *test_allocator_fn(void *user, hz_allocator_cmd_t cmd, void *ptr, size_t size, size_t align) {
+    (void)user; (void)align;
+    switch (cmd) {
+        case HZ_CMD_ALLOC: return failing_allocs ? NULL : malloc(size);
+        case HZ_CMD_REALLOC: return failing_allocs ? NULL : realloc(ptr, size);
+        case HZ_CMD_FREE: free(ptr); return NULL;
+        default: return NULL;
+    }
+}
+
+static uint8_t pixel(const hz_bitmap_t *atlas, hz_rect_t cell, int x, int y) {
+    return atlas->data[(size_t)(cell.y + y) * atlas->stride + cell.x + x];
+}
+
+static int cells_equal(const hz_bitmap_t *a, const hz_bitmap_t *b, hz_rect_t cell) {
+    for (int y = 0; y < cell.h; ++y)
+        if (memcmp(&a->data[(size_t)(cell.y + y) * a->stride + cell.x],
+                   &b->data[(size_t)(cell.y + y) * b->stride + cell.x], cell.w))
+            return 0;
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+    hz_set_allocator_fn(test_allocator_fn);
+
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/HzTestLayout.ttf", argv[1]);
+    char *data = hz_test_read_file(path, &size);
+    stbtt_fontinfo info;
+    if (!HZ_TEST_CHECK(data != NULL && stbtt_InitFont(&info, (const unsigned char *)data, 0)))
+        return hz_test_report("sdf");
+
+    hz_font_t *font = hz_stbtt_font_create(&info);
+    hz_face_t *face = hz_font_get_face(font);
+
+    hz_glyph_cache_opts_t opts = {0};
+    opts.width = opts.height = ATLAS_SIZE;
+    opts.x_cells = opts.y_cells = ATLAS_SIZE / CELL_SIZE;
+    opts.padd = 2.0f;
+    opts.max_sdf_distance = 4.0f;
+
+    static uint8_t single_data[ATLAS_SIZE * ATLAS_SIZE], batch_data[ATLAS_SIZE * ATLAS_SIZE];
+    hz_bitmap_t single = {single_data, ATLAS_SIZE, ATLAS_SIZE, ATLAS_SIZE, 1};
+    hz_bitmap_t batch = {batch_data, ATLAS_SIZE, ATLAS_SIZE, ATLAS_SIZE, 1};
+    hz_rect_t cell_a = {0, 0, CELL_SIZE, CELL_SIZE}, cell_v = {CELL_SIZE, 0, CELL_SIZE, CELL_SIZE};
+
+    // inside of the glyph is above the 0.5 threshold, the padding below it
+    HZ_TEST_CHECK(hz_rasterize_sdf(face, L_A, cell_a, &opts, &single, NULL) == HZ_OK);
+    HZ_TEST_CHECK(pixel(&single, cell_a, CELL_SIZE / 2, CELL_SIZE / 2) > 128);
+    HZ_TEST_CHECK(pixel(&single, cell_a, 0, 0) < 128);
+    HZ_TEST_CHECK(hz_rasterize_sdf(face, L_V, cell_v, &opts, &single, NULL) == HZ_OK);
+
+    // a cell outside the atlas fails alone, the other jobs are still rendered
+    hz_sdf_job_t jobs[3] = {
+        {face, L_A, cell_a, NULL, HZ_OK},
+        {face, L_A, {ATLAS_SIZE, 0, CELL_SIZE, CELL_SIZE}, NULL, HZ_OK},
+        {face, L_V, cell_v, NULL, HZ_OK},
+    };
+    HZ_TEST_CHECK(hz_rasterize_sdf_batch(jobs, 3, &opts, &batch) == HZ_ERROR_INVALID_PARAM);
+    HZ_TEST_CHECK(jobs[0].error == HZ_OK && jobs[1].error == HZ_ERROR_INVALID_PARAM && jobs[2].error == HZ_OK);
+    HZ_TEST_CHECK(cells_equal(&single, &batch, cell_a));
+    HZ_TEST_CHECK(cells_equal(&single, &batch, cell_v));
+
+    // running out of memory fails every job
+    failing_allocs = 1;
+    HZ_TEST_CHECK(hz_rasterize_sdf_batch(jobs, 3, &opts, &batch) == HZ_ERROR_OUT_OF_MEMORY);
+    HZ_TEST_CHECK(jobs[0].error == HZ_ERROR_OUT_OF_MEMORY && jobs[2].error == HZ_ERROR_OUT_OF_MEMORY);
+    failing_allocs = 0;
+
+    hz_face_destroy(face);
+    hz_font_destroy(font);
+    free(data);
+    hz_deinit();
+    return hz_test_report("sdf");
+}
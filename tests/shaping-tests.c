@@ -0,0 +1,247 @@
+// Shapes short strings with the fonts in tests/fonts and compares the glyphs and positions against
+// expected values. The fonts are built by tests/fonts/make_test_fonts.py.
+//
+// usage: hz_shaping_tests <fonts directory> [--table-views]
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define MAX_EXPECTED_GLYPHS 8
+#define SHAPING_PASSES 2 // the second pass shapes with the variation instances already cached
+
+typedef struct {
+    hz_index_t id;
+    int32_t x_advance, x_offset, y_offset;
+} expected_glyph_t;
+
+typedef struct {
+    const char *name;
+    const char *font; // file in the fonts directory
+    const char *text;
+    hz_direction_t direction;
+    size_t feature_count;
+    hz_feature_t features[2];
+    float weight; // value of the wght axis, 0 for the default instance
+    size_t glyph_count;
+    expected_glyph_t glyphs[MAX_EXPECTED_GLYPHS];
+} shaping_test_t;
+
+typedef struct {
+    hz_index_t glyph;
+    size_t layer_count;
+    hz_color_layer_t layers[4];
+} color_test_t;
+
+#define KERN_FEATURES 1, {HZ_FEATURE_KERN}
+#define MARK_FEATURES 2, {HZ_FEATURE_MARK, HZ_FEATURE_MKMK}
+#define CURS_FEATURES 1, {HZ_FEATURE_CURS}
+#define VAR_FEATURES 2, {HZ_FEATURE_KERN, HZ_FEATURE_MARK}
+
+// glyph ids of HzTestLayout.ttf
+enum { L_SPACE = 1, L_A, L_V, L_a, L_k, L_l, L_ACUTE, L_GRAVE };
+// glyph ids of HzTestVar.ttf
+enum { V_SPACE = 1, V_A, V_V, V_a, V_a_alt, V_ACUTE };
+// glyph ids of HzTestColr.ttf
+enum { C_A = 1, C_B, C_C, C_D, C_E, C_F, C_G, C_H, C_L0, C_L1, C_L2 };
+
+static const shaping_test_t shaping_tests[] = {
+    // GPOS applied in place: pair adjustment, chained context format 1 and format 3 skipping a mark
+    {"pair", "HzTestLayout.ttf", "Va", HZ_DIRECTION_LTR, KERN_FEATURES, 0, 2,
+        {{L_V, 560, 0, 0}, {L_a, 500, 0, 0}}},
+    {"context format 1", "HzTestLayout.ttf", "VAVa", HZ_DIRECTION_LTR, KERN_FEATURES, 0, 4,
+        {{L_V, 600, 0, 0}, {L_A, 600, 0, 0}, {L_V, 560, -100, 20}, {L_a, 500, 0, 0}}},
+    {"context format 1 without lookahead", "HzTestLayout.ttf", "AV", HZ_DIRECTION_LTR, KERN_FEATURES, 0, 2,
+        {{L_A, 600, 0, 0}, {L_V, 600, 0, 0}}},
+    {"context format 3", "HzTestLayout.ttf", "Akk", HZ_DIRECTION_LTR, KERN_FEATURES, 0, 3,
+        {{L_A, 600, 0, 0}, {L_k, 530, 0, 0}, {L_k, 500, 0, 0}}},
+    {"context format 3 over a mark", "HzTestLayout.ttf", "Al\xcc\x81k", HZ_DIRECTION_LTR, KERN_FEATURES, 0, 4,
+        {{L_A, 600, 0, 0}, {L_l, 480, 0, 0}, {L_ACUTE, 0, 0, 0}, {L_k, 500, 0, 0}}},
+
+    // mark attachment, each mark stacked on the position the previous one was given
+    {"mark to base", "HzTestLayout.ttf", "a\xcc\x81", HZ_DIRECTION_LTR, MARK_FEATURES, 0, 2,
+        {{L_a, 500, 0, 0}, {L_ACUTE, 0, 250, 100}}},
+    {"mark to base, no anchor", "HzTestLayout.ttf", "k\xcc\x81", HZ_DIRECTION_LTR, MARK_FEATURES, 0, 2,
+        {{L_k, 500, 0, 0}, {L_ACUTE, 0, 0, 0}}},
+    {"mark to mark", "HzTestLayout.ttf", "a\xcc\x80\xcc\x81\xcc\x80", HZ_DIRECTION_LTR, MARK_FEATURES, 0, 4,
+        {{L_a, 500, 0, 0}, {L_GRAVE, 0, 250, 100}, {L_ACUTE, 0, 250, 400}, {L_GRAVE, 0, 250, 700}}},
+    {"mark to mark between bases", "HzTestLayout.ttf", "A\xcc\x80\xcc\x81V", HZ_DIRECTION_LTR, MARK_FEATURES, 0, 4,
+        {{L_A, 600, 0, 0}, {L_GRAVE, 0, 250, 100}, {L_ACUTE, 0, 250, 400}, {L_V, 600, 0, 0}}},
+
+    // cursive attachment, the exit of a glyph joins the entry of the next one
+    {"cursive", "HzTestLayout.ttf", "klk", HZ_DIRECTION_LTR, CURS_FEATURES, 0, 3,
+        {{L_k, 400, 0, 0}, {L_l, 400, -50, 50}, {L_k, 500, 0, 250}}},
+    {"cursive, broken chain", "HzTestLayout.ttf", "kal", HZ_DIRECTION_LTR, CURS_FEATURES, 0, 3,
+        {{L_k, 500, 0, 0}, {L_a, 500, 0, 0}, {L_l, 450, 0, 0}}},
+    {"cursive, right to left", "HzTestLayout.ttf", "klk", HZ_DIRECTION_RTL, CURS_FEATURES, 0, 3,
+        {{L_k, 0, 0, 250}, {L_l, -400, -450, 50}, {L_k, 100, -400, 0}}},
+
+    // variations: HVAR advances, varied kerning and anchors, FeatureVariations swap a for a.alt from 600
+    {"default instance", "HzTestVar.ttf", "AVa a\xcc\x81", HZ_DIRECTION_LTR, VAR_FEATURES, 0, 6,
+        {{V_A, 520, 0, 0}, {V_V, 560, 0, 0}, {V_a, 500, 0, 0}, {V_SPACE, 250, 0, 0}, {V_a, 500, 0, 0}, {V_ACUTE, 0, 250, 20}}},
+    {"wght 250", "HzTestVar.ttf", "AVa a\xcc\x81", HZ_DIRECTION_LTR, VAR_FEATURES, 250, 6,
+        {{V_A, 524, 0, 0}, {V_V, 571, 0, 0}, {V_a, 510, 0, 0}, {V_SPACE, 250, 0, 0}, {V_a, 510, 0, 0}, {V_ACUTE, 0, 250, 27}}},
+    {"wght 400", "HzTestVar.ttf", "AVa a\xcc\x81", HZ_DIRECTION_LTR, VAR_FEATURES, 400, 6,
+        {{V_A, 528, 0, 0}, {V_V, 583, 0, 0}, {V_a, 520, 0, 0}, {V_SPACE, 250, 0, 0}, {V_a, 520, 0, 0}, {V_ACUTE, 0, 250, 32}}},
+    {"wght 650", "HzTestVar.ttf", "AVa a\xcc\x81", HZ_DIRECTION_LTR, VAR_FEATURES, 650, 6,
+        {{V_A, 539, 0, 0}, {V_V, 675, 0, 0}, {V_a_alt, 576, 0, 0}, {V_SPACE, 250, 0, 0}, {V_a_alt, 576, 0, 0}, {V_ACUTE, 0, 0, 0}}},
+    {"wght 900", "HzTestVar.ttf", "AVa a\xcc\x81", HZ_DIRECTION_LTR, VAR_FEATURES, 900, 6,
+        {{V_A, 550, 0, 0}, {V_V, 720, 0, 0}, {V_a_alt, 610, 0, 0}, {V_SPACE, 250, 0, 0}, {V_a_alt, 610, 0, 0}, {V_ACUTE, 0, 0, 0}}},
+    {"wght 100", "HzTestVar.ttf", "AVa a\xcc\x81", HZ_DIRECTION_LTR, VAR_FEATURES, 100, 6,
+        {{V_A, 520, 0, 0}, {V_V, 560, 0, 0}, {V_a, 500, 0, 0}, {V_SPACE, 250, 0, 0}, {V_a, 500, 0, 0}, {V_ACUTE, 0, 250, 20}}},
+};
+
+// layers of HzTestColr.ttf, colors are packed with red in the low byte
+static const color_test_t color_tests[] = {
+    {C_A, 2, {{C_L0, 0, 0xff0000ff}, {C_L1, 0, 0xff00ff00}}}, // COLR v0
+    {C_B, 3, {{C_L2, 0, 0x80ff0000}, {C_L0, HZ_COLOR_LAYER_FOREGROUND, 0x80ffffff}, {C_L1, 0, 0x4000ff00}}}, // v1, nests C
+    {C_C, 1, {{C_L1, 0, 0x4000ff00}}},
+    {C_D, 0, {{0}}}, // no color glyph
+    // paint graphs that never end or blow up are dropped whole
+    {C_E, 0, {{0}}},
+    {C_F, 0, {{0}}},
+    {C_G, 0, {{0}}},
+    {C_H, 0, {{0}}},
+};
+
+typedef struct {
+    char *data;
+    stbtt_fontinfo info;
+    hz_font_t *font;
+    hz_font_data_t *font_data;
+} test_font_t;
+
+static int test_font_load(test_font_t *f, const char *fonts_dir, const char *name) {
+    char path[1024];
+    size_t size;
+    snprintf(path, sizeof path, "%s/%s", fonts_dir, name);
+
+    if ((f->data = hz_test_read_file(path, &size)) == NULL) {
+        fprintf(stderr, "can't read %s\n", path);
+        return 0;
+    }
+
+    if (!stbtt_InitFont(&f->info, (const unsigned char *)f->data, 0)) {
+        fprintf(stderr, "can't load %s\n", path);
+        free(f->data);
+        return 0;
+    }
+
+    f->font = hz_stbtt_font_create(&f->info);
+    f->font_data = hz_font_data_create(f->font);
+    return 1;
+}
+
+static void test_font_release(test_font_t *f) {
+    hz_font_data_release(f->font_data);
+    hz_face_destroy(hz_font_get_face(f->font));
+    hz_font_destroy(f->font);
+    free(f->data);
+}
+
+static void run_shaping_test(hz_shaper_t *shaper, test_font_t *f, const shaping_test_t *test) {
+    if (test->weight != 0) {
+        hz_variation_t wght = {HZ_TAG('w','g','h','t'), test->weight};
+        hz_font_set_variations(f->font, 1, &wght);
+    } else {
+        hz_font_set_variations(f->font, 0, NULL);
+    }
+
+    hz_shaper_set_features(shaper, test->feature_count, test->features);
+    hz_shaper_set_direction(shaper, test->direction);
+
+    hz_buffer_t buffer;
+    hz_buffer_init(&buffer);
+    hz_shape_sz1(shaper, f->font_data, HZ_ENCODING_UTF8, test->text, &buffer);
+
+    int ok = buffer.glyph_count == test->glyph_count;
+    for (size_t i = 0; ok && i < test->glyph_count; ++i) {
+        const expected_glyph_t *e = &test->glyphs[i];
+        const hz_glyph_metrics_t *m = &buffer.glyph_metrics[i];
+        ok = buffer.glyph_indices[i] == e->id && (int32_t)m->xAdvance == e->x_advance
+            && (int32_t)m->xOffset == e->x_offset && (int32_t)m->yOffset == e->y_offset;
+    }
+
+    if (!HZ_TEST_CHECK(ok)) {
+        fprintf(stderr, "  %s (%s)\n  expected:", test->name, test->font);
+        for (size_t i = 0; i < test->glyph_count; ++i) {
+            const expected_glyph_t *e = &test->glyphs[i];
+            fprintf(stderr, " {%u,%d,%d,%d}", e->id, e->x_advance, e->x_offset, e->y_offset);
+        }
+
+        fprintf(stderr, "\n  got:     ");
+        for (size_t i = 0; i < buffer.glyph_count; ++i) {
+            const hz_glyph_metrics_t *m = &buffer.glyph_metrics[i];
+            fprintf(stderr, " {%u,%d,%d,%d}", buffer.glyph_indices[i],
+                    (int32_t)m->xAdvance, (int32_t)m->xOffset, (int32_t)m->yOffset);
+        }
+        fprintf(stderr, "\n");
+    }
+
+    hz_buffer_release(&buffer);
+}
+
+static void run_color_test(hz_face_t *face, const color_test_t *test) {
+    const hz_color_layer_t *layers;
+    size_t count = hz_face_get_glyph_color_layers(face, test->glyph, &layers);
+
+    int ok = count == test->layer_count;
+    for (size_t i = 0; ok && i < count; ++i) {
+        ok = layers[i].glyph == test->layers[i].glyph && layers[i].flags == test->layers[i].flags
+            && layers[i].color_rgba == test->layers[i].color_rgba;
+    }
+
+    if (!HZ_TEST_CHECK(ok)) {
+        fprintf(stderr, "  color layers of glyph %u, got:", test->glyph);
+        for (size_t i = 0; i < count; ++i)
+            fprintf(stderr, " {%u,%x,%08x}", layers[i].glyph, layers[i].flags, layers[i].color_rgba);
+        fprintf(stderr, "\n");
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory> [--table-views]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (argc > 2 && !strcmp(argv[2], "--table-views"))
+        cfg.flags |= HZ_CONFIG_FLAG_TABLE_VIEWS;
+
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    hz_shaper_t *shaper = hz_shaper_create();
+    hz_shaper_set_script(shaper, HZ_SCRIPT_LATIN);
+    hz_shaper_set_language(shaper, HZ_LANGUAGE_ENGLISH);
+
+    const char *fonts[] = {"HzTestLayout.ttf", "HzTestVar.ttf"};
+    for (size_t i = 0; i < sizeof fonts / sizeof fonts[0]; ++i) {
+        test_font_t f;
+        if (!HZ_TEST_CHECK(test_font_load(&f, argv[1], fonts[i])))
+            continue;
+
+        for (int pass = 0; pass < SHAPING_PASSES; ++pass) {
+            for (size_t t = 0; t < sizeof shaping_tests / sizeof shaping_tests[0]; ++t) {
+                if (!strcmp(shaping_tests[t].font, fonts[i]))
+                    run_shaping_test(shaper, &f, &shaping_tests[t]);
+            }
+        }
+
+        test_font_release(&f);
+    }
+
+    test_font_t colr;
+    if (HZ_TEST_CHECK(test_font_load(&colr, argv[1], "HzTestColr.ttf"))) {
+        for (size_t t = 0; t < sizeof color_tests / sizeof color_tests[0]; ++t)
+            run_color_test(hz_font_get_face(colr.font), &color_tests[t]);
+
+        test_font_release(&colr);
+    }
+
+    hz_shaper_destroy(shaper);
+    hz_deinit();
+    return hz_test_report(cfg.flags & HZ_CONFIG_FLAG_TABLE_VIEWS ? "shaping with table views" : "shaping");
+}
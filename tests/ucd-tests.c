@@ -0,0 +1,242 @@
+// Tests of the UCD property table: values of characters across the trie's blocks, codepoints past
+// the end of Unicode, and hz_ucd_lookup_n giving the values of the single character lookups, whether
+// it walks the trie eight characters at a time or one by one. Then the tables of older UCD versions:
+// characters assigned or changed since, lookups of several versions side by side, and the bidi,
+// script and line break algorithms following the version they are given.
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define CODEPOINT_COUNT 0x110000
+#define EXTRA_COUNT 8 // past the end of Unicode
+
+typedef struct {
+    hz_unicode_t c;
+    hz_general_category_t general_category;
+    hz_script_t script;
+    hz_bidi_class_t bidi_class;
+    hz_line_break_class_t line_break;
+    uint8_t combining_class;
+} ucd_test_t;
+
+static const ucd_test_t ucd_tests[] = {
+    {'A', HZ_GENERAL_CATEGORY_LU, HZ_SCRIPT_LATIN, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_AL, 0},
+    {' ', HZ_GENERAL_CATEGORY_ZS, HZ_SCRIPT_COMMON, HZ_BIDI_CLASS_WS, HZ_LINE_BREAK_CLASS_SP, 0},
+    {'1', HZ_GENERAL_CATEGORY_ND, HZ_SCRIPT_COMMON, HZ_BIDI_CLASS_EN, HZ_LINE_BREAK_CLASS_NU, 0},
+    {0x0301, HZ_GENERAL_CATEGORY_MN, HZ_SCRIPT_INHERITED, HZ_BIDI_CLASS_NSM, HZ_LINE_BREAK_CLASS_CM, 230},
+    {0x05D0, HZ_GENERAL_CATEGORY_LO, HZ_SCRIPT_HEBREW, HZ_BIDI_CLASS_R, HZ_LINE_BREAK_CLASS_HL, 0},
+    {0x0628, HZ_GENERAL_CATEGORY_LO, HZ_SCRIPT_ARABIC, HZ_BIDI_CLASS_AL, HZ_LINE_BREAK_CLASS_AL, 0},
+    {0x0E01, HZ_GENERAL_CATEGORY_LO, HZ_SCRIPT_THAI, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_SA, 0},
+    {0x4E00, HZ_GENERAL_CATEGORY_LO, HZ_SCRIPT_HAN, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_ID, 0},
+    {0xAC00, HZ_GENERAL_CATEGORY_LO, HZ_SCRIPT_HANGUL, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_H2, 0},
+    {0xD800, HZ_GENERAL_CATEGORY_CS, HZ_SCRIPT_UNKNOWN, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_SG, 0},
+    {0xE000, HZ_GENERAL_CATEGORY_CO, HZ_SCRIPT_UNKNOWN, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_XX, 0},
+    {0x1F600, HZ_GENERAL_CATEGORY_SO, HZ_SCRIPT_COMMON, HZ_BIDI_CLASS_ON, HZ_LINE_BREAK_CLASS_ID, 0},
+    {0x1F466, HZ_GENERAL_CATEGORY_SO, HZ_SCRIPT_COMMON, HZ_BIDI_CLASS_ON, HZ_LINE_BREAK_CLASS_EB, 0},
+    {0x1E900, HZ_GENERAL_CATEGORY_LU, HZ_SCRIPT_ADLAM, HZ_BIDI_CLASS_R, HZ_LINE_BREAK_CLASS_AL, 0},
+    {0xE0001, HZ_GENERAL_CATEGORY_CF, HZ_SCRIPT_COMMON, HZ_BIDI_CLASS_BN, HZ_LINE_BREAK_CLASS_CM, 0},
+    // unassigned, and the last codepoint, a noncharacter
+    {0x0378, HZ_GENERAL_CATEGORY_CN, HZ_SCRIPT_UNKNOWN, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_XX, 0},
+    {0x10FFFF, HZ_GENERAL_CATEGORY_CN, HZ_SCRIPT_UNKNOWN, HZ_BIDI_CLASS_BN, HZ_LINE_BREAK_CLASS_XX, 0},
+};
+
+static void run_ucd_test(const ucd_test_t *test) {
+    int ok = hz_ucd_general_category(NULL, test->c) == test->general_category
+        && hz_ucd_script(NULL, test->c) == test->script
+        && hz_ucd_bidi_class(NULL, test->c) == test->bidi_class
+        && hz_ucd_line_break_class(NULL, test->c) == test->line_break
+        && hz_ucd_combining_class(test->c) == test->combining_class;
+    if (!HZ_TEST_CHECK(ok))
+        fprintf(stderr, "  for U+%04X\n", test->c);
+}
+
+static uint8_t lookup(const hz_ucd_t *ucd, hz_unicode_t c, hz_ucd_property_t property) {
+    uint8_t value;
+    hz_ucd_lookup_n(ucd, &c, 1, property, &value);
+    return value;
+}
+
+static void test_joining(void) {
+    // the joining type is stored as n of the flag 1 << (16 + n)
+    HZ_TEST_CHECK(1u << (16 + lookup(NULL, 0x0628, HZ_UCD_PROPERTY_JOINING_TYPE)) == HZ_JOINING_TYPE_D);
+    HZ_TEST_CHECK(lookup(NULL, 0x0628, HZ_UCD_PROPERTY_JOINING_GROUP) == HZ_JOINING_GROUP_BEH);
+    HZ_TEST_CHECK(1u << (16 + lookup(NULL, 0x0627, HZ_UCD_PROPERTY_JOINING_TYPE)) == HZ_JOINING_TYPE_R);
+    HZ_TEST_CHECK(1u << (16 + lookup(NULL, 0x0640, HZ_UCD_PROPERTY_JOINING_TYPE)) == HZ_JOINING_TYPE_C);
+    HZ_TEST_CHECK(1u << (16 + lookup(NULL, 0x064B, HZ_UCD_PROPERTY_JOINING_TYPE)) == HZ_JOINING_TYPE_T);
+    HZ_TEST_CHECK(1u << (16 + lookup(NULL, 'A', HZ_UCD_PROPERTY_JOINING_TYPE)) == HZ_JOINING_TYPE_U);
+    HZ_TEST_CHECK(lookup(NULL, 'A', HZ_UCD_PROPERTY_JOINING_GROUP) == HZ_JOINING_GROUP_NONE);
+}
+
+static void test_mirror(void) {
+    HZ_TEST_CHECK(hz_ucd_mirror('(') == ')' && hz_ucd_mirror(')') == '(');
+    HZ_TEST_CHECK(hz_ucd_mirror('<') == '>' && hz_ucd_mirror(0x2264) == 0x2265);
+    HZ_TEST_CHECK(hz_ucd_mirror('A') == 'A' && hz_ucd_mirror(0x110000) == 0x110000);
+}
+
+static void test_past_end(void) {
+    static const hz_unicode_t past_end[] = {0x110000, 0x1FFFFF, 0x7FFFFFFF, 0xFFFFFFFF};
+    int ok = 1;
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(past_end); ++i) {
+        hz_unicode_t c = past_end[i];
+        ok &= hz_ucd_general_category(NULL, c) == HZ_GENERAL_CATEGORY_CN && hz_ucd_script(NULL, c) == HZ_SCRIPT_UNKNOWN
+            && hz_ucd_bidi_class(NULL, c) == HZ_BIDI_CLASS_L && hz_ucd_line_break_class(NULL, c) == HZ_LINE_BREAK_CLASS_XX
+            && hz_ucd_combining_class(c) == 0;
+    }
+    HZ_TEST_CHECK(ok);
+}
+
+// Compares the values hz_ucd_lookup_n gives for all codepoints, from every offset in a group of
+// eight so the vector loop's tail and misaligned loads are covered, with the lookups of single
+// characters, which never take the vector loop.
+static void test_lookup_n(const hz_ucd_t *ucd) {
+    size_t count = CODEPOINT_COUNT + EXTRA_COUNT;
+    hz_unicode_t *chars = malloc(count * sizeof(hz_unicode_t));
+    uint8_t *values = malloc(count), *expected = malloc(count);
+
+    for (hz_unicode_t c = 0; c < CODEPOINT_COUNT; ++c) chars[c] = c;
+    for (size_t i = 0; i < EXTRA_COUNT; ++i) chars[CODEPOINT_COUNT + i] = 0xFFFFFFFFu - (hz_unicode_t)i * 0x10000000u;
+
+    for (hz_ucd_property_t property = HZ_UCD_PROPERTY_GENERAL_CATEGORY; property <= HZ_UCD_PROPERTY_COMBINING_CLASS;
+         ++property) {
+        for (size_t i = 0; i < count; ++i)
+            expected[i] = lookup(ucd, chars[i], property);
+
+        int ok = 1;
+        for (size_t offset = 0; offset < 8; ++offset) {
+            memset(values, 0xff, count);
+            hz_ucd_lookup_n(ucd, chars + offset, count - offset, property, values + offset);
+            ok &= !memcmp(values + offset, expected + offset, count - offset);
+        }
+        if (!HZ_TEST_CHECK(ok))
+            fprintf(stderr, "  for property %d\n", (int)property);
+    }
+
+    // the single character lookups read the same table
+    int ok = 1;
+    for (hz_unicode_t c = 0; c < CODEPOINT_COUNT; ++c) {
+        ok &= lookup(ucd, c, HZ_UCD_PROPERTY_GENERAL_CATEGORY) == hz_ucd_general_category(ucd, c)
+            && lookup(ucd, c, HZ_UCD_PROPERTY_SCRIPT) == hz_ucd_script(ucd, c)
+            && lookup(ucd, c, HZ_UCD_PROPERTY_BIDI_CLASS) == hz_ucd_bidi_class(ucd, c)
+            && lookup(ucd, c, HZ_UCD_PROPERTY_LINE_BREAK_CLASS) == hz_ucd_line_break_class(ucd, c)
+            && lookup(ucd, c, HZ_UCD_PROPERTY_COMBINING_CLASS) == hz_ucd_combining_class(c);
+    }
+    HZ_TEST_CHECK(ok);
+
+    // nothing is written past count
+    memset(values, 0xab, 16);
+    hz_ucd_lookup_n(ucd, chars + 'A', 9, HZ_UCD_PROPERTY_GENERAL_CATEGORY, values);
+    HZ_TEST_CHECK(values[0] == HZ_GENERAL_CATEGORY_LU && values[9] == 0xab);
+
+    free(chars);
+    free(values);
+    free(expected);
+}
+
+// Checks the values of c in ucd against a test of the same layout.
+static int ucd_is(const hz_ucd_t *ucd, const ucd_test_t *test) {
+    return hz_ucd_general_category(ucd, test->c) == test->general_category
+        && hz_ucd_script(ucd, test->c) == test->script
+        && hz_ucd_bidi_class(ucd, test->c) == test->bidi_class
+        && hz_ucd_line_break_class(ucd, test->c) == test->line_break;
+}
+
+static void test_versions(void) {
+    HZ_TEST_CHECK(hz_ucd_create(HZ_MAKE_VERSION(3,2,0)) == NULL);
+    HZ_TEST_CHECK(hz_ucd_create(HZ_MAKE_VERSION(15,1,0)) == NULL);
+
+    hz_ucd_t *v5 = hz_ucd_create(HZ_MAKE_VERSION(5,0,0)), *v6 = hz_ucd_create(HZ_MAKE_VERSION(6,0,0));
+    hz_ucd_t *v61 = hz_ucd_create(HZ_MAKE_VERSION(6,1,0)), *v14 = hz_ucd_create(HZ_MAKE_VERSION(14,0,0));
+    hz_ucd_t *newest = hz_ucd_create(HZ_UCD_VERSION);
+    if (!HZ_TEST_CHECK(v5 && v6 && v61 && v14 && newest)) return;
+
+    // the newest version is the table of NULL
+    int ok = 1;
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(ucd_tests); ++i) ok &= ucd_is(newest, &ucd_tests[i]);
+    HZ_TEST_CHECK(ok);
+
+    // ARABIC LETTER BEH WITH SMALL V BELOW, added in 6.1, unassigned before it in a block of AL defaults
+    const ucd_test_t beh_v6 = {0x08A0, HZ_GENERAL_CATEGORY_CN, HZ_SCRIPT_UNKNOWN, HZ_BIDI_CLASS_AL, HZ_LINE_BREAK_CLASS_XX, 0};
+    const ucd_test_t beh_v61 = {0x08A0, HZ_GENERAL_CATEGORY_LO, HZ_SCRIPT_ARABIC, HZ_BIDI_CLASS_AL, HZ_LINE_BREAK_CLASS_AL, 0};
+    HZ_TEST_CHECK(ucd_is(v6, &beh_v6) && ucd_is(v61, &beh_v61) && ucd_is(NULL, &beh_v61));
+    HZ_TEST_CHECK(1u << (16 + lookup(v6, 0x08A0, HZ_UCD_PROPERTY_JOINING_TYPE)) == HZ_JOINING_TYPE_U);
+    HZ_TEST_CHECK(1u << (16 + lookup(v61, 0x08A0, HZ_UCD_PROPERTY_JOINING_TYPE)) == HZ_JOINING_TYPE_D);
+    HZ_TEST_CHECK(lookup(v61, 0x08A0, HZ_UCD_PROPERTY_JOINING_GROUP) == HZ_JOINING_GROUP_BEH);
+
+    // KANNADA SIGN COMBINING ANUSVARA ABOVE RIGHT, added in 15.0
+    const ucd_test_t anusvara_v14 = {0x0CF3, HZ_GENERAL_CATEGORY_CN, HZ_SCRIPT_UNKNOWN, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_XX, 0};
+    const ucd_test_t anusvara = {0x0CF3, HZ_GENERAL_CATEGORY_MC, HZ_SCRIPT_KANNADA, HZ_BIDI_CLASS_L, HZ_LINE_BREAK_CLASS_CM, 0};
+    HZ_TEST_CHECK(ucd_is(v14, &anusvara_v14) && ucd_is(NULL, &anusvara));
+
+    // a character whose joining group changed, and ones that didn't change at all, the ones of the
+    // BMP were all assigned by 5.0
+    HZ_TEST_CHECK(lookup(v5, 0x06CC, HZ_UCD_PROPERTY_JOINING_GROUP) == HZ_JOINING_GROUP_YEH);
+    HZ_TEST_CHECK(lookup(NULL, 0x06CC, HZ_UCD_PROPERTY_JOINING_GROUP) == HZ_JOINING_GROUP_FARSI_YEH);
+    ok = 1;
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(ucd_tests); ++i)
+        ok &= (ucd_tests[i].c > 0xFFFF || ucd_is(v5, &ucd_tests[i])) && ucd_is(v14, &ucd_tests[i]);
+    HZ_TEST_CHECK(ok && lookup(v5, 0x0628, HZ_UCD_PROPERTY_JOINING_GROUP) == HZ_JOINING_GROUP_BEH);
+
+    // an older version goes through the same vector and scalar lookups
+    test_lookup_n(v5);
+
+    hz_ucd_destroy(v5);
+    hz_ucd_destroy(v6);
+    hz_ucd_destroy(v61);
+    hz_ucd_destroy(v14);
+    hz_ucd_destroy(newest);
+    hz_ucd_destroy(NULL);
+}
+
+// The algorithms built on the lookups follow the version they are given.
+static void test_version_algorithms(void) {
+    hz_ucd_t *v6 = hz_ucd_create(HZ_MAKE_VERSION(6,0,0)), *v14 = hz_ucd_create(HZ_MAKE_VERSION(14,0,0));
+    if (!HZ_TEST_CHECK(v6 && v14)) return;
+
+    // ARABIC SMALL LOW WORD SAKTA, added in 15.0, was an AL default before it
+    static uint8_t mem[HZ_BIDI_SCRATCH_SIZE(2)];
+    hz_memory_arena_t scratch = hz_memory_arena_create(mem, sizeof mem);
+    hz_bidi_paragraph_t para;
+    const hz_unicode_t sakta[] = {'a', 0x10EFD};
+    HZ_TEST_CHECK(hz_bidi_resolve_paragraph(NULL, &scratch, sakta, 2, HZ_DIRECTION_LTR, &para)
+                  && para.levels[0] == 0 && para.levels[1] == 0);
+    hz_memory_arena_reset(&scratch);
+    HZ_TEST_CHECK(hz_bidi_resolve_paragraph(v14, &scratch, sakta, 2, HZ_DIRECTION_LTR, &para)
+                  && para.levels[0] == 0 && para.levels[1] == 1);
+
+    // U+08A0 had no script in 6.0, so it splits the Arabic run
+    hz_script_run_t runs[3];
+    const hz_unicode_t beh[] = {0x0628, 0x08A0, 0x0628};
+    HZ_TEST_CHECK(hz_itemize_scripts(NULL, beh, 3, runs) == 1 && runs[0].script == HZ_SCRIPT_ARABIC);
+    HZ_TEST_CHECK(hz_itemize_scripts(v6, beh, 3, runs) == 3 && runs[1].script == HZ_SCRIPT_UNKNOWN);
+
+    // U+1F6DC, added in 15.0, is an ideograph a line can break before, unassigned it is alphabetic
+    uint8_t breaks[2];
+    const hz_unicode_t wireless[] = {'a', 0x1F6DC};
+    hz_find_line_breaks(NULL, wireless, 2, breaks);
+    HZ_TEST_CHECK(breaks[1] == HZ_LINE_BREAK_ALLOWED);
+    hz_find_line_breaks(v14, wireless, 2, breaks);
+    HZ_TEST_CHECK(breaks[1] == HZ_LINE_BREAK_NONE);
+
+    hz_ucd_destroy(v6);
+    hz_ucd_destroy(v14);
+}
+
+int main(void) {
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < HZ_ARRAY_SIZE(ucd_tests); ++i)
+        run_ucd_test(&ucd_tests[i]);
+    test_joining();
+    test_mirror();
+    test_past_end();
+    test_lookup_n(NULL);
+    test_versions();
+    test_version_algorithms();
+
+    hz_deinit();
+    return hz_test_report("ucd");
+}
@@ -1,8 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#define HZ_IMPLEMENTATION
-#include <hz/hz.h>
+// the benchmark calls internal functions, so it builds the library into itself
+#include <hz/hz.c>
 
 char *read_entire_file(const char *filename, size_t *out_size) {
     FILE *fp = fopen(filename,"rb");
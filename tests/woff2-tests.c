@@ -0,0 +1,236 @@
+// Tests of WOFF2 decoding and the Brotli decoder under it: a font decodes to the same glyphs and metrics as
+// the font it was made from, and truncated streams, malformed transforms, sizes over the limits and running
+// out of memory are all reported without reading or writing out of bounds.
+//
+// usage: hz_woff2_tests <fonts directory>
+
+#include <hz/hz.h>
+
+#include "hz_test.h"
+
+#define NUM_GLYPHS 5 // of HzTestGlyf
+
+static int failing_allocs = 0;
+
+static void *test_allocator_fn(void *user, hz_allocator_cmd_t cmd, void *ptr, size_t size, size_t align) {
+    (void)user; (void)align;
+    switch (cmd) {
+        case HZ_CMD_ALLOC: return failing_allocs ? NULL : malloc(size);
+        case HZ_CMD_REALLOC: return failing_allocs ? NULL : realloc(ptr, size);
+        case HZ_CMD_FREE: free(ptr); return NULL;
+        default: return NULL;
+    }
+}
+
+static uint32_t load_u32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static void store_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static size_t skip_base128(const uint8_t *data, size_t offset) {
+    while (data[offset++] & 0x80) {}
+    return offset;
+}
+
+// Offset of the flags byte of the table directory entry of known table index, 0 if there is none.
+static size_t find_table_flags(const uint8_t *data, uint8_t index) {
+    size_t offset = 48;
+    for (unsigned i = 0, n = (unsigned)data[12] << 8 | data[13]; i < n; ++i) {
+        uint8_t flags = data[offset];
+        if ((flags & 63) == index) return offset;
+
+        offset += (flags & 63) == 63 ? 5 : 1;
+        offset = skip_base128(data, offset);
+        int transformed = (flags & 63) == 10 || (flags & 63) == 11 ? flags >> 6 != 3 : flags >> 6 != 0;
+        if (transformed) offset = skip_base128(data, offset);
+    }
+
+    return 0;
+}
+
+static int vec2_eq(hz_vec2 a, hz_vec2 b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+// Compares the curves field by field, the control points of lines aren't set.
+static int draw_data_equal(const hz_shape_draw_data_t *a, const hz_shape_draw_data_t *b) {
+    size_t vert_count = hz_vector_size(a->verts), contour_count = hz_vector_size(a->contours);
+    if (vert_count != hz_vector_size(b->verts) || contour_count != hz_vector_size(b->contours)) return 0;
+
+    for (size_t i = 0; i < vert_count; ++i) {
+        const hz_bezier_vertex_t *va = &a->verts[i], *vb = &b->verts[i];
+        if (va->type != vb->type || !vec2_eq(va->v1, vb->v1) || !vec2_eq(va->v2, vb->v2)) return 0;
+        if (va->type != HZ_VERTEX_TYPE_LINE && !vec2_eq(va->c1, vb->c1)) return 0;
+        if (va->type == HZ_VERTEX_TYPE_CUBIC_BEZIER && !vec2_eq(va->c2, vb->c2)) return 0;
+    }
+
+    for (size_t i = 0; i < contour_count; ++i) {
+        const hz_contour_t *ca = &a->contours[i], *cb = &b->contours[i];
+        if (ca->first_curve != cb->first_curve || ca->curve_count != cb->curve_count
+            || !vec2_eq(ca->origin, cb->origin))
+            return 0;
+    }
+
+    return 1;
+}
+
+// Checks that two fonts have the same outlines and glyph metrics.
+static int fonts_match(hz_font_t *a, hz_font_t *b) {
+    hz_face_t *face_a = hz_font_get_face(a), *face_b = hz_font_get_face(b);
+    int ok = 1;
+    for (hz_index_t g = 0; g < NUM_GLYPHS; ++g) {
+        hz_shape_draw_data_t dd_a = {0}, dd_b = {0};
+        hz_face_get_glyph_shape(face_a, &dd_a, (hz_vec2){0.0f, 0.0f}, 1.0f, g);
+        hz_face_get_glyph_shape(face_b, &dd_b, (hz_vec2){0.0f, 0.0f}, 1.0f, g);
+        ok &= hz_vector_size(dd_a.contours) > 0 || g == 0;
+        ok &= draw_data_equal(&dd_a, &dd_b);
+        hz_shape_draw_data_clear(&dd_a);
+        hz_shape_draw_data_clear(&dd_b);
+
+        const hz_metrics_t *m_a = hz_face_get_glyph_metrics(face_a, g), *m_b = hz_face_get_glyph_metrics(face_b, g);
+        ok &= m_a != NULL && m_b != NULL && !memcmp(m_a, m_b, sizeof *m_a); // no padding, every field is set
+    }
+
+    return ok;
+}
+
+static hz_error_t decode(const uint8_t *data, size_t size) {
+    size_t capacity = hz_woff2_get_sfnt_size(data, size), sfnt_size;
+    uint8_t *sfnt = malloc(capacity ? capacity : 1);
+    hz_error_t err = hz_woff2_decode(data, size, sfnt, capacity, &sfnt_size);
+    free(sfnt);
+    return err;
+}
+
+static void test_round_trip(const uint8_t *woff2, size_t woff2_size, hz_font_t *ttf) {
+    size_t capacity = hz_woff2_get_sfnt_size(woff2, woff2_size), sfnt_size = 0;
+    HZ_TEST_CHECK(capacity > 0);
+
+    uint8_t *sfnt = malloc(capacity);
+    HZ_TEST_CHECK(hz_woff2_decode(woff2, woff2_size, sfnt, capacity, &sfnt_size) == HZ_OK);
+    HZ_TEST_CHECK(sfnt_size > 0 && sfnt_size <= capacity);
+    free(sfnt);
+
+    // a buffer too small for the font
+    sfnt = malloc(capacity);
+    HZ_TEST_CHECK(hz_woff2_decode(woff2, woff2_size, sfnt, sfnt_size - 1, &sfnt_size) == HZ_ERROR_INVALID_PARAM);
+    free(sfnt);
+
+    hz_font_t *font = hz_font_load_woff2_from_memory(woff2, woff2_size);
+    if (HZ_TEST_CHECK(font != NULL)) {
+        HZ_TEST_CHECK(fonts_match(font, ttf));
+        hz_face_destroy(hz_font_get_face(font));
+        hz_font_destroy(font);
+    }
+}
+
+static void test_truncated(const uint8_t *woff2, size_t woff2_size) {
+    // the compressed stream cut short anywhere, the header still consistent
+    uint8_t *data = malloc(woff2_size);
+    uint32_t compressed_size = load_u32(woff2 + 20);
+    int ok = 1, truncated = 0;
+    for (uint32_t n = 1; n < compressed_size; ++n) {
+        memcpy(data, woff2, woff2_size);
+        store_u32(data + 20, n);
+        hz_error_t err = decode(data, woff2_size);
+        ok &= err == HZ_ERROR_INVALID_FORMAT || err == HZ_ERROR_BROTLI_STREAM_REJECTED;
+        truncated += err == HZ_ERROR_INVALID_FORMAT;
+    }
+    HZ_TEST_CHECK(ok);
+    // the decoder stops on reading past the end, whatever the zeros after it would decode to
+    memcpy(data, woff2, woff2_size);
+    store_u32(data + 20, compressed_size - 1);
+    HZ_TEST_CHECK(decode(data, woff2_size) == HZ_ERROR_INVALID_FORMAT);
+    HZ_TEST_CHECK(truncated > 0);
+
+    // the file itself cut short
+    HZ_TEST_CHECK(decode(woff2, woff2_size - 4) == HZ_ERROR_INVALID_FORMAT);
+    HZ_TEST_CHECK(hz_woff2_get_sfnt_size(woff2, 40) == 0);
+    free(data);
+}
+
+static void test_malformed(const uint8_t *woff2, size_t woff2_size, const uint8_t *bad_glyf, size_t bad_glyf_size) {
+    // the glyph stream ends in the triplets of a glyph
+    HZ_TEST_CHECK(decode(bad_glyf, bad_glyf_size) == HZ_ERROR_INVALID_FORMAT);
+    HZ_TEST_CHECK(hz_font_load_woff2_from_memory(bad_glyf, bad_glyf_size) == NULL);
+
+    uint8_t *data = malloc(woff2_size);
+
+    // hmtx only has transform version 1
+    memcpy(data, woff2, woff2_size);
+    size_t hmtx = find_table_flags(data, 3);
+    HZ_TEST_CHECK(hmtx != 0 && data[hmtx] >> 6 == 1);
+    data[hmtx] = (uint8_t)((data[hmtx] & 63) | 2 << 6);
+    HZ_TEST_CHECK(decode(data, woff2_size) == HZ_ERROR_INVALID_FORMAT);
+
+    // glyf is transformed but loca isn't
+    memcpy(data, woff2, woff2_size);
+    size_t loca = find_table_flags(data, 11);
+    HZ_TEST_CHECK(loca != 0 && data[loca] >> 6 == 0);
+    data[loca] |= 3 << 6; // the null transform of loca, its transformed length of zero is read as orig_length
+    HZ_TEST_CHECK(decode(data, woff2_size) != HZ_OK);
+
+    // a totalSfntSize over the limit isn't allocated
+    memcpy(data, woff2, woff2_size);
+    store_u32(data + 16, 0x7FFFFFFF);
+    HZ_TEST_CHECK(hz_woff2_get_sfnt_size(data, woff2_size) == 0);
+    HZ_TEST_CHECK(hz_font_load_woff2_from_memory(data, woff2_size) == NULL);
+
+    free(data);
+}
+
+static void test_out_of_memory(const uint8_t *woff2, size_t woff2_size) {
+    size_t capacity = hz_woff2_get_sfnt_size(woff2, woff2_size), sfnt_size;
+    uint8_t *sfnt = malloc(capacity);
+
+    failing_allocs = 1;
+    HZ_TEST_CHECK(hz_woff2_decode(woff2, woff2_size, sfnt, capacity, &sfnt_size) == HZ_ERROR_OUT_OF_MEMORY);
+    HZ_TEST_CHECK(hz_font_load_woff2_from_memory(woff2, woff2_size) == NULL);
+    HZ_TEST_CHECK(hz_font_load_woff2_from_memory_base85(HZ_BASE85_ENCODING_ADOBE, "87cURD]i,\"Ebo80") == NULL);
+    failing_allocs = 0;
+
+    free(sfnt);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <fonts directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    hz_config_t cfg = {0};
+    if (hz_init(&cfg) != HZ_OK) {
+        return EXIT_FAILURE;
+    }
+    hz_set_allocator_fn(test_allocator_fn);
+
+    char path[1024];
+    size_t ttf_size, woff2_size, bad_glyf_size;
+    snprintf(path, sizeof path, "%s/HzTestGlyf.ttf", argv[1]);
+    char *ttf_data = hz_test_read_file(path, &ttf_size);
+    snprintf(path, sizeof path, "%s/HzTestGlyf.woff2", argv[1]);
+    uint8_t *woff2 = (uint8_t *)hz_test_read_file(path, &woff2_size);
+    snprintf(path, sizeof path, "%s/HzTestBadGlyf.woff2", argv[1]);
+    uint8_t *bad_glyf = (uint8_t *)hz_test_read_file(path, &bad_glyf_size);
+
+    stbtt_fontinfo info;
+    if (HZ_TEST_CHECK(ttf_data != NULL && woff2 != NULL && bad_glyf != NULL
+                      && stbtt_InitFont(&info, (const unsigned char *)ttf_data, 0))) {
+        hz_font_t *ttf = hz_stbtt_font_create(&info);
+        test_round_trip(woff2, woff2_size, ttf);
+        test_truncated(woff2, woff2_size);
+        test_malformed(woff2, woff2_size, bad_glyf, bad_glyf_size);
+        test_out_of_memory(woff2, woff2_size);
+        hz_face_destroy(hz_font_get_face(ttf));
+        hz_font_destroy(ttf);
+    }
+
+    free(ttf_data);
+    free(woff2);
+    free(bad_glyf);
+    hz_deinit();
+    return hz_test_report("woff2");
+}